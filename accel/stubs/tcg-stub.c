@@ -16,6 +16,10 @@
 #include "tcg/tcg.h"
 #include "exec/cpu-common.h"
 #include "exec/exec-all.h"
+#include "exec/tb-cache.h"
+#include "exec/tcg-profile.h"
+#include "qapi/error.h"
+#include "qapi/qapi-commands-misc.h"
 
 void tb_flush(CPUState *cpu)
 {
@@ -28,3 +32,20 @@ void tb_unlock(void)
 void tlb_set_dirty(CPUState *cpu, target_ulong vaddr)
 {
 }
+
+void tb_cache_configure(const char *path, uint64_t max_size, Error **errp)
+{
+}
+
+void tb_cache_save(void)
+{
+}
+
+void tcg_profile_set(bool enable)
+{
+}
+
+void qmp_x_tcg_profile_dump(const char *filename, Error **errp)
+{
+    error_setg(errp, "TCG profile is only available with accel=tcg");
+}
@@ -0,0 +1,590 @@
+/*
+ * Persistent translation block cache
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+
+#include "qemu/osdep.h"
+#include "qemu-common.h"
+#include "qapi/error.h"
+#include "qemu/error-report.h"
+#include "qemu/timer.h"
+#include "cpu.h"
+#include "exec/exec-all.h"
+#include "exec/memory.h"
+#include "exec/tb-cache.h"
+#include "exec/tb-hash.h"
+#include "tcg.h"
+
+/*
+ * The cache keeps the host code of the TBs translated in previous runs, so
+ * that booting the same guest again does not need to translate the same
+ * kernel and framework code.
+ *
+ * A TB is stored along with the guest code it was translated from and the
+ * host addresses in its code, as recorded by the backend; see
+ * tcg_note_host_addr.  TBs whose code cannot be relocated (for instance
+ * because the translator baked a host pointer into it) and TBs that span two
+ * guest pages are not stored.
+ *
+ * The file is mapped when the cache is configured, and the TBs are checked
+ * lazily, when the guest first executes their address: the guest code must
+ * be the same, and every host address must still be reachable.  The file as
+ * a whole is only used if it was written by the same binary for the same
+ * CPU model.
+ *
+ * When the cache is saved, the TBs that were found stale are dropped, and
+ * so are the ones that were not used for TB_CACHE_MAX_UNUSED_RUNS runs.
+ */
+
+#define TB_CACHE_MAGIC "QEMUTBC"
+#define TB_CACHE_VERSION 1
+#define TB_CACHE_MAX_UNUSED_RUNS 4
+
+/* Keeps the alignment of direct jumps, which are patched atomically */
+#define TB_CACHE_CODE_ALIGN 16
+
+typedef struct TBCacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t nb_entries;
+    uint8_t fingerprint[32];
+} TBCacheHeader;
+
+typedef struct TBCacheKey {
+    uint64_t phys_pc;
+    uint64_t pc;
+    uint64_t cs_base;
+    uint32_t flags;
+    uint32_t cflags;
+    uint32_t trace_vcpu_dstate;
+    uint32_t pad;
+} TBCacheKey;
+
+/* Followed by the relocations, the host code and search data, and the
+   guest code.  */
+typedef struct TBCacheEntry {
+    TBCacheKey key;
+    uint32_t entry_size;
+    uint16_t size;
+    uint16_t icount;
+    uint16_t jmp_reset_offset[2];
+    uint32_t jmp_target_arg[2];
+    uint32_t code_size;
+    uint32_t search_size;
+    uint16_t nb_relocs;
+    uint16_t unused_runs;
+} TBCacheEntry;
+
+QEMU_BUILD_BUG_ON(sizeof(TBCacheHeader) % 8);
+QEMU_BUILD_BUG_ON(sizeof(TBCacheEntry) % 8);
+QEMU_BUILD_BUG_ON(sizeof(TCGHostReloc) % 8);
+
+/* Marks a pending entry that was superseded by a later translation */
+#define TB_CACHE_DEAD UINT16_MAX
+
+enum {
+    TB_CACHE_UNUSED,
+    TB_CACHE_HIT,
+    TB_CACHE_STALE,
+};
+
+typedef struct TBCacheStats {
+    uint64_t lookups;
+    uint64_t hits;
+    uint64_t stale;
+    uint64_t translated;
+    uint64_t stored;
+    uint64_t not_relocatable;
+    uint64_t full;
+    int64_t translate_ns;
+    int64_t load_ns;
+} TBCacheStats;
+
+static struct {
+    char *path;
+    uint64_t max_size;
+    uint64_t size;
+
+    /* The file, from the previous runs */
+    GMappedFile *file;
+    const TBCacheEntry **entries;
+    uint8_t *state;
+    unsigned nb_entries;
+    GHashTable *index;
+    bool checked;
+    bool valid;
+
+    /* The TBs translated in this run */
+    GByteArray *pending;
+    GHashTable *pending_index;
+
+    TBCacheStats stats;
+} tb_cache;
+
+bool tb_cache_enabled;
+
+static inline const TCGHostReloc *entry_relocs(const TBCacheEntry *e)
+{
+    return (const void *)(e + 1);
+}
+
+static inline const uint8_t *entry_code(const TBCacheEntry *e)
+{
+    return (const void *)(entry_relocs(e) + e->nb_relocs);
+}
+
+/* The host code and search data, computed so that it can't wrap */
+static inline size_t entry_host_size(const TBCacheEntry *e)
+{
+    return (size_t)e->code_size + e->search_size;
+}
+
+static inline const uint8_t *entry_guest_code(const TBCacheEntry *e)
+{
+    return entry_code(e) + entry_host_size(e);
+}
+
+static inline size_t entry_size(unsigned nb_relocs, size_t code_size,
+                                size_t guest_size)
+{
+    return sizeof(TBCacheEntry) + nb_relocs * sizeof(TCGHostReloc) +
+           ROUND_UP(code_size + guest_size, 8);
+}
+
+static guint tb_cache_key_hash(gconstpointer p)
+{
+    const TBCacheKey *k = p;
+
+    return tb_hash_func(k->phys_pc, k->pc, k->flags, k->cflags,
+                        k->trace_vcpu_dstate);
+}
+
+static gboolean tb_cache_key_equal(gconstpointer a, gconstpointer b)
+{
+    return !memcmp(a, b, sizeof(TBCacheKey));
+}
+
+static void tb_cache_key_init(TBCacheKey *k, TranslationBlock *tb,
+                              tb_page_addr_t phys_pc)
+{
+    *k = (TBCacheKey) {
+        .phys_pc = phys_pc,
+        .pc = tb->pc,
+        .cs_base = tb->cs_base,
+        .flags = tb->flags,
+        .cflags = tb->cflags,
+        .trace_vcpu_dstate = tb->trace_vcpu_dstate,
+    };
+}
+
+/* What the code depends on besides the guest code and the TB key */
+static void tb_cache_fingerprint(CPUState *cpu, uint8_t *digest)
+{
+    GChecksum *checksum = g_checksum_new(G_CHECKSUM_SHA256);
+    CPUArchState *env = cpu->env_ptr;
+    const char *s;
+    gsize len = sizeof(((TBCacheHeader *)0)->fingerprint);
+
+    s = QEMU_VERSION " " TARGET_NAME;
+    g_checksum_update(checksum, (const guchar *)s, strlen(s));
+    s = object_get_typename(OBJECT(cpu));
+    g_checksum_update(checksum, (const guchar *)s, strlen(s));
+#if defined(TARGET_I386)
+    g_checksum_update(checksum, (const guchar *)env->features,
+                      sizeof(env->features));
+#elif defined(TARGET_ARM)
+    g_checksum_update(checksum, (const guchar *)&env->features,
+                      sizeof(env->features));
+#elif defined(TARGET_XTENSA)
+    s = env->config->name;
+    g_checksum_update(checksum, (const guchar *)s, strlen(s));
+#else
+    (void)env;
+#endif
+    tcg_host_fingerprint(checksum);
+
+    g_checksum_get_digest(checksum, digest, &len);
+    g_checksum_free(checksum);
+}
+
+/* Drops the TBs of the file if it was written for another binary or CPU */
+static bool tb_cache_check(CPUState *cpu)
+{
+    const TBCacheHeader *header;
+    uint8_t fingerprint[sizeof(header->fingerprint)];
+
+    if (tb_cache.checked) {
+        return tb_cache.valid;
+    }
+    tb_cache.checked = true;
+    if (!tb_cache.file) {
+        return false;
+    }
+
+    header = (const void *)g_mapped_file_get_contents(tb_cache.file);
+    tb_cache_fingerprint(cpu, fingerprint);
+    if (memcmp(fingerprint, header->fingerprint, sizeof(fingerprint))) {
+        g_hash_table_remove_all(tb_cache.index);
+        tb_cache.nb_entries = 0;
+        tb_cache.size = sizeof(TBCacheHeader);
+        return false;
+    }
+    tb_cache.valid = true;
+    return true;
+}
+
+static bool tb_cache_index_file(const uint8_t *data, size_t len)
+{
+    const TBCacheHeader *header = (const void *)data;
+    size_t ofs = sizeof(TBCacheHeader);
+    unsigned i;
+
+    if (len < sizeof(TBCacheHeader) ||
+        memcmp(header->magic, TB_CACHE_MAGIC, sizeof(header->magic)) ||
+        header->version != TB_CACHE_VERSION ||
+        header->nb_entries > len / sizeof(TBCacheEntry)) {
+        return false;
+    }
+
+    tb_cache.entries = g_new(const TBCacheEntry *, header->nb_entries);
+    tb_cache.state = g_new0(uint8_t, header->nb_entries);
+    for (i = 0; i < header->nb_entries; i++) {
+        const TBCacheEntry *e = (const void *)(data + ofs);
+        size_t avail;
+
+        /* A truncated or corrupt entry ends the index, what was read so
+           far is kept.  Every field is bounded on its own, so that a
+           corrupt one can't wrap the sums.  */
+        if (len - ofs < sizeof(TBCacheEntry)) {
+            break;
+        }
+        avail = len - ofs - sizeof(TBCacheEntry);
+        if (e->nb_relocs * sizeof(TCGHostReloc) > avail) {
+            break;
+        }
+        avail -= e->nb_relocs * sizeof(TCGHostReloc);
+        if (e->code_size > avail ||
+            e->search_size > avail - e->code_size ||
+            e->size > avail - entry_host_size(e) ||
+            e->entry_size > len - ofs ||
+            e->entry_size != entry_size(e->nb_relocs, entry_host_size(e),
+                                        e->size) ||
+            (e->key.pc & ~TARGET_PAGE_MASK) + e->size > TARGET_PAGE_SIZE) {
+            break;
+        }
+        tb_cache.entries[i] = e;
+        g_hash_table_insert(tb_cache.index, (gpointer)&e->key,
+                            GUINT_TO_POINTER(i + 1));
+        ofs += e->entry_size;
+    }
+    tb_cache.nb_entries = i;
+    tb_cache.size = ofs;
+    return true;
+}
+
+void tb_cache_configure(const char *path, uint64_t max_size, Error **errp)
+{
+    Error *local_err = NULL;
+    GError *gerr = NULL;
+
+    if (!tcg_host_relocs_supported()) {
+        warn_report("tb-cache is not supported on this host");
+        return;
+    }
+    if (max_size < sizeof(TBCacheHeader)) {
+        error_setg(errp, "tb-cache-size is too small");
+        return;
+    }
+
+    tb_cache.path = g_strdup(path);
+    tb_cache.max_size = max_size;
+    tb_cache.size = sizeof(TBCacheHeader);
+    tb_cache.index = g_hash_table_new(tb_cache_key_hash, tb_cache_key_equal);
+    tb_cache.pending = g_byte_array_new();
+    tb_cache.pending_index = g_hash_table_new_full(tb_cache_key_hash,
+                                                   tb_cache_key_equal,
+                                                   g_free, NULL);
+
+    tb_cache.file = g_mapped_file_new(path, FALSE, &gerr);
+    if (!tb_cache.file) {
+        if (!g_error_matches(gerr, G_FILE_ERROR, G_FILE_ERROR_NOENT)) {
+            error_setg(&local_err, "%s", gerr->message);
+        }
+        g_error_free(gerr);
+    } else if (!tb_cache_index_file(
+                   (const uint8_t *)g_mapped_file_get_contents(tb_cache.file),
+                   g_mapped_file_get_length(tb_cache.file))) {
+        error_setg(&local_err, "not a TB cache file");
+        g_mapped_file_unref(tb_cache.file);
+        tb_cache.file = NULL;
+    }
+    if (local_err) {
+        /* The file will be rewritten from scratch */
+        warn_report("tb-cache: %s: %s", path, error_get_pretty(local_err));
+        error_free(local_err);
+    }
+
+    tb_cache_enabled = true;
+}
+
+int tb_cache_load(CPUState *cpu, TranslationBlock *tb, tb_page_addr_t phys_pc)
+{
+    TBCacheStats *stats = &tb_cache.stats;
+    const TBCacheEntry *e;
+    TBCacheKey key;
+    int64_t t0;
+    unsigned n;
+    int i;
+
+    if (!tb_cache_check(cpu)) {
+        return -1;
+    }
+
+    stats->lookups++;
+    tb_cache_key_init(&key, tb, phys_pc);
+    n = GPOINTER_TO_UINT(g_hash_table_lookup(tb_cache.index, &key));
+    if (!n || tb_cache.state[n - 1] == TB_CACHE_STALE) {
+        return -1;
+    }
+    e = tb_cache.entries[n - 1];
+    if ((void *)tb->tc.ptr + entry_host_size(e) >
+        tcg_ctx->code_gen_highwater ||
+        !QEMU_IS_ALIGNED((uintptr_t)tb->tc.ptr, TB_CACHE_CODE_ALIGN)) {
+        return -1;
+    }
+
+    t0 = get_clock();
+    if (memcmp(qemu_map_ram_ptr(NULL, phys_pc), entry_guest_code(e),
+               e->size)) {
+        goto stale;
+    }
+    memcpy(tb->tc.ptr, entry_code(e), entry_host_size(e));
+    if (!tcg_relocate_host_code(tb->tc.ptr, e->code_size, tb,
+                                entry_relocs(e), e->nb_relocs)) {
+        goto stale;
+    }
+
+    tb->size = e->size;
+    tb->icount = e->icount;
+    tb->tc.size = e->code_size;
+    for (i = 0; i < 2; i++) {
+        tb->jmp_reset_offset[i] = e->jmp_reset_offset[i];
+        tb->jmp_target_arg[i] = e->jmp_target_arg[i];
+    }
+
+    tb_cache.state[n - 1] = TB_CACHE_HIT;
+    stats->hits++;
+    stats->load_ns += get_clock() - t0;
+    return e->search_size;
+
+stale:
+    tb_cache.state[n - 1] = TB_CACHE_STALE;
+    tb_cache.size -= e->entry_size;
+    stats->stale++;
+    return -1;
+}
+
+void tb_cache_store(CPUState *cpu, TranslationBlock *tb,
+                    tb_page_addr_t phys_pc, int search_size,
+                    int64_t translate_ns)
+{
+    TBCacheStats *stats = &tb_cache.stats;
+    TCGContext *s = tcg_ctx;
+    TBCacheEntry e = {
+        .size = tb->size,
+        .icount = tb->icount,
+        .jmp_reset_offset = { tb->jmp_reset_offset[0],
+                              tb->jmp_reset_offset[1] },
+        .jmp_target_arg = { tb->jmp_target_arg[0], tb->jmp_target_arg[1] },
+        .code_size = tb->tc.size,
+        .search_size = search_size,
+        .nb_relocs = s->nb_host_relocs,
+    };
+    TBCacheKey *key;
+    unsigned n;
+    gpointer ofs;
+    size_t pad;
+
+    stats->translated++;
+    stats->translate_ns += translate_ns;
+
+    if (!s->host_relocs_ok ||
+        (tb->pc & ~TARGET_PAGE_MASK) + tb->size > TARGET_PAGE_SIZE ||
+        !QEMU_IS_ALIGNED((uintptr_t)tb->tc.ptr, TB_CACHE_CODE_ALIGN)) {
+        stats->not_relocatable++;
+        return;
+    }
+
+    tb_cache_key_init(&e.key, tb, phys_pc);
+    n = GPOINTER_TO_UINT(g_hash_table_lookup(tb_cache.index, &e.key));
+    if (n && tb_cache.state[n - 1] != TB_CACHE_STALE) {
+        /* Could not be loaded into the code buffer */
+        return;
+    }
+
+    e.entry_size = entry_size(e.nb_relocs, entry_host_size(&e), e.size);
+    if (tb_cache.size + e.entry_size > tb_cache.max_size) {
+        stats->full++;
+        return;
+    }
+
+    if (g_hash_table_lookup_extended(tb_cache.pending_index, &e.key,
+                                     NULL, &ofs)) {
+        TBCacheEntry *old = (void *)(tb_cache.pending->data +
+                                     GPOINTER_TO_SIZE(ofs));
+
+        old->unused_runs = TB_CACHE_DEAD;
+        tb_cache.size -= old->entry_size;
+    }
+    key = g_memdup(&e.key, sizeof(e.key));
+    g_hash_table_insert(tb_cache.pending_index, key,
+                        GSIZE_TO_POINTER(tb_cache.pending->len));
+
+    g_byte_array_append(tb_cache.pending, (const guint8 *)&e, sizeof(e));
+    g_byte_array_append(tb_cache.pending, (const guint8 *)s->host_relocs,
+                        e.nb_relocs * sizeof(TCGHostReloc));
+    g_byte_array_append(tb_cache.pending, (const guint8 *)tb->tc.ptr,
+                        entry_host_size(&e));
+    g_byte_array_append(tb_cache.pending, qemu_map_ram_ptr(NULL, phys_pc),
+                        e.size);
+    pad = ROUND_UP(entry_host_size(&e) + e.size, 8) -
+          (entry_host_size(&e) + e.size);
+    g_byte_array_set_size(tb_cache.pending, tb_cache.pending->len + pad);
+
+    tb_cache.size += e.entry_size;
+    stats->stored++;
+}
+
+static bool tb_cache_write_entry(FILE *f, const TBCacheEntry *e,
+                                 uint16_t unused_runs)
+{
+    TBCacheEntry header = *e;
+
+    header.unused_runs = unused_runs;
+    return fwrite(&header, sizeof(header), 1, f) == 1 &&
+           fwrite(e + 1, e->entry_size - sizeof(header), 1, f) == 1;
+}
+
+void tb_cache_save(void)
+{
+    TBCacheStats *stats = &tb_cache.stats;
+    TBCacheHeader header = {
+        .magic = TB_CACHE_MAGIC,
+        .version = TB_CACHE_VERSION,
+    };
+    char *tmp = NULL;
+    FILE *f = NULL;
+    CPUState *cpu = first_cpu;
+    size_t ofs;
+    unsigned i;
+    bool ok;
+
+    tb_lock();
+    if (!tb_cache_enabled) {
+        goto out;
+    }
+    tb_cache_enabled = false;
+    if (!cpu || (!stats->stored && !stats->stale)) {
+        /* Nothing to add or drop */
+        goto out;
+    }
+
+    tmp = g_strdup_printf("%s.tmp", tb_cache.path);
+    f = fopen(tmp, "wb");
+    if (!f) {
+        warn_report("tb-cache: cannot write %s: %s", tmp, strerror(errno));
+        goto out;
+    }
+
+    tb_cache_fingerprint(cpu, header.fingerprint);
+    ok = fwrite(&header, sizeof(header), 1, f) == 1;
+    for (i = 0; ok && i < tb_cache.nb_entries; i++) {
+        const TBCacheEntry *e = tb_cache.entries[i];
+
+        switch (tb_cache.state[i]) {
+        case TB_CACHE_HIT:
+            ok = tb_cache_write_entry(f, e, 0);
+            header.nb_entries++;
+            break;
+        case TB_CACHE_UNUSED:
+            if (e->unused_runs + 1 < TB_CACHE_MAX_UNUSED_RUNS) {
+                ok = tb_cache_write_entry(f, e, e->unused_runs + 1);
+                header.nb_entries++;
+            }
+            break;
+        }
+    }
+    for (ofs = 0; ok && ofs < tb_cache.pending->len; ) {
+        const TBCacheEntry *e = (void *)(tb_cache.pending->data + ofs);
+
+        if (e->unused_runs != TB_CACHE_DEAD) {
+            ok = tb_cache_write_entry(f, e, 0);
+            header.nb_entries++;
+        }
+        ofs += e->entry_size;
+    }
+    ok = ok && !fseek(f, 0, SEEK_SET) &&
+         fwrite(&header, sizeof(header), 1, f) == 1;
+    ok = !fclose(f) && ok;
+    if (!ok) {
+        warn_report("tb-cache: cannot write %s", tmp);
+        unlink(tmp);
+        goto out;
+    }
+
+    if (tb_cache.file) {
+        g_mapped_file_unref(tb_cache.file);
+        tb_cache.file = NULL;
+    }
+#ifdef _WIN32
+    /* Windows does not rename over an existing file */
+    unlink(tb_cache.path);
+#endif
+    if (rename(tmp, tb_cache.path)) {
+        warn_report("tb-cache: cannot rename %s: %s", tmp, strerror(errno));
+        unlink(tmp);
+    }
+
+out:
+    g_free(tmp);
+    tb_unlock();
+}
+
+void tb_cache_dump_info(FILE *f, fprintf_function cpu_fprintf)
+{
+    const TBCacheStats *stats = &tb_cache.stats;
+    double translate_us, load_us, saved_ms;
+
+    if (!tb_cache.path) {
+        return;
+    }
+
+    translate_us = stats->translated ?
+        stats->translate_ns / 1e3 / stats->translated : 0;
+    load_us = stats->hits ? stats->load_ns / 1e3 / stats->hits : 0;
+    saved_ms = (stats->hits * translate_us - stats->load_ns / 1e3) / 1e3;
+
+    cpu_fprintf(f, "\nPersistent TB cache %s\n", tb_cache.path);
+    cpu_fprintf(f, "cached TB count     %u%s\n", tb_cache.nb_entries,
+                tb_cache.checked && !tb_cache.valid && tb_cache.file ?
+                " (from another binary, ignored)" : "");
+    cpu_fprintf(f, "cache size          %" PRIu64 "/%" PRIu64 "\n",
+                tb_cache.size, tb_cache.max_size);
+    cpu_fprintf(f, "lookups             %" PRIu64 " (hits=%" PRIu64
+                " %0.1f%%, stale=%" PRIu64 ")\n",
+                stats->lookups, stats->hits,
+                stats->lookups ? stats->hits * 100.0 / stats->lookups : 0,
+                stats->stale);
+    cpu_fprintf(f, "translated TBs      %" PRIu64 " (stored=%" PRIu64
+                " not relocatable=%" PRIu64 " over size=%" PRIu64 ")\n",
+                stats->translated, stats->stored, stats->not_relocatable,
+                stats->full);
+    cpu_fprintf(f, "avg translate time  %0.1f us\n", translate_us);
+    cpu_fprintf(f, "avg load time       %0.1f us\n", load_us);
+    cpu_fprintf(f, "time saved          %0.1f ms\n", saved_ms);
+}
@@ -0,0 +1,361 @@
+/*
+ * TCG execution profile
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+
+#include "qemu/osdep.h"
+#include "qemu-common.h"
+#include "qapi/error.h"
+#include "qapi/qapi-commands-misc.h"
+#include "qapi/qmp/qdict.h"
+#include "qapi/qmp/qjson.h"
+#include "qapi/qmp/qlist.h"
+#include "qapi/qmp/qnum.h"
+#include "qapi/qmp/qstring.h"
+#include "cpu.h"
+#include "exec/exec-all.h"
+#include "exec/tb-hash.h"
+#include "exec/tcg-profile.h"
+#include "tcg.h"
+
+/*
+ * While profiling is enabled, the code of each TB starts by incrementing
+ * the execution counter of its entry below, and every helper call is
+ * preceded by an increment of the helper's counter (see tcg_gen_callN).
+ * This costs a load and a store per TB and per helper call, so no TB has
+ * to leave the code buffer to be counted.  Enabling or disabling the
+ * profile flushes the TBs, so that the counters are added or removed.
+ *
+ * Entries are keyed like TBs and survive TB flushes, so translating the
+ * same code again adds to the same entry.  They are never freed, because
+ * the code of a TB keeps a pointer to its counter.
+ */
+
+typedef struct TCGProfileTB {
+    /* Incremented by the code of the TB without atomics, so the counts of
+     * TBs that run on several vCPUs at once are approximate
+     */
+    uint64_t exec_count;
+    tb_page_addr_t phys_pc;
+    target_ulong pc;
+    target_ulong cs_base;
+    uint32_t flags;
+    uint32_t cflags;
+    uint16_t size;
+    uint16_t icount;
+    uint64_t translations;
+    int64_t translate_ns;
+} TCGProfileTB;
+
+bool tcg_profile_enabled;
+Stat64 tcg_profile_events[TCG_PROFILE_EVENT__MAX];
+
+static const char *const tcg_profile_event_names[TCG_PROFILE_EVENT__MAX] = {
+    [TCG_PROFILE_SLOW_LOAD] = "slow-load",
+    [TCG_PROFILE_SLOW_STORE] = "slow-store",
+    [TCG_PROFILE_TLB_VICTIM_HIT] = "tlb-victim-hit",
+    [TCG_PROFILE_TLB_FILL] = "tlb-fill",
+    [TCG_PROFILE_IO_READ] = "io-read",
+    [TCG_PROFILE_IO_WRITE] = "io-write",
+    [TCG_PROFILE_FLUSH] = "flush",
+    [TCG_PROFILE_FLUSH_FULL] = "flush-full",
+    [TCG_PROFILE_INVALIDATE_WRITE] = "invalidate-write",
+    [TCG_PROFILE_INVALIDATE_IO] = "invalidate-io",
+    [TCG_PROFILE_INVALIDATE_WATCHPOINT] = "invalidate-watchpoint",
+};
+
+/* Protected by tb_lock */
+static GHashTable *tcg_profile_tbs;
+
+typedef struct TCGProfileHelper {
+    const char *name;
+    uint64_t calls;
+} TCGProfileHelper;
+
+static guint tcg_profile_tb_hash(gconstpointer p)
+{
+    const TCGProfileTB *e = p;
+
+    return tb_hash_func(e->phys_pc, e->pc, e->flags, e->cflags, 0);
+}
+
+static gboolean tcg_profile_tb_equal(gconstpointer a, gconstpointer b)
+{
+    const TCGProfileTB *x = a, *y = b;
+
+    return x->phys_pc == y->phys_pc && x->pc == y->pc &&
+           x->cs_base == y->cs_base && x->flags == y->flags &&
+           x->cflags == y->cflags;
+}
+
+uint64_t *tcg_profile_tb_start(TranslationBlock *tb, tb_page_addr_t phys_pc)
+{
+    TCGProfileTB key = {
+        .phys_pc = phys_pc,
+        .pc = tb->pc,
+        .cs_base = tb->cs_base,
+        .flags = tb->flags,
+        .cflags = tb->cflags & CF_HASH_MASK,
+    };
+    TCGProfileTB *e;
+
+    if (!tcg_profile_tbs) {
+        tcg_profile_tbs = g_hash_table_new(tcg_profile_tb_hash,
+                                           tcg_profile_tb_equal);
+    }
+    e = g_hash_table_lookup(tcg_profile_tbs, &key);
+    if (!e) {
+        e = g_memdup(&key, sizeof(key));
+        g_hash_table_add(tcg_profile_tbs, e);
+    }
+    return &e->exec_count;
+}
+
+void tcg_profile_tb_end(TranslationBlock *tb, int64_t translate_ns)
+{
+    TCGProfileTB *e = container_of(tcg_ctx->tb_exec_count, TCGProfileTB,
+                                   exec_count);
+
+    e->size = tb->size;
+    e->icount = tb->icount;
+    e->translations++;
+    e->translate_ns += translate_ns;
+}
+
+void tcg_profile_set(bool enable)
+{
+    if (enable == atomic_read(&tcg_profile_enabled)) {
+        return;
+    }
+    atomic_set(&tcg_profile_enabled, enable);
+    if (first_cpu) {
+        tb_flush(first_cpu);
+    }
+}
+
+void tcg_profile_reset(void)
+{
+    GHashTableIter iter;
+    TCGProfileTB *e;
+    int i;
+
+    tb_lock();
+    if (tcg_profile_tbs) {
+        g_hash_table_iter_init(&iter, tcg_profile_tbs);
+        while (g_hash_table_iter_next(&iter, (gpointer *)&e, NULL)) {
+            e->exec_count = 0;
+            e->translations = 0;
+            e->translate_ns = 0;
+        }
+    }
+    tcg_helper_calls_reset();
+    for (i = 0; i < TCG_PROFILE_EVENT__MAX; i++) {
+        stat64_init(&tcg_profile_events[i], 0);
+    }
+    tb_unlock();
+}
+
+static uint64_t tcg_profile_tb_insns(const TCGProfileTB *e)
+{
+    return e->exec_count * e->icount;
+}
+
+/* Most executed guest instructions first */
+static gint tcg_profile_tb_compare(gconstpointer a, gconstpointer b)
+{
+    uint64_t x = tcg_profile_tb_insns(*(TCGProfileTB **)a);
+    uint64_t y = tcg_profile_tb_insns(*(TCGProfileTB **)b);
+
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static gint tcg_profile_helper_compare(gconstpointer a, gconstpointer b)
+{
+    const TCGProfileHelper *x = a, *y = b;
+
+    return x->calls < y->calls ? 1 : x->calls > y->calls ? -1 : 0;
+}
+
+/* Called with tb_lock held */
+static GPtrArray *tcg_profile_sorted_tbs(uint64_t *total_insns,
+                                         int64_t *total_translate_ns)
+{
+    GPtrArray *tbs = g_ptr_array_new();
+    GHashTableIter iter;
+    TCGProfileTB *e;
+
+    *total_insns = 0;
+    *total_translate_ns = 0;
+    if (tcg_profile_tbs) {
+        g_hash_table_iter_init(&iter, tcg_profile_tbs);
+        while (g_hash_table_iter_next(&iter, (gpointer *)&e, NULL)) {
+            g_ptr_array_add(tbs, e);
+            *total_insns += tcg_profile_tb_insns(e);
+            *total_translate_ns += e->translate_ns;
+        }
+    }
+    g_ptr_array_sort(tbs, tcg_profile_tb_compare);
+    return tbs;
+}
+
+static GArray *tcg_profile_sorted_helpers(void)
+{
+    GArray *helpers = g_array_new(FALSE, FALSE, sizeof(TCGProfileHelper));
+    TCGProfileHelper h;
+    int i;
+
+    for (i = 0; (h.name = tcg_helper_calls(i, &h.calls)); i++) {
+        if (h.calls) {
+            g_array_append_val(helpers, h);
+        }
+    }
+    g_array_sort(helpers, tcg_profile_helper_compare);
+    return helpers;
+}
+
+void tcg_profile_dump_info(FILE *f, fprintf_function cpu_fprintf, int count)
+{
+    uint64_t total_insns;
+    int64_t total_translate_ns;
+    GPtrArray *tbs;
+    GArray *helpers;
+    int i;
+
+    tb_lock();
+    tbs = tcg_profile_sorted_tbs(&total_insns, &total_translate_ns);
+    helpers = tcg_profile_sorted_helpers();
+
+    cpu_fprintf(f, "TCG profile: %s, %u TBs, %" PRIu64 " guest insns, "
+                "%0.1f ms translating\n",
+                atomic_read(&tcg_profile_enabled) ? "enabled" : "disabled",
+                tbs->len, total_insns, total_translate_ns / 1e6);
+
+    cpu_fprintf(f, "\nTop %d TBs by executed guest instructions:\n", count);
+    cpu_fprintf(f, "%-18s %-18s %5s %12s %6s %6s %10s\n",
+                "phys_pc", "pc", "insns", "execs", "%", "trans",
+                "trans_us");
+    for (i = 0; i < count && i < tbs->len; i++) {
+        const TCGProfileTB *e = g_ptr_array_index(tbs, i);
+
+        cpu_fprintf(f, "0x%016" PRIx64 " 0x%016" PRIx64 " %5u %12" PRIu64
+                    " %5.1f%% %6" PRIu64 " %10.1f\n",
+                    (uint64_t)e->phys_pc, (uint64_t)e->pc, e->icount,
+                    e->exec_count,
+                    total_insns ?
+                    tcg_profile_tb_insns(e) * 100.0 / total_insns : 0,
+                    e->translations, e->translate_ns / 1e3);
+    }
+
+    cpu_fprintf(f, "\nTop %d helpers by calls:\n", count);
+    for (i = 0; i < count && i < helpers->len; i++) {
+        const TCGProfileHelper *h = &g_array_index(helpers, TCGProfileHelper,
+                                                   i);
+
+        cpu_fprintf(f, "%-32s %12" PRIu64 "\n", h->name, h->calls);
+    }
+
+    cpu_fprintf(f, "\nsoftmmu slow path: loads %" PRIu64 " stores %" PRIu64
+                " TLB victim hits %" PRIu64 " TLB fills %" PRIu64
+                " I/O reads %" PRIu64 " I/O writes %" PRIu64 "\n",
+                stat64_get(&tcg_profile_events[TCG_PROFILE_SLOW_LOAD]),
+                stat64_get(&tcg_profile_events[TCG_PROFILE_SLOW_STORE]),
+                stat64_get(&tcg_profile_events[TCG_PROFILE_TLB_VICTIM_HIT]),
+                stat64_get(&tcg_profile_events[TCG_PROFILE_TLB_FILL]),
+                stat64_get(&tcg_profile_events[TCG_PROFILE_IO_READ]),
+                stat64_get(&tcg_profile_events[TCG_PROFILE_IO_WRITE]));
+    cpu_fprintf(f, "TB flushes: %" PRIu64 " (code buffer full %" PRIu64 ")\n",
+                stat64_get(&tcg_profile_events[TCG_PROFILE_FLUSH]),
+                stat64_get(&tcg_profile_events[TCG_PROFILE_FLUSH_FULL]));
+    cpu_fprintf(f, "TB invalidations: code writes %" PRIu64
+                " I/O recompiles %" PRIu64 " watchpoints %" PRIu64 "\n",
+                stat64_get(&tcg_profile_events[TCG_PROFILE_INVALIDATE_WRITE]),
+                stat64_get(&tcg_profile_events[TCG_PROFILE_INVALIDATE_IO]),
+                stat64_get(&tcg_profile_events[
+                               TCG_PROFILE_INVALIDATE_WATCHPOINT]));
+
+    g_ptr_array_free(tbs, TRUE);
+    g_array_free(helpers, TRUE);
+    tb_unlock();
+}
+
+void tcg_profile_dump_json(const char *filename, Error **errp)
+{
+    QDict *profile = qdict_new();
+    QList *list;
+    QDict *dict;
+    QString *json;
+    GError *gerr = NULL;
+    uint64_t total_insns;
+    int64_t total_translate_ns;
+    GPtrArray *tbs;
+    GArray *helpers;
+    int i;
+
+    tb_lock();
+    tbs = tcg_profile_sorted_tbs(&total_insns, &total_translate_ns);
+    helpers = tcg_profile_sorted_helpers();
+
+    list = qlist_new();
+    for (i = 0; i < tbs->len; i++) {
+        const TCGProfileTB *e = g_ptr_array_index(tbs, i);
+
+        dict = qdict_new();
+        qdict_put(dict, "phys-pc", qnum_from_uint(e->phys_pc));
+        qdict_put(dict, "pc", qnum_from_uint(e->pc));
+        qdict_put(dict, "cs-base", qnum_from_uint(e->cs_base));
+        qdict_put(dict, "flags", qnum_from_uint(e->flags));
+        qdict_put(dict, "size", qnum_from_uint(e->size));
+        qdict_put(dict, "insns", qnum_from_uint(e->icount));
+        qdict_put(dict, "execs", qnum_from_uint(e->exec_count));
+        qdict_put(dict, "translations", qnum_from_uint(e->translations));
+        qdict_put_int(dict, "translate-ns", e->translate_ns);
+        qlist_append(list, dict);
+    }
+    qdict_put(profile, "tbs", list);
+
+    list = qlist_new();
+    for (i = 0; i < helpers->len; i++) {
+        const TCGProfileHelper *h = &g_array_index(helpers, TCGProfileHelper,
+                                                   i);
+
+        dict = qdict_new();
+        qdict_put_str(dict, "name", h->name);
+        qdict_put(dict, "calls", qnum_from_uint(h->calls));
+        qlist_append(list, dict);
+    }
+    qdict_put(profile, "helpers", list);
+
+    dict = qdict_new();
+    for (i = 0; i < TCG_PROFILE_EVENT__MAX; i++) {
+        qdict_put(dict, tcg_profile_event_names[i],
+                  qnum_from_uint(stat64_get(&tcg_profile_events[i])));
+    }
+    qdict_put(profile, "events", dict);
+
+    g_ptr_array_free(tbs, TRUE);
+    g_array_free(helpers, TRUE);
+    tb_unlock();
+
+    json = qobject_to_json_pretty(QOBJECT(profile));
+    if (!g_file_set_contents(filename, qstring_get_str(json),
+                             qstring_get_length(json), &gerr)) {
+        error_setg(errp, "%s", gerr->message);
+        g_error_free(gerr);
+    }
+    QDECREF(json);
+    QDECREF(profile);
+}
+
+void qmp_x_tcg_profile_dump(const char *filename, Error **errp)
+{
+    if (!tcg_enabled()) {
+        error_setg(errp, "TCG profile is only available with accel=tcg");
+        return;
+    }
+    tcg_profile_dump_json(filename, errp);
+}
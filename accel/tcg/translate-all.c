@@ -51,6 +51,8 @@
 
 #include "exec/cputlb.h"
 #include "exec/tb-hash.h"
+#include "exec/tb-cache.h"
+#include "exec/tcg-profile.h"
 #include "translate-all.h"
 #include "qemu/bitmap.h"
 #include "qemu/error-report.h"
@@ -916,6 +918,7 @@ static void do_tb_flush(CPUState *cpu, run_on_cpu_data tb_flush_count)
     if (tb_ctx.tb_flush_count != tb_flush_count.host_int) {
         goto done;
     }
+    tcg_profile_event(TCG_PROFILE_FLUSH);
 
     if (DEBUG_TB_FLUSH_GATE) {
         size_t nb_tbs = g_tree_nnodes(tb_ctx.tb_tree);
@@ -1269,6 +1272,7 @@ TranslationBlock *tb_gen_code(CPUState *cpu,
     target_ulong virt_page2;
     tcg_insn_unit *gen_code_buf;
     int gen_code_size, search_size;
+    int64_t translate_start = 0;
 #ifdef CONFIG_PROFILER
     TCGProfile *prof = &tcg_ctx->prof;
     int64_t ti;
@@ -1281,6 +1285,7 @@ TranslationBlock *tb_gen_code(CPUState *cpu,
     tb = tb_alloc(pc);
     if (unlikely(!tb)) {
         /* flush must be done */
+        tcg_profile_event(TCG_PROFILE_FLUSH_FULL);
         tb_flush(cpu);
         mmap_unlock();
         /* Make the execution loop process the flush as soon as possible.  */
@@ -1297,6 +1302,29 @@ TranslationBlock *tb_gen_code(CPUState *cpu,
     tb->trace_vcpu_dstate = *cpu->trace_dstate;
     tcg_ctx->tb_cflags = cflags;
 
+    tcg_ctx->tb_exec_count = NULL;
+    if (tcg_profile_enabled) {
+        tcg_ctx->tb_exec_count = tcg_profile_tb_start(tb, phys_pc);
+    }
+
+    /* The profile counters are host addresses, which cannot be relocated.
+       Breakpoints and single-stepping change the code, but not the TB key,
+       so the cache is left alone while a debugger uses them.  */
+    tcg_ctx->host_relocs_enabled = tb_cache_enabled && !tcg_profile_enabled &&
+                                   !(cflags & CF_NOCACHE) &&
+                                   !cpu->singlestep_enabled && !singlestep &&
+                                   QTAILQ_EMPTY(&cpu->breakpoints);
+    if (tcg_ctx->host_relocs_enabled) {
+        search_size = tb_cache_load(cpu, tb, phys_pc);
+        if (search_size >= 0) {
+            gen_code_size = tb->tc.size;
+            goto cached;
+        }
+    }
+    if (tcg_ctx->host_relocs_enabled || tcg_ctx->tb_exec_count) {
+        translate_start = get_clock();
+    }
+
 #ifdef CONFIG_PROFILER
     /* includes aborted translations because of exceptions */
     atomic_set(&prof->tb_count1, prof->tb_count1 + 1);
@@ -1383,6 +1411,15 @@ TranslationBlock *tb_gen_code(CPUState *cpu,
     }
 #endif
 
+    if (tcg_ctx->host_relocs_enabled) {
+        tb_cache_store(cpu, tb, phys_pc, search_size,
+                       get_clock() - translate_start);
+    }
+    if (tcg_ctx->tb_exec_count) {
+        tcg_profile_tb_end(tb, get_clock() - translate_start);
+    }
+
+ cached:
     atomic_set(&tcg_ctx->code_gen_ptr, (void *)
         ROUND_UP((uintptr_t)gen_code_buf + gen_code_size + search_size,
                  CODE_GEN_ALIGN));
@@ -1535,6 +1572,7 @@ void tb_invalidate_phys_page_range(tb_page_addr_t start, tb_page_addr_t end,
                                      &current_flags);
             }
 #endif /* TARGET_HAS_PRECISE_SMC */
+            tcg_profile_event(TCG_PROFILE_INVALIDATE_WRITE);
             tb_phys_invalidate(tb, -1);
         }
         tb = tb_next;
@@ -1658,6 +1696,7 @@ static bool tb_invalidate_phys_page(tb_page_addr_t addr, uintptr_t pc)
                                  &current_flags);
         }
 #endif /* TARGET_HAS_PRECISE_SMC */
+        tcg_profile_event(TCG_PROFILE_INVALIDATE_WRITE);
         tb_phys_invalidate(tb, addr);
         tb = tb->page_next[n];
     }
@@ -1720,6 +1759,7 @@ void tb_check_watchpoint(CPUState *cpu)
     if (tb) {
         /* We can use retranslation to find the PC.  */
         cpu_restore_state_from_tb(cpu, tb, cpu->mem_io_pc, true);
+        tcg_profile_event(TCG_PROFILE_INVALIDATE_WATCHPOINT);
         tb_phys_invalidate(tb, -1);
     } else {
         /* The exception probably happened in a helper.  The CPU state should
@@ -1756,6 +1796,7 @@ void cpu_io_recompile(CPUState *cpu, uintptr_t retaddr)
                   (void *)retaddr);
     }
     cpu_restore_state_from_tb(cpu, tb, retaddr, true);
+    tcg_profile_event(TCG_PROFILE_INVALIDATE_IO);
 
     /* On MIPS and SH, delay slot instructions can only be restarted if
        they were already the first instruction in the TB.  If this is not
@@ -1934,6 +1975,7 @@ void dump_exec_info(FILE *f, fprintf_function cpu_fprintf)
     cpu_fprintf(f, "TB invalidate count %d\n", tb_ctx.tb_phys_invalidate_count);
     cpu_fprintf(f, "TLB flush count     %zu\n", tlb_flush_count());
     tcg_dump_info(f, cpu_fprintf);
+    tb_cache_dump_info(f, cpu_fprintf);
 
     tb_unlock();
 }
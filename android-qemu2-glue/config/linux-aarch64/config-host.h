@@ -58,6 +58,7 @@
 #define CONFIG_TLS_PRIORITY "NORMAL"
 #define HAVE_IFADDRS_H 1
 #define HAVE_FSXATTR 1
+#define CONFIG_LINUX_IO_URING 1
 #define CONFIG_VHOST_SCSI 1
 #define CONFIG_VHOST_CRYPTO 1
 #define CONFIG_VHOST_USER 1
@@ -56,6 +56,7 @@
 #define CONFIG_HAS_GLIB_SUBPROCESS_TESTS 1
 #define CONFIG_TLS_PRIORITY "NORMAL"
 #define HAVE_IFADDRS_H 1
+#define CONFIG_LINUX_IO_URING 1
 #define CONFIG_VHOST_SCSI 1
 #define CONFIG_VHOST_CRYPTO 1
 #define CONFIG_VHOST_USER 1
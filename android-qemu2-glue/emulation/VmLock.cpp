@@ -27,6 +27,10 @@ void VmLock::lock() {
     qemu_mutex_lock_iothread();
 }
 
+void VmLock::lockFrom(const char* caller) {
+    qemu_mutex_lock_iothread_impl(caller, 0);
+}
+
 void VmLock::unlock() {
     qemu_mutex_unlock_iothread();
 }
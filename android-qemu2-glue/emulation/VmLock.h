@@ -26,6 +26,7 @@ namespace qemu2 {
 class VmLock : public android::VmLock {
 public:
     virtual void lock() override;
+    virtual void lockFrom(const char* caller) override;
     virtual void unlock() override;
     virtual bool isLockedBySelf() const override;
 };
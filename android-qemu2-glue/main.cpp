@@ -623,7 +623,23 @@ private:
                                       1024 * 1024);
                 driveParam += StringFormat(",l2-cache-size=%d", l2CacheSize);
             }
+
+            if (fc::isEnabled(fc::AdaptiveQcow2Cache)) {
+                // Only use as much of the cache size as the working set
+                // needs, and warm up the L2 cache with the tables the
+                // previous boot used.
+                driveParam += ",cache-adaptive=on,l2-prefetch=on";
+            }
+        }
+
+#ifndef _WIN32
+        if (!qCow2Format && fc::isEnabled(fc::SharedImageCache)) {
+            // Read-only system and vendor images are the same for all the
+            // emulators on the host that run this system image; let them
+            // share one cache of their blocks.
+            driveParam += ",format=shared-cache";
         }
+#endif
 
 // Move the disk operations into the dedicated 'disk thread', and
 // enable modern notification mode for the hosts that support it (Linux).
@@ -105,6 +105,7 @@ extern "C" {
 
 #include "android/proxy/proxy_int.h"
 #include "qemu/abort.h"
+#include "qemu/bql-profile.h"
 #include "qemu/main-loop.h"
 #include "qemu/osdep.h"
 #include "qemu/thread.h"
@@ -384,6 +385,10 @@ bool qemu_android_emulation_setup() {
     if (std::getenv("VPERFETTO_TRACE_ENABLED")) {
         android::base::enableTracing();
     }
+    // "bql-profile on" in the monitor also shows the lock times in traces.
+    bql_profile_set_trace_counter([](const char* name, int64_t value) {
+        android::base::traceCounter(name, value);
+    });
 
     android_qemu_init_slirp_shapers();
 
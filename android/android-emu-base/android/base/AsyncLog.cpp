@@ -0,0 +1,457 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/base/AsyncLog.h"
+
+#include <assert.h>  // for assert
+#include <stdio.h>   // for snprintf, fwrite, fflush
+#include <string.h>  // for memcpy
+#include <time.h>    // for localtime_r, tm, time_t
+
+#include <algorithm>  // for min, remove_if
+#include <chrono>     // for system_clock
+#include <utility>    // for move
+
+#include "android/base/StringView.h"       // for StringView, c_str
+#include "android/base/files/PathUtils.h"  // for PathUtils
+#include "android/utils/debug.h"           // for VERBOSE_CHECK
+#include "android/utils/file_io.h"         // for android_fopen
+
+namespace android {
+namespace base {
+
+namespace {
+
+class StdioLogSink : public LogSink {
+public:
+    void write(const LogParams& params,
+               const char* line,
+               size_t lineLen) override {
+        fwrite(line, 1, lineLen, params.severity >= LOG_WARNING ? stderr : stdout);
+    }
+
+    void flush() override {
+        fflush(stdout);
+        fflush(stderr);
+    }
+};
+
+class FileLogSink : public LogSink {
+public:
+    explicit FileLogSink(FILE* file) : mFile(file) {}
+    ~FileLogSink() { fclose(mFile); }
+
+    void write(const LogParams& params,
+               const char* line,
+               size_t lineLen) override {
+        fwrite(line, 1, lineLen, mFile);
+    }
+
+    void flush() override { fflush(mFile); }
+
+private:
+    FILE* const mFile;
+};
+
+uint64_t nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::system_clock::now().time_since_epoch())
+            .count();
+}
+
+}  // namespace
+
+std::unique_ptr<LogSink> makeStdioLogSink() {
+    return std::unique_ptr<LogSink>(new StdioLogSink());
+}
+
+std::unique_ptr<LogSink> makeFileLogSink(const char* path) {
+    FILE* file = android_fopen(path, "a");
+    if (!file) {
+        return nullptr;
+    }
+    return std::unique_ptr<LogSink>(new FileLogSink(file));
+}
+
+// What goes into a ring for every message, followed by the message itself.
+struct AsyncLog::Record {
+    // Bytes taken in the ring, including the message. 0 marks the end of the
+    // ring, the next record is at the start.
+    uint32_t size;
+    uint32_t messageLen;
+    const char* file;
+    int32_t lineno;
+    int32_t severity;
+    uint32_t suppressed;
+    bool quiet;
+    uint64_t timeUs;
+};
+
+// A ring of records that a single thread writes to, and the AsyncLog thread
+// reads from. Positions only ever grow, and are taken modulo the size.
+class AsyncLog::ThreadBuffer {
+public:
+    explicit ThreadBuffer(size_t bytes)
+        : mData(bytes / sizeof(uint64_t)), mBytes(bytes) {}
+
+    // Called from the thread that owns the ring.
+    bool push(const Record& record, const char* message, size_t messageLen) {
+        // Really long messages are cut, so that there is always room for
+        // a few of them.
+        messageLen = std::min(messageLen, mBytes / 4);
+        const size_t size = alignUp(sizeof(Record) + messageLen);
+        uint64_t head = mHead.load(std::memory_order_relaxed);
+        const size_t toEnd = mBytes - offset(head);
+        const size_t skip = size > toEnd ? toEnd : 0;
+        if (head + skip + size - mTail.load(std::memory_order_acquire) >
+            mBytes) {
+            return false;
+        }
+        if (skip) {
+            if (toEnd >= sizeof(Record)) {
+                at(head)->size = 0;
+            }
+            head += skip;
+        }
+        Record* dst = at(head);
+        *dst = record;
+        dst->size = size;
+        dst->messageLen = messageLen;
+        memcpy(dst + 1, message, messageLen);
+        mHead.store(head + size, std::memory_order_release);
+        return true;
+    }
+
+    // Called from the AsyncLog thread, hands every queued record to |func|
+    // and returns how many there were.
+    template <class Func>
+    int pop(Func&& func) {
+        uint64_t tail = mTail.load(std::memory_order_relaxed);
+        const uint64_t head = mHead.load(std::memory_order_acquire);
+        int count = 0;
+        while (tail != head) {
+            const size_t toEnd = mBytes - offset(tail);
+            if (toEnd < sizeof(Record) || at(tail)->size == 0) {
+                tail += toEnd;
+                continue;
+            }
+            const Record* record = at(tail);
+            func(*record, reinterpret_cast<const char*>(record + 1));
+            tail += record->size;
+            ++count;
+            // Make room as soon as possible.
+            mTail.store(tail, std::memory_order_release);
+        }
+        mTail.store(tail, std::memory_order_release);
+        return count;
+    }
+
+    bool empty() const {
+        return mHead.load(std::memory_order_acquire) ==
+               mTail.load(std::memory_order_relaxed);
+    }
+
+    // Set once the owning thread is gone and won't push anymore.
+    std::atomic<bool> orphaned{false};
+    // Set by the AsyncLog thread once it read everything from an orphaned
+    // ring.
+    bool finished = false;
+
+private:
+    static size_t alignUp(size_t bytes) {
+        return (bytes + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+    }
+
+    size_t offset(uint64_t pos) const { return pos & (mBytes - 1); }
+
+    Record* at(uint64_t pos) {
+        return reinterpret_cast<Record*>(
+                reinterpret_cast<char*>(mData.data()) + offset(pos));
+    }
+
+    std::vector<uint64_t> mData;
+    const size_t mBytes;
+    std::atomic<uint64_t> mHead{0};
+    // Keeps the two sides off each other's cache line.
+    char mPadding[64];
+    std::atomic<uint64_t> mTail{0};
+};
+
+// Lives in the thread local storage of every thread that logs, and tells
+// the AsyncLog thread when that thread is gone.
+struct AsyncLog::ThreadHandle {
+    explicit ThreadHandle(ThreadBuffer* buffer) : buffer(buffer) {}
+    ~ThreadHandle() { buffer->orphaned.store(true, std::memory_order_release); }
+
+    ThreadBuffer* const buffer;
+};
+
+std::atomic<AsyncLog*> AsyncLog::sInstalled{nullptr};
+
+AsyncLog::AsyncLog(std::vector<std::unique_ptr<LogSink>> sinks)
+    : AsyncLog(std::move(sinks), Options()) {}
+
+AsyncLog::AsyncLog(std::vector<std::unique_ptr<LogSink>> sinks,
+                   const Options& options)
+    : mOptions(options),
+      mSinks(std::move(sinks)),
+      mThread([this]() { run(); }) {
+    assert(mOptions.threadBufferBytes &&
+           (mOptions.threadBufferBytes & (mOptions.threadBufferBytes - 1)) == 0);
+    mThread.start();
+}
+
+AsyncLog::~AsyncLog() {
+    {
+        AutoLock lock(mLock);
+        mExiting = true;
+        mWake.signalAndUnlock(&lock);
+    }
+    mThread.wait();
+    // ThreadStore doesn't free what is left once it goes away, do it at least
+    // for this thread.
+    delete mThreadHandles.swap(nullptr);
+}
+
+// static
+AsyncLog* AsyncLog::install(AsyncLog* log) {
+    return sInstalled.exchange(log, std::memory_order_acq_rel);
+}
+
+bool AsyncLog::log(const LogParams& params,
+                   const char* message,
+                   size_t messageLen) {
+    Record record;
+    record.file = params.file;
+    record.lineno = params.lineno;
+    record.severity = params.severity;
+    record.quiet = params.quiet;
+    record.timeUs = nowUs();
+    record.suppressed = 0;
+    if (mOptions.maxPerSecondPerSite && params.severity < LOG_ERROR &&
+        !allowed(params, record.timeUs, &record.suppressed)) {
+        mSuppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    if (!threadBuffer()->push(record, message, messageLen)) {
+        mDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Either we see the AsyncLog thread going to sleep, or it sees what
+    // we just queued.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (mSleeping.load(std::memory_order_relaxed)) {
+        AutoLock lock(mLock);
+        mWake.signalAndUnlock(&lock);
+    }
+    return true;
+}
+
+void AsyncLog::flush() {
+    if (getCurrentThreadId() == mThreadId) {
+        return;
+    }
+    AutoLock lock(mLock);
+    const uint64_t request = ++mFlushRequests;
+    mWake.signal();
+    mFlushed.wait(&lock, [this, request]() {
+        return mFlushesDone >= request;
+    });
+}
+
+AsyncLog::ThreadBuffer* AsyncLog::threadBuffer() {
+    ThreadHandle* handle = mThreadHandles.get();
+    if (!handle) {
+        std::unique_ptr<ThreadBuffer> buffer(
+                new ThreadBuffer(mOptions.threadBufferBytes));
+        handle = new ThreadHandle(buffer.get());
+        {
+            AutoLock lock(mLock);
+            mBuffers.push_back(std::move(buffer));
+        }
+        mThreadHandles.set(handle);
+    }
+    return handle->buffer;
+}
+
+bool AsyncLog::allowed(const LogParams& params,
+                       uint64_t timeUs,
+                       uint32_t* suppressed) {
+    uint64_t hash = reinterpret_cast<uintptr_t>(params.file) ^
+                    (uint64_t(params.lineno) * 0x9e3779b97f4a7c15ull);
+    hash ^= hash >> 29;
+    const int site = hash % kSites;
+
+    const uint64_t second = timeUs / 1000000;
+    uint64_t window = mSiteWindows[site].load(std::memory_order_relaxed);
+    for (;;) {
+        uint64_t next;
+        if ((window >> 32) != (second & 0xffffffff)) {
+            next = (second << 32) | 1;
+        } else if ((window & 0xffffffff) >= mOptions.maxPerSecondPerSite) {
+            mSiteSuppressed[site].fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            next = window + 1;
+        }
+        if (mSiteWindows[site].compare_exchange_weak(
+                    window, next, std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    if (mSiteSuppressed[site].load(std::memory_order_relaxed)) {
+        *suppressed =
+                mSiteSuppressed[site].exchange(0, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+void AsyncLog::run() {
+    mThreadId = getCurrentThreadId();
+    for (;;) {
+        uint64_t flushRequests;
+        bool exiting;
+        {
+            AutoLock lock(mLock);
+            flushRequests = mFlushRequests;
+            exiting = mExiting;
+        }
+
+        bool wrote = false;
+        while (drain()) {
+            wrote = true;
+        }
+        if (wrote || flushRequests > mFlushesDone || exiting) {
+            for (const auto& sink : mSinks) {
+                sink->flush();
+            }
+        }
+        if (flushRequests > mFlushesDone) {
+            AutoLock lock(mLock);
+            mFlushesDone = flushRequests;
+            mFlushed.broadcastAndUnlock(&lock);
+        }
+        if (exiting) {
+            break;
+        }
+
+        AutoLock lock(mLock);
+        mSleeping.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        mWake.wait(&lock, [this, flushRequests]() {
+            if (mExiting || mFlushRequests != flushRequests) {
+                return true;
+            }
+            for (const auto& buffer : mBuffers) {
+                if (!buffer->empty()) {
+                    return true;
+                }
+            }
+            return false;
+        });
+        mSleeping.store(0, std::memory_order_relaxed);
+    }
+}
+
+bool AsyncLog::drain() {
+    {
+        AutoLock lock(mLock);
+        mDraining.clear();
+        for (const auto& buffer : mBuffers) {
+            mDraining.push_back(buffer.get());
+        }
+    }
+
+    // Only this thread removes buffers, so they stay around without the lock,
+    // which keeps slow sinks from holding up threads that log.
+    int count = 0;
+    bool finished = false;
+    for (ThreadBuffer* buffer : mDraining) {
+        const bool orphaned = buffer->orphaned.load(std::memory_order_acquire);
+        count += buffer->pop([this](const Record& record, const char* message) {
+            write(record, message);
+        });
+        if (orphaned) {
+            buffer->finished = true;
+            finished = true;
+        }
+    }
+
+    if (finished) {
+        AutoLock lock(mLock);
+        mBuffers.erase(std::remove_if(mBuffers.begin(), mBuffers.end(),
+                                      [](const std::unique_ptr<ThreadBuffer>&
+                                                 buffer) {
+                                          return buffer->finished;
+                                      }),
+                       mBuffers.end());
+    }
+    return count > 0;
+}
+
+void AsyncLog::write(const Record& record, const char* message) {
+    char prefix[64];
+    int prefixLen = 0;
+    if (VERBOSE_CHECK(time)) {
+        const time_t seconds = record.timeUs / 1000000;
+        struct tm local;
+#ifdef _WIN32
+        localtime_s(&local, &seconds);
+#else
+        localtime_r(&seconds, &local);
+#endif
+        prefixLen = snprintf(prefix, sizeof(prefix), "%02d:%02d:%02d.%05ld ",
+                             local.tm_hour, local.tm_min, local.tm_sec,
+                             long(record.timeUs % 1000000));
+    }
+
+    LogParams params(record.file, record.lineno, LogSeverity(record.severity),
+                     record.quiet);
+    const char* severity = severityLevelToString(params.severity);
+    const int messageLen = int(record.messageLen);
+    int len;
+    for (;;) {
+        if (params.quiet) {
+            len = snprintf(mLine.data(), mLine.size(), "%.*semulator: %s: %.*s",
+                           prefixLen, prefix, severity, messageLen, message);
+        } else {
+            StringView filename;
+            if (!PathUtils::split(params.file, nullptr, &filename)) {
+                filename = params.file;
+            }
+            len = snprintf(mLine.data(), mLine.size(),
+                           "%.*semulator: %s: %s:%d: %.*s", prefixLen, prefix,
+                           severity, c_str(filename).get(), params.lineno,
+                           messageLen, message);
+        }
+        if (len >= 0 && size_t(len) + 64 <= mLine.size()) {
+            break;
+        }
+        mLine.resize(std::max<size_t>(256, (len + 64) * 2));
+    }
+    if (record.suppressed) {
+        len += snprintf(mLine.data() + len, mLine.size() - len,
+                        " (%u similar messages suppressed)", record.suppressed);
+    }
+    mLine[len++] = '\n';
+
+    for (const auto& sink : mSinks) {
+        sink->write(params, mLine.data(), len);
+    }
+}
+
+}  // namespace base
+}  // namespace android
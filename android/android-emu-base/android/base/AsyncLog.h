@@ -0,0 +1,160 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for uint64_t, uint32_t
+#include <atomic>    // for atomic
+#include <memory>    // for unique_ptr
+#include <vector>    // for vector
+
+#include "android/base/Compiler.h"                           // for DISALLOW...
+#include "android/base/Log.h"                                // for LogParams
+#include "android/base/synchronization/ConditionVariable.h"  // for Conditio...
+#include "android/base/synchronization/Lock.h"               // for Lock
+#include "android/base/threads/FunctorThread.h"              // for FunctorT...
+#include "android/base/threads/Thread.h"                     // for getCurre...
+#include "android/base/threads/ThreadStore.h"                // for ThreadStore
+
+namespace android {
+namespace base {
+
+// Where AsyncLog writes its lines to. Only ever called from the AsyncLog
+// thread, so implementations don't need to lock, but must not LOG()
+// themselves.
+class LogSink {
+public:
+    virtual ~LogSink() = default;
+
+    // |line| is a complete line, including the trailing newline.
+    virtual void write(const LogParams& params,
+                       const char* line,
+                       size_t lineLen) = 0;
+
+    // Called once everything queued so far has been written.
+    virtual void flush() {}
+};
+
+// Writes to stdout, and warnings and up to stderr, like the default output.
+std::unique_ptr<LogSink> makeStdioLogSink();
+
+// Appends to |path|. Returns nullptr if it can't be opened.
+std::unique_ptr<LogSink> makeFileLogSink(const char* path);
+
+// A logging backend that keeps the cost of LOG() on the calling thread down
+// to a copy of the message, so that turning on verbose logging doesn't
+// change the timing of render and vCPU threads.
+//
+// Every thread that logs gets its own ring of records, which only it writes
+// to and only the AsyncLog thread reads from, so queuing a message takes no
+// lock. Records keep the message text as streamed, with the file, line,
+// severity and time as they are; the AsyncLog thread turns them into lines
+// and hands those to the sinks. If a ring is full the message is dropped
+// rather than making the caller wait.
+//
+// Each call site may also be limited to a number of messages per second, to
+// keep a log statement in a hot loop from flooding the output. What is held
+// back is counted, and mentioned with the next message that gets through.
+// Call sites are told apart by a hash of their file and line, so two sites
+// can occasionally share a budget.
+class AsyncLog {
+public:
+    struct Options {
+        // Size of the ring of each thread, a power of 2.
+        size_t threadBufferBytes = 64 * 1024;
+        // Messages per second from a single call site, 0 for no limit.
+        // Errors are never limited.
+        uint32_t maxPerSecondPerSite = 0;
+    };
+
+    explicit AsyncLog(std::vector<std::unique_ptr<LogSink>> sinks);
+    AsyncLog(std::vector<std::unique_ptr<LogSink>> sinks, const Options& options);
+    // Writes out everything that is queued.
+    ~AsyncLog();
+
+    // Makes |log| the output of LOG() and friends, or goes back to writing
+    // from the calling thread if nullptr, and returns the previous one.
+    // Don't change it while other threads may be logging, the previous log
+    // can't be deleted until they are done with it.
+    static AsyncLog* install(AsyncLog* log);
+    static AsyncLog* installed() {
+        return sInstalled.load(std::memory_order_acquire);
+    }
+
+    // Queues a message from any thread, without blocking. Returns false if
+    // it was dropped or held back.
+    bool log(const LogParams& params, const char* message, size_t messageLen);
+
+    // Waits until everything the calling thread queued has been written.
+    void flush();
+
+    // Number of messages dropped because a ring was full.
+    uint64_t dropped() const { return mDropped; }
+    // Number of messages held back by the rate limit.
+    uint64_t suppressed() const { return mSuppressed; }
+
+private:
+    class ThreadBuffer;
+    struct ThreadHandle;
+    struct Record;
+
+    static constexpr int kSites = 1024;
+
+    ThreadBuffer* threadBuffer();
+    // Returns false if the call site used up its budget, and otherwise the
+    // number of messages it held back since the last one.
+    bool allowed(const LogParams& params, uint64_t timeUs, uint32_t* suppressed);
+    void run();
+    // Writes out all queued records, returns false if there were none.
+    bool drain();
+    void write(const Record& record, const char* message);
+
+    static std::atomic<AsyncLog*> sInstalled;
+
+    const Options mOptions;
+    const std::vector<std::unique_ptr<LogSink>> mSinks;
+    // Reused by the AsyncLog thread.
+    std::vector<char> mLine;
+    std::vector<ThreadBuffer*> mDraining;
+
+    // The rate limit of each call site: the current second in the high
+    // 32 bits, and how many messages went out in it in the low ones.
+    std::atomic<uint64_t> mSiteWindows[kSites] = {};
+    std::atomic<uint32_t> mSiteSuppressed[kSites] = {};
+
+    std::atomic<uint64_t> mDropped{0};
+    std::atomic<uint64_t> mSuppressed{0};
+
+    // Guards mBuffers, and waking up and flushing the AsyncLog thread.
+    Lock mLock;
+    ConditionVariable mWake;
+    ConditionVariable mFlushed;
+    std::vector<std::unique_ptr<ThreadBuffer>> mBuffers;
+    std::atomic<int> mSleeping{0};
+    uint64_t mFlushRequests = 0;
+    uint64_t mFlushesDone = 0;
+    bool mExiting = false;
+
+    FunctorThread mThread;
+    std::atomic<unsigned long> mThreadId{0};
+    // Declared last so that threads stop handing in their buffers before
+    // the buffers go away.
+    ThreadStore<ThreadHandle> mThreadHandles;
+
+    DISALLOW_COPY_AND_ASSIGN(AsyncLog);
+};
+
+}  // namespace base
+}  // namespace android
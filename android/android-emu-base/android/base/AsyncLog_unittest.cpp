@@ -0,0 +1,198 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/base/AsyncLog.h"
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "android/base/synchronization/Lock.h"
+#include "android/base/threads/FunctorThread.h"
+
+namespace android {
+namespace base {
+
+namespace {
+
+// Keeps what it is given, and can hold up the AsyncLog thread.
+class TestLogSink : public LogSink {
+public:
+    explicit TestLogSink(std::vector<std::string>* lines) : mLines(lines) {}
+
+    void write(const LogParams& params,
+               const char* line,
+               size_t lineLen) override {
+        AutoLock lock(*sBlock);
+        mLines->emplace_back(line, lineLen);
+    }
+
+    static Lock* sBlock;
+
+private:
+    std::vector<std::string>* const mLines;
+};
+
+Lock* TestLogSink::sBlock = nullptr;
+
+class AsyncLogTest : public ::testing::Test {
+protected:
+    void SetUp() override { TestLogSink::sBlock = &mBlock; }
+
+    std::unique_ptr<AsyncLog> makeLog(
+            const AsyncLog::Options& options = AsyncLog::Options()) {
+        std::vector<std::unique_ptr<LogSink>> sinks;
+        sinks.emplace_back(new TestLogSink(&mLines));
+        return std::unique_ptr<AsyncLog>(
+                new AsyncLog(std::move(sinks), options));
+    }
+
+    bool log(AsyncLog* log, int lineno, const std::string& message) {
+        return log->log(LogParams("/path/to/file.cpp", lineno, LOG_INFO),
+                        message.data(), message.size());
+    }
+
+    Lock mBlock;
+    std::vector<std::string> mLines;
+};
+
+}  // namespace
+
+TEST_F(AsyncLogTest, WritesLines) {
+    auto asyncLog = makeLog();
+    EXPECT_TRUE(log(asyncLog.get(), 12, "Hello world!"));
+    EXPECT_TRUE(asyncLog->log(LogParams("file.cpp", 3, LOG_WARNING, true),
+                              "quiet", 5));
+    asyncLog->flush();
+    EXPECT_EQ(std::vector<std::string>(
+                      {"emulator: INFO: file.cpp:12: Hello world!\n",
+                       "emulator: WARNING: quiet\n"}),
+              mLines);
+
+    // Long ones get through too.
+    const std::string longMessage(5000, 'x');
+    EXPECT_TRUE(log(asyncLog.get(), 1, longMessage));
+    asyncLog->flush();
+    ASSERT_EQ(3u, mLines.size());
+    EXPECT_EQ("emulator: INFO: file.cpp:1: " + longMessage + "\n", mLines[2]);
+}
+
+TEST_F(AsyncLogTest, KeepsOrderOfEveryThread) {
+    constexpr int kThreads = 4;
+    constexpr int kMessages = 5000;
+    AsyncLog::Options options;
+    // Small enough to wrap around plenty of times.
+    options.threadBufferBytes = 4096;
+    auto asyncLog = makeLog(options);
+
+    std::vector<std::unique_ptr<FunctorThread>> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back(new FunctorThread([this, t, &asyncLog]() {
+            for (int i = 0; i < kMessages; ++i) {
+                // Wait for room rather than drop, to check every message.
+                while (!log(asyncLog.get(), t, std::to_string(i))) {
+                }
+            }
+        }));
+        ASSERT_TRUE(threads.back()->start());
+    }
+    for (auto& thread : threads) {
+        thread->wait();
+    }
+    asyncLog->flush();
+
+    ASSERT_EQ(size_t(kThreads * kMessages), mLines.size());
+    std::vector<int> next(kThreads);
+    for (const auto& line : mLines) {
+        int t = -1;
+        int i = -1;
+        ASSERT_EQ(2, sscanf(line.c_str(), "emulator: INFO: file.cpp:%d: %d",
+                            &t, &i));
+        ASSERT_EQ(next[t]++, i) << "from thread " << t;
+    }
+}
+
+TEST_F(AsyncLogTest, DropsWhenFull) {
+    AsyncLog::Options options;
+    options.threadBufferBytes = 1024;
+    auto asyncLog = makeLog(options);
+
+    {
+        // Holds up the AsyncLog thread in the sink.
+        AutoLock block(mBlock);
+        EXPECT_TRUE(log(asyncLog.get(), 1, "first"));
+        int queued = 0;
+        while (log(asyncLog.get(), 2, "0123456789abcdef")) {
+            ++queued;
+        }
+        EXPECT_GT(1024 / 16, queued);
+        EXPECT_EQ(1u, asyncLog->dropped());
+    }
+    asyncLog->flush();
+    EXPECT_EQ(0u, asyncLog->suppressed());
+
+    // There is room again.
+    EXPECT_TRUE(log(asyncLog.get(), 3, "last"));
+    asyncLog->flush();
+    EXPECT_EQ("emulator: INFO: file.cpp:3: last\n", mLines.back());
+}
+
+TEST_F(AsyncLogTest, LimitsEveryCallSite) {
+    AsyncLog::Options options;
+    options.maxPerSecondPerSite = 5;
+    auto asyncLog = makeLog(options);
+
+    int passed = 0;
+    for (int i = 0; i < 100; ++i) {
+        passed += log(asyncLog.get(), 1, "spam");
+    }
+    // Unless a new second started in between.
+    EXPECT_LE(5, passed);
+    EXPECT_GE(10, passed);
+    EXPECT_EQ(100u - passed, asyncLog->suppressed());
+
+    // Other call sites and errors still get through.
+    EXPECT_TRUE(log(asyncLog.get(), 2, "other"));
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(asyncLog->log(
+                LogParams("/path/to/file.cpp", 1, LOG_ERROR), "error", 5));
+    }
+    asyncLog->flush();
+    EXPECT_EQ(size_t(passed + 11), mLines.size());
+}
+
+TEST_F(AsyncLogTest, BacksLog) {
+    auto asyncLog = makeLog();
+    EXPECT_EQ(nullptr, AsyncLog::install(asyncLog.get()));
+    const LogSeverity savedLevel = getMinLogLevel();
+    setMinLogLevel(LOG_INFO);
+
+    LOG(INFO) << "Routed " << 1;
+    const int line = __LINE__ - 1;
+    // Errors are written before LOG() returns.
+    LOG(ERROR) << "Now";
+
+    EXPECT_EQ(asyncLog.get(), AsyncLog::install(nullptr));
+    setMinLogLevel(savedLevel);
+    ASSERT_EQ(2u, mLines.size());
+    EXPECT_EQ("emulator: INFO: AsyncLog_unittest.cpp:" + std::to_string(line) +
+                      ": Routed 1\n",
+              mLines[0]);
+}
+
+}  // namespace base
+}  // namespace android
@@ -15,10 +15,13 @@
 
 #include "android/base/AlignedBuf.h"
 
+#include <algorithm>
 #include <vector>
-#include <unordered_set>
 
 #include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 namespace android {
 namespace base {
@@ -26,15 +29,19 @@ namespace base {
 // Class to make it easier to set up memory regions where it is fast
 // to allocate buffers AND we don't care about freeing individual pieces,
 // BUT it's necessary to preserve previous pointer values in between the first
-// alloc() after a freeAll(), and the freeAll() itself, allowing some sloppy use of
-// malloc in the first pass while we find out how much data was needed.
+// alloc() after a freeAll(), and the freeAll() itself.
+//
+// Allocations that don't fit in the storage are carved out of overflow
+// blocks that double in size, so a generation that outgrows the pool costs
+// a handful of mallocs rather than one per allocation. freeAll() then grows
+// the storage so that the next generation of the same size fits in it.
 class BumpPool {
 public:
     BumpPool(size_t startingBytes = 4096) : mStorage(startingBytes / sizeof(uint64_t))  { }
     // All memory allocated by this pool
     // is automatically deleted when the pool
     // is deconstructed.
-    ~BumpPool() { }
+    ~BumpPool() { freeOverflowBlocks(); }
 
     void* alloc(size_t wantedSize) {
         size_t wantedSizeRoundedUp =
@@ -42,12 +49,8 @@ public:
 
         mTotalWantedThisGeneration += wantedSizeRoundedUp;
         if (mAllocPos + wantedSizeRoundedUp > mStorage.size() * sizeof(uint64_t)) {
-            mNeedRealloc = true;
-            void* fallbackPtr = malloc(wantedSizeRoundedUp);
-            mFallbackPtrs.insert(fallbackPtr);
-            return fallbackPtr;
+            return allocOverflow(wantedSizeRoundedUp);
         }
-        size_t avail = mStorage.size() * sizeof(uint64_t) - mAllocPos;
         void* allocPtr = (void*)(((unsigned char*)mStorage.data()) + mAllocPos);
         mAllocPos += wantedSizeRoundedUp;
         return allocPtr;
@@ -55,17 +58,20 @@ public:
 
     void freeAll() {
         mAllocPos = 0;
-        if (mNeedRealloc) {
+        if (!mOverflowBlocks.empty()) {
+            freeOverflowBlocks();
+            // Drop the old contents first so that resize() doesn't copy them.
+            mStorage.resize(0);
             mStorage.resize((mTotalWantedThisGeneration * 2) / sizeof(uint64_t));
-            mNeedRealloc = false;
-            for (auto ptr : mFallbackPtrs) {
-                free(ptr);
-            }
-            mFallbackPtrs.clear();
+            ++mBackingAllocations;
         }
         mTotalWantedThisGeneration = 0;
     }
 
+    // Number of times the pool went to malloc for memory, for tests and
+    // benchmarks.
+    size_t backingAllocations() const { return mBackingAllocations; }
+
     // Convenience function to allocate an array
     // of objects of type T.
     template <class T>
@@ -100,11 +106,42 @@ public:
     }
 
 private:
+    void* allocOverflow(size_t bytes) {
+        if (mOverflowBlocks.empty() || mOverflowPos + bytes > mOverflowBlockBytes) {
+            mOverflowBlockBytes = std::max(
+                    bytes, std::max(mOverflowBlockBytes * 2,
+                                    mStorage.size() * sizeof(uint64_t)));
+            void* block = malloc(mOverflowBlockBytes);
+            if (!block) {
+                fprintf(stderr, "%s: failed to alloc %zu bytes\n", __func__,
+                        mOverflowBlockBytes);
+                abort();
+            }
+            mOverflowBlocks.push_back(block);
+            mOverflowPos = 0;
+            ++mBackingAllocations;
+        }
+        void* allocPtr = (unsigned char*)mOverflowBlocks.back() + mOverflowPos;
+        mOverflowPos += bytes;
+        return allocPtr;
+    }
+
+    void freeOverflowBlocks() {
+        for (auto block : mOverflowBlocks) {
+            free(block);
+        }
+        mOverflowBlocks.clear();
+        mOverflowBlockBytes = 0;
+        mOverflowPos = 0;
+    }
+
     AlignedBuf<uint64_t, 8> mStorage;
-    std::unordered_set<void*> mFallbackPtrs;
+    std::vector<void*> mOverflowBlocks;
+    size_t mOverflowBlockBytes = 0;
+    size_t mOverflowPos = 0;
     size_t mAllocPos = 0;
     size_t mTotalWantedThisGeneration = 0;
-    bool mNeedRealloc = false;
+    size_t mBackingAllocations = 1;
 };
 
 } // namespace base
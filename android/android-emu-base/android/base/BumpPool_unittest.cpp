@@ -0,0 +1,72 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "android/base/BumpPool.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace android {
+namespace base {
+
+// Allocations are 8 byte aligned, and stay valid until freeAll(), even
+// once the pool runs over its storage.
+TEST(BumpPool, KeepsAllocationsUntilFreeAll) {
+    BumpPool pool(64);
+    std::vector<uint32_t*> ptrs;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        uint32_t* ptr = pool.allocArray<uint32_t>(1 + i % 7);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(ptr) % 8);
+        *ptr = i;
+        ptrs.push_back(ptr);
+    }
+    for (uint32_t i = 0; i < ptrs.size(); ++i) {
+        EXPECT_EQ(i, *ptrs[i]);
+    }
+    pool.freeAll();
+
+    EXPECT_STREQ("hello", pool.strDup("hello"));
+    const char* strs[] = {"a", "bc"};
+    char** dup = pool.strDupArray(strs, 2);
+    EXPECT_STREQ("a", dup[0]);
+    EXPECT_STREQ("bc", dup[1]);
+}
+
+// Running over the storage costs a few mallocs, not one per allocation, and
+// once the pool has grown, a generation of the same size costs none.
+TEST(BumpPool, GrowsToFitAGeneration) {
+    BumpPool pool(64);
+    EXPECT_EQ(1u, pool.backingAllocations());
+
+    auto generation = [&pool] {
+        for (int i = 0; i < 10000; ++i) {
+            pool.alloc(24);
+        }
+        pool.dupArray(std::vector<char>(100000).data(), 100000);
+    };
+
+    generation();
+    EXPECT_GE(16u, pool.backingAllocations());
+    pool.freeAll();
+
+    const size_t grown = pool.backingAllocations();
+    for (int i = 0; i < 10; ++i) {
+        generation();
+        pool.freeAll();
+    }
+    EXPECT_EQ(grown, pool.backingAllocations());
+}
+
+}  // namespace base
+}  // namespace android
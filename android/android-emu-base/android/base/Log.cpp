@@ -18,9 +18,11 @@
 #include <string.h>                        // for memcpy, strerror
 
 #include "android/base/ArraySize.h"        // for arraySize
+#include "android/base/AsyncLog.h"         // for AsyncLog
 #include "android/base/Debug.h"            // for DebugBreak, IsDebuggerAtta...
 #include "android/base/StringView.h"       // for StringView, c_str, CStrWra...
 #include "android/base/files/PathUtils.h"  // for PathUtils
+#include "android/base/threads/ThreadStore.h"  // for ThreadStore
 #include "android/utils/debug.h"
 
 #define ENABLE_THREAD_ID 0
@@ -36,20 +38,13 @@ testing::LogOutput* gLogOutput = NULL;
 bool gDcheckLevel = false;
 LogSeverity gMinLogLevel = LOG_INFO;
 
-// Convert a severity level into a string.
-const char* severityLevelToString(LogSeverity severity) {
-    const char* kSeverityStrings[] = {
-            "INFO",
-            "WARNING",
-            "ERROR",
-            "FATAL",
-    };
-    if (severity >= 0 && severity < LOG_NUM_SEVERITIES)
-        return kSeverityStrings[severity];
-    if (severity == -1) {
-        return "VERBOSE";
+void exitIfFatal(const LogParams& params) {
+    if (params.severity >= LOG_FATAL) {
+        if (IsDebuggerAttached()) {
+            android::base::DebugBreak();
+        }
+        _exit(1);
     }
-    return "UNKNOWN";
 }
 
 // Default log output function
@@ -92,12 +87,25 @@ void defaultLogMessage(const LogParams& params,
         }
     }
 
-    if (params.severity >= LOG_FATAL) {
-        if (IsDebuggerAttached()) {
-            android::base::DebugBreak();
-        }
-        _exit(1);
+    exitIfFatal(params);
+}
+
+void asyncLogMessage(AsyncLog* log,
+                     const LogParams& params,
+                     const char* message,
+                     size_t messageLen) {
+    if (params.severity < LOG_ERROR) {
+        log->log(params, message, messageLen);
+        return;
     }
+
+    // Errors must not get lost, and must be out before a possible crash.
+    if (!log->log(params, message, messageLen)) {
+        log->flush();
+        log->log(params, message, messageLen);
+    }
+    log->flush();
+    exitIfFatal(params);
 }
 
 void logMessage(const LogParams& params,
@@ -105,13 +113,60 @@ void logMessage(const LogParams& params,
                 size_t messageLen) {
     if (gLogOutput) {
         gLogOutput->logMessage(params, message, messageLen);
+    } else if (AsyncLog* log = AsyncLog::installed()) {
+        asyncLogMessage(log, params, message, messageLen);
     } else {
         defaultLogMessage(params, message, messageLen);
     }
 }
 
+// Setting up a std::ostream is a good part of what a LOG() costs, so every
+// thread keeps one around. A LOG() made while another one is being streamed
+// gets a new one.
+ThreadStore<LogStream>* logStreams() {
+    // Never deleted, as it may be needed until the very end.
+    static ThreadStore<LogStream>* sStreams = new ThreadStore<LogStream>();
+    return sStreams;
+}
+
+LogStream* acquireLogStream(const char* file,
+                            int line,
+                            LogSeverity severity,
+                            bool quiet) {
+    LogStream* stream = logStreams()->swap(nullptr);
+    if (!stream) {
+        return new LogStream(file, line, severity, quiet);
+    }
+    stream->reset(file, line, severity, quiet);
+    return stream;
+}
+
+void releaseLogStream(LogStream* stream) {
+    if (logStreams()->get()) {
+        delete stream;
+    } else {
+        logStreams()->set(stream);
+    }
+}
+
 }  // namespace
 
+// Convert a severity level into a string.
+const char* severityLevelToString(LogSeverity severity) {
+    const char* kSeverityStrings[] = {
+            "INFO",
+            "WARNING",
+            "ERROR",
+            "FATAL",
+    };
+    if (severity >= 0 && severity < LOG_NUM_SEVERITIES)
+        return kSeverityStrings[severity];
+    if (severity == -1) {
+        return "VERBOSE";
+    }
+    return "UNKNOWN";
+}
+
 // DCHECK level.
 
 bool dcheckIsEnabled() {
@@ -156,7 +211,23 @@ LogStream::LogStream(const char* file,
                      int lineno,
                      LogSeverity severity,
                      bool quiet)
-    : mParams(file, lineno, severity, quiet), mStream(&mStreamBuf) {}
+    : mParams(file, lineno, severity, quiet),
+      mStream(&mStreamBuf),
+      mDefaultFlags(mStream.flags()) {}
+
+void LogStream::reset(const char* file,
+                      int lineno,
+                      LogSeverity severity,
+                      bool quiet) {
+    mParams = LogParams(file, lineno, severity, quiet);
+    mStreamBuf.reset();
+    // Undo whatever the previous message did with std::hex and friends.
+    mStream.clear();
+    mStream.flags(mDefaultFlags);
+    mStream.precision(6);
+    mStream.width(0);
+    mStream.fill(' ');
+}
 
 std::ostream& operator<<(std::ostream& stream,
                          const android::base::LogString& str) {
@@ -176,6 +247,13 @@ LogstreamBuf::LogstreamBuf() {
     setp(mStr, mStr + arraySize(mStr));
 }
 
+void LogstreamBuf::reset() {
+    if (!mLongString.empty()) {
+        std::vector<char>().swap(mLongString);
+    }
+    setp(mStr, mStr + arraySize(mStr));
+}
+
 size_t LogstreamBuf::size() {
     return this->pptr() - this->pbase();
 }
@@ -217,11 +295,11 @@ LogMessage::LogMessage(const char* file,
                        int line,
                        LogSeverity severity,
                        bool quiet)
-    : mStream(new LogStream(file, line, severity, quiet)) {}
+    : mStream(acquireLogStream(file, line, severity, quiet)) {}
 
 LogMessage::~LogMessage() {
     logMessage(mStream->params(), mStream->str(), mStream->size());
-    delete mStream;
+    releaseLogStream(mStream);
 }
 
 // ErrnoLogMessage
@@ -231,13 +309,13 @@ ErrnoLogMessage::ErrnoLogMessage(const char* file,
                                  LogSeverity severity,
                                  int errnoCode)
     : mStream(nullptr), mErrno(errnoCode) {
-    mStream = new LogStream(file, line, severity, false);
+    mStream = acquireLogStream(file, line, severity, false);
 }
 
 ErrnoLogMessage::~ErrnoLogMessage() {
     (*mStream) << "Error message: " << strerror(mErrno);
     logMessage(mStream->params(), mStream->str(), mStream->size());
-    delete mStream;
+    releaseLogStream(mStream);
     // Restore the errno.
     errno = mErrno;
 }
@@ -48,6 +48,9 @@ enum LogSeverity {
 LogSeverity getMinLogLevel();
 void setMinLogLevel(LogSeverity level);
 
+// Convert a severity level into a string, e.g. "INFO".
+const char* severityLevelToString(LogSeverity severity);
+
 // Convert a log level name (e.g. 'INFO') into the equivalent
 // ::android::base LOG_<name> constant.
 #define LOG_SEVERITY_FROM(x) ::android::base::LOG_##x
@@ -292,6 +295,8 @@ public:
 
     size_t size();
     char* str();
+    // Empties the buffer for the next message.
+    void reset();
 
 protected:
     int overflow (int c = EOF) override;
@@ -313,6 +318,9 @@ public:
     LogStream(const char* file, int lineno, LogSeverity severity, bool quiet);
     ~LogStream() = default;
 
+    // Gets ready for a new message, as if it was just constructed.
+    void reset(const char* file, int lineno, LogSeverity severity, bool quiet);
+
     template <typename T>
     std::ostream& operator<<(const T& t) {
         return mStream << t;
@@ -327,6 +335,7 @@ private:
     LogParams mParams;
     LogstreamBuf mStreamBuf;
     std::ostream mStream;
+    const std::ios_base::fmtflags mDefaultFlags;
 };
 
 // Add your own types when needed:
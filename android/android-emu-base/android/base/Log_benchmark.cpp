@@ -15,10 +15,13 @@
 // A small benchmark used to compare the performance of android::base::Lock
 // with other mutex implementions.
 
+#include "android/base/AsyncLog.h"
 #include "android/base/Log.h"
 #include "android/utils/debug.h"
 #include "benchmark/benchmark_api.h"
 
+#include <stdio.h>
+
 #define BASIC_BENCHMARK_TEST(x) BENCHMARK(x)->Arg(8)->Arg(512)->Arg(8192)
 
 void BM_LG_Log_simple_string(benchmark::State& state) {
@@ -79,6 +82,50 @@ void BM_LG_Log_complex_msg(benchmark::State& state) {
     }
 }
 
+// Sends LOG() through an AsyncLog writing to stdout for as long as it lives,
+// and reports how many messages didn't make it.
+class AsyncLogScope {
+public:
+    explicit AsyncLogScope(benchmark::State& state) : mState(state) {
+        std::vector<std::unique_ptr<android::base::LogSink>> sinks;
+        sinks.push_back(android::base::makeStdioLogSink());
+        mLog.reset(new android::base::AsyncLog(std::move(sinks)));
+        android::base::AsyncLog::install(mLog.get());
+    }
+
+    ~AsyncLogScope() {
+        android::base::AsyncLog::install(nullptr);
+        char label[64];
+        snprintf(label, sizeof(label), "dropped %llu",
+                 (unsigned long long)mLog->dropped());
+        mState.SetLabel(label);
+    }
+
+private:
+    benchmark::State& mState;
+    std::unique_ptr<android::base::AsyncLog> mLog;
+};
+
+void BM_LG_AsyncLog_simple_string(benchmark::State& state) {
+    setMinLogLevel(android::base::LogSeverity::LOG_INFO);
+    AsyncLogScope async(state);
+    while (state.KeepRunning()) {
+        LOG(INFO) << "Hello world!";
+    }
+}
+
+void BM_LG_AsyncLog_complex_msg(benchmark::State& state) {
+    setMinLogLevel(android::base::LogSeverity::LOG_INFO);
+    AsyncLogScope async(state);
+
+    int i = 0;
+    int j = 0;
+    while (state.KeepRunning()) {
+        LOG(INFO) << "Hello, i: " << i++ << ", with: " << j << ", and that's all!";
+        j = 2 * i;
+    }
+}
+
 BENCHMARK(BM_LG_Log_simple_string);
 BENCHMARK(BM_LG_Log_simple_string_logging_off);
 BENCHMARK(BM_LG_QLog_simple_string);
@@ -86,3 +133,5 @@ BENCHMARK(BM_LG_VLog_simple_string_off);
 BENCHMARK(BM_LG_VLog_simple_string_on);
 BENCHMARK(BM_LG_Log_simple_int);
 BENCHMARK(BM_LG_Log_complex_msg);
+BENCHMARK(BM_LG_AsyncLog_simple_string);
+BENCHMARK(BM_LG_AsyncLog_complex_msg);
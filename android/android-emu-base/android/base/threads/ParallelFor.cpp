@@ -0,0 +1,114 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/base/threads/ParallelFor.h"
+
+#include <algorithm>  // for max, min
+
+#include "android/base/synchronization/ConditionVariable.h"  // for Conditio...
+#include "android/base/synchronization/Lock.h"  // for AutoLock, Lock
+#include "android/base/threads/ThreadPool.h"    // for ThreadPool
+
+namespace android {
+namespace base {
+
+namespace {
+
+struct Job {
+    const std::function<void(int)>* func;
+    Lock lock;
+    ConditionVariable done;
+    int pending;
+};
+
+struct Task {
+    Job* job;
+    int index;
+};
+
+}  // namespace
+
+struct ParallelFor::Workers {
+    explicit Workers(int threads)
+        : pool(threads, [](Task&& task) {
+              Job* job = task.job;
+              (*job->func)(task.index);
+              AutoLock lock(job->lock);
+              if (--job->pending == 0) {
+                  job->done.signal();
+              }
+          }) {}
+
+    ThreadPool<Task> pool;
+};
+
+ParallelFor::ParallelFor(int threads) {
+    // The calling thread runs a task too.
+    if (threads > 1) {
+        mWorkers.reset(new Workers(threads - 1));
+        if (!mWorkers->pool.start()) {
+            mWorkers.reset();
+        }
+    }
+}
+
+ParallelFor::~ParallelFor() = default;
+
+int ParallelFor::threads() const {
+    return mWorkers ? mWorkers->pool.numWorkers() + 1 : 1;
+}
+
+void ParallelFor::forEach(int count, const std::function<void(int)>& func) {
+    if (count <= 1 || !mWorkers) {
+        for (int i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    Job job;
+    job.func = &func;
+    job.pending = count - 1;
+    // The first task is left for the calling thread.
+    for (int i = 1; i < count; ++i) {
+        mWorkers->pool.enqueue({&job, i});
+    }
+    func(0);
+
+    AutoLock lock(job.lock);
+    job.done.wait(&lock, [&job] { return job.pending == 0; });
+}
+
+void ParallelFor::forRows(
+        int rows,
+        int rowAlign,
+        int minRowsPerBand,
+        const std::function<void(int firstRow, int rows)>& func) {
+    const int bands =
+            std::min(threads(), std::max(1, rows / std::max(1, minRowsPerBand)));
+    if (bands == 1) {
+        func(0, rows);
+        return;
+    }
+
+    const int bandRows =
+            ((rows + bands - 1) / bands + rowAlign - 1) / rowAlign * rowAlign;
+    forEach((rows + bandRows - 1) / bandRows, [&](int band) {
+        const int firstRow = band * bandRows;
+        func(firstRow, std::min(bandRows, rows - firstRow));
+    });
+}
+
+}  // namespace base
+}  // namespace android
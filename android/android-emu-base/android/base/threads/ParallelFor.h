@@ -0,0 +1,66 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>  // for function
+#include <memory>      // for unique_ptr
+
+#include "android/base/Compiler.h"  // for DISALLOW_COPY_ASSIGN_AND_MOVE
+
+namespace android {
+namespace base {
+
+// Splits a job into tasks that run on a pool of worker threads and on the
+// calling thread, and returns once all of them are done. Meant for image
+// work, where a frame is cut into bands of rows, or a batch of frames is
+// processed one per thread.
+//
+// Can be used from several threads at once, their tasks share the workers.
+//
+//   ParallelFor parallel(4);
+//   parallel.forRows(height, 2, 64, [&](int firstRow, int rows) {
+//       convert(src + firstRow * stride, rows);
+//   });
+class ParallelFor {
+public:
+    // |threads| is how many threads run the tasks of a job, counting the
+    // calling one. With 1, or if no worker could start, everything runs on
+    // the calling thread.
+    explicit ParallelFor(int threads);
+    ~ParallelFor();
+
+    int threads() const;
+
+    // Runs |func| for every index in [0, count).
+    void forEach(int count, const std::function<void(int)>& func);
+
+    // Runs |func| over all of |rows|, in at most threads() bands of at
+    // least |minRowsPerBand| rows. Every band but the last starts and ends
+    // at a multiple of |rowAlign|, e.g. 2 so that the bands of a YUV 4:2:0
+    // frame don't share chroma rows.
+    void forRows(int rows,
+                 int rowAlign,
+                 int minRowsPerBand,
+                 const std::function<void(int firstRow, int rows)>& func);
+
+private:
+    struct Workers;
+    std::unique_ptr<Workers> mWorkers;
+
+    DISALLOW_COPY_ASSIGN_AND_MOVE(ParallelFor);
+};
+
+}  // namespace base
+}  // namespace android
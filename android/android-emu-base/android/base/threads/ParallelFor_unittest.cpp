@@ -0,0 +1,79 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/base/threads/ParallelFor.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include "android/base/synchronization/Lock.h"
+
+namespace android {
+namespace base {
+
+TEST(ParallelFor, Threads) {
+    EXPECT_EQ(1, ParallelFor(1).threads());
+    EXPECT_EQ(1, ParallelFor(0).threads());
+    EXPECT_EQ(3, ParallelFor(3).threads());
+}
+
+TEST(ParallelFor, ForEachRunsEveryIndexOnce) {
+    for (int threads : {1, 4}) {
+        ParallelFor parallel(threads);
+        std::vector<std::atomic<int>> runs(100);
+        parallel.forEach(runs.size(), [&runs](int i) { ++runs[i]; });
+        for (const auto& count : runs) {
+            EXPECT_EQ(1, count);
+        }
+        // Nothing to do.
+        parallel.forEach(0, [](int i) { FAIL(); });
+    }
+}
+
+TEST(ParallelFor, ForRowsCoversAllRows) {
+    ParallelFor parallel(4);
+    // An odd count, so that the last band is short.
+    constexpr int kRows = 251;
+    Lock lock;
+    std::vector<int> covered(kRows);
+    std::vector<int> firstRows;
+    parallel.forRows(kRows, 2, 16, [&](int firstRow, int rows) {
+        AutoLock autoLock(lock);
+        firstRows.push_back(firstRow);
+        for (int i = firstRow; i < firstRow + rows; ++i) {
+            ++covered[i];
+        }
+    });
+    EXPECT_EQ(std::vector<int>(kRows, 1), covered);
+    EXPECT_EQ(4u, firstRows.size());
+    for (int firstRow : firstRows) {
+        EXPECT_EQ(0, firstRow % 2);
+    }
+}
+
+TEST(ParallelFor, ForRowsKeepsSmallJobsTogether) {
+    ParallelFor parallel(4);
+    int bands = 0;
+    parallel.forRows(100, 2, 64, [&bands](int firstRow, int rows) {
+        EXPECT_EQ(0, firstRow);
+        EXPECT_EQ(100, rows);
+        ++bands;
+    });
+    EXPECT_EQ(1, bands);
+}
+
+}  // namespace base
+}  // namespace android
@@ -78,6 +78,7 @@ set(android-emu-common
     android/emulation/CpuAccelerator.cpp
     android/emulation/CrossSessionSocket.cpp
     android/emulation/DmaMap.cpp
+    android/emulation/FilePushPipe.cpp
     android/emulation/goldfish_sync.cpp
     android/emulation/GoldfishDma.cpp
     android/emulation/GoldfishSyncCommandQueue.cpp
@@ -104,6 +105,7 @@ set(android-emu-common
     android/emulation/MultiDisplayPipe.cpp
     android/emulation/nand_limits.c
     android/emulation/ParameterList.cpp
+    android/emulation/PipeWakeQueue.cpp
     android/emulation/qemud/android_qemud_client.cpp
     android/emulation/qemud/android_qemud_multiplexer.cpp
     android/emulation/qemud/android_qemud_serial.cpp
@@ -210,6 +212,7 @@ set(android-emu-common
     android/qemu-tcpdump.c
     android/qt/qt_path.cpp
     android/qt/qt_setup.cpp
+    android/recording/video/SharedFrameExchange.cpp
     android/resource.c
     android/sdk-controller-socket.c
     android/sensor_mock/SensorMockUtils.cpp
@@ -298,6 +301,7 @@ set(android_emu_dependent_src
     android/camera/camera-format-converters.c
     android/camera/camera-list.cpp
     android/camera/camera-metrics.cpp
+    android/camera/camera-parallel.cpp
     android/camera/camera-service.cpp
     android/camera/camera-videoplayback-default-renderer.cpp
     android/camera/camera-videoplayback-render-multiplexer.cpp
@@ -306,6 +310,7 @@ set(android_emu_dependent_src
     android/camera/camera-virtualscene-utils.cpp
     android/camera/camera-virtualscene.cpp
     android/console.cpp
+    android/emulation/control/PngEncoder.cpp
     android/emulation/control/ScreenCapturer.cpp
     android/emulation/FakeRotatingCameraSensor.cpp
     android/emulation/HostMemoryService.cpp
@@ -572,6 +577,7 @@ set(android-emu-min
     android/emulation/control/LineConsumer.cpp
     android/emulation/control/NopRtcBridge.cpp
     android/emulation/DmaMap.cpp
+    android/emulation/FilePushPipe.cpp
     android/emulation/goldfish_sync.cpp
     android/emulation/GoldfishDma.cpp
     android/emulation/GoldfishSyncCommandQueue.cpp
@@ -581,6 +587,7 @@ set(android-emu-min
     android/emulation/LogcatPipe.cpp
     android/emulation/nand_limits.c
     android/emulation/ParameterList.cpp
+    android/emulation/PipeWakeQueue.cpp
     android/emulation/RefcountPipe.cpp
     android/emulation/serial_line.cpp
     android/emulation/SerialLine.cpp
@@ -843,17 +850,20 @@ if(NOT LINUX_AARCH64)
       android/emulation/control/FilePusher_unittest.cpp
       android/emulation/control/GooglePlayServices_unittest.cpp
       android/emulation/control/LineConsumer_unittest.cpp
+      android/emulation/control/PngEncoder_unittest.cpp
       android/emulation/control/ScreenCapturer_unittest.cpp
       android/emulation/CpuAccelerator_unittest.cpp
       android/emulation/CrossSessionSocket_unittest.cpp
       android/emulation/DeviceContextRunner_unittest.cpp
       android/emulation/DmaMap_unittest.cpp
+      android/emulation/FilePushPipe_unittest.cpp
       android/emulation/hostdevices/HostAddressSpace_unittest.cpp
       android/emulation/hostdevices/HostGoldfishPipe_unittest.cpp
       android/emulation/HostmemIdMapping_unittest.cpp
       android/emulation/HostMemoryService_unittest.cpp
       android/emulation/Hypervisor_unittest.cpp
       android/emulation/ParameterList_unittest.cpp
+      android/emulation/PipeWakeQueue_unittest.cpp
       android/emulation/RefcountPipe_unittest.cpp
       android/emulation/serial_line_unittest.cpp
       android/emulation/SetupParameters_unittest.cpp
@@ -900,7 +910,9 @@ if(NOT LINUX_AARCH64)
       android/proxy/ProxyUtils_unittest.cpp
       android/qt/qt_path_unittest.cpp
       android/qt/qt_setup_unittest.cpp
+      android/recording/video/SharedFrameExchange_unittest.cpp
       android/sensor_replay/sensor_session_playback_unittest.cpp
+      android/shaper_unittest.cpp
       android/snapshot/RamLoader_unittest.cpp
       android/snapshot/RamSaver_unittest.cpp
       android/snapshot/RamSnapshot_unittest.cpp
@@ -969,6 +981,20 @@ if(NOT LINUX_AARCH64)
   target_link_libraries(android-emu_unittests PRIVATE android-emu
                                                       android-emu-test-launcher)
 
+  android_add_executable(
+    NODISTRIBUTE TARGET android-emu-camera_format_converters_benchmark
+    SRC # cmake-format: sortable
+        android/camera/CameraFormatConverters_benchmark.cpp)
+  target_link_libraries(android-emu-camera_format_converters_benchmark
+                        PRIVATE android-emu emulator-gbench)
+
+  android_add_executable(
+    NODISTRIBUTE TARGET android-emu-shaper_benchmark
+    SRC # cmake-format: sortable
+        android/shaper_benchmark.cpp)
+  target_link_libraries(android-emu-shaper_benchmark PRIVATE android-emu
+                                                             emulator-gbench)
+
   android_add_executable(
     NODISTRIBUTE TARGET studio_discovery_tester
     SRC # cmake-format: sortable
@@ -4,6 +4,7 @@ prebuilt(FFMPEG)
 
 set(ANDROID_LIBUI_HEADLESS_SRC_FILES
     # cmake-format: sortable
+    android/emulation/control/PngEncoder.cpp
     android/emulation/control/ScreenCapturer.cpp
     android/emulator-window.c
     android/gpu_frame.cpp
@@ -12,12 +13,15 @@ set(ANDROID_LIBUI_HEADLESS_SRC_FILES
     android/mp4/MP4Demuxer.cpp
     android/mp4/SensorLocationEventProvider.cpp
     android/mp4/VideoMetadataProvider.cpp
+    android/recording/audio/AudioCaptureHub.cpp
+    android/recording/audio/AudioConverter.cpp
     android/recording/audio/AudioProducer.cpp
     android/recording/codecs/audio/VorbisCodec.cpp
     android/recording/codecs/video/VP9Codec.cpp
     android/recording/FfmpegRecorder.cpp
     android/recording/Frame.cpp
     android/recording/GifConverter.cpp
+    android/recording/GifEncoder.cpp
     android/recording/screen-recorder.cpp
     android/recording/video/GuestReadbackWorker.cpp
     android/recording/video/player/Clock.cpp
@@ -25,6 +29,7 @@ set(ANDROID_LIBUI_HEADLESS_SRC_FILES
     android/recording/video/player/PacketQueue.cpp
     android/recording/video/player/VideoPlayer.cpp
     android/recording/video/player/VideoPlayerNotifier.cpp
+    android/recording/video/TiledFrameConverter.cpp
     android/recording/video/VideoFrameSharer.cpp
     android/recording/video/VideoProducer.cpp
     android/resource.c
@@ -50,6 +55,7 @@ set(ANDROID_LIBUI_HEADLESS_SRC_FILES
 
 set(ANDROID_LIBUI_SRC_FILES
     # cmake-format: sortable
+    android/emulation/control/PngEncoder.cpp
     android/emulation/control/ScreenCapturer.cpp
     android/emulator-window.c
     android/gpu_frame.cpp
@@ -58,12 +64,15 @@ set(ANDROID_LIBUI_SRC_FILES
     android/mp4/MP4Demuxer.cpp
     android/mp4/SensorLocationEventProvider.cpp
     android/mp4/VideoMetadataProvider.cpp
+    android/recording/audio/AudioCaptureHub.cpp
+    android/recording/audio/AudioConverter.cpp
     android/recording/audio/AudioProducer.cpp
     android/recording/codecs/audio/VorbisCodec.cpp
     android/recording/codecs/video/VP9Codec.cpp
     android/recording/FfmpegRecorder.cpp
     android/recording/Frame.cpp
     android/recording/GifConverter.cpp
+    android/recording/GifEncoder.cpp
     android/recording/screen-recorder.cpp
     android/recording/video/GuestReadbackWorker.cpp
     android/recording/video/player/Clock.cpp
@@ -71,6 +80,7 @@ set(ANDROID_LIBUI_SRC_FILES
     android/recording/video/player/PacketQueue.cpp
     android/recording/video/player/VideoPlayer.cpp
     android/recording/video/player/VideoPlayerNotifier.cpp
+    android/recording/video/TiledFrameConverter.cpp
     android/recording/video/VideoFrameSharer.cpp
     android/recording/video/VideoProducer.cpp
     android/resource.c
@@ -415,10 +425,15 @@ if(NOT LINUX_AARCH64)
         android/mp4/MP4Demuxer_test.cpp
         android/mp4/SensorLocationEventProvider_test.cpp
         android/mp4/VideoMetadataProvider_test.cpp
+        android/recording/audio/AudioCaptureHub_unittest.cpp
+        android/recording/audio/AudioConverter_unittest.cpp
         android/recording/FfmpegRecorder.cpp
+        android/recording/GifEncoder_unittest.cpp
         android/recording/test/DummyAudioProducer.cpp
         android/recording/test/DummyVideoProducer.cpp
         android/recording/test/FfmpegRecorder_unittest.cpp
+        android/recording/video/TiledFrameConverter_unittest.cpp
+        android/recording/video/player/FrameQueue_unittest.cpp
         android/skin/keycode-buffer_unittest.cpp
         android/skin/keycode_unittest.cpp
         android/skin/qt/native-keyboard-event-handler_unittest.cpp
@@ -460,6 +475,22 @@ if(NOT LINUX_AARCH64)
   android_target_link_libraries(emulator-libui_unittests windows_msvc-x86_64
                                 PUBLIC dirent-win32)
 
+  android_add_executable(
+    NODISTRIBUTE TARGET emulator-libui-frame_queue_benchmark
+    SRC # cmake-format: sortable
+        android/recording/video/player/FrameQueue_benchmark.cpp)
+  target_link_libraries(
+    emulator-libui-frame_queue_benchmark PRIVATE emulator-libui android-emu
+                                                 FFMPEG::FFMPEG emulator-gbench)
+
+  android_add_executable(
+    NODISTRIBUTE TARGET emulator-libui-audio_converter_benchmark
+    SRC # cmake-format: sortable
+        android/recording/audio/AudioConverter_benchmark.cpp)
+  target_link_libraries(
+    emulator-libui-audio_converter_benchmark
+    PRIVATE emulator-libui android-emu FFMPEG::FFMPEG emulator-gbench)
+
 endif()
 # Version of libui without Qt
 set(emulator-libui-headless_src ${ANDROID_LIBUI_HEADLESS_SRC_FILES})
@@ -0,0 +1,123 @@
+// Copyright 2021 The Android Open Source Project
+//
+// This software is licensed under the terms of the GNU General Public
+// License version 2, as published by the Free Software Foundation, and
+// may be copied, distributed, and modified under those terms.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Measures the conversion of a captured frame into the two framebuffers the
+// camera service sends to the guest: NV21 for video and RGB32 for preview.
+
+#include "android/camera/camera-format-converters.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+namespace {
+
+// Webcams mostly deliver YUYV, the virtual scene renders RGB32.
+constexpr uint32_t kSourceFormats[] = {V4L2_PIX_FMT_YUYV, V4L2_PIX_FMT_RGB32};
+
+class Frames {
+public:
+    Frames(uint32_t srcFormat, int width)
+        : mSrcFormat(srcFormat), mWidth(width), mHeight(width * 9 / 16) {
+        size_t size = 0;
+        calculate_framebuffer_size(srcFormat, mWidth, mHeight, &size);
+        mSrc.resize(size);
+        for (size_t i = 0; i < size; ++i) {
+            mSrc[i] = static_cast<uint8_t>(i * 7 + i / mWidth);
+        }
+
+        const uint32_t destFormats[] = {V4L2_PIX_FMT_NV21,
+                                        V4L2_PIX_FMT_RGB32};
+        for (int i = 0; i < 2; ++i) {
+            calculate_framebuffer_size(destFormats[i], mWidth, mHeight,
+                                       &size);
+            mDest[i].resize(size);
+            mFramebuffers[i] = {};
+            mFramebuffers[i].pixel_format = destFormats[i];
+            mFramebuffers[i].framebuffer = mDest[i].data();
+            mFramebuffers[i].width = mWidth;
+            mFramebuffers[i].height = mHeight;
+        }
+
+        mFrame = {};
+        mFrame.framebuffers = mFramebuffers;
+        mFrame.framebuffers_count = 2;
+        mFrame.staging_framebuffer = &mStaging;
+        mFrame.staging_framebuffer_size = &mStagingSize;
+    }
+
+    ~Frames() { free(mStaging); }
+
+    int convert(float rScale, float gScale, float bScale, float expComp) {
+        return convert_frame(mSrc.data(), mSrcFormat, mSrc.size(), mWidth,
+                             mHeight, &mFrame, rScale, gScale, bScale,
+                             expComp);
+    }
+
+    int convertSlow(float rScale, float gScale, float bScale, float expComp) {
+        return convert_frame_slow(mSrc.data(), mSrcFormat, mSrc.size(),
+                                  mWidth, mHeight, mFramebuffers, 2, rScale,
+                                  gScale, bScale, expComp);
+    }
+
+    size_t pixels() const { return static_cast<size_t>(mWidth) * mHeight; }
+
+private:
+    uint32_t mSrcFormat;
+    int mWidth;
+    int mHeight;
+    std::vector<uint8_t> mSrc;
+    std::vector<uint8_t> mDest[2];
+    ClientFrameBuffer mFramebuffers[2];
+    ClientFrame mFrame;
+    uint8_t* mStaging = nullptr;
+    size_t mStagingSize = 0;
+};
+
+// range_x() is the source format, range_y() the frame width.
+void BM_ConvertFrame(benchmark::State& state) {
+    Frames frames(kSourceFormats[state.range_x()], state.range_y());
+    while (state.KeepRunning()) {
+        frames.convert(1.0f, 1.0f, 1.0f, 1.0f);
+    }
+    state.SetItemsProcessed(state.iterations() * frames.pixels());
+}
+
+// A white balance other than "auto", with the exposure compensation set.
+void BM_ConvertFrame_WhiteBalance(benchmark::State& state) {
+    Frames frames(kSourceFormats[state.range_x()], state.range_y());
+    while (state.KeepRunning()) {
+        frames.convert(1.0f, 1.2f, 1.5f, 1.3f);
+    }
+    state.SetItemsProcessed(state.iterations() * frames.pixels());
+}
+
+// The generic per pixel converters, for comparison.
+void BM_ConvertFrame_Slow(benchmark::State& state) {
+    Frames frames(kSourceFormats[state.range_x()], state.range_y());
+    while (state.KeepRunning()) {
+        frames.convertSlow(1.0f, 1.2f, 1.5f, 1.3f);
+    }
+    state.SetItemsProcessed(state.iterations() * frames.pixels());
+}
+
+}  // namespace
+
+BENCHMARK(BM_ConvertFrame)->ArgPair(0, 640)->ArgPair(0, 1280)
+        ->ArgPair(0, 1920)->ArgPair(1, 1280);
+BENCHMARK(BM_ConvertFrame_WhiteBalance)->ArgPair(0, 640)->ArgPair(0, 1280)
+        ->ArgPair(0, 1920)->ArgPair(1, 1280);
+BENCHMARK(BM_ConvertFrame_Slow)->ArgPair(0, 1280)->ArgPair(1, 1280);
+
+BENCHMARK_MAIN()
@@ -493,3 +493,93 @@ TEST_P(FrameModifiers, ExpComp) {
 INSTANTIATE_TEST_CASE_P(CameraFormatConverters,
                         FrameModifiers,
                         testing::Values(1.0f, 0.0f, 0.5f, -1.0f, 2.0f));
+
+struct WhiteBalanceParam {
+    float r_scale;
+    float g_scale;
+    float b_scale;
+};
+
+static void PrintTo(const WhiteBalanceParam& param, std::ostream* os) {
+    *os << "WhiteBalanceParam(" << param.r_scale << ", " << param.g_scale
+        << ", " << param.b_scale << ")";
+}
+
+class FrameWhiteBalance : public testing::TestWithParam<WhiteBalanceParam> {};
+
+// The fast path applies the white balance with lookup tables, check that it
+// matches the slow path.  The larger size is split in bands that are
+// converted in parallel.
+TEST_P(FrameWhiteBalance, MatchesSlowPath) {
+    const WhiteBalanceParam param = GetParam();
+
+    uint8_t* stagingFramebuffer = nullptr;
+    size_t stagingFramebufferSize = 0;
+
+    for (const FramebufferSizeParam& size :
+         {FramebufferSizeParam(16, 16), FramebufferSizeParam(1280, 720)}) {
+        for (uint32_t src_format : kSupportedSourceFormats) {
+            std::vector<uint8_t> src =
+                    generateFramebuffer(src_format, size.width, size.height,
+                                        kAlpha, kRed, kGreen, kBlue);
+
+            for (uint32_t dest_format : kSupportedDestinationFormats) {
+                SCOPED_TRACE(testing::Message()
+                             << size.width << "x" << size.height
+                             << " source=" << fourccToString(src_format)
+                             << " dest=" << fourccToString(dest_format));
+
+                const size_t destSize =
+                        bufferSize(dest_format, size.width, size.height);
+                std::vector<uint8_t> dest(destSize);
+
+                ClientFrameBuffer framebuffer = {};
+                framebuffer.pixel_format = dest_format;
+                framebuffer.framebuffer = dest.data();
+                framebuffer.width = size.width;
+                framebuffer.height = size.height;
+
+                ClientFrame resultFrame = {};
+                resultFrame.framebuffers = &framebuffer;
+                resultFrame.framebuffers_count = 1;
+                resultFrame.staging_framebuffer = &stagingFramebuffer;
+                resultFrame.staging_framebuffer_size = &stagingFramebufferSize;
+
+                EXPECT_EQ(0, convert_frame(src.data(), src_format, src.size(),
+                                           size.width, size.height,
+                                           &resultFrame, param.r_scale,
+                                           param.g_scale, param.b_scale,
+                                           kDefaultExpComp));
+
+                std::vector<uint8_t> destBaseline(destSize);
+                ClientFrameBuffer baselineFramebuffer = {};
+                baselineFramebuffer.pixel_format = dest_format;
+                baselineFramebuffer.framebuffer = destBaseline.data();
+
+                EXPECT_EQ(0, convert_frame_slow(
+                                     src.data(), src_format, src.size(),
+                                     size.width, size.height,
+                                     &baselineFramebuffer, 1, param.r_scale,
+                                     param.g_scale, param.b_scale,
+                                     kDefaultExpComp));
+
+                compareSumOfSquaredDifferences(destBaseline, dest,
+                                               kLenientDifferenceSq);
+
+                if (HasFatalFailure()) {
+                    return;
+                }
+            }
+        }
+    }
+
+    free(stagingFramebuffer);
+}
+
+// The slow path doesn't clamp colors that overflow, so only test scales that
+// darken the colors.
+INSTANTIATE_TEST_CASE_P(CameraFormatConverters,
+                        FrameWhiteBalance,
+                        testing::Values(WhiteBalanceParam{1.0f, 1.25f, 1.0f},
+                                        WhiteBalanceParam{1.5f, 1.0f, 2.0f},
+                                        WhiteBalanceParam{1.0f, 2.0f, 1.25f}));
@@ -15,6 +15,7 @@
  */
 
 #include "android/camera/camera-format-converters.h"
+#include "android/camera/camera-parallel.h"
 #include "android/utils/misc.h"
 
 #ifdef __linux__
@@ -1200,10 +1201,13 @@ YUVToYUV(const YUVDesc* src_fmt,
                                        pYdst += Y_next_pair_dst,
                                        pUdst += UV_inc_dst,
                                        pVdst += UV_inc_dst) {
+            /* The second pixel of the pair shares the chroma of the first. */
+            uint8_t Y2 = pYsrc[Y_Inc_src], U2 = *pUsrc, V2 = *pVsrc;
             *pYdst = *pYsrc; *pUdst = *pUsrc; *pVdst = *pVsrc;
             _change_white_balance_YUV(pYdst, pUdst, pVdst, r_scale, g_scale, b_scale);
             *pYdst = _change_exposure(*pYdst, exp_comp);
-            pYdst[Y_Inc_dst] = _change_exposure(pYsrc[Y_Inc_src], exp_comp);
+            _change_white_balance_YUV(&Y2, &U2, &V2, r_scale, g_scale, b_scale);
+            pYdst[Y_Inc_dst] = _change_exposure(Y2, exp_comp);
         }
     }
 }
@@ -1994,14 +1998,200 @@ int convert_to_i420(const void* src_frame,
     return 0;
 }
 
-int convert_frame_fast(const void* src_frame,
-                       uint32_t pixel_format,
-                       size_t framebuffer_size,
-                       int src_width,
-                       int src_height,
-                       ClientFrame* result_frame,
-                       float exp_comp) {
+/* Lookup tables that apply the white balance and the exposure compensation to
+ * a frame in the fast path, so that no pixel goes through floating point.
+ */
+typedef struct ColorAdjust {
+    /* Whether the white balance scales are not all 1. */
+    bool white_balance;
+    /* Whether the exposure compensation is not 1. */
+    bool exposure;
+    /* White balance for libyuv's ARGBColorTable, which is indexed by the
+     * bytes of an ARGB pixel in memory order: blue, green, red and alpha. */
+    uint8_t argb_table[256 * 4];
+    /* Exposure compensation, indexed by luminance. */
+    uint8_t y_table[256];
+} ColorAdjust;
+
+static void init_color_adjust(ColorAdjust* adjust,
+                              float r_scale,
+                              float g_scale,
+                              float b_scale,
+                              float exp_comp) {
+    int i;
+
+    adjust->white_balance =
+            r_scale != 1.0f || g_scale != 1.0f || b_scale != 1.0f;
+    adjust->exposure = exp_comp != 1.0f;
+    for (i = 0; i < 256; i++) {
+        /* Unlike _change_white_balance_RGB_b, clamp colors that overflow
+         * when a scale is below 1. */
+        adjust->argb_table[i * 4] = clamp((float)i / b_scale);
+        adjust->argb_table[i * 4 + 1] = clamp((float)i / g_scale);
+        adjust->argb_table[i * 4 + 2] = clamp((float)i / r_scale);
+        adjust->argb_table[i * 4 + 3] = i;
+        adjust->y_table[i] = _change_exposure(i, exp_comp);
+    }
+}
+
+/* An I420 frame that gets its colors adjusted. */
+typedef struct I420Adjust {
+    const ColorAdjust* adjust;
+    uint8_t* y;
+    uint8_t* u;
+    uint8_t* v;
+    YUVInfo info;
+    int width;
+} I420Adjust;
+
+/* Applies the white balance, then the exposure compensation, to a band of
+ * rows of an I420 frame, as the slow path does.  The band must start on an
+ * even row.
+ */
+static void adjust_i420_rows(void* opaque, int first_row, int rows) {
+    const I420Adjust* frame = (const I420Adjust*)opaque;
+    const YUVInfo* info = &frame->info;
+    const int width = frame->width;
+    const int end_row = first_row + rows;
+    int row, x;
+
+    if (frame->adjust->white_balance) {
+        /* libyuv has SIMD kernels for each step.  Going through the band two
+         * rows at a time keeps the ARGB pixels in the cache. */
+        const int argb_stride = width * 4;
+        uint8_t* argb = (uint8_t*)malloc(argb_stride * 2);
+        if (argb == NULL) {
+            W("%s: Failed to allocate the white balance buffer",
+              __FUNCTION__);
+            return;
+        }
+        for (row = first_row; row < end_row; row += 2) {
+            const int n = end_row - row < 2 ? 1 : 2;
+            uint8_t* y = frame->y + row * info->y_stride;
+            uint8_t* u = frame->u + (row / 2) * info->u_or_v_stride;
+            uint8_t* v = frame->v + (row / 2) * info->u_or_v_stride;
+
+            I420ToARGB(y, info->y_stride, u, info->u_or_v_stride, v,
+                       info->u_or_v_stride, argb, argb_stride, width, n);
+            ARGBColorTable(argb, argb_stride, frame->adjust->argb_table, 0, 0,
+                           width, n);
+            ARGBToI420(argb, argb_stride, y, info->y_stride, u,
+                       info->u_or_v_stride, v, info->u_or_v_stride, width, n);
+        }
+        free(argb);
+    }
+
+    if (frame->adjust->exposure) {
+        const uint8_t* y_table = frame->adjust->y_table;
+        for (row = first_row; row < end_row; ++row) {
+            uint8_t* y_row = frame->y + row * info->y_stride;
+            for (x = 0; x < width; ++x) {
+                y_row[x] = y_table[y_row[x]];
+            }
+        }
+    }
+}
+
+/* Returns the size of a pixel of the packed libyuv |format|, if the rows of
+ * an I420 frame can be converted to it independently, or 0.
+ */
+static int i420_packed_bytes_per_pixel(uint32_t format) {
+    switch (format) {
+        case FOURCC_ARGB:
+        case FOURCC_BGRA:
+        case FOURCC_ABGR:
+            return 4;
+        case FOURCC_RGBP:
+        case V4L2_PIX_FMT_YUYV:
+            return 2;
+    }
+    return 0;
+}
+
+/* An I420 frame that gets converted to YVU420, or to a packed format. */
+typedef struct I420Output {
+    const uint8_t* y;
+    const uint8_t* u;
+    const uint8_t* v;
+    YUVInfo info;
+    int width;
+    uint32_t format;
+    uint8_t* dest;
+    int dest_stride;
+} I420Output;
+
+/* Converts a band of rows of an I420 frame, as ConvertFromI420 would.  The
+ * band must start on an even row.
+ */
+static void convert_i420_rows(void* opaque, int first_row, int rows) {
+    const I420Output* frame = (const I420Output*)opaque;
+    const YUVInfo* info = &frame->info;
+    const int y_offset = first_row * info->y_stride;
+    const int uv_offset = (first_row / 2) * info->u_or_v_stride;
+    const uint8_t* y = frame->y + y_offset;
+    const uint8_t* u = frame->u + uv_offset;
+    const uint8_t* v = frame->v + uv_offset;
+
+    if (frame->format == V4L2_PIX_FMT_YVU420) {
+        uint8_t* dest_y = frame->dest;
+        uint8_t* dest_v = dest_y + info->y_size;
+        uint8_t* dest_u = dest_v + info->u_or_v_size;
+
+        I420Copy(y, info->y_stride, u, info->u_or_v_stride, v,
+                 info->u_or_v_stride, dest_y + y_offset, info->y_stride,
+                 dest_u + uv_offset, info->u_or_v_stride, dest_v + uv_offset,
+                 info->u_or_v_stride, frame->width, rows);
+        return;
+    }
+
+    uint8_t* dest = frame->dest + first_row * frame->dest_stride;
+    switch (frame->format) {
+        case FOURCC_ARGB:
+            I420ToARGB(y, info->y_stride, u, info->u_or_v_stride, v,
+                       info->u_or_v_stride, dest, frame->dest_stride,
+                       frame->width, rows);
+            break;
+        case FOURCC_BGRA:
+            I420ToBGRA(y, info->y_stride, u, info->u_or_v_stride, v,
+                       info->u_or_v_stride, dest, frame->dest_stride,
+                       frame->width, rows);
+            break;
+        case FOURCC_ABGR:
+            I420ToABGR(y, info->y_stride, u, info->u_or_v_stride, v,
+                       info->u_or_v_stride, dest, frame->dest_stride,
+                       frame->width, rows);
+            break;
+        case FOURCC_RGBP:
+            I420ToRGB565(y, info->y_stride, u, info->u_or_v_stride, v,
+                         info->u_or_v_stride, dest, frame->dest_stride,
+                         frame->width, rows);
+            break;
+        case V4L2_PIX_FMT_YUYV:
+            I420ToYUY2(y, info->y_stride, u, info->u_or_v_stride, v,
+                       info->u_or_v_stride, dest, frame->dest_stride,
+                       frame->width, rows);
+            break;
+    }
+}
+
+/* Converts a frame with libyuv, going through I420 where the colors are
+ * adjusted.  This is the fast path behind convert_frame_fast and
+ * convert_frame.
+ */
+static int convert_frame_libyuv(const void* src_frame,
+                                uint32_t pixel_format,
+                                size_t framebuffer_size,
+                                int src_width,
+                                int src_height,
+                                ClientFrame* result_frame,
+                                float r_scale,
+                                float g_scale,
+                                float b_scale,
+                                float exp_comp) {
+    ColorAdjust adjust;
     int n;
+
+    init_color_adjust(&adjust, r_scale, g_scale, b_scale, exp_comp);
     for (n = 0; n < result_frame->framebuffers_count; ++n) {
         int result_width = result_frame->framebuffers[n].width;
         int result_height = result_frame->framebuffers[n].height;
@@ -2068,16 +2258,12 @@ int convert_frame_fast(const void* src_frame,
             src_size = result_size;
         }
 
-        // Apply exposure compensation.
-        if (exp_comp != 1.0f) {
-            int row;
-            int x;
-            for (row = 0; row < result_height; ++row) {
-                uint8_t* y_row = src_y + row * src_info.y_stride;
-                for (x = 0; x < result_width; ++x) {
-                    y_row[x] = _change_exposure(y_row[x], exp_comp);
-                }
-            }
+        // Apply white balance and exposure compensation.
+        if (adjust.white_balance || adjust.exposure) {
+            I420Adjust frame = {&adjust, src_y,    src_u,
+                                src_v,   src_info, result_width};
+            camera_parallel_rows(result_width, result_height, 2,
+                                 adjust_i420_rows, &frame);
         }
 
         // Convert to the target framebuffer formats.
@@ -2087,28 +2273,21 @@ int convert_frame_fast(const void* src_frame,
 
         if (dest_format == V4L2_PIX_FMT_YUV420) {
             memcpy(dest, src_y, src_size);
-        } else if (dest_format == V4L2_PIX_FMT_YVU420) {
+        } else if (dest_format == V4L2_PIX_FMT_YVU420 ||
+                   i420_packed_bytes_per_pixel(dest_format) > 0) {
             // YVU420 is 16-byte aligned, but there is no way to specify u and v
             // with ConvertFromI420; manually convert it to YUV420 (swapping U
-            // and V) with libyuv's I420Copy.
-            uint8_t* dest_y = dest;
-            uint8_t* dest_v = dest_y + src_info.y_size;
-            uint8_t* dest_u = dest_v + src_info.u_or_v_size;
-
-            result = I420Copy(src_y,                   // src_y
-                              src_info.y_stride,       // src_stride_y
-                              src_u,                   // src_u
-                              src_info.u_or_v_stride,  // src_stride_u
-                              src_v,                   // src_v
-                              src_info.u_or_v_stride,  // src_stride_v
-                              dest_y,                  // dst_y
-                              src_info.y_stride,       // dst_stride_y
-                              dest_u,                  // dst_u
-                              src_info.u_or_v_stride,  // dst_stride_u
-                              dest_v,                  // dst_v
-                              src_info.u_or_v_stride,  // dst_stride_v
-                              result_width,            // width
-                              result_height);          // height
+            // and V) with libyuv's I420Copy.  The packed formats are
+            // converted with the routines ConvertFromI420 would pick.  Either
+            // way the rows convert independently, in bands, and can't fail
+            // with the buffers set up above.
+            const int dest_stride =
+                    result_width * i420_packed_bytes_per_pixel(dest_format);
+            I420Output frame = {src_y,    src_u,        src_v,
+                                src_info, result_width, dest_format,
+                                dest,     dest_stride};
+            camera_parallel_rows(result_width, result_height, 2,
+                                 convert_i420_rows, &frame);
         } else {
             result = ConvertFromI420(src_y,                   // y
                                      src_info.y_stride,       // y_stride
@@ -2135,6 +2314,18 @@ int convert_frame_fast(const void* src_frame,
     return 0;
 }
 
+int convert_frame_fast(const void* src_frame,
+                       uint32_t pixel_format,
+                       size_t framebuffer_size,
+                       int src_width,
+                       int src_height,
+                       ClientFrame* result_frame,
+                       float exp_comp) {
+    return convert_frame_libyuv(src_frame, pixel_format, framebuffer_size,
+                                src_width, src_height, result_frame, 1.0f,
+                                1.0f, 1.0f, exp_comp);
+}
+
 int convert_frame(const void* src_frame,
                   uint32_t pixel_format,
                   size_t framebuffer_size,
@@ -2152,11 +2343,11 @@ int convert_frame(const void* src_frame,
         return -1;
     }
 
-    // Enable a fast-path with libyuv if the white-balance no-ops.
-    if (r_scale == 1.0f && g_scale == 1.0f && b_scale == 1.0f &&
-        libyuv_supported(src_desc, result_frame)) {
-        if (convert_frame_fast(src_frame, pixel_format, framebuffer_size, width,
-                               height, result_frame, exp_comp) == 0) {
+    // Enable a fast-path with libyuv if all the formats are supported.
+    if (libyuv_supported(src_desc, result_frame)) {
+        if (convert_frame_libyuv(src_frame, pixel_format, framebuffer_size,
+                                 width, height, result_frame, r_scale, g_scale,
+                                 b_scale, exp_comp) == 0) {
             // Successful conversion!
             return 0;
         }
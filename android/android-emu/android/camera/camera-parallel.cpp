@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "android/camera/camera-parallel.h"
+
+#include "android/base/memory/LazyInstance.h"
+#include "android/base/system/System.h"
+#include "android/base/threads/ParallelFor.h"
+
+#include <algorithm>
+
+using android::base::LazyInstance;
+using android::base::ParallelFor;
+using android::base::System;
+
+namespace {
+
+// Handing a band over to a worker costs a few microseconds, which is about
+// what converting this many pixels takes.
+constexpr int kMinPixelsPerBand = 256 * 1024;
+
+// Frames are converted one at a time, and memory bandwidth runs out well
+// before the cores do.
+constexpr int kMaxThreads = 8;
+
+struct Workers {
+    Workers()
+        : parallel(std::min(System::get()->getCpuCoreCount(), kMaxThreads)) {}
+
+    ParallelFor parallel;
+};
+
+LazyInstance<Workers> sWorkers = LAZY_INSTANCE_INIT;
+
+}  // namespace
+
+void camera_parallel_rows(int width,
+                          int height,
+                          int row_align,
+                          camera_rows_func func,
+                          void* opaque) {
+    const int minRowsPerBand =
+            std::max(1, kMinPixelsPerBand / std::max(1, width));
+    sWorkers->parallel.forRows(height, row_align, minRowsPerBand,
+                               [func, opaque](int firstRow, int rows) {
+                                   func(opaque, firstRow, rows);
+                               });
+}
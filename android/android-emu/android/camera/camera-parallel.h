@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+/*
+ * Splits the processing of a camera frame into bands of rows that are run on
+ * a shared pool of worker threads.
+ */
+
+#include "android/utils/compiler.h"
+
+ANDROID_BEGIN_HEADER
+
+/* Processes |rows| rows of a frame, starting at |first_row|. */
+typedef void (*camera_rows_func)(void* opaque, int first_row, int rows);
+
+/* Runs |func| over all the rows of a |width| x |height| frame, and returns
+ * once it is done.  Large frames are split into bands that are processed in
+ * parallel, small ones are processed by the calling thread in one go.
+ * Param:
+ *  |width|, |height| - Frame dimensions, in pixels.
+ *  |row_align| - Every band but the last starts and ends at a multiple of
+ *                this many rows, e.g. 2 so that bands of a YUV 4:2:0 frame
+ *                don't share chroma rows.
+ *  |func|, |opaque| - Routine that processes a band, and its first parameter.
+ */
+extern void camera_parallel_rows(int width,
+                                 int height,
+                                 int row_align,
+                                 camera_rows_func func,
+                                 void* opaque);
+
+ANDROID_END_HEADER
@@ -34,6 +34,11 @@ using ::android::base::Looper;
 using ::android::base::ThreadLooper;
 using videoinjection::VideoInjectionController;
 
+// Frames are shown from the looper thread, which also serves the guest, so a
+// late refresh or a slow keyframe shouldn't leave the camera repeating frames:
+// about 100ms of 60 fps video.
+static constexpr int kCameraDecodeAheadFrames = 6;
+
 class VideoplaybackNotifier : public android::videoplayer::VideoPlayerNotifier {
 public:
     VideoplaybackNotifier();
@@ -187,7 +192,8 @@ int64_t RenderMultiplexer::render() {
 
                 videoplayer::PlayConfig playConfig(
                     maybe_next_request->play().offset_in_seconds(),
-                    maybe_next_request->play().looping());
+                    maybe_next_request->play().looping(),
+                    kCameraDecodeAheadFrames);
                 mPlayer->start(playConfig);
                 // Successfully started playing the video.
                 videoinjection::VideoInjectionController::trySendAsyncResponse(
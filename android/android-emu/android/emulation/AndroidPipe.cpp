@@ -25,9 +25,11 @@
 #include "android/emulation/android_pipe_device.h"
 #include "android/emulation/android_pipe_host.h"
 #include "android/emulation/DeviceContextRunner.h"
+#include "android/emulation/PipeWakeQueue.h"
 #include "android/emulation/VmLock.h"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -330,45 +332,66 @@ public:
 // A helper class used to send signalWake() and closeFromHost() commands to
 // the device thread, depending on the threading mode setup by the emulation
 // engine.
-struct PipeWakeCommand {
-    void* hwPipe;
-    int wakeFlags;
-};
-
-class PipeWaker final : public DeviceContextRunner<PipeWakeCommand> {
+//
+// This works like a DeviceContextRunner, except that host threads queue the
+// commands without taking a lock, and that the commands queued for a pipe
+// are merged into one: the device thread only needs to know which events
+// happened since it last looked at the pipe.
+class PipeWaker final {
 public:
+    void init(VmLock* vmLock) { init(vmLock, ThreadLooper::get()); }
+
+    // Looper parameter is for unit testing purposes.
+    void init(VmLock* vmLock, Looper* looper) {
+        mVmLock = vmLock;
+        // See DeviceContextRunner::init() about why this is thread-safe.
+        mTimer.reset(looper->createTimer(
+                [](void* that, Looper::Timer*) {
+                    static_cast<PipeWaker*>(that)->onTimerEvent();
+                },
+                this));
+        if (!mTimer.get()) {
+            LOG(FATAL) << "Failed to create a loop timer in PipeWaker";
+        }
+    }
+
+    void setContextRunMode(ContextRunMode mode) {
+        mContextRunMode.store(mode, std::memory_order_relaxed);
+    }
+
     void signalWake(void* hwPipe, int wakeFlags) {
-        queueDeviceOperation({ hwPipe, wakeFlags });
+        if (mContextRunMode.load(std::memory_order_relaxed) ==
+                    ContextRunMode::DeferIfNotLocked &&
+            mVmLock->isLockedBySelf()) {
+            mImmediate.fetch_add(1, std::memory_order_relaxed);
+            deliver(hwPipe, wakeFlags);
+        } else if (mQueue.push(hwPipe, wakeFlags)) {
+            // Already armed if this isn't the first request since the
+            // last drain.
+            mTimer->startAbsolute(0);
+        }
     }
     void closeFromHost(void* hwPipe) {
         signalWake(hwPipe, PIPE_WAKE_CLOSED);
     }
-    void abortPending(void* hwPipe) {
-        removeAllPendingOperations([hwPipe](const PipeWakeCommand& cmd) {
-            return cmd.hwPipe == hwPipe;
-        });
-    }
-    void abortAllPending() {
-        removeAllPendingOperations([](const PipeWakeCommand& cmd) {
-            return true;
-        });
-    }
+    void abortPending(void* hwPipe) { mQueue.abort(hwPipe); }
+    void abortAllPending() { mQueue.abortAll(); }
 
-    int getPendingFlags(void* hwPipe) const {
-        int flags = 0;
-        forEachPendingOperation([hwPipe, &flags](const PipeWakeCommand& cmd) {
-            if (cmd.hwPipe == hwPipe) {
-                flags |= cmd.wakeFlags;
-            }
-        });
-        return flags;
+    int getPendingFlags(void* hwPipe) { return mQueue.pendingFlags(hwPipe); }
+
+    AndroidPipe::WakeStats stats() const {
+        const PipeWakeQueue::Stats queued = mQueue.stats();
+        AndroidPipe::WakeStats stats;
+        stats.immediate = mImmediate.load(std::memory_order_relaxed);
+        stats.queued = queued.requests;
+        stats.delivered = queued.delivered;
+        stats.drains = queued.drains;
+        stats.aborted = queued.aborted;
+        return stats;
     }
 
 private:
-    virtual void performDeviceOperation(const PipeWakeCommand& wake_cmd) {
-        void* hwPipe = wake_cmd.hwPipe;
-        int flags = wake_cmd.wakeFlags;
-
+    static void deliver(void* hwPipe, int flags) {
         // Not used when in virtio mode.
         if (flags & PIPE_WAKE_CLOSED) {
             getPipeHwFuncs(hwPipe)->closeFromHost(hwPipe);
@@ -376,6 +399,15 @@ private:
             getPipeHwFuncs(hwPipe)->signalWake(hwPipe, flags);
         }
     }
+
+    void onTimerEvent() { mQueue.drain(&PipeWaker::deliver); }
+
+    VmLock* mVmLock = nullptr;
+    std::atomic<ContextRunMode> mContextRunMode{
+            ContextRunMode::DeferIfNotLocked};
+    PipeWakeQueue mQueue;
+    std::atomic<uint64_t> mImmediate{0};
+    std::unique_ptr<Looper::Timer> mTimer;
 };
 
 struct Globals {
@@ -476,6 +508,11 @@ void AndroidPipe::initThreadingForTest(VmLock* vmLock, base::Looper* looper) {
     sGlobals->pipeWaker.init(vmLock, looper);
 }
 
+// static
+AndroidPipe::WakeStats AndroidPipe::wakeStats() {
+    return sGlobals->pipeWaker.stats();
+}
+
 AndroidPipe::~AndroidPipe() {
     DD("%s: for hwpipe=%p (host %p '%s')", __FUNCTION__, mHwPipe, this,
        mService->name().c_str());
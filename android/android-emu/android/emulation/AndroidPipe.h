@@ -76,6 +76,22 @@ public:
 
     static void initThreadingForTest(VmLock* lock, base::Looper* looper);
 
+    // Counters for the signalWake() / closeFromHost() requests of all pipes.
+    struct WakeStats {
+        // Requests delivered right away because the current thread held the
+        // VM lock, and requests queued for the device thread.
+        uint64_t immediate = 0;
+        uint64_t queued = 0;
+        // Wakes the queued requests were merged into, and how many times the
+        // device thread delivered some.
+        uint64_t delivered = 0;
+        uint64_t drains = 0;
+        // Merged wakes dropped by abortPendingOperation() or a snapshot load.
+        uint64_t aborted = 0;
+    };
+
+    static WakeStats wakeStats();
+
     // A base class for all AndroidPipe services, which is in charge
     // of creating new instances when a guest client connects to the
     // service.
@@ -0,0 +1,337 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "android/emulation/FilePushPipe.h"
+
+#include <fcntl.h>    // for open, posix_fadvise, O_RDONLY
+#include <string.h>   // for memcpy, memset
+#include <algorithm>  // for min
+#include <utility>    // for move
+
+#include "android/base/EintrWrapper.h"         // for HANDLE_EINTR
+#include "android/base/memory/LazyInstance.h"  // for LazyInstance
+#include "android/base/system/System.h"        // for System
+#include "android/filepush-pipe.h"             // for android_init_filepus...
+#include "android/utils/fd.h"                  // for O_CLOEXEC
+#include "android/utils/file_io.h"             // for android_open
+#include "android/utils/path.h"                // for O_BINARY
+
+namespace android {
+namespace emulation {
+
+using android::base::AutoLock;
+using android::base::System;
+using android::base::WorkerProcessingResult;
+
+namespace {
+
+// The currently connected guest daemon, if any.
+struct FilePushPipeInstance {
+    android::base::Lock lock;
+    FilePushPipe* pipe = nullptr;
+};
+
+// The reader thread reads this much at a time, and stops once a transfer
+// has kMaxBuffered bytes that the guest did not take yet. It starts again
+// when the guest took half of them.
+constexpr size_t kChunkSize = 1024 * 1024;
+constexpr uint64_t kMaxBuffered = 4 * kChunkSize;
+
+}  // namespace
+
+static android::base::LazyInstance<FilePushPipeInstance> sInstance = {};
+
+size_t FilePushPipe::Transfer::copyTo(uint8_t* data, size_t size) {
+    if (headerSent < header.size()) {
+        size_t toCopy = std::min(size, header.size() - headerSent);
+        memcpy(data, header.data() + headerSent, toCopy);
+        headerSent += toCopy;
+        return toCopy;
+    }
+    if (!chunks.empty()) {
+        const auto& chunk = chunks.front();
+        size_t toCopy = std::min(size, chunk.size() - chunkOffset);
+        memcpy(data, chunk.data() + chunkOffset, toCopy);
+        chunkOffset += toCopy;
+        if (chunkOffset == chunk.size()) {
+            chunks.pop_front();
+            chunkOffset = 0;
+        }
+        buffered -= toCopy;
+        sent += toCopy;
+        return toCopy;
+    }
+    if (failed) {
+        // The file got truncated, or we cannot read it. The guest is still
+        // expecting |size| bytes, so we send zeros and report the failure
+        // regardless of what the guest tells us.
+        size_t toCopy = std::min<uint64_t>(size, this->size - sent);
+        memset(data, 0, toCopy);
+        sent += toCopy;
+        return toCopy;
+    }
+    return 0;
+}
+
+FilePushPipe::FilePushPipe(void* hwPipe, Service* svc)
+    : AndroidPipe(hwPipe, svc), mReader([this](Transfer*&& transfer) {
+          if (!transfer) {
+              return WorkerProcessingResult::Stop;
+          }
+          readFile(transfer);
+          return WorkerProcessingResult::Continue;
+      }) {
+    mReader.start();
+}
+
+void FilePushPipe::onGuestClose(PipeCloseReason reason) {
+    {
+        AutoLock lock(sInstance->lock);
+        if (sInstance->pipe == this) {
+            sInstance->pipe = nullptr;
+        }
+    }
+
+    // Let the reader thread finish what it is reading, so that nothing
+    // touches the transfers after this.
+    {
+        AutoLock lock(mLock);
+        mClosing = true;
+    }
+    mReader.enqueue(nullptr);
+    mReader.join();
+
+    // Nobody is going to store these files anymore.
+    std::deque<std::unique_ptr<Transfer>> pending;
+    {
+        AutoLock lock(mLock);
+        pending.swap(mAwaitingStatus);
+        for (auto& transfer : mQueue) {
+            pending.push_back(std::move(transfer));
+        }
+        mQueue.clear();
+    }
+    for (const auto& transfer : pending) {
+        if (transfer->callback) {
+            transfer->callback(false);
+        }
+    }
+    delete this;
+}
+
+unsigned FilePushPipe::onGuestPoll() const {
+    AutoLock lock(mLock);
+    unsigned result = PIPE_POLL_OUT;
+    if (readableLocked()) {
+        result |= PIPE_POLL_IN;
+    }
+    return result;
+}
+
+int FilePushPipe::onGuestRecv(AndroidPipeBuffer* buffers, int numBuffers) {
+    AutoLock lock(mLock);
+    if (!readableLocked()) {
+        return PIPE_ERROR_AGAIN;
+    }
+
+    Transfer* transfer = mQueue.front().get();
+    size_t total = 0;
+    for (int i = 0; i < numBuffers; i++) {
+        size_t copied = 0;
+        while (copied < buffers[i].size) {
+            size_t size = transfer->copyTo(buffers[i].data + copied,
+                                           buffers[i].size - copied);
+            if (!size) {
+                break;
+            }
+            copied += size;
+        }
+        total += copied;
+        if (copied < buffers[i].size) {
+            break;
+        }
+    }
+
+    if (transfer->headerSent == transfer->header.size() &&
+        transfer->sent == transfer->size) {
+        // The reader thread is done with it, as it read everything or
+        // failed.
+        transfer->fd.close();
+        mAwaitingStatus.push_back(std::move(mQueue.front()));
+        mQueue.pop_front();
+        if (!mQueue.empty()) {
+            readAheadLocked(mQueue.front().get());
+        }
+    } else if (transfer->buffered <= kMaxBuffered / 2) {
+        readAheadLocked(transfer);
+    }
+    return total;
+}
+
+int FilePushPipe::onGuestSend(const AndroidPipeBuffer* buffers,
+                              int numBuffers,
+                              void** newPipePtr) {
+    std::vector<std::unique_ptr<Transfer>> done;
+    int total = 0;
+    {
+        AutoLock lock(mLock);
+        for (int i = 0; i < numBuffers; i++) {
+            for (size_t j = 0; j < buffers[i].size; j++) {
+                reinterpret_cast<uint8_t*>(&mStatus)[mStatusReceived++] =
+                        buffers[i].data[j];
+                if (mStatusReceived < sizeof(mStatus)) {
+                    continue;
+                }
+                mStatusReceived = 0;
+                if (!mAwaitingStatus.empty()) {
+                    auto transfer = std::move(mAwaitingStatus.front());
+                    mAwaitingStatus.pop_front();
+                    transfer->failed |= mStatus != 0;
+                    done.push_back(std::move(transfer));
+                }
+            }
+            total += buffers[i].size;
+        }
+    }
+
+    for (const auto& transfer : done) {
+        if (transfer->callback) {
+            transfer->callback(!transfer->failed);
+        }
+    }
+    return total;
+}
+
+void FilePushPipe::onGuestWantWakeOn(int flags) {
+    AutoLock lock(mLock);
+    mWakeOnRead = (flags & PIPE_WAKE_READ) != 0;
+    wakeGuestIfNeededLocked();
+}
+
+bool FilePushPipe::readableLocked() const {
+    if (mQueue.empty()) {
+        return false;
+    }
+    const Transfer* transfer = mQueue.front().get();
+    return transfer->headerSent < transfer->header.size() ||
+           !transfer->chunks.empty() || transfer->failed;
+}
+
+void FilePushPipe::readAheadLocked(Transfer* transfer) {
+    if (transfer->reading || transfer->failed || mClosing ||
+        transfer->readOffset == transfer->size) {
+        return;
+    }
+    transfer->reading = true;
+    mReader.enqueue(std::move(transfer));
+}
+
+void FilePushPipe::readFile(Transfer* transfer) {
+    AutoLock lock(mLock);
+    // Whoever takes the last bytes can free the transfer, so the check that
+    // we are done happens under the same lock as handing them over.
+    while (!mClosing && !transfer->failed &&
+           transfer->readOffset < transfer->size &&
+           transfer->buffered < kMaxBuffered) {
+        std::vector<uint8_t> chunk(std::min<uint64_t>(
+                kChunkSize, transfer->size - transfer->readOffset));
+        lock.unlock();
+        auto read = HANDLE_EINTR(
+                ::read(transfer->fd.get(), chunk.data(), chunk.size()));
+        lock.lock();
+        if (read <= 0) {
+            transfer->failed = true;
+        } else {
+            chunk.resize(read);
+            transfer->readOffset += read;
+            transfer->buffered += read;
+            transfer->chunks.push_back(std::move(chunk));
+        }
+        wakeGuestIfNeededLocked();
+    }
+    transfer->reading = false;
+}
+
+void FilePushPipe::wakeGuestIfNeededLocked() {
+    if (mWakeOnRead && readableLocked()) {
+        signalWake(PIPE_WAKE_READ);
+        mWakeOnRead = false;
+    }
+}
+
+void FilePushPipe::enqueue(std::unique_ptr<Transfer> transfer) {
+    AutoLock lock(mLock);
+    mQueue.push_back(std::move(transfer));
+    readAheadLocked(mQueue.front().get());
+    wakeGuestIfNeededLocked();
+}
+
+bool FilePushPipe::isConnected() {
+    AutoLock lock(sInstance->lock);
+    return sInstance->pipe != nullptr;
+}
+
+bool FilePushPipe::pushFile(const std::string& hostPath,
+                            const std::string& guestPath,
+                            ResultCallback callback) {
+    auto transfer = std::make_unique<Transfer>();
+    transfer->fd = base::ScopedFd(
+            android_open(hostPath.c_str(), O_RDONLY | O_BINARY | O_CLOEXEC));
+    System::FileSize size;
+    if (!transfer->fd.valid() ||
+        !System::get()->fileSize(transfer->fd.get(), &size)) {
+        return false;
+    }
+#ifdef __linux__
+    // We read the file exactly once, front to back.
+    posix_fadvise(transfer->fd.get(), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    Header header{kMagic, static_cast<uint32_t>(guestPath.size()), size};
+    transfer->header.assign(reinterpret_cast<const char*>(&header),
+                            sizeof(header));
+    transfer->header.append(guestPath);
+    transfer->size = size;
+    transfer->callback = std::move(callback);
+
+    AutoLock lock(sInstance->lock);
+    if (!sInstance->pipe) {
+        return false;
+    }
+    sInstance->pipe->enqueue(std::move(transfer));
+    return true;
+}
+
+void registerFilePushPipeService() {
+    android::AndroidPipe::Service::add(
+            std::make_unique<FilePushPipe::Service>());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FilePushPipe::Service::Service() : AndroidPipe::Service("filepush") {}
+
+AndroidPipe* FilePushPipe::Service::create(void* hwPipe, const char* args) {
+    auto pipe = new FilePushPipe(hwPipe, this);
+    AutoLock lock(sInstance->lock);
+    // The most recently connected daemon receives all new files.
+    sInstance->pipe = pipe;
+    return pipe;
+}
+
+}  // namespace emulation
+}  // namespace android
+
+void android_init_filepush_pipe(void) {
+    android::emulation::registerFilePushPipeService();
+}
@@ -0,0 +1,132 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <stdint.h>                                 // for uint32_t, uint64_t
+#include <deque>                                    // for deque
+#include <functional>                               // for function
+#include <memory>                                   // for unique_ptr
+#include <string>                                   // for string
+#include <vector>                                   // for vector
+
+#include "android/base/files/ScopedFd.h"            // for ScopedFd
+#include "android/base/synchronization/Lock.h"      // for Lock
+#include "android/base/threads/WorkerThread.h"      // for WorkerThread
+#include "android/emulation/AndroidPipe.h"          // for AndroidPipe, Andr...
+#include "android/emulation/android_pipe_common.h"  // for AndroidPipeBuffer
+
+namespace android {
+namespace emulation {
+
+// This is a pipe that streams files from the host into the guest.
+//
+// A push through adb moves every byte through the adb protocol in small
+// packets, with several copies on the host. This pipe is a dedicated bulk
+// channel instead: a reader thread of the pipe reads the file in large
+// chunks, a few of them ahead of the guest, and onGuestRecv only copies
+// those into the guest buffers. Reading the file never happens on the vCPU
+// thread, so a slow disk holds up the push but not the guest.
+//
+// The other side is a guest daemon that connects to the "filepush" service
+// and then loops:
+//
+//  1. Reads a Header, followed by |pathLength| bytes with the destination
+//     path (not zero terminated), followed by |size| bytes of content.
+//  2. Stores the contents at the destination path.
+//  3. Writes back a uint32_t status, 0 on success or an errno on failure.
+//
+// All integers are little endian.
+class FilePushPipe final : public AndroidPipe {
+public:
+    // Invoked with true if the guest stored the file. Note that this can be
+    // invoked on any thread.
+    using ResultCallback = std::function<void(bool success)>;
+
+    struct Header {
+        uint32_t magic;
+        uint32_t pathLength;
+        uint64_t size;
+    };
+    static constexpr uint32_t kMagic = 0x48535046;  // "FPSH"
+
+    class Service final : public AndroidPipe::Service {
+    public:
+        Service();
+        AndroidPipe* create(void* hwPipe, const char* args) override;
+    };
+
+    FilePushPipe(void* hwPipe, Service* svc);
+
+    void onGuestClose(PipeCloseReason reason) override;
+    unsigned onGuestPoll() const override;
+    int onGuestRecv(AndroidPipeBuffer* buffers, int numBuffers) override;
+    int onGuestSend(const AndroidPipeBuffer* buffers,
+                    int numBuffers,
+                    void** newPipePtr) override;
+    void onGuestWantWakeOn(int flags) override;
+
+    // True if a guest daemon is connected to the pipe.
+    static bool isConnected();
+
+    // Queues the file at |hostPath| to be stored at |guestPath|. Returns
+    // false if no guest daemon is connected, or if the file cannot be read.
+    // |callback| is only invoked if this returns true.
+    static bool pushFile(const std::string& hostPath,
+                         const std::string& guestPath,
+                         ResultCallback callback);
+
+private:
+    struct Transfer {
+        std::string header;  // The Header, followed by the guest path.
+        size_t headerSent = 0;
+        base::ScopedFd fd;   // Only used by the reader thread.
+        uint64_t size = 0;
+        uint64_t sent = 0;
+        bool failed = false;
+        ResultCallback callback;
+
+        // What the reader thread read, and the guest did not get yet.
+        std::deque<std::vector<uint8_t>> chunks;
+        size_t chunkOffset = 0;  // Into the front chunk.
+        uint64_t buffered = 0;
+        uint64_t readOffset = 0;
+        // True while the reader thread may touch this transfer.
+        bool reading = false;
+
+        // Copies the next bytes for the guest into |data|, and returns how
+        // many, 0 if there is nothing to copy right now.
+        size_t copyTo(uint8_t* data, size_t size);
+    };
+
+    void enqueue(std::unique_ptr<Transfer> transfer);
+    bool readableLocked() const;
+    void readAheadLocked(Transfer* transfer);
+    void readFile(Transfer* transfer);
+    void wakeGuestIfNeededLocked();
+
+    mutable base::Lock mLock;
+    std::deque<std::unique_ptr<Transfer>> mQueue;  // Front is in progress.
+    std::deque<std::unique_ptr<Transfer>> mAwaitingStatus;
+    uint32_t mStatus = 0;
+    size_t mStatusReceived = 0;
+    bool mWakeOnRead = false;
+    bool mClosing = false;
+    // Reads ahead for the front of mQueue. nullptr stops it.
+    base::WorkerThread<Transfer*> mReader;
+};
+
+void registerFilePushPipeService();
+
+}  // namespace emulation
+}  // namespace android
@@ -0,0 +1,167 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "android/emulation/FilePushPipe.h"
+
+#include <gtest/gtest.h>
+
+#include <errno.h>
+#include <string.h>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "android/base/system/System.h"
+#include "android/base/testing/TestLooper.h"
+#include "android/base/testing/TestTempDir.h"
+#include "android/emulation/hostdevices/HostGoldfishPipe.h"
+#include "android/emulation/testing/TestVmLock.h"
+#include "android/filepush-pipe.h"
+
+namespace android {
+namespace emulation {
+
+using android::base::System;
+using android::base::TestTempDir;
+
+class FilePushPipeTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        AndroidPipe::Service::resetAll();
+        mDevice = HostGoldfishPipeDevice::get();
+        mLooper = std::unique_ptr<base::TestLooper>(new base::TestLooper());
+        AndroidPipe::initThreadingForTest(TestVmLock::getInstance(),
+                                          mLooper.get());
+        android_init_filepush_pipe();
+        mTempDir.reset(new TestTempDir("filepush"));
+    }
+
+    void TearDown() override {
+        AndroidPipe::Service::resetAll();
+        AndroidPipe::initThreading(TestVmLock::getInstance());
+        mLooper.reset();
+    }
+
+    std::string writeFile(const std::string& name,
+                          const std::string& contents) {
+        std::string path = mTempDir->makeSubPath(name);
+        std::ofstream file(path, std::ios::binary);
+        file << contents;
+        return path;
+    }
+
+    // Reads exactly |len| bytes, the way a guest daemon would. The contents
+    // come from the reader thread of the pipe, so they may not be there yet.
+    std::string readExactly(int fd, size_t len) {
+        std::string result(len, '\0');
+        size_t offset = 0;
+        while (offset < len) {
+            auto read = mDevice->read(fd, &result[offset], len - offset);
+            if (read < 0 && mDevice->getErrno() == EAGAIN) {
+                System::get()->sleepMs(1);
+                continue;
+            }
+            EXPECT_GT(read, 0);
+            if (read <= 0) {
+                break;
+            }
+            offset += read;
+        }
+        return result;
+    }
+
+    // Receives one file, and acknowledges it with |status|.
+    void receiveFile(int fd,
+                     std::string* path,
+                     std::string* contents,
+                     uint32_t status = 0) {
+        FilePushPipe::Header header;
+        auto raw = readExactly(fd, sizeof(header));
+        memcpy(&header, raw.data(), sizeof(header));
+        EXPECT_EQ(FilePushPipe::kMagic, header.magic);
+        *path = readExactly(fd, header.pathLength);
+        *contents = readExactly(fd, header.size);
+        mDevice->write(fd, &status, sizeof(status));
+    }
+
+    HostGoldfishPipeDevice* mDevice = nullptr;
+    std::unique_ptr<base::TestLooper> mLooper;
+    std::unique_ptr<TestTempDir> mTempDir;
+};
+
+TEST_F(FilePushPipeTest, notConnected) {
+    auto file = writeFile("a.txt", "hello");
+    EXPECT_FALSE(FilePushPipe::isConnected());
+    EXPECT_FALSE(FilePushPipe::pushFile(file, "/data/a.txt",
+                                        [](bool) { FAIL(); }));
+}
+
+TEST_F(FilePushPipeTest, missingFile) {
+    auto fd = mDevice->connect("filepush");
+    EXPECT_TRUE(FilePushPipe::isConnected());
+    EXPECT_FALSE(FilePushPipe::pushFile(mTempDir->makeSubPath("missing"),
+                                        "/data/a.txt", [](bool) { FAIL(); }));
+    mDevice->close(fd);
+}
+
+TEST_F(FilePushPipeTest, pushesFiles) {
+    auto fd = mDevice->connect("filepush");
+    EXPECT_EQ(PIPE_POLL_OUT, mDevice->poll(fd));
+
+    // More than the pipe reads ahead, so that its reader has to pick up
+    // again as the guest catches up.
+    std::string big(9 * 1024 * 1024 + 17, 'x');
+    for (size_t i = 0; i < big.size(); i += 4093) {
+        big[i] = static_cast<char>(i);
+    }
+    auto small = writeFile("small.txt", "hello");
+    auto large = writeFile("large.bin", big);
+
+    std::vector<bool> results;
+    auto record = [&results](bool success) { results.push_back(success); };
+    EXPECT_TRUE(FilePushPipe::pushFile(small, "/data/small.txt", record));
+    EXPECT_TRUE(FilePushPipe::pushFile(large, "/data/large.bin", record));
+    EXPECT_TRUE(mDevice->poll(fd) & PIPE_POLL_IN);
+
+    std::string path, contents;
+    receiveFile(fd, &path, &contents);
+    EXPECT_EQ("/data/small.txt", path);
+    EXPECT_EQ("hello", contents);
+
+    receiveFile(fd, &path, &contents, 28 /* ENOSPC */);
+    EXPECT_EQ("/data/large.bin", path);
+    EXPECT_EQ(big, contents);
+
+    ASSERT_EQ(2, results.size());
+    EXPECT_TRUE(results[0]);
+    EXPECT_FALSE(results[1]);
+    EXPECT_EQ(PIPE_POLL_OUT, mDevice->poll(fd));
+    mDevice->close(fd);
+}
+
+TEST_F(FilePushPipeTest, closeFailsPendingPushes) {
+    auto fd = mDevice->connect("filepush");
+    auto file = writeFile("a.txt", "hello");
+    int failures = 0;
+    EXPECT_TRUE(FilePushPipe::pushFile(file, "/data/a.txt",
+                                       [&failures](bool success) {
+                                           failures += !success;
+                                       }));
+    mDevice->close(fd);
+    EXPECT_EQ(1, failures);
+    EXPECT_FALSE(FilePushPipe::isConnected());
+}
+
+}  // namespace emulation
+}  // namespace android
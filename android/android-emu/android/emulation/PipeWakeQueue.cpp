@@ -0,0 +1,129 @@
+// Copyright 2021 The Android Open Source Project
+//
+// This software is licensed under the terms of the GNU General Public
+// License version 2, as published by the Free Software Foundation, and
+// may be copied, distributed, and modified under those terms.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+#include "android/emulation/PipeWakeQueue.h"
+
+#include <algorithm>
+
+namespace android {
+
+using android::base::AutoLock;
+
+PipeWakeQueue::~PipeWakeQueue() {
+    Request* request = mPushed.exchange(nullptr, std::memory_order_acquire);
+    while (request) {
+        Request* next = request->next;
+        delete request;
+        request = next;
+    }
+}
+
+bool PipeWakeQueue::push(void* hwPipe, int wakeFlags) {
+    auto request = new Request{nullptr, hwPipe, wakeFlags};
+    Request* head = mPushed.load(std::memory_order_relaxed);
+    do {
+        request->next = head;
+    } while (!mPushed.compare_exchange_weak(head, request,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed));
+
+    mRequests.fetch_add(1, std::memory_order_relaxed);
+    if (head) {
+        return false;
+    }
+    mFirstRequests.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void PipeWakeQueue::collectLocked() {
+    // Only the device side takes requests off the list, so there is no ABA
+    // problem here: the whole list is taken at once.
+    Request* request = mPushed.exchange(nullptr, std::memory_order_acquire);
+
+    // Back to the order they were pushed in.
+    Request* ordered = nullptr;
+    while (request) {
+        Request* next = request->next;
+        request->next = ordered;
+        ordered = request;
+        request = next;
+    }
+
+    while (ordered) {
+        Request* next = ordered->next;
+        auto inserted =
+                mPendingIndex.emplace(ordered->hwPipe, mPending.size());
+        if (inserted.second) {
+            mPending.push_back({ordered->hwPipe, ordered->wakeFlags});
+        } else {
+            mPending[inserted.first->second].wakeFlags |= ordered->wakeFlags;
+        }
+        delete ordered;
+        ordered = next;
+    }
+}
+
+void PipeWakeQueue::drain(const DeliverFunc& deliver) {
+    AutoLock lock(mLock);
+    collectLocked();
+    if (mPending.empty()) {
+        return;
+    }
+    for (const PendingWake& wake : mPending) {
+        deliver(wake.hwPipe, wake.wakeFlags);
+    }
+    mDelivered.fetch_add(mPending.size(), std::memory_order_relaxed);
+    mDrains.fetch_add(1, std::memory_order_relaxed);
+    mPending.clear();
+    mPendingIndex.clear();
+}
+
+void PipeWakeQueue::abort(void* hwPipe) {
+    AutoLock lock(mLock);
+    collectLocked();
+    auto it = mPendingIndex.find(hwPipe);
+    if (it == mPendingIndex.end()) {
+        return;
+    }
+    mPending.erase(mPending.begin() + it->second);
+    mPendingIndex.clear();
+    for (size_t i = 0; i < mPending.size(); ++i) {
+        mPendingIndex.emplace(mPending[i].hwPipe, i);
+    }
+    mAborted.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PipeWakeQueue::abortAll() {
+    AutoLock lock(mLock);
+    collectLocked();
+    mAborted.fetch_add(mPending.size(), std::memory_order_relaxed);
+    mPending.clear();
+    mPendingIndex.clear();
+}
+
+int PipeWakeQueue::pendingFlags(void* hwPipe) {
+    AutoLock lock(mLock);
+    collectLocked();
+    auto it = mPendingIndex.find(hwPipe);
+    return it == mPendingIndex.end() ? 0 : mPending[it->second].wakeFlags;
+}
+
+PipeWakeQueue::Stats PipeWakeQueue::stats() const {
+    Stats stats;
+    stats.requests = mRequests.load(std::memory_order_relaxed);
+    stats.firstRequests = mFirstRequests.load(std::memory_order_relaxed);
+    stats.delivered = mDelivered.load(std::memory_order_relaxed);
+    stats.drains = mDrains.load(std::memory_order_relaxed);
+    stats.aborted = mAborted.load(std::memory_order_relaxed);
+    return stats;
+}
+
+}  // namespace android
@@ -0,0 +1,103 @@
+// Copyright 2021 The Android Open Source Project
+//
+// This software is licensed under the terms of the GNU General Public
+// License version 2, as published by the Free Software Foundation, and
+// may be copied, distributed, and modified under those terms.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+#pragma once
+
+#include "android/base/Compiler.h"
+#include "android/base/synchronization/Lock.h"
+
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <stdint.h>
+
+namespace android {
+
+// PipeWakeQueue holds the signalWake() / closeFromHost() requests that host
+// threads make for pipes, until the device thread can deliver them.
+//
+// - push() can be called from any thread and never blocks: requests go to a
+//   lock-free list.
+// - Everything else is for the device side, which merges the requests per
+//   pipe: a drain() delivers each pipe at most once, with the wake flags of
+//   all its requests OR-ed together, in the order of their first request.
+//
+// Chatty pipes (ADB, logcat, sensors, GL) wake the same pipe many times
+// before the device thread gets to it, which only needs to happen once.
+class PipeWakeQueue {
+public:
+    struct Stats {
+        // Requests pushed, and how many of them found the queue empty.
+        uint64_t requests = 0;
+        uint64_t firstRequests = 0;
+        // Wakes delivered to pipes, and drains that delivered any.
+        uint64_t delivered = 0;
+        uint64_t drains = 0;
+        // Pipe wakes dropped by abort() / abortAll().
+        uint64_t aborted = 0;
+    };
+
+    using DeliverFunc = std::function<void(void* hwPipe, int wakeFlags)>;
+
+    PipeWakeQueue() = default;
+    ~PipeWakeQueue();
+
+    // Queues |wakeFlags| for |hwPipe|. Returns true if there were no requests
+    // left to collect, i.e. the caller needs to schedule a drain().
+    bool push(void* hwPipe, int wakeFlags);
+
+    // Calls |deliver| for each pipe with pending requests, and forgets them.
+    void drain(const DeliverFunc& deliver);
+
+    // Forgets the pending requests for |hwPipe|, or all of them.
+    void abort(void* hwPipe);
+    void abortAll();
+
+    // Returns the flags that the next drain() will deliver to |hwPipe|.
+    int pendingFlags(void* hwPipe);
+
+    Stats stats() const;
+
+private:
+    struct Request {
+        Request* next;
+        void* hwPipe;
+        int wakeFlags;
+    };
+
+    struct PendingWake {
+        void* hwPipe;
+        int wakeFlags;
+    };
+
+    // Moves the pushed requests to |mPending|, merging them per pipe.
+    void collectLocked();
+
+    // Requests pushed since the last collection, most recent first.
+    std::atomic<Request*> mPushed{nullptr};
+
+    // Device side.
+    android::base::Lock mLock;
+    std::vector<PendingWake> mPending;
+    // Index of each pipe in |mPending|.
+    std::unordered_map<void*, size_t> mPendingIndex;
+
+    std::atomic<uint64_t> mRequests{0};
+    std::atomic<uint64_t> mFirstRequests{0};
+    std::atomic<uint64_t> mDelivered{0};
+    std::atomic<uint64_t> mDrains{0};
+    std::atomic<uint64_t> mAborted{0};
+
+    DISALLOW_COPY_ASSIGN_AND_MOVE(PipeWakeQueue);
+};
+
+}  // namespace android
@@ -0,0 +1,153 @@
+// Copyright 2021 The Android Open Source Project
+//
+// This software is licensed under the terms of the GNU General Public
+// License version 2, as published by the Free Software Foundation, and
+// may be copied, distributed, and modified under those terms.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+#include "android/emulation/PipeWakeQueue.h"
+
+#include "android/base/threads/FunctorThread.h"
+#include "android/emulation/android_pipe_common.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using android::base::FunctorThread;
+
+namespace android {
+
+namespace {
+
+using Wakes = std::vector<std::pair<void*, int>>;
+
+void* pipe(uintptr_t id) {
+    return reinterpret_cast<void*>(id);
+}
+
+Wakes drain(PipeWakeQueue* queue) {
+    Wakes wakes;
+    queue->drain([&wakes](void* hwPipe, int flags) {
+        wakes.emplace_back(hwPipe, flags);
+    });
+    return wakes;
+}
+
+}  // namespace
+
+TEST(PipeWakeQueue, MergesPerPipe) {
+    PipeWakeQueue queue;
+    EXPECT_TRUE(queue.push(pipe(1), PIPE_WAKE_READ));
+    EXPECT_FALSE(queue.push(pipe(2), PIPE_WAKE_WRITE));
+    EXPECT_FALSE(queue.push(pipe(1), PIPE_WAKE_WRITE));
+    EXPECT_FALSE(queue.push(pipe(1), PIPE_WAKE_READ));
+
+    EXPECT_EQ(Wakes({{pipe(1), PIPE_WAKE_READ | PIPE_WAKE_WRITE},
+                     {pipe(2), PIPE_WAKE_WRITE}}),
+              drain(&queue));
+    EXPECT_TRUE(drain(&queue).empty());
+
+    // Empty again.
+    EXPECT_TRUE(queue.push(pipe(2), PIPE_WAKE_READ));
+    EXPECT_EQ(Wakes({{pipe(2), PIPE_WAKE_READ}}), drain(&queue));
+
+    const PipeWakeQueue::Stats stats = queue.stats();
+    EXPECT_EQ(5u, stats.requests);
+    EXPECT_EQ(2u, stats.firstRequests);
+    EXPECT_EQ(3u, stats.delivered);
+    EXPECT_EQ(2u, stats.drains);
+}
+
+TEST(PipeWakeQueue, KeepsOrderOfFirstRequest) {
+    PipeWakeQueue queue;
+    for (uintptr_t i = 10; i > 0; --i) {
+        queue.push(pipe(i), PIPE_WAKE_READ);
+    }
+    queue.push(pipe(10), PIPE_WAKE_CLOSED);
+
+    const Wakes wakes = drain(&queue);
+    ASSERT_EQ(10u, wakes.size());
+    for (uintptr_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(pipe(10 - i), wakes[i].first);
+    }
+    EXPECT_EQ(PIPE_WAKE_READ | PIPE_WAKE_CLOSED, wakes[0].second);
+}
+
+TEST(PipeWakeQueue, Abort) {
+    PipeWakeQueue queue;
+    queue.push(pipe(1), PIPE_WAKE_READ);
+    queue.push(pipe(2), PIPE_WAKE_READ);
+    queue.push(pipe(3), PIPE_WAKE_WRITE);
+    EXPECT_EQ(PIPE_WAKE_READ, queue.pendingFlags(pipe(2)));
+
+    queue.push(pipe(2), PIPE_WAKE_WRITE);
+    EXPECT_EQ(PIPE_WAKE_READ | PIPE_WAKE_WRITE, queue.pendingFlags(pipe(2)));
+    queue.abort(pipe(2));
+    EXPECT_EQ(0, queue.pendingFlags(pipe(2)));
+    queue.abort(pipe(4));
+
+    // Still merges with what was pending before the abort.
+    queue.push(pipe(3), PIPE_WAKE_READ);
+    EXPECT_EQ(Wakes({{pipe(1), PIPE_WAKE_READ},
+                     {pipe(3), PIPE_WAKE_WRITE | PIPE_WAKE_READ}}),
+              drain(&queue));
+
+    queue.push(pipe(1), PIPE_WAKE_READ);
+    queue.push(pipe(2), PIPE_WAKE_READ);
+    queue.abortAll();
+    EXPECT_TRUE(drain(&queue).empty());
+    EXPECT_EQ(3u, queue.stats().aborted);
+}
+
+TEST(PipeWakeQueue, ConcurrentPush) {
+    constexpr int kThreads = 4;
+    constexpr int kPipes = 16;
+    constexpr int kPushes = 10000;
+
+    PipeWakeQueue queue;
+    std::map<void*, int> flags;
+    int delivered = 0;
+    bool done = false;
+
+    std::vector<std::unique_ptr<FunctorThread>> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back(new FunctorThread([&queue, t] {
+            for (int i = 0; i < kPushes; ++i) {
+                queue.push(pipe(1 + (i % kPipes)), 1 << (t + 1));
+            }
+            return 0;
+        }));
+        threads.back()->start();
+    }
+
+    const auto deliver = [&flags, &delivered](void* hwPipe, int wakeFlags) {
+        flags[hwPipe] |= wakeFlags;
+        ++delivered;
+    };
+    while (!done) {
+        done = true;
+        for (auto& thread : threads) {
+            done = done && thread->tryWait(nullptr);
+        }
+        queue.drain(deliver);
+    }
+
+    ASSERT_EQ(size_t(kPipes), flags.size());
+    for (const auto& pipeFlags : flags) {
+        EXPECT_EQ(0x1e, pipeFlags.second);
+    }
+    const PipeWakeQueue::Stats stats = queue.stats();
+    EXPECT_EQ(uint64_t(kThreads * kPushes), stats.requests);
+    EXPECT_EQ(uint64_t(delivered), stats.delivered);
+    EXPECT_LE(stats.delivered, stats.requests);
+}
+
+}  // namespace android
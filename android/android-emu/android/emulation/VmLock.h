@@ -47,6 +47,11 @@ public:
     // Lock the VM global mutex.
     virtual void lock() {}
 
+    // Same as lock(), on behalf of |caller|, the name of the function that
+    // needs the lock. The lock profiler reports the time spent waiting for
+    // the lock and holding it per caller.
+    virtual void lockFrom(const char* caller) { lock(); }
+
     // Unlock the VM global mutex.
     virtual void unlock() {}
 
@@ -77,8 +82,10 @@ public:
 class ScopedVmLock {
     DISALLOW_COPY_ASSIGN_AND_MOVE(ScopedVmLock);
 public:
-    ScopedVmLock(VmLock* vmLock = VmLock::get()) : mVmLock(vmLock) {
-        mVmLock->lock();
+    ScopedVmLock(VmLock* vmLock = VmLock::get(),
+                 const char* caller = __builtin_FUNCTION())
+        : mVmLock(vmLock) {
+        mVmLock->lockFrom(caller);
     }
 
     ~ScopedVmLock() {
@@ -94,12 +101,13 @@ private:
 class RecursiveScopedVmLock {
     DISALLOW_COPY_ASSIGN_AND_MOVE(RecursiveScopedVmLock);
 public:
-    RecursiveScopedVmLock(VmLock* vmLock = VmLock::get()) {
+    RecursiveScopedVmLock(VmLock* vmLock = VmLock::get(),
+                          const char* caller = __builtin_FUNCTION()) {
         if (vmLock->isLockedBySelf()) {
             mVmLock = nullptr;
         } else {
             mVmLock = vmLock;
-            vmLock->lock();
+            vmLock->lockFrom(caller);
         }
     }
 
@@ -118,7 +126,8 @@ private:
 class RecursiveScopedVmLockIfInstance {
     DISALLOW_COPY_ASSIGN_AND_MOVE(RecursiveScopedVmLockIfInstance);
 public:
-    RecursiveScopedVmLockIfInstance() {
+    explicit RecursiveScopedVmLockIfInstance(
+            const char* caller = __builtin_FUNCTION()) {
         if (!VmLock::hasInstance()) return;
 
         VmLock* vmLock = VmLock::get();
@@ -127,7 +136,7 @@ public:
             mVmLock = nullptr;
         } else {
             mVmLock = vmLock;
-            vmLock->lock();
+            vmLock->lockFrom(caller);
         }
     }
 
@@ -146,7 +155,9 @@ private:
 class ScopedVmUnlock {
     DISALLOW_COPY_ASSIGN_AND_MOVE(ScopedVmUnlock);
 public:
-    ScopedVmUnlock(VmLock* vmLock = VmLock::get()) {
+    ScopedVmUnlock(VmLock* vmLock = VmLock::get(),
+                   const char* caller = __builtin_FUNCTION())
+        : mCaller(caller) {
         if (vmLock->isLockedBySelf()) {
             mVmLock = vmLock;
             vmLock->unlock();
@@ -157,12 +168,13 @@ public:
 
     ~ScopedVmUnlock() {
         if (mVmLock) {
-            mVmLock->lock();
+            mVmLock->lockFrom(mCaller);
         }
     }
 
 private:
     VmLock* mVmLock;
+    const char* const mCaller;
 };
 
 }  // namespace android
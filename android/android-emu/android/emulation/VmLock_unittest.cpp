@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+
 namespace android {
 
 TEST(VmLock, Default) {
@@ -102,4 +104,43 @@ TEST(ScopedVmLock, CustomVmLock) {
     EXPECT_EQ(2, myLock.mUnlockCount);
 }
 
+namespace {
+
+class CallerVmLock : public TestVmLock {
+public:
+    void lockFrom(const char* caller) override {
+        mCaller = caller;
+        lock();
+    }
+
+    std::string mCaller;
+};
+
+void lockForDeviceOperation() {
+    ScopedVmLock vlock;
+}
+
+void unlockForSlowOperation() {
+    ScopedVmUnlock unlock;
+}
+
+}  // namespace
+
+TEST(ScopedVmLock, Caller) {
+    CallerVmLock myLock;
+
+    lockForDeviceOperation();
+    EXPECT_EQ("lockForDeviceOperation", myLock.mCaller);
+    EXPECT_EQ(1, myLock.mLockCount);
+
+    {
+        RecursiveScopedVmLock vlock;
+        EXPECT_EQ("TestBody", myLock.mCaller);
+        unlockForSlowOperation();
+        EXPECT_EQ("unlockForSlowOperation", myLock.mCaller);
+    }
+    EXPECT_EQ(3, myLock.mLockCount);
+    EXPECT_EQ(3, myLock.mUnlockCount);
+}
+
 }  // namespace android
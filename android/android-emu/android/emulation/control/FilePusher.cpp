@@ -16,15 +16,20 @@
 
 #include "android/base/Compiler.h"
 #include "android/base/Log.h"
+#include "android/base/async/ThreadLooper.h"
+#include "android/base/files/PathUtils.h"
 #include "android/base/system/System.h"
+#include "android/emulation/FilePushPipe.h"
 
 namespace android {
 namespace emulation {
 
 using android::base::Looper;
 using android::base::ParallelTask;
+using android::base::PathUtils;
 using android::base::StringView;
 using android::base::System;
+using android::base::ThreadLooper;
 using std::string;
 using std::vector;
 
@@ -46,7 +51,7 @@ FilePusher::~FilePusher() {
 void FilePusher::pushFiles(const std::vector<FilePusher::PushItem>& files) {
     mPushQueue.insert(mPushQueue.end(), files.begin(), files.end());
     mNumQueued += files.size();
-    if (!mCurrentPushCommand) {
+    if (!mCurrentPushCommand && !mCurrentPipePush) {
         mProgressCallback(0, false);
         pushNextItem();
     }
@@ -57,6 +62,7 @@ void FilePusher::cancel() {
         mCurrentPushCommand->cancel();
         mCurrentPushCommand.reset();
     }
+    mCurrentPipePush.reset();
     mPushQueue.clear();
     resetProgress();
 }
@@ -74,6 +80,52 @@ void FilePusher::pushNextItem() {
         pushDone(Result::FileReadError);
         return;
     }
+    if (!pushViaPipe()) {
+        pushViaAdb();
+    }
+}
+
+bool FilePusher::pushViaPipe() {
+    // The filepush pipe streams the file into guest memory in large chunks,
+    // which is a lot faster than adb. It is only there if the guest daemon
+    // runs.
+    if (!FilePushPipe::isConnected()) {
+        return false;
+    }
+
+    // Like adb, a destination that ends with a '/' is a directory.
+    std::string guestPath = mCurrentItem.second;
+    StringView baseName;
+    if (!guestPath.empty() && guestPath.back() == '/' &&
+        PathUtils::split(mCurrentItem.first, nullptr, &baseName)) {
+        guestPath += baseName.str();
+    }
+
+    // The push can complete after we have been cancelled, or deleted.
+    auto push = std::make_shared<bool>(true);
+    std::weak_ptr<bool> weakPush = push;
+    auto onResult = [this, weakPush](bool success) {
+        ThreadLooper::runOnMainLooper([this, weakPush, success]() {
+            if (!weakPush.lock()) {
+                return;
+            }
+            mCurrentPipePush.reset();
+            if (success) {
+                pushDone(Result::Success);
+            } else {
+                LOG(VERBOSE) << "Pipe push failed, retrying with adb.";
+                pushViaAdb();
+            }
+        });
+    };
+    if (!FilePushPipe::pushFile(mCurrentItem.first, guestPath, onResult)) {
+        return false;
+    }
+    mCurrentPipePush = std::move(push);
+    return true;
+}
+
+void FilePusher::pushViaAdb() {
     mCurrentPushCommand = mAdb->runAdbCommand(
         {"push", mCurrentItem.first, mCurrentItem.second},
         [this](const OptionalAdbCommandResult& result) {
@@ -65,11 +65,15 @@ public:
 
 private:
     void pushNextItem();
+    bool pushViaPipe();
+    void pushViaAdb();
     void pushDone(const Result& result);
     void resetProgress();
 
     AdbInterface* mAdb;
     AdbCommandPtr mCurrentPushCommand;
+    // Set while the current item is pushed through the filepush pipe.
+    std::shared_ptr<bool> mCurrentPipePush;
     ProgressCallback mProgressCallback;
     ResultCallback mResultCallback;
 
@@ -0,0 +1,307 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/emulation/control/PngEncoder.h"
+
+#include <string.h>  // for memcpy
+#include <zlib.h>    // for deflate, adler32, crc32
+
+#include <algorithm>  // for min, max
+#include <atomic>     // for atomic
+#include <cstddef>    // for ptrdiff_t
+#include <utility>    // for swap
+
+#include "android/base/memory/LazyInstance.h"  // for LazyInstance
+#include "android/base/system/System.h"        // for System
+#include "android/base/threads/ParallelFor.h"  // for ParallelFor
+
+namespace android {
+namespace emulation {
+
+// Stripes smaller than this are not worth handing to another thread.
+static constexpr uint32_t kMinRowsPerStripe = 32;
+
+// Block size (in pixels) used when rotating images.
+static constexpr uint32_t kRotateBlock = 32;
+
+// PNG filter type "Sub", each byte is stored as the difference with the
+// corresponding byte of the pixel on its left. It is cheap to compute and
+// compresses the large flat areas of a typical UI very well.
+static constexpr uint8_t kPngFilterSub = 1;
+
+namespace {
+
+// A set of consecutive rows that is deflated as an independent unit.
+struct Stripe {
+    uint32_t first;
+    uint32_t count;
+    bool last;
+    std::vector<uint8_t> deflated;
+    uLong adler;
+    uLong length;
+};
+
+// Deflates the stripes of every screenshot, the threads are only started
+// for the first one.
+struct StripeWorkers {
+    StripeWorkers()
+        : parallel(android::base::System::get()->getCpuCoreCount()) {}
+
+    android::base::ParallelFor parallel;
+};
+
+android::base::LazyInstance<StripeWorkers> sStripeWorkers =
+        LAZY_INSTANCE_INIT;
+
+}  // namespace
+
+template <size_t N>
+static void rotateBlocked(const uint8_t* src,
+                          uint8_t* dst,
+                          uint32_t width,
+                          uint32_t height,
+                          ptrdiff_t base,
+                          ptrdiff_t dx,
+                          ptrdiff_t dy) {
+    // The destination index of source pixel (x, y) is base + x * dx + y * dy.
+    for (uint32_t by = 0; by < height; by += kRotateBlock) {
+        const uint32_t ey = std::min(by + kRotateBlock, height);
+        for (uint32_t bx = 0; bx < width; bx += kRotateBlock) {
+            const uint32_t ex = std::min(bx + kRotateBlock, width);
+            for (uint32_t y = by; y < ey; y++) {
+                const uint8_t* s =
+                        src + (static_cast<size_t>(y) * width + bx) * N;
+                ptrdiff_t d = base + bx * dx + y * dy;
+                for (uint32_t x = bx; x < ex; x++) {
+                    memcpy(dst + d * N, s, N);
+                    s += N;
+                    d += dx;
+                }
+            }
+        }
+    }
+}
+
+void rotatePixels(const uint8_t* src,
+                  uint8_t* dst,
+                  uint32_t width,
+                  uint32_t height,
+                  uint8_t nChannels,
+                  SkinRotation rotation) {
+    const ptrdiff_t w = width;
+    const ptrdiff_t h = height;
+    ptrdiff_t base, dx, dy;
+    switch (rotation) {
+        case SKIN_ROTATION_90:
+            base = h - 1;
+            dx = h;
+            dy = -1;
+            break;
+        case SKIN_ROTATION_180:
+            base = w * h - 1;
+            dx = -1;
+            dy = -w;
+            break;
+        case SKIN_ROTATION_270:
+            base = (w - 1) * h;
+            dx = -h;
+            dy = 1;
+            break;
+        default:
+            memcpy(dst, src, static_cast<size_t>(w) * h * nChannels);
+            return;
+    }
+
+    if (nChannels == 4) {
+        rotateBlocked<4>(src, dst, width, height, base, dx, dy);
+    } else if (nChannels == 3) {
+        rotateBlocked<3>(src, dst, width, height, base, dx, dy);
+    } else {
+        rotateBlocked<1>(src, dst, width, height, base, dx, dy);
+    }
+}
+
+// Filters and deflates the rows of the given stripe into a raw deflate
+// stream. All stripes but the last one end on a byte boundary (sync flush),
+// so they can simply be concatenated.
+static bool deflateStripe(const uint8_t* pixels,
+                          uint32_t width,
+                          uint8_t nChannels,
+                          Stripe* stripe) {
+    const size_t stride = static_cast<size_t>(width) * nChannels;
+    std::vector<uint8_t> row(stride + 1);
+
+    z_stream z = {};
+    if (deflateInit2(&z, Z_BEST_SPEED, Z_DEFLATED, -MAX_WBITS, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        return false;
+    }
+
+    stripe->deflated.resize(deflateBound(&z, row.size() * stripe->count) + 16);
+    stripe->adler = adler32(0, Z_NULL, 0);
+    stripe->length = 0;
+    z.next_out = stripe->deflated.data();
+    z.avail_out = stripe->deflated.size();
+
+    bool success = true;
+    for (uint32_t r = 0; r < stripe->count && success; r++) {
+        const uint8_t* src = pixels + (stripe->first + r) * stride;
+        row[0] = kPngFilterSub;
+        memcpy(&row[1], src, nChannels);
+        for (size_t i = nChannels; i < stride; i++) {
+            row[i + 1] = src[i] - src[i - nChannels];
+        }
+        stripe->adler = adler32(stripe->adler, row.data(), row.size());
+        stripe->length += row.size();
+
+        int flush = Z_NO_FLUSH;
+        if (r + 1 == stripe->count) {
+            flush = stripe->last ? Z_FINISH : Z_SYNC_FLUSH;
+        }
+        z.next_in = row.data();
+        z.avail_in = row.size();
+        int res;
+        do {
+            if (z.avail_out == 0) {
+                size_t used = stripe->deflated.size();
+                stripe->deflated.resize(used * 2);
+                z.next_out = stripe->deflated.data() + used;
+                z.avail_out = used;
+            }
+            res = deflate(&z, flush);
+            if (res == Z_STREAM_ERROR) {
+                success = false;
+                break;
+            }
+        } while (z.avail_out == 0 ||
+                 (flush == Z_FINISH && res != Z_STREAM_END));
+    }
+
+    stripe->deflated.resize(z.total_out);
+    deflateEnd(&z);
+    return success;
+}
+
+static void putUint32BE(std::vector<uint8_t>* out, uint32_t value) {
+    out->push_back(value >> 24);
+    out->push_back(value >> 16);
+    out->push_back(value >> 8);
+    out->push_back(value);
+}
+
+// Marks the start of a chunk, returns the offset of the chunk in |out|.
+static size_t beginChunk(std::vector<uint8_t>* out, const char* type) {
+    size_t offset = out->size();
+    putUint32BE(out, 0);
+    out->insert(out->end(), type, type + 4);
+    return offset;
+}
+
+// Fills in the length and appends the crc of the chunk at |offset|.
+static void endChunk(std::vector<uint8_t>* out, size_t offset) {
+    const size_t length = out->size() - offset - 8;
+    (*out)[offset] = length >> 24;
+    (*out)[offset + 1] = length >> 16;
+    (*out)[offset + 2] = length >> 8;
+    (*out)[offset + 3] = length;
+    const uint8_t* start = out->data() + offset + 4;
+    putUint32BE(out, crc32(crc32(0, Z_NULL, 0), start, length + 4));
+}
+
+bool encodePng(const uint8_t* pixels,
+               uint32_t width,
+               uint32_t height,
+               uint8_t nChannels,
+               SkinRotation rotation,
+               std::vector<uint8_t>* out,
+               int threads) {
+    if ((nChannels != 3 && nChannels != 4) || !pixels || width == 0 ||
+        height == 0) {
+        return false;
+    }
+
+    std::vector<uint8_t> rotated;
+    if (rotation != SKIN_ROTATION_0) {
+        rotated.resize(static_cast<size_t>(width) * height * nChannels);
+        rotatePixels(pixels, rotated.data(), width, height, nChannels,
+                     rotation);
+        pixels = rotated.data();
+        if (rotation == SKIN_ROTATION_90 || rotation == SKIN_ROTATION_270) {
+            std::swap(width, height);
+        }
+    }
+
+    if (threads < 1) {
+        threads = sStripeWorkers->parallel.threads();
+    }
+    const uint32_t rowsPerStripe = std::max(
+            kMinRowsPerStripe, (height + threads - 1) / threads);
+    std::vector<Stripe> stripes;
+    for (uint32_t first = 0; first < height; first += rowsPerStripe) {
+        Stripe stripe = {};
+        stripe.first = first;
+        stripe.count = std::min(rowsPerStripe, height - first);
+        stripes.push_back(std::move(stripe));
+    }
+    stripes.back().last = true;
+
+    std::atomic<bool> success{true};
+    sStripeWorkers->parallel.forEach(stripes.size(), [&](int i) {
+        if (!deflateStripe(pixels, width, nChannels, &stripes[i])) {
+            success = false;
+        }
+    });
+    if (!success) {
+        return false;
+    }
+
+    static const uint8_t kSignature[] = {0x89, 'P',  'N',  'G',
+                                         '\r', '\n', 0x1a, '\n'};
+    out->insert(out->end(), kSignature, kSignature + sizeof(kSignature));
+
+    size_t chunk = beginChunk(out, "IHDR");
+    putUint32BE(out, width);
+    putUint32BE(out, height);
+    out->push_back(8);                        // Bit depth
+    out->push_back(nChannels == 4 ? 6 : 2);  // RGBA or RGB
+    out->push_back(0);                        // Deflate compression
+    out->push_back(0);                        // Adaptive filtering
+    out->push_back(0);                        // No interlacing
+    endChunk(out, chunk);
+
+    size_t total = 6;
+    for (const auto& stripe : stripes) {
+        total += stripe.deflated.size();
+    }
+    out->reserve(out->size() + total + 32);
+
+    chunk = beginChunk(out, "IDAT");
+    out->push_back(0x78);  // Deflate, 32K window.
+    out->push_back(0x01);  // Fastest compression, no dictionary.
+    uLong adler = adler32(0, Z_NULL, 0);
+    for (const auto& stripe : stripes) {
+        out->insert(out->end(), stripe.deflated.begin(),
+                    stripe.deflated.end());
+        adler = adler32_combine(adler, stripe.adler, stripe.length);
+    }
+    putUint32BE(out, adler);
+    endChunk(out, chunk);
+
+    chunk = beginChunk(out, "IEND");
+    endChunk(out, chunk);
+    return true;
+}
+
+}  // namespace emulation
+}  // namespace android
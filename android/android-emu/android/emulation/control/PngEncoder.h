@@ -0,0 +1,61 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>  // for uint8_t, uint32_t
+#include <vector>   // for vector
+
+#include "android/skin/rect.h"  // for SkinRotation
+
+namespace android {
+namespace emulation {
+
+// Rotates the tightly packed |width| x |height| image with |nChannels| bytes
+// per pixel into |dst|. |dst| must be able to hold width * height * nChannels
+// bytes. The rotation follows the same conventions as savepng, that is, for a
+// 90 or 270 degree rotation the resulting image is |height| pixels wide.
+//
+// The image is processed in small blocks so that both the source and
+// destination stay in the cache, which matters a lot for 90 and 270 degree
+// rotations of large screens.
+void rotatePixels(const uint8_t* src,
+                  uint8_t* dst,
+                  uint32_t width,
+                  uint32_t height,
+                  uint8_t nChannels,
+                  SkinRotation rotation);
+
+// Encodes the tightly packed |width| x |height| RGB888 (|nChannels| == 3) or
+// RGBA8888 (|nChannels| == 4) image as a PNG, rotated by |rotation|, and
+// appends the result to |out|.
+//
+// The image rows are split in up to |threads| stripes (0 means one per core)
+// that are filtered and deflated independently, on a pool of worker threads
+// shared by all the calls. The resulting deflate streams are stitched
+// together into a single zlib stream, so the result is a regular PNG that any
+// decoder can read. We favor speed over size, as screenshots are usually
+// short lived.
+//
+// Returns false if the image could not be encoded.
+bool encodePng(const uint8_t* pixels,
+               uint32_t width,
+               uint32_t height,
+               uint8_t nChannels,
+               SkinRotation rotation,
+               std::vector<uint8_t>* out,
+               int threads = 0);
+
+}  // namespace emulation
+}  // namespace android
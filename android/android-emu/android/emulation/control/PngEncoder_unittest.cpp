@@ -0,0 +1,128 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/emulation/control/PngEncoder.h"
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "android/loadpng.h"
+
+namespace android {
+namespace emulation {
+
+static std::vector<uint8_t> makeImage(uint32_t width,
+                                      uint32_t height,
+                                      uint8_t nChannels) {
+    std::vector<uint8_t> pixels(width * height * nChannels);
+    for (size_t i = 0; i < pixels.size(); i++) {
+        // Mix some gradients with noise, so we exercise the filters.
+        pixels[i] = (i % 7 == 0) ? rand() : (i / nChannels) % 251;
+    }
+    return pixels;
+}
+
+// Decodes the png and verifies it matches |expected|.
+static void verifyPng(const std::vector<uint8_t>& png,
+                      const std::vector<uint8_t>& expected,
+                      uint32_t width,
+                      uint32_t height,
+                      uint8_t nChannels) {
+    unsigned w = 0, h = 0;
+    uint8_t* decoded =
+            static_cast<uint8_t*>(readpng(png.data(), png.size(), &w, &h));
+    ASSERT_NE(nullptr, decoded);
+    EXPECT_EQ(width, w);
+    EXPECT_EQ(height, h);
+
+    // readpng always produces RGBA.
+    for (size_t i = 0; i < width * height; i++) {
+        for (int c = 0; c < nChannels; c++) {
+            ASSERT_EQ(expected[i * nChannels + c], decoded[i * 4 + c])
+                    << "pixel: " << i << ", channel: " << c;
+        }
+    }
+    free(decoded);
+}
+
+TEST(PngEncoder, rejectsBadInput) {
+    std::vector<uint8_t> out;
+    uint8_t pixel[4] = {};
+    EXPECT_FALSE(encodePng(pixel, 1, 1, 2, SKIN_ROTATION_0, &out));
+    EXPECT_FALSE(encodePng(pixel, 0, 1, 4, SKIN_ROTATION_0, &out));
+    EXPECT_FALSE(encodePng(nullptr, 1, 1, 4, SKIN_ROTATION_0, &out));
+}
+
+TEST(PngEncoder, singleStripe) {
+    for (uint8_t nChannels : {3, 4}) {
+        auto pixels = makeImage(31, 7, nChannels);
+        std::vector<uint8_t> png;
+        ASSERT_TRUE(encodePng(pixels.data(), 31, 7, nChannels,
+                              SKIN_ROTATION_0, &png, 1));
+        verifyPng(png, pixels, 31, 7, nChannels);
+    }
+}
+
+TEST(PngEncoder, multipleStripes) {
+    for (uint8_t nChannels : {3, 4}) {
+        auto pixels = makeImage(257, 301, nChannels);
+        std::vector<uint8_t> png;
+        ASSERT_TRUE(encodePng(pixels.data(), 257, 301, nChannels,
+                              SKIN_ROTATION_0, &png, 4));
+        verifyPng(png, pixels, 257, 301, nChannels);
+    }
+}
+
+TEST(PngEncoder, rotations) {
+    const uint32_t width = 67, height = 131;
+    for (uint8_t nChannels : {3, 4}) {
+        auto pixels = makeImage(width, height, nChannels);
+        for (auto rotation : {SKIN_ROTATION_90, SKIN_ROTATION_180,
+                              SKIN_ROTATION_270}) {
+            std::vector<uint8_t> rotated(pixels.size());
+            rotatePixels(pixels.data(), rotated.data(), width, height,
+                         nChannels, rotation);
+            bool swap = rotation != SKIN_ROTATION_180;
+
+            std::vector<uint8_t> png;
+            ASSERT_TRUE(encodePng(pixels.data(), width, height, nChannels,
+                                  rotation, &png, 3));
+            verifyPng(png, rotated, swap ? height : width,
+                      swap ? width : height, nChannels);
+        }
+    }
+}
+
+TEST(PngEncoder, rotatePixels) {
+    // 3x2 image, single channel:
+    // 1 2 3
+    // 4 5 6
+    const uint8_t src[] = {1, 2, 3, 4, 5, 6};
+    const uint8_t rot90[] = {4, 1, 5, 2, 6, 3};
+    const uint8_t rot180[] = {6, 5, 4, 3, 2, 1};
+    const uint8_t rot270[] = {3, 6, 2, 5, 1, 4};
+    uint8_t dst[6];
+
+    rotatePixels(src, dst, 3, 2, 1, SKIN_ROTATION_90);
+    EXPECT_EQ(0, memcmp(rot90, dst, sizeof(dst)));
+    rotatePixels(src, dst, 3, 2, 1, SKIN_ROTATION_180);
+    EXPECT_EQ(0, memcmp(rot180, dst, sizeof(dst)));
+    rotatePixels(src, dst, 3, 2, 1, SKIN_ROTATION_270);
+    EXPECT_EQ(0, memcmp(rot270, dst, sizeof(dst)));
+}
+
+}  // namespace emulation
+}  // namespace android
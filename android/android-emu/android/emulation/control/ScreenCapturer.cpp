@@ -15,7 +15,6 @@
 #include "android/emulation/control/ScreenCapturer.h"
 
 #include <assert.h>  // for assert
-#include <png.h>     // for png_create_info...
 #include <stdio.h>   // for NULL, snprintf
 #include <string.h>  // for memcpy
 
@@ -23,19 +22,27 @@
 #include <memory>   // for shared_ptr
 #include <vector>   // for vector
 
+#if defined(__x86_64__) && !defined(_MSC_VER)
+#include <tmmintrin.h>
+#define HAS_SSSE3_CONVERSION 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define HAS_NEON_CONVERSION 1
+#endif
+
 #include "OpenglRender/Renderer.h"                    // for Renderer
 #include "android/base/Log.h"                         // for LOG, LogMessage
 #include "android/base/files/PathUtils.h"             // for PathUtils
 #include "android/base/system/System.h"               // for System
 #include "android/console.h"                          // for getConsoleAgents
+#include "android/emulation/control/PngEncoder.h"     // for encodePng
 #include "android/emulation/control/display_agent.h"  // for QAndroidDisplay...
 #include "android/emulation/control/window_agent.h"   // for QAndroidEmulato...
 #include "android/emulator-window.h"                  // for emulator_window...
-#include "android/loadpng.h"                          // for savepng, write_...
 #include "android/opengles.h"                         // for android_getOpen...
+#include "android/utils/file_io.h"                    // for android_fopen
 #include "android/utils/string.h"                     // for str_ends_with
 #include "observation.pb.h"                           // for Observation
-#include "pngconf.h"                                  // for png_byte, png_b...
 
 namespace android {
 namespace emulation {
@@ -170,23 +177,14 @@ Image takeScreenshot(
     switch (desiredFormat) {
         case ImageFormat::PNG: {
             std::vector<uint8_t> pngData;
-            png_structp p = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL,
-                                                    NULL, NULL);
-            png_infop pi = png_create_info_struct(p);
-            png_set_write_fn(
-                    p, &pngData,
-                    [](png_structp png_ptr, png_bytep data, png_size_t length) {
-                        std::vector<uint8_t>* vec =
-                                reinterpret_cast<std::vector<uint8_t>*>(
-                                        png_get_io_ptr(png_ptr));
-                        vec->insert(vec->end(), &data[0], &data[length]);
-                    },
-                    [](png_structp png_ptr) {});
             // already rotated through rendering
             rotation = renderer ? SKIN_ROTATION_0 : rotation;
-            write_png_user_function(p, pi, nChannels, width, height, rotation,
-                                    pixelBuffer.data());
-            png_destroy_write_struct(&p, &pi);
+            if (!encodePng(pixelBuffer.data(), width, height, nChannels,
+                           rotation, &pngData)) {
+                LOG(ERROR) << "Unable to encode " << width << "x" << height
+                           << " screenshot as png";
+                pngData.clear();
+            }
             return Image((uint16_t)width, (uint16_t)height, nChannels,
                          ImageFormat::PNG, std::move(pngData));
         }
@@ -271,9 +269,22 @@ bool captureScreenshot(
 
     // already rotated through rendering
     rotation = renderer ? SKIN_ROTATION_0 : rotation;
-    savepng(outputFilePath.c_str(), img.getChannels(), img.getWidth(),
-            img.getHeight(), rotation, img.getPixelBuf());
-    return true;
+    std::vector<uint8_t> pngData;
+    if (!encodePng(img.getPixelBuf(), img.getWidth(), img.getHeight(),
+                   img.getChannels(), rotation, &pngData)) {
+        LOG(ERROR) << "Unable to encode screenshot as png";
+        return false;
+    }
+
+    FILE* fp = android_fopen(outputFilePath.c_str(), "wb");
+    if (!fp) {
+        LOG(ERROR) << "Unable to write to file " << outputFilePath;
+        return false;
+    }
+    bool written = fwrite(pngData.data(), 1, pngData.size(), fp) ==
+                   pngData.size();
+    fclose(fp);
+    return written;
 }
 
 // True if we are on a big endian system
@@ -377,6 +388,82 @@ static std::vector<uint8_t>& convert_dma_hexlet(std::vector<uint8_t>& source,
     return dest;
 }
 
+#ifdef HAS_SSSE3_CONVERSION
+// Drops the alpha channel of 4 pixels at a time using pshufb. Returns the
+// number of pixels that were converted, the caller is responsible for the
+// remainder. Safe to use in place.
+__attribute__((target("ssse3"))) static size_t convert_rgba_rgb_ssse3(
+        const uint8_t* src,
+        uint8_t* dst,
+        size_t pixels) {
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13,
+                                          14, -1, -1, -1, -1);
+    size_t converted = 0;
+    // Every iteration writes 16 bytes, of which only 12 are valid. The 4
+    // garbage bytes are overwritten by the next iteration, as long as we
+    // stay 16 bytes away from the end of the buffer.
+    while (converted + 4 < pixels) {
+        __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                         _mm_shuffle_epi8(rgba, shuffle));
+        src += 16;
+        dst += 12;
+        converted += 4;
+    }
+    return converted;
+}
+#endif
+
+#ifdef HAS_NEON_CONVERSION
+// Drops the alpha channel of 16 pixels at a time using a de-interleaving load
+// and interleaving store. Returns the number of pixels that were converted.
+// Safe to use in place.
+static size_t convert_rgba_rgb_neon(const uint8_t* src,
+                                    uint8_t* dst,
+                                    size_t pixels) {
+    size_t converted = 0;
+    while (converted + 16 <= pixels) {
+        uint8x16x4_t rgba = vld4q_u8(src);
+        uint8x16x3_t rgb = {{rgba.val[0], rgba.val[1], rgba.val[2]}};
+        vst3q_u8(dst, rgb);
+        src += 64;
+        dst += 48;
+        converted += 16;
+    }
+    return converted;
+}
+#endif
+
+// Converts RGBA8888 -> RGB888 with the fastest available vector unit,
+// returns false if no vectorized implementation is available on this host.
+static bool convert_dma_simd(std::vector<uint8_t>& pixels) {
+    const size_t count = pixels.size() / 4;
+    size_t done = 0;
+#if defined(HAS_SSSE3_CONVERSION)
+    static const bool hasSsse3 = __builtin_cpu_supports("ssse3");
+    if (!hasSsse3) {
+        return false;
+    }
+    done = convert_rgba_rgb_ssse3(pixels.data(), pixels.data(), count);
+#elif defined(HAS_NEON_CONVERSION)
+    done = convert_rgba_rgb_neon(pixels.data(), pixels.data(), count);
+#else
+    return false;
+#endif
+    // Convert the remaining pixels one at a time.
+    const uint8_t* src = pixels.data() + done * 4;
+    uint8_t* dst = pixels.data() + done * 3;
+    for (size_t i = done; i < count; i++) {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        src += 4;
+        dst += 3;
+    }
+    pixels.resize(count * 3);
+    return true;
+}
+
 void Image::convertPerByte() {
     convert_dma_byte(m_Pixels, m_Pixels);
 }
@@ -392,6 +479,10 @@ Image& Image::asRGB888() {
     }
 
     m_Format = ImageFormat::RGB888;
+    if (convert_dma_simd(m_Pixels)) {
+        return *this;
+    }
+
     // Let's just use the slow, default approach when
     // When we are not little endian.
     if (is_big_endian() || sizeof(__uint128_t) != 16) {
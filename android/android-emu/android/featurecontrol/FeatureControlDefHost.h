@@ -68,3 +68,6 @@ FEATURE_CONTROL_ITEM(BptcTextureSupport)
 FEATURE_CONTROL_ITEM(GuestUsesAngle)
 FEATURE_CONTROL_ITEM(S3tcTextureSupport)
 FEATURE_CONTROL_ITEM(NoDraw)
+FEATURE_CONTROL_ITEM(SharedImageCache)
+FEATURE_CONTROL_ITEM(AdaptiveQcow2Cache)
+FEATURE_CONTROL_ITEM(FilePushPipe)
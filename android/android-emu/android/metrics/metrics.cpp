@@ -479,6 +479,12 @@ static android_studio::EmulatorFeatureFlagState::EmulatorFeatureFlag toClearcutF
             return android_studio::EmulatorFeatureFlagState::MINIGBM;
         case android::featurecontrol::NoDraw:
             return android_studio::EmulatorFeatureFlagState::NO_DRAW;
+        case android::featurecontrol::SharedImageCache:
+            return android_studio::EmulatorFeatureFlagState::SHARED_IMAGE_CACHE;
+        case android::featurecontrol::AdaptiveQcow2Cache:
+            return android_studio::EmulatorFeatureFlagState::ADAPTIVE_QCOW2_CACHE;
+        case android::featurecontrol::FilePushPipe:
+            return android_studio::EmulatorFeatureFlagState::FILE_PUSH_PIPE;
     }
     return android_studio::EmulatorFeatureFlagState::EMULATOR_FEATURE_FLAG_UNSPECIFIED;
 }
@@ -52,6 +52,7 @@
 #include "android/emulation/control/window_agent.h"           // for gQAndro...
 #include "android/featurecontrol/FeatureControl.h"            // for isEnabled
 #include "android/featurecontrol/Features.h"                  // for MultiDi...
+#include "android/filepush-pipe.h"                            // for android...
 #include "android/globals.h"                                  // for android...
 #include "android/hw-fingerprint.h"                           // for android...
 #include "android/hw-sensors.h"                               // for android...
@@ -435,6 +436,8 @@ bool android_emulation_setup(const AndroidConsoleAgents* agents, bool isQemu2) {
 
     android_init_clipboard_pipe();
     android_init_logcat_pipe();
+    if (fc::isEnabled(fc::FilePushPipe))
+        android_init_filepush_pipe();
     if (fc::isEnabled(fc::RefCountPipe))
         android_init_refcount_pipe();
     if (fc::isEnabled(fc::WifiConfigurable)) {
@@ -36,11 +36,14 @@
 #include "android/base/Log.h"                   // for LogStream, LogMessage
 #include "android/base/memory/ScopedPtr.h"      // for FuncDelete
 #include "android/base/synchronization/Lock.h"  // for Lock, AutoLock
+#include "android/base/synchronization/MessageChannel.h"  // for MessageCh...
 #include "android/base/system/System.h"         // for System
+#include "android/base/threads/FunctorThread.h"  // for FunctorThread
 #include "android/recording/AVScopedPtr.h"      // for makeAVScopedPtr
 #include "android/recording/Frame.h"            // for Frame, AVFormat, getV...
 #include "android/recording/Producer.h"         // for Producer
 #include "android/recording/codecs/Codec.h"     // for Codec, CodecParams
+#include "android/recording/video/TiledFrameConverter.h"  // for TiledFram...
 #include "android/utils/debug.h"                // for VERBOSE_record, VERBO...
 
 extern "C" {
@@ -73,8 +76,11 @@ struct SwsContext;
 #include <stdarg.h>                             // for va_list
 #include <stdio.h>                              // for vprintf, NULL
 #include <string.h>                             // for memcpy
+#include <algorithm>                            // for max, min
+#include <atomic>                               // for atomic
 #include <cstdint>                              // for uint8_t
 #include <functional>                           // for __base
+#include <memory>                               // for unique_ptr
 #include <string>                               // for string, basic_string
 #include <utility>                              // for move
 #include <vector>                               // for vector
@@ -85,20 +91,67 @@ namespace android {
 namespace recording {
 
 using android::base::AutoLock;
+using android::base::FunctorThread;
 using android::base::Lock;
+using android::base::MessageChannel;
 using android::base::PathUtils;
 
 namespace {
 
+// Converted video frames that are waiting for the encoder, at most. Frames
+// that come in while the encoder is this far behind are dropped.
+constexpr size_t kMaxQueuedVideoFrames = 2;
+// One more is being encoded.
+constexpr size_t kVideoFramesInFlight = kMaxQueuedVideoFrames + 1;
+
+// Time spent in a stage of the video pipeline.
+struct StageLatency {
+    uint64_t count = 0;
+    uint64_t totalUs = 0;
+    uint64_t maxUs = 0;
+
+    void add(uint64_t us) {
+        ++count;
+        totalUs += us;
+        maxUs = std::max(maxUs, us);
+    }
+    uint64_t avgUs() const { return count ? totalUs / count : 0; }
+};
+
+// The video frames go through:
+// - the producer, which grabs them and hands them over from its own thread,
+// - the conversion to the encoder format, on the producer thread,
+// - the encoding and muxing, on the encoder thread.
+struct VideoPipelineStats {
+    StageLatency grab;     // Grabbed until converted.
+    StageLatency convert;
+    StageLatency queue;    // Converted until the encoder takes it.
+    StageLatency encode;   // Including the muxing.
+    std::atomic<uint64_t> dropped{0};
+};
+
 // a wrapper around a single output AVStream
 struct VideoOutputStream {
     // These two pointers are owned by the output context
     AVStream* stream = nullptr;
     AVScopedPtr<AVCodecContext> codecCtx;
-    AVScopedPtr<AVFrame> frame;
+    // Frames in the encoder format, passed between the converter and the
+    // encoder through |freeFrames| and |encodeQueue|.
+    AVScopedPtr<AVFrame> frames[kVideoFramesInFlight];
     AVScopedPtr<AVFrame> tmpFrame;
     AVScopedPtr<SwsContext> swsCtx;
+    std::unique_ptr<TiledFrameConverter> converter;
+
+    struct QueuedFrame {
+        AVFrame* frame;
+        uint64_t queuedUs;
+    };
+    MessageChannel<AVFrame*, kVideoFramesInFlight> freeFrames;
+    // A null frame stops the encoder thread.
+    MessageChannel<QueuedFrame, kVideoFramesInFlight + 1> encodeQueue;
+    std::unique_ptr<FunctorThread> encoder;
 
+    VideoPipelineStats stats;
     uint64_t frameCount = 0;
     uint64_t writeFrameCount = 0;
 };
@@ -133,6 +186,7 @@ public:
     virtual bool isValid() override;
     virtual bool start() override;
     virtual bool stop() override;
+    virtual uint64_t droppedVideoFrames() override;
 
     virtual bool addAudioTrack(
             std::unique_ptr<Producer> producer,
@@ -154,6 +208,11 @@ private:
     bool encodeAudioFrame(const Frame* audioFrame);
     bool encodeVideoFrame(const Frame* videoFrame);
 
+    // The video encoder thread, and how to stop it once the video producer
+    // is done.
+    void videoEncoderLoop();
+    void stopVideoEncoder();
+
     // Interleave the packets
     bool writeFrame(const AVCodecContext* c, AVStream* stream, AVPacket* pkt);
 
@@ -332,6 +391,11 @@ bool FfmpegRecorderImpl::start() {
     mStarted = true;
     mStartTimeUs = android::base::System::get()->getHighResTimeUs();
 
+    mVideoStream.encoder.reset(new FunctorThread([this] {
+        videoEncoderLoop();
+        return 0;
+    }));
+    mVideoStream.encoder->start();
     mVideoProducer->start();
     if (mHasAudioTrack) {
         // The audio track add may have failed, so don't start
@@ -353,10 +417,38 @@ void FfmpegRecorderImpl::abortRecording() {
     }
     mVideoProducer->stop();
     mVideoProducer->wait();
+    stopVideoEncoder();
 
     mValid = false;
 }
 
+void FfmpegRecorderImpl::stopVideoEncoder() {
+    VideoOutputStream* ost = &mVideoStream;
+    if (!ost->encoder) {
+        return;
+    }
+    // Behind the frames still queued, which get encoded first.
+    ost->encodeQueue.send({nullptr, 0});
+    ost->encoder->wait();
+    ost->encoder.reset();
+
+    const auto& stats = ost->stats;
+    auto logStage = [](const char* name, const StageLatency& stage) {
+        VLOG(record) << name << ": " << stage.count << " frames, avg "
+                     << stage.avgUs() << " us, max " << stage.maxUs << " us";
+    };
+    logStage("Video grab", stats.grab);
+    logStage("Video convert", stats.convert);
+    logStage("Video queue", stats.queue);
+    logStage("Video encode", stats.encode);
+    if (stats.dropped > 0) {
+        const uint64_t dropped = stats.dropped;
+        LOG(WARNING) << "Dropped " << dropped << " of "
+                     << dropped + stats.convert.count
+                     << " video frames, the encoder could not keep up";
+    }
+}
+
 bool FfmpegRecorderImpl::stop() {
     assert(mValid);
 
@@ -371,6 +463,7 @@ bool FfmpegRecorderImpl::stop() {
     }
     mVideoProducer->stop();
     mVideoProducer->wait();
+    stopVideoEncoder();
 
     // flush video encoding with a NULL frame
     if (mHasVideoTrack) {
@@ -451,6 +544,10 @@ bool FfmpegRecorderImpl::stop() {
     return mHasVideoFrames;
 }
 
+uint64_t FfmpegRecorderImpl::droppedVideoFrames() {
+    return mVideoStream.stats.dropped;
+}
+
 bool FfmpegRecorderImpl::addAudioTrack(
         std::unique_ptr<Producer> producer,
         const Codec<SwrContext>* codec) {
@@ -633,13 +730,16 @@ bool FfmpegRecorderImpl::addVideoTrack(
         return false;
     }
 
-    // allocate and init a re-usable frame
-    auto frame = allocVideoFrame(c->pix_fmt, c->width, c->height);
-    if (!frame) {
-        LOG(ERROR) << "Could not allocate video frame";
-        return false;
+    // allocate and init the re-usable frames
+    for (auto& frame : ost->frames) {
+        auto avframe = allocVideoFrame(c->pix_fmt, c->width, c->height);
+        if (!avframe) {
+            LOG(ERROR) << "Could not allocate video frame";
+            return false;
+        }
+        frame = makeAVScopedPtr(avframe);
+        ost->freeFrames.send(avframe);
     }
-    mVideoStream.frame = makeAVScopedPtr(frame);
 
     // If the output format is not YUV420P, then a temporary YUV420P
     // picture is needed too. It is then converted to the required
@@ -662,6 +762,22 @@ bool FfmpegRecorderImpl::addVideoTrack(
     }
     ost->swsCtx = makeAVScopedPtr(swsCtx);
 
+    // The common case of an unscaled framebuffer going to YUV420P is
+    // converted without sws_scale(), on a few threads.
+    const auto format = mVideoProducer->getFormat().videoFormat;
+    if (c->pix_fmt == AV_PIX_FMT_YUV420P &&
+        TiledFrameConverter::canConvert(format, mFbWidth, mFbHeight, c->width,
+                                        c->height)) {
+        // Leave the other cores to the encoder and the guest.
+        const int threads = std::max(
+                1, std::min(4, android::base::System::get()->getCpuCoreCount() /
+                                       2));
+        ost->converter.reset(
+                new TiledFrameConverter(mFbWidth, mFbHeight, format, threads));
+        VLOG(record) << "Converting video frames on "
+                     << ost->converter->threads() << " threads";
+    }
+
     mHasVideoTrack = true;
     return true;
 }
@@ -742,28 +858,60 @@ bool FfmpegRecorderImpl::encodeVideoFrame(const Frame* frame) {
 
     VideoOutputStream* ost = &mVideoStream;
 
-    const int linesize[1] = {getVideoFormatSize(frame->format.videoFormat) *
-                             mFbWidth};
+    AVFrame* avframe = nullptr;
+    if (!ost->freeFrames.tryReceive(&avframe)) {
+        // The encoder is behind. Drop this frame rather than block the
+        // producer, which would then grab the next ones late as well.
+        ++ost->stats.dropped;
+        VLOG(record) << "Dropping video frame, the encoder is behind";
+        return true;
+    }
+
+    auto system = android::base::System::get();
+    auto startUs = system->getHighResTimeUs();
+    if (startUs > frame->tsUs) {
+        ost->stats.grab.add(startUs - frame->tsUs);
+    }
 
-    // To test the speed of sws_scale()
-    auto startUs = android::base::System::get()->getHighResTimeUs();
     auto data = frame->dataVec.data();
-    sws_scale(ost->swsCtx.get(), (const uint8_t* const*)&data, linesize, 0,
-              mFbHeight, ost->frame->data, ost->frame->linesize);
-    VLOG(record)
-            << "Time to sws_scale: ["
-            << (long long)(android::base::System::get()->getHighResTimeUs() -
-                           startUs) /
-                       1000
-            << " ms]";
+    if (ost->converter) {
+        ost->converter->convert(data, avframe->data, avframe->linesize);
+    } else {
+        const int linesize[1] = {
+                getVideoFormatSize(frame->format.videoFormat) * mFbWidth};
+        sws_scale(ost->swsCtx.get(), (const uint8_t* const*)&data, linesize,
+                  0, mFbHeight, avframe->data, avframe->linesize);
+    }
+    auto convertedUs = system->getHighResTimeUs();
+    ost->stats.convert.add(convertedUs - startUs);
+    VLOG(record) << "Time to convert: [" << (convertedUs - startUs) / 1000
+                 << " ms]";
 
     uint64_t elapsedUS = frame->tsUs - mStartTimeUs;
-    ost->frame->pts = (int64_t)(elapsedUS);
+    avframe->pts = (int64_t)(elapsedUS);
 
-    bool ret = writeVideoFrame(ost->frame.get());
-    mHasVideoFrames = true;
+    // Never blocks, there is room for every frame in flight.
+    ost->encodeQueue.send({avframe, convertedUs});
+    return true;
+}
 
-    return ret;
+void FfmpegRecorderImpl::videoEncoderLoop() {
+    VideoOutputStream* ost = &mVideoStream;
+    auto system = android::base::System::get();
+    for (;;) {
+        VideoOutputStream::QueuedFrame queued;
+        if (!ost->encodeQueue.receive(&queued) || !queued.frame) {
+            break;
+        }
+        auto startUs = system->getHighResTimeUs();
+        ost->stats.queue.add(startUs - queued.queuedUs);
+
+        writeVideoFrame(queued.frame);
+        mHasVideoFrames = true;
+
+        ost->stats.encode.add(system->getHighResTimeUs() - startUs);
+        ost->freeFrames.send(queued.frame);
+    }
 }
 
 bool FfmpegRecorderImpl::writeFrame(const AVCodecContext* c, AVStream* stream, AVPacket* pkt) {
@@ -986,7 +1134,10 @@ void FfmpegRecorderImpl::closeAudioContext() {
 
 void FfmpegRecorderImpl::closeVideoContext() {
     mVideoStream.codecCtx.reset();
-    mVideoStream.frame.reset();
+    for (auto& frame : mVideoStream.frames) {
+        frame.reset();
+    }
+    mVideoStream.converter.reset();
     mVideoStream.tmpFrame.reset();
     mVideoStream.swsCtx.reset();
 }
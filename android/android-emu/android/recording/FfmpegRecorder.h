@@ -78,6 +78,10 @@ public:
     // to an invalid state.
     virtual bool stop() = 0;
 
+    // Returns how many video frames were dropped so far, because the encoder
+    // was too far behind to take them.
+    virtual uint64_t droppedVideoFrames() = 0;
+
     // Add an audio track.
     // params:
     //   producer - The audio producer. The recorder will take ownership of the
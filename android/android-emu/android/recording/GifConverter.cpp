@@ -34,20 +34,26 @@
 #include "android/recording/GifConverter.h"
 
 #include <stddef.h>                         // for NULL
-#include <errno.h>                          // for ENOMEM
+#include <stdio.h>                          // for FILE
+
+#include <algorithm>                        // for max, min
+#include <memory>                           // for unique_ptr
+#include <vector>                           // for vector
 
 #include "android/base/Log.h"               // for LOG, LogMessage, LogStream
-#include "android/base/memory/ScopedPtr.h"  // for FuncDelete
+#include "android/base/files/StdioStream.h"  // for StdioStream
+#include "android/base/system/System.h"     // for System
+#include "android/base/threads/ParallelFor.h"  // for ParallelFor
 #include "android/recording/AVScopedPtr.h"  // for makeAVScopedPtr
+#include "android/recording/GifEncoder.h"   // for GifPalette, GifFrame, Gif...
+#include "android/utils/file_io.h"          // for android_fopen
+#include "libyuv/convert_argb.h"            // for I420ToABGR
 
 extern "C" {
 #include <libavcodec/avcodec.h>             // for AVCodecContext, AVPacket
 #include <libavformat/avformat.h>           // for AVStream, AVFormatContext
-#include <libavformat/avio.h>               // for avio_open, AVIO_FLAG_WRITE
 #include <libavutil/avutil.h>               // for AVMEDIA_TYPE_VIDEO
-#include <libavutil/error.h>                // for AVERROR, AVERROR_EOF
 #include <libavutil/frame.h>                // for AVFrame, av_frame_alloc
-#include <libavutil/log.h>                  // for av_log, AV_LOG_INFO
 #include <libavutil/mathematics.h>          // for av_rescale_q
 #include <libavutil/pixfmt.h>               // for AVPixelFormat
 #include <libavutil/rational.h>             // for AVRational
@@ -55,62 +61,101 @@ extern "C" {
 struct SwsContext;
 }
 
-#include <memory>                           // for unique_ptr
-
 static constexpr int SCALE_FLAGS = SWS_BICUBIC;
 
 namespace android {
 namespace recording {
 
+using android::base::ParallelFor;
+using android::base::StdioStream;
+using android::base::System;
+
 namespace {
 
+// Frames are decoded in batches of one per thread, then mapped and encoded
+// together. Each one holds an RGBA copy of the screen until then.
+constexpr int kMaxThreads = 8;
+// How often the palette samples the video, and which of the pixels.
+constexpr int64_t kSampleIntervalCs = 50;
+constexpr int kSampleStep = 2;
+// Browsers slow down anything faster than this to 10 cs a frame.
+constexpr int kMinDelayCs = 2;
+constexpr AVRational kCentiseconds = {1, 100};
+
+// A decoded frame on its way to the GIF.
+struct Slot {
+    AVScopedPtr<AVFrame> decoded;
+    // Whether |decoded| is still to be converted to |rgba|.
+    bool decodedOnly = false;
+    std::vector<uint8_t> rgba;
+    std::vector<uint8_t> indices;
+    GifFrame encoded;
+    int64_t timeCs = 0;
+};
+
 class GifConverterImpl {
 public:
     explicit GifConverterImpl(android::base::StringView inFilename,
-                              android::base::StringView outFilename,
-                              uint32_t bitrate);
+                              android::base::StringView outFilename);
     bool run();
 
 private:
     bool initialize(android::base::StringView inFilename,
-                    android::base::StringView outFilename,
-                    uint32_t bitrate);
+                    android::base::StringView outFilename);
 
     bool initInputContext(android::base::StringView inFilename);
-    bool initOutputContext(android::base::StringView outFilename,
-                           uint32_t bitrate);
-    bool initConversionContext();
+    bool initOutputFile(android::base::StringView outFilename);
 
     bool getNextVideoPacket(AVPacket* pkt);
-
-    int encodeWriteFrame(AVFrame* filt_frame, int* got_frame);
-    int flushEncoder();
+    // Decodes the next frame into |frame|. Returns false after the last
+    // one, or on error.
+    bool decodeNextFrame(AVFrame* frame);
+    bool rewind();
+    // The time of |frame|, after |lastCs|.
+    int64_t frameTimeCs(const AVFrame* frame, int64_t lastCs) const;
+
+    // Fills |slot->rgba| from |slot->decoded|. Only safe off the decoding
+    // thread for YUV420P frames, as it uses |mSwsContext| otherwise.
+    bool toRgba(Slot* slot);
+    bool buildPalette();
+    bool encodeBatch(int count);
+    bool writePending(int64_t endCs);
 
 private:
     bool mIsValid = false;
+    bool mDraining = false;
+    bool mDecodeFailed = false;
     AVScopedPtr<AVFormatContext> mInputContext;
-    AVScopedPtr<AVFormatContext> mOutputContext;
     AVScopedPtr<SwsContext> mSwsContext;
     AVCodecContext* mInVideoCodecCxt = nullptr;
-    AVCodecContext* mOutVideoCodecCxt = nullptr;
-    AVStream* mOutputStream = nullptr;
     int mVideoStreamIndex = -1;
+    int mWidth = 0;
+    int mHeight = 0;
+
+    std::unique_ptr<StdioStream> mOutput;
+    std::unique_ptr<GifWriter> mWriter;
+    GifPalette mPalette;
+    std::unique_ptr<ParallelFor> mParallel;
+
+    std::vector<Slot> mSlots;
+    // What the last frame written left on screen.
+    std::vector<uint8_t> mShown;
+    bool mHasShown = false;
+    GifFrame mPending;
+    int64_t mPendingCs = 0;
 };
 
 GifConverterImpl::GifConverterImpl(android::base::StringView inFilename,
-                                   android::base::StringView outFilename,
-                                   uint32_t bitrate) {
-    mIsValid = initialize(inFilename, outFilename, bitrate);
+                                   android::base::StringView outFilename) {
+    mIsValid = initialize(inFilename, outFilename);
 }
 
 bool GifConverterImpl::initialize(android::base::StringView inFilename,
-                                  android::base::StringView outFilename,
-                                  uint32_t bitrate) {
+                                  android::base::StringView outFilename) {
     // Initialize libavcodec, and register all codecs and formats. does not hurt
     // to register multiple times
     av_register_all();
-    return initInputContext(inFilename) &&
-           initOutputContext(outFilename, bitrate);
+    return initInputContext(inFilename) && initOutputFile(outFilename);
 }
 
 bool GifConverterImpl::initInputContext(android::base::StringView inFilename) {
@@ -141,6 +186,11 @@ bool GifConverterImpl::initInputContext(android::base::StringView inFilename) {
 
         if (codec_ctx->codec_type == AVMEDIA_TYPE_VIDEO) {
             codec_ctx->strict_std_compliance = FF_COMPLIANCE_EXPERIMENTAL;
+            // Decode several frames at once, and keep them past the next
+            // call, for the pool to convert.
+            codec_ctx->thread_count =
+                    std::min(kMaxThreads, System::get()->getCpuCoreCount());
+            codec_ctx->refcounted_frames = 1;
             // Open decoder
             ret = avcodec_open2(
                     codec_ctx, avcodec_find_decoder(codec_ctx->codec_id), NULL);
@@ -157,92 +207,200 @@ bool GifConverterImpl::initInputContext(android::base::StringView inFilename) {
         LOG(ERROR) << "Cannot find video stream";
         return false;
     }
+    mWidth = mInVideoCodecCxt->width;
+    mHeight = mInVideoCodecCxt->height;
 
     return true;
 }
 
-bool GifConverterImpl::initOutputContext(android::base::StringView outFilename,
-                                         uint32_t bitrate) {
+bool GifConverterImpl::initOutputFile(android::base::StringView outFilename) {
     auto outFilenameValidated = android::base::c_str(outFilename);
 
     // open the output gif file
-    AVFormatContext* ofmt_ctx = nullptr;
-    avformat_alloc_output_context2(&ofmt_ctx, nullptr, nullptr,
-                                   outFilenameValidated);
-    if (ofmt_ctx == nullptr) {
-        LOG(ERROR) << "Could not create output context for ["
-                   << outFilenameValidated << "]";
-        return false;
-    }
-    mOutputContext = makeAVScopedPtr(ofmt_ctx);
-
-    AVStream* out_stream = avformat_new_stream(mOutputContext.get(), nullptr);
-    if (out_stream == NULL) {
-        LOG(ERROR) << "Failed allocating output stream";
+    FILE* file = android_fopen(outFilenameValidated, "wb");
+    if (file == nullptr) {
+        LOG(ERROR) << "Could not open output file [" << outFilenameValidated
+                   << "]";
         return false;
     }
-    mOutputStream = out_stream;
+    mOutput.reset(new StdioStream(file, StdioStream::kOwner));
+    mWriter.reset(new GifWriter(mOutput.get()));
+    return true;
+}
 
-    AVCodec* encoder = avcodec_find_encoder(AV_CODEC_ID_GIF);
-    if (encoder == nullptr) {
-        LOG(ERROR) << "GIF encoder not found";
-        return false;
+bool GifConverterImpl::getNextVideoPacket(AVPacket* pkt) {
+    // Get next video packet
+    while (av_read_frame(mInputContext.get(), pkt) >= 0) {
+        if (pkt->stream_index == mVideoStreamIndex) {
+            return true;
+        }
+        // Ignore audio packets
+        av_packet_unref(pkt);
     }
 
-    AVCodecContext* enc_ctx = mOutputStream->codec;
+    return false;
+}
 
-    if ((encoder->capabilities & CODEC_CAP_EXPERIMENTAL) != 0) {
-        enc_ctx->strict_std_compliance = FF_COMPLIANCE_EXPERIMENTAL;
+bool GifConverterImpl::decodeNextFrame(AVFrame* frame) {
+    int gotFrame = 0;
+    while (!mDraining) {
+        AVPacket packet = {0};
+        av_init_packet(&packet);
+        if (!getNextVideoPacket(&packet)) {
+            mDraining = true;
+            break;
+        }
+        int ret = avcodec_decode_video2(mInVideoCodecCxt, frame, &gotFrame,
+                                        &packet);
+        av_packet_unref(&packet);
+        if (ret < 0) {
+            LOG(ERROR) << "Decoding failed";
+            mDecodeFailed = true;
+            return false;
+        }
+        if (gotFrame) {
+            return true;
+        }
     }
 
-    enc_ctx->height = mInVideoCodecCxt->height;
-    enc_ctx->width = mInVideoCodecCxt->width;
-    enc_ctx->bit_rate = bitrate;
-    enc_ctx->sample_aspect_ratio = mInVideoCodecCxt->sample_aspect_ratio;
-    // take first format from list of supported formats, which should be
-    // AV_PIX_FMT_RGB8
-    enc_ctx->pix_fmt = encoder->pix_fmts[0];
-    enc_ctx->time_base = mInVideoCodecCxt->time_base;
-
-    int ret = avcodec_open2(enc_ctx, encoder, NULL);
-    if (ret < 0) {
-        LOG(ERROR) << "Cannot open video encoder for GIF";
+    // The decoder threads may still hold a few frames.
+    AVPacket packet = {0};
+    av_init_packet(&packet);
+    packet.data = nullptr;
+    packet.size = 0;
+    return avcodec_decode_video2(mInVideoCodecCxt, frame, &gotFrame,
+                                 &packet) >= 0 &&
+           gotFrame;
+}
+
+bool GifConverterImpl::rewind() {
+    if (av_seek_frame(mInputContext.get(), mVideoStreamIndex, 0,
+                      AVSEEK_FLAG_BACKWARD) < 0) {
+        LOG(ERROR) << "Could not seek back to the first frame";
         return false;
     }
-    mOutVideoCodecCxt = enc_ctx;
+    avcodec_flush_buffers(mInVideoCodecCxt);
+    mDraining = false;
+    return true;
+}
 
-    if (mOutputContext->oformat->flags & AVFMT_GLOBALHEADER)
-        enc_ctx->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+int64_t GifConverterImpl::frameTimeCs(const AVFrame* frame,
+                                      int64_t lastCs) const {
+    const int64_t pts = av_frame_get_best_effort_timestamp(frame);
+    if (pts == AV_NOPTS_VALUE) {
+        return lastCs + 1;
+    }
+    // correct invalid pts in the rare cases
+    return std::max(
+            lastCs + 1,
+            av_rescale_q(pts,
+                         mInputContext->streams[mVideoStreamIndex]->time_base,
+                         kCentiseconds));
+}
 
-    av_dump_format(mOutputContext.get(), 0, outFilenameValidated, 1);
+bool GifConverterImpl::toRgba(Slot* slot) {
+    AVFrame* frame = slot->decoded.get();
+    slot->rgba.resize(size_t(mWidth) * mHeight * 4);
+    if (frame->format == AV_PIX_FMT_YUV420P) {
+        // libyuv's ABGR is RGBA in memory.
+        libyuv::I420ToABGR(frame->data[0], frame->linesize[0], frame->data[1],
+                           frame->linesize[1], frame->data[2],
+                           frame->linesize[2], slot->rgba.data(), mWidth * 4,
+                           mWidth, mHeight);
+        return true;
+    }
 
-    if (!(mOutputContext->oformat->flags & AVFMT_NOFILE)) {
-        ret = avio_open(&mOutputContext->pb, outFilenameValidated,
-                        AVIO_FLAG_WRITE);
-        if (ret < 0) {
-            LOG(ERROR) << "Could not open output file [" << outFilenameValidated
-                       << "]";
+    if (!mSwsContext) {
+        SwsContext* sws_ctx = sws_getContext(
+                mWidth, mHeight, AVPixelFormat(frame->format), mWidth,
+                mHeight, AV_PIX_FMT_RGBA, SCALE_FLAGS, nullptr, nullptr,
+                nullptr);
+        if (sws_ctx == nullptr) {
+            LOG(ERROR) << "Could not initialize the conversion context";
             return false;
         }
+        mSwsContext = makeAVScopedPtr(sws_ctx);
     }
+    uint8_t* const dst[1] = {slot->rgba.data()};
+    const int dstStride[1] = {mWidth * 4};
+    sws_scale(mSwsContext.get(), frame->data, frame->linesize, 0, mHeight,
+              dst, dstStride);
+    return true;
+}
 
+bool GifConverterImpl::buildPalette() {
+    // The palette covers the whole video, so the frames can share it and
+    // their unchanged parts stay unchanged.
+    Slot slot;
+    slot.decoded = makeAVScopedPtr(av_frame_alloc());
+    int64_t lastCs = -1;
+    int64_t nextSampleCs = 0;
+    while (decodeNextFrame(slot.decoded.get())) {
+        lastCs = frameTimeCs(slot.decoded.get(), lastCs);
+        if (lastCs >= nextSampleCs) {
+            if (!toRgba(&slot)) {
+                return false;
+            }
+            mPalette.addSample(slot.rgba.data(), mWidth, mHeight, mWidth * 4,
+                               kSampleStep);
+            nextSampleCs = lastCs + kSampleIntervalCs;
+        }
+        av_frame_unref(slot.decoded.get());
+    }
+    if (mDecodeFailed) {
+        return false;
+    }
+    mPalette.build();
+    VLOG(record) << "GIF palette of " << mPalette.size() << " colors";
     return true;
 }
 
-bool GifConverterImpl::getNextVideoPacket(AVPacket* pkt) {
-    // Get next video packet
-    while (av_read_frame(mInputContext.get(), pkt) >= 0) {
-        if (pkt->stream_index != mVideoStreamIndex) {
-            // Ignore audio packets
+bool GifConverterImpl::writePending(int64_t endCs) {
+    const int delayCs =
+            int(std::max<int64_t>(kMinDelayCs, endCs - mPendingCs));
+    const bool ok = mWriter->writeFrame(mPending, delayCs);
+    mPending = GifFrame();
+    return ok;
+}
+
+bool GifConverterImpl::encodeBatch(int count) {
+    // Frames only depend on the one before once they are mapped.
+    mParallel->forEach(count, [this](int i) {
+        Slot& slot = mSlots[i];
+        if (slot.decodedOnly) {
+            toRgba(&slot);
+            av_frame_unref(slot.decoded.get());
+        }
+        slot.indices.resize(size_t(mWidth) * mHeight);
+        mPalette.map(slot.rgba.data(), mWidth, mHeight, mWidth * 4,
+                     slot.indices.data());
+    });
+    mParallel->forEach(count, [this](int i) {
+        const uint8_t* previous = nullptr;
+        if (i > 0) {
+            previous = mSlots[i - 1].indices.data();
+        } else if (mHasShown) {
+            previous = mShown.data();
+        }
+        mSlots[i].encoded = encodeGifFrame(mSlots[i].indices.data(), previous,
+                                           mWidth, mHeight);
+    });
+
+    for (int i = 0; i < count; ++i) {
+        Slot& slot = mSlots[i];
+        if (slot.encoded.empty()) {
+            // The frame on screen stays there longer.
             continue;
         }
-        av_packet_rescale_ts(
-                pkt, mInputContext->streams[mVideoStreamIndex]->time_base,
-                mInputContext->streams[mVideoStreamIndex]->codec->time_base);
-        return true;
+        if (!mPending.empty() && !writePending(slot.timeCs)) {
+            return false;
+        }
+        mPending = std::move(slot.encoded);
+        mPendingCs = slot.timeCs;
     }
-
-    return false;
+    mShown.swap(mSlots[count - 1].indices);
+    mHasShown = true;
+    return true;
 }
 
 bool GifConverterImpl::run() {
@@ -251,196 +409,74 @@ bool GifConverterImpl::run() {
         return false;
     }
 
-    // init muxer, write output file header
-    int ret = avformat_write_header(mOutputContext.get(), nullptr);
-    if (ret < 0) {
-        LOG(ERROR) << "Error occurred in avformat_write_header()";
+    const int threads =
+            std::min(kMaxThreads, System::get()->getCpuCoreCount());
+    mParallel.reset(new ParallelFor(threads));
+
+    if (!buildPalette() || !rewind() ||
+        !mWriter->writeHeader(mWidth, mHeight, mPalette)) {
         return false;
     }
 
-    SwsContext* sws_ctx = nullptr;
-    if (mInVideoCodecCxt->pix_fmt != mOutVideoCodecCxt->pix_fmt) {
-        sws_ctx = sws_getContext(mOutVideoCodecCxt->width, mOutVideoCodecCxt->height,
-                                 mInVideoCodecCxt->pix_fmt, mOutVideoCodecCxt->width,
-                                 mOutVideoCodecCxt->height,
-                                 /*AV_PIX_FMT_RGBA*/ mOutVideoCodecCxt->pix_fmt,
-                                 SCALE_FLAGS, nullptr, nullptr, nullptr);
-        if (sws_ctx == nullptr) {
-            LOG(ERROR) << "Could not initialize the conversion context";
-            return false;
-        }
+    // read all packets, decode, then map and encode a batch of frames at a
+    // time on all the threads
+    mSlots.resize(threads);
+    for (auto& slot : mSlots) {
+        slot.decoded = makeAVScopedPtr(av_frame_alloc());
     }
-    mSwsContext = makeAVScopedPtr(sws_ctx);
-
-    // read all packets, decode, convert, then encode to gif format
-    int64_t last_pts = -1;
-    int got_frame;
-    AVPacket packet = {0};
-    while (getNextVideoPacket(&packet)) {
-        auto pPacket = makeAVScopedPtr(&packet);
-        // for GIF, it seems we can't use a shared frame, so we have to alloc
-        // it here inside the loop
-        AVFrame* frame = av_frame_alloc();
-        if (!frame) {
-            ret = AVERROR(ENOMEM);
-            break;
-        }
-        auto pFrame = makeAVScopedPtr(frame);
-
-        ret = avcodec_decode_video2(
-                mInputContext->streams[mVideoStreamIndex]->codec, pFrame.get(),
-                &got_frame, &packet);
-        if (ret < 0) {
-            LOG(ERROR) << "Decoding failed";
+    int64_t lastCs = -1;
+    int count = 0;
+    bool ok = true;
+    for (;;) {
+        Slot& slot = mSlots[count];
+        if (!decodeNextFrame(slot.decoded.get())) {
             break;
         }
-
-        ret = 0;
-        if (got_frame) {
-            // Rescale pts to codec timebase
-            pFrame->pts = av_frame_get_best_effort_timestamp(pFrame.get());
-            // correct invalid pts in the rare cases
-
-            // Need to check the scaled value if the output time_base has a
-            // smaller resolution than the input time_base
-            if (mOutputContext->streams[mVideoStreamIndex]
-                        ->codec->time_base.den >
-                mOutputContext->streams[mVideoStreamIndex]->time_base.den) {
-                int64_t last_scaled_pts = -1;
-                int64_t scaled_pts = av_rescale_q(
-                        pFrame->pts,
-                        mOutputContext->streams[mVideoStreamIndex]
-                                ->codec->time_base,
-                        mOutputContext->streams[mVideoStreamIndex]->time_base);
-
-                if (last_pts > 0) {
-                    last_scaled_pts = av_rescale_q(
-                            last_pts,
-                            mOutputContext->streams[mVideoStreamIndex]
-                                    ->codec->time_base,
-                            mOutputContext->streams[mVideoStreamIndex]
-                                    ->time_base);
-                }
-                if (scaled_pts <= last_scaled_pts) {
-                    pFrame->pts = av_rescale_q(
-                            last_scaled_pts + 1,
-                            mOutputContext->streams[mVideoStreamIndex]
-                                    ->time_base,
-                            mOutputContext->streams[mVideoStreamIndex]
-                                    ->codec->time_base);
-                }
-            } else {
-                if (pFrame->pts <= last_pts) {
-                    pFrame->pts = last_pts + 1;
-                }
-            }
-            last_pts = pFrame->pts;
-
-            // Rescale the video pixel data
-            AVFrame* tmp_frame = av_frame_alloc();
-            if (!tmp_frame) {
-                ret = AVERROR(ENOMEM);
-                break;
-            }
-            auto pTmpFrame = makeAVScopedPtr(tmp_frame);
-
-            pTmpFrame->format = mOutVideoCodecCxt->pix_fmt;
-            pTmpFrame->width = mOutVideoCodecCxt->width;
-            pTmpFrame->height = mOutVideoCodecCxt->height;
-            // allocate the buffer for the frame data
-            ret = av_frame_get_buffer(pTmpFrame.get(), 32);
-            if (ret < 0) {
-                LOG(ERROR) << "Could not allocate video frame data.";
+        slot.timeCs = lastCs = frameTimeCs(slot.decoded.get(), lastCs);
+        // Other formats go through |mSwsContext|, on this thread.
+        slot.decodedOnly = slot.decoded->format == AV_PIX_FMT_YUV420P;
+        if (!slot.decodedOnly) {
+            if (!toRgba(&slot)) {
+                ok = false;
                 break;
             }
-
-            sws_scale(mSwsContext.get(), pFrame->data, pFrame->linesize, 0,
-                      mOutVideoCodecCxt->height, pTmpFrame->data, pTmpFrame->linesize);
-            pTmpFrame->pts = pFrame->pts;
-            ret = encodeWriteFrame(pTmpFrame.get(), nullptr);
-            if (ret < 0) {
+            av_frame_unref(slot.decoded.get());
+        }
+        if (++count == int(mSlots.size())) {
+            if (!encodeBatch(count)) {
+                ok = false;
                 break;
             }
+            count = 0;
         }
     }
-
-    if (ret == AVERROR_EOF) {
-        ret = 0;
-    }
-
-    if (ret == 0) {
-        // flush encoder
-        flushEncoder();
-        av_write_trailer(mOutputContext.get());
+    ok = ok && !mDecodeFailed && (count == 0 || encodeBatch(count));
+
+    if (ok && !mPending.empty()) {
+        // The last frame lasts as long as the others on average.
+        const AVStream* stream = mInputContext->streams[mVideoStreamIndex];
+        int64_t durationCs = 10;
+        if (stream->avg_frame_rate.num > 0) {
+            durationCs = av_rescale_q(1, av_inv_q(stream->avg_frame_rate),
+                                      kCentiseconds);
+        }
+        ok = writePending(lastCs + durationCs);
     }
+    ok = ok && mWriter->writeTrailer();
 
-    // Close the output file and free the output context
-    mOutputContext.reset();
+    // Close the output file
+    mWriter.reset();
+    mOutput.reset();
 
-    return ret == 0;
+    return ok;
 }
 
-int GifConverterImpl::encodeWriteFrame(AVFrame* filt_frame, int* got_frame) {
-    int ret;
-    int got_frame_local;
-    AVPacket enc_pkt;
-
-    if (!got_frame)
-        got_frame = &got_frame_local;
-
-    enc_pkt.data = NULL;
-    enc_pkt.size = 0;
-    av_init_packet(&enc_pkt);
-    ret = avcodec_encode_video2(
-            mOutputContext->streams[mVideoStreamIndex]->codec, &enc_pkt,
-            filt_frame, got_frame);
-    if (ret < 0)
-        return ret;
-    if (!(*got_frame))
-        return 0;
-
-    // prepare packet for muxing
-    enc_pkt.stream_index = mVideoStreamIndex;
-    av_packet_rescale_ts(
-            &enc_pkt,
-            mOutputContext->streams[mVideoStreamIndex]->codec->time_base,
-            mOutputContext->streams[mVideoStreamIndex]->time_base);
-    // mux encoded frame
-    // DO NOT free or unref enc_pkt once interleaved.
-    // av_interleaved_write_frame() will take ownership of the packet once
-    // passed in.
-    ret = av_interleaved_write_frame(mOutputContext.get(), &enc_pkt);
-    return ret;
-}
-
-// Gif conversion helper
-// static
-int GifConverterImpl::flushEncoder() {
-    int ret;
-    int got_frame;
-
-    if (!(mOutputContext->streams[mVideoStreamIndex]
-                  ->codec->codec->capabilities &
-          AV_CODEC_CAP_DELAY))
-        return 0;
-
-    while (1) {
-        av_log(NULL, AV_LOG_INFO, "Flushing stream #%u encoder\n",
-               mVideoStreamIndex);
-        ret = encodeWriteFrame(nullptr, &got_frame);
-        if (ret < 0)
-            break;
-        if (!got_frame)
-            return 0;
-    }
-    return ret;
-}
 }  // namespace
 
 bool GifConverter::toAnimatedGif(android::base::StringView inFilename,
                                  android::base::StringView outFilename,
-                                 uint32_t bitrate) {
-    GifConverterImpl converter(inFilename, outFilename, bitrate);
+                                 uint32_t /* bitrate */) {
+    GifConverterImpl converter(inFilename, outFilename);
     return converter.run();
 }
 
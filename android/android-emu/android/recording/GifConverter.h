@@ -30,8 +30,8 @@ public:
     // params:
     //   inFilename - the input video file in webm or mp4 format
     //   outFilename - the output animated gif file
-    //   bitRate - bit rate (bps) for the gif file, usually smaller number
-    //             to reduce the file size.
+    //   bitRate - unused, GIF has no rate control. The file size depends on
+    //             how much of the screen changes between frames.
     // returns:
     //   true if successfully converted to animated gif, false otherwise.
     static bool toAnimatedGif(android::base::StringView inFilename,
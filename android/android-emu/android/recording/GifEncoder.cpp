@@ -0,0 +1,478 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/recording/GifEncoder.h"
+
+#include <stdint.h>  // for INT32_MAX, UINT32_MAX
+#include <string.h>  // for memcmp
+
+#include <algorithm>  // for sort, max, min
+
+namespace android {
+namespace recording {
+
+namespace {
+
+// Colors are binned by the 5 most significant bits of each channel.
+constexpr int kBinBits = 5;
+constexpr int kBinCount = 1 << (3 * kBinBits);
+constexpr int kKMeansPasses = 3;
+
+int binOf(const uint8_t* rgba) {
+    return ((rgba[0] >> 3) << 10) | ((rgba[1] >> 3) << 5) | (rgba[2] >> 3);
+}
+
+// The value of |channel| at the center of |bin|, in 8 bits.
+int binValue(int bin, int channel) {
+    return (((bin >> (5 * (2 - channel))) & 0x1f) << 3) | 4;
+}
+
+struct Centroid {
+    double sum[3] = {};
+    double weight = 0;
+    int value[3] = {};
+
+    void add(int bin, double w) {
+        for (int c = 0; c < 3; ++c) {
+            sum[c] += binValue(bin, c) * w;
+        }
+        weight += w;
+    }
+    // Moves to the mean of what was added, and starts over.
+    void update() {
+        for (int c = 0; c < 3; ++c) {
+            if (weight > 0) {
+                value[c] = std::min(255, int(sum[c] / weight + 0.5));
+            }
+            sum[c] = 0;
+        }
+        weight = 0;
+    }
+};
+
+int nearest(const std::vector<Centroid>& centroids, int bin) {
+    const int r = binValue(bin, 0);
+    const int g = binValue(bin, 1);
+    const int b = binValue(bin, 2);
+    int best = 0;
+    int bestDistance = INT32_MAX;
+    for (size_t i = 0; i < centroids.size(); ++i) {
+        const int dr = r - centroids[i].value[0];
+        const int dg = g - centroids[i].value[1];
+        const int db = b - centroids[i].value[2];
+        const int distance = dr * dr + dg * dg + db * db;
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            best = i;
+        }
+    }
+    return best;
+}
+
+// A box of the median cut, over a range of the sampled bins.
+struct Box {
+    int begin;
+    int end;
+    uint64_t weight;
+    int channel;  // The one with the widest range.
+    int range;
+};
+
+void measure(Box* box,
+             const std::vector<int>& bins,
+             const std::vector<uint32_t>& histogram) {
+    int lo[3] = {255, 255, 255};
+    int hi[3] = {0, 0, 0};
+    box->weight = 0;
+    for (int i = box->begin; i < box->end; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            lo[c] = std::min(lo[c], binValue(bins[i], c));
+            hi[c] = std::max(hi[c], binValue(bins[i], c));
+        }
+        box->weight += histogram[bins[i]];
+    }
+    box->channel = 0;
+    for (int c = 1; c < 3; ++c) {
+        if (hi[c] - lo[c] > hi[box->channel] - lo[box->channel]) {
+            box->channel = c;
+        }
+    }
+    box->range = hi[box->channel] - lo[box->channel];
+}
+
+// GIF's variable length LZW, as in giflib.
+class LzwEncoder {
+public:
+    explicit LzwEncoder(std::vector<uint8_t>* out) : mOut(out) {}
+
+    void encode(const uint8_t* pixels, size_t count) {
+        clear();
+        emit(kClearCode);
+        if (count == 0) {
+            emit(kEndCode);
+            finish();
+            return;
+        }
+        int prefix = pixels[0];
+        for (size_t i = 1; i < count; ++i) {
+            const uint8_t pixel = pixels[i];
+            const uint32_t key = (uint32_t(prefix) << 8) | pixel;
+            const int code = find(key);
+            if (code >= 0) {
+                prefix = code;
+                continue;
+            }
+            emit(prefix);
+            if (mNextCode >= kMaxCode) {
+                emit(kClearCode);
+                clear();
+            } else {
+                insert(key, mNextCode++);
+            }
+            prefix = pixel;
+        }
+        emit(prefix);
+        emit(kEndCode);
+        finish();
+    }
+
+private:
+    static constexpr int kMinCodeSize = 8;
+    static constexpr int kClearCode = 1 << kMinCodeSize;
+    static constexpr int kEndCode = kClearCode + 1;
+    static constexpr int kMaxCode = 4095;
+    // A prime a bit larger than the 4096 codes, as in compress(1).
+    static constexpr int kHashSize = 5003;
+
+    void clear() {
+        std::fill(mKeys, mKeys + kHashSize, UINT32_MAX);
+        mNextCode = kEndCode + 1;
+        mCodeSize = kMinCodeSize + 1;
+    }
+
+    int slot(uint32_t key) const {
+        return int(((key >> 12) ^ key) % kHashSize);
+    }
+
+    int find(uint32_t key) const {
+        for (int i = slot(key);; i = (i + 1) % kHashSize) {
+            if (mKeys[i] == key) {
+                return mCodes[i];
+            }
+            if (mKeys[i] == UINT32_MAX) {
+                return -1;
+            }
+        }
+    }
+
+    void insert(uint32_t key, int code) {
+        int i = slot(key);
+        while (mKeys[i] != UINT32_MAX) {
+            i = (i + 1) % kHashSize;
+        }
+        mKeys[i] = key;
+        mCodes[i] = uint16_t(code);
+    }
+
+    void emit(int code) {
+        mBits |= uint32_t(code) << mBitCount;
+        mBitCount += mCodeSize;
+        while (mBitCount >= 8) {
+            put(uint8_t(mBits));
+            mBits >>= 8;
+            mBitCount -= 8;
+        }
+        // The decoder widens its codes once the table outgrows them.
+        if (mNextCode >= (1 << mCodeSize) && mCodeSize < 12) {
+            ++mCodeSize;
+        }
+    }
+
+    void finish() {
+        if (mBitCount > 0) {
+            put(uint8_t(mBits));
+        }
+        if (mBlockSize > 0) {
+            (*mOut)[mBlockStart] = uint8_t(mBlockSize);
+        }
+        mOut->push_back(0);
+    }
+
+    // Data goes in sub-blocks of up to 255 bytes, each after its size.
+    void put(uint8_t byte) {
+        if (mBlockSize == 0) {
+            mBlockStart = mOut->size();
+            mOut->push_back(0);
+        }
+        mOut->push_back(byte);
+        if (++mBlockSize == 255) {
+            (*mOut)[mBlockStart] = 255;
+            mBlockSize = 0;
+        }
+    }
+
+    std::vector<uint8_t>* mOut;
+    uint32_t mKeys[kHashSize];
+    uint16_t mCodes[kHashSize];
+    int mNextCode = 0;
+    int mCodeSize = 0;
+    uint32_t mBits = 0;
+    int mBitCount = 0;
+    size_t mBlockStart = 0;
+    int mBlockSize = 0;
+};
+
+void putLe16(std::vector<uint8_t>* out, int value) {
+    out->push_back(uint8_t(value));
+    out->push_back(uint8_t(value >> 8));
+}
+
+}  // namespace
+
+GifPalette::GifPalette()
+    : mHistogram(kBinCount), mColors(3 * 256), mLookup(kBinCount) {}
+
+void GifPalette::addSample(const uint8_t* rgba,
+                           int width,
+                           int height,
+                           int stride,
+                           int step) {
+    for (int y = 0; y < height; y += step) {
+        const uint8_t* row = rgba + y * stride;
+        for (int x = 0; x < width; x += step) {
+            ++mHistogram[binOf(row + 4 * x)];
+        }
+    }
+}
+
+void GifPalette::build() {
+    std::vector<int> bins;
+    for (int bin = 0; bin < kBinCount; ++bin) {
+        if (mHistogram[bin]) {
+            bins.push_back(bin);
+        }
+    }
+    if (bins.empty()) {
+        bins.push_back(0);
+        mHistogram[0] = 1;
+    }
+
+    // Median cut: split the heaviest box that has room for it at its
+    // weighted median, along its widest channel.
+    std::vector<Box> boxes = {{0, int(bins.size())}};
+    measure(&boxes[0], bins, mHistogram);
+    while (int(boxes.size()) < kMaxColors) {
+        Box* widest = nullptr;
+        for (auto& box : boxes) {
+            if (box.end - box.begin > 1 &&
+                (!widest || box.weight * (box.range + 1) >
+                                    widest->weight * (widest->range + 1))) {
+                widest = &box;
+            }
+        }
+        if (!widest) {
+            break;
+        }
+        const int channel = widest->channel;
+        std::sort(bins.begin() + widest->begin, bins.begin() + widest->end,
+                  [channel](int a, int b) {
+                      return binValue(a, channel) < binValue(b, channel);
+                  });
+        int split = widest->begin + 1;
+        uint64_t below = mHistogram[bins[widest->begin]];
+        while (split < widest->end - 1 && below * 2 < widest->weight) {
+            below += mHistogram[bins[split++]];
+        }
+        Box upper = {split, widest->end};
+        widest->end = split;
+        measure(widest, bins, mHistogram);
+        measure(&upper, bins, mHistogram);
+        boxes.push_back(upper);
+    }
+
+    std::vector<Centroid> centroids(boxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        for (int j = boxes[i].begin; j < boxes[i].end; ++j) {
+            centroids[i].add(bins[j], mHistogram[bins[j]]);
+        }
+        centroids[i].update();
+    }
+
+    // The boxes split the colors along axes only; let each color go to its
+    // closest centroid instead.
+    for (int pass = 0; pass < kKMeansPasses; ++pass) {
+        for (int bin : bins) {
+            centroids[nearest(centroids, bin)].add(bin, mHistogram[bin]);
+        }
+        for (auto& centroid : centroids) {
+            centroid.update();
+        }
+    }
+
+    mSize = int(centroids.size());
+    for (int i = 0; i < mSize; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            mColors[3 * i + c] = uint8_t(centroids[i].value[c]);
+        }
+    }
+    for (int bin = 0; bin < kBinCount; ++bin) {
+        mLookup[bin] = uint8_t(nearest(centroids, bin));
+    }
+}
+
+void GifPalette::map(const uint8_t* rgba,
+                     int width,
+                     int height,
+                     int stride,
+                     uint8_t* indices) const {
+    for (int y = 0; y < height; ++y) {
+        const uint8_t* pixel = rgba + y * stride;
+        for (int x = 0; x < width; ++x, pixel += 4) {
+            *indices++ = mLookup[binOf(pixel)];
+        }
+    }
+}
+
+GifFrame encodeGifFrame(const uint8_t* indices,
+                        const uint8_t* previous,
+                        int width,
+                        int height) {
+    GifFrame frame;
+    int top = 0;
+    int bottom = height;
+    int left = 0;
+    int right = width;
+    if (previous) {
+        auto rowChanged = [=](int y) {
+            return memcmp(indices + y * width, previous + y * width, width) !=
+                   0;
+        };
+        while (top < height && !rowChanged(top)) {
+            ++top;
+        }
+        if (top == height) {
+            return frame;
+        }
+        while (!rowChanged(bottom - 1)) {
+            --bottom;
+        }
+        left = width;
+        right = 0;
+        for (int y = top; y < bottom; ++y) {
+            const uint8_t* row = indices + y * width;
+            const uint8_t* prevRow = previous + y * width;
+            for (int x = 0; x < left; ++x) {
+                if (row[x] != prevRow[x]) {
+                    left = x;
+                    break;
+                }
+            }
+            for (int x = width - 1; x >= right; --x) {
+                if (row[x] != prevRow[x]) {
+                    right = x + 1;
+                    break;
+                }
+            }
+        }
+        frame.transparent = true;
+    }
+
+    frame.left = left;
+    frame.top = top;
+    frame.width = right - left;
+    frame.height = bottom - top;
+
+    std::vector<uint8_t> pixels(size_t(frame.width) * frame.height);
+    uint8_t* out = pixels.data();
+    for (int y = top; y < bottom; ++y) {
+        const uint8_t* row = indices + y * width;
+        if (!previous) {
+            out = std::copy(row + left, row + right, out);
+            continue;
+        }
+        const uint8_t* prevRow = previous + y * width;
+        for (int x = left; x < right; ++x) {
+            *out++ = row[x] == prevRow[x] ? GifPalette::kTransparentIndex
+                                          : row[x];
+        }
+    }
+
+    LzwEncoder(&frame.data).encode(pixels.data(), pixels.size());
+    return frame;
+}
+
+GifWriter::GifWriter(android::base::Stream* stream) : mStream(stream) {}
+
+bool GifWriter::writeHeader(int width, int height, const GifPalette& palette) {
+    static const char kSignature[] = "GIF89a";
+    mBuffer.insert(mBuffer.end(), kSignature, kSignature + 6);
+    putLe16(&mBuffer, width);
+    putLe16(&mBuffer, height);
+    // A 256 entry global color table, of 8 bit colors.
+    mBuffer.push_back(0xf7);
+    mBuffer.push_back(0);  // Background color.
+    mBuffer.push_back(0);  // Pixel aspect ratio.
+    mBuffer.insert(mBuffer.end(), palette.colors(), palette.colors() + 3 * 256);
+
+    // Loop forever.
+    static const char kNetscape[] = "NETSCAPE2.0";
+    mBuffer.push_back(0x21);
+    mBuffer.push_back(0xff);
+    mBuffer.push_back(11);
+    mBuffer.insert(mBuffer.end(), kNetscape, kNetscape + 11);
+    mBuffer.push_back(3);
+    mBuffer.push_back(1);
+    putLe16(&mBuffer, 0);
+    mBuffer.push_back(0);
+    return flush();
+}
+
+bool GifWriter::writeFrame(const GifFrame& frame, int delayCs) {
+    // Graphic control extension: leave the frame in place for the next one
+    // to draw on.
+    mBuffer.push_back(0x21);
+    mBuffer.push_back(0xf9);
+    mBuffer.push_back(4);
+    mBuffer.push_back((1 << 2) | (frame.transparent ? 1 : 0));
+    putLe16(&mBuffer, std::max(0, std::min(delayCs, 0xffff)));
+    mBuffer.push_back(GifPalette::kTransparentIndex);
+    mBuffer.push_back(0);
+
+    // Image descriptor, using the global color table.
+    mBuffer.push_back(0x2c);
+    putLe16(&mBuffer, frame.left);
+    putLe16(&mBuffer, frame.top);
+    putLe16(&mBuffer, frame.width);
+    putLe16(&mBuffer, frame.height);
+    mBuffer.push_back(0);
+
+    mBuffer.push_back(8);  // LZW minimum code size.
+    mBuffer.insert(mBuffer.end(), frame.data.begin(), frame.data.end());
+    return flush();
+}
+
+bool GifWriter::writeTrailer() {
+    mBuffer.push_back(0x3b);
+    return flush();
+}
+
+bool GifWriter::flush() {
+    const ssize_t size = mBuffer.size();
+    const bool ok = mStream->write(mBuffer.data(), mBuffer.size()) == size;
+    mBuffer.clear();
+    return ok;
+}
+
+}  // namespace recording
+}  // namespace android
@@ -0,0 +1,111 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>  // for uint8_t, uint32_t
+#include <vector>    // for vector
+
+#include "android/base/files/Stream.h"  // for Stream
+
+namespace android {
+namespace recording {
+
+// The palette shared by all the frames of an animated GIF, built from a
+// sample of their pixels: a median cut of the sampled colors, refined by a
+// few k-means passes. Colors are looked up in a table indexed by their
+// 5 most significant bits per channel, so mapping a frame costs a load per
+// pixel.
+class GifPalette {
+public:
+    // The last index is kept for the pixels a frame leaves as they were.
+    static constexpr int kMaxColors = 255;
+    static constexpr uint8_t kTransparentIndex = 255;
+
+    GifPalette();
+
+    // Adds every |step|th pixel of every |step|th row of an RGBA frame to
+    // the sample.
+    void addSample(const uint8_t* rgba,
+                   int width,
+                   int height,
+                   int stride,
+                   int step);
+
+    // Builds the palette from the sample. Must be called once, before
+    // colors() and map().
+    void build();
+
+    // RGB triplets for all 256 entries.
+    const uint8_t* colors() const { return mColors.data(); }
+    int size() const { return mSize; }
+
+    // Maps |height| rows of RGBA pixels to |width| x |height| indices.
+    void map(const uint8_t* rgba,
+             int width,
+             int height,
+             int stride,
+             uint8_t* indices) const;
+
+private:
+    std::vector<uint32_t> mHistogram;
+    std::vector<uint8_t> mColors;
+    std::vector<uint8_t> mLookup;
+    int mSize = 0;
+};
+
+// A frame ready to be written, but for how long it stays on screen.
+struct GifFrame {
+    // The part of the image that changed, empty if nothing did.
+    int left = 0;
+    int top = 0;
+    int width = 0;
+    int height = 0;
+    bool transparent = false;
+    // LZW compressed pixels, as data sub-blocks, including the terminator.
+    std::vector<uint8_t> data;
+
+    bool empty() const { return width == 0 || height == 0; }
+};
+
+// Encodes |indices|, a |width| x |height| frame, given |previous|, the
+// frame it is drawn on top of, or nullptr for the first one. Only the
+// bounding box of what changed is kept, and the pixels in it that did not
+// change become transparent, which compresses to almost nothing. Frames
+// don't depend on each other once mapped, so they can be encoded in
+// parallel.
+GifFrame encodeGifFrame(const uint8_t* indices,
+                        const uint8_t* previous,
+                        int width,
+                        int height);
+
+// Writes an animated GIF that loops forever to |stream|.
+class GifWriter {
+public:
+    explicit GifWriter(android::base::Stream* stream);
+
+    bool writeHeader(int width, int height, const GifPalette& palette);
+    // |delayCs| is how long the frame stays on screen, in 1/100 s.
+    bool writeFrame(const GifFrame& frame, int delayCs);
+    bool writeTrailer();
+
+private:
+    bool flush();
+
+    android::base::Stream* mStream;
+    std::vector<uint8_t> mBuffer;
+};
+
+}  // namespace recording
+}  // namespace android
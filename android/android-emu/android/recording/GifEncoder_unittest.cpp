@@ -0,0 +1,255 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/recording/GifEncoder.h"
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <vector>
+
+#include "android/base/files/MemStream.h"
+
+namespace android {
+namespace recording {
+
+using android::base::MemStream;
+
+namespace {
+
+constexpr int kWidth = 64;
+constexpr int kHeight = 48;
+
+// Decodes the LZW data sub-blocks at |data|, and returns the pixels.
+std::vector<uint8_t> decodeLzw(const uint8_t* data, size_t* consumed) {
+    std::vector<uint8_t> bytes;
+    const uint8_t* p = data;
+    while (*p) {
+        bytes.insert(bytes.end(), p + 1, p + 1 + *p);
+        p += *p + 1;
+    }
+    *consumed = p + 1 - data;
+
+    std::vector<std::vector<uint8_t>> table;
+    auto reset = [&table] {
+        table.resize(258);
+        for (int i = 0; i < 256; ++i) {
+            table[i] = {uint8_t(i)};
+        }
+    };
+    reset();
+    std::vector<uint8_t> out;
+    int codeSize = 9;
+    int prev = -1;
+    size_t bit = 0;
+    while (bit + codeSize <= bytes.size() * 8) {
+        int code = 0;
+        for (int i = 0; i < codeSize; ++i, ++bit) {
+            code |= ((bytes[bit / 8] >> (bit % 8)) & 1) << i;
+        }
+        if (code == 256) {
+            reset();
+            codeSize = 9;
+            prev = -1;
+            continue;
+        }
+        if (code == 257) {
+            break;
+        }
+        std::vector<uint8_t> entry;
+        if (code < int(table.size())) {
+            entry = table[code];
+        } else {
+            EXPECT_EQ(int(table.size()), code);
+            entry = table[prev];
+            entry.push_back(table[prev][0]);
+        }
+        if (prev >= 0 && table.size() < 4096) {
+            auto added = table[prev];
+            added.push_back(entry[0]);
+            table.push_back(added);
+        }
+        if (int(table.size()) == (1 << codeSize) && codeSize < 12) {
+            ++codeSize;
+        }
+        out.insert(out.end(), entry.begin(), entry.end());
+        prev = code;
+    }
+    return out;
+}
+
+struct DecodedFrame {
+    std::vector<uint8_t> canvas;
+    int delayCs;
+};
+
+// Decodes a GIF written by GifWriter: the indices shown after each frame.
+std::vector<DecodedFrame> decodeGif(const std::vector<uint8_t>& gif) {
+    std::vector<DecodedFrame> frames;
+    EXPECT_EQ(0, memcmp(gif.data(), "GIF89a", 6));
+    const int width = gif[6] | gif[7] << 8;
+    const int height = gif[8] | gif[9] << 8;
+    size_t pos = 13 + 3 * 256;
+    std::vector<uint8_t> canvas(width * height);
+    int delayCs = 0;
+    bool transparent = false;
+    while (pos < gif.size() && gif[pos] != 0x3b) {
+        if (gif[pos] == 0x21) {
+            if (gif[pos + 1] == 0xf9) {
+                transparent = gif[pos + 3] & 1;
+                delayCs = gif[pos + 4] | gif[pos + 5] << 8;
+            }
+            pos += 2;
+            while (gif[pos]) {
+                pos += gif[pos] + 1;
+            }
+            ++pos;
+            continue;
+        }
+        EXPECT_EQ(0x2c, gif[pos]);
+        const int left = gif[pos + 1] | gif[pos + 2] << 8;
+        const int top = gif[pos + 3] | gif[pos + 4] << 8;
+        const int w = gif[pos + 5] | gif[pos + 6] << 8;
+        const int h = gif[pos + 7] | gif[pos + 8] << 8;
+        EXPECT_EQ(8, gif[pos + 10]);
+        size_t consumed = 0;
+        auto pixels = decodeLzw(&gif[pos + 11], &consumed);
+        EXPECT_EQ(size_t(w * h), pixels.size());
+        pos += 11 + consumed;
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x) {
+                const uint8_t index = pixels[y * w + x];
+                if (!transparent || index != GifPalette::kTransparentIndex) {
+                    canvas[(top + y) * width + left + x] = index;
+                }
+            }
+        }
+        frames.push_back({canvas, delayCs});
+    }
+    EXPECT_EQ(gif.size() - 1, pos);
+    return frames;
+}
+
+std::vector<uint8_t> noise(int seed, int colors) {
+    std::vector<uint8_t> indices(kWidth * kHeight);
+    uint32_t state = seed;
+    for (auto& index : indices) {
+        state = state * 1103515245 + 12345;
+        index = (state >> 16) % colors;
+    }
+    return indices;
+}
+
+}  // namespace
+
+TEST(GifEncoder, PaletteKeepsFewColors) {
+    const uint8_t colors[][4] = {{255, 0, 0, 255},
+                                 {0, 255, 0, 255},
+                                 {0, 0, 255, 255},
+                                 {40, 40, 40, 255}};
+    std::vector<uint8_t> rgba(kWidth * kHeight * 4);
+    for (int i = 0; i < kWidth * kHeight; ++i) {
+        memcpy(&rgba[4 * i], colors[i % 4], 4);
+    }
+    GifPalette palette;
+    palette.addSample(rgba.data(), kWidth, kHeight, kWidth * 4, 1);
+    palette.build();
+    EXPECT_EQ(4, palette.size());
+
+    std::vector<uint8_t> indices(kWidth * kHeight);
+    palette.map(rgba.data(), kWidth, kHeight, kWidth * 4, indices.data());
+    for (int i = 0; i < kWidth * kHeight; ++i) {
+        const uint8_t* color = palette.colors() + 3 * indices[i];
+        for (int c = 0; c < 3; ++c) {
+            // Within the bin the color falls into.
+            EXPECT_NEAR(colors[i % 4][c], color[c], 8);
+        }
+    }
+}
+
+TEST(GifEncoder, PaletteLimitsColors) {
+    std::vector<uint8_t> rgba(256 * 256 * 4);
+    for (int i = 0; i < 256 * 256; ++i) {
+        rgba[4 * i] = i & 0xff;
+        rgba[4 * i + 1] = i >> 8;
+        rgba[4 * i + 2] = (i * 7) & 0xff;
+    }
+    GifPalette palette;
+    palette.addSample(rgba.data(), 256, 256, 256 * 4, 2);
+    palette.build();
+    EXPECT_EQ(GifPalette::kMaxColors, palette.size());
+
+    std::vector<uint8_t> indices(256 * 256);
+    palette.map(rgba.data(), 256, 256, 256 * 4, indices.data());
+    for (auto index : indices) {
+        EXPECT_NE(GifPalette::kTransparentIndex, index);
+    }
+}
+
+TEST(GifEncoder, RoundTrip) {
+    // Enough distinct strings to fill the LZW table a few times.
+    const auto first = noise(1, 200);
+    auto second = first;
+    for (int y = 10; y < 20; ++y) {
+        for (int x = 5; x < 30; ++x) {
+            second[y * kWidth + x] = (x + y) % 200;
+        }
+    }
+    const auto third = second;
+
+    GifPalette palette;
+    palette.build();
+    MemStream stream;
+    GifWriter writer(&stream);
+    ASSERT_TRUE(writer.writeHeader(kWidth, kHeight, palette));
+
+    GifFrame frame = encodeGifFrame(first.data(), nullptr, kWidth, kHeight);
+    EXPECT_FALSE(frame.transparent);
+    EXPECT_EQ(kWidth, frame.width);
+    ASSERT_TRUE(writer.writeFrame(frame, 4));
+
+    frame = encodeGifFrame(second.data(), first.data(), kWidth, kHeight);
+    EXPECT_TRUE(frame.transparent);
+    EXPECT_LE(5, frame.left);
+    EXPECT_GE(30, frame.left + frame.width);
+    EXPECT_LE(10, frame.top);
+    EXPECT_GE(20, frame.top + frame.height);
+    ASSERT_TRUE(writer.writeFrame(frame, 7));
+
+    EXPECT_TRUE(encodeGifFrame(third.data(), second.data(), kWidth, kHeight)
+                        .empty());
+    ASSERT_TRUE(writer.writeTrailer());
+
+    const auto& buffer = stream.buffer();
+    const auto frames =
+            decodeGif(std::vector<uint8_t>(buffer.begin(), buffer.end()));
+    ASSERT_EQ(2u, frames.size());
+    EXPECT_EQ(first, frames[0].canvas);
+    EXPECT_EQ(4, frames[0].delayCs);
+    EXPECT_EQ(second, frames[1].canvas);
+    EXPECT_EQ(7, frames[1].delayCs);
+}
+
+TEST(GifEncoder, SingleColor) {
+    // Long runs make long strings.
+    std::vector<uint8_t> indices(kWidth * kHeight, 3);
+    GifFrame frame = encodeGifFrame(indices.data(), nullptr, kWidth, kHeight);
+    size_t consumed = 0;
+    EXPECT_EQ(indices, decodeLzw(frame.data.data(), &consumed));
+    EXPECT_EQ(frame.data.size(), consumed);
+}
+
+}  // namespace recording
+}  // namespace android
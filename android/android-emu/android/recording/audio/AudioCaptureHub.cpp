@@ -0,0 +1,242 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/recording/audio/AudioCaptureHub.h"
+
+#include <limits.h>  // for CHAR_BIT
+#include <string.h>  // for memcpy
+
+#include <algorithm>  // for min
+
+#include "android/base/Log.h"                      // for LOG, LogMessage
+#include "android/base/memory/LazyInstance.h"      // for LazyInstance
+#include "android/base/system/System.h"            // for System
+#include "android/emulation/AudioCapture.h"        // for AudioCapturer
+#include "android/emulation/AudioCaptureEngine.h"  // for AudioCaptureEngine
+
+namespace android {
+namespace recording {
+
+using android::base::AutoLock;
+using android::base::System;
+using android::emulation::AudioCaptureEngine;
+using android::emulation::AudioCapturer;
+
+class AudioCaptureHub::Capturer : public AudioCapturer {
+public:
+    Capturer(AudioCaptureHub* hub, const AudioSpec& spec)
+        : AudioCapturer(spec.sampleRate,
+                        getAudioFormatSize(spec.format) * CHAR_BIT,
+                        spec.channels),
+          mHub(hub) {}
+
+    bool start() {
+        auto engine = AudioCaptureEngine::get();
+        return engine && engine->start(this) == 0;
+    }
+
+    ~Capturer() {
+        auto engine = AudioCaptureEngine::get();
+        if (engine) {
+            engine->stop(this);
+        }
+    }
+
+    int onSample(void* buf, int size) override {
+        return mHub->onSample(buf, size);
+    }
+
+private:
+    AudioCaptureHub* const mHub;
+};
+
+AudioCaptureHub::Reader::Reader(AudioCaptureHub* hub, int index)
+    : mHub(hub), mIndex(index) {}
+
+AudioCaptureHub::Reader::~Reader() {
+    mHub->unsubscribe(mIndex);
+}
+
+bool AudioCaptureHub::Reader::read(std::vector<uint8_t>* out,
+                                   uint64_t* tsUs,
+                                   uint64_t deadlineUs) {
+    std::atomic<uint64_t>& cursor = mHub->mCursors[mIndex];
+    uint64_t pos = cursor.load(std::memory_order_acquire);
+    if (mStopped) {
+        return false;
+    }
+    if (mHub->mHead.load(std::memory_order_acquire) == pos &&
+        !mHub->waitForAudio(pos, this, deadlineUs)) {
+        return false;
+    }
+
+    // The producer won't touch this slot until we move past it. If it
+    // skipped us ahead in the meantime, the failed exchange picks up the
+    // new position, which is older than the head as well.
+    while (!cursor.compare_exchange_weak(pos, pos | kReading,
+                                         std::memory_order_acq_rel)) {
+    }
+    const Slot& slot = mHub->mSlots[pos % kSlots];
+    out->assign(slot.data, slot.data + slot.size);
+    *tsUs = slot.tsUs;
+    cursor.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+uint64_t AudioCaptureHub::Reader::dropped() const {
+    return mHub->mReaderDropped[mIndex].load(std::memory_order_relaxed);
+}
+
+void AudioCaptureHub::Reader::stop() {
+    mStopped = true;
+    AutoLock lock(mHub->mLock);
+    mHub->mCanRead.broadcastAndUnlock(&lock);
+}
+
+AudioCaptureHub::AudioCaptureHub(const AudioSpec& spec)
+    : mSpec(spec),
+      mBytesPerUs(spec.sampleRate * spec.bytesPerFrame() / 1000000.0),
+      mSlots(kSlots) {
+    for (auto& cursor : mCursors) {
+        cursor = kInactive;
+    }
+}
+
+AudioCaptureHub::~AudioCaptureHub() = default;
+
+static base::LazyInstance<AudioCaptureHub> sAudioCaptureHub =
+        LAZY_INSTANCE_INIT;
+
+// static
+AudioCaptureHub* AudioCaptureHub::get() {
+    return sAudioCaptureHub.ptr();
+}
+
+std::unique_ptr<AudioCaptureHub::Reader> AudioCaptureHub::subscribe() {
+    AutoLock lock(mControlLock);
+    int index = 0;
+    while (index < kMaxReaders &&
+           mCursors[index].load(std::memory_order_relaxed) != kInactive) {
+        ++index;
+    }
+    if (index == kMaxReaders) {
+        LOG(ERROR) << "Too many audio readers";
+        return nullptr;
+    }
+
+    if (mReaders == 0) {
+        mCapturer.reset(new Capturer(this, mSpec));
+        if (!mCapturer->start()) {
+            LOG(ERROR) << "Unable to start audio capturer";
+            mCapturer.reset();
+            return nullptr;
+        }
+    }
+    ++mReaders;
+
+    // Starts with the next chunk, the ones before may be overwritten at any
+    // time.
+    mReaderDropped[index].store(0, std::memory_order_relaxed);
+    mCursors[index].store(mHead.load(std::memory_order_acquire),
+                          std::memory_order_release);
+    return std::unique_ptr<Reader>(new Reader(this, index));
+}
+
+void AudioCaptureHub::unsubscribe(int index) {
+    AutoLock lock(mControlLock);
+    mCursors[index].store(kInactive, std::memory_order_release);
+    if (--mReaders == 0) {
+        mCapturer.reset();
+    }
+}
+
+int AudioCaptureHub::onSample(const void* buf, int size) {
+    if (buf == nullptr || size <= 0) {
+        return -1;
+    }
+
+    const uint64_t tsUs = System::get()->getHighResTimeUs();
+    const uint8_t* p = static_cast<const uint8_t*>(buf);
+    int offset = 0;
+    int result = 0;
+    while (offset < size) {
+        // Only this thread moves the head.
+        const uint64_t head = mHead.load(std::memory_order_relaxed);
+        if (!makeRoom(head)) {
+            // Rather than wait for the reader, drop the rest.
+            ++mDropped;
+            result = -1;
+            break;
+        }
+
+        Slot& slot = mSlots[head % kSlots];
+        slot.size = std::min(size - offset, kSlotBytes);
+        slot.tsUs = tsUs + static_cast<uint64_t>(offset / mBytesPerUs);
+        memcpy(slot.data, p + offset, slot.size);
+        offset += slot.size;
+        mHead.store(head + 1, std::memory_order_seq_cst);
+    }
+
+    wakeReaders();
+    return result;
+}
+
+bool AudioCaptureHub::makeRoom(uint64_t head) {
+    for (int i = 0; i < kMaxReaders; ++i) {
+        uint64_t cursor = mCursors[i].load(std::memory_order_acquire);
+        while (cursor != kInactive) {
+            const uint64_t pos = cursor & ~kReading;
+            if (head - pos < kSlots) {
+                break;
+            }
+            if (cursor & kReading) {
+                return false;
+            }
+            // Fails if the reader got to it first, or went away.
+            if (mCursors[i].compare_exchange_weak(cursor, pos + 1,
+                                                  std::memory_order_acq_rel)) {
+                mReaderDropped[i].fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+bool AudioCaptureHub::waitForAudio(uint64_t pos,
+                                   const Reader* reader,
+                                   uint64_t deadlineUs) {
+    AutoLock lock(mLock);
+    // Announce ourselves before looking at the head again, so that either we
+    // see the new audio, or onSample() sees us waiting and wakes us up.
+    mWaiters.fetch_add(1, std::memory_order_seq_cst);
+    while (mHead.load(std::memory_order_seq_cst) == pos && !reader->stopped()) {
+        if (!mCanRead.timedWait(&mLock, deadlineUs)) {
+            break;
+        }
+    }
+    mWaiters.fetch_sub(1, std::memory_order_relaxed);
+    return mHead.load(std::memory_order_acquire) != pos && !reader->stopped();
+}
+
+void AudioCaptureHub::wakeReaders() {
+    if (mWaiters.load(std::memory_order_seq_cst) == 0) {
+        return;
+    }
+    AutoLock lock(mLock);
+    mCanRead.broadcastAndUnlock(&lock);
+}
+
+}  // namespace recording
+}  // namespace android
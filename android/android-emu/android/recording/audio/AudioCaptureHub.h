@@ -0,0 +1,141 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>  // for uint64_t, uint8_t
+#include <atomic>    // for atomic
+#include <memory>    // for unique_ptr
+#include <vector>    // for vector
+
+#include "android/base/Compiler.h"                           // for DISALLOW...
+#include "android/base/synchronization/ConditionVariable.h"  // for Conditio...
+#include "android/base/synchronization/Lock.h"               // for Lock
+#include "android/recording/audio/AudioConverter.h"          // for AudioSpec
+
+namespace android {
+namespace recording {
+
+// Captures the guest audio once, and shares it with everyone who wants it:
+// the recorder, gRPC audio streams and WebRTC.
+//
+// The first subscriber starts a single capture from QEMU in |spec()|, and the
+// last one stops it. Audio goes into a preallocated ring that all readers
+// walk with their own cursor, so the QEMU io thread never allocates, never
+// blocks, and only takes a lock to wake up readers that are waiting. If a
+// reader falls a whole ring behind, it skips its oldest audio to make room,
+// so one slow reader doesn't cost the others anything.
+class AudioCaptureHub {
+public:
+    // About 0.75s of 44.1kHz stereo.
+    static constexpr int kSlots = 64;
+    static constexpr int kSlotBytes = 2048;
+    static constexpr int kMaxReaders = 8;
+
+    class Reader {
+    public:
+        ~Reader();
+
+        // Waits for the next chunk of audio until |deadlineUs|, in unix time,
+        // and copies it to |out|, with its capture time in |tsUs|. Returns
+        // false on timeout or once stop() is called.
+        bool read(std::vector<uint8_t>* out, uint64_t* tsUs, uint64_t deadlineUs);
+
+        // Wakes up read(), and makes it fail from now on. Can be called from
+        // any thread.
+        void stop();
+        bool stopped() const { return mStopped; }
+
+        // Number of chunks this reader missed because it was too slow.
+        uint64_t dropped() const;
+
+    private:
+        friend class AudioCaptureHub;
+        Reader(AudioCaptureHub* hub, int index);
+
+        AudioCaptureHub* const mHub;
+        const int mIndex;
+        std::atomic<bool> mStopped{false};
+
+        DISALLOW_COPY_AND_ASSIGN(Reader);
+    };
+
+    explicit AudioCaptureHub(const AudioSpec& spec = AudioSpec());
+    ~AudioCaptureHub();
+
+    static AudioCaptureHub* get();
+
+    // The format of the audio handed out by readers.
+    const AudioSpec& spec() const { return mSpec; }
+
+    // Returns a reader that sees all audio captured from now on, or nullptr
+    // if there are too many readers, or capture couldn't start.
+    std::unique_ptr<Reader> subscribe();
+
+    // Number of chunks no reader got, because a reader that was a whole
+    // ring behind was in the middle of reading the slot they needed.
+    uint64_t dropped() const { return mDropped; }
+
+private:
+    class Capturer;
+
+    struct Slot {
+        uint64_t tsUs;
+        int size;
+        uint8_t data[kSlotBytes];
+    };
+
+    // Marks an unused entry in mCursors.
+    static constexpr uint64_t kInactive = UINT64_MAX;
+    // Set in a cursor while its reader copies out the slot, which keeps
+    // onSample() from skipping the reader past it.
+    static constexpr uint64_t kReading = uint64_t(1) << 63;
+
+    // Called from the QEMU io thread.
+    int onSample(const void* buf, int size);
+    void unsubscribe(int index);
+    // Moves the readers that are a whole ring behind |head| past their
+    // oldest chunk. Returns false if one of them is reading it.
+    bool makeRoom(uint64_t head);
+    // Waits until there is audio past |pos|, |reader| is stopped, or the
+    // deadline passes. Returns true if there is audio.
+    bool waitForAudio(uint64_t pos, const Reader* reader, uint64_t deadlineUs);
+    void wakeReaders();
+
+    const AudioSpec mSpec;
+    const double mBytesPerUs;
+
+    // Guards subscribing and unsubscribing.
+    base::Lock mControlLock;
+    std::unique_ptr<Capturer> mCapturer;
+    int mReaders = 0;
+
+    std::vector<Slot> mSlots;
+    // Number of chunks ever written, the next one goes to mHead % kSlots.
+    std::atomic<uint64_t> mHead{0};
+    // The next chunk each reader will read.
+    std::atomic<uint64_t> mCursors[kMaxReaders];
+    std::atomic<uint64_t> mReaderDropped[kMaxReaders];
+    std::atomic<uint64_t> mDropped{0};
+
+    // Readers that wait for audio.
+    base::Lock mLock;
+    base::ConditionVariable mCanRead;
+    std::atomic<int> mWaiters{0};
+
+    DISALLOW_COPY_AND_ASSIGN(AudioCaptureHub);
+};
+
+}  // namespace recording
+}  // namespace android
@@ -0,0 +1,255 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/recording/audio/AudioCaptureHub.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include "android/base/system/System.h"
+#include "android/base/threads/FunctorThread.h"
+#include "android/emulation/AudioCapture.h"
+#include "android/emulation/AudioCaptureEngine.h"
+
+namespace android {
+namespace recording {
+
+using android::base::FunctorThread;
+using android::base::System;
+using android::emulation::AudioCaptureEngine;
+using android::emulation::AudioCapturer;
+
+namespace {
+
+class FakeAudioCaptureEngine : public AudioCaptureEngine {
+public:
+    int start(AudioCapturer* capturer) override {
+        EXPECT_EQ(nullptr, mCapturer);
+        mCapturer = capturer;
+        ++mStarts;
+        return 0;
+    }
+
+    int stop(AudioCapturer* capturer) override {
+        if (mCapturer != capturer) {
+            return -1;
+        }
+        mCapturer = nullptr;
+        return 0;
+    }
+
+    // Hands |size| bytes counting up from |first| to the capturer.
+    int send(int first, int size) {
+        std::vector<uint8_t> data(size);
+        for (int i = 0; i < size; ++i) {
+            data[i] = uint8_t(first + i);
+        }
+        return mCapturer->onSample(data.data(), size);
+    }
+
+    AudioCapturer* mCapturer = nullptr;
+    int mStarts = 0;
+};
+
+class AudioCaptureHubTest : public testing::Test {
+protected:
+    void SetUp() override { AudioCaptureEngine::set(&mEngine); }
+    void TearDown() override { AudioCaptureEngine::set(nullptr); }
+
+    uint64_t soon() { return System::get()->getUnixTimeUs() + 1000000; }
+
+    FakeAudioCaptureEngine mEngine;
+};
+
+}  // namespace
+
+TEST_F(AudioCaptureHubTest, StartsCaptureOnce) {
+    AudioCaptureHub hub;
+    EXPECT_EQ(nullptr, mEngine.mCapturer);
+    {
+        auto first = hub.subscribe();
+        ASSERT_NE(nullptr, mEngine.mCapturer);
+        EXPECT_EQ(44100, mEngine.mCapturer->getSamplingRate());
+        EXPECT_EQ(16, mEngine.mCapturer->getBits());
+        EXPECT_EQ(2, mEngine.mCapturer->getChannels());
+        auto second = hub.subscribe();
+        EXPECT_EQ(1, mEngine.mStarts);
+    }
+    EXPECT_EQ(nullptr, mEngine.mCapturer);
+
+    std::vector<std::unique_ptr<AudioCaptureHub::Reader>> readers;
+    for (int i = 0; i < AudioCaptureHub::kMaxReaders; ++i) {
+        readers.push_back(hub.subscribe());
+        ASSERT_NE(nullptr, readers.back());
+    }
+    EXPECT_EQ(nullptr, hub.subscribe());
+    EXPECT_EQ(2, mEngine.mStarts);
+}
+
+TEST_F(AudioCaptureHubTest, EveryReaderGetsEverything) {
+    AudioCaptureHub hub;
+    auto first = hub.subscribe();
+    auto second = hub.subscribe();
+
+    // Larger than a slot, so it is split up.
+    const int size = AudioCaptureHub::kSlotBytes + 100;
+    EXPECT_EQ(0, mEngine.send(7, size));
+
+    for (auto* reader : {first.get(), second.get()}) {
+        std::vector<uint8_t> received;
+        std::vector<uint8_t> chunk;
+        uint64_t tsUs = 0;
+        uint64_t lastTsUs = 0;
+        while (received.size() < size_t(size)) {
+            ASSERT_TRUE(reader->read(&chunk, &tsUs, soon()));
+            EXPECT_LE(lastTsUs, tsUs);
+            lastTsUs = tsUs;
+            received.insert(received.end(), chunk.begin(), chunk.end());
+        }
+        for (int i = 0; i < size; ++i) {
+            ASSERT_EQ(uint8_t(7 + i), received[i]);
+        }
+        // Nothing more, times out.
+        EXPECT_FALSE(reader->read(&chunk, &tsUs, 0));
+    }
+    EXPECT_EQ(0u, hub.dropped());
+}
+
+TEST_F(AudioCaptureHubTest, SlowReaderDrops) {
+    AudioCaptureHub hub;
+    auto slow = hub.subscribe();
+    auto fast = hub.subscribe();
+    std::vector<uint8_t> chunk;
+    uint64_t tsUs = 0;
+    for (int i = 0; i < AudioCaptureHub::kSlots + 2; ++i) {
+        EXPECT_EQ(0, mEngine.send(i, 4));
+        ASSERT_TRUE(fast->read(&chunk, &tsUs, soon()));
+        EXPECT_EQ(uint8_t(i), chunk[0]);
+    }
+
+    // Only the slow reader lost its two oldest chunks.
+    EXPECT_EQ(0u, fast->dropped());
+    EXPECT_EQ(2u, slow->dropped());
+    EXPECT_EQ(0u, hub.dropped());
+    for (int i = 2; i < AudioCaptureHub::kSlots + 2; ++i) {
+        ASSERT_TRUE(slow->read(&chunk, &tsUs, soon()));
+        EXPECT_EQ(std::vector<uint8_t>({uint8_t(i), uint8_t(i + 1),
+                                        uint8_t(i + 2), uint8_t(i + 3)}),
+                  chunk);
+    }
+    EXPECT_FALSE(slow->read(&chunk, &tsUs, 0));
+}
+
+TEST_F(AudioCaptureHubTest, StopWakesReader) {
+    AudioCaptureHub hub;
+    auto reader = hub.subscribe();
+    FunctorThread thread([&reader]() {
+        std::vector<uint8_t> chunk;
+        uint64_t tsUs = 0;
+        // Blocks until stopped.
+        return reader->read(&chunk, &tsUs, UINT64_MAX / 2) ? -1 : 0;
+    });
+    ASSERT_TRUE(thread.start());
+    System::get()->sleepMs(10);
+    reader->stop();
+    intptr_t result = -1;
+    thread.wait(&result);
+    EXPECT_EQ(0, result);
+    EXPECT_TRUE(reader->stopped());
+}
+
+TEST_F(AudioCaptureHubTest, Streams) {
+    constexpr int kChunks = 20000;
+    constexpr int kReaders = 2;
+    AudioCaptureHub hub;
+    std::vector<std::unique_ptr<AudioCaptureHub::Reader>> readers;
+    for (int i = 0; i < kReaders; ++i) {
+        readers.push_back(hub.subscribe());
+    }
+    auto slow = hub.subscribe();
+
+    // The chunks each of |readers| got so far.
+    std::atomic<int> progress[kReaders] = {};
+    std::vector<std::unique_ptr<FunctorThread>> threads;
+    for (int n = 0; n < kReaders; ++n) {
+        AudioCaptureHub::Reader* r = readers[n].get();
+        std::atomic<int>* done = &progress[n];
+        threads.emplace_back(new FunctorThread([this, r, done]() {
+            std::vector<uint8_t> chunk;
+            uint64_t tsUs = 0;
+            for (int i = 0; i < kChunks; ++i) {
+                if (!r->read(&chunk, &tsUs, soon()) || chunk.size() != 4 ||
+                    chunk[0] != uint8_t(i)) {
+                    return -1;
+                }
+                done->store(i + 1);
+            }
+            return 0;
+        }));
+        ASSERT_TRUE(threads.back()->start());
+    }
+
+    // Falls behind now and then, and gets skipped ahead while it reads.
+    threads.emplace_back(new FunctorThread([&slow]() {
+        std::vector<uint8_t> chunk;
+        uint64_t tsUs = 0;
+        uint64_t received = 0;
+        const uint64_t giveUpUs = System::get()->getUnixTimeUs() + 20000000;
+        while (received + slow->dropped() < kChunks) {
+            if (!slow->read(&chunk, &tsUs,
+                            System::get()->getUnixTimeUs() + 1000)) {
+                if (System::get()->getUnixTimeUs() > giveUpUs) {
+                    return -1;
+                }
+                continue;
+            }
+            if (chunk.size() != 4 || chunk[3] != uint8_t(chunk[0] + 3)) {
+                return -1;
+            }
+            if (++received % 100 == 0) {
+                System::get()->sleepMs(1);
+            }
+        }
+        return 0;
+    }));
+    ASSERT_TRUE(threads.back()->start());
+
+    // Keep within a ring of the other readers, so that they see every chunk.
+    // A chunk can still be dropped for everyone if it needs the slot the slow
+    // reader is copying, retry those.
+    for (int i = 0; i < kChunks; ++i) {
+        for (const auto& done : progress) {
+            while (i - done.load() >= AudioCaptureHub::kSlots) {
+                System::get()->yield();
+            }
+        }
+        while (mEngine.send(i, 4) != 0) {
+            System::get()->yield();
+        }
+    }
+    for (auto& thread : threads) {
+        intptr_t result = -1;
+        thread->wait(&result);
+        EXPECT_EQ(0, result);
+    }
+    for (const auto& reader : readers) {
+        EXPECT_EQ(0u, reader->dropped());
+    }
+    EXPECT_LT(0u, slow->dropped());
+}
+
+}  // namespace recording
+}  // namespace android
@@ -0,0 +1,252 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/recording/audio/AudioConverter.h"
+
+#include <math.h>    // for lrintf, sin, sqrt
+#include <string.h>  // for memcpy
+
+#include <algorithm>  // for min, max
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define HAS_SSE_DOT_PRODUCT 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define HAS_NEON_DOT_PRODUCT 1
+#endif
+
+namespace android {
+namespace recording {
+
+namespace {
+
+// Taps per phase when upsampling. Downsampling needs proportionally more to
+// keep the same transition band at the lower cutoff.
+constexpr int kTapsPerPhase = 32;
+constexpr int kMaxTapsPerPhase = 256;
+// Where the passband ends, as a fraction of the lower Nyquist frequency.
+constexpr double kPassband = 0.9;
+// Kaiser window shape, about 70dB of stopband attenuation.
+constexpr double kKaiserBeta = 7.0;
+constexpr double kPi = 3.14159265358979323846;
+
+int gcd(int a, int b) {
+    while (b != 0) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// Zeroth order modified Bessel function of the first kind.
+double besselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; k < 32; ++k) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+// |n| is a multiple of 4.
+float dotProduct(const float* a, const float* b, int n) {
+#if defined(HAS_SSE_DOT_PRODUCT)
+    __m128 sum = _mm_setzero_ps();
+    for (int i = 0; i < n; i += 4) {
+        sum = _mm_add_ps(sum,
+                         _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    float lanes[4];
+    _mm_storeu_ps(lanes, sum);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(HAS_NEON_DOT_PRODUCT)
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    for (int i = 0; i < n; i += 4) {
+        sum = vmlaq_f32(sum, vld1q_f32(a + i), vld1q_f32(b + i));
+    }
+    return vaddvq_f32(sum);
+#else
+    float sum = 0.0f;
+    for (int i = 0; i < n; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+#endif
+}
+
+}  // namespace
+
+PolyphaseResampler::PolyphaseResampler(int inRate, int outRate, int channels)
+    : mChannels(channels), mHistory(channels) {
+    const int common = gcd(inRate, outRate);
+    mUp = outRate / common;
+    mDown = inRate / common;
+
+    int taps = kTapsPerPhase;
+    if (mDown > mUp) {
+        taps = (kTapsPerPhase * mDown + mUp - 1) / mUp;
+    }
+    mTaps = (std::min(taps, kMaxTapsPerPhase) + 3) & ~3;
+
+    // The prototype low pass filter runs at the upsampled rate, where the
+    // lower of the two Nyquist frequencies is 0.5 / max(up, down) cycles per
+    // sample. Its gain makes up for the zeros upsampling inserts.
+    const int length = mTaps * mUp;
+    const double cutoff = kPassband * 0.5 / std::max(mUp, mDown);
+    const double center = (length - 1) / 2.0;
+    const double norm = besselI0(kKaiserBeta);
+    std::vector<double> prototype(length);
+    for (int n = 0; n < length; ++n) {
+        const double t = n - center;
+        const double sinc =
+                t == 0 ? 2.0 * cutoff : sin(2.0 * kPi * cutoff * t) / (kPi * t);
+        const double r = 2.0 * n / (length - 1) - 1.0;
+        const double window =
+                besselI0(kKaiserBeta * sqrt(std::max(0.0, 1.0 - r * r))) /
+                norm;
+        prototype[n] = mUp * sinc * window;
+    }
+
+    // Output sample n sits at n * down in the upsampled signal, that is
+    // input sample i = n * down / up plus phase p = n * down % up, and is
+    // the sum of prototype[k * up + p] * input[i - k]. Each phase is stored
+    // in the order of the input, so that it lines up with mHistory.
+    mCoefs.resize(mUp * mTaps);
+    for (int p = 0; p < mUp; ++p) {
+        for (int j = 0; j < mTaps; ++j) {
+            mCoefs[p * mTaps + j] = prototype[(mTaps - 1 - j) * mUp + p];
+        }
+    }
+
+    // The first outputs see silence before the stream started.
+    for (auto& history : mHistory) {
+        history.assign(mTaps - 1, 0.0f);
+    }
+}
+
+void PolyphaseResampler::process(const float* in,
+                                 int frames,
+                                 std::vector<float>* out) {
+    const int skip = std::min(mSkip, frames);
+    in += skip * mChannels;
+    frames -= skip;
+    mSkip -= skip;
+
+    for (int c = 0; c < mChannels; ++c) {
+        std::vector<float>& history = mHistory[c];
+        const size_t offset = history.size();
+        history.resize(offset + frames);
+        for (int i = 0; i < frames; ++i) {
+            history[offset + i] = in[i * mChannels + c];
+        }
+    }
+
+    const int available = mHistory[0].size();
+    int start = 0;
+    while (start + mTaps <= available) {
+        const float* coefs = &mCoefs[mPhase * mTaps];
+        for (int c = 0; c < mChannels; ++c) {
+            out->push_back(dotProduct(coefs, &mHistory[c][start], mTaps));
+        }
+        const int next = mPhase + mDown;
+        start += next / mUp;
+        mPhase = next % mUp;
+    }
+
+    // Keep what the next output needs. When downsampling by a lot, that
+    // may start past the input we have.
+    for (auto& history : mHistory) {
+        history.erase(history.begin(),
+                      history.begin() + std::min(start, available));
+    }
+    mSkip = std::max(0, start - available);
+}
+
+AudioConverter::AudioConverter(const AudioSpec& from, const AudioSpec& to)
+    : mFrom(from), mTo(to) {
+    if (mFrom.sampleRate != mTo.sampleRate) {
+        mResampler.reset(new PolyphaseResampler(mFrom.sampleRate,
+                                                mTo.sampleRate, mTo.channels));
+    }
+}
+
+void AudioConverter::convert(const void* data,
+                             size_t size,
+                             std::vector<uint8_t>* out) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    if (passthrough()) {
+        out->insert(out->end(), bytes, bytes + size);
+        return;
+    }
+
+    // To float, in the output channel layout.
+    const int frames = size / mFrom.bytesPerFrame();
+    const int inChannels = mFrom.channels;
+    const int outChannels = mTo.channels;
+    mInput.resize(frames * outChannels);
+    for (int i = 0; i < frames; ++i) {
+        float samples[2] = {0.0f, 0.0f};
+        for (int c = 0; c < inChannels; ++c) {
+            const int index = i * inChannels + c;
+            float sample;
+            if (mFrom.format == AudioFormat::AUD_FMT_U8) {
+                sample = (bytes[index] - 128) / 128.0f;
+            } else {
+                int16_t value;
+                memcpy(&value, bytes + 2 * index, sizeof(value));
+                sample = value / 32768.0f;
+            }
+            if (outChannels == 1) {
+                samples[0] += sample / inChannels;
+            } else {
+                samples[std::min(c, 1)] = sample;
+            }
+        }
+        if (outChannels == 2 && inChannels == 1) {
+            samples[1] = samples[0];
+        }
+        for (int c = 0; c < outChannels; ++c) {
+            mInput[i * outChannels + c] = samples[std::min(c, 1)];
+        }
+    }
+
+    const std::vector<float>* samples = &mInput;
+    if (mResampler) {
+        mResampled.clear();
+        mResampler->process(mInput.data(), frames, &mResampled);
+        samples = &mResampled;
+    }
+
+    // And to the output format.
+    const size_t offset = out->size();
+    out->resize(offset + samples->size() * getAudioFormatSize(mTo.format));
+    uint8_t* dst = out->data() + offset;
+    for (float sample : *samples) {
+        if (mTo.format == AudioFormat::AUD_FMT_U8) {
+            *dst++ = static_cast<uint8_t>(
+                    std::min(255L, std::max(0L, lrintf(sample * 128.0f) + 128)));
+        } else {
+            const int16_t value = static_cast<int16_t>(std::min(
+                    32767L, std::max(-32768L, lrintf(sample * 32768.0f))));
+            memcpy(dst, &value, sizeof(value));
+            dst += sizeof(value);
+        }
+    }
+}
+
+}  // namespace recording
+}  // namespace android
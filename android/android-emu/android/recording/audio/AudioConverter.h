@@ -0,0 +1,103 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for uint8_t
+#include <memory>    // for unique_ptr
+#include <vector>    // for vector
+
+#include "android/recording/Frame.h"  // for AudioFormat
+
+namespace android {
+namespace recording {
+
+// The layout of interleaved PCM audio.
+struct AudioSpec {
+    int sampleRate = 44100;
+    int channels = 2;
+    AudioFormat format = AudioFormat::AUD_FMT_S16;
+
+    int bytesPerFrame() const {
+        return channels * getAudioFormatSize(format);
+    }
+
+    bool operator==(const AudioSpec& other) const {
+        return sampleRate == other.sampleRate && channels == other.channels &&
+               format == other.format;
+    }
+    bool operator!=(const AudioSpec& other) const { return !(*this == other); }
+};
+
+// Converts the sample rate of interleaved float audio with a polyphase
+// windowed sinc filter. The rates are reduced to a ratio up/down, and every
+// output sample is a single dot product with one of |up| sets of taps, so
+// the cost doesn't depend on how awkward the ratio is (44.1kHz to 48kHz is
+// 160/147). The dot products use SSE or NEON when available.
+class PolyphaseResampler {
+public:
+    PolyphaseResampler(int inRate, int outRate, int channels);
+
+    // Resamples |frames| interleaved frames, and appends the result to
+    // |out|. Keeps enough of the input to carry on seamlessly on the next
+    // call.
+    void process(const float* in, int frames, std::vector<float>* out);
+
+    int taps() const { return mTaps; }
+
+private:
+    int mUp;
+    int mDown;
+    int mChannels;
+    // Taps per phase, a multiple of 4.
+    int mTaps;
+    // mUp sets of mTaps coefficients, each in the order of the input.
+    std::vector<float> mCoefs;
+    // One row of past and pending input per channel, the first sample of
+    // each is the oldest one the next output needs.
+    std::vector<std::vector<float>> mHistory;
+    // Phase of the next output sample, in [0, mUp).
+    int mPhase = 0;
+    // Input frames to drop before the next output, when downsampling
+    // skipped past the end of the previous input.
+    int mSkip = 0;
+};
+
+// Converts interleaved PCM between sample formats, channel counts (mono and
+// stereo) and sample rates. Buffers are kept across calls, so a converter
+// doesn't allocate once it has seen the largest chunk it will get.
+class AudioConverter {
+public:
+    AudioConverter(const AudioSpec& from, const AudioSpec& to);
+
+    const AudioSpec& from() const { return mFrom; }
+    const AudioSpec& to() const { return mTo; }
+
+    // True if audio is copied as is.
+    bool passthrough() const { return mFrom == mTo; }
+
+    // Converts |size| bytes of whole frames and appends them to |out|.
+    void convert(const void* data, size_t size, std::vector<uint8_t>* out);
+
+private:
+    AudioSpec mFrom;
+    AudioSpec mTo;
+    std::vector<float> mInput;
+    std::vector<float> mResampled;
+    std::unique_ptr<PolyphaseResampler> mResampler;
+};
+
+}  // namespace recording
+}  // namespace android
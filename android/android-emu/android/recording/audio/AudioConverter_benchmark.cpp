@@ -0,0 +1,166 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures what the shared audio path costs: converting captured audio to
+// the formats consumers ask for, and handing it from the QEMU io thread to
+// a number of readers.
+
+#include "android/recording/audio/AudioConverter.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "android/base/system/System.h"
+#include "android/base/threads/FunctorThread.h"
+#include "android/emulation/AudioCapture.h"
+#include "android/emulation/AudioCaptureEngine.h"
+#include "android/recording/audio/AudioCaptureHub.h"
+#include "benchmark/benchmark_api.h"
+
+using android::base::FunctorThread;
+using android::base::System;
+using android::emulation::AudioCaptureEngine;
+using android::emulation::AudioCapturer;
+using android::recording::AudioCaptureHub;
+using android::recording::AudioConverter;
+using android::recording::AudioSpec;
+
+namespace {
+
+// What QEMU hands over at a time.
+constexpr int kChunkFrames = 1024;
+
+std::vector<int16_t> makeChunk() {
+    std::vector<int16_t> chunk(kChunkFrames * 2);
+    for (int i = 0; i < kChunkFrames; ++i) {
+        chunk[2 * i] = lrint(12000 * sin(i * 0.0627));
+        chunk[2 * i + 1] = lrint(12000 * sin(i * 0.0311));
+    }
+    return chunk;
+}
+
+// range_x() is the output rate, range_y() the output channels.
+void BM_Convert(benchmark::State& state) {
+    const AudioSpec native;
+    AudioSpec to;
+    to.sampleRate = state.range_x();
+    to.channels = state.range_y();
+    AudioConverter converter(native, to);
+    const auto chunk = makeChunk();
+    std::vector<uint8_t> out;
+    const uint64_t startUs = System::get()->getHighResTimeUs();
+    while (state.KeepRunning()) {
+        out.clear();
+        converter.convert(chunk.data(), chunk.size() * 2, &out);
+    }
+    const uint64_t elapsedUs = System::get()->getHighResTimeUs() - startUs;
+
+    // How many seconds of audio a core converts in a second.
+    const double audioUs = 1000000.0 * state.iterations() * kChunkFrames /
+                           native.sampleRate;
+    char label[64];
+    snprintf(label, sizeof(label), "%.0fx realtime",
+             elapsedUs ? audioUs / elapsedUs : 0.0);
+    state.SetLabel(label);
+    state.SetItemsProcessed(state.iterations() * kChunkFrames);
+}
+
+class BenchmarkAudioCaptureEngine : public AudioCaptureEngine {
+public:
+    int start(AudioCapturer* capturer) override {
+        mCapturer = capturer;
+        return 0;
+    }
+    int stop(AudioCapturer* capturer) override {
+        mCapturer = nullptr;
+        return 0;
+    }
+
+    AudioCapturer* mCapturer = nullptr;
+};
+
+// range_x() is the number of readers. Every iteration hands a chunk to the
+// hub as QEMU would, and waits until all readers have it.
+void BM_HubFanOut(benchmark::State& state) {
+    BenchmarkAudioCaptureEngine engine;
+    AudioCaptureEngine::set(&engine);
+    const int readerCount = state.range_x();
+    {
+        AudioCaptureHub hub;
+        std::vector<std::unique_ptr<AudioCaptureHub::Reader>> readers;
+        for (int i = 0; i < readerCount; ++i) {
+            readers.push_back(hub.subscribe());
+        }
+
+        std::atomic<uint64_t> received{0};
+        std::atomic<uint64_t> latencyUs{0};
+        std::vector<std::unique_ptr<FunctorThread>> threads;
+        for (auto& reader : readers) {
+            AudioCaptureHub::Reader* r = reader.get();
+            threads.emplace_back(new FunctorThread([r, &received,
+                                                    &latencyUs]() {
+                std::vector<uint8_t> chunk;
+                uint64_t tsUs = 0;
+                while (r->read(&chunk, &tsUs, UINT64_MAX / 2)) {
+                    latencyUs += System::get()->getHighResTimeUs() - tsUs;
+                    ++received;
+                }
+                return 0;
+            }));
+            threads.back()->start();
+        }
+
+        // Small enough to fit in a single slot.
+        const std::vector<uint8_t> chunk(AudioCaptureHub::kSlotBytes);
+        uint64_t sent = 0;
+        while (state.KeepRunning()) {
+            engine.mCapturer->onSample(const_cast<uint8_t*>(chunk.data()),
+                                       chunk.size());
+            sent += readerCount;
+            while (received < sent) {
+                System::get()->yield();
+            }
+        }
+
+        for (auto& reader : readers) {
+            reader->stop();
+        }
+        for (auto& thread : threads) {
+            thread->wait();
+        }
+
+        char label[64];
+        snprintf(label, sizeof(label), "latency %.1f us",
+                 sent ? double(latencyUs) / sent : 0.0);
+        state.SetLabel(label);
+        state.SetItemsProcessed(state.iterations());
+    }
+    AudioCaptureEngine::set(nullptr);
+}
+
+}  // namespace
+
+// The formats the recorder, gRPC and WebRTC ask for.
+BENCHMARK(BM_Convert)
+        ->ArgPair(44100, 1)
+        ->ArgPair(48000, 2)
+        ->ArgPair(16000, 1)
+        ->ArgPair(8000, 1);
+BENCHMARK(BM_HubFanOut)->Arg(1)->Arg(3)->UseRealTime();
+
+BENCHMARK_MAIN()
@@ -0,0 +1,174 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/recording/audio/AudioConverter.h"
+
+#include <gtest/gtest.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <vector>
+
+namespace android {
+namespace recording {
+
+namespace {
+
+AudioSpec spec(int sampleRate, int channels, AudioFormat format) {
+    AudioSpec spec;
+    spec.sampleRate = sampleRate;
+    spec.channels = channels;
+    spec.format = format;
+    return spec;
+}
+
+std::vector<int16_t> toSamples(const std::vector<uint8_t>& bytes) {
+    std::vector<int16_t> samples(bytes.size() / 2);
+    memcpy(samples.data(), bytes.data(), samples.size() * 2);
+    return samples;
+}
+
+// Stereo S16 with a sine of |hz| on the left and silence on the right.
+std::vector<int16_t> sine(int sampleRate, double hz, int frames) {
+    std::vector<int16_t> samples(frames * 2);
+    for (int i = 0; i < frames; ++i) {
+        samples[2 * i] = lrint(16000 * sin(2 * M_PI * hz * i / sampleRate));
+    }
+    return samples;
+}
+
+// The amplitude and frequency of the sine on the left channel, measured
+// away from the start where the filter is still filling up.
+void measure(const std::vector<int16_t>& samples,
+             int sampleRate,
+             double* amplitude,
+             double* hz) {
+    const int frames = samples.size() / 2;
+    const int first = frames / 4;
+    double power = 0;
+    int crossings = 0;
+    int firstCrossing = -1;
+    int lastCrossing = -1;
+    for (int i = first; i < frames; ++i) {
+        power += double(samples[2 * i]) * samples[2 * i];
+        EXPECT_GE(50, abs(samples[2 * i + 1])) << "at " << i;
+        if (samples[2 * (i - 1)] < 0 && samples[2 * i] >= 0) {
+            if (firstCrossing < 0) {
+                firstCrossing = i;
+            } else {
+                ++crossings;
+            }
+            lastCrossing = i;
+        }
+    }
+    *amplitude = sqrt(2 * power / (frames - first));
+    *hz = crossings * double(sampleRate) / (lastCrossing - firstCrossing);
+}
+
+}  // namespace
+
+TEST(AudioConverter, Passthrough) {
+    const AudioSpec native;
+    AudioConverter converter(native, native);
+    EXPECT_TRUE(converter.passthrough());
+
+    const std::vector<uint8_t> in = {1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<uint8_t> out = {9};
+    converter.convert(in.data(), in.size(), &out);
+    EXPECT_EQ(std::vector<uint8_t>({9, 1, 2, 3, 4, 5, 6, 7, 8}), out);
+}
+
+TEST(AudioConverter, FormatAndChannels) {
+    const std::vector<int16_t> stereo = {-32768, 32767, 0, 256, 1000, 3000};
+
+    AudioConverter toMono(spec(44100, 2, AudioFormat::AUD_FMT_S16),
+                          spec(44100, 1, AudioFormat::AUD_FMT_S16));
+    EXPECT_FALSE(toMono.passthrough());
+    std::vector<uint8_t> out;
+    toMono.convert(stereo.data(), stereo.size() * 2, &out);
+    EXPECT_EQ(std::vector<int16_t>({0, 128, 2000}), toSamples(out));
+
+    AudioConverter toU8(spec(44100, 2, AudioFormat::AUD_FMT_S16),
+                        spec(44100, 2, AudioFormat::AUD_FMT_U8));
+    out.clear();
+    toU8.convert(stereo.data(), stereo.size() * 2, &out);
+    EXPECT_EQ(std::vector<uint8_t>({0, 255, 128, 129, 132, 140}), out);
+
+    // And back, with the same channel on both sides.
+    const std::vector<uint8_t> mono = {0, 128, 192};
+    AudioConverter fromU8(spec(44100, 1, AudioFormat::AUD_FMT_U8),
+                          spec(44100, 2, AudioFormat::AUD_FMT_S16));
+    out.clear();
+    fromU8.convert(mono.data(), mono.size(), &out);
+    EXPECT_EQ(std::vector<int16_t>({-32768, -32768, 0, 0, 16384, 16384}),
+              toSamples(out));
+}
+
+TEST(AudioConverter, Resample) {
+    const struct {
+        int from;
+        int to;
+    } kRates[] = {{44100, 48000}, {48000, 44100}, {48000, 16000},
+                  {16000, 44100}, {44100, 8000}};
+    constexpr double kHz = 1000;
+    for (const auto& rates : kRates) {
+        SCOPED_TRACE(testing::Message() << rates.from << " to " << rates.to);
+        AudioConverter converter(spec(rates.from, 2, AudioFormat::AUD_FMT_S16),
+                                 spec(rates.to, 2, AudioFormat::AUD_FMT_S16));
+
+        // Half a second, in chunks the size QEMU hands over.
+        const auto in = sine(rates.from, kHz, rates.from / 2);
+        std::vector<uint8_t> out;
+        for (size_t pos = 0; pos < in.size(); pos += 1024) {
+            const size_t count = std::min<size_t>(1024, in.size() - pos);
+            converter.convert(&in[pos], count * 2, &out);
+        }
+
+        // All of it, less what the filter holds back.
+        const int frames = out.size() / 4;
+        const int expected = rates.to / 2;
+        EXPECT_GE(expected, frames);
+        EXPECT_LE(expected - 300 * rates.to / rates.from - 1, frames);
+
+        double amplitude = 0;
+        double hz = 0;
+        measure(toSamples(out), rates.to, &amplitude, &hz);
+        EXPECT_NEAR(16000, amplitude, 200);
+        EXPECT_NEAR(kHz, hz, 5);
+    }
+}
+
+TEST(AudioConverter, ResampleRemovesAliases) {
+    // 20kHz can't be shown at 16kHz, and must not fold back as 4kHz.
+    AudioConverter converter(spec(48000, 2, AudioFormat::AUD_FMT_S16),
+                             spec(16000, 2, AudioFormat::AUD_FMT_S16));
+    const auto in = sine(48000, 20000, 48000 / 4);
+    std::vector<uint8_t> out;
+    converter.convert(in.data(), in.size() * 2, &out);
+    const auto samples = toSamples(out);
+    ASSERT_LT(1000u, samples.size());
+    for (size_t i = 1000; i < samples.size(); i += 2) {
+        EXPECT_GE(100, abs(samples[i])) << "at " << i / 2;
+    }
+}
+
+TEST(PolyphaseResampler, Taps) {
+    EXPECT_EQ(32, PolyphaseResampler(44100, 48000, 2).taps());
+    EXPECT_EQ(96, PolyphaseResampler(48000, 16000, 2).taps());
+    EXPECT_EQ(0, PolyphaseResampler(44100, 8000, 1).taps() % 4);
+}
+
+}  // namespace recording
+}  // namespace android
@@ -14,109 +14,64 @@
 
 #include "android/recording/audio/AudioProducer.h"
 
-#include <assert.h>                                       // for assert
-#include <limits.h>                                       // for CHAR_BIT
-#include <stddef.h>                                       // for size_t
-#include <stdint.h>                                       // for uint64_t
-#include <functional>                                     // for function
-#include <memory>                                         // for unique_ptr
-#include <new>                                            // for operator new
-#include <utility>                                        // for move
-#include <vector>                                         // for vector
-
-#include "android/base/Log.h"                             // for LOG, LogMes...
-#include "android/base/Optional.h"                        // for Optional
-#include "android/base/synchronization/MessageChannel.h"  // for MessageChannel
-#include "android/base/system/System.h"                   // for System
-#include "android/emulation/AudioCapture.h"               // for AudioCapturer
-#include "android/emulation/AudioCaptureEngine.h"         // for AudioCaptur...
-#include "android/recording/Producer.h"                   // for Producer
-#include "android/utils/debug.h"                          // for VERBOSE_PRINT
+#include <assert.h>                                   // for assert
+#include <stddef.h>                                   // for size_t
+#include <stdint.h>                                   // for uint64_t
+#include <algorithm>                                  // for min
+#include <functional>                                 // for function
+#include <memory>                                     // for unique_ptr
+#include <vector>                                     // for vector
+
+#include "android/base/Log.h"                         // for LOG, LogMes...
+#include "android/base/synchronization/Lock.h"        // for AutoLock, Lock
+#include "android/base/system/System.h"               // for System
+#include "android/recording/Producer.h"               // for Producer
+#include "android/recording/audio/AudioCaptureHub.h"  // for AudioCaptu...
+#include "android/recording/audio/AudioConverter.h"   // for AudioConverter
+#include "android/utils/debug.h"                      // for VERBOSE_PRINT
 
 #define D(...) VERBOSE_PRINT(record, __VA_ARGS__);
 
 namespace android {
 namespace recording {
 
-using android::base::MessageChannel;
-using android::emulation::AudioCaptureEngine;
-using android::emulation::AudioCapturer;
+using android::base::AutoLock;
 
 namespace {
-class AudioCapturerImpl : public AudioCapturer {
-public:
-    using Callback = std::function<int(const void* buf, int size)>;
-    explicit AudioCapturerImpl(Callback cb, int freq, int bits, int nchannels)
-        : AudioCapturer(freq, bits, nchannels), mCallback(std::move(cb)) {
-        assert(mCallback);
-    }
-
-    // Start the audio capturer
-    bool start() {
-        auto engine = AudioCaptureEngine::get();
-        if (!engine) {
-            return false;
-        }
-
-        return engine->start(this) == 0;
-    }
-
-    // Stop the audio capturer
-    bool stop() {
-        auto engine = AudioCaptureEngine::get();
-        if (!engine) {
-            return false;
-        }
 
-        return engine->stop(this) == 0;
-    }
-
-    virtual ~AudioCapturerImpl() {
-        // Doesn't hurt to stop the audio capture engine even if we stopped it
-        // already
-        auto engine = AudioCaptureEngine::get();
-        if (engine) {
-            engine->stop(this);
-        }
-    }
-
-    // Called from the qemu io thread with the audio data
-    virtual int onSample(void* buf, int size) override {
-        return mCallback(buf, size);
-    }
-
-private:
-    Callback mCallback;
-};  // class AudioCapturerImpl
+AudioSpec makeSpec(int sampleRate, AudioFormat format, int nchannels) {
+    AudioSpec spec;
+    spec.sampleRate = sampleRate;
+    spec.channels = nchannels;
+    spec.format = format;
+    return spec;
+}
 
-// Implementation of Producer class for audio data
+// Implementation of Producer class for audio data. Reads the audio shared by
+// AudioCaptureHub, and converts it to what was asked for on its own thread.
 class AudioProducer : public Producer {
 public:
     explicit AudioProducer(int sampleRate,
                            int nbSamples,
                            AudioFormat format,
                            int nchannels)
-        : mSampleRate(sampleRate),
-          mNbSamples(nbSamples),
-          mChannels(nchannels) {
+        : mConverter(AudioCaptureHub::get()->spec(),
+                     makeSpec(sampleRate, format, nchannels)) {
         mFormat.audioFormat = format;
-        size_t szBytes = getAudioFormatSize(mFormat.audioFormat);
+        const int bytesPerFrame = mConverter.to().bytesPerFrame();
 
-        mFrameSize = mNbSamples * mChannels * szBytes;
-        double bytesPerSecond = (double)mSampleRate * mChannels * szBytes;
-        double secPerFrame = ((double)mFrameSize) / bytesPerSecond;
-        mMicroSecondsPerFrame = (uint64_t)(secPerFrame * 1000000);
+        mFrameSize = nbSamples * bytesPerFrame;
+        mBytesPerUs = sampleRate * bytesPerFrame / 1000000.0;
+        mMicroSecondsPerFrame = (uint64_t)(mFrameSize / mBytesPerUs);
 
         // 4 silent frames makes Chrome very happy
         mNbSilentFrames = 4;
         mSilentFrames.reset(new Frame(mNbSilentFrames * mFrameSize, 0));
 
-        // Prefill the free queue with empty packets
-        for (int i = 0; i < kMaxFrames; ++i) {
-            Frame f(mNbSamples * mChannels * szBytes);
-            f.format.audioFormat = mFormat.audioFormat;
-            mFreeQueue.send(std::move(f));
-        }
+        // Everything below is reused for every frame.
+        mFrame.dataVec.reserve(mFrameSize);
+        mFrame.format.audioFormat = format;
+        mChunk.reserve(AudioCaptureHub::kSlotBytes);
     }
 
     virtual ~AudioProducer() { stop(); }
@@ -124,16 +79,19 @@ public:
     intptr_t main() final {
         assert(mCallback);
 
-        // Start the audio capturer to start receiving audio frames.
-        mAudioCapturer.reset(new AudioCapturerImpl(
-                [this](const void* buf, int size) -> int {
-                    return onSample(buf, size);
-                },
-                mSampleRate, getAudioFormatSize(mFormat.audioFormat) * CHAR_BIT,
-                mChannels));
-        if (!mAudioCapturer->start()) {
-            LOG(ERROR) << "Unable to start audio capturer";
-            return -1;
+        // Start receiving audio frames.
+        AudioCaptureHub::Reader* reader;
+        {
+            AutoLock lock(mLock);
+            if (mStopped) {
+                return 0;
+            }
+            mReader = AudioCaptureHub::get()->subscribe();
+            if (!mReader) {
+                LOG(ERROR) << "Unable to start audio capturer";
+                return -1;
+            }
+            reader = mReader.get();
         }
 
         int i = 0;
@@ -145,11 +103,10 @@ public:
             //   ConditionVariable::timedWait()
             auto future = base::System::get()->getUnixTimeUs() +
                           mNbSilentFrames * mMicroSecondsPerFrame;
-            // Blocks until either we get a packet, timeout or the queue is
-            // closed.
-            auto frame = mDataQueue.timedReceive(future);
-            if (!frame) {
-                if (mDataQueue.isStopped()) {
+            // Blocks until either we get a chunk, timeout or we are stopped.
+            uint64_t tsUs = 0;
+            if (!reader->read(&mChunk, &tsUs, future)) {
+                if (reader->stopped()) {
                     break;
                 }
                 // insert silent audio
@@ -161,94 +118,59 @@ public:
                 D("Inserting silent frames %d (size=%u, tsUs=%lu)\n", i++,
                   mSilentFrames->dataVec.size(), mSilentFrames->tsUs);
                 mCallback(mSilentFrames.get());
-            } else {
-                last_pts = frame->tsUs;
-                D("Encoding audio frame %d (size=%u, tsUs=%lu)\n", i++,
-                  frame->dataVec.size(), frame->tsUs);
-                mCallback(&*frame);
+                continue;
+            }
 
-                // Blocks until there is space in the queue or is closed.
-                if (!mFreeQueue.send(std::move(*frame))) {
-                    break;
-                }
+            mConverted.clear();
+            mConverter.convert(mChunk.data(), mChunk.size(), &mConverted);
+
+            // Hand it over in frames of at most mFrameSize.
+            for (size_t pos = 0; pos < mConverted.size(); pos += mFrameSize) {
+                const size_t sz =
+                        std::min<size_t>(mFrameSize, mConverted.size() - pos);
+                mFrame.dataVec.assign(mConverted.begin() + pos,
+                                      mConverted.begin() + pos + sz);
+                mFrame.tsUs = tsUs + (uint64_t)(pos / mBytesPerUs);
+                last_pts = mFrame.tsUs;
+                D("Encoding audio frame %d (size=%u, tsUs=%lu)\n", i++,
+                  mFrame.dataVec.size(), mFrame.tsUs);
+                mCallback(&mFrame);
             }
         }
 
+        AutoLock lock(mLock);
+        mReader.reset();
         return 0;
     }
 
     virtual void stop() override {
-        if (!mAudioCapturer) {
-            return;
+        AutoLock lock(mLock);
+        mStopped = true;
+        if (mReader) {
+            mReader->stop();
         }
-
-        mAudioCapturer->stop();
-        mDataQueue.stop();
-        mFreeQueue.stop();
     }
 
 private:
-    // Called from the qemu io thread. Keep this as fast as possible.
-    int onSample(const void* buf, int size) {
-        if (buf == nullptr || size <= 0) {
-            return -1;
-        }
-
-        // Producer
-        int remaining = size;
-        auto p = static_cast<const uint8_t*>(buf);
-        while (remaining > 0) {
-            // Get the timestamp first as dequeuing the buffer and memcpying
-            // will take some time.
-            auto tsUs = android::base::System::get()->getHighResTimeUs();
-            Frame frame;
-            // Use non-blocking call here because we want to avoid blocking the
-            // io thread. If we can't get a packet, just let this audio packet
-            // go.
-            if (!mFreeQueue.tryReceive(&frame)) {
-                return -1;
-            }
-
-            int sz = remaining > frame.dataVec.capacity()
-                             ? frame.dataVec.capacity()
-                             : remaining;
-            frame.dataVec.assign(p, p + sz);
-            p += sz;
-            frame.tsUs = tsUs;
-            remaining -= sz;
-            // MessageChannel::send is a blocking call, but since we should
-            // never be exceeding the capacity of the channel (kMaxFrames),
-            // this call should never block.
-            mDataQueue.send(std::move(frame));
-        }
-
-        return 0;
-    }
-
-    int mSampleRate = 0;
-    int mNbSamples = 0;
-    int mChannels = 0;
+    AudioConverter mConverter;
     int mFrameSize = 0;
+    double mBytesPerUs = 0;
     // micro seconds per frame
     uint64_t mMicroSecondsPerFrame = 0;
 
     int mNbSilentFrames = 0;
     std::unique_ptr<Frame> mSilentFrames;
 
-    std::unique_ptr<AudioCapturerImpl> mAudioCapturer;
-    // mDataQueue contains filled audio frames and mFreeQueue has available
-    // audio frames that the producer can use. The workflow is as follows:
-    // Producer:
-    //   1) get an audio frame from mFreeQueue
-    //   2) write data into frame
-    //   3) push frame to mDataQueue
-    // Consumer:
-    //   1) wait for audio frame in mDataQueue
-    //   2) process audio frame
-    //   3) Push frame back to mFreeQueue
-    static constexpr int kMaxFrames = 3;
-    MessageChannel<Frame, kMaxFrames> mDataQueue;
-    MessageChannel<Frame, kMaxFrames> mFreeQueue;
+    // A chunk of audio as captured, after conversion, and the frame it is
+    // handed over in.
+    std::vector<uint8_t> mChunk;
+    std::vector<uint8_t> mConverted;
+    Frame mFrame;
+
+    // Guards mReader, as stop() can be called from any thread.
+    base::Lock mLock;
+    bool mStopped = false;
+    std::unique_ptr<AudioCaptureHub::Reader> mReader;
 };  // class AudioProducer
 }  // namespace
 
@@ -12,14 +12,14 @@
 #include "android/recording/codecs/video/VP9Codec.h"
 
 #include <stddef.h>                      // for NULL
-#include <algorithm>                     // for min
+#include <algorithm>                     // for max, min
 #include <utility>                       // for move
 
 #include "android/base/Log.h"            // for LOG, LogMessage, LogStream
 #include "android/base/system/System.h"  // for System
 
 extern "C" {
-#include <libavutil/dict.h>              // for av_dict_set, av_dict_free
+#include <libavutil/dict.h>              // for av_dict_set, av_dict_free, av_...
 #include <libavutil/rational.h>          // for AVRational
 #include <libswscale/swscale.h>          // for sws_getContext, SWS_BICUBIC
 struct SwsContext;
@@ -52,8 +52,10 @@ bool VP9Codec::configAndOpenEncoder(const AVFormatContext* oc,
     c->bit_rate = mParams.bitrate;
     c->width = mParams.width;
     c->height = mParams.height;
-    c->thread_count =
-            std::min(8, android::base::System::get()->getCpuCoreCount() * 2);
+    // libvpx spreads the tile columns, and with row-mt their rows, over
+    // these threads. See the options below.
+    c->thread_count = std::max(
+            1, std::min(16, android::base::System::get()->getCpuCoreCount()));
 
     // If you use a .WEBM container, the stream time base will automatically get changed
     // to a millisecond time base. Even so, let's explicitly set it anyways just in case
@@ -80,6 +82,17 @@ bool VP9Codec::configAndOpenEncoder(const AVFormatContext* oc,
     AVDictionary* opts = nullptr;
     av_dict_set(&opts, "deadline", "realtime", 0);
     av_dict_set(&opts, "cpu-used", "8", 0);
+    // VP9 tile columns are at least 256 pixels wide; have one per thread
+    // where the width allows. The option is the log2 of the count.
+    int tileColumnsLog2 = 0;
+    while ((2 << tileColumnsLog2) <= c->thread_count &&
+           (256 << (tileColumnsLog2 + 1)) <= c->width) {
+        ++tileColumnsLog2;
+    }
+    av_dict_set_int(&opts, "tile-columns", tileColumnsLog2, 0);
+    // Rows within a tile column in parallel too, for the narrow screens.
+    // Older libvpx builds ignore it.
+    av_dict_set(&opts, "row-mt", "1", 0);
 
     // Open the codec
     int ret = avcodec_open2(c, mCodec, &opts);
@@ -647,6 +647,72 @@ TEST(FfmpegRecorder, Stop) {
     }
 }
 
+// Class that sends all its video frames at once, faster than any encoder
+// can take them. The frames are noise, which is slow to encode.
+class BurstVideoFrameProducer : public android::recording::Producer {
+public:
+    explicit BurstVideoFrameProducer(int frames) : mFrames(frames) {
+        mFormat.videoFormat = VideoFormat::RGBA8888;
+    }
+
+    intptr_t main() final {
+        Frame frame(kFbWidth * kFbHeight *
+                    getVideoFormatSize(mFormat.videoFormat));
+        frame.format.videoFormat = mFormat.videoFormat;
+        uint32_t seed = 1;
+        for (auto& byte : frame.dataVec) {
+            seed = seed * 1103515245 + 12345;
+            byte = seed >> 24;
+        }
+        const uint64_t startUs = System::get()->getHighResTimeUs();
+        for (int i = 0; i < mFrames; ++i) {
+            frame.tsUs = startUs + i * 1000000 / kFPS;
+            mCallback(&frame);
+        }
+        return 0;
+    }
+    virtual void stop() override {}
+
+private:
+    const int mFrames;
+};  // BurstVideoFrameProducer
+
+TEST(FfmpegRecorder, DropsFramesWhenEncoderIsBehind) {
+    TestSystem system("/progdir", System::kProgramBitness, "/homedir",
+                      "/appdir");
+    TestTempDir* dir = system.getTempRoot();
+    std::string outputFile = dir->makeSubPath("unittest.webm");
+
+    constexpr int kFrames = 30;
+    auto recorder = FfmpegRecorder::create(kFbWidth, kFbHeight, outputFile,
+                                           kContainerFormat);
+    EXPECT_TRUE(recorder->isValid());
+    std::unique_ptr<Producer> videoProducer(
+            new BurstVideoFrameProducer(kFrames));
+    CodecParams videoParams;
+    videoParams.width = kFbWidth;
+    videoParams.height = kFbHeight;
+    videoParams.bitrate = kDefaultVideoBitrate;
+    videoParams.fps = kFPS;
+    videoParams.intra_spacing = kIntraSpacing;
+    VP9Codec videoCodec(std::move(videoParams), kFbWidth, kFbHeight,
+                        toAVPixelFormat(videoProducer->getFormat().videoFormat));
+    EXPECT_TRUE(recorder->addVideoTrack(std::move(videoProducer), &videoCodec));
+    EXPECT_EQ(0u, recorder->droppedVideoFrames());
+
+    EXPECT_TRUE(recorder->start());
+    // The producer is done by then, and the encoder still busy with the
+    // first frames.
+    Thread::sleepMs(500);
+    // The frames that fit in the queue are encoded, not dropped, the others
+    // are dropped rather than hold up the producer.
+    const uint64_t dropped = recorder->droppedVideoFrames();
+    EXPECT_GT(dropped, 0u);
+    EXPECT_LT(dropped, uint64_t(kFrames));
+    EXPECT_TRUE(recorder->stop());
+    EXPECT_EQ(dropped, recorder->droppedVideoFrames());
+}
+
 TEST(FfmpegRecorder, RecordRGBA8888AndAudFmtS16) {
     TestSystem system("/progdir", System::kProgramBitness, "/homedir",
                       "/appdir");
@@ -0,0 +1,200 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/recording/video/SharedFrameExchange.h"
+
+#include <string.h>  // for memset
+
+#include "android/base/system/System.h"  // for System
+
+#ifdef __linux__
+#include <limits.h>       // for INT_MAX
+#include <linux/futex.h>  // for FUTEX_WAIT, FUTEX_WAKE
+#include <sys/syscall.h>  // for SYS_futex
+#include <time.h>         // for timespec
+#include <unistd.h>       // for syscall
+#endif
+
+namespace android {
+namespace recording {
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+              "The header is shared across processes");
+
+// The original layout: the header up to |tsUs|, followed by one RGBA frame.
+static constexpr size_t kLegacyHeaderSize = 24;
+static constexpr size_t kLegacyBytesPerPixel = 4;
+static_assert(offsetof(SharedFrameHeader, magic) == kLegacyHeaderSize,
+              "The legacy header must come first");
+
+// Frames start on a cache line.
+static constexpr size_t kSlotAlignment = 64;
+static constexpr size_t kMaxReadAttempts = 4;
+
+static size_t alignSlot(size_t size) {
+    return (size + kSlotAlignment - 1) & ~(kSlotAlignment - 1);
+}
+
+// static
+size_t SharedFrameHeader::regionSize(size_t frameSize) {
+    return alignSlot(sizeof(SharedFrameHeader)) +
+           kSlotCount * alignSlot(frameSize);
+}
+
+SharedFrameWriter::SharedFrameWriter(void* region,
+                                     uint32_t width,
+                                     uint32_t height,
+                                     uint32_t fps,
+                                     size_t frameSize)
+    : mHeader(static_cast<SharedFrameHeader*>(region)) {
+    memset(region, 0, sizeof(SharedFrameHeader));
+    mHeader->width = width;
+    mHeader->height = height;
+    mHeader->fps = fps;
+    mHeader->slotCount = SharedFrameHeader::kSlotCount;
+    mHeader->slotOffset = alignSlot(sizeof(SharedFrameHeader));
+    mHeader->slotSize = alignSlot(frameSize);
+    // Readers check it before anything else.
+    std::atomic_thread_fence(std::memory_order_release);
+    mHeader->magic = SharedFrameHeader::kMagic;
+}
+
+uint8_t* SharedFrameWriter::beginFrame() {
+    // Round robin skips the newest frame, and leaves a reader that is still
+    // on the previous one another frame's time to finish.
+    mWriteSlot = (mHeader->latestSlot.load(std::memory_order_relaxed) + 1) %
+                 SharedFrameHeader::kSlotCount;
+    auto& slot = mHeader->slots[mWriteSlot];
+    slot.seq.store(slot.seq.load(std::memory_order_relaxed) + 1,
+                   std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return reinterpret_cast<uint8_t*>(mHeader) + mHeader->slotOffset +
+           mWriteSlot * mHeader->slotSize;
+}
+
+void SharedFrameWriter::publishFrame(uint32_t frameNumber, uint64_t tsUs) {
+    auto& slot = mHeader->slots[mWriteSlot];
+    slot.frameNumber = frameNumber;
+    slot.tsUs = tsUs;
+    slot.seq.store(slot.seq.load(std::memory_order_relaxed) + 1,
+                   std::memory_order_release);
+
+    mHeader->latestSlot.store(mWriteSlot, std::memory_order_release);
+    mHeader->tsUs = tsUs;
+    mHeader->frameNumber.store(frameNumber, std::memory_order_release);
+#ifdef __linux__
+    // Not FUTEX_PRIVATE_FLAG: the readers live in other processes.
+    syscall(SYS_futex, &mHeader->frameNumber, FUTEX_WAKE, INT_MAX, nullptr,
+            nullptr, 0);
+#endif
+}
+
+SharedFrameReader::SharedFrameReader(const void* region, size_t regionSize)
+    : mHeader(static_cast<const SharedFrameHeader*>(region)),
+      mRegion(static_cast<const uint8_t*>(region)) {
+    if (regionSize < sizeof(SharedFrameHeader)) {
+        return;
+    }
+    if (mHeader->magic != SharedFrameHeader::kMagic) {
+        const size_t frameSize =
+                size_t(mHeader->width) * mHeader->height * kLegacyBytesPerPixel;
+        if (kLegacyHeaderSize + frameSize <= regionSize) {
+            mLegacy = true;
+            mFrameSize = frameSize;
+        }
+        return;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const size_t frameSize =
+            size_t(mHeader->width) * mHeader->height * kLegacyBytesPerPixel;
+    if (mHeader->slotCount == SharedFrameHeader::kSlotCount &&
+        frameSize <= mHeader->slotSize &&
+        mHeader->slotOffset + mHeader->slotCount * mHeader->slotSize <=
+                regionSize) {
+        mFrameSize = frameSize;
+    }
+}
+
+// static
+size_t SharedFrameReader::regionSize(const void* header) {
+    auto info = static_cast<const SharedFrameHeader*>(header);
+    if (info->magic != SharedFrameHeader::kMagic) {
+        return kLegacyHeaderSize +
+               size_t(info->width) * info->height * kLegacyBytesPerPixel;
+    }
+    return info->slotOffset + info->slotCount * info->slotSize;
+}
+
+uint32_t SharedFrameReader::frameNumber() const {
+    return mHeader->frameNumber.load(std::memory_order_acquire);
+}
+
+bool SharedFrameReader::waitForFrame(uint32_t frameNumber,
+                                     uint64_t timeoutUs) const {
+    auto system = base::System::get();
+    const uint64_t deadlineUs = system->getHighResTimeUs() + timeoutUs;
+    for (;;) {
+        if (this->frameNumber() != frameNumber) {
+            return true;
+        }
+        const uint64_t nowUs = system->getHighResTimeUs();
+        if (nowUs >= deadlineUs) {
+            return false;
+        }
+        const uint64_t leftUs = deadlineUs - nowUs;
+#ifdef __linux__
+        // Returns right away if a frame got published in the meantime.
+        struct timespec timeout = {time_t(leftUs / 1000000),
+                                   long(leftUs % 1000000) * 1000};
+        syscall(SYS_futex, &mHeader->frameNumber, FUTEX_WAIT, frameNumber,
+                &timeout, nullptr, 0);
+#else
+        // No cross-process futex here, poll once a millisecond.
+        system->sleepUs(leftUs < 1000 ? leftUs : 1000);
+#endif
+    }
+}
+
+bool SharedFrameReader::read(const ConsumeFunc& consume) const {
+    if (!isValid()) {
+        return false;
+    }
+    if (mLegacy) {
+        consume(mRegion + kLegacyHeaderSize, mFrameSize, frameNumber(),
+                mHeader->tsUs);
+        return true;
+    }
+
+    for (size_t attempt = 0; attempt < kMaxReadAttempts; ++attempt) {
+        const uint32_t index =
+                mHeader->latestSlot.load(std::memory_order_acquire) %
+                SharedFrameHeader::kSlotCount;
+        const auto& slot = mHeader->slots[index];
+        const uint32_t seq = slot.seq.load(std::memory_order_acquire);
+        if (seq & 1) {
+            // Wrapped around already.
+            continue;
+        }
+        consume(mRegion + mHeader->slotOffset + index * mHeader->slotSize,
+                mFrameSize, slot.frameNumber, slot.tsUs);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) == seq) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace recording
+}  // namespace android
@@ -0,0 +1,132 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for uint32_t, uint64_t
+#include <atomic>    // for atomic
+#include <functional>  // for function
+
+namespace android {
+namespace recording {
+
+// The layout of the shared memory region through which the emulator hands
+// video frames to another process, e.g. the WebRTC video bridge.
+//
+// The region starts with this header, followed by |kSlotCount| frames. The
+// writer always fills a slot other than the last published one, then
+// publishes it, so a reader never sees a frame that is being written unless
+// it is so slow that the writer wraps around. Each slot has a sequence
+// number, odd while it is being written, that lets the reader detect that
+// case and read the newest frame again (a seqlock).
+//
+// The first fields match the original single frame layout, so a reader can
+// tell which one it is looking at from |magic|.
+struct SharedFrameHeader {
+    static constexpr uint32_t kMagic = 0x33584656;  // 'VFX3'
+    static constexpr uint32_t kSlotCount = 3;
+
+    struct Slot {
+        std::atomic<uint32_t> seq;
+        uint32_t frameNumber;
+        uint64_t tsUs;
+    };
+
+    uint32_t width;
+    uint32_t height;
+    uint32_t fps;  // Target framerate.
+    // Number of the last published frame. Readers can wait on it with a
+    // futex on Linux.
+    std::atomic<uint32_t> frameNumber;
+    uint64_t tsUs;  // Timestamp of the last published frame.
+
+    uint32_t magic;
+    uint32_t slotCount;
+    uint64_t slotOffset;  // From the start of the region.
+    uint64_t slotSize;
+    std::atomic<uint32_t> latestSlot;
+    uint32_t reserved;
+    Slot slots[kSlotCount];
+
+    // Bytes needed for a region holding |frameSize| byte frames.
+    static size_t regionSize(size_t frameSize);
+};
+
+// Publishes frames to a region that it owns.
+class SharedFrameWriter {
+public:
+    // Initializes the header of |region|, which must be at least
+    // SharedFrameHeader::regionSize(|frameSize|) bytes.
+    SharedFrameWriter(void* region,
+                      uint32_t width,
+                      uint32_t height,
+                      uint32_t fps,
+                      size_t frameSize);
+
+    // Returns the slot to write the next frame to.
+    uint8_t* beginFrame();
+    // Makes the frame written since beginFrame() the newest, and wakes up
+    // the readers waiting for one.
+    void publishFrame(uint32_t frameNumber, uint64_t tsUs);
+
+private:
+    SharedFrameHeader* mHeader;
+    uint32_t mWriteSlot = 0;
+};
+
+// Reads frames from a region mapped read-only.
+class SharedFrameReader {
+public:
+    // |region| is |regionSize| bytes, which must cover at least the header
+    // and one frame.
+    SharedFrameReader(const void* region, size_t regionSize);
+
+    // Returns how many bytes of the region that starts with |header| to map,
+    // given the first sizeof(SharedFrameHeader) bytes of it.
+    static size_t regionSize(const void* header);
+
+    bool isValid() const { return mFrameSize > 0; }
+    // True for the original layout, where the frame is overwritten in place
+    // and may tear.
+    bool isLegacy() const { return mLegacy; }
+
+    uint32_t width() const { return mHeader->width; }
+    uint32_t height() const { return mHeader->height; }
+    uint32_t fps() const { return mHeader->fps; }
+    uint32_t frameNumber() const;
+
+    // Waits up to |timeoutUs| for a frame other than |frameNumber| to be
+    // published. Returns false if none was.
+    bool waitForFrame(uint32_t frameNumber, uint64_t timeoutUs) const;
+
+    // Calls |consume| on the newest frame, in place. As the writer may wrap
+    // around and overwrite it meanwhile, |consume| is called again with the
+    // new newest frame if it did. Returns false if that kept happening, in
+    // which case whatever |consume| saw last may be torn.
+    using ConsumeFunc = std::function<void(const uint8_t* pixels,
+                                           size_t size,
+                                           uint32_t frameNumber,
+                                           uint64_t tsUs)>;
+    bool read(const ConsumeFunc& consume) const;
+
+private:
+    const SharedFrameHeader* mHeader;
+    const uint8_t* mRegion;
+    size_t mFrameSize = 0;
+    bool mLegacy = false;
+};
+
+}  // namespace recording
+}  // namespace android
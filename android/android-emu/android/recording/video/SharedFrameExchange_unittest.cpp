@@ -0,0 +1,212 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/recording/video/SharedFrameExchange.h"
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <atomic>
+#include <vector>
+
+#include "android/base/threads/FunctorThread.h"
+
+namespace android {
+namespace recording {
+
+using android::base::FunctorThread;
+
+namespace {
+
+constexpr uint32_t kWidth = 16;
+constexpr uint32_t kHeight = 8;
+constexpr size_t kFrameSize = kWidth * kHeight * 4;
+
+std::vector<uint64_t> makeRegion(size_t size) {
+    // uint64_t for the alignment of the header.
+    return std::vector<uint64_t>((size + 7) / 8);
+}
+
+void writeFrame(SharedFrameWriter* writer, uint32_t frameNumber) {
+    uint8_t* pixels = writer->beginFrame();
+    memset(pixels, frameNumber & 0xff, kFrameSize);
+    writer->publishFrame(frameNumber, frameNumber * 1000);
+}
+
+// Returns the frame number the pixels were filled with, or -1 if torn.
+int pixelsFrame(const uint8_t* pixels, size_t size) {
+    for (size_t i = 1; i < size; ++i) {
+        if (pixels[i] != pixels[0]) {
+            return -1;
+        }
+    }
+    return pixels[0];
+}
+
+}  // namespace
+
+TEST(SharedFrameExchange, ReadsNewestFrame) {
+    const size_t size = SharedFrameHeader::regionSize(kFrameSize);
+    auto region = makeRegion(size);
+    SharedFrameWriter writer(region.data(), kWidth, kHeight, 30, kFrameSize);
+    SharedFrameReader reader(region.data(), size);
+    ASSERT_TRUE(reader.isValid());
+    EXPECT_FALSE(reader.isLegacy());
+    EXPECT_EQ(size, SharedFrameReader::regionSize(region.data()));
+    EXPECT_EQ(kWidth, reader.width());
+    EXPECT_EQ(kHeight, reader.height());
+    EXPECT_EQ(30u, reader.fps());
+
+    for (uint32_t frame = 1; frame <= 5; ++frame) {
+        writeFrame(&writer, frame);
+        EXPECT_EQ(frame, reader.frameNumber());
+        int seen = 0;
+        EXPECT_TRUE(reader.read([&seen](const uint8_t* pixels, size_t size,
+                                        uint32_t frameNumber, uint64_t tsUs) {
+            EXPECT_EQ(kFrameSize, size);
+            EXPECT_EQ(frameNumber * 1000, tsUs);
+            seen = pixelsFrame(pixels, size);
+        }));
+        EXPECT_EQ(int(frame), seen);
+    }
+}
+
+TEST(SharedFrameExchange, WriterSkipsNewestFrame) {
+    const size_t size = SharedFrameHeader::regionSize(kFrameSize);
+    auto region = makeRegion(size);
+    SharedFrameWriter writer(region.data(), kWidth, kHeight, 30, kFrameSize);
+    SharedFrameReader reader(region.data(), size);
+
+    writeFrame(&writer, 1);
+    // The next frame being written doesn't affect a reader of frame 1.
+    uint8_t* pixels = writer.beginFrame();
+    memset(pixels, 2, kFrameSize);
+    int seen = 0;
+    EXPECT_TRUE(reader.read(
+            [&seen](const uint8_t* pixels, size_t size, uint32_t, uint64_t) {
+                seen = pixelsFrame(pixels, size);
+            }));
+    EXPECT_EQ(1, seen);
+    writer.publishFrame(2, 2000);
+    EXPECT_EQ(2u, reader.frameNumber());
+}
+
+TEST(SharedFrameExchange, RetriesWhenOverwritten) {
+    const size_t size = SharedFrameHeader::regionSize(kFrameSize);
+    auto region = makeRegion(size);
+    SharedFrameWriter writer(region.data(), kWidth, kHeight, 30, kFrameSize);
+    SharedFrameReader reader(region.data(), size);
+    writeFrame(&writer, 1);
+
+    std::vector<uint32_t> consumed;
+    uint32_t next = 2;
+    EXPECT_TRUE(reader.read([&](const uint8_t*, size_t, uint32_t frameNumber,
+                                uint64_t) {
+        consumed.push_back(frameNumber);
+        // A slow reader: the writer wraps around on the first attempt.
+        if (consumed.size() == 1) {
+            for (int i = 0; i < 3; ++i) {
+                writeFrame(&writer, next++);
+            }
+        }
+    }));
+    EXPECT_EQ(std::vector<uint32_t>({1, 4}), consumed);
+}
+
+TEST(SharedFrameExchange, Legacy) {
+    // The single frame layout: 24 bytes of header, then the frame.
+    auto region = makeRegion(24 + kFrameSize);
+    uint32_t* info = reinterpret_cast<uint32_t*>(region.data());
+    info[0] = kWidth;
+    info[1] = kHeight;
+    info[2] = 60;
+    info[3] = 7;
+    uint8_t* pixels = reinterpret_cast<uint8_t*>(region.data()) + 24;
+    memset(pixels, 7, kFrameSize);
+
+    EXPECT_EQ(24 + kFrameSize, SharedFrameReader::regionSize(region.data()));
+    SharedFrameReader reader(region.data(), 24 + kFrameSize);
+    ASSERT_TRUE(reader.isValid());
+    EXPECT_TRUE(reader.isLegacy());
+    EXPECT_EQ(7u, reader.frameNumber());
+    int seen = 0;
+    EXPECT_TRUE(reader.read(
+            [&seen](const uint8_t* pixels, size_t size, uint32_t, uint64_t) {
+                seen = pixelsFrame(pixels, size);
+            }));
+    EXPECT_EQ(7, seen);
+
+    // Too small for its own frame.
+    EXPECT_FALSE(SharedFrameReader(region.data(), 24 + kFrameSize - 1)
+                         .isValid());
+}
+
+TEST(SharedFrameExchange, WaitForFrame) {
+    const size_t size = SharedFrameHeader::regionSize(kFrameSize);
+    auto region = makeRegion(size);
+    SharedFrameWriter writer(region.data(), kWidth, kHeight, 30, kFrameSize);
+    SharedFrameReader reader(region.data(), size);
+
+    EXPECT_FALSE(reader.waitForFrame(0, 1000));
+    writeFrame(&writer, 1);
+    EXPECT_TRUE(reader.waitForFrame(0, 0));
+
+    FunctorThread thread([&writer] {
+        writeFrame(&writer, 2);
+        return 0;
+    });
+    thread.start();
+    EXPECT_TRUE(reader.waitForFrame(1, 10 * 1000 * 1000));
+    thread.wait();
+    EXPECT_EQ(2u, reader.frameNumber());
+}
+
+TEST(SharedFrameExchange, NoTornFrames) {
+    const size_t size = SharedFrameHeader::regionSize(kFrameSize);
+    auto region = makeRegion(size);
+    SharedFrameWriter writer(region.data(), kWidth, kHeight, 30, kFrameSize);
+    SharedFrameReader reader(region.data(), size);
+    writeFrame(&writer, 1);
+
+    std::atomic<bool> done{false};
+    FunctorThread thread([&writer, &done] {
+        for (uint32_t frame = 2; frame < 20000; ++frame) {
+            writeFrame(&writer, frame);
+        }
+        done = true;
+        return 0;
+    });
+    thread.start();
+
+    int torn = 0;
+    while (!done) {
+        int seen = 0;
+        uint32_t seenFrame = 0;
+        if (reader.read([&](const uint8_t* pixels, size_t size,
+                            uint32_t frameNumber, uint64_t) {
+                seen = pixelsFrame(pixels, size);
+                seenFrame = frameNumber;
+            })) {
+            if (seen != int(seenFrame & 0xff)) {
+                ++torn;
+            }
+        }
+    }
+    thread.wait();
+    EXPECT_EQ(0, torn);
+}
+
+}  // namespace recording
+}  // namespace android
@@ -0,0 +1,102 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/recording/video/TiledFrameConverter.h"
+
+#include "libyuv/convert.h"  // for ARGBToI420, ABGRToI420
+
+namespace android {
+namespace recording {
+
+namespace {
+
+// Below this, handing a band over to a worker costs more than it saves.
+constexpr int kMinRowsPerBand = 64;
+
+}  // namespace
+
+TiledFrameConverter::TiledFrameConverter(uint32_t width,
+                                         uint32_t height,
+                                         VideoFormat format,
+                                         int threads)
+    : mWidth(width), mHeight(height), mFormat(format), mParallel(threads) {}
+
+TiledFrameConverter::~TiledFrameConverter() = default;
+
+// static
+bool TiledFrameConverter::canConvert(VideoFormat format,
+                                     uint32_t srcWidth,
+                                     uint32_t srcHeight,
+                                     uint32_t dstWidth,
+                                     uint32_t dstHeight) {
+    if (srcWidth != dstWidth || srcHeight != dstHeight) {
+        return false;
+    }
+    switch (format) {
+        case VideoFormat::RGB565:
+        case VideoFormat::RGBA8888:
+        case VideoFormat::BGRA8888:
+            return true;
+        default:
+            return false;
+    }
+}
+
+int TiledFrameConverter::threads() const {
+    return mParallel.threads();
+}
+
+void TiledFrameConverter::convert(const uint8_t* src,
+                                  uint8_t* const dst[3],
+                                  const int dstStride[3]) {
+    // Bands start on an even row, so that they don't share chroma rows.
+    mParallel.forRows(mHeight, 2, kMinRowsPerBand,
+                      [&](int firstRow, int rows) {
+                          convertRows(src, dst, dstStride, firstRow, rows);
+                      });
+}
+
+void TiledFrameConverter::convertRows(const uint8_t* src,
+                                      uint8_t* const dst[3],
+                                      const int dstStride[3],
+                                      uint32_t firstRow,
+                                      uint32_t rows) const {
+    const int srcStride = getVideoFormatSize(mFormat) * mWidth;
+    src += firstRow * srcStride;
+    uint8_t* const y = dst[0] + firstRow * dstStride[0];
+    uint8_t* const u = dst[1] + firstRow / 2 * dstStride[1];
+    uint8_t* const v = dst[2] + firstRow / 2 * dstStride[2];
+
+    // libyuv names formats after the order of their bytes in a little endian
+    // word, e.g. ARGB is B, G, R, A in memory.
+    switch (mFormat) {
+        case VideoFormat::RGB565:
+            libyuv::RGB565ToI420(src, srcStride, y, dstStride[0], u,
+                                 dstStride[1], v, dstStride[2], mWidth, rows);
+            break;
+        case VideoFormat::RGBA8888:
+            libyuv::ABGRToI420(src, srcStride, y, dstStride[0], u,
+                               dstStride[1], v, dstStride[2], mWidth, rows);
+            break;
+        case VideoFormat::BGRA8888:
+            libyuv::ARGBToI420(src, srcStride, y, dstStride[0], u,
+                               dstStride[1], v, dstStride[2], mWidth, rows);
+            break;
+        default:
+            break;
+    }
+}
+
+}  // namespace recording
+}  // namespace android
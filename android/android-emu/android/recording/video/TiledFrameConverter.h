@@ -0,0 +1,75 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>  // for uint8_t
+
+#include "android/base/Compiler.h"            // for DISALLOW_COPY_ASSIGN_AND_MOVE
+#include "android/base/threads/ParallelFor.h"  // for ParallelFor
+#include "android/recording/Frame.h"           // for VideoFormat
+
+namespace android {
+namespace recording {
+
+// Converts framebuffer frames to YUV420P for the video encoder, splitting
+// each frame into bands of rows that are converted in parallel.
+//
+// Each pair of rows converts on its own, so the result is the same as
+// converting the whole frame at once. Only packed RGB frames that do not
+// need scaling are handled; the recorder falls back to sws_scale() for the
+// others.
+class TiledFrameConverter {
+public:
+    // |threads| is how many threads convert a frame, counting the calling
+    // one.
+    TiledFrameConverter(uint32_t width,
+                        uint32_t height,
+                        VideoFormat format,
+                        int threads);
+    ~TiledFrameConverter();
+
+    // Whether a |srcWidth| x |srcHeight| frame in |format| can be converted
+    // to a |dstWidth| x |dstHeight| one.
+    static bool canConvert(VideoFormat format,
+                           uint32_t srcWidth,
+                           uint32_t srcHeight,
+                           uint32_t dstWidth,
+                           uint32_t dstHeight);
+
+    // Converts |src|, a tightly packed frame, to the Y, U and V planes of
+    // |dst|, and returns once it is done.
+    void convert(const uint8_t* src,
+                 uint8_t* const dst[3],
+                 const int dstStride[3]);
+
+    int threads() const;
+
+private:
+    void convertRows(const uint8_t* src,
+                     uint8_t* const dst[3],
+                     const int dstStride[3],
+                     uint32_t firstRow,
+                     uint32_t rows) const;
+
+    const uint32_t mWidth;
+    const uint32_t mHeight;
+    const VideoFormat mFormat;
+    android::base::ParallelFor mParallel;
+
+    DISALLOW_COPY_ASSIGN_AND_MOVE(TiledFrameConverter);
+};
+
+}  // namespace recording
+}  // namespace android
@@ -0,0 +1,92 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/recording/video/TiledFrameConverter.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace android {
+namespace recording {
+
+namespace {
+
+// An odd height, so that the last band is short and has an unpaired row.
+constexpr uint32_t kWidth = 320;
+constexpr uint32_t kHeight = 251;
+constexpr uint32_t kChromaWidth = (kWidth + 1) / 2;
+constexpr uint32_t kChromaHeight = (kHeight + 1) / 2;
+
+struct Planes {
+    std::vector<uint8_t> y = std::vector<uint8_t>(kWidth * kHeight);
+    std::vector<uint8_t> u =
+            std::vector<uint8_t>(kChromaWidth * kChromaHeight);
+    std::vector<uint8_t> v =
+            std::vector<uint8_t>(kChromaWidth * kChromaHeight);
+};
+
+Planes convert(VideoFormat format, int threads, const uint8_t* src) {
+    Planes planes;
+    uint8_t* const dst[3] = {planes.y.data(), planes.u.data(),
+                             planes.v.data()};
+    const int dstStride[3] = {int(kWidth), int(kChromaWidth),
+                              int(kChromaWidth)};
+    TiledFrameConverter converter(kWidth, kHeight, format, threads);
+    converter.convert(src, dst, dstStride);
+    return planes;
+}
+
+}  // namespace
+
+TEST(TiledFrameConverter, CanConvert) {
+    EXPECT_TRUE(TiledFrameConverter::canConvert(VideoFormat::RGB565, 640, 480,
+                                                640, 480));
+    EXPECT_TRUE(TiledFrameConverter::canConvert(VideoFormat::RGBA8888, 640,
+                                                480, 640, 480));
+    EXPECT_TRUE(TiledFrameConverter::canConvert(VideoFormat::BGRA8888, 640,
+                                                480, 640, 480));
+    // Scaling is left to sws_scale().
+    EXPECT_FALSE(TiledFrameConverter::canConvert(VideoFormat::BGRA8888, 640,
+                                                 480, 320, 240));
+    EXPECT_FALSE(TiledFrameConverter::canConvert(VideoFormat::INVALID_FMT, 640,
+                                                 480, 640, 480));
+}
+
+TEST(TiledFrameConverter, BandsMatchWholeFrame) {
+    for (auto format : {VideoFormat::RGB565, VideoFormat::RGBA8888,
+                        VideoFormat::BGRA8888}) {
+        std::vector<uint8_t> src(kWidth * kHeight *
+                                 getVideoFormatSize(format));
+        for (size_t i = 0; i < src.size(); ++i) {
+            src[i] = uint8_t(i * 7 + i / kWidth);
+        }
+
+        const Planes whole = convert(format, 1, src.data());
+        const Planes bands = convert(format, 4, src.data());
+        EXPECT_EQ(whole.y, bands.y);
+        EXPECT_EQ(whole.u, bands.u);
+        EXPECT_EQ(whole.v, bands.v);
+    }
+}
+
+TEST(TiledFrameConverter, Threads) {
+    EXPECT_EQ(1, TiledFrameConverter(kWidth, kHeight, VideoFormat::RGB565, 1)
+                         .threads());
+    EXPECT_EQ(3, TiledFrameConverter(kWidth, kHeight, VideoFormat::RGB565, 3)
+                         .threads());
+}
+
+}  // namespace recording
+}  // namespace android
@@ -14,7 +14,6 @@
 
 #include "android/recording/video/VideoFrameSharer.h"
 
-#include <string.h>                            // for memcpy, size_t
 #include <sys/types.h>                         // for mode_t
 #include <functional>                          // for _1, _2, _3
 
@@ -47,7 +46,7 @@ VideoFrameSharer::VideoFrameSharer(uint32_t fbWidth,
     : mVideo({fbWidth, fbHeight, 60}),
       mHandle(handle),
       mPixelBufferSize(getPixelBytes(mVideo)),
-      mMemory(handle, sizeof(mVideo) + getPixelBytes(mVideo)) {}
+      mMemory(handle, SharedFrameHeader::regionSize(getPixelBytes(mVideo))) {}
 
 VideoFrameSharer::~VideoFrameSharer() {
     stop();
@@ -73,7 +72,9 @@ bool VideoFrameSharer::initialize() {
         return false;
     }
 
-    memcpy(mMemory.get(), &mVideo, sizeof(mVideo));
+    mWriter.reset(new SharedFrameWriter(mMemory.get(), mVideo.width,
+                                        mVideo.height, mVideo.fps,
+                                        mPixelBufferSize));
     mReadPixels = android_getReadPixelsFunc();
     LOG(INFO) << "Initialized handle: " << mHandle;
     return true;
@@ -93,15 +94,14 @@ void VideoFrameSharer::stop() {
 }
 
 void VideoFrameSharer::frameAvailable() {
-    VideoInfo* info = (VideoInfo*)mMemory.get();
-    uint8_t* bPixels = (uint8_t*)mMemory.get() + sizeof(mVideo);
+    uint8_t* bPixels = mWriter->beginFrame();
     // TODO: enable displayId > 0
     mReadPixels(bPixels, mPixelBufferSize, 0);
 
-    // Update frame information.
-    info->frameNumber = sFrameCounter++;
-    info->tsUs = base::System::get()->getUnixTimeUs();
-    DD("Marshall, frame: %d, ts: %d", info->frameNumber, info->tsUs);
+    const uint32_t frameNumber = sFrameCounter++;
+    const uint64_t tsUs = base::System::get()->getUnixTimeUs();
+    mWriter->publishFrame(frameNumber, tsUs);
+    DD("Marshall, frame: %d, ts: %d", frameNumber, tsUs);
 }
 
 size_t VideoFrameSharer::getPixelBytes(VideoInfo info) {
@@ -21,33 +21,27 @@
 #include <string>                              // for string, basic_string
 #include "android/base/memory/SharedMemory.h"  // for SharedMemory
 #include "android/opengles.h"                  // for ReadPixelsFunc
+#include "android/recording/video/SharedFrameExchange.h"
 
 namespace android {
 namespace recording {
 class Producer;
 
-// A class that produces video frames in the YUV-I420 pixel format.
-// It has the luma "luminance" plane Y first, then the U chroma plane and last
-// the V chroma plane.
-//
-// The two chroma planes (blue and red projections) are sub-sampled in both the
-// horizontal and vertical dimensions by a factor of 2. That is to say, for a
-// 2x2 square of pixels, there are 4 Y samples but only 1 U sample and 1 V
-// sample.
-//
-// This format requires 4*8+8+8=48 bits for 4 pixels, so its depth is 12 bits
-// per pixel.
+// A class that shares video frames with another process through shared
+// memory.
 //
 // The VideoFrameSharer will listen to frame events from the Producer and
-// convert the incoming video format to I420 and copy it to the shared memory
-// location. It will produce AT MOST "fps" frames per second.
+// copy the RGBA8888 frames to the shared memory location, laid out as
+// described in SharedFrameExchange.h. It will produce AT MOST "fps" frames
+// per second.
 //
-// Note, that the existing frame will be overwritten, this can cause encoder
-// artifacts. See https://en.wikipedia.org/wiki/Screen_tearing for background
-// information on vsync issues. Vsync is tracked in b/77969099.
+// Frames are triple buffered: a new frame never overwrites the newest one,
+// which the other process might be reading, so it gets consistent frames
+// without having to copy them first.
 //
 // The process on the other side can feed this data to the WebRTC system that
-// will take care of the actual encoding and serialization of the video frames.
+// will take care of the conversion to I420, the actual encoding and the
+// serialization of the video frames.
 class VideoFrameSharer {
 public:
     struct VideoInfo {
@@ -78,6 +72,7 @@ private:
     ReadPixelsFunc mReadPixels;
     std::unique_ptr<Producer> mVideoProducer;
     size_t mPixelBufferSize;
+    std::unique_ptr<SharedFrameWriter> mWriter;
 
     static std::atomic<uint64_t> sFrameCounter;
 };
@@ -46,7 +46,8 @@ FrameQueue::FrameQueue(VideoPlayer* player,
                        int max_size,
                        bool keep_last)
     : mPlayer(player), mPacketQueue(pktq), mKeepLast(keep_last) {
-    mMaxSize = FFMIN(max_size, FRAME_QUEUE_SIZE);
+    mMaxSize = FFMAX(1, FFMIN(max_size, MAX_FRAME_QUEUE_SIZE));
+    mQueue.resize(mMaxSize);
     for (int i = 0; i < mMaxSize; i++) {
         mQueue[i].frame = av_frame_alloc();
     }
@@ -64,6 +65,36 @@ FrameQueue::~FrameQueue() {
     }
 }
 
+template <class Predicate>
+void FrameQueue::waitUntil(Predicate ready) {
+    if (ready()) {
+        return;
+    }
+
+    // The waiter count is raised before |ready| is checked again, and the
+    // other side changes mSize before it checks the count, so one of them
+    // always sees the other: either we don't sleep, or it wakes us up.
+    VideoPlayerWaitInfo* pwi = &mWaitInfo;
+    pwi->lock.lock();
+    pwi->done = false;
+    mWaiters++;
+    while (!ready() && !pwi->done && mPlayer->isRunning() &&
+           !mPacketQueue->isAbort()) {
+        pwi->cvDone.wait(&pwi->lock);
+    }
+    mWaiters--;
+    pwi->lock.unlock();
+}
+
+void FrameQueue::wakeWaiter() {
+    if (mWaiters == 0) {
+        return;
+    }
+    VideoPlayerWaitInfo* pwi = &mWaitInfo;
+    pwi->lock.lock();
+    pwi->cvDone.signalAndUnlock(&pwi->lock);
+}
+
 void FrameQueue::signalWait() {
     VideoPlayerWaitInfo* pwi = &mWaitInfo;
     pwi->lock.lock();
@@ -85,33 +116,22 @@ Frame* FrameQueue::peekLast() {
 
 Frame* FrameQueue::peekWritable() {
     // wait until we have space to put a new frame
-    VideoPlayerWaitInfo* pwi = &mWaitInfo;
-    pwi->lock.lock();
-    pwi->done = false;
-    while (mSize >= mMaxSize && !pwi->done && mPlayer->isRunning() &&
-           !mPacketQueue->isAbort()) {
-        pwi->cvDone.wait(&pwi->lock);
-    }
-    pwi->lock.unlock();
+    waitUntil([this]() { return mSize < mMaxSize; });
 
-    if (!mPlayer->isRunning() || mPacketQueue->isAbort())
+    if (!mPlayer->isRunning() || mPacketQueue->isAbort() ||
+        mSize >= mMaxSize) {
         return nullptr;
+    }
 
     return &mQueue[mWindex];
 }
 
 Frame* FrameQueue::peekReadable() {
     // wait until we have a readable new frame
-    VideoPlayerWaitInfo* pwi = &mWaitInfo;
-    pwi->lock.lock();
-    pwi->done = false;
-    while ((mSize - mRindexShown) <= 0 && !pwi->done && mPlayer->isRunning() &&
-           !mPacketQueue->isAbort()) {
-        pwi->cvDone.wait(&pwi->lock);
-    }
-    pwi->lock.unlock();
+    waitUntil([this]() { return mSize - mRindexShown > 0; });
 
-    if (!mPlayer->isRunning() || mPacketQueue->isAbort()) {
+    if (!mPlayer->isRunning() || mPacketQueue->isAbort() ||
+        mSize - mRindexShown <= 0) {
         return nullptr;
     }
 
@@ -120,17 +140,11 @@ Frame* FrameQueue::peekReadable() {
 
 // no wait, return null if no data
 Frame* FrameQueue::peekReadableNoWait() {
-    bool empty = false;
-    VideoPlayerWaitInfo* pwi = &mWaitInfo;
-    pwi->lock.lock();
-    empty = (mSize - mRindexShown) <= 0;
-    if (empty || !mPlayer->isRunning() || mPacketQueue->isAbort()) {
-	pwi->lock.unlock();
+    if (mSize - mRindexShown <= 0 || !mPlayer->isRunning() ||
+        mPacketQueue->isAbort()) {
         return nullptr;
     }
 
-    pwi->lock.unlock();
-
     return &mQueue[(mRindex + mRindexShown) % mMaxSize];
 }
 
@@ -139,10 +153,9 @@ void FrameQueue::push() {
         mWindex = 0;
     }
 
-    VideoPlayerWaitInfo* pwi = &mWaitInfo;
-    pwi->lock.lock();
+    // publishes the frame written to the slot
     mSize++;
-    pwi->cvDone.signalAndUnlock(&pwi->lock);
+    wakeWaiter();
 }
 
 void FrameQueue::next() {
@@ -155,10 +168,9 @@ void FrameQueue::next() {
         mRindex = 0;
     }
 
-    VideoPlayerWaitInfo* pwi = &mWaitInfo;
-    pwi->lock.lock();
+    // hands the slot back to the writer
     mSize--;
-    pwi->cvDone.signalAndUnlock(&pwi->lock);
+    wakeWaiter();
 }
 
 // jump back to the previous frame if available by resetting rindex_shown
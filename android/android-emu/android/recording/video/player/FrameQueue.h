@@ -33,6 +33,8 @@
 
 #include <stddef.h>                                              // for size_t
 #include <stdint.h>                                              // for int64_t
+#include <atomic>                                                // for atomic
+#include <vector>                                                // for vector
 
 #include "android/recording/video/player/VideoPlayerWaitInfo.h"  // for Vide...
 
@@ -76,10 +78,10 @@ struct Frame {
     int height = 0;
 };
 
-#define VIDEO_PICTURE_QUEUE_SIZE 3
+// the video frame queue is sized by PlayConfig::decodeAheadFrames
 #define AUDIO_SAMPLE_QUEUE_SIZE 9
-#define FRAME_QUEUE_SIZE \
-    FFMAX(AUDIO_SAMPLE_QUEUE_SIZE, VIDEO_PICTURE_QUEUE_SIZE)
+// upper bound on either, a video frame holds a converted picture
+#define MAX_FRAME_QUEUE_SIZE 32
 
 #define SDL_AUDIO_BUFFER_SIZE 1024
 #define MAX_AUDIO_FRAME_SIZE 192000
@@ -101,6 +103,12 @@ struct Frame {
 #define AV_NOSYNC_THRESHOLD 10.0
 
 // a queue structure to keep decoded audio/video frames ready for rendering
+//
+// There is exactly one writer (the decoder thread: peekWritable() and push())
+// and one reader (the thread rendering or playing the frames: everything
+// else), so the ring indices are owned by one side each and only the frame
+// count is shared. Neither side takes a lock unless the queue is full or empty
+// and it has to wait for the other one.
 class FrameQueue {
 public:
     FrameQueue(VideoPlayer* player,
@@ -124,21 +132,33 @@ public:
     int64_t lastPos();
 
     int size() const { return mSize; }
+    int maxSize() const { return mMaxSize; }
 
     VideoPlayerWaitInfo* getWaitInfo() { return &mWaitInfo; }
 
 private:
+    // blocks until |ready| returns true, the queue is aborted or signalWait()
+    // is called
+    template <class Predicate>
+    void waitUntil(Predicate ready);
+    // wakes up the other side if it is blocked in waitUntil()
+    void wakeWaiter();
+
     VideoPlayer* mPlayer = nullptr;
     PacketQueue* mPacketQueue = nullptr;
 
-    Frame mQueue[FRAME_QUEUE_SIZE];
+    std::vector<Frame> mQueue;
+    // only touched by the reader
     int mRindex = 0;
+    int mRindexShown = 0;
+    // only touched by the writer
     int mWindex = 0;
-    int mSize = 0;
+    std::atomic<int> mSize{0};
     int mMaxSize = 0;
     bool mKeepLast = 0;
-    int mRindexShown = 0;
 
+    // number of threads blocked in waitUntil()
+    std::atomic<int> mWaiters{0};
     VideoPlayerWaitInfo mWaitInfo;
 };
 
@@ -0,0 +1,251 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// This software is licensed under the terms of the GNU General Public
+// License version 2, as published by the Free Software Foundation, and
+// may be copied, distributed, and modified under those terms.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Plays a synthetic clip through the video frame queue the way VideoPlayer
+// does: a decoder thread converts I420 frames to the format of the render
+// target and queues them, and the benchmark thread takes them off as the
+// refresh timer would. Reports the frame rate, how long frames wait in the
+// queue, and how many cores the whole thing keeps busy.
+
+#include "android/recording/video/player/FrameQueue.h"
+
+#include <stdio.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "android/base/system/System.h"
+#include "android/base/threads/FunctorThread.h"
+#include "android/recording/video/player/PacketQueue.h"
+#include "android/recording/video/player/VideoPlayer.h"
+#include "benchmark/benchmark_api.h"
+
+extern "C" {
+#include <libavutil/frame.h>
+#include <libavutil/time.h>
+
+#include "libavcodec/avcodec.h"
+#include "libswscale/swscale.h"
+}
+
+using android::base::FunctorThread;
+using android::base::System;
+using android::videoplayer::Frame;
+using android::videoplayer::FrameQueue;
+using android::videoplayer::PacketQueue;
+using android::videoplayer::PlayConfig;
+using android::videoplayer::VideoPlayer;
+
+namespace {
+
+// 720p, converted to the size of the default camera.
+constexpr int kClipWidth = 1280;
+constexpr int kClipHeight = 720;
+constexpr int kDstWidth = 640;
+constexpr int kDstHeight = 360;
+constexpr int kClipFrames = 30;
+
+// The output formats VideoPlayerRenderTarget can ask for.
+constexpr AVPixelFormat kDstFormats[] = {AV_PIX_FMT_RGB24, AV_PIX_FMT_RGBA};
+
+class RunningVideoPlayer : public VideoPlayer {
+public:
+    void start() override {}
+    void start(const PlayConfig& playConfig) override {}
+    void stop() override { mRunning = false; }
+    void pause() override {}
+    void pauseAt(double timestamp) override {}
+    bool isRunning() const override { return mRunning; }
+    bool isLooping() const override { return true; }
+    void videoRefresh() override {}
+    void scheduleRefresh(int delayMs) override {}
+    void loadVideoFileWithData(
+            const ::offworld::DatasetInfo& datasetInfo) override {}
+    void setErrorStatusAndRecordErrorMessage(
+            std::string errorDetails) override {}
+    bool getErrorStatus() override { return false; }
+    std::string getErrorMessage() override { return ""; }
+
+private:
+    std::atomic<bool> mRunning{true};
+};
+
+// A few frames of a moving gradient, decoded once and looped.
+class SyntheticClip {
+public:
+    SyntheticClip() {
+        for (int i = 0; i < kClipFrames; ++i) {
+            AVFrame* frame = av_frame_alloc();
+            frame->format = AV_PIX_FMT_YUV420P;
+            frame->width = kClipWidth;
+            frame->height = kClipHeight;
+            av_frame_get_buffer(frame, 32);
+            for (int plane = 0; plane < 3; ++plane) {
+                const int rows = plane ? kClipHeight / 2 : kClipHeight;
+                const int cols = plane ? kClipWidth / 2 : kClipWidth;
+                for (int y = 0; y < rows; ++y) {
+                    uint8_t* row =
+                            frame->data[plane] + y * frame->linesize[plane];
+                    for (int x = 0; x < cols; ++x) {
+                        row[x] = uint8_t(x + y * (plane + 1) + i * 8);
+                    }
+                }
+            }
+            mFrames.push_back(frame);
+        }
+    }
+
+    ~SyntheticClip() {
+        for (AVFrame* frame : mFrames) {
+            av_frame_free(&frame);
+        }
+    }
+
+    const AVFrame* frame(int i) const { return mFrames[i % kClipFrames]; }
+
+private:
+    std::vector<AVFrame*> mFrames;
+};
+
+// Decodes the clip into a frame queue on its own thread, the way
+// VideoPlayerImpl::queuePicture() does.
+class Playback {
+public:
+    Playback(AVPixelFormat dstFormat, int decodeAheadFrames)
+        : mDstFormat(dstFormat),
+          mFrameQueue(&mPlayer,
+                      &mPacketQueue,
+                      decodeAheadFrames + 1,
+                      true),
+          mDecoder([this]() { decode(); }) {
+        mPacketQueue.start();
+        mConvertCtx = sws_getContext(kClipWidth, kClipHeight,
+                                     AV_PIX_FMT_YUV420P, kDstWidth, kDstHeight,
+                                     mDstFormat, SWS_FAST_BILINEAR, nullptr,
+                                     nullptr, nullptr);
+        mDecoder.start();
+    }
+
+    ~Playback() {
+        mPlayer.stop();
+        mPacketQueue.abort();
+        mFrameQueue.signalWait();
+        mDecoder.wait();
+        sws_freeContext(mConvertCtx);
+    }
+
+    FrameQueue* frameQueue() { return &mFrameQueue; }
+
+private:
+    void decode() {
+        const bool ppm = mDstFormat == AV_PIX_FMT_RGB24;
+        const int numBytes =
+                avpicture_get_size(mDstFormat, kDstWidth, kDstHeight);
+        for (int i = 0;; ++i) {
+            Frame* vp = mFrameQueue.peekWritable();
+            if (vp == nullptr) {
+                return;
+            }
+            if (!vp->allocated) {
+                vp->buf = new unsigned char[numBytes + 64];
+                vp->headerlen =
+                        ppm ? sprintf((char*)vp->buf, "P6\n%d %d\n255\n",
+                                      kDstWidth, kDstHeight)
+                            : 0;
+                vp->len = numBytes + vp->headerlen;
+                vp->width = kDstWidth;
+                vp->height = kDstHeight;
+                vp->allocated = true;
+            }
+
+            const AVFrame* src = mClip.frame(i);
+            AVPicture pict;
+            avpicture_fill(&pict, vp->buf + vp->headerlen, mDstFormat,
+                           kDstWidth, kDstHeight);
+            sws_scale(mConvertCtx, src->data, src->linesize, 0, kClipHeight,
+                      pict.data, pict.linesize);
+
+            // When the frame was ready, rather than when it should be shown.
+            vp->pts = av_gettime_relative() / 1000000.0;
+            mFrameQueue.push();
+        }
+    }
+
+    const AVPixelFormat mDstFormat;
+    SyntheticClip mClip;
+    SwsContext* mConvertCtx = nullptr;
+    RunningVideoPlayer mPlayer;
+    PacketQueue mPacketQueue{&mPlayer};
+    FrameQueue mFrameQueue;
+    FunctorThread mDecoder;
+};
+
+void setLabel(benchmark::State& state,
+              double queuedSec,
+              const System::Times& start) {
+    const System::Times end = System::get()->getProcessTimes();
+    const double cpuMs = (end.userMs - start.userMs) +
+                         (end.systemMs - start.systemMs);
+    const double wallMs = end.wallClockMs - start.wallClockMs;
+    char label[64];
+    snprintf(label, sizeof(label), "queued %.2f ms, %.2f cores",
+             1000.0 * queuedSec / state.iterations(),
+             wallMs > 0 ? cpuMs / wallMs : 0.0);
+    state.SetLabel(label);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// range_x() is the output format, range_y() the decode-ahead in frames.
+// Takes frames off as fast as they come: the best frame rate.
+void BM_PlayUnpaced(benchmark::State& state) {
+    Playback playback(kDstFormats[state.range_x()], state.range_y());
+    FrameQueue* queue = playback.frameQueue();
+    double queuedSec = 0;
+    const System::Times start = System::get()->getProcessTimes();
+    while (state.KeepRunning()) {
+        Frame* vp = queue->peekReadable();
+        queuedSec += av_gettime_relative() / 1000000.0 - vp->pts;
+        queue->next();
+    }
+    setLabel(state, queuedSec, start);
+}
+
+// Shows a frame every 1/60 s, as the refresh timer would: the cost of
+// holding 60 fps.
+void BM_PlayAt60Fps(benchmark::State& state) {
+    constexpr int64_t kFrameUs = 1000000 / 60;
+    Playback playback(kDstFormats[state.range_x()], state.range_y());
+    FrameQueue* queue = playback.frameQueue();
+    double queuedSec = 0;
+    int64_t nextUs = av_gettime_relative();
+    const System::Times start = System::get()->getProcessTimes();
+    while (state.KeepRunning()) {
+        const int64_t nowUs = av_gettime_relative();
+        if (nowUs < nextUs) {
+            System::get()->sleepUs(nextUs - nowUs);
+        }
+        nextUs += kFrameUs;
+        Frame* vp = queue->peekReadable();
+        queuedSec += av_gettime_relative() / 1000000.0 - vp->pts;
+        queue->next();
+    }
+    setLabel(state, queuedSec, start);
+}
+
+}  // namespace
+
+BENCHMARK(BM_PlayUnpaced)->ArgPair(0, 2)->ArgPair(1, 2)->ArgPair(1, 6)
+        ->UseRealTime();
+BENCHMARK(BM_PlayAt60Fps)->ArgPair(0, 2)->ArgPair(1, 2)->ArgPair(1, 6)
+        ->UseRealTime();
+
+BENCHMARK_MAIN()
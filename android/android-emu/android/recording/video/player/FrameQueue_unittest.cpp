@@ -0,0 +1,138 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// This software is licensed under the terms of the GNU General Public
+// License version 2, as published by the Free Software Foundation, and
+// may be copied, distributed, and modified under those terms.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+#include "android/recording/video/player/FrameQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "android/base/threads/FunctorThread.h"
+#include "android/recording/video/player/PacketQueue.h"
+#include "android/recording/video/player/VideoPlayer.h"
+
+namespace android {
+namespace videoplayer {
+
+namespace {
+
+class RunningVideoPlayer : public VideoPlayer {
+public:
+    void start() override {}
+    void start(const PlayConfig& playConfig) override {}
+    void stop() override {}
+    void pause() override {}
+    void pauseAt(double timestamp) override {}
+    bool isRunning() const override { return true; }
+    bool isLooping() const override { return false; }
+    void videoRefresh() override {}
+    void scheduleRefresh(int delayMs) override {}
+    void loadVideoFileWithData(
+            const ::offworld::DatasetInfo& datasetInfo) override {}
+    void setErrorStatusAndRecordErrorMessage(
+            std::string errorDetails) override {}
+    bool getErrorStatus() override { return false; }
+    std::string getErrorMessage() override { return ""; }
+};
+
+class FrameQueueTest : public testing::Test {
+protected:
+    void SetUp() override { mPacketQueue.start(); }
+
+    RunningVideoPlayer mPlayer;
+    PacketQueue mPacketQueue{&mPlayer};
+};
+
+}  // namespace
+
+TEST_F(FrameQueueTest, SizeIsBounded) {
+    EXPECT_EQ(1, FrameQueue(&mPlayer, &mPacketQueue, 0, true).maxSize());
+    EXPECT_EQ(7, FrameQueue(&mPlayer, &mPacketQueue, 7, true).maxSize());
+    EXPECT_EQ(MAX_FRAME_QUEUE_SIZE,
+              FrameQueue(&mPlayer, &mPacketQueue, 1000, true).maxSize());
+}
+
+TEST_F(FrameQueueTest, KeepsLastFrameShown) {
+    FrameQueue queue(&mPlayer, &mPacketQueue, 3, true);
+    queue.peekWritable()->pts = 1;
+    queue.push();
+    queue.peekWritable()->pts = 2;
+    queue.push();
+    EXPECT_EQ(2, queue.numRemaining());
+
+    EXPECT_EQ(1, queue.peekReadable()->pts);
+    queue.next();
+    // The first frame stays in the queue, as the one on screen.
+    EXPECT_EQ(1, queue.numRemaining());
+    EXPECT_EQ(2, queue.size());
+    EXPECT_EQ(1, queue.peekLast()->pts);
+    EXPECT_EQ(2, queue.peekReadable()->pts);
+
+    queue.next();
+    EXPECT_EQ(0, queue.numRemaining());
+    EXPECT_EQ(2, queue.peekLast()->pts);
+    EXPECT_EQ(nullptr, queue.peekReadableNoWait());
+}
+
+TEST_F(FrameQueueTest, HandsFramesOverInOrder) {
+    // A small queue, so that both sides keep waiting for each other.
+    constexpr int kFrames = 10000;
+    FrameQueue queue(&mPlayer, &mPacketQueue, 2, false);
+
+    base::FunctorThread decoder([&queue]() {
+        for (int i = 0; i < kFrames; ++i) {
+            Frame* vp = queue.peekWritable();
+            if (vp == nullptr) {
+                return -1;
+            }
+            vp->pts = i;
+            vp->serial = i * 3;
+            queue.push();
+        }
+        return 0;
+    });
+    ASSERT_TRUE(decoder.start());
+
+    for (int i = 0; i < kFrames; ++i) {
+        Frame* vp = queue.peekReadable();
+        ASSERT_NE(nullptr, vp);
+        EXPECT_EQ(i, vp->pts);
+        EXPECT_EQ(i * 3, vp->serial);
+        queue.next();
+    }
+
+    intptr_t result = -1;
+    decoder.wait(&result);
+    EXPECT_EQ(0, result);
+    EXPECT_EQ(0, queue.size());
+}
+
+TEST_F(FrameQueueTest, AbortWakesDecoder) {
+    FrameQueue queue(&mPlayer, &mPacketQueue, 1, true);
+    queue.peekWritable();
+    queue.push();
+
+    base::FunctorThread decoder([&queue]() {
+        // The queue is full, this blocks until the abort.
+        return queue.peekWritable() == nullptr ? 0 : -1;
+    });
+    ASSERT_TRUE(decoder.start());
+
+    mPacketQueue.abort();
+    queue.signalWait();
+
+    intptr_t result = -1;
+    decoder.wait(&result);
+    EXPECT_EQ(0, result);
+}
+
+}  // namespace videoplayer
+}  // namespace android
@@ -57,6 +57,16 @@ PacketQueue::PacketQueue(VideoPlayer* player) : mPlayer(player) {}
 
 PacketQueue::~PacketQueue() {
     flush();
+
+    CustomAVPacketList* pkt1;
+    for (CustomAVPacketList* pkt = takeAll(); pkt; pkt = pkt1) {
+        pkt1 = pkt->next;
+        av_freep(&pkt);
+    }
+    for (CustomAVPacketList* pkt = mFreePkts; pkt; pkt = pkt1) {
+        pkt1 = pkt->next;
+        av_freep(&pkt);
+    }
 }
 
 void PacketQueue::start() {
@@ -83,10 +93,14 @@ int PacketQueue::internalPut(AVPacket* pkt) {
         return -1;
     }
 
-    CustomAVPacketList* pkt1 =
-            (CustomAVPacketList*)av_malloc(sizeof(CustomAVPacketList));
-    if (pkt1 == nullptr) {
-        return -1;
+    CustomAVPacketList* pkt1 = mFreePkts;
+    if (pkt1 != nullptr) {
+        mFreePkts = pkt1->next;
+    } else {
+        pkt1 = (CustomAVPacketList*)av_malloc(sizeof(CustomAVPacketList));
+        if (pkt1 == nullptr) {
+            return -1;
+        }
     }
 
     pkt1->pkt = *pkt;
@@ -136,20 +150,30 @@ int PacketQueue::putNullPacket(int stream_index) {
     return put(pkt);
 }
 
+CustomAVPacketList* PacketQueue::takeAll() {
+    CustomAVPacketList* pkts = mFirstPkt;
+    mLastPkt = nullptr;
+    mFirstPkt = nullptr;
+    mNumPkts = 0;
+    mSize = 0;
+    return pkts;
+}
+
+void PacketQueue::recycle(CustomAVPacketList* pkt) {
+    pkt->next = mFreePkts;
+    mFreePkts = pkt;
+}
+
 void PacketQueue::flush() {
     VideoPlayerWaitInfo* pwi = &mWaitInfo;
     pwi->lock.lock();
 
     CustomAVPacketList* pkt1;
-    for (CustomAVPacketList* pkt = mFirstPkt; pkt; pkt = pkt1) {
+    for (CustomAVPacketList* pkt = takeAll(); pkt; pkt = pkt1) {
         pkt1 = pkt->next;
         av_packet_unref(&pkt->pkt);
-        av_freep(&pkt);
+        recycle(pkt);
     }
-    mLastPkt = nullptr;
-    mFirstPkt = nullptr;
-    mNumPkts = 0;
-    mSize = 0;
 
     internalPut(&sFlushPkt);
 
@@ -179,6 +203,7 @@ int PacketQueue::get(AVPacket* pkt, bool blocking, int* serial) {
             mNumPkts--;
             mSize -= pkt1->pkt.size + sizeof(*pkt1);
             if (pkt1->pkt.size == 0 && pkt1->pkt.data == nullptr) {
+                recycle(pkt1);
                 ret = -2;  // EOF packet
                 break;
             }
@@ -186,7 +211,7 @@ int PacketQueue::get(AVPacket* pkt, bool blocking, int* serial) {
             if (serial) {
                 *serial = pkt1->serial;
             }
-            av_free(pkt1);
+            recycle(pkt1);
             ret = 1;
             break;
         } else if (!blocking) {
@@ -214,6 +239,8 @@ void PacketQueue::signalWait() {
 }
 
 int64_t PacketQueue::getEnqueuedPktDuration() {
+    // nodes are reused, so they must not be looked at while being recycled
+    base::AutoLock lock(mWaitInfo.lock);
     if (mFirstPkt == nullptr || mLastPkt == nullptr) {
         return 0L;
     } else if (mFirstPkt->pkt.pts == AV_NOPTS_VALUE ||
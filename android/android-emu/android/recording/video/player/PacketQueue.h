@@ -32,6 +32,7 @@
 #pragma once
 
 #include <stdint.h>                                              // for int64_t
+#include <atomic>                                                // for atomic
 
 #include "android/recording/video/player/VideoPlayerWaitInfo.h"  // for Vide...
 
@@ -51,6 +52,12 @@ struct CustomAVPacketList {
 };
 
 // a queue structure to keep audio/video packets read from a video file
+//
+// Unlike FrameQueue, this one is not single producer: packets for both streams
+// are put by whichever decoder thread is demuxing, and the controlling thread
+// flushes and aborts the queues when seeking or stopping. So it stays a locked
+// list, but the counters that decoders and the refresh timer poll are atomic,
+// and list nodes are recycled rather than allocated for each packet.
 class PacketQueue {
 public:
     PacketQueue(VideoPlayer* player);
@@ -91,6 +98,10 @@ public:
 
 private:
     int internalPut(AVPacket* pkt);
+    // unlinks and returns all the packets, the caller frees them
+    CustomAVPacketList* takeAll();
+    // returns |pkt| to the free list
+    void recycle(CustomAVPacketList* pkt);
 
 public:
     // this is special packet to mark a flush is needed
@@ -100,10 +111,13 @@ public:
 private:
     CustomAVPacketList* mFirstPkt = nullptr;
     CustomAVPacketList* mLastPkt = nullptr;
-    int mNumPkts = 0;
-    int mSize = 0;
+    // nodes of packets already retrieved, ready to be reused
+    CustomAVPacketList* mFreePkts = nullptr;
+    std::atomic<int> mNumPkts{0};
+    std::atomic<int> mSize{0};
     // must call start() method to enable the queue
-    bool mAbortRequest = true;
+    std::atomic<bool> mAbortRequest{true};
+    // only changed with the lock held; Clock reads it through a plain pointer
     int mSerial = 0;
 
     VideoPlayerWaitInfo mWaitInfo;
@@ -35,6 +35,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <errno.h>
+#include <algorithm>
 #include <functional>
 #include <string>
 #include <utility>
@@ -323,6 +324,11 @@ private:
     SwsContext* mImgConvertCtx = nullptr;
     SwrContext* mSwrCtx = nullptr;
 
+    // the pixel format decoded frames are converted to, as asked by
+    // mRenderTarget
+    AVPixelFormat mDstPixFmt = AV_PIX_FMT_RGB24;
+    bool mWritePpmHeader = true;
+
     // we use this condition to control not reading too much
     // data into the packet queues
     VideoPlayerWaitInfo mContinueReadWaitInfo;
@@ -831,11 +837,11 @@ int VideoPlayerImpl::queuePicture(AVFrame* src_frame,
         }
 
         // Determine required buffer size and allocate buffer
-        int numBytes = avpicture_get_size(AV_PIX_FMT_RGB24, mWindowWidth,
+        int numBytes = avpicture_get_size(mDstPixFmt, mWindowWidth,
                                           mWindowHeight);
         int headerlen = 0;
         vp->buf = new unsigned char[numBytes + 64];
-        if (vp->buf != nullptr) {
+        if (vp->buf != nullptr && mWritePpmHeader) {
             // simply append a ppm header to become ppm image format
             headerlen = sprintf((char*)vp->buf, "P6\n%d %d\n255\n",
                                 mWindowWidth, mWindowHeight);
@@ -844,11 +850,8 @@ int VideoPlayerImpl::queuePicture(AVFrame* src_frame,
         }
         vp->headerlen = headerlen;
         vp->len = numBytes + headerlen;
-        VideoPlayerWaitInfo* pwi = mVideoFrameQueue->getWaitInfo();
-        pwi->lock.lock();
+        // the slot belongs to the decoder until it is pushed
         vp->allocated = true;
-        pwi->done = true;
-        pwi->cvDone.signalAndUnlock(&pwi->lock);
 
         if (mVideoQueue->isAbort()) {
             return -1;
@@ -857,10 +860,10 @@ int VideoPlayerImpl::queuePicture(AVFrame* src_frame,
 
     // assign appropriate parts of buffer to image planes
     AVPicture pict;
-    avpicture_fill(&pict, vp->buf + vp->headerlen, AV_PIX_FMT_RGB24,
-                   mWindowWidth, mWindowHeight);
+    avpicture_fill(&pict, vp->buf + vp->headerlen, mDstPixFmt, mWindowWidth,
+                   mWindowHeight);
 
-    // Convert the image to RGB format
+    // Convert the image to the format of the render target
     sws_scale(mImgConvertCtx, src_frame->data, src_frame->linesize, 0,
               mVideoCodecCtx->height, pict.data, pict.linesize);
 
@@ -1315,12 +1318,22 @@ int VideoPlayerImpl::play() {
         mWindowWidth = dst_w;
         mWindowHeight = dst_h;
 
-        AVPixelFormat dst_fmt = AV_PIX_FMT_RGB24;
+        // Convert straight to the format the render target uploads, so that
+        // it doesn't have to repack the pixels.
+        if (mRenderTarget->getPixelFormat() ==
+            VideoPlayerRenderTarget::PixelFormat::RGBA8888) {
+            mDstPixFmt = AV_PIX_FMT_RGBA;
+            mWritePpmHeader = false;
+        } else {
+            mDstPixFmt = AV_PIX_FMT_RGB24;
+            mWritePpmHeader = true;
+        }
         // create image convert context
         mImgConvertCtx =
                 sws_getContext(mVideoCodecCtx->width, mVideoCodecCtx->height,
-                               mVideoCodecCtx->pix_fmt, dst_w, dst_h, dst_fmt,
-                               SWS_FAST_BILINEAR, NULL, NULL, NULL);
+                               mVideoCodecCtx->pix_fmt, dst_w, dst_h,
+                               mDstPixFmt, SWS_FAST_BILINEAR, NULL, NULL,
+                               NULL);
         if (mImgConvertCtx == nullptr) {
             derror("Could not allocate image convert context");
             return -1;
@@ -1332,8 +1345,13 @@ int VideoPlayerImpl::play() {
 
         mVideoClock.init(mVideoQueue->getSerialPtr());
 
+        // one more slot for the frame kept on screen; with that slot alone
+        // the decoder would wait for room while the display waits for a new
+        // frame
+        const int decodeAheadFrames =
+                std::max(1, mPlayConfig.decodeAheadFrames.load());
         mVideoFrameQueue.reset(new FrameQueue(this, mVideoQueue.get(),
-                                              VIDEO_PICTURE_QUEUE_SIZE, true));
+                                              decodeAheadFrames + 1, true));
 
         mVideoDecoder.reset(new VideoDecoder(
                 this, mVideoCodecCtx.get(), mVideoQueue.get(), mVideoFrameQueue.get(),
@@ -44,19 +44,32 @@ namespace android {
 namespace videoplayer {
 class VideoPlayerNotifier;
 
+// default number of decoded video frames kept ready ahead of the one on
+// screen
+constexpr int kDefaultDecodeAheadFrames = 2;
+
 struct PlayConfig {
     // absolute timestamp from the beginning of the video, measured in seconds
     std::atomic<double> seekTimestamp;
     // play in looping mode or not
     std::atomic<bool> looping;
-
-    PlayConfig(double timestamp = 0, bool looping_ = false)
-        : seekTimestamp(timestamp), looping(looping_) {}
+    // decoded video frames kept ready ahead of the one on screen, to ride out
+    // frames that take longer than usual to decode; each costs a converted
+    // picture. Read when playback starts, at least 1 is used.
+    std::atomic<int> decodeAheadFrames;
+
+    PlayConfig(double timestamp = 0,
+               bool looping_ = false,
+               int decodeAheadFrames_ = kDefaultDecodeAheadFrames)
+        : seekTimestamp(timestamp),
+          looping(looping_),
+          decodeAheadFrames(decodeAheadFrames_) {}
 
     // assignment operator because std::atomic deletes it
     PlayConfig& operator=(const PlayConfig& other) {
         seekTimestamp.exchange(other.seekTimestamp);
         looping.exchange(other.looping);
+        decodeAheadFrames.exchange(other.decodeAheadFrames);
         return *this;
     }
 };
@@ -19,6 +19,16 @@
 // changes in the video dimensions.
 class VideoPlayerRenderTarget {
 public:
+    // Layout of the pixels passed to setPixelBuffer.
+    enum class PixelFormat {
+        // A binary PPM image: a FrameInfo::headerlen bytes long text header,
+        // then packed 8-bit RGB.
+        RGB24_PPM,
+        // Packed 8-bit RGBA without a header. Rows stay 4-byte aligned,
+        // which is what GL texture uploads expect by default.
+        RGBA8888,
+    };
+
     // Metadata for the decoded frame being passed to setPixelBuffer.
     struct FrameInfo {
       size_t headerlen;
@@ -40,6 +50,12 @@ public:
                                      int* resultRenderTargetWidth,
                                      int* resultRenderTargetHeight) = 0;
 
+    // The video player converts the decoded frames straight to this format,
+    // so that the render target can use them as they are.
+    virtual PixelFormat getPixelFormat() const {
+        return PixelFormat::RGB24_PPM;
+    }
+
     // The video player calls setPixelBuffer to communicate the actual decoded
     // result to the render target.
     // TODO: An interface that doesn't
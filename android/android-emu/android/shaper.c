@@ -65,28 +65,88 @@ typedef struct QueuedPacketRec_ {
     size_t                     size;
     void*                      opaque;
     void*                      data;
+    struct SessionRec_*        session;  /* delayed SYN only, NULL if dropped */
+    int                        pooled;
 } QueuedPacketRec, *QueuedPacket;
 
+/* at high rates, thousands of packets go through the queues every second,
+ * so instead of a malloc/free pair per packet, packets that fit in a full
+ * ethernet frame are carved from slabs and recycled through a free list.
+ * the slabs are only released when their owner is destroyed.
+ */
+#define  PACKET_POOL_DATA_SIZE   1536
+#define  PACKET_POOL_SLAB_COUNT  64
+
+typedef struct PooledPacketRec_ {
+    QueuedPacketRec  packet;
+    uint8_t          data[PACKET_POOL_DATA_SIZE];
+} PooledPacketRec;
+
+typedef struct PacketSlabRec_ {
+    struct PacketSlabRec_*  next;
+    PooledPacketRec         packets[PACKET_POOL_SLAB_COUNT];
+} PacketSlabRec, *PacketSlab;
+
+typedef struct PacketPoolRec_ {
+    QueuedPacket  free_list;
+    PacketSlab    slabs;
+} PacketPoolRec, *PacketPool;
+
+static QueuedPacket
+packet_pool_alloc( PacketPool  pool )
+{
+    QueuedPacket  packet = pool->free_list;
+
+    if (packet == NULL) {
+        PacketSlab  slab = malloc(sizeof(*slab));
+        int         nn;
+
+        slab->next  = pool->slabs;
+        pool->slabs = slab;
+        for (nn = PACKET_POOL_SLAB_COUNT - 1; nn >= 0; nn--) {
+            slab->packets[nn].packet.next = packet;
+            packet = &slab->packets[nn].packet;
+        }
+    }
+    pool->free_list = packet->next;
+    return packet;
+}
+
+static void
+packet_pool_destroy( PacketPool  pool )
+{
+    while (pool->slabs) {
+        PacketSlab  slab = pool->slabs;
+        pool->slabs = slab->next;
+        free(slab);
+    }
+    pool->free_list = NULL;
+}
 
 static QueuedPacket
-queued_packet_create( const void*   data,
+queued_packet_create( PacketPool    pool,
+                      const void*   data,
                       size_t        size,
                       void*         opaque,
                       int           do_copy )
 {
     QueuedPacket   packet;
-    size_t         packet_size = sizeof(*packet);
 
-    if (do_copy)
-        packet_size += size;
-
-    packet = malloc(packet_size);
+    if (!do_copy || size <= PACKET_POOL_DATA_SIZE) {
+        packet = packet_pool_alloc(pool);
+        packet->pooled = 1;
+    } else {
+        packet = malloc(sizeof(*packet) + size);
+        packet->pooled = 0;
+    }
     packet->next       = NULL;
     packet->expiration = 0;
     packet->size       = (size_t)size;
     packet->opaque     = opaque;
+    packet->session    = NULL;
 
     if (do_copy) {
+        /* pooled packets are followed by their buffer as well */
         packet->data = (void*)(packet+1);
         memcpy( (char*)packet->data, (char*)data, packet->size );
     } else {
@@ -96,21 +156,255 @@ queued_packet_create( const void*   data,
 }
 
 static void
-queued_packet_free( QueuedPacket  packet )
+queued_packet_free( PacketPool  pool, QueuedPacket  packet )
 {
     if (packet) {
-        free( packet );
+        if (packet->pooled) {
+            packet->next    = pool->free_list;
+            pool->free_list = packet;
+        } else {
+            free( packet );
+        }
+    }
+}
+
+/* queued packets are kept in a timer wheel: a ring of PACKET_WHEEL_SIZE
+ * lists, one per tick of the shaper clock, covering the ticks from 'now'
+ * on. packets that expire in the same tick are appended to the same list,
+ * so queuing a packet doesn't depend on the number of packets already
+ * queued, and the rare packets that expire beyond the end of the ring
+ * wait in a sorted overflow list.
+ *
+ * the wheel has a single timer, programmed for the first non-empty tick.
+ * when it fires, all the packets that are due are delivered in a single
+ * batch, in expiration order, then the timer is programmed again.
+ */
+#define  PACKET_WHEEL_SIZE  256
+
+typedef struct {
+    QueuedPacket  head;
+    QueuedPacket  tail;
+} PacketListRec, *PacketList;
+
+typedef void (*PacketWheelDeliverFunc)( void*  owner, QueuedPacket  packet );
+
+typedef struct PacketWheelRec_ {
+    PacketListRec           slots[PACKET_WHEEL_SIZE];
+    PacketListRec           overflow;     /* ordered by expiration date */
+    Duration                now;          /* first tick not delivered yet */
+    Duration                deadline;     /* timer deadline, -1 if stopped */
+    int                     num_packets;
+    int                     num_overflow;
+    LoopTimer*              timer;
+    PacketPoolRec           pool;
+    PacketWheelDeliverFunc  deliver;
+    void*                   owner;
+} PacketWheelRec, *PacketWheel;
+
+static void
+packet_list_append( PacketList  list, QueuedPacket  packet )
+{
+    packet->next = NULL;
+    if (list->tail)
+        list->tail->next = packet;
+    else
+        list->head = packet;
+    list->tail = packet;
+}
+
+static void
+packet_list_insert_sorted( PacketList  list, QueuedPacket  packet )
+{
+    QueuedPacket  *pnode, node;
+
+    /* packets are mostly queued in expiration order */
+    if (list->tail == NULL || list->tail->expiration <= packet->expiration) {
+        packet_list_append(list, packet);
+        return;
+    }
+    pnode = &list->head;
+    for (;;) {
+        node = *pnode;
+        if (node->expiration > packet->expiration)
+            break;
+        pnode = &node->next;
+    }
+    packet->next = node;
+    *pnode       = packet;
+}
+
+static PacketList
+packet_wheel_slot( PacketWheel  wheel, Duration  tick )
+{
+    return &wheel->slots[tick % PACKET_WHEEL_SIZE];
+}
+
+static void
+packet_wheel_put( PacketWheel  wheel, QueuedPacket  packet )
+{
+    if (packet->expiration < wheel->now + PACKET_WHEEL_SIZE) {
+        packet_list_append(packet_wheel_slot(wheel, packet->expiration),
+                           packet);
+    } else {
+        packet_list_insert_sorted(&wheel->overflow, packet);
+        wheel->num_overflow++;
     }
 }
 
+static void
+packet_wheel_arm( PacketWheel  wheel, Duration  deadline )
+{
+    if (wheel->deadline < 0 || deadline < wheel->deadline) {
+        wheel->deadline = deadline;
+        loopTimer_startAbsolute(wheel->timer, deadline);
+    }
+}
+
+static void
+packet_wheel_add( PacketWheel  wheel, QueuedPacket  packet )
+{
+    if (wheel->num_packets == 0) {
+        wheel->now = looper_nowWithClock(looper_getForThread(), SHAPER_CLOCK);
+    }
+    if (packet->expiration < wheel->now) {
+        packet->expiration = wheel->now;
+    }
+    packet_wheel_put(wheel, packet);
+    wheel->num_packets++;
+    packet_wheel_arm(wheel, packet->expiration);
+}
+
+/* deliver all packets that expire at or before 'until' */
+static void
+packet_wheel_run( PacketWheel  wheel, Duration  until )
+{
+    while (wheel->num_packets > 0 && wheel->now <= until) {
+        PacketList    slot = packet_wheel_slot(wheel, wheel->now);
+        QueuedPacket  packet = slot->head;
+
+        /* detach the list first, delivering may queue new packets */
+        slot->head = slot->tail = NULL;
+        while (packet) {
+            QueuedPacket  next = packet->next;
+
+            wheel->num_packets--;
+            wheel->deliver(wheel->owner, packet);
+            queued_packet_free(&wheel->pool, packet);
+            packet = next;
+        }
+        wheel->now++;
+
+        if (wheel->num_packets == wheel->num_overflow &&
+            wheel->num_overflow > 0) {
+            /* nothing left in the ring, skip the empty ticks */
+            Duration  first = wheel->overflow.head->expiration;
+            if (first > wheel->now)
+                wheel->now = (first <= until) ? first : until + 1;
+        }
+
+        /* move the packets that entered the ring from the overflow list */
+        while (wheel->overflow.head &&
+               wheel->overflow.head->expiration <
+                       wheel->now + PACKET_WHEEL_SIZE) {
+            packet = wheel->overflow.head;
+            wheel->overflow.head = packet->next;
+            if (wheel->overflow.head == NULL)
+                wheel->overflow.tail = NULL;
+            wheel->num_overflow--;
+            packet_wheel_put(wheel, packet);
+        }
+    }
+}
+
+static void
+packet_wheel_rearm( PacketWheel  wheel )
+{
+    Duration  tick;
+
+    if (wheel->num_packets == 0) {
+        return;
+    }
+    if (wheel->num_packets > wheel->num_overflow) {
+        for (tick = wheel->now; ; tick++) {
+            if (packet_wheel_slot(wheel, tick)->head) {
+                packet_wheel_arm(wheel, tick);
+                return;
+            }
+        }
+    }
+    packet_wheel_arm(wheel, wheel->overflow.head->expiration);
+}
+
+/* this function is called when the wheel's timer expires */
+static void
+packet_wheel_expires(void* opaque, LoopTimer* unused)
+{
+    PacketWheel  wheel = (PacketWheel)opaque;
+
+    if (opaque == NULL) {
+        crashhandler_die("packet_wheel_expires() with opaque==NULL");
+    }
+
+    wheel->deadline = -1;
+    packet_wheel_run(wheel,
+            looper_nowWithClock(looper_getForThread(), SHAPER_CLOCK));
+    packet_wheel_rearm(wheel);
+}
+
+/* deliver all queued packets now, in expiration order */
+static void
+packet_wheel_flush( PacketWheel  wheel )
+{
+    while (wheel->num_packets > 0) {
+        packet_wheel_run(wheel, wheel->now + PACKET_WHEEL_SIZE);
+    }
+    loopTimer_stop(wheel->timer);
+    wheel->deadline = -1;
+}
+
+static void
+packet_wheel_init( PacketWheel             wheel,
+                   PacketWheelDeliverFunc  deliver,
+                   void*                   owner )
+{
+    memset(wheel, 0, sizeof(*wheel));
+    wheel->deadline = -1;
+    wheel->deliver  = deliver;
+    wheel->owner    = owner;
+    wheel->timer    = loopTimer_newWithClock(
+            looper_getForThread(), packet_wheel_expires, wheel, SHAPER_CLOCK);
+}
+
+static void
+packet_wheel_destroy( PacketWheel  wheel )
+{
+    int  nn;
+
+    for (nn = 0; nn < PACKET_WHEEL_SIZE; nn++) {
+        while (wheel->slots[nn].head) {
+            QueuedPacket  packet = wheel->slots[nn].head;
+            wheel->slots[nn].head = packet->next;
+            queued_packet_free(&wheel->pool, packet);
+        }
+    }
+    while (wheel->overflow.head) {
+        QueuedPacket  packet = wheel->overflow.head;
+        wheel->overflow.head = packet->next;
+        queued_packet_free(&wheel->pool, packet);
+    }
+    packet_pool_destroy(&wheel->pool);
+
+    loopTimer_stop(wheel->timer);
+    loopTimer_free(wheel->timer);
+    wheel->timer = NULL;
+}
+
 typedef struct NetShaperRec_ {
-    QueuedPacket   packets;   /* list of queued packets, ordered by expiration date */
-    int            num_packets;
+    PacketWheelRec wheel;     /* queued packets */
     int            active;    /* is this shaper active ? */
-    Duration       block_until;
+    double         block_until;
     double         max_rate;  /* max rate expressed in bytes/second */
     double         inv_rate;  /* inverse of max rate                */
-    LoopTimer*     timer;     /* timer */
 
     int                do_copy;
     NetShaperSendFunc  send_func;
@@ -123,51 +417,17 @@ netshaper_destroy( NetShaper  shaper )
 {
     if (shaper) {
         shaper->active = 0;
-
-        while (shaper->packets) {
-            QueuedPacket  packet = shaper->packets;
-            shaper->packets = packet->next;
-            packet->next    = NULL;
-            queued_packet_free(packet);
-        }
-
-        loopTimer_stop(shaper->timer);
-        loopTimer_free(shaper->timer);
-        shaper->timer = NULL;
+        packet_wheel_destroy(&shaper->wheel);
         free(shaper);
     }
 }
 
-/* this function is called when the shaper's timer expires */
 static void
-netshaper_expires(void* opaque, LoopTimer* unused)
+netshaper_deliver( void*  owner, QueuedPacket  packet )
 {
-    NetShaper shaper = (NetShaper)opaque;
-    QueuedPacket  packet;
-
-    if (opaque == NULL) {
-        crashhandler_die("netshaper_expires() with opaque==NULL");
-    }
+    NetShaper  shaper = (NetShaper)owner;
 
-    while ((packet = shaper->packets) != NULL) {
-       Duration now = looper_nowWithClock(looper_getForThread(), SHAPER_CLOCK);
-
-       if (packet->expiration > now)
-           break;
-
-       shaper->packets = packet->next;
-       shaper->send_func( packet->data, packet->size, packet->opaque );
-       queued_packet_free(packet);
-       shaper->num_packets--;
-   }
-
-   /* reprogram timer if needed */
-   if (shaper->packets) {
-       shaper->block_until = shaper->packets->expiration;
-       loopTimer_startAbsolute(shaper->timer, shaper->block_until);
-   } else {
-       shaper->block_until = -1;
-   }
+    shaper->send_func( packet->data, packet->size, packet->opaque );
 }
 
 
@@ -178,10 +438,8 @@ netshaper_create( int                do_copy,
     NetShaper  shaper = malloc(sizeof(*shaper));
 
     shaper->active = 0;
-    shaper->packets = NULL;
-    shaper->num_packets = 0;
-    shaper->timer = loopTimer_newWithClock(
-            looper_getForThread(), netshaper_expires, shaper, SHAPER_CLOCK);
+    packet_wheel_init(&shaper->wheel, netshaper_deliver, shaper);
+    shaper->do_copy   = do_copy;
     shaper->send_func = send_func;
     shaper->max_rate  = 1e6;
     shaper->inv_rate  = 0.;
@@ -198,13 +456,7 @@ netshaper_set_rate( NetShaper  shaper,
     if (!shaper) return;
 
     /* send all current packets when changing the rate */
-    while (shaper->packets) {
-        QueuedPacket  packet = shaper->packets;
-        shaper->packets = packet->next;
-        shaper->send_func(packet->data, packet->size, packet->opaque);
-        free(packet);
-        shaper->num_packets = 0;
-    }
+    packet_wheel_flush(&shaper->wheel);
 
     shaper->max_rate = rate;
     if (rate > 1.) {
@@ -230,43 +482,30 @@ netshaper_send_aux( NetShaper  shaper,
         return;
     }
 
+    /* the time it takes to send a packet at high rates is a fraction of
+     * a clock tick, so 'block_until' keeps the fractional part: rounding
+     * it to the tick would let everything through above a few Mbit/s.
+     */
     now = looper_nowWithClock(looper_getForThread(), SHAPER_CLOCK);
-    if (now >= shaper->block_until) {
+    if (now >= shaper->block_until && shaper->wheel.num_packets == 0) {
         shaper->send_func( data, size, opaque );
         shaper->block_until = now + size*shaper->inv_rate;
-        //fprintf(stderr, "NETSHAPER: block for %.2fms\n", (shaper->block_until - now)*1.0 );
         return;
     }
+    if (shaper->block_until < now) {
+        shaper->block_until = now;
+    }
 
     /* create new packet, add it to the queue */
     {
         QueuedPacket   packet;
 
-        packet = queued_packet_create( data, size, opaque, shaper->do_copy );
-
-        packet->expiration = shaper->block_until;
-
-        {
-            QueuedPacket  *pnode, node;
-
-            pnode = &shaper->packets;
-            for (;;) {
-                node = *pnode;
-                if (node == NULL || node->expiration > packet->expiration )
-                    break;
-                pnode = &node->next;
-            }
-            packet->next = *pnode;
-            *pnode       = packet;
-
-            if (packet == shaper->packets) {
-                loopTimer_startAbsolute(shaper->timer, packet->expiration);
-            }
-        }
-        shaper->num_packets += 1;
+        packet = queued_packet_create( &shaper->wheel.pool, data, size,
+                                       opaque, shaper->do_copy );
+        packet->expiration = (Duration)shaper->block_until;
+        packet_wheel_add(&shaper->wheel, packet);
     }
     shaper->block_until += size*shaper->inv_rate;
-    //fprintf(stderr, "NETSHAPER: block2 for %.2fms\n", (shaper->block_until - now)*1.0 );
 }
 
 void
@@ -286,7 +525,7 @@ netshaper_can_send( NetShaper  shaper )
     if (!shaper->active || shaper->block_until < 0)
         return 1;
 
-    if (shaper->packets)
+    if (shaper->wheel.num_packets > 0)
         return 0;
 
     now = looper_nowWithClock(looper_getForThread(), SHAPER_CLOCK);
@@ -323,7 +562,8 @@ session_free( Session  session )
 {
     if (session) {
         if (session->packet) {
-            queued_packet_free(session->packet);
+            /* still in the delay's wheel, which will drop it */
+            session->packet->session = NULL;
             session->packet = NULL;
         }
         free( session );
@@ -397,10 +637,10 @@ _packet_SYN_flags( const void*  _data, size_t   size, Session  info )
 
 typedef struct NetDelayRec_
 {
-    Session     sessions;
-    int         num_sessions;
-    LoopTimer*  timer;
-    int         active;
+    Session         sessions;
+    int             num_sessions;
+    PacketWheelRec  wheel;       /* delayed SYN packets */
+    int             active;
     int         min_ms;
     int         max_ms;
 
@@ -434,42 +674,20 @@ netdelay_lookup_session( NetDelay  delay, Session  info )
 
 
 
-/* called by the delay's timer on expiration */
+/* called by the delay's wheel when a SYN packet must be sent */
 static void
-netdelay_expires(void* opaque, LoopTimer* unused)
+netdelay_deliver( void*  owner, QueuedPacket  packet )
 {
-    NetDelay delay = (NetDelay)opaque;
-    Session  session;
-    Duration now = looper_nowWithClock(looper_getForThread(), SHAPER_CLOCK);
-    int      rearm = 0;
-    Duration rearm_time = 0;
+    NetDelay  delay   = (NetDelay)owner;
+    Session   session = packet->session;
 
-    for (session = delay->sessions; session != NULL; session = session->next)
-    {
-        QueuedPacket  packet = session->packet;
-
-        if (packet == NULL)
-            continue;
-
-        if (session->expiration <= now) {
-            /* send the SYN packet now */
-                    //fprintf(stderr, "NetDelay:RST: sending creation for %s\n", session_to_string(session) );
-            delay->send_func( packet->data, packet->size, packet->opaque );
-            session->packet = NULL;
-            queued_packet_free( packet );
-        } else {
-            if (!rearm) {
-                rearm      = 1;
-                rearm_time = session->expiration;
-            }
-            else if ( session->expiration < rearm_time )
-                rearm_time = session->expiration;
-        }
-    }
-
-    if (rearm) {
-        loopTimer_startAbsolute(delay->timer, rearm_time);
+    if (session == NULL) {
+        /* the connection was dropped in the meantime */
+        return;
     }
+    //fprintf(stderr, "NetDelay:RST: sending creation for %s\n", session_to_string(session) );
+    session->packet = NULL;
+    delay->send_func( packet->data, packet->size, packet->opaque );
 }
 
 
@@ -480,8 +698,7 @@ netdelay_create( NetShaperSendFunc  send_func )
 
     delay->sessions     = NULL;
     delay->num_sessions = 0;
-    delay->timer = loopTimer_newWithClock(
-            looper_getForThread(), netdelay_expires, delay, SHAPER_CLOCK);
+    packet_wheel_init(&delay->wheel, netdelay_deliver, delay);
     delay->active = 0;
     delay->min_ms = 0;
     delay->max_ms = 0;
@@ -496,14 +713,11 @@ void
 netdelay_set_latency( NetDelay  delay, int  min_ms, int  max_ms )
 {
     /* when changing the latency, accept all sessions */
+    packet_wheel_flush(&delay->wheel);
     while (delay->sessions) {
         Session  session = delay->sessions;
         delay->sessions = session->next;
         session->next = NULL;
-        if (session->packet) {
-            QueuedPacket  packet = session->packet;
-            delay->send_func( packet->data, packet->size, packet->opaque );
-        }
         session_free(session);
         delay->num_sessions--;
     }
@@ -577,9 +791,11 @@ netdelay_send_aux( NetDelay  delay, const void*  data, size_t  size, void* opaqu
                 session->dst_port = info->dst_port;
                 session->protocol = info->protocol;
 
-                session->packet = queued_packet_create( data, size, opaque, 1 );
-
-                netdelay_expires(delay, delay->timer);
+                session->packet = queued_packet_create( &delay->wheel.pool,
+                                                        data, size, opaque, 1 );
+                session->packet->session    = session;
+                session->packet->expiration = session->expiration;
+                packet_wheel_add(&delay->wheel, session->packet);
                 return;
             }
         }
@@ -599,9 +815,7 @@ netdelay_destroy( NetDelay  delay )
             session_free(session);
             delay->num_sessions -= 1;
         }
-        loopTimer_stop(delay->timer);
-        loopTimer_free(delay->timer);
-        delay->timer = NULL;
+        packet_wheel_destroy(&delay->wheel);
         delay->active = 0;
         free( delay );
     }
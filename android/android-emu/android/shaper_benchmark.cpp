@@ -0,0 +1,145 @@
+// Copyright 2021 The Android Open Source Project
+//
+// This software is licensed under the terms of the GNU General Public
+// License version 2, as published by the Free Software Foundation, and
+// may be copied, distributed, and modified under those terms.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Measures the cost of the network shaper and delay line when the guest
+// sends at the throttled rate, which is when every packet gets queued.
+
+#include "android/shaper.h"
+
+#include "android/base/async/ThreadLooper.h"
+#include "android/base/testing/TestLooper.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "benchmark/benchmark_api.h"
+
+using android::base::TestLooper;
+using android::base::ThreadLooper;
+
+namespace {
+
+// The shaper uses the realtime clock, which is driven by the benchmark
+// so that it doesn't have to wait for packets to expire.
+class FakeClockLooper : public TestLooper {
+public:
+    Duration nowMs(ClockType clockType) override { return mNowMs; }
+    DurationNs nowNs(ClockType clockType) override {
+        return mNowMs * 1000000LL;
+    }
+
+    // DefaultLooper timers only run on the host clock, which is the same
+    // as the others here.
+    Looper::Timer* createTimer(Looper::Timer::Callback callback,
+                               void* opaque,
+                               ClockType clock) override {
+        return TestLooper::createTimer(callback, opaque, ClockType::kHost);
+    }
+
+    void advanceMs(Duration ms) {
+        mNowMs += ms;
+        runOneIterationWithDeadlineMs(mNowMs);
+    }
+
+private:
+    Duration mNowMs = 0;
+};
+
+FakeClockLooper* looper() {
+    static FakeClockLooper* sLooper = [] {
+        auto looper = new FakeClockLooper();
+        ThreadLooper::setLooper(looper, true);
+        return looper;
+    }();
+    return sLooper;
+}
+
+constexpr size_t kFrameSize = 1514;
+
+// An established TCP connection from the guest to 8.8.8.8.
+void makeFrame(uint8_t* frame) {
+    memset(frame, 0, kFrameSize);
+    frame[12] = 0x08;                    // IPv4
+    uint8_t* ip = frame + 14;
+    ip[0] = 0x45;
+    ip[8] = 64;                          // TTL
+    ip[9] = 6;                           // TCP
+    ip[12] = 10, ip[13] = 0, ip[14] = 2, ip[15] = 15;
+    ip[16] = 8, ip[17] = 8, ip[18] = 8, ip[19] = 8;
+    uint8_t* tcp = ip + 20;
+    tcp[0] = 0x9c, tcp[1] = 0x40;
+    tcp[2] = 0x01, tcp[3] = 0xbb;
+    tcp[13] = 0x10;                      // ACK
+}
+
+size_t sDelivered = 0;
+
+void countPacket(void* data, size_t size, void* opaque) {
+    sDelivered += size;
+}
+
+NetDelay sDelay = nullptr;
+
+void sendToDelay(void* data, size_t size, void* opaque) {
+    netdelay_send_aux(sDelay, data, size, opaque);
+}
+
+// Each iteration offers one millisecond of traffic at the shaper rate,
+// given in Mbit/s, and lets the clock run for that millisecond.
+void runShaper(benchmark::State& state, NetShaper shaper) {
+    const double rate = state.range_x() * 1e6;
+    const int packetsPerMs =
+            std::max(1, static_cast<int>(rate / 8 / 1000 / kFrameSize));
+    uint8_t frame[kFrameSize];
+    makeFrame(frame);
+
+    netshaper_set_rate(shaper, rate);
+    sDelivered = 0;
+    while (state.KeepRunning()) {
+        for (int i = 0; i < packetsPerMs; i++) {
+            netshaper_send(shaper, frame, kFrameSize);
+        }
+        looper()->advanceMs(1);
+    }
+    netshaper_set_rate(shaper, 0);
+
+    state.SetItemsProcessed(state.iterations() * packetsPerMs);
+    state.SetBytesProcessed(sDelivered);
+}
+
+void BM_Shaper_LineRate(benchmark::State& state) {
+    looper();
+    NetShaper shaper = netshaper_create(1, countPacket);
+    runShaper(state, shaper);
+    netshaper_destroy(shaper);
+}
+
+// The guest to host direction, where packets go through the delay line
+// after the shaper.
+void BM_Shaper_LineRateWithDelay(benchmark::State& state) {
+    looper();
+    sDelay = netdelay_create(countPacket);
+    netdelay_set_latency(sDelay, 20, 100);
+    NetShaper shaper = netshaper_create(1, sendToDelay);
+    runShaper(state, shaper);
+    netshaper_destroy(shaper);
+    netdelay_destroy(sDelay);
+    sDelay = nullptr;
+}
+
+}  // namespace
+
+BENCHMARK(BM_Shaper_LineRate)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_Shaper_LineRateWithDelay)->Arg(100)->Arg(1000);
+
+BENCHMARK_MAIN()
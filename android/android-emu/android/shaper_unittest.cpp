@@ -0,0 +1,192 @@
+// Copyright 2021 The Android Open Source Project
+//
+// This software is licensed under the terms of the GNU General Public
+// License version 2, as published by the Free Software Foundation, and
+// may be copied, distributed, and modified under those terms.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+#include "android/shaper.h"
+
+#include <gtest/gtest.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <functional>
+#include <vector>
+
+#include "android/base/async/ThreadLooper.h"
+#include "android/base/testing/TestLooper.h"
+#include "android/base/threads/FunctorThread.h"
+
+namespace {
+
+using android::base::FunctorThread;
+using android::base::TestLooper;
+using android::base::ThreadLooper;
+
+// The shaper uses the realtime clock, which the tests drive by hand.
+class FakeClockLooper : public TestLooper {
+public:
+    Duration nowMs(ClockType clockType) override { return mNowMs; }
+    DurationNs nowNs(ClockType clockType) override {
+        return mNowMs * 1000000LL;
+    }
+
+    // DefaultLooper timers only run on the host clock, which is the same
+    // as the others here.
+    Looper::Timer* createTimer(Looper::Timer::Callback callback,
+                               void* opaque,
+                               ClockType clock) override {
+        return TestLooper::createTimer(callback, opaque, ClockType::kHost);
+    }
+
+    void advanceMs(Duration ms) {
+        mNowMs += ms;
+        runOneIterationWithDeadlineMs(mNowMs);
+    }
+
+private:
+    Duration mNowMs = 0;
+};
+
+// Runs |body| on a thread of its own, whose looper is |looper|, since a
+// thread's looper can only be set once.
+void runWithLooper(FakeClockLooper* looper, std::function<void()> body) {
+    FunctorThread thread([looper, &body]() {
+        ThreadLooper::setLooper(looper);
+        body();
+        return 0;
+    });
+    ASSERT_TRUE(thread.start());
+    thread.wait();
+}
+
+constexpr size_t kFrameSize = 1514;
+// Sends a full frame in exactly one millisecond.
+constexpr double kRate = kFrameSize * 8 * 1000.;
+
+// A TCP segment from the guest to 8.8.8.8, numbered with |id|.
+std::vector<uint8_t> makeFrame(int id, uint8_t tcpFlags = 0x10) {
+    std::vector<uint8_t> frame(kFrameSize);
+    frame[12] = 0x08;  // IPv4
+    uint8_t* ip = &frame[14];
+    ip[0] = 0x45;
+    ip[8] = 64;  // TTL
+    ip[9] = 6;   // TCP
+    ip[12] = 10, ip[13] = 0, ip[14] = 2, ip[15] = 15;
+    ip[16] = 8, ip[17] = 8, ip[18] = 8, ip[19] = 8;
+    uint8_t* tcp = ip + 20;
+    tcp[0] = 0x9c, tcp[1] = 0x40;
+    tcp[2] = 0x01, tcp[3] = 0xbb;
+    tcp[13] = tcpFlags;
+    frame[kFrameSize - 8] = uint8_t(id);
+    return frame;
+}
+
+std::vector<int> sReceived;
+
+void receive(void* data, size_t size, void* opaque) {
+    EXPECT_EQ(kFrameSize, size);
+    sReceived.push_back(static_cast<uint8_t*>(data)[kFrameSize - 8]);
+}
+
+class ShaperTest : public testing::Test {
+protected:
+    void SetUp() override { sReceived.clear(); }
+
+    FakeClockLooper mLooper;
+};
+
+}  // namespace
+
+TEST_F(ShaperTest, PacesPacketsAtTheRate) {
+    runWithLooper(&mLooper, [this] {
+        NetShaper shaper = netshaper_create(1, receive);
+        netshaper_set_rate(shaper, kRate);
+
+        // The first one goes out right away, the others a millisecond apart,
+        // and the queued ones are copies.
+        for (int i = 0; i < 10; i++) {
+            netshaper_send(shaper, makeFrame(i).data(), kFrameSize);
+        }
+        EXPECT_EQ(std::vector<int>({0}), sReceived);
+        EXPECT_FALSE(netshaper_can_send(shaper));
+
+        for (int ms = 1; ms < 10; ms++) {
+            mLooper.advanceMs(1);
+            EXPECT_EQ(size_t(ms + 1), sReceived.size());
+        }
+        EXPECT_EQ(std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), sReceived);
+
+        mLooper.advanceMs(1);
+        EXPECT_TRUE(netshaper_can_send(shaper));
+        netshaper_destroy(shaper);
+    });
+}
+
+TEST_F(ShaperTest, KeepsOrderOverLongQueues) {
+    runWithLooper(&mLooper, [this] {
+        NetShaper shaper = netshaper_create(1, receive);
+        netshaper_set_rate(shaper, kRate);
+
+        // Longer than the wheel, so that some go through the overflow list.
+        constexpr int kPackets = 600;
+        for (int i = 0; i < kPackets; i++) {
+            netshaper_send(shaper, makeFrame(i).data(), kFrameSize);
+        }
+        // A big step delivers everything that is due in one batch.
+        mLooper.advanceMs(kPackets / 2);
+        EXPECT_EQ(size_t(kPackets / 2 + 1), sReceived.size());
+        for (int ms = 0; ms < kPackets; ms++) {
+            mLooper.advanceMs(1);
+        }
+        ASSERT_EQ(size_t(kPackets), sReceived.size());
+        for (int i = 0; i < kPackets; i++) {
+            EXPECT_EQ(uint8_t(i), sReceived[i]);
+        }
+        netshaper_destroy(shaper);
+    });
+}
+
+TEST_F(ShaperTest, ChangingTheRateFlushes) {
+    runWithLooper(&mLooper, [this] {
+        NetShaper shaper = netshaper_create(1, receive);
+        netshaper_set_rate(shaper, kRate);
+        for (int i = 0; i < 5; i++) {
+            netshaper_send(shaper, makeFrame(i).data(), kFrameSize);
+        }
+        netshaper_set_rate(shaper, 0);
+        EXPECT_EQ(std::vector<int>({0, 1, 2, 3, 4}), sReceived);
+
+        // No limit anymore.
+        netshaper_send(shaper, makeFrame(5).data(), kFrameSize);
+        EXPECT_EQ(6u, sReceived.size());
+        netshaper_destroy(shaper);
+    });
+}
+
+TEST_F(ShaperTest, DelaysNewConnections) {
+    runWithLooper(&mLooper, [this] {
+        NetDelay delay = netdelay_create(receive);
+        // A range of 1 always picks the minimum.
+        netdelay_set_latency(delay, 20, 21);
+
+        netdelay_send(delay, makeFrame(0, 0x02).data(), kFrameSize);  // SYN
+        // Resent before the first one went out, swallowed.
+        netdelay_send(delay, makeFrame(1, 0x02).data(), kFrameSize);
+        // Other traffic is not held back.
+        netdelay_send(delay, makeFrame(2).data(), kFrameSize);
+        EXPECT_EQ(std::vector<int>({2}), sReceived);
+
+        mLooper.advanceMs(19);
+        EXPECT_EQ(1u, sReceived.size());
+        mLooper.advanceMs(1);
+        EXPECT_EQ(std::vector<int>({2, 0}), sReceived);
+        netdelay_destroy(delay);
+    });
+}
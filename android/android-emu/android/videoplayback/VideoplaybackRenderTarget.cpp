@@ -148,8 +148,8 @@ bool VideoplaybackRenderTarget::initialize() {
     mGles2->glGenTextures(2, mTextures.data());
     mGles2->glBindTexture(GL_TEXTURE_2D, mTextures[kVideoFrameTextureIdx]);
 
-    mGles2->glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, mRenderWidth, mRenderHeight,
-                         0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+    mGles2->glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, mRenderWidth,
+                         mRenderHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
     mGles2->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     mGles2->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 
@@ -242,13 +242,13 @@ void VideoplaybackRenderTarget::renderVideoFrame() {
     if (mFrameInfo.width <= mRenderWidth &&
         mFrameInfo.height <= mRenderHeight) {
         mGles2->glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, mFrameInfo.width,
-                                mFrameInfo.height, GL_RGB, GL_UNSIGNED_BYTE,
+                                mFrameInfo.height, GL_RGBA, GL_UNSIGNED_BYTE,
                                 frameBuf);
     } else {
         // The frame dimensions were too big, so we should allocate a larger
         // texture.
-        mGles2->glTexImage2D(GL_TEXTURE_2D, 0, 0, 0, mFrameInfo.width,
-                             mFrameInfo.height, GL_RGB, GL_UNSIGNED_BYTE,
+        mGles2->glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, mFrameInfo.width,
+                             mFrameInfo.height, 0, GL_RGBA, GL_UNSIGNED_BYTE,
                              frameBuf);
         mRenderWidth = std::max(mRenderWidth, mFrameInfo.width);
         mRenderHeight = std::max(mRenderHeight, mFrameInfo.height);
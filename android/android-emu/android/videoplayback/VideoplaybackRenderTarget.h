@@ -35,6 +35,10 @@ public:
                              int video_height,
                              int* resultRenderTargetWidth,
                              int* resultRenderTargetHeight) override;
+    // Frames are uploaded to a GL_RGBA texture as they are.
+    PixelFormat getPixelFormat() const override {
+        return PixelFormat::RGBA8888;
+    }
     void setPixelBuffer(const FrameInfo& info,
                         const unsigned char* buf,
                         size_t len) override;
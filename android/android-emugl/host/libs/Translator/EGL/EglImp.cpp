@@ -1425,7 +1425,9 @@ EGLAPI EGLSyncKHR EGLAPIENTRY eglCreateSyncKHR(EGLDisplay dpy, EGLenum type, con
 
 EGLAPI EGLint EGLAPIENTRY eglClientWaitSyncKHR(EGLDisplay dpy, EGLSyncKHR sync, EGLint flags, EGLTimeKHR timeout) {
     MEM_TRACE("EMUGL");
-    emugl::Mutex::AutoLock mutex(s_eglLock);
+    // Not under s_eglLock: the wait can block for as long as the GPU takes,
+    // and several sync threads wait on fences at once. Like the other sync
+    // entry points, this only touches state of the calling thread's context.
     if (!g_eglInfo->isEgl2EglSyncSafeToUse()) {
         return EGL_CONDITION_SATISFIED_KHR;
     }
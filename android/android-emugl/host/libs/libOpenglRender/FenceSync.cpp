@@ -42,7 +42,10 @@ using android::base::StaticMap;
 // delete. After at least that many timeline increments have
 // happened, we sweep away the remaining native fences.
 // The function that performs the deleting,
-// incrementTimelineAndDeleteOldFences(), happens on the SyncThread.
+// incrementTimelineAndDeleteOldFences(), runs on the workers of the
+// SyncThread's wait pool, possibly several at once. A fence queued in the
+// pool may outlive that many increments; the pool holds its own reference
+// to it until it is signaled.
 
 class Timeline {
 public:
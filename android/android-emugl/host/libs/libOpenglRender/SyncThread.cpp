@@ -67,10 +67,152 @@ static LazyInstance<GlobalSyncThread> sGlobalSyncThread = LAZY_INSTANCE_INIT;
 static const uint32_t kTimelineInterval = 1;
 static const uint64_t kDefaultTimeoutNsecs = 5ULL * 1000ULL * 1000ULL * 1000ULL;
 
+// The workers spend their time blocked in the GPU driver, so there is no
+// point in matching the number of cores. The guest rarely has more than a
+// few timelines with fences in flight at once.
+static const int kNumSyncWaitWorkers = 4;
+
+// EGL objects for calling eglClientWaitSyncKHR on a thread.
+struct SyncContext {
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLContext context = EGL_NO_CONTEXT;
+    EGLSurface surface = EGL_NO_SURFACE;
+};
+
+static void createSyncContext(SyncContext* ctx) {
+    const EGLDispatch* egl = emugl::LazyLoadedEGLDispatch::get();
+
+    ctx->display = egl->eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    int eglMaj, eglMin;
+    egl->eglInitialize(ctx->display, &eglMaj , &eglMin);
+
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_NONE,
+    };
+
+    EGLint nConfigs;
+    EGLConfig config;
+
+    egl->eglChooseConfig(ctx->display, configAttribs, &config, 1, &nConfigs);
+
+    const EGLint pbufferAttribs[] = {
+        EGL_WIDTH, 1,
+        EGL_HEIGHT, 1,
+        EGL_NONE,
+    };
+
+    ctx->surface =
+        egl->eglCreatePbufferSurface(ctx->display, config, pbufferAttribs);
+
+    const EGLint contextAttribs[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
+    ctx->context = egl->eglCreateContext(ctx->display, config, EGL_NO_CONTEXT,
+                                         contextAttribs);
+
+    egl->eglMakeCurrent(ctx->display, ctx->surface, ctx->surface,
+                        ctx->context);
+}
+
+static void destroySyncContext(SyncContext* ctx) {
+    if (ctx->context == EGL_NO_CONTEXT) return;
+
+    const EGLDispatch* egl = emugl::LazyLoadedEGLDispatch::get();
+
+    egl->eglMakeCurrent(ctx->display, EGL_NO_SURFACE, EGL_NO_SURFACE,
+                        EGL_NO_CONTEXT);
+    egl->eglDestroyContext(ctx->display, ctx->context);
+    egl->eglDestroySurface(ctx->display, ctx->surface);
+    ctx->context = EGL_NO_CONTEXT;
+    ctx->surface = EGL_NO_SURFACE;
+}
+
+// The context of the wait pool worker running on this thread.
+static thread_local SyncContext sWorkerContext;
+
+// The pool gets the fences triggerWait() found, with a reference held on
+// them until they are signaled, or null for ones it didn't find.
+static void doWaitPoolWait(FenceSync* fenceSync) {
+    // Either no fence at all, or one from before a snapshot was loaded;
+    // the timeline is incremented right away.
+    if (!fenceSync) return;
+
+    DPRINT("wait on sync obj: %p", fenceSync);
+    EGLint wait_result = fenceSync->wait(kDefaultTimeoutNsecs);
+
+    DPRINT("done waiting, with wait result=0x%x. "
+           "increment timeline (and signal fence)",
+           wait_result);
+
+    if (wait_result != EGL_CONDITION_SATISFIED_KHR) {
+        DPRINT("error: eglClientWaitSync abnormal exit 0x%x\n",
+               wait_result);
+    }
+}
+
+static bool doWaitPoolIsSignaled(FenceSync* fenceSync) {
+    return !fenceSync || fenceSync->isSignaled();
+}
+
+static void doWaitPoolSignal(uint64_t timeline,
+                             FenceSync* const* fences,
+                             size_t count) {
+    DPRINT("issue timeline increment by %zu", count);
+
+    // We always unconditionally increment timeline at this point, even
+    // if the call to eglClientWaitSync returned abnormally.
+    // There are three cases to consider:
+    // - EGL_CONDITION_SATISFIED_KHR: either the sync object is already
+    //   signaled and we need to increment this timeline immediately, or
+    //   we have waited until the object is signaled, and then
+    //   we increment the timeline.
+    // - EGL_TIMEOUT_EXPIRED_KHR: the fence command we put in earlier
+    //   in the OpenGL stream is not actually ever signaled, and we
+    //   end up blocking in the above eglClientWaitSyncKHR call until
+    //   our timeout runs out. In this case, provided we have waited
+    //   for |kDefaultTimeoutNsecs|, the guest will have received all
+    //   relevant error messages about fence fd's not being signaled
+    //   in time, so we are properly emulating bad behavior even if
+    //   we now increment the timeline.
+    // - EGL_FALSE (error): chances are, the underlying EGL implementation
+    //   on the host doesn't actually support fence objects. In this case,
+    //   we should fail safe: 1) It must be only very old or faulty
+    //   graphics drivers / GPU's that don't support fence objects.
+    //   2) The consequences of signaling too early are generally, out of
+    //   order frames and scrambled textures in some apps. But, not
+    //   incrementing the timeline means that the app's rendering freezes.
+    //   So, despite the faulty GPU driver, not incrementing is too heavyweight a response.
+    //
+    // Fences that completed together are signaled with one increment.
+
+    emugl::emugl_sync_timeline_inc(timeline, count * kTimelineInterval);
+    for (size_t i = 0; i < count; ++i) {
+        if (fences[i]) {
+            FenceSync::incrementTimelineAndDeleteOldFences();
+            // Taken in triggerWait().
+            fences[i]->decRef();
+        }
+    }
+
+    DPRINT("done timeline increment");
+}
+
 SyncThread::SyncThread() :
     emugl::Thread(android::base::ThreadFlags::MaskSignals, 512 * 1024) {
+    SyncWaitPool::Callbacks callbacks;
+    callbacks.onWorkerStart = [] { createSyncContext(&sWorkerContext); };
+    callbacks.onWorkerExit = [] { destroySyncContext(&sWorkerContext); };
+    callbacks.wait = doWaitPoolWait;
+    callbacks.isSignaled = doWaitPoolIsSignaled;
+    callbacks.signal = doWaitPoolSignal;
+    mWaitPool.reset(new SyncWaitPool(kNumSyncWaitWorkers, std::move(callbacks)));
+
     this->start();
     initSyncContext();
+    mWaitPool->start();
 }
 
 SyncThread::~SyncThread() {
@@ -81,12 +223,16 @@ void SyncThread::triggerWait(FenceSync* fenceSync,
                              uint64_t timeline) {
     DPRINT("fenceSyncInfo=0x%llx timeline=0x%lx ...",
             fenceSync, timeline);
-    SyncThreadCmd to_send;
-    to_send.opCode = SYNC_THREAD_WAIT;
-    to_send.fenceSync = fenceSync;
-    to_send.timeline = timeline;
-    DPRINT("opcode=%u", to_send.opCode);
-    sendAsync(to_send);
+    // The timeline sweep drops its reference to a native fence a fixed
+    // number of increments after it was created, which says nothing about
+    // how long the fence sits in the pool behind slower timelines. Hold one
+    // until the fence is signaled.
+    FenceSync* actual =
+        FenceSync::getFromHandle((uint64_t)(uintptr_t)fenceSync);
+    if (actual) {
+        actual->incRef();
+    }
+    mWaitPool->enqueue(actual, timeline);
     DPRINT("exit");
 }
 
@@ -103,12 +249,31 @@ void SyncThread::triggerBlockedWaitNoTimeline(FenceSync* fenceSync) {
 
 void SyncThread::cleanup() {
     DPRINT("enter");
+    if (mCleanedUp) return;
+    mCleanedUp = true;
+
+    mWaitPool->stop();
+    const SyncWaitPool::Stats stats = mWaitPool->stats();
+    VERBOSE_PRINT(syncthreads,
+                  "fence waits: %llu in %llu timeline increments, "
+                  "max queue depth %u, latency avg %llu us max %llu us",
+                  (unsigned long long)stats.waits,
+                  (unsigned long long)stats.timelineIncs,
+                  stats.maxQueueDepth,
+                  (unsigned long long)(stats.waits
+                          ? stats.totalLatencyUs / stats.waits : 0),
+                  (unsigned long long)stats.maxLatencyUs);
+
     SyncThreadCmd to_send;
     to_send.opCode = SYNC_THREAD_EXIT;
     sendAndWaitForResult(to_send);
     DPRINT("exit");
 }
 
+SyncWaitPool::Stats SyncThread::waitStats() const {
+    return mWaitPool->stats();
+}
+
 // Private methods below////////////////////////////////////////////////////////
 
 void SyncThread::initSyncContext() {
@@ -168,98 +333,11 @@ void SyncThread::sendAsync(SyncThreadCmd& cmd) {
 }
 
 void SyncThread::doSyncContextInit() {
-    const EGLDispatch* egl = emugl::LazyLoadedEGLDispatch::get();
-
-    mDisplay = egl->eglGetDisplay(EGL_DEFAULT_DISPLAY);
-    int eglMaj, eglMin;
-    egl->eglInitialize(mDisplay, &eglMaj , &eglMin);
-
-    const EGLint configAttribs[] = {
-        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
-        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,
-        EGL_RED_SIZE, 8,
-        EGL_GREEN_SIZE, 8,
-        EGL_BLUE_SIZE, 8,
-        EGL_NONE,
-    };
-
-    EGLint nConfigs;
-    EGLConfig config;
-
-    egl->eglChooseConfig(mDisplay, configAttribs, &config, 1, &nConfigs);
-
-    const EGLint pbufferAttribs[] = {
-        EGL_WIDTH, 1,
-        EGL_HEIGHT, 1,
-        EGL_NONE,
-    };
-
-    mSurface =
-        egl->eglCreatePbufferSurface(mDisplay, config, pbufferAttribs);
-
-    const EGLint contextAttribs[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
-    mContext = egl->eglCreateContext(mDisplay, config, EGL_NO_CONTEXT, contextAttribs);
-
-    egl->eglMakeCurrent(mDisplay, mSurface, mSurface, mContext);
-}
-
-void SyncThread::doSyncWait(SyncThreadCmd* cmd) {
-    DPRINT("enter");
-
-    FenceSync* fenceSync =
-        FenceSync::getFromHandle((uint64_t)(uintptr_t)cmd->fenceSync);
-
-    if (!fenceSync) {
-        emugl::emugl_sync_timeline_inc(cmd->timeline, kTimelineInterval);
-        return;
-    }
-
-    EGLint wait_result = 0x0;
-
-    DPRINT("wait on sync obj: %p", cmd->fenceSync);
-    wait_result = cmd->fenceSync->wait(kDefaultTimeoutNsecs);
-
-    DPRINT("done waiting, with wait result=0x%x. "
-           "increment timeline (and signal fence)",
-           wait_result);
-
-    if (wait_result != EGL_CONDITION_SATISFIED_KHR) {
-        DPRINT("error: eglClientWaitSync abnormal exit 0x%x\n",
-               wait_result);
-    }
-
-    DPRINT("issue timeline increment");
-
-    // We always unconditionally increment timeline at this point, even
-    // if the call to eglClientWaitSync returned abnormally.
-    // There are three cases to consider:
-    // - EGL_CONDITION_SATISFIED_KHR: either the sync object is already
-    //   signaled and we need to increment this timeline immediately, or
-    //   we have waited until the object is signaled, and then
-    //   we increment the timeline.
-    // - EGL_TIMEOUT_EXPIRED_KHR: the fence command we put in earlier
-    //   in the OpenGL stream is not actually ever signaled, and we
-    //   end up blocking in the above eglClientWaitSyncKHR call until
-    //   our timeout runs out. In this case, provided we have waited
-    //   for |kDefaultTimeoutNsecs|, the guest will have received all
-    //   relevant error messages about fence fd's not being signaled
-    //   in time, so we are properly emulating bad behavior even if
-    //   we now increment the timeline.
-    // - EGL_FALSE (error): chances are, the underlying EGL implementation
-    //   on the host doesn't actually support fence objects. In this case,
-    //   we should fail safe: 1) It must be only very old or faulty
-    //   graphics drivers / GPU's that don't support fence objects.
-    //   2) The consequences of signaling too early are generally, out of
-    //   order frames and scrambled textures in some apps. But, not
-    //   incrementing the timeline means that the app's rendering freezes.
-    //   So, despite the faulty GPU driver, not incrementing is too heavyweight a response.
-
-    emugl::emugl_sync_timeline_inc(cmd->timeline, kTimelineInterval);
-    FenceSync::incrementTimelineAndDeleteOldFences();
-
-    DPRINT("done timeline increment");
-
-    DPRINT("exit");
+    SyncContext ctx;
+    createSyncContext(&ctx);
+    mDisplay = ctx.display;
+    mContext = ctx.context;
+    mSurface = ctx.surface;
 }
 
 void SyncThread::doSyncBlockedWaitNoTimeline(SyncThreadCmd* cmd) {
@@ -288,14 +366,11 @@ void SyncThread::doSyncBlockedWaitNoTimeline(SyncThreadCmd* cmd) {
 }
 
 void SyncThread::doExit() {
-
-    if (mContext == EGL_NO_CONTEXT) return;
-
-    const EGLDispatch* egl = emugl::LazyLoadedEGLDispatch::get();
-
-    egl->eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
-    egl->eglDestroyContext(mDisplay, mContext);
-    egl->eglDestroySurface(mDisplay, mContext);
+    SyncContext ctx;
+    ctx.display = mDisplay;
+    ctx.context = mContext;
+    ctx.surface = mSurface;
+    destroySyncContext(&ctx);
     mContext = EGL_NO_CONTEXT;
     mSurface = EGL_NO_SURFACE;
 }
@@ -307,10 +382,6 @@ int SyncThread::doSyncThreadCmd(SyncThreadCmd* cmd) {
         DPRINT("exec SYNC_THREAD_INIT");
         doSyncContextInit();
         break;
-    case SYNC_THREAD_WAIT:
-        DPRINT("exec SYNC_THREAD_WAIT");
-        doSyncWait(cmd);
-        break;
     case SYNC_THREAD_EXIT:
         DPRINT("exec SYNC_THREAD_EXIT");
         doExit();
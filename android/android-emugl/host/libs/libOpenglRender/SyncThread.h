@@ -17,6 +17,7 @@
 #pragma once
 
 #include "FenceSync.h"
+#include "SyncWaitPool.h"
 
 #include <EGL/egl.h>
 #include <GLES2/gl2.h>
@@ -27,19 +28,19 @@
 
 #include "emugl/common/thread.h"
 
+#include <memory>
+
 // SyncThread///////////////////////////////////////////////////////////////////
 // The purpose of SyncThread is to track sync device timelines and give out +
 // signal FD's that correspond to the completion of host-side GL fence commands.
 
-// We communicate with the sync thread in 3 ways:
+// Waits that signal a guest timeline are handed to a |SyncWaitPool|, which
+// waits on fences of different timelines in parallel. The sync thread itself
+// only runs the commands below.
 enum SyncThreadOpCode {
     // Nonblocking command to initialize sync thread's contents,
     // such as the EGL context for sync operations
     SYNC_THREAD_INIT = 0,
-    // Nonblocking command to wait on a given FenceSync object
-    // and timeline handle.
-    // A fence FD object in the guest is signaled.
-    SYNC_THREAD_WAIT = 1,
     // Blocking command to clean up and exit the sync thread.
     SYNC_THREAD_EXIT = 2,
     // Blocking command to wait on a given FenceSync object.
@@ -64,9 +65,9 @@ public:
     ~SyncThread();
 
     // |triggerWait|: async wait with a given FenceSync object.
-    // We use the wait() method to do a eglClientWaitSyncKHR.
-    // After wait is over, the timeline will be incremented,
-    // which should signal the guest-side fence FD.
+    // A worker of the wait pool uses the wait() method to do a
+    // eglClientWaitSyncKHR. After wait is over, the timeline will be
+    // incremented, which should signal the guest-side fence FD.
     // This method is how the goldfish sync virtual device
     // knows when to increment timelines / signal native fence FD's.
     void triggerWait(FenceSync* fenceSync,
@@ -77,12 +78,16 @@ public:
     void triggerBlockedWaitNoTimeline(FenceSync* fenceSync);
 
     // |cleanup|: for use with destructors and other cleanup functions.
-    // it destroys the sync context and exits the sync thread.
+    // it signals the pending waits, stops the wait pool, destroys the sync
+    // context and exits the sync thread.
     // This is blocking; after this function returns, we're sure
     // the sync thread is gone.
     // - Triggers a |SyncThreadCmd| with op code |SYNC_THREAD_EXIT|
     void cleanup();
 
+    // Queue depth and fence latency of the waits from |triggerWait|.
+    SyncWaitPool::Stats waitStats() const;
+
     // Obtains the global sync thread.
     static SyncThread* get();
 
@@ -121,7 +126,6 @@ private:
     // execute the actual commands. These run on the sync thread.
     GLint doSyncThreadCmd(SyncThreadCmd* cmd);
     void doSyncContextInit();
-    void doSyncWait(SyncThreadCmd* cmd);
     void doSyncBlockedWaitNoTimeline(SyncThreadCmd* cmd);
     void doExit();
 
@@ -130,5 +134,10 @@ private:
     EGLDisplay mDisplay = EGL_NO_DISPLAY;
     EGLContext mContext = EGL_NO_CONTEXT;
     EGLSurface mSurface = EGL_NO_SURFACE;
+
+    // Waits on the fences from |triggerWait|; each of its workers has an
+    // EGL context of its own.
+    std::unique_ptr<SyncWaitPool> mWaitPool;
+    bool mCleanedUp = false;
 };
 
@@ -0,0 +1,156 @@
+/*
+* Copyright (C) 2021 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "SyncWaitPool.h"
+
+#include "android/base/system/System.h"
+
+#include <algorithm>
+
+using android::base::AutoLock;
+using android::base::FunctorThread;
+using android::base::System;
+
+SyncWaitPool::SyncWaitPool(int numWorkers, Callbacks callbacks)
+    : mCallbacks(std::move(callbacks)) {
+    for (int i = 0; i < std::max(1, numWorkers); ++i) {
+        mWorkers.emplace_back(
+                new FunctorThread([this] { workerLoop(); }));
+    }
+}
+
+SyncWaitPool::~SyncWaitPool() {
+    stop();
+}
+
+void SyncWaitPool::start() {
+    AutoLock lock(mLock);
+    if (mStarted || mStopping) return;
+    mStarted = true;
+    for (auto& worker : mWorkers) {
+        worker->start();
+    }
+}
+
+void SyncWaitPool::enqueue(FenceSync* fence, uint64_t timeline) {
+    AutoLock lock(mLock);
+    if (!mStarted || mStopping) {
+        // Nobody left to wait on it; not signaling would freeze the guest.
+        lock.unlock();
+        mCallbacks.signal(timeline, &fence, 1);
+        return;
+    }
+
+    Timeline& queue = mTimelines[timeline];
+    queue.waits.push_back({fence, System::get()->getHighResTimeUs()});
+    mStats.queueDepth++;
+    mStats.maxQueueDepth = std::max(mStats.maxQueueDepth, mStats.queueDepth);
+
+    // A busy timeline is requeued by its worker once it is done.
+    if (!queue.busy && queue.waits.size() == 1) {
+        mReady.push_back(timeline);
+        mCv.signal();
+    }
+}
+
+void SyncWaitPool::stop() {
+    {
+        AutoLock lock(mLock);
+        if (mStopping) return;
+        mStopping = true;
+        if (!mStarted) return;
+        mCv.broadcast();
+    }
+    for (auto& worker : mWorkers) {
+        worker->wait();
+    }
+}
+
+SyncWaitPool::Stats SyncWaitPool::stats() const {
+    AutoLock lock(mLock);
+    return mStats;
+}
+
+void SyncWaitPool::workerLoop() {
+    if (mCallbacks.onWorkerStart) {
+        mCallbacks.onWorkerStart();
+    }
+
+    std::vector<FenceSync*> batch;
+    batch.reserve(kMaxCoalescedWaits);
+
+    AutoLock lock(mLock);
+    for (;;) {
+        // When stopping, keep going until every queue is drained.
+        mCv.wait(&lock, [this] { return !mReady.empty() || mStopping; });
+        if (mReady.empty()) break;
+
+        const uint64_t timelineHandle = mReady.front();
+        mReady.pop_front();
+        // Only the worker that owns a busy timeline erases it.
+        Timeline& timeline = mTimelines[timelineHandle];
+        timeline.busy = true;
+        FenceSync* first = timeline.waits.front().fence;
+
+        lock.unlock();
+        mCallbacks.wait(first);
+        lock.lock();
+
+        // Fences queued behind it were submitted later, so they often
+        // complete together with it.
+        const size_t candidates =
+                std::min(timeline.waits.size(), kMaxCoalescedWaits);
+        batch.clear();
+        for (size_t i = 0; i < candidates; ++i) {
+            batch.push_back(timeline.waits[i].fence);
+        }
+
+        lock.unlock();
+        size_t count = 1;
+        while (count < batch.size() && mCallbacks.isSignaled(batch[count])) {
+            ++count;
+        }
+        mCallbacks.signal(timelineHandle, batch.data(), count);
+        const uint64_t nowUs = System::get()->getHighResTimeUs();
+        lock.lock();
+
+        for (size_t i = 0; i < count; ++i) {
+            const uint64_t latencyUs =
+                    nowUs - std::min(nowUs, timeline.waits.front().enqueueUs);
+            mStats.totalLatencyUs += latencyUs;
+            mStats.maxLatencyUs = std::max(mStats.maxLatencyUs, latencyUs);
+            timeline.waits.pop_front();
+        }
+        mStats.waits += count;
+        mStats.timelineIncs++;
+        mStats.queueDepth -= count;
+
+        timeline.busy = false;
+        if (timeline.waits.empty()) {
+            mTimelines.erase(timelineHandle);
+        } else {
+            // Behind the other timelines, so that a busy one can't starve
+            // them.
+            mReady.push_back(timelineHandle);
+            mCv.signal();
+        }
+    }
+    lock.unlock();
+
+    if (mCallbacks.onWorkerExit) {
+        mCallbacks.onWorkerExit();
+    }
+}
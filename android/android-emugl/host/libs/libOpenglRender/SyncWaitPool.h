@@ -0,0 +1,121 @@
+/*
+* Copyright (C) 2021 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include "android/base/Compiler.h"
+#include "android/base/synchronization/ConditionVariable.h"
+#include "android/base/synchronization/Lock.h"
+#include "android/base/threads/FunctorThread.h"
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <stdint.h>
+
+class FenceSync;
+
+// SyncWaitPool waits on host fences on behalf of the goldfish sync device,
+// using a few worker threads so that a slow fence on one guest timeline does
+// not hold back the fences of the others.
+//
+// - Fences of a timeline are waited on and signaled in the order they were
+//   queued, by one worker at a time.
+// - Fences of different timelines are waited on in parallel.
+// - Once a worker is done waiting, the fences queued after it on the same
+//   timeline that have already completed are signaled along with it, with a
+//   single timeline increment.
+//
+// The pool does not know what a FenceSync is; everything it does with one
+// goes through |Callbacks|.
+class SyncWaitPool {
+public:
+    struct Callbacks {
+        // Optional. Run on each worker when it starts / before it exits,
+        // e.g. to make an EGL context current.
+        std::function<void()> onWorkerStart;
+        std::function<void()> onWorkerExit;
+        // Blocks until |fence| is signaled, or gives up on it.
+        std::function<void(FenceSync* fence)> wait;
+        // Returns whether |fence| is signaled, without blocking.
+        std::function<bool(FenceSync* fence)> isSignaled;
+        // Signals the first |count| fences waiting on |timeline|.
+        std::function<void(uint64_t timeline,
+                           FenceSync* const* fences,
+                           size_t count)>
+                signal;
+    };
+
+    struct Stats {
+        // Fences signaled, and how many timeline increments that took.
+        uint64_t waits = 0;
+        uint64_t timelineIncs = 0;
+        // Fences queued or being waited on.
+        uint32_t queueDepth = 0;
+        uint32_t maxQueueDepth = 0;
+        // Time from enqueue() to the timeline increment.
+        uint64_t totalLatencyUs = 0;
+        uint64_t maxLatencyUs = 0;
+    };
+
+    // Fences that complete together are coalesced up to this many.
+    static constexpr size_t kMaxCoalescedWaits = 16;
+
+    SyncWaitPool(int numWorkers, Callbacks callbacks);
+    ~SyncWaitPool();
+
+    void start();
+
+    // Queues a wait on |fence|, after which |timeline| gets incremented.
+    void enqueue(FenceSync* fence, uint64_t timeline);
+
+    // Signals the fences that are still queued, then stops the workers.
+    // Fences queued after that are signaled right away.
+    void stop();
+
+    Stats stats() const;
+
+private:
+    struct Wait {
+        FenceSync* fence;
+        uint64_t enqueueUs;
+    };
+
+    struct Timeline {
+        std::deque<Wait> waits;
+        // A worker is waiting on the first fence.
+        bool busy = false;
+    };
+
+    void workerLoop();
+
+    const Callbacks mCallbacks;
+    std::vector<std::unique_ptr<android::base::FunctorThread>> mWorkers;
+
+    mutable android::base::Lock mLock;
+    android::base::ConditionVariable mCv;
+    std::unordered_map<uint64_t, Timeline> mTimelines;
+    // Timelines with fences to wait on, and no worker on them.
+    std::deque<uint64_t> mReady;
+    bool mStarted = false;
+    bool mStopping = false;
+    Stats mStats;
+
+    DISALLOW_COPY_ASSIGN_AND_MOVE(SyncWaitPool);
+};
@@ -0,0 +1,215 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SyncWaitPool.h"
+
+#include "android/base/synchronization/ConditionVariable.h"
+#include "android/base/synchronization/Lock.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <set>
+#include <vector>
+
+using android::base::AutoLock;
+using android::base::ConditionVariable;
+using android::base::Lock;
+
+namespace {
+
+// Stands in for the GPU: fences are plain numbers, signaled by the test.
+class FakeFences {
+public:
+    FakeFences() {
+        mCallbacks.wait = [this](FenceSync* fence) {
+            AutoLock lock(mLock);
+            mCv.wait(&lock, [this, fence] { return isSignaledLocked(fence); });
+        };
+        mCallbacks.isSignaled = [this](FenceSync* fence) {
+            AutoLock lock(mLock);
+            return isSignaledLocked(fence);
+        };
+        mCallbacks.signal = [this](uint64_t timeline, FenceSync* const* fences,
+                                   size_t count) {
+            AutoLock lock(mLock);
+            for (size_t i = 0; i < count; ++i) {
+                mTimelines[timeline].push_back(id(fences[i]));
+            }
+            mIncs[timeline]++;
+            mCv.broadcast();
+        };
+    }
+
+    static FenceSync* fence(uintptr_t id) {
+        return reinterpret_cast<FenceSync*>(id);
+    }
+
+    void signal(uintptr_t id) {
+        AutoLock lock(mLock);
+        mSignaled.insert(id);
+        mCv.broadcast();
+    }
+
+    // Waits until |count| fences of |timeline| got signaled.
+    std::vector<uintptr_t> waitForTimeline(uint64_t timeline, size_t count) {
+        AutoLock lock(mLock);
+        mCv.wait(&lock, [this, timeline, count] {
+            return mTimelines[timeline].size() >= count;
+        });
+        return mTimelines[timeline];
+    }
+
+    std::vector<uintptr_t> signaledOn(uint64_t timeline) {
+        AutoLock lock(mLock);
+        return mTimelines[timeline];
+    }
+
+    int incsOn(uint64_t timeline) {
+        AutoLock lock(mLock);
+        return mIncs[timeline];
+    }
+
+    const SyncWaitPool::Callbacks& callbacks() const { return mCallbacks; }
+
+private:
+    static uintptr_t id(FenceSync* fence) {
+        return reinterpret_cast<uintptr_t>(fence);
+    }
+
+    bool isSignaledLocked(FenceSync* fence) const {
+        return mSignaled.count(id(fence)) > 0;
+    }
+
+    SyncWaitPool::Callbacks mCallbacks;
+    Lock mLock;
+    ConditionVariable mCv;
+    std::set<uintptr_t> mSignaled;
+    std::map<uint64_t, std::vector<uintptr_t>> mTimelines;
+    std::map<uint64_t, int> mIncs;
+};
+
+}  // namespace
+
+TEST(SyncWaitPool, SignalsTimelineInOrder) {
+    FakeFences fences;
+    SyncWaitPool pool(4, fences.callbacks());
+    pool.start();
+
+    std::vector<uintptr_t> expected;
+    for (uintptr_t i = 1; i <= 100; ++i) {
+        pool.enqueue(FakeFences::fence(i), 7);
+        expected.push_back(i);
+    }
+    // Completing out of order doesn't matter, the timeline is in order.
+    for (uintptr_t i = 100; i >= 1; --i) {
+        fences.signal(i);
+    }
+
+    EXPECT_EQ(expected, fences.waitForTimeline(7, 100));
+    pool.stop();
+
+    const SyncWaitPool::Stats stats = pool.stats();
+    EXPECT_EQ(100u, stats.waits);
+    EXPECT_EQ(0u, stats.queueDepth);
+    EXPECT_LE(stats.timelineIncs, stats.waits);
+}
+
+TEST(SyncWaitPool, CoalescesCompletedFences) {
+    FakeFences fences;
+    SyncWaitPool pool(1, fences.callbacks());
+    pool.start();
+
+    for (uintptr_t i = 1; i <= 5; ++i) {
+        pool.enqueue(FakeFences::fence(i), 1);
+    }
+    // The worker is blocked on the first fence while the others complete.
+    for (uintptr_t i = 5; i >= 1; --i) {
+        fences.signal(i);
+    }
+
+    EXPECT_EQ(5u, fences.waitForTimeline(1, 5).size());
+    pool.stop();
+
+    EXPECT_EQ(1, fences.incsOn(1));
+    EXPECT_EQ(5u, pool.stats().maxQueueDepth);
+    EXPECT_EQ(1u, pool.stats().timelineIncs);
+}
+
+TEST(SyncWaitPool, DoesNotCoalesceBehindPendingFence) {
+    FakeFences fences;
+    SyncWaitPool pool(1, fences.callbacks());
+    pool.start();
+
+    pool.enqueue(FakeFences::fence(1), 1);
+    pool.enqueue(FakeFences::fence(2), 1);
+    pool.enqueue(FakeFences::fence(3), 1);
+    fences.signal(3);
+    fences.signal(1);
+
+    EXPECT_EQ(std::vector<uintptr_t>({1}), fences.waitForTimeline(1, 1));
+    fences.signal(2);
+    EXPECT_EQ(std::vector<uintptr_t>({1, 2, 3}),
+              fences.waitForTimeline(1, 3));
+    pool.stop();
+
+    EXPECT_EQ(2, fences.incsOn(1));
+}
+
+TEST(SyncWaitPool, SlowTimelineDoesNotBlockOthers) {
+    FakeFences fences;
+    SyncWaitPool pool(2, fences.callbacks());
+    pool.start();
+
+    pool.enqueue(FakeFences::fence(1), 1);
+    pool.enqueue(FakeFences::fence(2), 2);
+    pool.enqueue(FakeFences::fence(3), 2);
+    fences.signal(2);
+    fences.signal(3);
+
+    EXPECT_EQ(std::vector<uintptr_t>({2, 3}), fences.waitForTimeline(2, 2));
+    EXPECT_TRUE(fences.signaledOn(1).empty());
+
+    fences.signal(1);
+    EXPECT_EQ(std::vector<uintptr_t>({1}), fences.waitForTimeline(1, 1));
+    pool.stop();
+}
+
+TEST(SyncWaitPool, StopDrainsQueues) {
+    FakeFences fences;
+    SyncWaitPool pool(2, fences.callbacks());
+    pool.start();
+
+    for (uintptr_t i = 1; i <= 20; ++i) {
+        fences.signal(i);
+        pool.enqueue(FakeFences::fence(i), i % 3);
+    }
+    pool.stop();
+
+    EXPECT_EQ(20u, fences.signaledOn(0).size() + fences.signaledOn(1).size() +
+                           fences.signaledOn(2).size());
+    EXPECT_EQ(20u, pool.stats().waits);
+}
+
+TEST(SyncWaitPool, SignalsRightAwayWhenStopped) {
+    FakeFences fences;
+    SyncWaitPool pool(1, fences.callbacks());
+    pool.start();
+    pool.stop();
+    pool.stop();
+
+    // Never signaled by the "GPU", but nobody is left to wait on it.
+    pool.enqueue(FakeFences::fence(1), 3);
+    EXPECT_EQ(std::vector<uintptr_t>({1}), fences.signaledOn(3));
+}
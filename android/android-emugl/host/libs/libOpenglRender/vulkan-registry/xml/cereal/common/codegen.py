@@ -533,6 +533,10 @@ class CodeGen(object):
         return "sizeof(%s)" % (
             self.makeCTypeDecl(vulkanType, useParamName=False))
 
+    def alignofExpr(self, vulkanType):
+        return "alignof(%s)" % (
+            self.makeCTypeDecl(vulkanType, useParamName=False))
+
     def generalAccess(self,
                       vulkanType,
                       parentVarName=None,
@@ -262,6 +262,32 @@ class VulkanReservedMarshalingCodegen(VulkanTypeIterator):
                         (self.streamVarName,
                             access, bytesExpr))
 
+    def canReadInPlace(self, vulkanType, lenAccess):
+        # Const arrays of plain data are never written to by the decoder,
+        # so they can point straight into the stream instead of being
+        # copied out of it.
+        return self.dynAlloc and \
+            self.direction == "read" and \
+            lenAccess is not None and \
+            vulkanType.isConst and \
+            vulkanType.pointerIndirectionLevels == 1 and \
+            not vulkanType.isHandleType() and \
+            not vulkanType.isString() and \
+            not self.typeInfo.isCompoundType(vulkanType.typeName) and \
+            not self.typeInfo.isNonAbiPortableType(vulkanType.typeName)
+
+    def beginReadInPlace(self, vulkanType, access, lenAccess):
+        valueType = vulkanType.getForValueAccess()
+        # Empty arrays still read as null, like alloc() makes them.
+        self.cgen.beginIf("%s && ((uintptr_t)(*%s) & (%s - 1)) == 0" % (
+            lenAccess, self.ptrVar, self.cgen.alignofExpr(valueType)))
+        self.cgen.stmt("%s = %s(*%s)" % (
+            access, self.makeCastExpr(vulkanType.getForNonConstAccess()),
+            self.ptrVar))
+        self.genPtrIncr("%s * %s" % (lenAccess, self.cgen.sizeofExpr(valueType)))
+        self.cgen.endIf()
+        self.cgen.beginElse()
+
     def getOptionalStringFeatureExpr(self, vulkanType):
         if vulkanType.optionalStr is not None:
             if vulkanType.optionalStr.startswith("streamFeature:"):
@@ -620,6 +646,9 @@ class VulkanReservedMarshalingCodegen(VulkanTypeIterator):
         lenAccessGuard = self.lenAccessorGuard(vulkanType)
 
         self.beginFilterGuard(vulkanType)
+        readInPlace = self.canReadInPlace(vulkanType, lenAccess)
+        if readInPlace:
+            self.beginReadInPlace(vulkanType, access, lenAccess)
         self.doAllocSpace(vulkanType)
 
         if vulkanType.filterVar != None:
@@ -649,6 +678,9 @@ class VulkanReservedMarshalingCodegen(VulkanTypeIterator):
                         self.cgen.sizeofExpr(vulkanType.getForValueAccess()))
                 self.genStreamCall(vulkanType, access, finalLenExpr)
 
+        if readInPlace:
+            self.cgen.endElse()
+
         if self.direction == "read":
             self.endFilterGuard(vulkanType, "%s = 0" % access)
         else:
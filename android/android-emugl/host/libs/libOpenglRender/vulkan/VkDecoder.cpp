@@ -5918,9 +5918,17 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                 }
                 memcpy((uint32_t*)&dynamicOffsetCount, *readStreamPtrPtr, sizeof(uint32_t));
                 *readStreamPtrPtr += sizeof(uint32_t);
-                vkReadStream->alloc((void**)&pDynamicOffsets, ((dynamicOffsetCount)) * sizeof(const uint32_t));
-                memcpy((uint32_t*)pDynamicOffsets, *readStreamPtrPtr, ((dynamicOffsetCount)) * sizeof(const uint32_t));
-                *readStreamPtrPtr += ((dynamicOffsetCount)) * sizeof(const uint32_t);
+                if (((dynamicOffsetCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint32_t) - 1)) == 0)
+                {
+                    pDynamicOffsets = (uint32_t*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((dynamicOffsetCount)) * sizeof(const uint32_t);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pDynamicOffsets, ((dynamicOffsetCount)) * sizeof(const uint32_t));
+                    memcpy((uint32_t*)pDynamicOffsets, *readStreamPtrPtr, ((dynamicOffsetCount)) * sizeof(const uint32_t));
+                    *readStreamPtrPtr += ((dynamicOffsetCount)) * sizeof(const uint32_t);
+                }
                 if (m_logCalls)
                 {
                     fprintf(stderr, "stream %p: call vkCmdBindDescriptorSets 0x%llx 0x%llx 0x%llx 0x%llx 0x%llx 0x%llx 0x%llx 0x%llx \n", ioStream, (unsigned long long)commandBuffer, (unsigned long long)pipelineBindPoint, (unsigned long long)layout, (unsigned long long)firstSet, (unsigned long long)descriptorSetCount, (unsigned long long)pDescriptorSets, (unsigned long long)dynamicOffsetCount, (unsigned long long)pDynamicOffsets);
@@ -6009,9 +6017,17 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                         *(((VkBuffer*)pBuffers) + k) = (VkBuffer)unbox_VkBuffer((VkBuffer)tmpval);
                     }
                 }
-                vkReadStream->alloc((void**)&pOffsets, ((bindingCount)) * sizeof(const VkDeviceSize));
-                memcpy((VkDeviceSize*)pOffsets, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
-                *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                if (((bindingCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
+                {
+                    pOffsets = (VkDeviceSize*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pOffsets, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    memcpy((VkDeviceSize*)pOffsets, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                }
                 if (m_logCalls)
                 {
                     fprintf(stderr, "stream %p: call vkCmdBindVertexBuffers 0x%llx 0x%llx 0x%llx 0x%llx 0x%llx \n", ioStream, (unsigned long long)commandBuffer, (unsigned long long)firstBinding, (unsigned long long)bindingCount, (unsigned long long)pBuffers, (unsigned long long)pOffsets);
@@ -6586,9 +6602,17 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                 *readStreamPtrPtr += sizeof(VkDeviceSize);
                 memcpy((VkDeviceSize*)&dataSize, *readStreamPtrPtr, sizeof(VkDeviceSize));
                 *readStreamPtrPtr += sizeof(VkDeviceSize);
-                vkReadStream->alloc((void**)&pData, ((dataSize)) * sizeof(const uint8_t));
-                memcpy((void*)pData, *readStreamPtrPtr, ((dataSize)) * sizeof(const uint8_t));
-                *readStreamPtrPtr += ((dataSize)) * sizeof(const uint8_t);
+                if (((dataSize)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint8_t) - 1)) == 0)
+                {
+                    pData = (void*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((dataSize)) * sizeof(const uint8_t);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pData, ((dataSize)) * sizeof(const uint8_t));
+                    memcpy((void*)pData, *readStreamPtrPtr, ((dataSize)) * sizeof(const uint8_t));
+                    *readStreamPtrPtr += ((dataSize)) * sizeof(const uint8_t);
+                }
                 if (m_logCalls)
                 {
                     fprintf(stderr, "stream %p: call vkCmdUpdateBuffer 0x%llx 0x%llx 0x%llx 0x%llx 0x%llx \n", ioStream, (unsigned long long)commandBuffer, (unsigned long long)dstBuffer, (unsigned long long)dstOffset, (unsigned long long)dataSize, (unsigned long long)pData);
@@ -7384,9 +7408,17 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                 *readStreamPtrPtr += sizeof(uint32_t);
                 memcpy((uint32_t*)&size, *readStreamPtrPtr, sizeof(uint32_t));
                 *readStreamPtrPtr += sizeof(uint32_t);
-                vkReadStream->alloc((void**)&pValues, ((size)) * sizeof(const uint8_t));
-                memcpy((void*)pValues, *readStreamPtrPtr, ((size)) * sizeof(const uint8_t));
-                *readStreamPtrPtr += ((size)) * sizeof(const uint8_t);
+                if (((size)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint8_t) - 1)) == 0)
+                {
+                    pValues = (void*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((size)) * sizeof(const uint8_t);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pValues, ((size)) * sizeof(const uint8_t));
+                    memcpy((void*)pValues, *readStreamPtrPtr, ((size)) * sizeof(const uint8_t));
+                    *readStreamPtrPtr += ((size)) * sizeof(const uint8_t);
+                }
                 if (m_logCalls)
                 {
                     fprintf(stderr, "stream %p: call vkCmdPushConstants 0x%llx 0x%llx 0x%llx 0x%llx 0x%llx 0x%llx \n", ioStream, (unsigned long long)commandBuffer, (unsigned long long)layout, (unsigned long long)stageFlags, (unsigned long long)offset, (unsigned long long)size, (unsigned long long)pValues);
@@ -16776,18 +16808,34 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                         *(((VkBuffer*)pBuffers) + k) = (VkBuffer)unbox_VkBuffer((VkBuffer)tmpval);
                     }
                 }
-                vkReadStream->alloc((void**)&pOffsets, ((bindingCount)) * sizeof(const VkDeviceSize));
-                memcpy((VkDeviceSize*)pOffsets, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
-                *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                if (((bindingCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
+                {
+                    pOffsets = (VkDeviceSize*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pOffsets, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    memcpy((VkDeviceSize*)pOffsets, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                }
                 // WARNING PTR CHECK
                 memcpy((VkDeviceSize**)&pSizes, (*readStreamPtrPtr), 8);
                 android::base::Stream::fromBe64((uint8_t*)&pSizes);
                 *readStreamPtrPtr += 8;
                 if (pSizes)
                 {
-                    vkReadStream->alloc((void**)&pSizes, ((bindingCount)) * sizeof(const VkDeviceSize));
-                    memcpy((VkDeviceSize*)pSizes, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
-                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                    if (((bindingCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
+                    {
+                        pSizes = (VkDeviceSize*)(*readStreamPtrPtr);
+                        *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                    }
+                    else
+                    {
+                        vkReadStream->alloc((void**)&pSizes, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        memcpy((VkDeviceSize*)pSizes, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                    }
                 }
                 if (m_logCalls)
                 {
@@ -16850,9 +16898,17 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                 *readStreamPtrPtr += 8;
                 if (pCounterBufferOffsets)
                 {
-                    vkReadStream->alloc((void**)&pCounterBufferOffsets, ((counterBufferCount)) * sizeof(const VkDeviceSize));
-                    memcpy((VkDeviceSize*)pCounterBufferOffsets, *readStreamPtrPtr, ((counterBufferCount)) * sizeof(const VkDeviceSize));
-                    *readStreamPtrPtr += ((counterBufferCount)) * sizeof(const VkDeviceSize);
+                    if (((counterBufferCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
+                    {
+                        pCounterBufferOffsets = (VkDeviceSize*)(*readStreamPtrPtr);
+                        *readStreamPtrPtr += ((counterBufferCount)) * sizeof(const VkDeviceSize);
+                    }
+                    else
+                    {
+                        vkReadStream->alloc((void**)&pCounterBufferOffsets, ((counterBufferCount)) * sizeof(const VkDeviceSize));
+                        memcpy((VkDeviceSize*)pCounterBufferOffsets, *readStreamPtrPtr, ((counterBufferCount)) * sizeof(const VkDeviceSize));
+                        *readStreamPtrPtr += ((counterBufferCount)) * sizeof(const VkDeviceSize);
+                    }
                 }
                 if (m_logCalls)
                 {
@@ -16915,9 +16971,17 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                 *readStreamPtrPtr += 8;
                 if (pCounterBufferOffsets)
                 {
-                    vkReadStream->alloc((void**)&pCounterBufferOffsets, ((counterBufferCount)) * sizeof(const VkDeviceSize));
-                    memcpy((VkDeviceSize*)pCounterBufferOffsets, *readStreamPtrPtr, ((counterBufferCount)) * sizeof(const VkDeviceSize));
-                    *readStreamPtrPtr += ((counterBufferCount)) * sizeof(const VkDeviceSize);
+                    if (((counterBufferCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
+                    {
+                        pCounterBufferOffsets = (VkDeviceSize*)(*readStreamPtrPtr);
+                        *readStreamPtrPtr += ((counterBufferCount)) * sizeof(const VkDeviceSize);
+                    }
+                    else
+                    {
+                        vkReadStream->alloc((void**)&pCounterBufferOffsets, ((counterBufferCount)) * sizeof(const VkDeviceSize));
+                        memcpy((VkDeviceSize*)pCounterBufferOffsets, *readStreamPtrPtr, ((counterBufferCount)) * sizeof(const VkDeviceSize));
+                        *readStreamPtrPtr += ((counterBufferCount)) * sizeof(const VkDeviceSize);
+                    }
                 }
                 if (m_logCalls)
                 {
@@ -22793,18 +22857,34 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                         *(((VkBuffer*)pBuffers) + k) = (VkBuffer)unbox_VkBuffer((VkBuffer)tmpval);
                     }
                 }
-                vkReadStream->alloc((void**)&pOffsets, ((bindingCount)) * sizeof(const VkDeviceSize));
-                memcpy((VkDeviceSize*)pOffsets, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
-                *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                if (((bindingCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
+                {
+                    pOffsets = (VkDeviceSize*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pOffsets, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    memcpy((VkDeviceSize*)pOffsets, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                }
                 // WARNING PTR CHECK
                 memcpy((VkDeviceSize**)&pSizes, (*readStreamPtrPtr), 8);
                 android::base::Stream::fromBe64((uint8_t*)&pSizes);
                 *readStreamPtrPtr += 8;
                 if (pSizes)
                 {
-                    vkReadStream->alloc((void**)&pSizes, ((bindingCount)) * sizeof(const VkDeviceSize));
-                    memcpy((VkDeviceSize*)pSizes, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
-                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                    if (((bindingCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
+                    {
+                        pSizes = (VkDeviceSize*)(*readStreamPtrPtr);
+                        *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                    }
+                    else
+                    {
+                        vkReadStream->alloc((void**)&pSizes, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        memcpy((VkDeviceSize*)pSizes, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                    }
                 }
                 // WARNING PTR CHECK
                 memcpy((VkDeviceSize**)&pStrides, (*readStreamPtrPtr), 8);
@@ -22812,9 +22892,17 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                 *readStreamPtrPtr += 8;
                 if (pStrides)
                 {
-                    vkReadStream->alloc((void**)&pStrides, ((bindingCount)) * sizeof(const VkDeviceSize));
-                    memcpy((VkDeviceSize*)pStrides, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
-                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                    if (((bindingCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
+                    {
+                        pStrides = (VkDeviceSize*)(*readStreamPtrPtr);
+                        *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                    }
+                    else
+                    {
+                        vkReadStream->alloc((void**)&pStrides, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        memcpy((VkDeviceSize*)pStrides, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
+                    }
                 }
                 if (m_logCalls)
                 {
@@ -23799,9 +23887,17 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                 *readStreamPtrPtr += 8;
                 if (pImageInfoEntryIndices)
                 {
-                    vkReadStream->alloc((void**)&pImageInfoEntryIndices, ((imageInfoCount)) * sizeof(const uint32_t));
-                    memcpy((uint32_t*)pImageInfoEntryIndices, *readStreamPtrPtr, ((imageInfoCount)) * sizeof(const uint32_t));
-                    *readStreamPtrPtr += ((imageInfoCount)) * sizeof(const uint32_t);
+                    if (((imageInfoCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint32_t) - 1)) == 0)
+                    {
+                        pImageInfoEntryIndices = (uint32_t*)(*readStreamPtrPtr);
+                        *readStreamPtrPtr += ((imageInfoCount)) * sizeof(const uint32_t);
+                    }
+                    else
+                    {
+                        vkReadStream->alloc((void**)&pImageInfoEntryIndices, ((imageInfoCount)) * sizeof(const uint32_t));
+                        memcpy((uint32_t*)pImageInfoEntryIndices, *readStreamPtrPtr, ((imageInfoCount)) * sizeof(const uint32_t));
+                        *readStreamPtrPtr += ((imageInfoCount)) * sizeof(const uint32_t);
+                    }
                 }
                 // WARNING PTR CHECK
                 memcpy((uint32_t**)&pBufferInfoEntryIndices, (*readStreamPtrPtr), 8);
@@ -23809,9 +23905,17 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                 *readStreamPtrPtr += 8;
                 if (pBufferInfoEntryIndices)
                 {
-                    vkReadStream->alloc((void**)&pBufferInfoEntryIndices, ((bufferInfoCount)) * sizeof(const uint32_t));
-                    memcpy((uint32_t*)pBufferInfoEntryIndices, *readStreamPtrPtr, ((bufferInfoCount)) * sizeof(const uint32_t));
-                    *readStreamPtrPtr += ((bufferInfoCount)) * sizeof(const uint32_t);
+                    if (((bufferInfoCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint32_t) - 1)) == 0)
+                    {
+                        pBufferInfoEntryIndices = (uint32_t*)(*readStreamPtrPtr);
+                        *readStreamPtrPtr += ((bufferInfoCount)) * sizeof(const uint32_t);
+                    }
+                    else
+                    {
+                        vkReadStream->alloc((void**)&pBufferInfoEntryIndices, ((bufferInfoCount)) * sizeof(const uint32_t));
+                        memcpy((uint32_t*)pBufferInfoEntryIndices, *readStreamPtrPtr, ((bufferInfoCount)) * sizeof(const uint32_t));
+                        *readStreamPtrPtr += ((bufferInfoCount)) * sizeof(const uint32_t);
+                    }
                 }
                 // WARNING PTR CHECK
                 memcpy((uint32_t**)&pBufferViewEntryIndices, (*readStreamPtrPtr), 8);
@@ -23819,9 +23923,17 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                 *readStreamPtrPtr += 8;
                 if (pBufferViewEntryIndices)
                 {
-                    vkReadStream->alloc((void**)&pBufferViewEntryIndices, ((bufferViewCount)) * sizeof(const uint32_t));
-                    memcpy((uint32_t*)pBufferViewEntryIndices, *readStreamPtrPtr, ((bufferViewCount)) * sizeof(const uint32_t));
-                    *readStreamPtrPtr += ((bufferViewCount)) * sizeof(const uint32_t);
+                    if (((bufferViewCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint32_t) - 1)) == 0)
+                    {
+                        pBufferViewEntryIndices = (uint32_t*)(*readStreamPtrPtr);
+                        *readStreamPtrPtr += ((bufferViewCount)) * sizeof(const uint32_t);
+                    }
+                    else
+                    {
+                        vkReadStream->alloc((void**)&pBufferViewEntryIndices, ((bufferViewCount)) * sizeof(const uint32_t));
+                        memcpy((uint32_t*)pBufferViewEntryIndices, *readStreamPtrPtr, ((bufferViewCount)) * sizeof(const uint32_t));
+                        *readStreamPtrPtr += ((bufferViewCount)) * sizeof(const uint32_t);
+                    }
                 }
                 // WARNING PTR CHECK
                 memcpy((VkDescriptorImageInfo**)&pImageInfos, (*readStreamPtrPtr), 8);
@@ -24538,9 +24650,17 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                 *(VkCommandBuffer*)&commandBuffer = (VkCommandBuffer)(VkCommandBuffer)((VkCommandBuffer)(*&cgen_var_1));
                 memcpy((VkDeviceSize*)&dataSize, *readStreamPtrPtr, sizeof(VkDeviceSize));
                 *readStreamPtrPtr += sizeof(VkDeviceSize);
-                vkReadStream->alloc((void**)&pData, ((dataSize)) * sizeof(const uint8_t));
-                memcpy((void*)pData, *readStreamPtrPtr, ((dataSize)) * sizeof(const uint8_t));
-                *readStreamPtrPtr += ((dataSize)) * sizeof(const uint8_t);
+                if (((dataSize)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint8_t) - 1)) == 0)
+                {
+                    pData = (void*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((dataSize)) * sizeof(const uint8_t);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pData, ((dataSize)) * sizeof(const uint8_t));
+                    memcpy((void*)pData, *readStreamPtrPtr, ((dataSize)) * sizeof(const uint8_t));
+                    *readStreamPtrPtr += ((dataSize)) * sizeof(const uint8_t);
+                }
                 if (m_logCalls)
                 {
                     fprintf(stderr, "stream %p: call vkQueueFlushCommandsGOOGLE 0x%llx 0x%llx 0x%llx 0x%llx \n", ioStream, (unsigned long long)queue, (unsigned long long)commandBuffer, (unsigned long long)dataSize, (unsigned long long)pData);
@@ -24603,18 +24723,50 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                         *(((VkDescriptorSetLayout*)pSetLayouts) + k) = (VkDescriptorSetLayout)unbox_VkDescriptorSetLayout((VkDescriptorSetLayout)tmpval);
                     }
                 }
-                vkReadStream->alloc((void**)&pDescriptorSetPoolIds, ((descriptorSetCount)) * sizeof(const uint64_t));
-                memcpy((uint64_t*)pDescriptorSetPoolIds, *readStreamPtrPtr, ((descriptorSetCount)) * sizeof(const uint64_t));
-                *readStreamPtrPtr += ((descriptorSetCount)) * sizeof(const uint64_t);
-                vkReadStream->alloc((void**)&pDescriptorSetWhichPool, ((descriptorSetCount)) * sizeof(const uint32_t));
-                memcpy((uint32_t*)pDescriptorSetWhichPool, *readStreamPtrPtr, ((descriptorSetCount)) * sizeof(const uint32_t));
-                *readStreamPtrPtr += ((descriptorSetCount)) * sizeof(const uint32_t);
-                vkReadStream->alloc((void**)&pDescriptorSetPendingAllocation, ((descriptorSetCount)) * sizeof(const uint32_t));
-                memcpy((uint32_t*)pDescriptorSetPendingAllocation, *readStreamPtrPtr, ((descriptorSetCount)) * sizeof(const uint32_t));
-                *readStreamPtrPtr += ((descriptorSetCount)) * sizeof(const uint32_t);
-                vkReadStream->alloc((void**)&pDescriptorWriteStartingIndices, ((descriptorSetCount)) * sizeof(const uint32_t));
-                memcpy((uint32_t*)pDescriptorWriteStartingIndices, *readStreamPtrPtr, ((descriptorSetCount)) * sizeof(const uint32_t));
-                *readStreamPtrPtr += ((descriptorSetCount)) * sizeof(const uint32_t);
+                if (((descriptorSetCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint64_t) - 1)) == 0)
+                {
+                    pDescriptorSetPoolIds = (uint64_t*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((descriptorSetCount)) * sizeof(const uint64_t);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pDescriptorSetPoolIds, ((descriptorSetCount)) * sizeof(const uint64_t));
+                    memcpy((uint64_t*)pDescriptorSetPoolIds, *readStreamPtrPtr, ((descriptorSetCount)) * sizeof(const uint64_t));
+                    *readStreamPtrPtr += ((descriptorSetCount)) * sizeof(const uint64_t);
+                }
+                if (((descriptorSetCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint32_t) - 1)) == 0)
+                {
+                    pDescriptorSetWhichPool = (uint32_t*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((descriptorSetCount)) * sizeof(const uint32_t);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pDescriptorSetWhichPool, ((descriptorSetCount)) * sizeof(const uint32_t));
+                    memcpy((uint32_t*)pDescriptorSetWhichPool, *readStreamPtrPtr, ((descriptorSetCount)) * sizeof(const uint32_t));
+                    *readStreamPtrPtr += ((descriptorSetCount)) * sizeof(const uint32_t);
+                }
+                if (((descriptorSetCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint32_t) - 1)) == 0)
+                {
+                    pDescriptorSetPendingAllocation = (uint32_t*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((descriptorSetCount)) * sizeof(const uint32_t);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pDescriptorSetPendingAllocation, ((descriptorSetCount)) * sizeof(const uint32_t));
+                    memcpy((uint32_t*)pDescriptorSetPendingAllocation, *readStreamPtrPtr, ((descriptorSetCount)) * sizeof(const uint32_t));
+                    *readStreamPtrPtr += ((descriptorSetCount)) * sizeof(const uint32_t);
+                }
+                if (((descriptorSetCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint32_t) - 1)) == 0)
+                {
+                    pDescriptorWriteStartingIndices = (uint32_t*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((descriptorSetCount)) * sizeof(const uint32_t);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pDescriptorWriteStartingIndices, ((descriptorSetCount)) * sizeof(const uint32_t));
+                    memcpy((uint32_t*)pDescriptorWriteStartingIndices, *readStreamPtrPtr, ((descriptorSetCount)) * sizeof(const uint32_t));
+                    *readStreamPtrPtr += ((descriptorSetCount)) * sizeof(const uint32_t);
+                }
                 memcpy((uint32_t*)&pendingDescriptorWriteCount, *readStreamPtrPtr, sizeof(uint32_t));
                 *readStreamPtrPtr += sizeof(uint32_t);
                 vkReadStream->alloc((void**)&pPendingDescriptorWrites, ((pendingDescriptorWriteCount)) * sizeof(const VkWriteDescriptorSet));
@@ -24900,12 +25052,28 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                 {
                     reservedunmarshal_VkAccelerationStructureBuildGeometryInfoKHR(vkReadStream, (VkAccelerationStructureBuildGeometryInfoKHR*)(pInfos + i), readStreamPtrPtr);
                 }
-                vkReadStream->alloc((void**)&pIndirectDeviceAddresses, ((infoCount)) * sizeof(const VkDeviceAddress));
-                memcpy((VkDeviceAddress*)pIndirectDeviceAddresses, *readStreamPtrPtr, ((infoCount)) * sizeof(const VkDeviceAddress));
-                *readStreamPtrPtr += ((infoCount)) * sizeof(const VkDeviceAddress);
-                vkReadStream->alloc((void**)&pIndirectStrides, ((infoCount)) * sizeof(const uint32_t));
-                memcpy((uint32_t*)pIndirectStrides, *readStreamPtrPtr, ((infoCount)) * sizeof(const uint32_t));
-                *readStreamPtrPtr += ((infoCount)) * sizeof(const uint32_t);
+                if (((infoCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceAddress) - 1)) == 0)
+                {
+                    pIndirectDeviceAddresses = (VkDeviceAddress*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((infoCount)) * sizeof(const VkDeviceAddress);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pIndirectDeviceAddresses, ((infoCount)) * sizeof(const VkDeviceAddress));
+                    memcpy((VkDeviceAddress*)pIndirectDeviceAddresses, *readStreamPtrPtr, ((infoCount)) * sizeof(const VkDeviceAddress));
+                    *readStreamPtrPtr += ((infoCount)) * sizeof(const VkDeviceAddress);
+                }
+                if (((infoCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint32_t) - 1)) == 0)
+                {
+                    pIndirectStrides = (uint32_t*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((infoCount)) * sizeof(const uint32_t);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pIndirectStrides, ((infoCount)) * sizeof(const uint32_t));
+                    memcpy((uint32_t*)pIndirectStrides, *readStreamPtrPtr, ((infoCount)) * sizeof(const uint32_t));
+                    *readStreamPtrPtr += ((infoCount)) * sizeof(const uint32_t);
+                }
                 if (pInfos)
                 {
                     for (uint32_t i = 0; i < (uint32_t)((infoCount)); ++i)
@@ -25445,9 +25613,17 @@ size_t VkDecoder::Impl::decode(void* buf, size_t len, IOStream* ioStream, uint32
                 *readStreamPtrPtr += sizeof(VkAccelerationStructureBuildTypeKHR);
                 vkReadStream->alloc((void**)&pBuildInfo, sizeof(const VkAccelerationStructureBuildGeometryInfoKHR));
                 reservedunmarshal_VkAccelerationStructureBuildGeometryInfoKHR(vkReadStream, (VkAccelerationStructureBuildGeometryInfoKHR*)(pBuildInfo), readStreamPtrPtr);
-                vkReadStream->alloc((void**)&pMaxPrimitiveCounts, pBuildInfo->geometryCount * sizeof(const uint32_t));
-                memcpy((uint32_t*)pMaxPrimitiveCounts, *readStreamPtrPtr, pBuildInfo->geometryCount * sizeof(const uint32_t));
-                *readStreamPtrPtr += pBuildInfo->geometryCount * sizeof(const uint32_t);
+                if (pBuildInfo->geometryCount && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint32_t) - 1)) == 0)
+                {
+                    pMaxPrimitiveCounts = (uint32_t*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += pBuildInfo->geometryCount * sizeof(const uint32_t);
+                }
+                else
+                {
+                    vkReadStream->alloc((void**)&pMaxPrimitiveCounts, pBuildInfo->geometryCount * sizeof(const uint32_t));
+                    memcpy((uint32_t*)pMaxPrimitiveCounts, *readStreamPtrPtr, pBuildInfo->geometryCount * sizeof(const uint32_t));
+                    *readStreamPtrPtr += pBuildInfo->geometryCount * sizeof(const uint32_t);
+                }
                 // Begin manual dispatchable handle unboxing for pSizeInfo;
                 vkReadStream->unsetHandleMapping();
                 vkReadStream->alloc((void**)&pSizeInfo, sizeof(VkAccelerationStructureBuildSizesInfoKHR));
@@ -288,16 +288,24 @@ size_t subDecode(VulkanMemReadingStream* readStream, VulkanDispatch* vk, void* b
                 }
                 memcpy((uint32_t*)&dynamicOffsetCount, *readStreamPtrPtr, sizeof(uint32_t));
                 *readStreamPtrPtr += sizeof(uint32_t);
-                if (((dynamicOffsetCount)) <= MAX_STACK_ITEMS)
+                if (((dynamicOffsetCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint32_t) - 1)) == 0)
                 {
-                    pDynamicOffsets = (uint32_t*)stack_pDynamicOffsets;
+                    pDynamicOffsets = (uint32_t*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((dynamicOffsetCount)) * sizeof(const uint32_t);
                 }
                 else
                 {
-                    readStream->alloc((void**)&pDynamicOffsets, ((dynamicOffsetCount)) * sizeof(const uint32_t));
+                    if (((dynamicOffsetCount)) <= MAX_STACK_ITEMS)
+                    {
+                        pDynamicOffsets = (uint32_t*)stack_pDynamicOffsets;
+                    }
+                    else
+                    {
+                        readStream->alloc((void**)&pDynamicOffsets, ((dynamicOffsetCount)) * sizeof(const uint32_t));
+                    }
+                    memcpy((uint32_t*)pDynamicOffsets, *readStreamPtrPtr, ((dynamicOffsetCount)) * sizeof(const uint32_t));
+                    *readStreamPtrPtr += ((dynamicOffsetCount)) * sizeof(const uint32_t);
                 }
-                memcpy((uint32_t*)pDynamicOffsets, *readStreamPtrPtr, ((dynamicOffsetCount)) * sizeof(const uint32_t));
-                *readStreamPtrPtr += ((dynamicOffsetCount)) * sizeof(const uint32_t);
                 this->on_vkCmdBindDescriptorSets(pool, (VkCommandBuffer)(boxed_dispatchHandle), pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
                 android::base::endTrace();
                 break;
@@ -351,16 +359,24 @@ size_t subDecode(VulkanMemReadingStream* readStream, VulkanDispatch* vk, void* b
                         *(((VkBuffer*)pBuffers) + k) = (VkBuffer)unbox_VkBuffer((VkBuffer)tmpval);
                     }
                 }
-                if (((bindingCount)) <= MAX_STACK_ITEMS)
+                if (((bindingCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
                 {
-                    pOffsets = (VkDeviceSize*)stack_pOffsets;
+                    pOffsets = (VkDeviceSize*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                 }
                 else
                 {
-                    readStream->alloc((void**)&pOffsets, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    if (((bindingCount)) <= MAX_STACK_ITEMS)
+                    {
+                        pOffsets = (VkDeviceSize*)stack_pOffsets;
+                    }
+                    else
+                    {
+                        readStream->alloc((void**)&pOffsets, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    }
+                    memcpy((VkDeviceSize*)pOffsets, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                 }
-                memcpy((VkDeviceSize*)pOffsets, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
-                *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                 vk->vkCmdBindVertexBuffers((VkCommandBuffer)dispatchHandle, firstBinding, bindingCount, pBuffers, pOffsets);
                 android::base::endTrace();
                 break;
@@ -721,16 +737,24 @@ size_t subDecode(VulkanMemReadingStream* readStream, VulkanDispatch* vk, void* b
                 *readStreamPtrPtr += sizeof(VkDeviceSize);
                 memcpy((VkDeviceSize*)&dataSize, *readStreamPtrPtr, sizeof(VkDeviceSize));
                 *readStreamPtrPtr += sizeof(VkDeviceSize);
-                if (((dataSize)) <= MAX_STACK_ITEMS)
+                if (((dataSize)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint8_t) - 1)) == 0)
                 {
-                    pData = (void*)stack_pData;
+                    pData = (void*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((dataSize)) * sizeof(const uint8_t);
                 }
                 else
                 {
-                    readStream->alloc((void**)&pData, ((dataSize)) * sizeof(const uint8_t));
+                    if (((dataSize)) <= MAX_STACK_ITEMS)
+                    {
+                        pData = (void*)stack_pData;
+                    }
+                    else
+                    {
+                        readStream->alloc((void**)&pData, ((dataSize)) * sizeof(const uint8_t));
+                    }
+                    memcpy((void*)pData, *readStreamPtrPtr, ((dataSize)) * sizeof(const uint8_t));
+                    *readStreamPtrPtr += ((dataSize)) * sizeof(const uint8_t);
                 }
-                memcpy((void*)pData, *readStreamPtrPtr, ((dataSize)) * sizeof(const uint8_t));
-                *readStreamPtrPtr += ((dataSize)) * sizeof(const uint8_t);
                 vk->vkCmdUpdateBuffer((VkCommandBuffer)dispatchHandle, dstBuffer, dstOffset, dataSize, pData);
                 android::base::endTrace();
                 break;
@@ -1298,16 +1322,24 @@ size_t subDecode(VulkanMemReadingStream* readStream, VulkanDispatch* vk, void* b
                 *readStreamPtrPtr += sizeof(uint32_t);
                 memcpy((uint32_t*)&size, *readStreamPtrPtr, sizeof(uint32_t));
                 *readStreamPtrPtr += sizeof(uint32_t);
-                if (((size)) <= MAX_STACK_ITEMS)
+                if (((size)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint8_t) - 1)) == 0)
                 {
-                    pValues = (void*)stack_pValues;
+                    pValues = (void*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((size)) * sizeof(const uint8_t);
                 }
                 else
                 {
-                    readStream->alloc((void**)&pValues, ((size)) * sizeof(const uint8_t));
+                    if (((size)) <= MAX_STACK_ITEMS)
+                    {
+                        pValues = (void*)stack_pValues;
+                    }
+                    else
+                    {
+                        readStream->alloc((void**)&pValues, ((size)) * sizeof(const uint8_t));
+                    }
+                    memcpy((void*)pValues, *readStreamPtrPtr, ((size)) * sizeof(const uint8_t));
+                    *readStreamPtrPtr += ((size)) * sizeof(const uint8_t);
                 }
-                memcpy((void*)pValues, *readStreamPtrPtr, ((size)) * sizeof(const uint8_t));
-                *readStreamPtrPtr += ((size)) * sizeof(const uint8_t);
                 vk->vkCmdPushConstants((VkCommandBuffer)dispatchHandle, layout, stageFlags, offset, size, pValues);
                 android::base::endTrace();
                 break;
@@ -2113,32 +2145,48 @@ size_t subDecode(VulkanMemReadingStream* readStream, VulkanDispatch* vk, void* b
                         *(((VkBuffer*)pBuffers) + k) = (VkBuffer)unbox_VkBuffer((VkBuffer)tmpval);
                     }
                 }
-                if (((bindingCount)) <= MAX_STACK_ITEMS)
+                if (((bindingCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
                 {
-                    pOffsets = (VkDeviceSize*)stack_pOffsets;
+                    pOffsets = (VkDeviceSize*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                 }
                 else
                 {
-                    readStream->alloc((void**)&pOffsets, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    if (((bindingCount)) <= MAX_STACK_ITEMS)
+                    {
+                        pOffsets = (VkDeviceSize*)stack_pOffsets;
+                    }
+                    else
+                    {
+                        readStream->alloc((void**)&pOffsets, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    }
+                    memcpy((VkDeviceSize*)pOffsets, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                 }
-                memcpy((VkDeviceSize*)pOffsets, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
-                *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                 // WARNING PTR CHECK
                 memcpy((VkDeviceSize**)&pSizes, (*readStreamPtrPtr), 8);
                 android::base::Stream::fromBe64((uint8_t*)&pSizes);
                 *readStreamPtrPtr += 8;
                 if (pSizes)
                 {
-                    if (((bindingCount)) <= MAX_STACK_ITEMS)
+                    if (((bindingCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
                     {
-                        pSizes = (VkDeviceSize*)stack_pSizes;
+                        pSizes = (VkDeviceSize*)(*readStreamPtrPtr);
+                        *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                     }
                     else
                     {
-                        readStream->alloc((void**)&pSizes, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        if (((bindingCount)) <= MAX_STACK_ITEMS)
+                        {
+                            pSizes = (VkDeviceSize*)stack_pSizes;
+                        }
+                        else
+                        {
+                            readStream->alloc((void**)&pSizes, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        }
+                        memcpy((VkDeviceSize*)pSizes, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                     }
-                    memcpy((VkDeviceSize*)pSizes, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
-                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                 }
                 vk->vkCmdBindTransformFeedbackBuffersEXT((VkCommandBuffer)dispatchHandle, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
                 android::base::endTrace();
@@ -2188,16 +2236,24 @@ size_t subDecode(VulkanMemReadingStream* readStream, VulkanDispatch* vk, void* b
                 *readStreamPtrPtr += 8;
                 if (pCounterBufferOffsets)
                 {
-                    if (((counterBufferCount)) <= MAX_STACK_ITEMS)
+                    if (((counterBufferCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
                     {
-                        pCounterBufferOffsets = (VkDeviceSize*)stack_pCounterBufferOffsets;
+                        pCounterBufferOffsets = (VkDeviceSize*)(*readStreamPtrPtr);
+                        *readStreamPtrPtr += ((counterBufferCount)) * sizeof(const VkDeviceSize);
                     }
                     else
                     {
-                        readStream->alloc((void**)&pCounterBufferOffsets, ((counterBufferCount)) * sizeof(const VkDeviceSize));
+                        if (((counterBufferCount)) <= MAX_STACK_ITEMS)
+                        {
+                            pCounterBufferOffsets = (VkDeviceSize*)stack_pCounterBufferOffsets;
+                        }
+                        else
+                        {
+                            readStream->alloc((void**)&pCounterBufferOffsets, ((counterBufferCount)) * sizeof(const VkDeviceSize));
+                        }
+                        memcpy((VkDeviceSize*)pCounterBufferOffsets, *readStreamPtrPtr, ((counterBufferCount)) * sizeof(const VkDeviceSize));
+                        *readStreamPtrPtr += ((counterBufferCount)) * sizeof(const VkDeviceSize);
                     }
-                    memcpy((VkDeviceSize*)pCounterBufferOffsets, *readStreamPtrPtr, ((counterBufferCount)) * sizeof(const VkDeviceSize));
-                    *readStreamPtrPtr += ((counterBufferCount)) * sizeof(const VkDeviceSize);
                 }
                 vk->vkCmdBeginTransformFeedbackEXT((VkCommandBuffer)dispatchHandle, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
                 android::base::endTrace();
@@ -2247,16 +2303,24 @@ size_t subDecode(VulkanMemReadingStream* readStream, VulkanDispatch* vk, void* b
                 *readStreamPtrPtr += 8;
                 if (pCounterBufferOffsets)
                 {
-                    if (((counterBufferCount)) <= MAX_STACK_ITEMS)
+                    if (((counterBufferCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
                     {
-                        pCounterBufferOffsets = (VkDeviceSize*)stack_pCounterBufferOffsets;
+                        pCounterBufferOffsets = (VkDeviceSize*)(*readStreamPtrPtr);
+                        *readStreamPtrPtr += ((counterBufferCount)) * sizeof(const VkDeviceSize);
                     }
                     else
                     {
-                        readStream->alloc((void**)&pCounterBufferOffsets, ((counterBufferCount)) * sizeof(const VkDeviceSize));
+                        if (((counterBufferCount)) <= MAX_STACK_ITEMS)
+                        {
+                            pCounterBufferOffsets = (VkDeviceSize*)stack_pCounterBufferOffsets;
+                        }
+                        else
+                        {
+                            readStream->alloc((void**)&pCounterBufferOffsets, ((counterBufferCount)) * sizeof(const VkDeviceSize));
+                        }
+                        memcpy((VkDeviceSize*)pCounterBufferOffsets, *readStreamPtrPtr, ((counterBufferCount)) * sizeof(const VkDeviceSize));
+                        *readStreamPtrPtr += ((counterBufferCount)) * sizeof(const VkDeviceSize);
                     }
-                    memcpy((VkDeviceSize*)pCounterBufferOffsets, *readStreamPtrPtr, ((counterBufferCount)) * sizeof(const VkDeviceSize));
-                    *readStreamPtrPtr += ((counterBufferCount)) * sizeof(const VkDeviceSize);
                 }
                 vk->vkCmdEndTransformFeedbackEXT((VkCommandBuffer)dispatchHandle, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
                 android::base::endTrace();
@@ -3330,32 +3394,48 @@ size_t subDecode(VulkanMemReadingStream* readStream, VulkanDispatch* vk, void* b
                         *(((VkBuffer*)pBuffers) + k) = (VkBuffer)unbox_VkBuffer((VkBuffer)tmpval);
                     }
                 }
-                if (((bindingCount)) <= MAX_STACK_ITEMS)
+                if (((bindingCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
                 {
-                    pOffsets = (VkDeviceSize*)stack_pOffsets;
+                    pOffsets = (VkDeviceSize*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                 }
                 else
                 {
-                    readStream->alloc((void**)&pOffsets, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    if (((bindingCount)) <= MAX_STACK_ITEMS)
+                    {
+                        pOffsets = (VkDeviceSize*)stack_pOffsets;
+                    }
+                    else
+                    {
+                        readStream->alloc((void**)&pOffsets, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    }
+                    memcpy((VkDeviceSize*)pOffsets, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
+                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                 }
-                memcpy((VkDeviceSize*)pOffsets, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
-                *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                 // WARNING PTR CHECK
                 memcpy((VkDeviceSize**)&pSizes, (*readStreamPtrPtr), 8);
                 android::base::Stream::fromBe64((uint8_t*)&pSizes);
                 *readStreamPtrPtr += 8;
                 if (pSizes)
                 {
-                    if (((bindingCount)) <= MAX_STACK_ITEMS)
+                    if (((bindingCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
                     {
-                        pSizes = (VkDeviceSize*)stack_pSizes;
+                        pSizes = (VkDeviceSize*)(*readStreamPtrPtr);
+                        *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                     }
                     else
                     {
-                        readStream->alloc((void**)&pSizes, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        if (((bindingCount)) <= MAX_STACK_ITEMS)
+                        {
+                            pSizes = (VkDeviceSize*)stack_pSizes;
+                        }
+                        else
+                        {
+                            readStream->alloc((void**)&pSizes, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        }
+                        memcpy((VkDeviceSize*)pSizes, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                     }
-                    memcpy((VkDeviceSize*)pSizes, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
-                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                 }
                 // WARNING PTR CHECK
                 memcpy((VkDeviceSize**)&pStrides, (*readStreamPtrPtr), 8);
@@ -3363,16 +3443,24 @@ size_t subDecode(VulkanMemReadingStream* readStream, VulkanDispatch* vk, void* b
                 *readStreamPtrPtr += 8;
                 if (pStrides)
                 {
-                    if (((bindingCount)) <= MAX_STACK_ITEMS)
+                    if (((bindingCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceSize) - 1)) == 0)
                     {
-                        pStrides = (VkDeviceSize*)stack_pStrides;
+                        pStrides = (VkDeviceSize*)(*readStreamPtrPtr);
+                        *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                     }
                     else
                     {
-                        readStream->alloc((void**)&pStrides, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        if (((bindingCount)) <= MAX_STACK_ITEMS)
+                        {
+                            pStrides = (VkDeviceSize*)stack_pStrides;
+                        }
+                        else
+                        {
+                            readStream->alloc((void**)&pStrides, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        }
+                        memcpy((VkDeviceSize*)pStrides, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
+                        *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                     }
-                    memcpy((VkDeviceSize*)pStrides, *readStreamPtrPtr, ((bindingCount)) * sizeof(const VkDeviceSize));
-                    *readStreamPtrPtr += ((bindingCount)) * sizeof(const VkDeviceSize);
                 }
                 vk->vkCmdBindVertexBuffers2EXT((VkCommandBuffer)dispatchHandle, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
                 android::base::endTrace();
@@ -3659,26 +3747,42 @@ size_t subDecode(VulkanMemReadingStream* readStream, VulkanDispatch* vk, void* b
                 {
                     reservedunmarshal_VkAccelerationStructureBuildGeometryInfoKHR(readStream, (VkAccelerationStructureBuildGeometryInfoKHR*)(pInfos + i), readStreamPtrPtr);
                 }
-                if (((infoCount)) <= MAX_STACK_ITEMS)
+                if (((infoCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const VkDeviceAddress) - 1)) == 0)
                 {
-                    pIndirectDeviceAddresses = (VkDeviceAddress*)stack_pIndirectDeviceAddresses;
+                    pIndirectDeviceAddresses = (VkDeviceAddress*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((infoCount)) * sizeof(const VkDeviceAddress);
                 }
                 else
                 {
-                    readStream->alloc((void**)&pIndirectDeviceAddresses, ((infoCount)) * sizeof(const VkDeviceAddress));
+                    if (((infoCount)) <= MAX_STACK_ITEMS)
+                    {
+                        pIndirectDeviceAddresses = (VkDeviceAddress*)stack_pIndirectDeviceAddresses;
+                    }
+                    else
+                    {
+                        readStream->alloc((void**)&pIndirectDeviceAddresses, ((infoCount)) * sizeof(const VkDeviceAddress));
+                    }
+                    memcpy((VkDeviceAddress*)pIndirectDeviceAddresses, *readStreamPtrPtr, ((infoCount)) * sizeof(const VkDeviceAddress));
+                    *readStreamPtrPtr += ((infoCount)) * sizeof(const VkDeviceAddress);
                 }
-                memcpy((VkDeviceAddress*)pIndirectDeviceAddresses, *readStreamPtrPtr, ((infoCount)) * sizeof(const VkDeviceAddress));
-                *readStreamPtrPtr += ((infoCount)) * sizeof(const VkDeviceAddress);
-                if (((infoCount)) <= MAX_STACK_ITEMS)
+                if (((infoCount)) && ((uintptr_t)(*readStreamPtrPtr) & (alignof(const uint32_t) - 1)) == 0)
                 {
-                    pIndirectStrides = (uint32_t*)stack_pIndirectStrides;
+                    pIndirectStrides = (uint32_t*)(*readStreamPtrPtr);
+                    *readStreamPtrPtr += ((infoCount)) * sizeof(const uint32_t);
                 }
                 else
                 {
-                    readStream->alloc((void**)&pIndirectStrides, ((infoCount)) * sizeof(const uint32_t));
+                    if (((infoCount)) <= MAX_STACK_ITEMS)
+                    {
+                        pIndirectStrides = (uint32_t*)stack_pIndirectStrides;
+                    }
+                    else
+                    {
+                        readStream->alloc((void**)&pIndirectStrides, ((infoCount)) * sizeof(const uint32_t));
+                    }
+                    memcpy((uint32_t*)pIndirectStrides, *readStreamPtrPtr, ((infoCount)) * sizeof(const uint32_t));
+                    *readStreamPtrPtr += ((infoCount)) * sizeof(const uint32_t);
                 }
-                memcpy((uint32_t*)pIndirectStrides, *readStreamPtrPtr, ((infoCount)) * sizeof(const uint32_t));
-                *readStreamPtrPtr += ((infoCount)) * sizeof(const uint32_t);
                 if (pInfos)
                 {
                     for (uint32_t i = 0; i < (uint32_t)((infoCount)); ++i)
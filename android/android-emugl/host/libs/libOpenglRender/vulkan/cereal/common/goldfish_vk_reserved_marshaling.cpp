@@ -940,9 +940,17 @@ void reservedunmarshal_VkDeviceQueueCreateInfo(
     *ptr += sizeof(uint32_t);
     memcpy((uint32_t*)&forUnmarshaling->queueCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pQueuePriorities, forUnmarshaling->queueCount * sizeof(const float));
-    memcpy((float*)forUnmarshaling->pQueuePriorities, *ptr, forUnmarshaling->queueCount * sizeof(const float));
-    *ptr += forUnmarshaling->queueCount * sizeof(const float);
+    if (forUnmarshaling->queueCount && ((uintptr_t)(*ptr) & (alignof(const float) - 1)) == 0)
+    {
+        forUnmarshaling->pQueuePriorities = (float*)(*ptr);
+        *ptr += forUnmarshaling->queueCount * sizeof(const float);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pQueuePriorities, forUnmarshaling->queueCount * sizeof(const float));
+        memcpy((float*)forUnmarshaling->pQueuePriorities, *ptr, forUnmarshaling->queueCount * sizeof(const float));
+        *ptr += forUnmarshaling->queueCount * sizeof(const float);
+    }
 }
 
 void reservedunmarshal_VkDeviceCreateInfo(
@@ -1057,9 +1065,17 @@ void reservedunmarshal_VkSubmitInfo(
             }
         }
     }
-    vkStream->alloc((void**)&forUnmarshaling->pWaitDstStageMask, forUnmarshaling->waitSemaphoreCount * sizeof(const VkPipelineStageFlags));
-    memcpy((VkPipelineStageFlags*)forUnmarshaling->pWaitDstStageMask, *ptr, forUnmarshaling->waitSemaphoreCount * sizeof(const VkPipelineStageFlags));
-    *ptr += forUnmarshaling->waitSemaphoreCount * sizeof(const VkPipelineStageFlags);
+    if (forUnmarshaling->waitSemaphoreCount && ((uintptr_t)(*ptr) & (alignof(const VkPipelineStageFlags) - 1)) == 0)
+    {
+        forUnmarshaling->pWaitDstStageMask = (VkPipelineStageFlags*)(*ptr);
+        *ptr += forUnmarshaling->waitSemaphoreCount * sizeof(const VkPipelineStageFlags);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pWaitDstStageMask, forUnmarshaling->waitSemaphoreCount * sizeof(const VkPipelineStageFlags));
+        memcpy((VkPipelineStageFlags*)forUnmarshaling->pWaitDstStageMask, *ptr, forUnmarshaling->waitSemaphoreCount * sizeof(const VkPipelineStageFlags));
+        *ptr += forUnmarshaling->waitSemaphoreCount * sizeof(const VkPipelineStageFlags);
+    }
     memcpy((uint32_t*)&forUnmarshaling->commandBufferCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
     vkStream->alloc((void**)&forUnmarshaling->pCommandBuffers, forUnmarshaling->commandBufferCount * sizeof(const VkCommandBuffer));
@@ -1524,9 +1540,17 @@ void reservedunmarshal_VkBufferCreateInfo(
     *ptr += 8;
     if (forUnmarshaling->pQueueFamilyIndices)
     {
-        vkStream->alloc((void**)&forUnmarshaling->pQueueFamilyIndices, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
-        memcpy((uint32_t*)forUnmarshaling->pQueueFamilyIndices, *ptr, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
-        *ptr += forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t);
+        if (forUnmarshaling->queueFamilyIndexCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+        {
+            forUnmarshaling->pQueueFamilyIndices = (uint32_t*)(*ptr);
+            *ptr += forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t);
+        }
+        else
+        {
+            vkStream->alloc((void**)&forUnmarshaling->pQueueFamilyIndices, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
+            memcpy((uint32_t*)forUnmarshaling->pQueueFamilyIndices, *ptr, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
+            *ptr += forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t);
+        }
     }
 }
 
@@ -1615,9 +1639,17 @@ void reservedunmarshal_VkImageCreateInfo(
     *ptr += 8;
     if (forUnmarshaling->pQueueFamilyIndices)
     {
-        vkStream->alloc((void**)&forUnmarshaling->pQueueFamilyIndices, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
-        memcpy((uint32_t*)forUnmarshaling->pQueueFamilyIndices, *ptr, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
-        *ptr += forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t);
+        if (forUnmarshaling->queueFamilyIndexCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+        {
+            forUnmarshaling->pQueueFamilyIndices = (uint32_t*)(*ptr);
+            *ptr += forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t);
+        }
+        else
+        {
+            vkStream->alloc((void**)&forUnmarshaling->pQueueFamilyIndices, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
+            memcpy((uint32_t*)forUnmarshaling->pQueueFamilyIndices, *ptr, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
+            *ptr += forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t);
+        }
     }
     memcpy((VkImageLayout*)&forUnmarshaling->initialLayout, *ptr, sizeof(VkImageLayout));
     *ptr += sizeof(VkImageLayout);
@@ -1718,9 +1750,17 @@ void reservedunmarshal_VkShaderModuleCreateInfo(
     memcpy((size_t*)&forUnmarshaling->codeSize, (*ptr), 8);
     android::base::Stream::fromBe64((uint8_t*)&forUnmarshaling->codeSize);
     *ptr += 8;
-    vkStream->alloc((void**)&forUnmarshaling->pCode, (forUnmarshaling->codeSize / 4) * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pCode, *ptr, (forUnmarshaling->codeSize / 4) * sizeof(const uint32_t));
-    *ptr += (forUnmarshaling->codeSize / 4) * sizeof(const uint32_t);
+    if ((forUnmarshaling->codeSize / 4) && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pCode = (uint32_t*)(*ptr);
+        *ptr += (forUnmarshaling->codeSize / 4) * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pCode, (forUnmarshaling->codeSize / 4) * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pCode, *ptr, (forUnmarshaling->codeSize / 4) * sizeof(const uint32_t));
+        *ptr += (forUnmarshaling->codeSize / 4) * sizeof(const uint32_t);
+    }
 }
 
 void reservedunmarshal_VkPipelineCacheCreateInfo(
@@ -1750,9 +1790,17 @@ void reservedunmarshal_VkPipelineCacheCreateInfo(
     memcpy((size_t*)&forUnmarshaling->initialDataSize, (*ptr), 8);
     android::base::Stream::fromBe64((uint8_t*)&forUnmarshaling->initialDataSize);
     *ptr += 8;
-    vkStream->alloc((void**)&forUnmarshaling->pInitialData, forUnmarshaling->initialDataSize * sizeof(const uint8_t));
-    memcpy((void*)forUnmarshaling->pInitialData, *ptr, forUnmarshaling->initialDataSize * sizeof(const uint8_t));
-    *ptr += forUnmarshaling->initialDataSize * sizeof(const uint8_t);
+    if (forUnmarshaling->initialDataSize && ((uintptr_t)(*ptr) & (alignof(const uint8_t) - 1)) == 0)
+    {
+        forUnmarshaling->pInitialData = (void*)(*ptr);
+        *ptr += forUnmarshaling->initialDataSize * sizeof(const uint8_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pInitialData, forUnmarshaling->initialDataSize * sizeof(const uint8_t));
+        memcpy((void*)forUnmarshaling->pInitialData, *ptr, forUnmarshaling->initialDataSize * sizeof(const uint8_t));
+        *ptr += forUnmarshaling->initialDataSize * sizeof(const uint8_t);
+    }
 }
 
 void reservedunmarshal_VkSpecializationMapEntry(
@@ -1784,9 +1832,17 @@ void reservedunmarshal_VkSpecializationInfo(
     memcpy((size_t*)&forUnmarshaling->dataSize, (*ptr), 8);
     android::base::Stream::fromBe64((uint8_t*)&forUnmarshaling->dataSize);
     *ptr += 8;
-    vkStream->alloc((void**)&forUnmarshaling->pData, forUnmarshaling->dataSize * sizeof(const uint8_t));
-    memcpy((void*)forUnmarshaling->pData, *ptr, forUnmarshaling->dataSize * sizeof(const uint8_t));
-    *ptr += forUnmarshaling->dataSize * sizeof(const uint8_t);
+    if (forUnmarshaling->dataSize && ((uintptr_t)(*ptr) & (alignof(const uint8_t) - 1)) == 0)
+    {
+        forUnmarshaling->pData = (void*)(*ptr);
+        *ptr += forUnmarshaling->dataSize * sizeof(const uint8_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pData, forUnmarshaling->dataSize * sizeof(const uint8_t));
+        memcpy((void*)forUnmarshaling->pData, *ptr, forUnmarshaling->dataSize * sizeof(const uint8_t));
+        *ptr += forUnmarshaling->dataSize * sizeof(const uint8_t);
+    }
 }
 
 void reservedunmarshal_VkPipelineShaderStageCreateInfo(
@@ -2149,9 +2205,17 @@ void reservedunmarshal_VkPipelineMultisampleStateCreateInfo(
     *ptr += 8;
     if (forUnmarshaling->pSampleMask)
     {
-        vkStream->alloc((void**)&forUnmarshaling->pSampleMask, (((forUnmarshaling->rasterizationSamples) + 31) / 32) * sizeof(const VkSampleMask));
-        memcpy((VkSampleMask*)forUnmarshaling->pSampleMask, *ptr, (((forUnmarshaling->rasterizationSamples) + 31) / 32) * sizeof(const VkSampleMask));
-        *ptr += (((forUnmarshaling->rasterizationSamples) + 31) / 32) * sizeof(const VkSampleMask);
+        if ((((forUnmarshaling->rasterizationSamples) + 31) / 32) && ((uintptr_t)(*ptr) & (alignof(const VkSampleMask) - 1)) == 0)
+        {
+            forUnmarshaling->pSampleMask = (VkSampleMask*)(*ptr);
+            *ptr += (((forUnmarshaling->rasterizationSamples) + 31) / 32) * sizeof(const VkSampleMask);
+        }
+        else
+        {
+            vkStream->alloc((void**)&forUnmarshaling->pSampleMask, (((forUnmarshaling->rasterizationSamples) + 31) / 32) * sizeof(const VkSampleMask));
+            memcpy((VkSampleMask*)forUnmarshaling->pSampleMask, *ptr, (((forUnmarshaling->rasterizationSamples) + 31) / 32) * sizeof(const VkSampleMask));
+            *ptr += (((forUnmarshaling->rasterizationSamples) + 31) / 32) * sizeof(const VkSampleMask);
+        }
     }
     memcpy((VkBool32*)&forUnmarshaling->alphaToCoverageEnable, *ptr, sizeof(VkBool32));
     *ptr += sizeof(VkBool32);
@@ -2310,9 +2374,17 @@ void reservedunmarshal_VkPipelineDynamicStateCreateInfo(
     *ptr += sizeof(VkPipelineDynamicStateCreateFlags);
     memcpy((uint32_t*)&forUnmarshaling->dynamicStateCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pDynamicStates, forUnmarshaling->dynamicStateCount * sizeof(const VkDynamicState));
-    memcpy((VkDynamicState*)forUnmarshaling->pDynamicStates, *ptr, forUnmarshaling->dynamicStateCount * sizeof(const VkDynamicState));
-    *ptr += forUnmarshaling->dynamicStateCount * sizeof(const VkDynamicState);
+    if (forUnmarshaling->dynamicStateCount && ((uintptr_t)(*ptr) & (alignof(const VkDynamicState) - 1)) == 0)
+    {
+        forUnmarshaling->pDynamicStates = (VkDynamicState*)(*ptr);
+        *ptr += forUnmarshaling->dynamicStateCount * sizeof(const VkDynamicState);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pDynamicStates, forUnmarshaling->dynamicStateCount * sizeof(const VkDynamicState));
+        memcpy((VkDynamicState*)forUnmarshaling->pDynamicStates, *ptr, forUnmarshaling->dynamicStateCount * sizeof(const VkDynamicState));
+        *ptr += forUnmarshaling->dynamicStateCount * sizeof(const VkDynamicState);
+    }
 }
 
 void reservedunmarshal_VkGraphicsPipelineCreateInfo(
@@ -3090,9 +3162,17 @@ void reservedunmarshal_VkSubpassDescription(
     }
     memcpy((uint32_t*)&forUnmarshaling->preserveAttachmentCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pPreserveAttachments, forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pPreserveAttachments, *ptr, forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t);
+    if (forUnmarshaling->preserveAttachmentCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pPreserveAttachments = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pPreserveAttachments, forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pPreserveAttachments, *ptr, forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t);
+    }
 }
 
 void reservedunmarshal_VkSubpassDependency(
@@ -3787,19 +3867,43 @@ void reservedunmarshal_VkDeviceGroupSubmitInfo(
     }
     memcpy((uint32_t*)&forUnmarshaling->waitSemaphoreCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pWaitSemaphoreDeviceIndices, forUnmarshaling->waitSemaphoreCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pWaitSemaphoreDeviceIndices, *ptr, forUnmarshaling->waitSemaphoreCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->waitSemaphoreCount * sizeof(const uint32_t);
+    if (forUnmarshaling->waitSemaphoreCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pWaitSemaphoreDeviceIndices = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->waitSemaphoreCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pWaitSemaphoreDeviceIndices, forUnmarshaling->waitSemaphoreCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pWaitSemaphoreDeviceIndices, *ptr, forUnmarshaling->waitSemaphoreCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->waitSemaphoreCount * sizeof(const uint32_t);
+    }
     memcpy((uint32_t*)&forUnmarshaling->commandBufferCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pCommandBufferDeviceMasks, forUnmarshaling->commandBufferCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pCommandBufferDeviceMasks, *ptr, forUnmarshaling->commandBufferCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->commandBufferCount * sizeof(const uint32_t);
+    if (forUnmarshaling->commandBufferCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pCommandBufferDeviceMasks = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->commandBufferCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pCommandBufferDeviceMasks, forUnmarshaling->commandBufferCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pCommandBufferDeviceMasks, *ptr, forUnmarshaling->commandBufferCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->commandBufferCount * sizeof(const uint32_t);
+    }
     memcpy((uint32_t*)&forUnmarshaling->signalSemaphoreCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pSignalSemaphoreDeviceIndices, forUnmarshaling->signalSemaphoreCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pSignalSemaphoreDeviceIndices, *ptr, forUnmarshaling->signalSemaphoreCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->signalSemaphoreCount * sizeof(const uint32_t);
+    if (forUnmarshaling->signalSemaphoreCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pSignalSemaphoreDeviceIndices = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->signalSemaphoreCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pSignalSemaphoreDeviceIndices, forUnmarshaling->signalSemaphoreCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pSignalSemaphoreDeviceIndices, *ptr, forUnmarshaling->signalSemaphoreCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->signalSemaphoreCount * sizeof(const uint32_t);
+    }
 }
 
 void reservedunmarshal_VkDeviceGroupBindSparseInfo(
@@ -3854,9 +3958,17 @@ void reservedunmarshal_VkBindBufferMemoryDeviceGroupInfo(
     }
     memcpy((uint32_t*)&forUnmarshaling->deviceIndexCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pDeviceIndices, forUnmarshaling->deviceIndexCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pDeviceIndices, *ptr, forUnmarshaling->deviceIndexCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->deviceIndexCount * sizeof(const uint32_t);
+    if (forUnmarshaling->deviceIndexCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pDeviceIndices = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->deviceIndexCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pDeviceIndices, forUnmarshaling->deviceIndexCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pDeviceIndices, *ptr, forUnmarshaling->deviceIndexCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->deviceIndexCount * sizeof(const uint32_t);
+    }
 }
 
 void reservedunmarshal_VkBindImageMemoryDeviceGroupInfo(
@@ -3883,9 +3995,17 @@ void reservedunmarshal_VkBindImageMemoryDeviceGroupInfo(
     }
     memcpy((uint32_t*)&forUnmarshaling->deviceIndexCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pDeviceIndices, forUnmarshaling->deviceIndexCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pDeviceIndices, *ptr, forUnmarshaling->deviceIndexCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->deviceIndexCount * sizeof(const uint32_t);
+    if (forUnmarshaling->deviceIndexCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pDeviceIndices = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->deviceIndexCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pDeviceIndices, forUnmarshaling->deviceIndexCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pDeviceIndices, *ptr, forUnmarshaling->deviceIndexCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->deviceIndexCount * sizeof(const uint32_t);
+    }
     memcpy((uint32_t*)&forUnmarshaling->splitInstanceBindRegionCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
     vkStream->alloc((void**)&forUnmarshaling->pSplitInstanceBindRegions, forUnmarshaling->splitInstanceBindRegionCount * sizeof(const VkRect2D));
@@ -4488,19 +4608,43 @@ void reservedunmarshal_VkRenderPassMultiviewCreateInfo(
     }
     memcpy((uint32_t*)&forUnmarshaling->subpassCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pViewMasks, forUnmarshaling->subpassCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pViewMasks, *ptr, forUnmarshaling->subpassCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->subpassCount * sizeof(const uint32_t);
+    if (forUnmarshaling->subpassCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pViewMasks = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->subpassCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pViewMasks, forUnmarshaling->subpassCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pViewMasks, *ptr, forUnmarshaling->subpassCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->subpassCount * sizeof(const uint32_t);
+    }
     memcpy((uint32_t*)&forUnmarshaling->dependencyCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pViewOffsets, forUnmarshaling->dependencyCount * sizeof(const int32_t));
-    memcpy((int32_t*)forUnmarshaling->pViewOffsets, *ptr, forUnmarshaling->dependencyCount * sizeof(const int32_t));
-    *ptr += forUnmarshaling->dependencyCount * sizeof(const int32_t);
+    if (forUnmarshaling->dependencyCount && ((uintptr_t)(*ptr) & (alignof(const int32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pViewOffsets = (int32_t*)(*ptr);
+        *ptr += forUnmarshaling->dependencyCount * sizeof(const int32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pViewOffsets, forUnmarshaling->dependencyCount * sizeof(const int32_t));
+        memcpy((int32_t*)forUnmarshaling->pViewOffsets, *ptr, forUnmarshaling->dependencyCount * sizeof(const int32_t));
+        *ptr += forUnmarshaling->dependencyCount * sizeof(const int32_t);
+    }
     memcpy((uint32_t*)&forUnmarshaling->correlationMaskCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pCorrelationMasks, forUnmarshaling->correlationMaskCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pCorrelationMasks, *ptr, forUnmarshaling->correlationMaskCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->correlationMaskCount * sizeof(const uint32_t);
+    if (forUnmarshaling->correlationMaskCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pCorrelationMasks = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->correlationMaskCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pCorrelationMasks, forUnmarshaling->correlationMaskCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pCorrelationMasks, *ptr, forUnmarshaling->correlationMaskCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->correlationMaskCount * sizeof(const uint32_t);
+    }
 }
 
 void reservedunmarshal_VkPhysicalDeviceMultiviewFeatures(
@@ -5799,9 +5943,17 @@ void reservedunmarshal_VkImageFormatListCreateInfo(
     }
     memcpy((uint32_t*)&forUnmarshaling->viewFormatCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pViewFormats, forUnmarshaling->viewFormatCount * sizeof(const VkFormat));
-    memcpy((VkFormat*)forUnmarshaling->pViewFormats, *ptr, forUnmarshaling->viewFormatCount * sizeof(const VkFormat));
-    *ptr += forUnmarshaling->viewFormatCount * sizeof(const VkFormat);
+    if (forUnmarshaling->viewFormatCount && ((uintptr_t)(*ptr) & (alignof(const VkFormat) - 1)) == 0)
+    {
+        forUnmarshaling->pViewFormats = (VkFormat*)(*ptr);
+        *ptr += forUnmarshaling->viewFormatCount * sizeof(const VkFormat);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pViewFormats, forUnmarshaling->viewFormatCount * sizeof(const VkFormat));
+        memcpy((VkFormat*)forUnmarshaling->pViewFormats, *ptr, forUnmarshaling->viewFormatCount * sizeof(const VkFormat));
+        *ptr += forUnmarshaling->viewFormatCount * sizeof(const VkFormat);
+    }
 }
 
 void reservedunmarshal_VkAttachmentDescription2(
@@ -5941,9 +6093,17 @@ void reservedunmarshal_VkSubpassDescription2(
     }
     memcpy((uint32_t*)&forUnmarshaling->preserveAttachmentCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pPreserveAttachments, forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pPreserveAttachments, *ptr, forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t);
+    if (forUnmarshaling->preserveAttachmentCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pPreserveAttachments = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pPreserveAttachments, forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pPreserveAttachments, *ptr, forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->preserveAttachmentCount * sizeof(const uint32_t);
+    }
 }
 
 void reservedunmarshal_VkSubpassDependency2(
@@ -6033,9 +6193,17 @@ void reservedunmarshal_VkRenderPassCreateInfo2(
     }
     memcpy((uint32_t*)&forUnmarshaling->correlatedViewMaskCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pCorrelatedViewMasks, forUnmarshaling->correlatedViewMaskCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pCorrelatedViewMasks, *ptr, forUnmarshaling->correlatedViewMaskCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->correlatedViewMaskCount * sizeof(const uint32_t);
+    if (forUnmarshaling->correlatedViewMaskCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pCorrelatedViewMasks = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->correlatedViewMaskCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pCorrelatedViewMasks, forUnmarshaling->correlatedViewMaskCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pCorrelatedViewMasks, *ptr, forUnmarshaling->correlatedViewMaskCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->correlatedViewMaskCount * sizeof(const uint32_t);
+    }
 }
 
 void reservedunmarshal_VkSubpassBeginInfo(
@@ -6293,9 +6461,17 @@ void reservedunmarshal_VkDescriptorSetLayoutBindingFlagsCreateInfo(
     *ptr += 8;
     if (forUnmarshaling->pBindingFlags)
     {
-        vkStream->alloc((void**)&forUnmarshaling->pBindingFlags, forUnmarshaling->bindingCount * sizeof(const VkDescriptorBindingFlags));
-        memcpy((VkDescriptorBindingFlags*)forUnmarshaling->pBindingFlags, *ptr, forUnmarshaling->bindingCount * sizeof(const VkDescriptorBindingFlags));
-        *ptr += forUnmarshaling->bindingCount * sizeof(const VkDescriptorBindingFlags);
+        if (forUnmarshaling->bindingCount && ((uintptr_t)(*ptr) & (alignof(const VkDescriptorBindingFlags) - 1)) == 0)
+        {
+            forUnmarshaling->pBindingFlags = (VkDescriptorBindingFlags*)(*ptr);
+            *ptr += forUnmarshaling->bindingCount * sizeof(const VkDescriptorBindingFlags);
+        }
+        else
+        {
+            vkStream->alloc((void**)&forUnmarshaling->pBindingFlags, forUnmarshaling->bindingCount * sizeof(const VkDescriptorBindingFlags));
+            memcpy((VkDescriptorBindingFlags*)forUnmarshaling->pBindingFlags, *ptr, forUnmarshaling->bindingCount * sizeof(const VkDescriptorBindingFlags));
+            *ptr += forUnmarshaling->bindingCount * sizeof(const VkDescriptorBindingFlags);
+        }
     }
 }
 
@@ -6457,9 +6633,17 @@ void reservedunmarshal_VkDescriptorSetVariableDescriptorCountAllocateInfo(
     }
     memcpy((uint32_t*)&forUnmarshaling->descriptorSetCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pDescriptorCounts, forUnmarshaling->descriptorSetCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pDescriptorCounts, *ptr, forUnmarshaling->descriptorSetCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->descriptorSetCount * sizeof(const uint32_t);
+    if (forUnmarshaling->descriptorSetCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pDescriptorCounts = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->descriptorSetCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pDescriptorCounts, forUnmarshaling->descriptorSetCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pDescriptorCounts, *ptr, forUnmarshaling->descriptorSetCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->descriptorSetCount * sizeof(const uint32_t);
+    }
 }
 
 void reservedunmarshal_VkDescriptorSetVariableDescriptorCountLayoutSupport(
@@ -6753,9 +6937,17 @@ void reservedunmarshal_VkFramebufferAttachmentImageInfo(
     *ptr += sizeof(uint32_t);
     memcpy((uint32_t*)&forUnmarshaling->viewFormatCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pViewFormats, forUnmarshaling->viewFormatCount * sizeof(const VkFormat));
-    memcpy((VkFormat*)forUnmarshaling->pViewFormats, *ptr, forUnmarshaling->viewFormatCount * sizeof(const VkFormat));
-    *ptr += forUnmarshaling->viewFormatCount * sizeof(const VkFormat);
+    if (forUnmarshaling->viewFormatCount && ((uintptr_t)(*ptr) & (alignof(const VkFormat) - 1)) == 0)
+    {
+        forUnmarshaling->pViewFormats = (VkFormat*)(*ptr);
+        *ptr += forUnmarshaling->viewFormatCount * sizeof(const VkFormat);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pViewFormats, forUnmarshaling->viewFormatCount * sizeof(const VkFormat));
+        memcpy((VkFormat*)forUnmarshaling->pViewFormats, *ptr, forUnmarshaling->viewFormatCount * sizeof(const VkFormat));
+        *ptr += forUnmarshaling->viewFormatCount * sizeof(const VkFormat);
+    }
 }
 
 void reservedunmarshal_VkFramebufferAttachmentsCreateInfo(
@@ -7097,9 +7289,17 @@ void reservedunmarshal_VkTimelineSemaphoreSubmitInfo(
     *ptr += 8;
     if (forUnmarshaling->pWaitSemaphoreValues)
     {
-        vkStream->alloc((void**)&forUnmarshaling->pWaitSemaphoreValues, forUnmarshaling->waitSemaphoreValueCount * sizeof(const uint64_t));
-        memcpy((uint64_t*)forUnmarshaling->pWaitSemaphoreValues, *ptr, forUnmarshaling->waitSemaphoreValueCount * sizeof(const uint64_t));
-        *ptr += forUnmarshaling->waitSemaphoreValueCount * sizeof(const uint64_t);
+        if (forUnmarshaling->waitSemaphoreValueCount && ((uintptr_t)(*ptr) & (alignof(const uint64_t) - 1)) == 0)
+        {
+            forUnmarshaling->pWaitSemaphoreValues = (uint64_t*)(*ptr);
+            *ptr += forUnmarshaling->waitSemaphoreValueCount * sizeof(const uint64_t);
+        }
+        else
+        {
+            vkStream->alloc((void**)&forUnmarshaling->pWaitSemaphoreValues, forUnmarshaling->waitSemaphoreValueCount * sizeof(const uint64_t));
+            memcpy((uint64_t*)forUnmarshaling->pWaitSemaphoreValues, *ptr, forUnmarshaling->waitSemaphoreValueCount * sizeof(const uint64_t));
+            *ptr += forUnmarshaling->waitSemaphoreValueCount * sizeof(const uint64_t);
+        }
     }
     memcpy((uint32_t*)&forUnmarshaling->signalSemaphoreValueCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
@@ -7109,9 +7309,17 @@ void reservedunmarshal_VkTimelineSemaphoreSubmitInfo(
     *ptr += 8;
     if (forUnmarshaling->pSignalSemaphoreValues)
     {
-        vkStream->alloc((void**)&forUnmarshaling->pSignalSemaphoreValues, forUnmarshaling->signalSemaphoreValueCount * sizeof(const uint64_t));
-        memcpy((uint64_t*)forUnmarshaling->pSignalSemaphoreValues, *ptr, forUnmarshaling->signalSemaphoreValueCount * sizeof(const uint64_t));
-        *ptr += forUnmarshaling->signalSemaphoreValueCount * sizeof(const uint64_t);
+        if (forUnmarshaling->signalSemaphoreValueCount && ((uintptr_t)(*ptr) & (alignof(const uint64_t) - 1)) == 0)
+        {
+            forUnmarshaling->pSignalSemaphoreValues = (uint64_t*)(*ptr);
+            *ptr += forUnmarshaling->signalSemaphoreValueCount * sizeof(const uint64_t);
+        }
+        else
+        {
+            vkStream->alloc((void**)&forUnmarshaling->pSignalSemaphoreValues, forUnmarshaling->signalSemaphoreValueCount * sizeof(const uint64_t));
+            memcpy((uint64_t*)forUnmarshaling->pSignalSemaphoreValues, *ptr, forUnmarshaling->signalSemaphoreValueCount * sizeof(const uint64_t));
+            *ptr += forUnmarshaling->signalSemaphoreValueCount * sizeof(const uint64_t);
+        }
     }
 }
 
@@ -7155,9 +7363,17 @@ void reservedunmarshal_VkSemaphoreWaitInfo(
             }
         }
     }
-    vkStream->alloc((void**)&forUnmarshaling->pValues, forUnmarshaling->semaphoreCount * sizeof(const uint64_t));
-    memcpy((uint64_t*)forUnmarshaling->pValues, *ptr, forUnmarshaling->semaphoreCount * sizeof(const uint64_t));
-    *ptr += forUnmarshaling->semaphoreCount * sizeof(const uint64_t);
+    if (forUnmarshaling->semaphoreCount && ((uintptr_t)(*ptr) & (alignof(const uint64_t) - 1)) == 0)
+    {
+        forUnmarshaling->pValues = (uint64_t*)(*ptr);
+        *ptr += forUnmarshaling->semaphoreCount * sizeof(const uint64_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pValues, forUnmarshaling->semaphoreCount * sizeof(const uint64_t));
+        memcpy((uint64_t*)forUnmarshaling->pValues, *ptr, forUnmarshaling->semaphoreCount * sizeof(const uint64_t));
+        *ptr += forUnmarshaling->semaphoreCount * sizeof(const uint64_t);
+    }
 }
 
 void reservedunmarshal_VkSemaphoreSignalInfo(
@@ -7416,9 +7632,17 @@ void reservedunmarshal_VkSwapchainCreateInfoKHR(
     *ptr += 8;
     if (forUnmarshaling->pQueueFamilyIndices)
     {
-        vkStream->alloc((void**)&forUnmarshaling->pQueueFamilyIndices, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
-        memcpy((uint32_t*)forUnmarshaling->pQueueFamilyIndices, *ptr, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
-        *ptr += forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t);
+        if (forUnmarshaling->queueFamilyIndexCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+        {
+            forUnmarshaling->pQueueFamilyIndices = (uint32_t*)(*ptr);
+            *ptr += forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t);
+        }
+        else
+        {
+            vkStream->alloc((void**)&forUnmarshaling->pQueueFamilyIndices, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
+            memcpy((uint32_t*)forUnmarshaling->pQueueFamilyIndices, *ptr, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
+            *ptr += forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t);
+        }
     }
     memcpy((VkSurfaceTransformFlagBitsKHR*)&forUnmarshaling->preTransform, *ptr, sizeof(VkSurfaceTransformFlagBitsKHR));
     *ptr += sizeof(VkSurfaceTransformFlagBitsKHR);
@@ -7488,9 +7712,17 @@ void reservedunmarshal_VkPresentInfoKHR(
             }
         }
     }
-    vkStream->alloc((void**)&forUnmarshaling->pImageIndices, forUnmarshaling->swapchainCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pImageIndices, *ptr, forUnmarshaling->swapchainCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->swapchainCount * sizeof(const uint32_t);
+    if (forUnmarshaling->swapchainCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pImageIndices = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->swapchainCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pImageIndices, forUnmarshaling->swapchainCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pImageIndices, *ptr, forUnmarshaling->swapchainCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->swapchainCount * sizeof(const uint32_t);
+    }
     // WARNING PTR CHECK
     memcpy((VkResult**)&forUnmarshaling->pResults, (*ptr), 8);
     android::base::Stream::fromBe64((uint8_t*)&forUnmarshaling->pResults);
@@ -7653,9 +7885,17 @@ void reservedunmarshal_VkDeviceGroupPresentInfoKHR(
     }
     memcpy((uint32_t*)&forUnmarshaling->swapchainCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pDeviceMasks, forUnmarshaling->swapchainCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pDeviceMasks, *ptr, forUnmarshaling->swapchainCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->swapchainCount * sizeof(const uint32_t);
+    if (forUnmarshaling->swapchainCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pDeviceMasks = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->swapchainCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pDeviceMasks, forUnmarshaling->swapchainCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pDeviceMasks, *ptr, forUnmarshaling->swapchainCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->swapchainCount * sizeof(const uint32_t);
+    }
     memcpy((VkDeviceGroupPresentModeFlagBitsKHR*)&forUnmarshaling->mode, *ptr, sizeof(VkDeviceGroupPresentModeFlagBitsKHR));
     *ptr += sizeof(VkDeviceGroupPresentModeFlagBitsKHR);
 }
@@ -8326,12 +8566,28 @@ void reservedunmarshal_VkWin32KeyedMutexAcquireReleaseInfoKHR(
             }
         }
     }
-    vkStream->alloc((void**)&forUnmarshaling->pAcquireKeys, forUnmarshaling->acquireCount * sizeof(const uint64_t));
-    memcpy((uint64_t*)forUnmarshaling->pAcquireKeys, *ptr, forUnmarshaling->acquireCount * sizeof(const uint64_t));
-    *ptr += forUnmarshaling->acquireCount * sizeof(const uint64_t);
-    vkStream->alloc((void**)&forUnmarshaling->pAcquireTimeouts, forUnmarshaling->acquireCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pAcquireTimeouts, *ptr, forUnmarshaling->acquireCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->acquireCount * sizeof(const uint32_t);
+    if (forUnmarshaling->acquireCount && ((uintptr_t)(*ptr) & (alignof(const uint64_t) - 1)) == 0)
+    {
+        forUnmarshaling->pAcquireKeys = (uint64_t*)(*ptr);
+        *ptr += forUnmarshaling->acquireCount * sizeof(const uint64_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pAcquireKeys, forUnmarshaling->acquireCount * sizeof(const uint64_t));
+        memcpy((uint64_t*)forUnmarshaling->pAcquireKeys, *ptr, forUnmarshaling->acquireCount * sizeof(const uint64_t));
+        *ptr += forUnmarshaling->acquireCount * sizeof(const uint64_t);
+    }
+    if (forUnmarshaling->acquireCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pAcquireTimeouts = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->acquireCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pAcquireTimeouts, forUnmarshaling->acquireCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pAcquireTimeouts, *ptr, forUnmarshaling->acquireCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->acquireCount * sizeof(const uint32_t);
+    }
     memcpy((uint32_t*)&forUnmarshaling->releaseCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
     vkStream->alloc((void**)&forUnmarshaling->pReleaseSyncs, forUnmarshaling->releaseCount * sizeof(const VkDeviceMemory));
@@ -8348,9 +8604,17 @@ void reservedunmarshal_VkWin32KeyedMutexAcquireReleaseInfoKHR(
             }
         }
     }
-    vkStream->alloc((void**)&forUnmarshaling->pReleaseKeys, forUnmarshaling->releaseCount * sizeof(const uint64_t));
-    memcpy((uint64_t*)forUnmarshaling->pReleaseKeys, *ptr, forUnmarshaling->releaseCount * sizeof(const uint64_t));
-    *ptr += forUnmarshaling->releaseCount * sizeof(const uint64_t);
+    if (forUnmarshaling->releaseCount && ((uintptr_t)(*ptr) & (alignof(const uint64_t) - 1)) == 0)
+    {
+        forUnmarshaling->pReleaseKeys = (uint64_t*)(*ptr);
+        *ptr += forUnmarshaling->releaseCount * sizeof(const uint64_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pReleaseKeys, forUnmarshaling->releaseCount * sizeof(const uint64_t));
+        memcpy((uint64_t*)forUnmarshaling->pReleaseKeys, *ptr, forUnmarshaling->releaseCount * sizeof(const uint64_t));
+        *ptr += forUnmarshaling->releaseCount * sizeof(const uint64_t);
+    }
 }
 
 #endif
@@ -8463,9 +8727,17 @@ void reservedunmarshal_VkD3D12FenceSubmitInfoKHR(
     *ptr += 8;
     if (forUnmarshaling->pWaitSemaphoreValues)
     {
-        vkStream->alloc((void**)&forUnmarshaling->pWaitSemaphoreValues, forUnmarshaling->waitSemaphoreValuesCount * sizeof(const uint64_t));
-        memcpy((uint64_t*)forUnmarshaling->pWaitSemaphoreValues, *ptr, forUnmarshaling->waitSemaphoreValuesCount * sizeof(const uint64_t));
-        *ptr += forUnmarshaling->waitSemaphoreValuesCount * sizeof(const uint64_t);
+        if (forUnmarshaling->waitSemaphoreValuesCount && ((uintptr_t)(*ptr) & (alignof(const uint64_t) - 1)) == 0)
+        {
+            forUnmarshaling->pWaitSemaphoreValues = (uint64_t*)(*ptr);
+            *ptr += forUnmarshaling->waitSemaphoreValuesCount * sizeof(const uint64_t);
+        }
+        else
+        {
+            vkStream->alloc((void**)&forUnmarshaling->pWaitSemaphoreValues, forUnmarshaling->waitSemaphoreValuesCount * sizeof(const uint64_t));
+            memcpy((uint64_t*)forUnmarshaling->pWaitSemaphoreValues, *ptr, forUnmarshaling->waitSemaphoreValuesCount * sizeof(const uint64_t));
+            *ptr += forUnmarshaling->waitSemaphoreValuesCount * sizeof(const uint64_t);
+        }
     }
     memcpy((uint32_t*)&forUnmarshaling->signalSemaphoreValuesCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
@@ -8475,9 +8747,17 @@ void reservedunmarshal_VkD3D12FenceSubmitInfoKHR(
     *ptr += 8;
     if (forUnmarshaling->pSignalSemaphoreValues)
     {
-        vkStream->alloc((void**)&forUnmarshaling->pSignalSemaphoreValues, forUnmarshaling->signalSemaphoreValuesCount * sizeof(const uint64_t));
-        memcpy((uint64_t*)forUnmarshaling->pSignalSemaphoreValues, *ptr, forUnmarshaling->signalSemaphoreValuesCount * sizeof(const uint64_t));
-        *ptr += forUnmarshaling->signalSemaphoreValuesCount * sizeof(const uint64_t);
+        if (forUnmarshaling->signalSemaphoreValuesCount && ((uintptr_t)(*ptr) & (alignof(const uint64_t) - 1)) == 0)
+        {
+            forUnmarshaling->pSignalSemaphoreValues = (uint64_t*)(*ptr);
+            *ptr += forUnmarshaling->signalSemaphoreValuesCount * sizeof(const uint64_t);
+        }
+        else
+        {
+            vkStream->alloc((void**)&forUnmarshaling->pSignalSemaphoreValues, forUnmarshaling->signalSemaphoreValuesCount * sizeof(const uint64_t));
+            memcpy((uint64_t*)forUnmarshaling->pSignalSemaphoreValues, *ptr, forUnmarshaling->signalSemaphoreValuesCount * sizeof(const uint64_t));
+            *ptr += forUnmarshaling->signalSemaphoreValuesCount * sizeof(const uint64_t);
+        }
     }
 }
 
@@ -9037,9 +9317,17 @@ void reservedunmarshal_VkQueryPoolPerformanceCreateInfoKHR(
     *ptr += sizeof(uint32_t);
     memcpy((uint32_t*)&forUnmarshaling->counterIndexCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pCounterIndices, forUnmarshaling->counterIndexCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pCounterIndices, *ptr, forUnmarshaling->counterIndexCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->counterIndexCount * sizeof(const uint32_t);
+    if (forUnmarshaling->counterIndexCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pCounterIndices = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->counterIndexCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pCounterIndices, forUnmarshaling->counterIndexCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pCounterIndices, *ptr, forUnmarshaling->counterIndexCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->counterIndexCount * sizeof(const uint32_t);
+    }
 }
 
 void reservedunmarshal_VkPerformanceCounterResultKHR(
@@ -10544,9 +10832,17 @@ void reservedunmarshal_VkDebugMarkerObjectTagInfoEXT(
     memcpy((size_t*)&forUnmarshaling->tagSize, (*ptr), 8);
     android::base::Stream::fromBe64((uint8_t*)&forUnmarshaling->tagSize);
     *ptr += 8;
-    vkStream->alloc((void**)&forUnmarshaling->pTag, forUnmarshaling->tagSize * sizeof(const uint8_t));
-    memcpy((void*)forUnmarshaling->pTag, *ptr, forUnmarshaling->tagSize * sizeof(const uint8_t));
-    *ptr += forUnmarshaling->tagSize * sizeof(const uint8_t);
+    if (forUnmarshaling->tagSize && ((uintptr_t)(*ptr) & (alignof(const uint8_t) - 1)) == 0)
+    {
+        forUnmarshaling->pTag = (void*)(*ptr);
+        *ptr += forUnmarshaling->tagSize * sizeof(const uint8_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pTag, forUnmarshaling->tagSize * sizeof(const uint8_t));
+        memcpy((void*)forUnmarshaling->pTag, *ptr, forUnmarshaling->tagSize * sizeof(const uint8_t));
+        *ptr += forUnmarshaling->tagSize * sizeof(const uint8_t);
+    }
 }
 
 void reservedunmarshal_VkDebugMarkerMarkerInfoEXT(
@@ -11145,12 +11441,28 @@ void reservedunmarshal_VkWin32KeyedMutexAcquireReleaseInfoNV(
             }
         }
     }
-    vkStream->alloc((void**)&forUnmarshaling->pAcquireKeys, forUnmarshaling->acquireCount * sizeof(const uint64_t));
-    memcpy((uint64_t*)forUnmarshaling->pAcquireKeys, *ptr, forUnmarshaling->acquireCount * sizeof(const uint64_t));
-    *ptr += forUnmarshaling->acquireCount * sizeof(const uint64_t);
-    vkStream->alloc((void**)&forUnmarshaling->pAcquireTimeoutMilliseconds, forUnmarshaling->acquireCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pAcquireTimeoutMilliseconds, *ptr, forUnmarshaling->acquireCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->acquireCount * sizeof(const uint32_t);
+    if (forUnmarshaling->acquireCount && ((uintptr_t)(*ptr) & (alignof(const uint64_t) - 1)) == 0)
+    {
+        forUnmarshaling->pAcquireKeys = (uint64_t*)(*ptr);
+        *ptr += forUnmarshaling->acquireCount * sizeof(const uint64_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pAcquireKeys, forUnmarshaling->acquireCount * sizeof(const uint64_t));
+        memcpy((uint64_t*)forUnmarshaling->pAcquireKeys, *ptr, forUnmarshaling->acquireCount * sizeof(const uint64_t));
+        *ptr += forUnmarshaling->acquireCount * sizeof(const uint64_t);
+    }
+    if (forUnmarshaling->acquireCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pAcquireTimeoutMilliseconds = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->acquireCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pAcquireTimeoutMilliseconds, forUnmarshaling->acquireCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pAcquireTimeoutMilliseconds, *ptr, forUnmarshaling->acquireCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->acquireCount * sizeof(const uint32_t);
+    }
     memcpy((uint32_t*)&forUnmarshaling->releaseCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
     vkStream->alloc((void**)&forUnmarshaling->pReleaseSyncs, forUnmarshaling->releaseCount * sizeof(const VkDeviceMemory));
@@ -11167,9 +11479,17 @@ void reservedunmarshal_VkWin32KeyedMutexAcquireReleaseInfoNV(
             }
         }
     }
-    vkStream->alloc((void**)&forUnmarshaling->pReleaseKeys, forUnmarshaling->releaseCount * sizeof(const uint64_t));
-    memcpy((uint64_t*)forUnmarshaling->pReleaseKeys, *ptr, forUnmarshaling->releaseCount * sizeof(const uint64_t));
-    *ptr += forUnmarshaling->releaseCount * sizeof(const uint64_t);
+    if (forUnmarshaling->releaseCount && ((uintptr_t)(*ptr) & (alignof(const uint64_t) - 1)) == 0)
+    {
+        forUnmarshaling->pReleaseKeys = (uint64_t*)(*ptr);
+        *ptr += forUnmarshaling->releaseCount * sizeof(const uint64_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pReleaseKeys, forUnmarshaling->releaseCount * sizeof(const uint64_t));
+        memcpy((uint64_t*)forUnmarshaling->pReleaseKeys, *ptr, forUnmarshaling->releaseCount * sizeof(const uint64_t));
+        *ptr += forUnmarshaling->releaseCount * sizeof(const uint64_t);
+    }
 }
 
 #endif
@@ -11198,9 +11518,17 @@ void reservedunmarshal_VkValidationFlagsEXT(
     }
     memcpy((uint32_t*)&forUnmarshaling->disabledValidationCheckCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pDisabledValidationChecks, forUnmarshaling->disabledValidationCheckCount * sizeof(const VkValidationCheckEXT));
-    memcpy((VkValidationCheckEXT*)forUnmarshaling->pDisabledValidationChecks, *ptr, forUnmarshaling->disabledValidationCheckCount * sizeof(const VkValidationCheckEXT));
-    *ptr += forUnmarshaling->disabledValidationCheckCount * sizeof(const VkValidationCheckEXT);
+    if (forUnmarshaling->disabledValidationCheckCount && ((uintptr_t)(*ptr) & (alignof(const VkValidationCheckEXT) - 1)) == 0)
+    {
+        forUnmarshaling->pDisabledValidationChecks = (VkValidationCheckEXT*)(*ptr);
+        *ptr += forUnmarshaling->disabledValidationCheckCount * sizeof(const VkValidationCheckEXT);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pDisabledValidationChecks, forUnmarshaling->disabledValidationCheckCount * sizeof(const VkValidationCheckEXT));
+        memcpy((VkValidationCheckEXT*)forUnmarshaling->pDisabledValidationChecks, *ptr, forUnmarshaling->disabledValidationCheckCount * sizeof(const VkValidationCheckEXT));
+        *ptr += forUnmarshaling->disabledValidationCheckCount * sizeof(const VkValidationCheckEXT);
+    }
 }
 
 #endif
@@ -12356,9 +12684,17 @@ void reservedunmarshal_VkDebugUtilsObjectTagInfoEXT(
     memcpy((size_t*)&forUnmarshaling->tagSize, (*ptr), 8);
     android::base::Stream::fromBe64((uint8_t*)&forUnmarshaling->tagSize);
     *ptr += 8;
-    vkStream->alloc((void**)&forUnmarshaling->pTag, forUnmarshaling->tagSize * sizeof(const uint8_t));
-    memcpy((void*)forUnmarshaling->pTag, *ptr, forUnmarshaling->tagSize * sizeof(const uint8_t));
-    *ptr += forUnmarshaling->tagSize * sizeof(const uint8_t);
+    if (forUnmarshaling->tagSize && ((uintptr_t)(*ptr) & (alignof(const uint8_t) - 1)) == 0)
+    {
+        forUnmarshaling->pTag = (void*)(*ptr);
+        *ptr += forUnmarshaling->tagSize * sizeof(const uint8_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pTag, forUnmarshaling->tagSize * sizeof(const uint8_t));
+        memcpy((void*)forUnmarshaling->pTag, *ptr, forUnmarshaling->tagSize * sizeof(const uint8_t));
+        *ptr += forUnmarshaling->tagSize * sizeof(const uint8_t);
+    }
 }
 
 #endif
@@ -12633,9 +12969,17 @@ void reservedunmarshal_VkWriteDescriptorSetInlineUniformBlockEXT(
     }
     memcpy((uint32_t*)&forUnmarshaling->dataSize, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pData, forUnmarshaling->dataSize * sizeof(const uint8_t));
-    memcpy((void*)forUnmarshaling->pData, *ptr, forUnmarshaling->dataSize * sizeof(const uint8_t));
-    *ptr += forUnmarshaling->dataSize * sizeof(const uint8_t);
+    if (forUnmarshaling->dataSize && ((uintptr_t)(*ptr) & (alignof(const uint8_t) - 1)) == 0)
+    {
+        forUnmarshaling->pData = (void*)(*ptr);
+        *ptr += forUnmarshaling->dataSize * sizeof(const uint8_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pData, forUnmarshaling->dataSize * sizeof(const uint8_t));
+        memcpy((void*)forUnmarshaling->pData, *ptr, forUnmarshaling->dataSize * sizeof(const uint8_t));
+        *ptr += forUnmarshaling->dataSize * sizeof(const uint8_t);
+    }
 }
 
 void reservedunmarshal_VkDescriptorPoolInlineUniformBlockCreateInfoEXT(
@@ -13020,9 +13364,17 @@ void reservedunmarshal_VkPipelineCoverageModulationStateCreateInfoNV(
     *ptr += 8;
     if (forUnmarshaling->pCoverageModulationTable)
     {
-        vkStream->alloc((void**)&forUnmarshaling->pCoverageModulationTable, forUnmarshaling->coverageModulationTableCount * sizeof(const float));
-        memcpy((float*)forUnmarshaling->pCoverageModulationTable, *ptr, forUnmarshaling->coverageModulationTableCount * sizeof(const float));
-        *ptr += forUnmarshaling->coverageModulationTableCount * sizeof(const float);
+        if (forUnmarshaling->coverageModulationTableCount && ((uintptr_t)(*ptr) & (alignof(const float) - 1)) == 0)
+        {
+            forUnmarshaling->pCoverageModulationTable = (float*)(*ptr);
+            *ptr += forUnmarshaling->coverageModulationTableCount * sizeof(const float);
+        }
+        else
+        {
+            vkStream->alloc((void**)&forUnmarshaling->pCoverageModulationTable, forUnmarshaling->coverageModulationTableCount * sizeof(const float));
+            memcpy((float*)forUnmarshaling->pCoverageModulationTable, *ptr, forUnmarshaling->coverageModulationTableCount * sizeof(const float));
+            *ptr += forUnmarshaling->coverageModulationTableCount * sizeof(const float);
+        }
     }
 }
 
@@ -13173,9 +13525,17 @@ void reservedunmarshal_VkPhysicalDeviceImageDrmFormatModifierInfoEXT(
     *ptr += 8;
     if (forUnmarshaling->pQueueFamilyIndices)
     {
-        vkStream->alloc((void**)&forUnmarshaling->pQueueFamilyIndices, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
-        memcpy((uint32_t*)forUnmarshaling->pQueueFamilyIndices, *ptr, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
-        *ptr += forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t);
+        if (forUnmarshaling->queueFamilyIndexCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+        {
+            forUnmarshaling->pQueueFamilyIndices = (uint32_t*)(*ptr);
+            *ptr += forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t);
+        }
+        else
+        {
+            vkStream->alloc((void**)&forUnmarshaling->pQueueFamilyIndices, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
+            memcpy((uint32_t*)forUnmarshaling->pQueueFamilyIndices, *ptr, forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t));
+            *ptr += forUnmarshaling->queueFamilyIndexCount * sizeof(const uint32_t);
+        }
     }
 }
 
@@ -13203,9 +13563,17 @@ void reservedunmarshal_VkImageDrmFormatModifierListCreateInfoEXT(
     }
     memcpy((uint32_t*)&forUnmarshaling->drmFormatModifierCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pDrmFormatModifiers, forUnmarshaling->drmFormatModifierCount * sizeof(const uint64_t));
-    memcpy((uint64_t*)forUnmarshaling->pDrmFormatModifiers, *ptr, forUnmarshaling->drmFormatModifierCount * sizeof(const uint64_t));
-    *ptr += forUnmarshaling->drmFormatModifierCount * sizeof(const uint64_t);
+    if (forUnmarshaling->drmFormatModifierCount && ((uintptr_t)(*ptr) & (alignof(const uint64_t) - 1)) == 0)
+    {
+        forUnmarshaling->pDrmFormatModifiers = (uint64_t*)(*ptr);
+        *ptr += forUnmarshaling->drmFormatModifierCount * sizeof(const uint64_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pDrmFormatModifiers, forUnmarshaling->drmFormatModifierCount * sizeof(const uint64_t));
+        memcpy((uint64_t*)forUnmarshaling->pDrmFormatModifiers, *ptr, forUnmarshaling->drmFormatModifierCount * sizeof(const uint64_t));
+        *ptr += forUnmarshaling->drmFormatModifierCount * sizeof(const uint64_t);
+    }
 }
 
 void reservedunmarshal_VkImageDrmFormatModifierExplicitCreateInfoEXT(
@@ -13296,9 +13664,17 @@ void reservedunmarshal_VkValidationCacheCreateInfoEXT(
     memcpy((size_t*)&forUnmarshaling->initialDataSize, (*ptr), 8);
     android::base::Stream::fromBe64((uint8_t*)&forUnmarshaling->initialDataSize);
     *ptr += 8;
-    vkStream->alloc((void**)&forUnmarshaling->pInitialData, forUnmarshaling->initialDataSize * sizeof(const uint8_t));
-    memcpy((void*)forUnmarshaling->pInitialData, *ptr, forUnmarshaling->initialDataSize * sizeof(const uint8_t));
-    *ptr += forUnmarshaling->initialDataSize * sizeof(const uint8_t);
+    if (forUnmarshaling->initialDataSize && ((uintptr_t)(*ptr) & (alignof(const uint8_t) - 1)) == 0)
+    {
+        forUnmarshaling->pInitialData = (void*)(*ptr);
+        *ptr += forUnmarshaling->initialDataSize * sizeof(const uint8_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pInitialData, forUnmarshaling->initialDataSize * sizeof(const uint8_t));
+        memcpy((void*)forUnmarshaling->pInitialData, *ptr, forUnmarshaling->initialDataSize * sizeof(const uint8_t));
+        *ptr += forUnmarshaling->initialDataSize * sizeof(const uint8_t);
+    }
 }
 
 void reservedunmarshal_VkShaderModuleValidationCacheCreateInfoEXT(
@@ -13342,9 +13718,17 @@ void reservedunmarshal_VkShadingRatePaletteNV(
 {
     memcpy((uint32_t*)&forUnmarshaling->shadingRatePaletteEntryCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pShadingRatePaletteEntries, forUnmarshaling->shadingRatePaletteEntryCount * sizeof(const VkShadingRatePaletteEntryNV));
-    memcpy((VkShadingRatePaletteEntryNV*)forUnmarshaling->pShadingRatePaletteEntries, *ptr, forUnmarshaling->shadingRatePaletteEntryCount * sizeof(const VkShadingRatePaletteEntryNV));
-    *ptr += forUnmarshaling->shadingRatePaletteEntryCount * sizeof(const VkShadingRatePaletteEntryNV);
+    if (forUnmarshaling->shadingRatePaletteEntryCount && ((uintptr_t)(*ptr) & (alignof(const VkShadingRatePaletteEntryNV) - 1)) == 0)
+    {
+        forUnmarshaling->pShadingRatePaletteEntries = (VkShadingRatePaletteEntryNV*)(*ptr);
+        *ptr += forUnmarshaling->shadingRatePaletteEntryCount * sizeof(const VkShadingRatePaletteEntryNV);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pShadingRatePaletteEntries, forUnmarshaling->shadingRatePaletteEntryCount * sizeof(const VkShadingRatePaletteEntryNV));
+        memcpy((VkShadingRatePaletteEntryNV*)forUnmarshaling->pShadingRatePaletteEntries, *ptr, forUnmarshaling->shadingRatePaletteEntryCount * sizeof(const VkShadingRatePaletteEntryNV));
+        *ptr += forUnmarshaling->shadingRatePaletteEntryCount * sizeof(const VkShadingRatePaletteEntryNV);
+    }
 }
 
 void reservedunmarshal_VkPipelineViewportShadingRateImageStateCreateInfoNV(
@@ -13818,9 +14202,17 @@ void reservedunmarshal_VkBindAccelerationStructureMemoryInfoNV(
     *ptr += sizeof(VkDeviceSize);
     memcpy((uint32_t*)&forUnmarshaling->deviceIndexCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pDeviceIndices, forUnmarshaling->deviceIndexCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pDeviceIndices, *ptr, forUnmarshaling->deviceIndexCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->deviceIndexCount * sizeof(const uint32_t);
+    if (forUnmarshaling->deviceIndexCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pDeviceIndices = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->deviceIndexCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pDeviceIndices, forUnmarshaling->deviceIndexCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pDeviceIndices, *ptr, forUnmarshaling->deviceIndexCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->deviceIndexCount * sizeof(const uint32_t);
+    }
 }
 
 void reservedunmarshal_VkWriteDescriptorSetAccelerationStructureNV(
@@ -15719,14 +16111,30 @@ void reservedunmarshal_VkValidationFeaturesEXT(
     }
     memcpy((uint32_t*)&forUnmarshaling->enabledValidationFeatureCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pEnabledValidationFeatures, forUnmarshaling->enabledValidationFeatureCount * sizeof(const VkValidationFeatureEnableEXT));
-    memcpy((VkValidationFeatureEnableEXT*)forUnmarshaling->pEnabledValidationFeatures, *ptr, forUnmarshaling->enabledValidationFeatureCount * sizeof(const VkValidationFeatureEnableEXT));
-    *ptr += forUnmarshaling->enabledValidationFeatureCount * sizeof(const VkValidationFeatureEnableEXT);
+    if (forUnmarshaling->enabledValidationFeatureCount && ((uintptr_t)(*ptr) & (alignof(const VkValidationFeatureEnableEXT) - 1)) == 0)
+    {
+        forUnmarshaling->pEnabledValidationFeatures = (VkValidationFeatureEnableEXT*)(*ptr);
+        *ptr += forUnmarshaling->enabledValidationFeatureCount * sizeof(const VkValidationFeatureEnableEXT);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pEnabledValidationFeatures, forUnmarshaling->enabledValidationFeatureCount * sizeof(const VkValidationFeatureEnableEXT));
+        memcpy((VkValidationFeatureEnableEXT*)forUnmarshaling->pEnabledValidationFeatures, *ptr, forUnmarshaling->enabledValidationFeatureCount * sizeof(const VkValidationFeatureEnableEXT));
+        *ptr += forUnmarshaling->enabledValidationFeatureCount * sizeof(const VkValidationFeatureEnableEXT);
+    }
     memcpy((uint32_t*)&forUnmarshaling->disabledValidationFeatureCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pDisabledValidationFeatures, forUnmarshaling->disabledValidationFeatureCount * sizeof(const VkValidationFeatureDisableEXT));
-    memcpy((VkValidationFeatureDisableEXT*)forUnmarshaling->pDisabledValidationFeatures, *ptr, forUnmarshaling->disabledValidationFeatureCount * sizeof(const VkValidationFeatureDisableEXT));
-    *ptr += forUnmarshaling->disabledValidationFeatureCount * sizeof(const VkValidationFeatureDisableEXT);
+    if (forUnmarshaling->disabledValidationFeatureCount && ((uintptr_t)(*ptr) & (alignof(const VkValidationFeatureDisableEXT) - 1)) == 0)
+    {
+        forUnmarshaling->pDisabledValidationFeatures = (VkValidationFeatureDisableEXT*)(*ptr);
+        *ptr += forUnmarshaling->disabledValidationFeatureCount * sizeof(const VkValidationFeatureDisableEXT);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pDisabledValidationFeatures, forUnmarshaling->disabledValidationFeatureCount * sizeof(const VkValidationFeatureDisableEXT));
+        memcpy((VkValidationFeatureDisableEXT*)forUnmarshaling->pDisabledValidationFeatures, *ptr, forUnmarshaling->disabledValidationFeatureCount * sizeof(const VkValidationFeatureDisableEXT));
+        *ptr += forUnmarshaling->disabledValidationFeatureCount * sizeof(const VkValidationFeatureDisableEXT);
+    }
 }
 
 #endif
@@ -16582,12 +16990,28 @@ void reservedunmarshal_VkIndirectCommandsLayoutTokenNV(
     *ptr += sizeof(VkIndirectStateFlagsNV);
     memcpy((uint32_t*)&forUnmarshaling->indexTypeCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pIndexTypes, forUnmarshaling->indexTypeCount * sizeof(const VkIndexType));
-    memcpy((VkIndexType*)forUnmarshaling->pIndexTypes, *ptr, forUnmarshaling->indexTypeCount * sizeof(const VkIndexType));
-    *ptr += forUnmarshaling->indexTypeCount * sizeof(const VkIndexType);
-    vkStream->alloc((void**)&forUnmarshaling->pIndexTypeValues, forUnmarshaling->indexTypeCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pIndexTypeValues, *ptr, forUnmarshaling->indexTypeCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->indexTypeCount * sizeof(const uint32_t);
+    if (forUnmarshaling->indexTypeCount && ((uintptr_t)(*ptr) & (alignof(const VkIndexType) - 1)) == 0)
+    {
+        forUnmarshaling->pIndexTypes = (VkIndexType*)(*ptr);
+        *ptr += forUnmarshaling->indexTypeCount * sizeof(const VkIndexType);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pIndexTypes, forUnmarshaling->indexTypeCount * sizeof(const VkIndexType));
+        memcpy((VkIndexType*)forUnmarshaling->pIndexTypes, *ptr, forUnmarshaling->indexTypeCount * sizeof(const VkIndexType));
+        *ptr += forUnmarshaling->indexTypeCount * sizeof(const VkIndexType);
+    }
+    if (forUnmarshaling->indexTypeCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pIndexTypeValues = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->indexTypeCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pIndexTypeValues, forUnmarshaling->indexTypeCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pIndexTypeValues, *ptr, forUnmarshaling->indexTypeCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->indexTypeCount * sizeof(const uint32_t);
+    }
 }
 
 void reservedunmarshal_VkIndirectCommandsLayoutCreateInfoNV(
@@ -16625,9 +17049,17 @@ void reservedunmarshal_VkIndirectCommandsLayoutCreateInfoNV(
     }
     memcpy((uint32_t*)&forUnmarshaling->streamCount, *ptr, sizeof(uint32_t));
     *ptr += sizeof(uint32_t);
-    vkStream->alloc((void**)&forUnmarshaling->pStreamStrides, forUnmarshaling->streamCount * sizeof(const uint32_t));
-    memcpy((uint32_t*)forUnmarshaling->pStreamStrides, *ptr, forUnmarshaling->streamCount * sizeof(const uint32_t));
-    *ptr += forUnmarshaling->streamCount * sizeof(const uint32_t);
+    if (forUnmarshaling->streamCount && ((uintptr_t)(*ptr) & (alignof(const uint32_t) - 1)) == 0)
+    {
+        forUnmarshaling->pStreamStrides = (uint32_t*)(*ptr);
+        *ptr += forUnmarshaling->streamCount * sizeof(const uint32_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pStreamStrides, forUnmarshaling->streamCount * sizeof(const uint32_t));
+        memcpy((uint32_t*)forUnmarshaling->pStreamStrides, *ptr, forUnmarshaling->streamCount * sizeof(const uint32_t));
+        *ptr += forUnmarshaling->streamCount * sizeof(const uint32_t);
+    }
 }
 
 void reservedunmarshal_VkGeneratedCommandsInfoNV(
@@ -17958,9 +18390,17 @@ void reservedunmarshal_VkAccelerationStructureVersionInfoKHR(
         *(VkStructureType*)forUnmarshaling->pNext = extType;
         reservedunmarshal_extension_struct(vkStream, (void*)(forUnmarshaling->pNext), ptr);
     }
-    vkStream->alloc((void**)&forUnmarshaling->pVersionData, 2*VK_UUID_SIZE * sizeof(const uint8_t));
-    memcpy((uint8_t*)forUnmarshaling->pVersionData, *ptr, 2*VK_UUID_SIZE * sizeof(const uint8_t));
-    *ptr += 2*VK_UUID_SIZE * sizeof(const uint8_t);
+    if (2*VK_UUID_SIZE && ((uintptr_t)(*ptr) & (alignof(const uint8_t) - 1)) == 0)
+    {
+        forUnmarshaling->pVersionData = (uint8_t*)(*ptr);
+        *ptr += 2*VK_UUID_SIZE * sizeof(const uint8_t);
+    }
+    else
+    {
+        vkStream->alloc((void**)&forUnmarshaling->pVersionData, 2*VK_UUID_SIZE * sizeof(const uint8_t));
+        memcpy((uint8_t*)forUnmarshaling->pVersionData, *ptr, 2*VK_UUID_SIZE * sizeof(const uint8_t));
+        *ptr += 2*VK_UUID_SIZE * sizeof(const uint8_t);
+    }
 }
 
 void reservedunmarshal_VkCopyAccelerationStructureToMemoryInfoKHR(
@@ -20,10 +20,13 @@
 #endif
 
 #include <grpcpp/grpcpp.h>
+#include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <functional>
 #include <iostream>
@@ -47,10 +50,13 @@
 #include "android/base/Stopwatch.h"
 #include "android/base/Tracing.h"
 #include "android/base/async/ThreadLooper.h"
+#include "android/base/files/PathUtils.h"
 #include "android/base/memory/SharedMemory.h"
 #include "android/base/synchronization/MessageChannel.h"
 #include "android/base/system/System.h"
 #include "android/console.h"
+#include "android/emulation/ConfigDirs.h"
+#include "android/emulation/FilePushPipe.h"
 #include "android/emulation/LogcatPipe.h"
 #include "android/emulation/MultiDisplay.h"
 #include "android/emulation/control/RtcBridge.h"
@@ -65,16 +71,18 @@
 #include "android/emulation/control/keyboard/EmulatorKeyEventSender.h"
 #include "android/emulation/control/keyboard/TouchEventSender.h"
 #include "android/emulation/control/location_agent.h"
-#include "android/emulation/control/logcat/LogcatParser.h"
+#include "android/emulation/control/logcat/LogcatStore.h"
 #include "android/emulation/control/logcat/RingStreambuf.h"
 #include "android/emulation/control/multi_display_agent.h"
 #include "android/emulation/control/sensors_agent.h"
 #include "android/emulation/control/telephony_agent.h"
 #include "android/emulation/control/user_event_agent.h"
+#include "android/emulation/control/utils/AudioRing.h"
 #include "android/emulation/control/utils/AudioUtils.h"
 #include "android/emulation/control/utils/EventWaiter.h"
 #include "android/emulation/control/utils/ScreenshotUtils.h"
 #include "android/emulation/control/utils/SharedMemoryLibrary.h"
+#include "android/emulation/control/utils/TileDiff.h"
 #include "android/emulation/control/vm_operations.h"
 #include "android/emulation/control/window_agent.h"
 #include "android/featurecontrol/FeatureControl.h"
@@ -122,12 +130,45 @@ namespace android {
 namespace emulation {
 namespace control {
 
+// A gRPC client may be someone other than the user, so it can only push the
+// files that the user put in this directory, and not every file the emulator
+// can read.
+static std::string filePushDirectory() {
+    return pj(ConfigDirs::getUserDirectory(), "filepush");
+}
+
+// Returns the real path of |path| if it is a file in filePushDirectory().
+static Optional<std::string> allowedFilePushPath(const std::string& path) {
+#ifdef _WIN32
+    char dir[_MAX_PATH];
+    char file[_MAX_PATH];
+    if (!_fullpath(dir, filePushDirectory().c_str(), sizeof(dir)) ||
+        !_fullpath(file, path.c_str(), sizeof(file))) {
+        return {};
+    }
+#else
+    char dir[PATH_MAX];
+    char file[PATH_MAX];
+    // Resolves symlinks, so that one cannot point out of the directory.
+    if (!realpath(filePushDirectory().c_str(), dir) ||
+        !realpath(path.c_str(), file)) {
+        return {};
+    }
+#endif
+    auto prefix = PathUtils::addTrailingDirSeparator(dir);
+    if (strncmp(file, prefix.c_str(), prefix.size()) != 0) {
+        return {};
+    }
+    return std::string(file);
+}
+
 // Logic and data behind the server's behavior.
 class EmulatorControllerImpl final : public EmulatorController::Service {
 public:
     EmulatorControllerImpl(const AndroidConsoleAgents* agents)
         : mAgents(agents),
           mLogcatBuffer(k128KB),
+          mLogcatStore(kLogcatEntries),
           mKeyEventSender(agents),
           mTouchEventSender(agents),
           mCamera(agents->sensors),
@@ -136,20 +177,18 @@ public:
         // the logcat pipe will take ownership of the created stream, and writes
         // to our buffer.
         LogcatPipe::registerStream(new std::ostream(&mLogcatBuffer));
+        LogcatPipe::registerStream(new std::ostream(&mLogcatStore));
     }
 
     Status getLogcat(ServerContext* context,
                      const LogMessage* request,
                      LogMessage* reply) override {
-        auto message = mLogcatBuffer.bufferAtOffset(request->start(), kNoWait);
         if (request->sort() == LogMessage::Parsed) {
-            auto parsed = LogcatParser::parseLines(message.second);
-            reply->set_start(message.first);
-            for (auto entry : parsed.second) {
-                *reply->add_entries() = entry;
-            }
-            reply->set_next(message.first + parsed.first);
+            mLogcatStore.query(request->start(), request->filter(), kNoWait,
+                               reply);
         } else {
+            auto message =
+                    mLogcatBuffer.bufferAtOffset(request->start(), kNoWait);
             reply->set_start(message.first);
             reply->set_contents(message.second);
             reply->set_next(message.first + message.second.size());
@@ -166,17 +205,25 @@ public:
             // When streaming, block at most 5 seconds before sending any status
             // This also makes sure we check that the clients is still around at
             // least once every 5 seconds.
-            auto message =
-                    mLogcatBuffer.bufferAtOffset(log.next(), k5SecondsWait);
             if (request->sort() == LogMessage::Parsed) {
-                auto parsed = LogcatParser::parseLines(message.second);
-                log.clear_entries();
-                log.set_start(message.first);
-                for (auto entry : parsed.second) {
-                    *log.add_entries() = entry;
+                // Only entries that match the filter go over the wire. The
+                // store wakes us up for every new line, so keep waiting until
+                // one matches rather than sending an empty message for each.
+                const auto deadlineUs =
+                        System::get()->getUnixTimeUs() + k5SecondsWait * 1000;
+                System::Duration waitMs = k5SecondsWait;
+                while (mLogcatStore.query(log.next(), request->filter(), waitMs,
+                                          &log) == 0 &&
+                       !context->IsCancelled()) {
+                    const auto nowUs = System::get()->getUnixTimeUs();
+                    if (nowUs >= deadlineUs) {
+                        break;
+                    }
+                    waitMs = (deadlineUs - nowUs + 999) / 1000;
                 }
-                log.set_next(message.first + parsed.first);
             } else {
+                auto message =
+                        mLogcatBuffer.bufferAtOffset(log.next(), k5SecondsWait);
                 log.set_start(message.first);
                 log.set_contents(message.second);
                 log.set_next(message.first + message.second.size());
@@ -185,6 +232,46 @@ public:
         return Status::OK;
     }
 
+    Status pushFile(ServerContext* context,
+                    const FilePush* request,
+                    ::google::protobuf::Empty* reply) override {
+        if (!FilePushPipe::isConnected()) {
+            return Status(::grpc::StatusCode::FAILED_PRECONDITION,
+                          "No guest daemon is listening on the filepush pipe",
+                          "");
+        }
+
+        auto hostPath = allowedFilePushPath(request->hostpath());
+        if (!hostPath) {
+            return Status(::grpc::StatusCode::PERMISSION_DENIED,
+                          "Only files in " + filePushDirectory() +
+                                  " can be pushed: " + request->hostpath(),
+                          "");
+        }
+
+        // The push can complete after the client has gone away, so the
+        // callback owns the channel.
+        auto result = std::make_shared<MessageChannel<bool, 1>>();
+        if (!FilePushPipe::pushFile(
+                    *hostPath, request->guestpath(),
+                    [result](bool success) { result->send(success); })) {
+            return Status(::grpc::StatusCode::NOT_FOUND,
+                          "Unable to push: " + request->hostpath(), "");
+        }
+
+        Optional<bool> success;
+        while (!success && !context->IsCancelled()) {
+            success = result->timedReceive(System::get()->getUnixTimeUs() +
+                                           k5SecondsWait * 1000);
+        }
+        if (!success || !*success) {
+            return Status(::grpc::StatusCode::INTERNAL,
+                          "The guest failed to store: " + request->guestpath(),
+                          "");
+        }
+        return Status::OK;
+    }
+
     Status setBattery(ServerContext* context,
                       const BatteryState* requestPtr,
                       ::google::protobuf::Empty* reply) override {
@@ -472,44 +559,82 @@ public:
         format->set_format(request->format());
         format->set_samplingrate(sampleRate);
 
-        constexpr int kMaxAudioFrames = 50;
-        using TimedAudioFrame = std::pair<System::Duration, std::string>;
-        android::base::MessageChannel<TimedAudioFrame, kMaxAudioFrames>
-                audioFrames;
+        const int frameSize = kSrcNumSamples * channels *
+                              android::recording::getAudioFormatSize(
+                                      sampleFormat);
+        const double bytesPerUs = sampleRate * channels *
+                                  android::recording::getAudioFormatSize(
+                                          sampleFormat) /
+                                  1000000.0;
+
+        // The ring holds a bit more than a second of audio, that is 88
+        // frames at 44.1kHz. We batch up to 4 frames in a single packet if
+        // the client is falling behind.
+        const int maxAudioFrames = sampleRate / kSrcNumSamples + 2;
+        constexpr int kMaxFramesPerPacket = 4;
+        AudioRing audioFrames(maxAudioFrames * (frameSize + 16));
         auto audioProducer = android::recording::createAudioProducer(
                 sampleRate, kSrcNumSamples, sampleFormat, channels);
 
         // Callback that is responsible for copying the incoming packets
-        // into the audioframe channel.
+        // into the audio ring, this will never block the producer.
         audioProducer->attachCallback(
-                [&audioFrames,
-                 &packet](const android::recording::Frame* frame) {
-                    auto audioFrame =
-                            std::make_pair<System::Duration, std::string>(
-                                    System::get()->getUnixTimeUs(),
-                                    std::string((char*)frame->dataVec.data(),
-                                                frame->dataVec.size()));
-                    return audioFrames.trySend(std::move(audioFrame));
+                [&audioFrames](const android::recording::Frame* frame) {
+                    return audioFrames.write(System::get()->getUnixTimeUs(),
+                                             frame->dataVec.data(),
+                                             frame->dataVec.size());
                 });
 
         audioProducer->start();
 
+        // Track the delay between capturing a frame and handing it to gRPC,
+        // and how much the arrival of packets deviates from the audio
+        // duration of the previous packet.
+        metrics::Percentiles latencyUs(32, {0.5, 0.95});
+        metrics::Percentiles jitterUs(32, {0.5, 0.95});
+        uint64_t lastTimestampUs = 0;
+        double lastDurationUs = 0;
+        uint64_t packets = 0;
+
         // Write out the incoming audio packets.
         constexpr std::chrono::microseconds kTimeToWaitForAudioFrame =
                 std::chrono::milliseconds(125);
         bool clientAlive = true;
         do {
-            auto audioFrame =
-                    audioFrames.timedReceive(kTimeToWaitForAudioFrame.count());
-            if (audioFrame) {
-                packet.set_timestamp(audioFrame->first);
-                packet.set_audio(std::move(audioFrame->second));
+            uint64_t timestampUs = 0;
+            auto audio = packet.mutable_audio();
+            audio->clear();
+            if (audioFrames.read(audio, &timestampUs,
+                                 kMaxFramesPerPacket * frameSize,
+                                 kTimeToWaitForAudioFrame.count()) > 0) {
+                packet.set_timestamp(timestampUs);
                 clientAlive = writer->Write(packet);
+
+                latencyUs.addSample(System::get()->getUnixTimeUs() -
+                                    timestampUs);
+                if (lastTimestampUs != 0) {
+                    jitterUs.addSample(
+                            std::abs((double)timestampUs -
+                                     (double)lastTimestampUs - lastDurationUs));
+                }
+                lastTimestampUs = timestampUs;
+                lastDurationUs = audio->size() / bytesPerUs;
+                packets++;
             }
             clientAlive = clientAlive && !context->IsCancelled();
         } while (clientAlive);
 
         audioProducer->stop();
+        LOG(VERBOSE) << "Delivered " << audioFrames.written()
+                     << " audio frames in " << packets << " packets, dropped "
+                     << audioFrames.dropped() << " frames. Latency (us) p50: "
+                     << latencyUs.calcValueForTargetNo(0).valueOr(0)
+                     << ", p95: "
+                     << latencyUs.calcValueForTargetNo(1).valueOr(0)
+                     << ". Jitter (us) p50: "
+                     << jitterUs.calcValueForTargetNo(0).valueOr(0)
+                     << ", p95: "
+                     << jitterUs.calcValueForTargetNo(1).valueOr(0);
         return Status::OK;
     }
 
@@ -524,6 +649,33 @@ public:
                             ScreenshotUtils::getBytesPerPixel(*request));
         }
 
+        // Clients that request tiles only receive the regions of the screen
+        // that changed since the last frame we delivered.
+        std::unique_ptr<TileDiff> tileDiff;
+        Image tiles;
+        // A tile never needs to be larger than the requested image.
+        uint32_t maxTileSize = TileDiff::kMaxTileSize;
+        if (request->width() > 0 || request->height() > 0) {
+            maxTileSize = std::min(
+                    maxTileSize,
+                    std::max({TileDiff::kMinTileSize, request->width(),
+                              request->height()}));
+        }
+        if (request->tilesize() > 0 &&
+            (request->tilesize() < TileDiff::kMinTileSize ||
+             request->tilesize() > maxTileSize)) {
+            return Status(::grpc::StatusCode::INVALID_ARGUMENT,
+                          "tileSize must be between " +
+                                  std::to_string(TileDiff::kMinTileSize) +
+                                  " and " + std::to_string(maxTileSize),
+                          "");
+        }
+        if (request->tilesize() > 0 &&
+            request->format() != ImageFormat::PNG &&
+            request->transport().channel() != ImageTransport::MMAP) {
+            tileDiff = std::make_unique<TileDiff>(request->tilesize());
+        }
+
         // Make sure we always write the first frame, this can be
         // a completely empty frame if the screen is not active.
         Image reply;
@@ -538,7 +690,11 @@ public:
             getScreenshot(context, request, &reply);
             assert(reply.image().size() >= cPixels);
             cPixels = reply.image().size();
-            clientAvailable = !context->IsCancelled() && writer->Write(reply);
+            if (tileDiff) {
+                fillChangedTiles(reply, tileDiff.get(), &tiles);
+            }
+            clientAvailable = !context->IsCancelled() &&
+                              writer->Write(tileDiff ? tiles : reply);
         }
 
         bool lastFrameWasEmpty = reply.format().width() == 0;
@@ -596,9 +752,14 @@ public:
                 // is empty frame. F is frame) [0, ... <nothing> ..., F1, F2,
                 // F3, 0, ...<nothing>... ]
                 bool emptyFrame = reply.format().width() == 0;
-                if (!context->IsCancelled() &&
+                bool unchanged = false;
+                if (tileDiff) {
+                    fillChangedTiles(reply, tileDiff.get(), &tiles);
+                    unchanged = !emptyFrame && tiles.tiles_size() == 0;
+                }
+                if (!context->IsCancelled() && !unchanged &&
                     (!lastFrameWasEmpty || !emptyFrame)) {
-                    clientAvailable = writer->Write(reply);
+                    clientAvailable = writer->Write(tileDiff ? tiles : reply);
                     perfEstimator.addSample(sw.elapsedUs());
                 }
                 lastFrameWasEmpty = emptyFrame;
@@ -1189,6 +1350,46 @@ public:
     }
 
 private:
+    // Fills |tiles| with the regions of |image| that changed since the
+    // previous image handed to |diff|. The pixels of |image| are expected
+    // to be in the RGB888 or RGBA8888 format.
+    static void fillChangedTiles(const Image& image,
+                                 TileDiff* diff,
+                                 Image* tiles) {
+        const uint32_t width = image.format().width();
+        const uint32_t height = image.format().height();
+        const uint32_t bpp = ScreenshotUtils::getBytesPerPixel(image.format());
+        const size_t stride = static_cast<size_t>(width) * bpp;
+
+        tiles->clear_tiles();
+        *tiles->mutable_format() = image.format();
+        tiles->mutable_format()->set_tilesize(diff->tileSize());
+        tiles->set_seq(image.seq());
+        tiles->set_timestampus(image.timestampus());
+        if (width == 0 || height == 0 ||
+            image.image().size() < stride * height) {
+            diff->reset();
+            return;
+        }
+
+        auto pixels = reinterpret_cast<const uint8_t*>(image.image().data());
+        for (const auto& rect : diff->update(pixels, width, height, bpp)) {
+            auto tile = tiles->add_tiles();
+            tile->set_x(rect.x);
+            tile->set_y(rect.y);
+            tile->set_width(rect.width);
+            tile->set_height(rect.height);
+
+            const size_t len = static_cast<size_t>(rect.width) * bpp;
+            auto buffer = tile->mutable_image();
+            buffer->resize(len * rect.height);
+            for (uint32_t row = 0; row < rect.height; row++) {
+                memcpy(&(*buffer)[row * len],
+                       pixels + (rect.y + row) * stride + rect.x * bpp, len);
+            }
+        }
+    }
+
     const AndroidConsoleAgents* mAgents;
     keyboard::EmulatorKeyEventSender mKeyEventSender;
     TouchEventSender mTouchEventSender;
@@ -1200,8 +1401,10 @@ private:
     Looper* mLooper;
     RingStreambuf
             mLogcatBuffer;  // A ring buffer that tracks the logcat output.
+    LogcatStore mLogcatStore;  // The parsed and indexed logcat entries.
 
     static constexpr uint32_t k128KB = (128 * 1024) - 1;
+    static constexpr uint32_t kLogcatEntries = 16 * 1024;
     static constexpr uint16_t k5SecondsWait = 5 * 1000;
     const uint16_t kNoWait = 0;
 };
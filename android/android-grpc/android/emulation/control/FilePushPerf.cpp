@@ -0,0 +1,114 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the throughput of the filepush pipe, as seen by a guest daemon
+// that reads the file in chunks of the given size. A chunk of 4K is about the
+// payload of a single adb packet.
+
+#include <errno.h>    // for EAGAIN
+#include <algorithm>  // for min
+#include <fstream>    // for ofstream
+#include <iostream>   // for operator<<
+#include <string>     // for string
+#include <vector>     // for vector
+
+#include "android/base/files/PathUtils.h"                    // for pj
+#include "android/base/system/System.h"                      // for System
+#include "android/base/testing/TestLooper.h"                 // for TestLooper
+#include "android/emulation/FilePushPipe.h"                  // for FilePush...
+#include "android/emulation/hostdevices/HostGoldfishPipe.h"  // for HostGold...
+#include "android/emulation/testing/TestVmLock.h"            // for TestVmLock
+#include "android/filepush-pipe.h"                           // for android_...
+#include "android/utils/Random.h"                            // for generate...
+#include "benchmark/benchmark_api.h"                         // for State
+
+#define BASIC_BENCHMARK_TEST(x) \
+    BENCHMARK(x)->RangeMultiplier(4)->Range(1 << 12, 1 << 20)
+
+using android::AndroidPipe;
+using android::HostGoldfishPipeDevice;
+using android::TestVmLock;
+using android::base::System;
+using android::emulation::FilePushPipe;
+
+static constexpr int kFileSize = 64 * 1024 * 1024;
+
+static std::string testFile() {
+    auto tmpdir = System::get()->getTempDir();
+    auto tstfile = android::base::pj(tmpdir, "filepush.bin");
+
+    if (!System::get()->pathExists(tstfile)) {
+        std::cout << "Test file in: " << tstfile << std::endl;
+
+        std::ofstream rnd(tstfile, std::ios::binary);
+        char sz[4096];
+        for (int i = 0; i < kFileSize / sizeof(sz); i++) {
+            android::generateRandomBytes(sz, sizeof(sz));
+            rnd.write(sz, sizeof(sz));
+        }
+    }
+    return tstfile;
+}
+
+// Reads like a guest daemon blocked in read() would, retrying until the
+// reader thread of the pipe caught up.
+static ssize_t readFromGuest(HostGoldfishPipeDevice* device,
+                             int fd,
+                             void* buffer,
+                             size_t len) {
+    for (;;) {
+        auto read = device->read(fd, buffer, len);
+        if (read >= 0 || device->getErrno() != EAGAIN) {
+            return read;
+        }
+    }
+}
+
+void BM_FilePushPipe(benchmark::State& state) {
+    auto file = testFile();
+    android::base::TestLooper looper;
+    AndroidPipe::Service::resetAll();
+    AndroidPipe::initThreadingForTest(TestVmLock::getInstance(), &looper);
+    android_init_filepush_pipe();
+
+    auto device = HostGoldfishPipeDevice::get();
+    auto fd = device->connect("filepush");
+    std::vector<char> chunk(state.range_x());
+
+    while (state.KeepRunning()) {
+        FilePushPipe::pushFile(file, "/data/local/tmp/filepush.bin", nullptr);
+        FilePushPipe::Header header;
+        readFromGuest(device, fd, &header, sizeof(header));
+        readFromGuest(device, fd, chunk.data(), header.pathLength);
+        uint64_t remaining = header.size;
+        while (remaining > 0) {
+            auto read = readFromGuest(
+                    device, fd, chunk.data(),
+                    std::min<uint64_t>(remaining, chunk.size()));
+            if (read <= 0) {
+                break;
+            }
+            remaining -= read;
+        }
+        uint32_t status = 0;
+        device->write(fd, &status, sizeof(status));
+    }
+    state.SetBytesProcessed(state.iterations() * kFileSize);
+
+    device->close(fd);
+    AndroidPipe::Service::resetAll();
+    AndroidPipe::initThreading(TestVmLock::getInstance());
+}
+
+BASIC_BENCHMARK_TEST(BM_FilePushPipe);
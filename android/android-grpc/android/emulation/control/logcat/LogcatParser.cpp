@@ -69,8 +69,9 @@ static uint64_t parseTimeToEpochMs(std::string timestr) {
     return time;
 }
 
-std::pair<int, std::vector<LogcatEntry>> LogcatParser::parseLines(
-        const std::string lines) {
+bool LogcatParser::parseLine(std::string::const_iterator begin,
+                             std::string::const_iterator end,
+                             LogcatEntry* entry) {
     static const std::regex logline(
             // timestamp[1]
             "^(\\d{2}-\\d{2} \\d{2}:\\d{2}:\\d{2}.\\d{3})"
@@ -79,21 +80,29 @@ std::pair<int, std::vector<LogcatEntry>> LogcatParser::parseLines(
             // tag and message [5-6]
             "(.+?)\\s*: (.*)$");
 
+    std::smatch m;
+    if (!std::regex_match(begin, end, m, logline)) {
+        return false;
+    }
+    entry->set_timestamp(parseTimeToEpochMs(m[1]));
+    entry->set_pid(std::stoi(m[2]));
+    entry->set_tid(std::stoi(m[3]));
+    entry->set_level(parseLevel(m[4]));
+    entry->set_tag(m[5]);
+    entry->set_msg(m[6]);
+    return true;
+}
+
+std::pair<int, std::vector<LogcatEntry>> LogcatParser::parseLines(
+        const std::string lines) {
     int skip = 0;
     auto start = lines.begin();
     auto end = lines.begin();
     std::vector<LogcatEntry> result;
     while (end != lines.end()) {
         if (*end == '\n') {
-            std::smatch m;
-            if (std::regex_match(start, end, m, logline)) {
-                LogcatEntry entry;
-                entry.set_timestamp(parseTimeToEpochMs(m[1]));
-                entry.set_pid(std::stoi(m[2]));
-                entry.set_tid(std::stoi(m[3]));
-                entry.set_level(parseLevel(m[4]));
-                entry.set_tag(m[5]);
-                entry.set_msg(m[6]);
+            LogcatEntry entry;
+            if (parseLine(start, end, &entry)) {
                 result.push_back(entry);
             }
             start = ++end;
@@ -24,6 +24,12 @@ class LogcatParser {
 public:
     static std::pair<int, std::vector<LogcatEntry>> parseLines(
             const std::string lines);
+
+    // Parses the single logcat line [begin, end), without the trailing
+    // newline, into |entry|. Returns false if this is not a logcat line.
+    static bool parseLine(std::string::const_iterator begin,
+                          std::string::const_iterator end,
+                          LogcatEntry* entry);
 };
 
 }  // namespace control
@@ -0,0 +1,345 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "android/emulation/control/logcat/LogcatStore.h"
+
+#include <algorithm>  // for lower_bound, max, min, sort, find
+
+#include "android/emulation/control/logcat/LogcatParser.h"  // for LogcatP...
+
+namespace android {
+namespace emulation {
+namespace control {
+
+using namespace base;
+
+// Lines longer than this are not logcat lines, and are dropped.
+static constexpr size_t kMaxLineLength = 64 * 1024;
+
+using SeqList = std::deque<uint64_t>;
+
+LogcatStore::LogcatStore(uint32_t capacity)
+    : mCapacity(std::max<uint32_t>(capacity, 1)),
+      mOffset(mCapacity),
+      mEnd(mCapacity),
+      mTimestamp(mCapacity),
+      mMaxTimestamp(mCapacity),
+      mPid(mCapacity),
+      mTid(mCapacity),
+      mLevel(mCapacity),
+      mTagId(mCapacity),
+      mMsg(mCapacity) {}
+
+std::streamsize LogcatStore::xsputn(const char* s, std::streamsize n) {
+    AutoLock lock(mLock);
+    bool newLines = false;
+    for (std::streamsize i = 0; i < n; i++) {
+        mHeadOffset++;
+        if (s[i] == '\n') {
+            addLine(mHeadOffset);
+            newLines = true;
+        } else if (mPartial.size() < kMaxLineLength) {
+            mPartial.push_back(s[i]);
+        }
+    }
+    if (newLines) {
+        mCanRead.broadcast();
+    }
+    return n;
+}
+
+int LogcatStore::overflow(int c) {
+    if (c == EOF) {
+        return EOF;
+    }
+    char ch = c;
+    xsputn(&ch, 1);
+    return c;
+}
+
+size_t LogcatStore::size() {
+    AutoLock lock(mLock);
+    return mNextSeq - mFirstSeq;
+}
+
+size_t LogcatStore::tagCount() {
+    AutoLock lock(mLock);
+    return mTagIds.size();
+}
+
+uint32_t LogcatStore::internTag(const std::string& tag) {
+    auto it = mTagIds.find(tag);
+    if (it != mTagIds.end()) {
+        return it->second;
+    }
+    uint32_t id;
+    if (!mFreeTagIds.empty()) {
+        id = mFreeTagIds.back();
+        mFreeTagIds.pop_back();
+        mTags[id] = tag;
+    } else {
+        id = mTags.size();
+        mTags.push_back(tag);
+    }
+    mTagIds[tag] = id;
+    return id;
+}
+
+void LogcatStore::addLine(uint64_t end) {
+    const uint64_t start = mLineEnd;
+    mLineEnd = end;
+
+    LogcatEntry entry;
+    const std::string& line = mPartial;
+    if (!LogcatParser::parseLine(line.begin(), line.end(), &entry)) {
+        mPartial.clear();
+        return;
+    }
+
+    if (mNextSeq - mFirstSeq == mCapacity) {
+        evictOldest();
+    }
+
+    const uint64_t seq = mNextSeq++;
+    const size_t idx = slot(seq);
+    uint64_t maxTs = entry.timestamp();
+    if (seq > mFirstSeq) {
+        maxTs = std::max(maxTs, mMaxTimestamp[slot(seq - 1)]);
+    }
+    const uint32_t tagId = internTag(entry.tag());
+    mOffset[idx] = start;
+    mEnd[idx] = end;
+    mTimestamp[idx] = entry.timestamp();
+    mMaxTimestamp[idx] = maxTs;
+    mPid[idx] = entry.pid();
+    mTid[idx] = entry.tid();
+    mLevel[idx] = entry.level();
+    mTagId[idx] = tagId;
+    mMsg[idx] = std::move(*entry.mutable_msg());
+
+    mByTag[tagId].push_back(seq);
+    mByPid[entry.pid()].push_back(seq);
+    mByLevel[entry.level()].push_back(seq);
+    mPartial.clear();
+}
+
+// Returns true if that was the last entry with |key|.
+static bool popFront(std::unordered_map<uint32_t, SeqList>* index,
+                     uint32_t key) {
+    auto it = index->find(key);
+    it->second.pop_front();
+    if (it->second.empty()) {
+        index->erase(it);
+        return true;
+    }
+    return false;
+}
+
+void LogcatStore::evictOldest() {
+    const size_t idx = slot(mFirstSeq);
+    const uint32_t tagId = mTagId[idx];
+    if (popFront(&mByTag, tagId)) {
+        mTagIds.erase(mTags[tagId]);
+        mTags[tagId].clear();
+        mFreeTagIds.push_back(tagId);
+    }
+    popFront(&mByPid, mPid[idx]);
+    mByLevel[mLevel[idx]].pop_front();
+    mMsg[idx].clear();
+    mFirstSeq++;
+}
+
+uint64_t LogcatStore::lowerBoundOffset(uint64_t offset) const {
+    uint64_t lo = mFirstSeq, hi = mNextSeq;
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (mOffset[slot(mid)] < offset) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+uint64_t LogcatStore::lowerBoundTime(uint64_t since) const {
+    // Timestamps can go backwards (the clock got set), so we search the
+    // running maximum, which is guaranteed to be sorted.
+    uint64_t lo = mFirstSeq, hi = mNextSeq;
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (mMaxTimestamp[slot(mid)] < since) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+bool LogcatStore::matches(uint64_t seq,
+                          const LogcatFilter& filter,
+                          const std::vector<uint32_t>& tagIds) const {
+    const size_t idx = slot(seq);
+    if (mLevel[idx] < filter.minlevel() || mTimestamp[idx] < filter.since()) {
+        return false;
+    }
+    if (filter.tags_size() > 0 &&
+        std::find(tagIds.begin(), tagIds.end(), mTagId[idx]) == tagIds.end()) {
+        return false;
+    }
+    if (filter.pids_size() > 0 &&
+        std::find(filter.pids().begin(), filter.pids().end(), mPid[idx]) ==
+                filter.pids().end()) {
+        return false;
+    }
+    return true;
+}
+
+// Number of entries >= first in the given lists.
+static size_t countFrom(const std::vector<const SeqList*>& lists,
+                        uint64_t first) {
+    size_t count = 0;
+    for (const auto* list : lists) {
+        count += list->end() -
+                 std::lower_bound(list->begin(), list->end(), first);
+    }
+    return count;
+}
+
+int LogcatStore::query(uint64_t offset,
+                       const LogcatFilter& filter,
+                       System::Duration timeoutMs,
+                       LogMessage* reply) {
+    AutoLock lock(mLock);
+    if (offset >= mLineEnd && timeoutMs > 0) {
+        System::Duration waitUntilUs =
+                System::get()->getUnixTimeUs() + timeoutMs * 1000;
+        while (offset >= mLineEnd) {
+            if (!mCanRead.timedWait(&mLock, waitUntilUs)) {
+                break;
+            }
+        }
+    }
+
+    reply->clear_entries();
+    uint64_t oldest =
+            mFirstSeq < mNextSeq ? mOffset[slot(mFirstSeq)] : mLineEnd;
+    reply->set_start(std::min(std::max(offset, oldest), mLineEnd));
+    reply->set_next(mLineEnd);
+
+    uint64_t first = lowerBoundOffset(offset);
+    if (filter.since() > 0) {
+        first = std::max(first, lowerBoundTime(filter.since()));
+    }
+
+    // Resolve the tags, if none of them were ever logged we are done.
+    std::vector<uint32_t> tagIds;
+    for (const auto& tag : filter.tags()) {
+        auto it = mTagIds.find(tag);
+        if (it != mTagIds.end()) {
+            tagIds.push_back(it->second);
+        }
+    }
+    if (filter.tags_size() > 0 && tagIds.empty()) {
+        return 0;
+    }
+
+    // Pick the index that gives us the fewest candidates, a plain scan
+    // of the ring is used if that is cheaper.
+    std::vector<const SeqList*> candidates;
+    size_t best = mNextSeq - first;
+    auto consider = [&](std::vector<const SeqList*> lists) {
+        size_t count = countFrom(lists, first);
+        if (count < best) {
+            best = count;
+            candidates = std::move(lists);
+        }
+    };
+    if (!tagIds.empty()) {
+        std::vector<const SeqList*> lists;
+        for (uint32_t id : tagIds) {
+            auto it = mByTag.find(id);
+            if (it != mByTag.end()) {
+                lists.push_back(&it->second);
+            }
+        }
+        consider(std::move(lists));
+    }
+    if (filter.pids_size() > 0) {
+        std::vector<const SeqList*> lists;
+        for (uint32_t pid : filter.pids()) {
+            auto it = mByPid.find(pid);
+            if (it != mByPid.end()) {
+                lists.push_back(&it->second);
+            }
+        }
+        consider(std::move(lists));
+    }
+    if (filter.minlevel() > LogcatEntry::UNKNOWN) {
+        std::vector<const SeqList*> lists;
+        for (size_t lvl = filter.minlevel(); lvl < mByLevel.size(); lvl++) {
+            lists.push_back(&mByLevel[lvl]);
+        }
+        consider(std::move(lists));
+    }
+
+    int count = 0;
+    const uint32_t maxEntries = filter.maxentries();
+    auto visit = [&](uint64_t seq) {
+        if (!matches(seq, filter, tagIds)) {
+            return true;
+        }
+        const size_t idx = slot(seq);
+        auto entry = reply->add_entries();
+        entry->set_timestamp(mTimestamp[idx]);
+        entry->set_pid(mPid[idx]);
+        entry->set_tid(mTid[idx]);
+        entry->set_level(static_cast<LogcatEntry::LogLevel>(mLevel[idx]));
+        entry->set_tag(mTags[mTagId[idx]]);
+        entry->set_msg(mMsg[idx]);
+        if (++count == maxEntries) {
+            // Resume right after this entry.
+            reply->set_next(mEnd[idx]);
+            return false;
+        }
+        return true;
+    };
+
+    if (best == mNextSeq - first) {
+        for (uint64_t seq = first; seq < mNextSeq && visit(seq); seq++)
+            ;
+        return count;
+    }
+
+    std::vector<uint64_t> seqs;
+    seqs.reserve(best);
+    for (const auto* list : candidates) {
+        seqs.insert(seqs.end(),
+                    std::lower_bound(list->begin(), list->end(), first),
+                    list->end());
+    }
+    if (candidates.size() > 1) {
+        std::sort(seqs.begin(), seqs.end());
+    }
+    for (uint64_t seq : seqs) {
+        if (!visit(seq)) {
+            break;
+        }
+    }
+    return count;
+}
+
+}  // namespace control
+}  // namespace emulation
+}  // namespace android
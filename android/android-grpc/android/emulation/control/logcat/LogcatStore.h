@@ -0,0 +1,139 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+#include <stdint.h>       // for uint64_t, uint32_t, uint8_t
+#include <stdio.h>        // for EOF
+#include <array>          // for array
+#include <deque>          // for deque
+#include <ios>            // for streamsize
+#include <streambuf>      // for streambuf
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
+
+#include "android/base/synchronization/ConditionVariable.h"  // for Conditio...
+#include "android/base/synchronization/Lock.h"               // for Lock
+#include "android/base/system/System.h"                      // for System
+#include "emulator_controller.pb.h"  // for LogcatEntry, LogcatFilter
+
+namespace android {
+namespace emulation {
+namespace control {
+
+using namespace base;
+
+// LogcatStore - a thread safe streambuffer that parses the logcat output
+// that is written to it exactly once, and keeps the last |capacity| entries
+// around in a columnar ring. The entries are indexed on tag, pid and level,
+// and on time, so queries only touch entries that can actually match.
+//
+// Offsets are byte offsets in the logcat stream, and are compatible with
+// the offsets used by the RingStreambuf, so clients can use the start/next
+// fields of a LogMessage the same way, regardless of the LogType.
+//
+// For example:
+//
+//   LogcatStore store(8192);
+//   LogcatPipe::registerStream(new std::ostream(&store));
+//
+//   LogcatFilter filter;
+//   filter.add_tags("ActivityManager");
+//   filter.set_minlevel(LogcatEntry::WARN);
+//   LogMessage reply;
+//   store.query(0, filter, 5000, &reply);
+class LogcatStore : public std::streambuf {
+public:
+    // |capacity| the maximum number of parsed entries that are retained.
+    explicit LogcatStore(uint32_t capacity);
+
+    // Retrieves the entries that start at or after the given offset and
+    // match the filter. It will block at most timeoutMs if no new lines
+    // are available. Sets the entries, start and next fields of |reply|.
+    //
+    // Returns the number of entries added to |reply|.
+    int query(uint64_t offset,
+              const LogcatFilter& filter,
+              System::Duration timeoutMs,
+              LogMessage* reply);
+
+    // The number of entries currently retained.
+    size_t size();
+
+    // The number of distinct tags of the retained entries.
+    size_t tagCount();
+
+protected:
+    // Implement the output side of the streambuf interface.
+    std::streamsize xsputn(const char* s, std::streamsize n) override;
+    int overflow(int c = EOF) override;
+
+private:
+    // Parses the line in mPartial, and adds it to the ring if it is a
+    // logcat line. |end| is the offset just past the newline.
+    void addLine(uint64_t end);
+    void evictOldest();
+    uint32_t internTag(const std::string& tag);
+
+    // First entry with an offset >= |offset|.
+    uint64_t lowerBoundOffset(uint64_t offset) const;
+
+    // First entry that could have a timestamp >= |since|.
+    uint64_t lowerBoundTime(uint64_t since) const;
+
+    bool matches(uint64_t seq,
+                 const LogcatFilter& filter,
+                 const std::vector<uint32_t>& tagIds) const;
+
+    size_t slot(uint64_t seq) const { return seq % mCapacity; }
+
+    const uint32_t mCapacity;
+
+    // The columns, entry |seq| lives in slot(seq).
+    std::vector<uint64_t> mOffset;        // Offset of the first character.
+    std::vector<uint64_t> mEnd;           // Offset just past the newline.
+    std::vector<uint64_t> mTimestamp;     // Timestamp in ms.
+    std::vector<uint64_t> mMaxTimestamp;  // Running max, the time index.
+    std::vector<uint32_t> mPid;
+    std::vector<uint32_t> mTid;
+    std::vector<uint8_t> mLevel;
+    std::vector<uint32_t> mTagId;
+    std::vector<std::string> mMsg;
+
+    // The indices, every deque contains sequence numbers in ascending order.
+    std::unordered_map<uint32_t, std::deque<uint64_t>> mByTag;
+    std::unordered_map<uint32_t, std::deque<uint64_t>> mByPid;
+    std::array<std::deque<uint64_t>, LogcatEntry::LogLevel_ARRAYSIZE>
+            mByLevel;
+
+    // Interned tags of the retained entries. A tag goes away with its last
+    // entry, and its id is handed out again, so a device that makes up new
+    // tags all the time doesn't grow these.
+    std::unordered_map<std::string, uint32_t> mTagIds;
+    std::vector<std::string> mTags;
+    std::vector<uint32_t> mFreeTagIds;
+
+    uint64_t mFirstSeq{0};  // Oldest retained entry.
+    uint64_t mNextSeq{0};   // Next entry to be written.
+
+    std::string mPartial;     // Incomplete line we have seen so far.
+    uint64_t mLineEnd{0};     // Offset just past the last complete line.
+    uint64_t mHeadOffset{0};  // Accumulated offset.
+
+    Lock mLock;
+    ConditionVariable mCanRead;
+};
+
+}  // namespace control
+}  // namespace emulation
+}  // namespace android
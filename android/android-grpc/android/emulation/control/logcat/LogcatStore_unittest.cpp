@@ -0,0 +1,223 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/emulation/control/logcat/LogcatStore.h"
+
+#include <gtest/gtest.h>  // for Message, TestPartResult, EXPECT_EQ
+#include <ostream>        // for ostream
+#include <string>         // for string
+#include <thread>         // for thread
+
+namespace android {
+namespace emulation {
+namespace control {
+
+static std::string logLine(int sec, int pid, char level, std::string tag) {
+    char buf[128];
+    snprintf(buf, sizeof(buf), "10-11 22:27:%02d.043  %d  %d %c %s: msg %d\n",
+             sec, pid, pid + 1, level, tag.c_str(), sec);
+    return buf;
+}
+
+TEST(LogcatStore, parsesEntries) {
+    LogcatStore store(16);
+    std::ostream stream(&store);
+    stream << logLine(1, 100, 'W', "Foo") << logLine(2, 200, 'I', "Bar");
+
+    LogMessage reply;
+    EXPECT_EQ(2, store.query(0, LogcatFilter(), 0, &reply));
+    EXPECT_EQ(0, reply.start());
+    EXPECT_EQ(logLine(1, 100, 'W', "Foo").size() * 2, reply.next());
+    EXPECT_EQ("Foo", reply.entries(0).tag());
+    EXPECT_EQ(100, reply.entries(0).pid());
+    EXPECT_EQ(101, reply.entries(0).tid());
+    EXPECT_EQ(LogcatEntry::WARN, reply.entries(0).level());
+    EXPECT_EQ("msg 1", reply.entries(0).msg());
+    EXPECT_EQ("Bar", reply.entries(1).tag());
+}
+
+TEST(LogcatStore, partialLinesAreNotReturned) {
+    LogcatStore store(16);
+    std::ostream stream(&store);
+    std::string line = logLine(1, 100, 'W', "Foo");
+    stream << line.substr(0, 10);
+
+    LogMessage reply;
+    EXPECT_EQ(0, store.query(0, LogcatFilter(), 0, &reply));
+    EXPECT_EQ(0, reply.next());
+
+    stream << line.substr(10);
+    EXPECT_EQ(1, store.query(0, LogcatFilter(), 0, &reply));
+    EXPECT_EQ(line.size(), reply.next());
+}
+
+TEST(LogcatStore, skipsGarbage) {
+    LogcatStore store(16);
+    std::ostream stream(&store);
+    stream << "--------- beginning of main\n" << logLine(1, 100, 'W', "Foo");
+
+    LogMessage reply;
+    EXPECT_EQ(1, store.query(0, LogcatFilter(), 0, &reply));
+    EXPECT_EQ("Foo", reply.entries(0).tag());
+}
+
+TEST(LogcatStore, resumesAtNext) {
+    LogcatStore store(16);
+    std::ostream stream(&store);
+    stream << logLine(1, 100, 'W', "Foo");
+
+    LogMessage reply;
+    EXPECT_EQ(1, store.query(0, LogcatFilter(), 0, &reply));
+    stream << logLine(2, 100, 'W', "Bar");
+    EXPECT_EQ(1, store.query(reply.next(), LogcatFilter(), 0, &reply));
+    EXPECT_EQ("Bar", reply.entries(0).tag());
+    EXPECT_EQ(0, store.query(reply.next(), LogcatFilter(), 0, &reply));
+}
+
+TEST(LogcatStore, filters) {
+    LogcatStore store(64);
+    std::ostream stream(&store);
+    size_t written = 0;
+    for (int i = 0; i < 30; i++) {
+        std::string line = logLine(i, 100 + i % 3, "VDIWE"[i % 5],
+                                   i % 2 ? "Odd" : "Even");
+        stream << line;
+        written += line.size();
+    }
+
+    LogMessage reply;
+    LogcatFilter byTag;
+    byTag.add_tags("Odd");
+    byTag.add_tags("Unknown");
+    EXPECT_EQ(15, store.query(0, byTag, 0, &reply));
+    for (const auto& entry : reply.entries()) {
+        EXPECT_EQ("Odd", entry.tag());
+    }
+
+    LogcatFilter byPid;
+    byPid.add_pids(101);
+    EXPECT_EQ(10, store.query(0, byPid, 0, &reply));
+    for (const auto& entry : reply.entries()) {
+        EXPECT_EQ(101, entry.pid());
+    }
+
+    LogcatFilter byLevel;
+    byLevel.set_minlevel(LogcatEntry::WARN);
+    EXPECT_EQ(12, store.query(0, byLevel, 0, &reply));
+    for (const auto& entry : reply.entries()) {
+        EXPECT_GE(entry.level(), LogcatEntry::WARN);
+    }
+
+    LogcatFilter combined;
+    combined.add_tags("Even");
+    combined.add_pids(100);
+    combined.set_minlevel(LogcatEntry::WARN);
+    // Even and pid 100 means i % 6 == 0, of which only 18 and 24 are W or E.
+    EXPECT_EQ(2, store.query(0, combined, 0, &reply));
+
+    LogcatFilter missing;
+    missing.add_tags("Unknown");
+    EXPECT_EQ(0, store.query(0, missing, 0, &reply));
+    EXPECT_EQ(written, reply.next());
+}
+
+TEST(LogcatStore, filtersOnTime) {
+    LogcatStore store(64);
+    std::ostream stream(&store);
+    LogMessage reply;
+    for (int i = 0; i < 10; i++) {
+        stream << logLine(i, 100, 'I', "Foo");
+    }
+    ASSERT_EQ(10, store.query(0, LogcatFilter(), 0, &reply));
+
+    LogcatFilter since;
+    since.set_since(reply.entries(7).timestamp());
+    EXPECT_EQ(3, store.query(0, since, 0, &reply));
+    EXPECT_EQ("msg 7", reply.entries(0).msg());
+}
+
+TEST(LogcatStore, maxEntries) {
+    LogcatStore store(64);
+    std::ostream stream(&store);
+    for (int i = 0; i < 10; i++) {
+        stream << logLine(i, 100, 'I', "Foo");
+    }
+
+    LogcatFilter filter;
+    filter.set_maxentries(4);
+    LogMessage reply;
+    int total = 0;
+    for (int batch : {4, 4, 2, 0}) {
+        EXPECT_EQ(batch, store.query(reply.next(), filter, 0, &reply));
+        for (const auto& entry : reply.entries()) {
+            EXPECT_EQ("msg " + std::to_string(total++), entry.msg());
+        }
+    }
+    EXPECT_EQ(10, total);
+}
+
+TEST(LogcatStore, evictsOldEntries) {
+    LogcatStore store(8);
+    std::ostream stream(&store);
+    size_t evicted = 0;
+    for (int i = 0; i < 20; i++) {
+        std::string line = logLine(i, 100 + i % 2, 'I', "Foo");
+        stream << line;
+        if (i < 12) {
+            evicted += line.size();
+        }
+    }
+    EXPECT_EQ(8, store.size());
+
+    LogMessage reply;
+    LogcatFilter filter;
+    filter.add_pids(100);
+    EXPECT_EQ(4, store.query(0, filter, 0, &reply));
+    EXPECT_EQ("msg 12", reply.entries(0).msg());
+    EXPECT_EQ(evicted, reply.start());
+}
+
+TEST(LogcatStore, evictsUnusedTags) {
+    LogcatStore store(4);
+    std::ostream stream(&store);
+    for (int i = 0; i < 100; i++) {
+        stream << logLine(i % 60, 100, 'I', "Tag" + std::to_string(i));
+    }
+    EXPECT_EQ(4, store.tagCount());
+
+    // Reused tag ids don't bring back the entries of the old tags.
+    LogMessage reply;
+    LogcatFilter filter;
+    filter.add_tags("Tag1");
+    EXPECT_EQ(0, store.query(0, filter, 0, &reply));
+    filter.add_tags("Tag99");
+    EXPECT_EQ(1, store.query(0, filter, 0, &reply));
+    EXPECT_EQ("Tag99", reply.entries(0).tag());
+}
+
+TEST(LogcatStore, waitsForNewLines) {
+    LogcatStore store(16);
+    std::thread writer([&store]() {
+        std::ostream stream(&store);
+        stream << logLine(1, 100, 'W', "Foo");
+    });
+
+    LogMessage reply;
+    EXPECT_EQ(1, store.query(0, LogcatFilter(), 5000, &reply));
+    writer.join();
+}
+
+}  // namespace control
+}  // namespace emulation
+}  // namespace android
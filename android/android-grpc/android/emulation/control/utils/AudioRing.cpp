@@ -0,0 +1,118 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "android/emulation/control/utils/AudioRing.h"
+
+#include "android/base/system/System.h"  // for System
+
+namespace android {
+namespace emulation {
+namespace control {
+
+using android::base::AutoLock;
+using android::base::System;
+
+// The ring buffer needs a power of 2, and always keeps one byte free.
+static uint32_t ringSize(uint32_t capacity) {
+    uint32_t size = 1;
+    while (size < capacity + 1) {
+        size <<= 1;
+    }
+    return size;
+}
+
+AudioRing::AudioRing(uint32_t capacity) : mBuffer(ringSize(capacity)) {
+    ring_buffer_view_init(&mRing, &mView, mBuffer.data(), mBuffer.size());
+}
+
+bool AudioRing::write(uint64_t timestampUs, const void* data, uint32_t size) {
+    FrameHeader header{timestampUs, size, 0};
+
+    // The consumer only picks up a frame once the payload is complete, so it
+    // is fine to write the header and payload as separate steps.
+    if (!ring_buffer_view_can_write(&mRing, &mView, sizeof(header) + size)) {
+        mDropped++;
+        return false;
+    }
+    ring_buffer_view_write(&mRing, &mView, &header, sizeof(header), 1);
+    if (size > 0) {
+        ring_buffer_view_write(&mRing, &mView, data, size, 1);
+    }
+    mWritten++;
+
+    // Either the consumer sees the frame before it goes to sleep, or we see
+    // that it is waiting for one.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (mWaiting.load(std::memory_order_relaxed)) {
+        AutoLock lock(mLock);
+        mCanRead.signalAndUnlock(&lock);
+    }
+    return true;
+}
+
+bool AudioRing::peek(FrameHeader* header) {
+    if (ring_buffer_copy_contents(&mRing, &mView, sizeof(*header),
+                                  reinterpret_cast<uint8_t*>(header)) != 0) {
+        return false;
+    }
+    return ring_buffer_available_read(&mRing, &mView) >=
+           sizeof(*header) + header->size;
+}
+
+bool AudioRing::waitForFrame(FrameHeader* header, uint64_t timeoutUs) {
+    if (peek(header)) {
+        return true;
+    }
+
+    const uint64_t deadlineUs = System::get()->getUnixTimeUs() + timeoutUs;
+    AutoLock lock(mLock);
+    mWaiting.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool ready;
+    while (!(ready = peek(header)) &&
+           System::get()->getUnixTimeUs() < deadlineUs) {
+        mCanRead.timedWait(&mLock, deadlineUs);
+    }
+    mWaiting.store(0, std::memory_order_relaxed);
+    return ready;
+}
+
+int AudioRing::read(std::string* out,
+                    uint64_t* timestampUs,
+                    uint32_t maxBytes,
+                    uint64_t timeoutUs) {
+    FrameHeader header;
+    if (!waitForFrame(&header, timeoutUs)) {
+        return 0;
+    }
+
+    *timestampUs = header.timestampUs;
+    uint32_t bytes = 0;
+    int frames = 0;
+    do {
+        ring_buffer_view_read(&mRing, &mView, &header, sizeof(header), 1);
+        if (header.size > 0) {
+            size_t offset = out->size();
+            out->resize(offset + header.size);
+            ring_buffer_view_read(&mRing, &mView, &(*out)[offset], header.size,
+                                  1);
+        }
+        bytes += header.size;
+        frames++;
+    } while (peek(&header) && bytes + header.size <= maxBytes);
+    return frames;
+}
+
+}  // namespace control
+}  // namespace emulation
+}  // namespace android
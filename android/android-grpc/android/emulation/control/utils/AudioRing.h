@@ -0,0 +1,105 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <stdint.h>  // for uint64_t, uint32_t
+#include <atomic>    // for atomic
+#include <string>    // for string
+#include <vector>    // for vector
+
+#include "android/base/ring_buffer.h"                        // for ring_bu...
+#include "android/base/synchronization/ConditionVariable.h"  // for Conditio...
+#include "android/base/synchronization/Lock.h"               // for Lock
+
+namespace android {
+namespace emulation {
+namespace control {
+
+// An AudioRing is a preallocated, lock-free, single producer/single consumer
+// queue of timestamped audio frames. It is a thin layer on top of the
+// ring_buffer that is also used to talk to the guest.
+//
+// The producer (usually an AudioProducer callback) copies each frame exactly
+// once into the ring, and never waits for the consumer. If the consumer
+// cannot keep up the frame is dropped. The consumer sleeps until the
+// producer wakes it up with a new frame, and copies a batch of frames
+// straight into the buffer that it will hand to gRPC.
+//
+// For example:
+//
+// AudioRing ring(64 * 1024);
+// producer->attachCallback([&ring](const Frame* frame) {
+//      return ring.write(frame->tsUs, frame->dataVec.data(),
+//                        frame->dataVec.size());
+// });
+//
+// uint64_t ts;
+// std::string audio;
+// if (ring.read(&audio, &ts, 8192, 125000) > 0)
+//      deliver(ts, audio);
+class AudioRing {
+public:
+    // Creates a ring that can hold at least |capacity| bytes. Every frame
+    // takes an additional 16 bytes of bookkeeping.
+    explicit AudioRing(uint32_t capacity);
+
+    // Producer side. Copies the frame of |size| bytes into the ring. Returns
+    // false if there is not enough space in the ring, in which case the frame
+    // is dropped.
+    bool write(uint64_t timestampUs, const void* data, uint32_t size);
+
+    // Consumer side. Waits at most |timeoutUs| for a frame to arrive, and
+    // appends as many complete frames as are available to |out|, up to at
+    // most |maxBytes|. At least one frame is read, even if it is larger than
+    // |maxBytes|. |timestampUs| is set to the timestamp of the first frame.
+    //
+    // Returns the number of frames appended, 0 if we timed out.
+    int read(std::string* out,
+             uint64_t* timestampUs,
+             uint32_t maxBytes,
+             uint64_t timeoutUs);
+
+    // The number of frames dropped by the producer.
+    uint64_t dropped() const { return mDropped.load(); }
+
+    // The number of frames successfully written by the producer.
+    uint64_t written() const { return mWritten.load(); }
+
+private:
+    struct FrameHeader {
+        uint64_t timestampUs;
+        uint32_t size;
+        uint32_t reserved;
+    };
+
+    // True if the header and payload of the next frame are fully available.
+    bool peek(FrameHeader* header);
+    // Like peek(), but waits at most |timeoutUs| for the frame.
+    bool waitForFrame(FrameHeader* header, uint64_t timeoutUs);
+
+    std::vector<uint8_t> mBuffer;
+    ring_buffer mRing;
+    ring_buffer_view mView;
+    std::atomic<uint64_t> mDropped{0};
+    std::atomic<uint64_t> mWritten{0};
+
+    // Only taken by the producer if the consumer is waiting.
+    base::Lock mLock;
+    base::ConditionVariable mCanRead;
+    std::atomic<int> mWaiting{0};
+};
+
+}  // namespace control
+}  // namespace emulation
+}  // namespace android
@@ -0,0 +1,141 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/emulation/control/utils/AudioRing.h"
+
+#include <gtest/gtest.h>  // for Message, TestPartResult, EXPECT_EQ
+#include <chrono>         // for milliseconds, seconds, steady_clock
+#include <string>         // for string
+#include <thread>         // for thread
+
+namespace android {
+namespace emulation {
+namespace control {
+
+TEST(AudioRing, empty_ring_times_out) {
+    AudioRing ring(1024);
+    std::string out;
+    uint64_t ts = 0;
+    EXPECT_EQ(0, ring.read(&out, &ts, 1024, 10));
+    EXPECT_TRUE(out.empty());
+}
+
+TEST(AudioRing, read_single_frame) {
+    AudioRing ring(1024);
+    std::string frame(100, 'a');
+    EXPECT_TRUE(ring.write(42, frame.data(), frame.size()));
+
+    std::string out;
+    uint64_t ts = 0;
+    EXPECT_EQ(1, ring.read(&out, &ts, 1024, 10));
+    EXPECT_EQ(42u, ts);
+    EXPECT_EQ(frame, out);
+}
+
+TEST(AudioRing, batches_frames) {
+    AudioRing ring(1024);
+    std::string a(100, 'a');
+    std::string b(100, 'b');
+    std::string c(100, 'c');
+    ring.write(1, a.data(), a.size());
+    ring.write(2, b.data(), b.size());
+    ring.write(3, c.data(), c.size());
+
+    // Only 2 frames fit in the first batch.
+    std::string out;
+    uint64_t ts = 0;
+    EXPECT_EQ(2, ring.read(&out, &ts, 250, 10));
+    EXPECT_EQ(1u, ts);
+    EXPECT_EQ(a + b, out);
+
+    out.clear();
+    EXPECT_EQ(1, ring.read(&out, &ts, 250, 10));
+    EXPECT_EQ(3u, ts);
+    EXPECT_EQ(c, out);
+}
+
+TEST(AudioRing, drops_when_full) {
+    // Room for exactly 2 frames of 100 bytes.
+    AudioRing ring(2 * (100 + 16));
+    std::string frame(100, 'a');
+    EXPECT_TRUE(ring.write(1, frame.data(), frame.size()));
+    EXPECT_TRUE(ring.write(2, frame.data(), frame.size()));
+    EXPECT_FALSE(ring.write(3, frame.data(), frame.size()));
+    EXPECT_EQ(1u, ring.dropped());
+    EXPECT_EQ(2u, ring.written());
+}
+
+TEST(AudioRing, wraps_around) {
+    AudioRing ring(256);
+    std::string out;
+    uint64_t ts = 0;
+    for (int i = 0; i < 100; i++) {
+        std::string frame(50 + i % 30, 'a' + i % 26);
+        ASSERT_TRUE(ring.write(i, frame.data(), frame.size()));
+        out.clear();
+        ASSERT_EQ(1, ring.read(&out, &ts, 1024, 10));
+        EXPECT_EQ(frame, out);
+        EXPECT_EQ((uint64_t)i, ts);
+    }
+}
+
+TEST(AudioRing, write_wakes_up_reader) {
+    AudioRing ring(1024);
+    std::thread producer([&ring]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        std::string frame(100, 'a');
+        ring.write(7, frame.data(), frame.size());
+    });
+
+    std::string out;
+    uint64_t ts = 0;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(1, ring.read(&out, &ts, 1024, 30 * 1000000));
+    // Woken up by the write, long before the timeout.
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    EXPECT_EQ(7u, ts);
+    producer.join();
+}
+
+TEST(AudioRing, producer_consumer) {
+    AudioRing ring(4096);
+    const int kFrames = 2000;
+    std::thread producer([&ring]() {
+        for (int i = 0; i < kFrames; i++) {
+            std::string frame(64, (char)i);
+            while (!ring.write(i, frame.data(), frame.size())) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    while (expected < kFrames) {
+        std::string out;
+        uint64_t ts = 0;
+        int frames = ring.read(&out, &ts, 1024, 1000000);
+        ASSERT_GT(frames, 0);
+        EXPECT_EQ((uint64_t)expected, ts);
+        ASSERT_EQ(frames * 64u, out.size());
+        for (int i = 0; i < frames; i++) {
+            EXPECT_EQ((char)(expected + i), out[i * 64]);
+        }
+        expected += frames;
+    }
+    producer.join();
+}
+
+}  // namespace control
+}  // namespace emulation
+}  // namespace android
@@ -0,0 +1,150 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "android/emulation/control/utils/TileDiff.h"
+
+#include <string.h>   // for memcmp, memcpy
+#include <algorithm>  // for max, min
+
+#ifdef __x86_64__
+#include <emmintrin.h>
+#endif
+
+namespace android {
+namespace emulation {
+namespace control {
+
+TileDiff::TileDiff(uint32_t tileSize)
+    : mTileSize(std::max(kMinTileSize, std::min(tileSize, kMaxTileSize))) {}
+
+void TileDiff::reset() {
+    mWidth = mHeight = mBpp = 0;
+    mPrevious.clear();
+}
+
+bool TileDiff::equals(const uint8_t* a, const uint8_t* b, size_t len) {
+#ifdef __x86_64__
+    // Compare 64 bytes per iteration, we only need a single movemask to
+    // learn if any of the 4 vectors differ.
+    while (len >= 64) {
+        auto pa = reinterpret_cast<const __m128i*>(a);
+        auto pb = reinterpret_cast<const __m128i*>(b);
+        __m128i e0 = _mm_cmpeq_epi8(_mm_loadu_si128(pa), _mm_loadu_si128(pb));
+        __m128i e1 = _mm_cmpeq_epi8(_mm_loadu_si128(pa + 1),
+                                    _mm_loadu_si128(pb + 1));
+        __m128i e2 = _mm_cmpeq_epi8(_mm_loadu_si128(pa + 2),
+                                    _mm_loadu_si128(pb + 2));
+        __m128i e3 = _mm_cmpeq_epi8(_mm_loadu_si128(pa + 3),
+                                    _mm_loadu_si128(pb + 3));
+        __m128i all = _mm_and_si128(_mm_and_si128(e0, e1),
+                                    _mm_and_si128(e2, e3));
+        if (_mm_movemask_epi8(all) != 0xFFFF) {
+            return false;
+        }
+        a += 64;
+        b += 64;
+        len -= 64;
+    }
+    while (len >= 16) {
+        __m128i eq = _mm_cmpeq_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(a)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(b)));
+        if (_mm_movemask_epi8(eq) != 0xFFFF) {
+            return false;
+        }
+        a += 16;
+        b += 16;
+        len -= 16;
+    }
+#endif
+    return memcmp(a, b, len) == 0;
+}
+
+std::vector<DirtyRect> TileDiff::update(const uint8_t* pixels,
+                                        uint32_t width,
+                                        uint32_t height,
+                                        uint32_t bpp) {
+    std::vector<DirtyRect> dirty;
+    const size_t stride = static_cast<size_t>(width) * bpp;
+    const size_t size = stride * height;
+    if (size == 0) {
+        reset();
+        return dirty;
+    }
+
+    if (width != mWidth || height != mHeight || bpp != mBpp) {
+        mWidth = width;
+        mHeight = height;
+        mBpp = bpp;
+        mPrevious.assign(pixels, pixels + size);
+        dirty.push_back({0, 0, width, height});
+        return dirty;
+    }
+
+    const uint32_t columns = (width + mTileSize - 1) / mTileSize;
+    const size_t tileStride = static_cast<size_t>(mTileSize) * bpp;
+    mDirty.resize(columns);
+
+    for (uint32_t top = 0; top < height; top += mTileSize) {
+        const uint32_t rows = std::min(mTileSize, height - top);
+        std::fill(mDirty.begin(), mDirty.end(), false);
+
+        // Walk the band row by row so we touch memory sequentially, tiles
+        // that are already known to be dirty are skipped.
+        uint32_t clean = columns;
+        for (uint32_t y = top; y < top + rows && clean > 0; y++) {
+            const size_t offset = y * stride;
+            for (uint32_t tx = 0; tx < columns; tx++) {
+                if (mDirty[tx]) {
+                    continue;
+                }
+                const size_t start = offset + tx * tileStride;
+                const size_t len = std::min(tileStride, offset + stride - start);
+                if (!equals(pixels + start, mPrevious.data() + start, len)) {
+                    mDirty[tx] = true;
+                    clean--;
+                }
+            }
+        }
+
+        if (clean == columns) {
+            continue;
+        }
+
+        // Merge runs of dirty tiles, and update our copy of the frame.
+        for (uint32_t tx = 0; tx < columns;) {
+            if (!mDirty[tx]) {
+                tx++;
+                continue;
+            }
+            uint32_t end = tx;
+            while (end < columns && mDirty[end]) {
+                end++;
+            }
+            const uint32_t left = tx * mTileSize;
+            const uint32_t right = std::min(end * mTileSize, width);
+            const size_t len = static_cast<size_t>(right - left) * bpp;
+            for (uint32_t y = top; y < top + rows; y++) {
+                const size_t start = y * stride + left * bpp;
+                memcpy(mPrevious.data() + start, pixels + start, len);
+            }
+            dirty.push_back({left, top, right - left, rows});
+            tx = end;
+        }
+    }
+    return dirty;
+}
+
+}  // namespace control
+}  // namespace emulation
+}  // namespace android
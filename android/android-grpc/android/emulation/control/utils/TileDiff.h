@@ -0,0 +1,89 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for uint32_t, uint8_t
+#include <vector>    // for vector
+
+namespace android {
+namespace emulation {
+namespace control {
+
+// A rectangular region of an image, in pixels.
+struct DirtyRect {
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+};
+
+// A TileDiff can be used to find the regions of a screen that changed
+// between consecutive frames of a screenshot stream.
+//
+// The frame is divided in a grid of |tileSize| x |tileSize| pixel tiles.
+// Every call to update compares the new frame against the previous one and
+// returns the tiles that changed. Horizontally adjacent dirty tiles are merged
+// into a single rectangle, so a typical cursor blink results in a single
+// rectangle, and a progress bar in one rectangle per tile row.
+//
+// The differ keeps its own copy of the previous frame, only the changed
+// tiles are copied on every update.
+//
+// This class is not thread safe.
+class TileDiff {
+public:
+    static constexpr uint32_t kDefaultTileSize = 64;
+    // Smaller tiles cost more in rectangles than they save in pixels, larger
+    // ones are bigger than any display.
+    static constexpr uint32_t kMinTileSize = 8;
+    static constexpr uint32_t kMaxTileSize = 16384;
+
+    // |tileSize| is clamped to [kMinTileSize, kMaxTileSize].
+    explicit TileDiff(uint32_t tileSize = kDefaultTileSize);
+
+    // Compares the tightly packed |pixels| of |width| x |height| pixels of
+    // |bpp| bytes each against the previous frame, and returns the
+    // regions that changed.
+    //
+    // The first frame, or any frame whose dimensions differ from the
+    // previous frame, is reported as a single rectangle covering the whole
+    // frame. An empty vector is returned if nothing changed.
+    std::vector<DirtyRect> update(const uint8_t* pixels,
+                                  uint32_t width,
+                                  uint32_t height,
+                                  uint32_t bpp);
+
+    // Forgets the previous frame, the next update will mark the whole
+    // frame as dirty.
+    void reset();
+
+    uint32_t tileSize() const { return mTileSize; }
+
+    // Returns true if the |len| bytes at |a| and |b| are identical. Uses
+    // SSE2 on x86_64 hosts.
+    static bool equals(const uint8_t* a, const uint8_t* b, size_t len);
+
+private:
+    uint32_t mTileSize;
+    uint32_t mWidth{0};
+    uint32_t mHeight{0};
+    uint32_t mBpp{0};
+    std::vector<uint8_t> mPrevious;
+    std::vector<bool> mDirty;
+};
+
+}  // namespace control
+}  // namespace emulation
+}  // namespace android
@@ -0,0 +1,149 @@
+// Copyright (C) 2021 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "android/emulation/control/utils/TileDiff.h"
+
+#include <gtest/gtest.h>  // for Message, TestPartResult, EXPECT_EQ
+#include <vector>         // for vector
+
+namespace android {
+namespace emulation {
+namespace control {
+
+static void setPixel(std::vector<uint8_t>& frame,
+                     uint32_t width,
+                     uint32_t x,
+                     uint32_t y,
+                     uint8_t value) {
+    const uint32_t bpp = 4;
+    frame[(y * width + x) * bpp] = value;
+}
+
+TEST(TileDiff, first_frame_is_dirty) {
+    TileDiff diff(16);
+    std::vector<uint8_t> frame(100 * 50 * 4, 0);
+    auto rects = diff.update(frame.data(), 100, 50, 4);
+    ASSERT_EQ(1u, rects.size());
+    EXPECT_EQ(0u, rects[0].x);
+    EXPECT_EQ(0u, rects[0].y);
+    EXPECT_EQ(100u, rects[0].width);
+    EXPECT_EQ(50u, rects[0].height);
+}
+
+TEST(TileDiff, same_frame_is_clean) {
+    TileDiff diff(16);
+    std::vector<uint8_t> frame(100 * 50 * 4, 0x7f);
+    diff.update(frame.data(), 100, 50, 4);
+    EXPECT_TRUE(diff.update(frame.data(), 100, 50, 4).empty());
+}
+
+TEST(TileDiff, single_pixel_marks_single_tile) {
+    TileDiff diff(16);
+    std::vector<uint8_t> frame(100 * 50 * 4, 0);
+    diff.update(frame.data(), 100, 50, 4);
+
+    setPixel(frame, 100, 40, 20, 0xff);
+    auto rects = diff.update(frame.data(), 100, 50, 4);
+    ASSERT_EQ(1u, rects.size());
+    EXPECT_EQ(32u, rects[0].x);
+    EXPECT_EQ(16u, rects[0].y);
+    EXPECT_EQ(16u, rects[0].width);
+    EXPECT_EQ(16u, rects[0].height);
+
+    // The differ keeps track of the changes.
+    EXPECT_TRUE(diff.update(frame.data(), 100, 50, 4).empty());
+}
+
+TEST(TileDiff, edge_tiles_are_clipped) {
+    TileDiff diff(16);
+    std::vector<uint8_t> frame(100 * 50 * 4, 0);
+    diff.update(frame.data(), 100, 50, 4);
+
+    setPixel(frame, 100, 99, 49, 0xff);
+    auto rects = diff.update(frame.data(), 100, 50, 4);
+    ASSERT_EQ(1u, rects.size());
+    EXPECT_EQ(96u, rects[0].x);
+    EXPECT_EQ(48u, rects[0].y);
+    EXPECT_EQ(4u, rects[0].width);
+    EXPECT_EQ(2u, rects[0].height);
+}
+
+TEST(TileDiff, adjacent_tiles_are_merged) {
+    TileDiff diff(16);
+    std::vector<uint8_t> frame(100 * 50 * 4, 0);
+    diff.update(frame.data(), 100, 50, 4);
+
+    // A horizontal line in the first band, and an isolated pixel in the
+    // last band.
+    for (uint32_t x = 10; x < 70; x++) {
+        setPixel(frame, 100, x, 3, 0xff);
+    }
+    setPixel(frame, 100, 5, 40, 0xff);
+
+    auto rects = diff.update(frame.data(), 100, 50, 4);
+    ASSERT_EQ(2u, rects.size());
+    EXPECT_EQ(0u, rects[0].x);
+    EXPECT_EQ(0u, rects[0].y);
+    EXPECT_EQ(80u, rects[0].width);
+    EXPECT_EQ(16u, rects[0].height);
+
+    EXPECT_EQ(0u, rects[1].x);
+    EXPECT_EQ(32u, rects[1].y);
+    EXPECT_EQ(16u, rects[1].width);
+    EXPECT_EQ(16u, rects[1].height);
+}
+
+TEST(TileDiff, resize_marks_everything_dirty) {
+    TileDiff diff(16);
+    std::vector<uint8_t> frame(100 * 50 * 4, 0);
+    diff.update(frame.data(), 100, 50, 4);
+    auto rects = diff.update(frame.data(), 50, 100, 4);
+    ASSERT_EQ(1u, rects.size());
+    EXPECT_EQ(50u, rects[0].width);
+    EXPECT_EQ(100u, rects[0].height);
+
+    diff.reset();
+    EXPECT_EQ(1u, diff.update(frame.data(), 50, 100, 4).size());
+}
+
+TEST(TileDiff, tile_size_is_clamped) {
+    EXPECT_EQ(TileDiff::kMinTileSize, TileDiff(0).tileSize());
+    EXPECT_EQ(TileDiff::kMinTileSize, TileDiff(1).tileSize());
+    EXPECT_EQ(TileDiff::kMaxTileSize, TileDiff(UINT32_MAX).tileSize());
+
+    // A tile larger than the frame covers all of it.
+    TileDiff diff(UINT32_MAX - 1);
+    std::vector<uint8_t> frame(100 * 50 * 4, 0);
+    diff.update(frame.data(), 100, 50, 4);
+    setPixel(frame, 100, 99, 49, 0xff);
+    auto rects = diff.update(frame.data(), 100, 50, 4);
+    ASSERT_EQ(1u, rects.size());
+    EXPECT_EQ(100u, rects[0].width);
+    EXPECT_EQ(50u, rects[0].height);
+}
+
+TEST(TileDiff, equals_detects_every_byte) {
+    std::vector<uint8_t> a(199, 1);
+    std::vector<uint8_t> b(199, 1);
+    EXPECT_TRUE(TileDiff::equals(a.data(), b.data(), a.size()));
+    for (size_t i = 0; i < b.size(); i++) {
+        b[i] = 2;
+        EXPECT_FALSE(TileDiff::equals(a.data(), b.data(), a.size())) << i;
+        b[i] = 1;
+    }
+}
+
+}  // namespace control
+}  // namespace emulation
+}  // namespace android
@@ -30,6 +30,13 @@ public:
     // call to the getVideoFrame should be made.
     virtual int64_t frameNumber() = 0;
 
+    // Waits up to |timeoutUs| for a frame newer than |frameNumber|, and
+    // returns true if there is one. Capturers that cannot be notified of new
+    // frames just check for one.
+    virtual bool waitForFrame(int64_t frameNumber, int64_t timeoutUs) {
+        return this->frameNumber() > frameNumber;
+    }
+
     // Gets the current screen frame of the device. Return NULL when you failed
     // to produce a video frame.
     virtual absl::optional<::webrtc::VideoFrame> getVideoFrame() = 0;
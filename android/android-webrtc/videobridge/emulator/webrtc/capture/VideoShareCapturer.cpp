@@ -29,12 +29,12 @@
 #include "libyuv/video_common.h"               // for FOURCC_ARGB, FourCC
 
 using android::base::SharedMemory;
+using android::recording::SharedFrameHeader;
+using android::recording::SharedFrameReader;
 
 namespace emulator {
 namespace webrtc {
 
-static const int kRGB8888BytesPerPixel = 4;
-
 static bool openSharedMemory(SharedMemory& shm, std::string handle) {
     if (!shm.isOpen()) {
         int err = shm.open(SharedMemory::AccessMode::READ_ONLY);
@@ -51,30 +51,33 @@ static bool openSharedMemory(SharedMemory& shm, std::string handle) {
 VideoShareCapturer::VideoShareCapturer(std::string handle)
     : mSharedMemory("", 0) {
     // First read the memory settings.
-    SharedMemory shm(handle, sizeof(VideoInfo));
+    SharedMemory shm(handle, sizeof(SharedFrameHeader));
     if (!openSharedMemory(shm, handle)) {
         mName = "bad_" + handle;
         return;
     }
-    memcpy(&mVideoInfo, *shm, sizeof(VideoInfo));
 
-    mPixelBufferSize = getBytesPerFrame(mVideoInfo);
-    mSharedMemory = SharedMemory(handle, mPixelBufferSize + sizeof(VideoInfo));
+    const size_t regionSize = SharedFrameReader::regionSize(*shm);
+    mSharedMemory = SharedMemory(handle, regionSize);
 
     if (!openSharedMemory(mSharedMemory, handle)) {
         mName = "bad_" + handle;
         return;
     }
 
+    mReader.reset(new SharedFrameReader(*mSharedMemory, regionSize));
+    if (!mReader->isValid()) {
+        RTC_LOG(LERROR) << "Unexpected frame layout in: [" << handle << "]";
+        mName = "bad_" + handle;
+        return;
+    }
+    if (mReader->isLegacy()) {
+        RTC_LOG(WARNING) << "Frames from [" << handle << "] might tear.";
+    }
+
     mName = "shm_" + handle;
     mI420Buffer =
-            ::webrtc::I420Buffer::Create(mVideoInfo.width, mVideoInfo.height);
-    mPixelBuffer = (uint8_t*)*mSharedMemory + sizeof(VideoInfo);
-}
-
-size_t VideoShareCapturer::getBytesPerFrame(
-        const VideoShareCapturer::VideoInfo& capability) {
-    return (capability.width * capability.height * kRGB8888BytesPerPixel);
+            ::webrtc::I420Buffer::Create(mReader->width(), mReader->height());
 }
 
 std::string VideoShareCapturer::name() const {
@@ -82,19 +85,27 @@ std::string VideoShareCapturer::name() const {
 }
 
 uint32_t VideoShareCapturer::maxFps() const {
-    return mVideoInfo.fps;
+    return mReader ? mReader->fps() : 0;
 }
 
 bool VideoShareCapturer::isValid() const {
-    return mSharedMemory.isOpen() && mVideoInfo.fps > 0;
+    return mSharedMemory.isOpen() && mReader && mReader->isValid() &&
+           mReader->fps() > 0;
 }
 
 int64_t VideoShareCapturer::frameNumber() {
     if (!isValid())
         return 0;
 
-    VideoInfo* info = (VideoInfo*)*mSharedMemory;
-    return info->frameNumber;
+    return mReader->frameNumber();
+}
+
+bool VideoShareCapturer::waitForFrame(int64_t frameNumber, int64_t timeoutUs) {
+    if (!isValid() || timeoutUs <= 0) {
+        return VideoCapturer::waitForFrame(frameNumber, timeoutUs);
+    }
+
+    return mReader->waitForFrame(frameNumber, timeoutUs);
 }
 
 absl::optional<::webrtc::VideoFrame> VideoShareCapturer::getVideoFrame() {
@@ -102,19 +113,32 @@ absl::optional<::webrtc::VideoFrame> VideoShareCapturer::getVideoFrame() {
         return {};
     };
 
-    auto converted = libyuv::ConvertToI420(
-            mPixelBuffer, mPixelBufferSize, mI420Buffer.get()->MutableDataY(),
-            mI420Buffer.get()->StrideY(), mI420Buffer.get()->MutableDataU(),
-            mI420Buffer.get()->StrideU(), mI420Buffer.get()->MutableDataV(),
-            mI420Buffer.get()->StrideV(),
-            /*crop_x=*/0,
-            /*crop_y=*/0, mVideoInfo.width, mVideoInfo.height, mVideoInfo.width,
-            mVideoInfo.height, libyuv::kRotate0, libyuv::FourCC::FOURCC_ARGB);
+    // libyuv picks the SIMD conversion for the host CPU. The frame is
+    // converted in place, and again if the emulator overwrote it meanwhile.
+    int converted = -1;
+    const bool consistent = mReader->read([this, &converted](
+                                                  const uint8_t* pixels,
+                                                  size_t size,
+                                                  uint32_t frameNumber,
+                                                  uint64_t tsUs) {
+        converted = libyuv::ConvertToI420(
+                pixels, size, mI420Buffer.get()->MutableDataY(),
+                mI420Buffer.get()->StrideY(), mI420Buffer.get()->MutableDataU(),
+                mI420Buffer.get()->StrideU(), mI420Buffer.get()->MutableDataV(),
+                mI420Buffer.get()->StrideV(),
+                /*crop_x=*/0,
+                /*crop_y=*/0, mReader->width(), mReader->height(),
+                mReader->width(), mReader->height(), libyuv::kRotate0,
+                libyuv::FourCC::FOURCC_ARGB);
+    });
     if (converted != 0) {
         RTC_LOG(INFO) << "Bad conversion frame." << frameNumber() << " "
-                      << mVideoInfo.width << "x" << mVideoInfo.height;
+                      << mReader->width() << "x" << mReader->height();
         return {};
     }
+    if (!consistent) {
+        RTC_LOG(INFO) << "Torn frame." << frameNumber();
+    }
 
     return ::webrtc::VideoFrame::Builder()
             .set_video_frame_buffer(mI420Buffer)
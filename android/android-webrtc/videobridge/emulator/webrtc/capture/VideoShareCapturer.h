@@ -19,9 +19,11 @@
 #include <stddef.h>                 // for size_t
 #include <stdint.h>                 // for uint32_t, int32_t
 
+#include <memory>  // for unique_ptr
 #include <string>  // for string
 
 #include "android/base/memory/SharedMemory.h"       // for SharedMemory
+#include "android/recording/video/SharedFrameExchange.h"  // for SharedFrameR...
 #include "emulator/webrtc/capture/VideoCapturer.h"  // for VideoCapturer
 
 using android::base::SharedMemory;
@@ -31,7 +33,8 @@ namespace webrtc {
 
 // A VideoCapturer that provides a new frame from the emulator shared memory region.
 // A new frame will only be delivered if the shared memory region is valid and
-// the frame number has increased.
+// the frame number has increased. Frames are converted straight from the
+// shared memory region, see SharedFrameExchange.h for how they don't tear.
 class VideoShareCapturer : public VideoCapturer {
 public:
     VideoShareCapturer(std::string handle);
@@ -39,6 +42,9 @@ public:
 
     int64_t frameNumber() override;
 
+    // Blocks on the emulator publishing a frame, rather than polling.
+    bool waitForFrame(int64_t frameNumber, int64_t timeoutUs) override;
+
     // Max number of frames per second the capturer can capture.
     uint32_t maxFps() const override;
 
@@ -48,21 +54,9 @@ public:
     std::string name() const override;
 
 private:
-    struct VideoInfo {
-        uint32_t width;
-        uint32_t height;
-        uint32_t fps;          // Target framerate.
-        uint32_t frameNumber;  // Frame number.
-        uint64_t tsUs;         // Timestamp when this frame was received.
-    };
-
-    static size_t getBytesPerFrame(const VideoInfo& capability);
-
     SharedMemory mSharedMemory;
     std::string mName;
-    VideoInfo mVideoInfo{0};
-    uint8_t* mPixelBuffer{nullptr};
-    uint32_t mPixelBufferSize = 0;
+    std::unique_ptr<android::recording::SharedFrameReader> mReader;
     rtc::scoped_refptr<::webrtc::I420Buffer>
             mI420Buffer;  // Re-usable I420Buffer.
 };
@@ -68,6 +68,11 @@ void VideoTrackSource::captureFrames() {
         }
 
         auto currentFrame = mVideoCapturer->frameNumber();
+        if (currentFrame <= lastFrame && now >= deliverAllUntilTs &&
+            mVideoCapturer->waitForFrame(lastFrame, maxFrameDelayUs)) {
+            // Rather than finding out at the next frame delay.
+            currentFrame = mVideoCapturer->frameNumber();
+        }
         if (currentFrame > lastFrame || now < deliverAllUntilTs) {
             auto frame = mVideoCapturer->getVideoFrame();
             if (frame) {
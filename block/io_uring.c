@@ -0,0 +1,700 @@
+/*
+ * Linux io_uring support.
+ *
+ * Copyright (C) 2009 IBM, Corp.
+ * Copyright (C) 2009 Red Hat, Inc.
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ */
+#include "qemu/osdep.h"
+#include "qemu-common.h"
+#include "block/aio.h"
+#include "qemu/queue.h"
+#include "block/block.h"
+#include "block/raw-aio.h"
+#include "qemu/coroutine.h"
+#include "qemu/host-utils.h"
+#include "qapi/error.h"
+#include "qemu/error-report.h"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+/*
+ * The syscall numbers are shared by all architectures we care about, but
+ * the C library headers of the build sysroot may predate them.
+ */
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup     425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter     426
+#endif
+#ifndef __NR_io_uring_register
+#define __NR_io_uring_register  427
+#endif
+
+/*
+ * Queue size (per-AioContext).  The completion ring is twice as large, so it
+ * can never overflow as long as in_flight stays below this.
+ */
+#define MAX_ENTRIES 128
+
+/*
+ * Misaligned requests on O_DIRECT files need a bounce buffer.  We keep a
+ * pool of them registered with the kernel, so that the pages are pinned once
+ * instead of on every request.  Larger requests, or requests that find all
+ * of them busy, allocate a bounce buffer of their own.
+ */
+#define BOUNCE_BUFFERS     16
+#define BOUNCE_BUFFER_SIZE (64 * 1024)
+
+/* Maximum number of memory regions registered for fixed buffer I/O. */
+#define MAX_FIXED_BUFFERS  64
+
+typedef struct LuringAIOCB {
+    Coroutine *co;
+    LuringState *s;
+    int fd;
+    uint64_t offset;
+    int type;
+    QEMUIOVector *qiov;
+    ssize_t ret;
+
+    /* Bytes transferred so far, when a short read had to be resubmitted. */
+    size_t done;
+    QEMUIOVector resubmit_qiov;
+
+    /* Bounce buffer for misaligned requests, and its slot in the pool. */
+    uint8_t *bounce;
+    int bounce_slot;
+    struct iovec bounce_iov;
+
+    QSIMPLEQ_ENTRY(LuringAIOCB) next;
+} LuringAIOCB;
+
+typedef struct {
+    int plugged;
+    unsigned int in_queue;
+    unsigned int in_flight;
+    bool blocked;
+    QSIMPLEQ_HEAD(, LuringAIOCB) pending;
+} LuringQueue;
+
+typedef struct {
+    unsigned *khead;
+    unsigned *ktail;
+    unsigned *kring_mask;
+    unsigned *karray;
+    struct io_uring_sqe *sqes;
+    unsigned tail;              /* Local copy, published on submission. */
+    void *ring;
+    size_t ring_size;
+    size_t sqes_size;
+} LuringSubmitQueue;
+
+typedef struct {
+    unsigned *khead;
+    unsigned *ktail;
+    unsigned *kring_mask;
+    struct io_uring_cqe *cqes;
+    void *ring;
+    size_t ring_size;
+} LuringCompleteQueue;
+
+struct LuringState {
+    AioContext *aio_context;
+
+    int ring_fd;
+    LuringSubmitQueue sq;
+    LuringCompleteQueue cq;
+
+    /* io queue for submit at batch.  Protected by AioContext lock. */
+    LuringQueue io_q;
+
+    /* I/O completion processing.  Only runs in I/O thread.  */
+    QEMUBH *completion_bh;
+
+    /* Bounce buffer pool, and a bitmap of the free slots. */
+    uint8_t *bounce_buffers;
+    uint32_t bounce_free;
+
+    /* Memory registered for fixed buffer I/O: the bounce buffer pool, and
+     * whatever was passed to luring_register_buf().
+     */
+    struct iovec fixed[MAX_FIXED_BUFFERS];
+    unsigned int nr_fixed;
+};
+
+static void ioq_submit(LuringState *s);
+
+static int sys_io_uring_setup(unsigned entries, struct io_uring_params *p)
+{
+    return syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int sys_io_uring_enter(int fd, unsigned to_submit,
+                              unsigned min_complete, unsigned flags)
+{
+    return syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags,
+                   NULL, 0);
+}
+
+static int sys_io_uring_register(int fd, unsigned opcode, void *arg,
+                                 unsigned nr_args)
+{
+    return syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+static int luring_get_bounce(BlockDriverState *bs, LuringState *s,
+                             LuringAIOCB *req)
+{
+    size_t size = req->qiov->size;
+
+    if (s->bounce_free && size <= BOUNCE_BUFFER_SIZE) {
+        req->bounce_slot = ctz32(s->bounce_free);
+        s->bounce_free &= ~(1u << req->bounce_slot);
+        req->bounce = s->bounce_buffers +
+                      (size_t)req->bounce_slot * BOUNCE_BUFFER_SIZE;
+    } else {
+        req->bounce_slot = -1;
+        req->bounce = qemu_try_blockalign(bs, size);
+        if (!req->bounce) {
+            return -ENOMEM;
+        }
+    }
+
+    if (req->type == QEMU_AIO_WRITE) {
+        qemu_iovec_to_buf(req->qiov, 0, req->bounce, size);
+    }
+    return 0;
+}
+
+static void luring_put_bounce(LuringState *s, LuringAIOCB *req)
+{
+    if (req->bounce_slot >= 0) {
+        s->bounce_free |= 1u << req->bounce_slot;
+    } else {
+        qemu_vfree(req->bounce);
+    }
+    req->bounce = NULL;
+}
+
+/*
+ * Completes an AIO request, or queues the rest of it again after a short
+ * read.
+ */
+static void luring_process_completion(LuringState *s, LuringAIOCB *req,
+                                      int ret)
+{
+    size_t total = req->qiov->size;
+
+    if (ret > 0 && req->type == QEMU_AIO_READ && req->done + ret < total) {
+        /* Unlike libaio, buffered reads may come back short anywhere in
+         * the file.  Only a read of zero bytes means EOF.
+         */
+        req->done += ret;
+        if (!req->bounce) {
+            if (!req->resubmit_qiov.iov) {
+                qemu_iovec_init(&req->resubmit_qiov, req->qiov->niov);
+            } else {
+                qemu_iovec_reset(&req->resubmit_qiov);
+            }
+            qemu_iovec_concat(&req->resubmit_qiov, req->qiov, req->done,
+                              total - req->done);
+        }
+        QSIMPLEQ_INSERT_TAIL(&s->io_q.pending, req, next);
+        s->io_q.in_queue++;
+        return;
+    }
+
+    if (ret >= 0) {
+        size_t done = req->done + ret;
+
+        if (done == total) {
+            ret = 0;
+        } else if (req->type == QEMU_AIO_READ) {
+            /* Short reads mean EOF, pad with zeros. */
+            if (req->bounce) {
+                memset(req->bounce + done, 0, total - done);
+            } else {
+                qemu_iovec_memset(req->qiov, done, 0, total - done);
+            }
+            ret = 0;
+        } else {
+            ret = -ENOSPC;
+        }
+    }
+
+    if (req->bounce) {
+        if (ret == 0 && req->type == QEMU_AIO_READ) {
+            qemu_iovec_from_buf(req->qiov, 0, req->bounce, total);
+        }
+        luring_put_bounce(s, req);
+    }
+    if (req->resubmit_qiov.iov) {
+        qemu_iovec_destroy(&req->resubmit_qiov);
+    }
+
+    req->ret = ret;
+    /* If the coroutine is already entered it must be in ioq_submit() and
+     * will notice req->ret has been filled in when it eventually runs
+     * later.  Coroutines cannot be entered recursively so avoid doing
+     * that!
+     */
+    if (!qemu_coroutine_entered(req->co)) {
+        aio_co_wake(req->co);
+    }
+}
+
+static bool luring_completions_ready(LuringState *s)
+{
+    return *s->cq.khead != atomic_load_acquire(s->cq.ktail);
+}
+
+/**
+ * luring_process_completions:
+ * @s: AIO state
+ *
+ * Fetches completed I/O requests and invokes their callbacks.
+ *
+ * Each completion is consumed from the ring before its coroutine runs, so a
+ * nested event loop started by a callback simply picks up where we are.
+ * The BH makes sure that such a nested event loop sees the pending
+ * completions at all; it is canceled once the ring is empty.
+ */
+static void luring_process_completions(LuringState *s)
+{
+    /* Reschedule so nested event loops see currently pending completions */
+    qemu_bh_schedule(s->completion_bh);
+
+    while (luring_completions_ready(s)) {
+        unsigned head = *s->cq.khead;
+        struct io_uring_cqe *cqe = &s->cq.cqes[head & *s->cq.kring_mask];
+        LuringAIOCB *req = (LuringAIOCB *)(uintptr_t)cqe->user_data;
+        int ret = cqe->res;
+
+        atomic_store_release(s->cq.khead, head + 1);
+        s->io_q.in_flight--;
+        luring_process_completion(s, req, ret);
+    }
+
+    qemu_bh_cancel(s->completion_bh);
+}
+
+static void luring_process_completions_and_submit(LuringState *s)
+{
+    aio_context_acquire(s->aio_context);
+    luring_process_completions(s);
+
+    if (!s->io_q.plugged && !QSIMPLEQ_EMPTY(&s->io_q.pending)) {
+        ioq_submit(s);
+    }
+    aio_context_release(s->aio_context);
+}
+
+static void qemu_luring_completion_bh(void *opaque)
+{
+    LuringState *s = opaque;
+
+    luring_process_completions_and_submit(s);
+}
+
+static void qemu_luring_completion_cb(void *opaque)
+{
+    LuringState *s = opaque;
+
+    luring_process_completions_and_submit(s);
+}
+
+static bool qemu_luring_poll_cb(void *opaque)
+{
+    LuringState *s = opaque;
+
+    if (!luring_completions_ready(s)) {
+        return false;
+    }
+
+    luring_process_completions_and_submit(s);
+    return true;
+}
+
+/* Returns the registered region that contains all of @iov, or -1. */
+static int luring_find_fixed(LuringState *s, const struct iovec *iov)
+{
+    uintptr_t start = (uintptr_t)iov->iov_base;
+    unsigned int i;
+
+    for (i = 0; i < s->nr_fixed; i++) {
+        uintptr_t base = (uintptr_t)s->fixed[i].iov_base;
+
+        if (start >= base &&
+            start + iov->iov_len <= base + s->fixed[i].iov_len) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void luring_prep_sqe(LuringState *s, LuringAIOCB *req)
+{
+    struct io_uring_sqe *sqe = &s->sq.sqes[s->sq.tail & *s->sq.kring_mask];
+    bool is_read = req->type == QEMU_AIO_READ;
+    const struct iovec *iov;
+    int niov, buf_index = -1;
+
+    if (req->bounce) {
+        req->bounce_iov.iov_base = req->bounce + req->done;
+        req->bounce_iov.iov_len = req->qiov->size - req->done;
+        iov = &req->bounce_iov;
+        niov = 1;
+    } else {
+        QEMUIOVector *qiov = req->done ? &req->resubmit_qiov : req->qiov;
+
+        iov = qiov->iov;
+        niov = qiov->niov;
+    }
+    if (niov == 1) {
+        buf_index = luring_find_fixed(s, iov);
+    }
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->fd = req->fd;
+    sqe->off = req->offset + req->done;
+    sqe->user_data = (uintptr_t)req;
+
+    if (buf_index >= 0) {
+        /* The kernel does not need to pin the pages again. */
+        sqe->opcode = is_read ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+        sqe->addr = (uintptr_t)iov->iov_base;
+        sqe->len = iov->iov_len;
+        sqe->buf_index = buf_index;
+    } else {
+        sqe->opcode = is_read ? IORING_OP_READV : IORING_OP_WRITEV;
+        sqe->addr = (uintptr_t)iov;
+        sqe->len = niov;
+    }
+
+    s->sq.tail++;
+}
+
+/*
+ * Hands all queued submission entries to the kernel with one system call.
+ * Returns the number it took, or a negative errno.
+ */
+static int luring_enter(LuringState *s)
+{
+    unsigned to_submit;
+    int ret;
+
+    atomic_store_release(s->sq.ktail, s->sq.tail);
+    to_submit = s->sq.tail - atomic_load_acquire(s->sq.khead);
+    if (!to_submit) {
+        return 0;
+    }
+
+    do {
+        ret = sys_io_uring_enter(s->ring_fd, to_submit, 0, 0);
+    } while (ret < 0 && errno == EINTR);
+    return ret < 0 ? -errno : ret;
+}
+
+/*
+ * Takes the entries the kernel did not consume back out of the submission
+ * ring, and puts their requests back at the front of the queue in order.
+ * Without SQPOLL the kernel only reads the ring in io_uring_enter(), so
+ * they can't be picked up behind our back.
+ */
+static void luring_requeue_unsubmitted(LuringState *s)
+{
+    unsigned head = atomic_load_acquire(s->sq.khead);
+
+    while (s->sq.tail != head) {
+        struct io_uring_sqe *sqe;
+        LuringAIOCB *req;
+
+        s->sq.tail--;
+        sqe = &s->sq.sqes[s->sq.tail & *s->sq.kring_mask];
+        req = (LuringAIOCB *)(uintptr_t)sqe->user_data;
+        QSIMPLEQ_INSERT_HEAD(&s->io_q.pending, req, next);
+        s->io_q.in_queue++;
+        s->io_q.in_flight--;
+    }
+    atomic_store_release(s->sq.ktail, s->sq.tail);
+}
+
+static void ioq_fail_pending(LuringState *s, int ret)
+{
+    LuringAIOCB *req;
+
+    while ((req = QSIMPLEQ_FIRST(&s->io_q.pending)) != NULL) {
+        QSIMPLEQ_REMOVE_HEAD(&s->io_q.pending, next);
+        s->io_q.in_queue--;
+        luring_process_completion(s, req, ret);
+    }
+}
+
+static void ioq_submit(LuringState *s)
+{
+    LuringAIOCB *req;
+    int ret;
+
+    do {
+        while (s->io_q.in_flight < MAX_ENTRIES &&
+               (req = QSIMPLEQ_FIRST(&s->io_q.pending)) != NULL) {
+            QSIMPLEQ_REMOVE_HEAD(&s->io_q.pending, next);
+            s->io_q.in_queue--;
+            s->io_q.in_flight++;
+            luring_prep_sqe(s, req);
+        }
+
+        ret = luring_enter(s);
+        luring_requeue_unsubmitted(s);
+        if (!s->io_q.in_flight) {
+            /* No completion is coming to submit the queue again later, so
+             * fail what the kernel refused instead of leaving it hanging.
+             */
+            ioq_fail_pending(s, ret < 0 ? ret : -EIO);
+            break;
+        }
+        if (ret < 0) {
+            /* EAGAIN or EBUSY: the kernel is short of resources until some
+             * of the requests in flight complete.  The completion handler
+             * submits the queue again then.
+             */
+            break;
+        }
+
+        /* We can try to complete something just right away if there are
+         * still requests in-flight.  This may queue the rest of short reads
+         * again, which we then submit in the next iteration.
+         */
+        luring_process_completions(s);
+    } while (s->io_q.in_queue && s->io_q.in_flight < MAX_ENTRIES);
+    s->io_q.blocked = (s->io_q.in_queue > 0);
+}
+
+void luring_io_plug(BlockDriverState *bs, LuringState *s)
+{
+    s->io_q.plugged++;
+}
+
+void luring_io_unplug(BlockDriverState *bs, LuringState *s)
+{
+    assert(s->io_q.plugged);
+    if (--s->io_q.plugged == 0 &&
+        !s->io_q.blocked && !QSIMPLEQ_EMPTY(&s->io_q.pending)) {
+        ioq_submit(s);
+    }
+}
+
+int coroutine_fn luring_co_submit(BlockDriverState *bs, LuringState *s, int fd,
+                                  uint64_t offset, QEMUIOVector *qiov,
+                                  int type)
+{
+    int ret;
+    LuringAIOCB req = {
+        .co         = qemu_coroutine_self(),
+        .s          = s,
+        .fd         = fd,
+        .offset     = offset,
+        .type       = type & QEMU_AIO_TYPE_MASK,
+        .qiov       = qiov,
+        .ret        = -EINPROGRESS,
+        .bounce_slot = -1,
+    };
+
+    if (req.type != QEMU_AIO_READ && req.type != QEMU_AIO_WRITE) {
+        fprintf(stderr, "%s: invalid AIO request type 0x%x.\n",
+                        __func__, type);
+        return -EIO;
+    }
+
+    if (type & QEMU_AIO_MISALIGNED) {
+        ret = luring_get_bounce(bs, s, &req);
+        if (ret < 0) {
+            return ret;
+        }
+    }
+
+    QSIMPLEQ_INSERT_TAIL(&s->io_q.pending, &req, next);
+    s->io_q.in_queue++;
+    if (!s->io_q.blocked &&
+        (!s->io_q.plugged ||
+         s->io_q.in_flight + s->io_q.in_queue >= MAX_ENTRIES)) {
+        ioq_submit(s);
+    }
+
+    if (req.ret == -EINPROGRESS) {
+        qemu_coroutine_yield();
+    }
+    return req.ret;
+}
+
+void luring_detach_aio_context(LuringState *s, AioContext *old_context)
+{
+    aio_set_fd_handler(old_context, s->ring_fd, false, NULL, NULL, NULL,
+                       NULL);
+    qemu_bh_delete(s->completion_bh);
+    s->aio_context = NULL;
+}
+
+void luring_attach_aio_context(LuringState *s, AioContext *new_context)
+{
+    s->aio_context = new_context;
+    s->completion_bh = aio_bh_new(new_context, qemu_luring_completion_bh, s);
+    aio_set_fd_handler(new_context, s->ring_fd, false,
+                       qemu_luring_completion_cb, NULL,
+                       qemu_luring_poll_cb, s);
+}
+
+/*
+ * The kernel only knows how to replace the whole set of fixed buffers, so
+ * this must not be called while requests are in flight.
+ */
+static int luring_update_fixed(LuringState *s)
+{
+    if (sys_io_uring_register(s->ring_fd, IORING_UNREGISTER_BUFFERS,
+                              NULL, 0) < 0 && errno != ENXIO) {
+        return -errno;
+    }
+    if (s->nr_fixed &&
+        sys_io_uring_register(s->ring_fd, IORING_REGISTER_BUFFERS,
+                              s->fixed, s->nr_fixed) < 0) {
+        return -errno;
+    }
+    return 0;
+}
+
+static int luring_add_fixed(LuringState *s, void *host, size_t size)
+{
+    int ret;
+
+    if (s->nr_fixed == MAX_FIXED_BUFFERS) {
+        return -ENOBUFS;
+    }
+    s->fixed[s->nr_fixed].iov_base = host;
+    s->fixed[s->nr_fixed].iov_len = size;
+    s->nr_fixed++;
+
+    /* This counts against RLIMIT_MEMLOCK, so it is allowed to fail. */
+    ret = luring_update_fixed(s);
+    if (ret < 0) {
+        s->nr_fixed--;
+        luring_update_fixed(s);
+    }
+    return ret;
+}
+
+void luring_register_buf(LuringState *s, void *host, size_t size)
+{
+    int ret = luring_add_fixed(s, host, size);
+
+    if (ret < 0) {
+        warn_report("io_uring: cannot register buffer for fixed I/O: %s",
+                    strerror(-ret));
+    }
+}
+
+void luring_unregister_buf(LuringState *s, void *host)
+{
+    unsigned int i;
+
+    for (i = 0; i < s->nr_fixed; i++) {
+        if (s->fixed[i].iov_base == host) {
+            s->nr_fixed--;
+            memmove(&s->fixed[i], &s->fixed[i + 1],
+                    (s->nr_fixed - i) * sizeof(s->fixed[0]));
+            luring_update_fixed(s);
+            return;
+        }
+    }
+}
+
+static void luring_unmap_rings(LuringState *s)
+{
+    if (s->sq.sqes) {
+        munmap(s->sq.sqes, s->sq.sqes_size);
+    }
+    if (s->sq.ring) {
+        munmap(s->sq.ring, s->sq.ring_size);
+    }
+    if (s->cq.ring) {
+        munmap(s->cq.ring, s->cq.ring_size);
+    }
+}
+
+static void *luring_mmap(LuringState *s, size_t size, off_t offset)
+{
+    void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, s->ring_fd, offset);
+
+    return ptr == MAP_FAILED ? NULL : ptr;
+}
+
+LuringState *luring_init(Error **errp)
+{
+    LuringState *s;
+    struct io_uring_params p;
+    unsigned i;
+
+    s = g_malloc0(sizeof(*s));
+    memset(&p, 0, sizeof(p));
+    s->ring_fd = sys_io_uring_setup(MAX_ENTRIES, &p);
+    if (s->ring_fd < 0) {
+        /* ENOSYS before Linux 5.1, or io_uring disabled by a sandbox. */
+        error_setg_errno(errp, errno, "failed to create linux io_uring ring");
+        g_free(s);
+        return NULL;
+    }
+
+    s->sq.ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    s->sq.sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    s->cq.ring_size = p.cq_off.cqes +
+                      p.cq_entries * sizeof(struct io_uring_cqe);
+    s->sq.ring = luring_mmap(s, s->sq.ring_size, IORING_OFF_SQ_RING);
+    s->sq.sqes = luring_mmap(s, s->sq.sqes_size, IORING_OFF_SQES);
+    s->cq.ring = luring_mmap(s, s->cq.ring_size, IORING_OFF_CQ_RING);
+    if (!s->sq.ring || !s->sq.sqes || !s->cq.ring) {
+        error_setg_errno(errp, errno, "failed to map linux io_uring ring");
+        luring_unmap_rings(s);
+        close(s->ring_fd);
+        g_free(s);
+        return NULL;
+    }
+
+    s->sq.khead = s->sq.ring + p.sq_off.head;
+    s->sq.ktail = s->sq.ring + p.sq_off.tail;
+    s->sq.kring_mask = s->sq.ring + p.sq_off.ring_mask;
+    s->sq.karray = s->sq.ring + p.sq_off.array;
+    s->sq.tail = *s->sq.ktail;
+    s->cq.khead = s->cq.ring + p.cq_off.head;
+    s->cq.ktail = s->cq.ring + p.cq_off.tail;
+    s->cq.kring_mask = s->cq.ring + p.cq_off.ring_mask;
+    s->cq.cqes = s->cq.ring + p.cq_off.cqes;
+
+    /* Submission entries are always used in ring order. */
+    for (i = 0; i < p.sq_entries; i++) {
+        s->sq.karray[i] = i;
+    }
+
+    s->bounce_buffers = qemu_memalign(qemu_real_host_page_size,
+                                      BOUNCE_BUFFERS * BOUNCE_BUFFER_SIZE);
+    s->bounce_free = (1u << BOUNCE_BUFFERS) - 1;
+    luring_add_fixed(s, s->bounce_buffers,
+                     BOUNCE_BUFFERS * BOUNCE_BUFFER_SIZE);
+
+    QSIMPLEQ_INIT(&s->io_q.pending);
+    return s;
+}
+
+void luring_cleanup(LuringState *s)
+{
+    luring_unmap_rings(s);
+    close(s->ring_fd);
+    qemu_vfree(s->bounce_buffers);
+    g_free(s);
+}
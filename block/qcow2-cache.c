@@ -28,6 +28,18 @@
 #include "qcow2.h"
 #include "trace.h"
 
+/*
+ * An adaptive cache reconsiders its size after this many lookups: it doubles
+ * when it evicts tables and misses more than one lookup in
+ * QCOW2_CACHE_GROW_MISS_RATIO, and halves when less than a quarter of its
+ * entries were used.
+ */
+#define QCOW2_CACHE_ADAPT_INTERVAL 512
+#define QCOW2_CACHE_GROW_MISS_RATIO 16
+
+/* Fraction of its maximum size an adaptive cache starts with */
+#define QCOW2_CACHE_INITIAL_RATIO 8
+
 typedef struct Qcow2CachedTable {
     int64_t  offset;
     uint64_t lru_counter;
@@ -39,11 +51,22 @@ struct Qcow2Cache {
     Qcow2CachedTable       *entries;
     struct Qcow2Cache      *depends;
     int                     size;
+    int                     min_size;
+    int                     max_size;
     int                     table_size;
     bool                    depends_on_flush;
     void                   *table_array;
     uint64_t                lru_counter;
     uint64_t                cache_clean_lru_counter;
+
+    uint64_t                hits;
+    uint64_t                misses;
+
+    /* Activity since the last resize decision of an adaptive cache */
+    int                     adapt_lookups;
+    int                     adapt_misses;
+    int                     adapt_evictions;
+    uint64_t                adapt_lru_counter;
 };
 
 static inline void *qcow2_cache_get_table_addr(Qcow2Cache *c, int table)
@@ -120,23 +143,29 @@ void qcow2_cache_clean_unused(Qcow2Cache *c)
     c->cache_clean_lru_counter = c->lru_counter;
 }
 
-Qcow2Cache *qcow2_cache_create(BlockDriverState *bs, int num_tables,
-                               unsigned table_size)
+static Qcow2Cache *qcow2_cache_do_create(BlockDriverState *bs, int num_tables,
+                                         int min_tables, int max_tables,
+                                         unsigned table_size)
 {
     BDRVQcow2State *s = bs->opaque;
     Qcow2Cache *c;
 
-    assert(num_tables > 0);
+    assert(min_tables > 0);
+    assert(min_tables <= num_tables && num_tables <= max_tables);
     assert(is_power_of_2(table_size));
     assert(table_size >= (1 << MIN_CLUSTER_BITS));
     assert(table_size <= s->cluster_size);
 
+    /* Only the first num_tables entries are used, and thus touched, at first;
+     * the rest of the array stays unbacked until the cache grows. */
     c = g_new0(Qcow2Cache, 1);
     c->size = num_tables;
+    c->min_size = min_tables;
+    c->max_size = max_tables;
     c->table_size = table_size;
-    c->entries = g_try_new0(Qcow2CachedTable, num_tables);
+    c->entries = g_try_new0(Qcow2CachedTable, max_tables);
     c->table_array = qemu_try_blockalign(bs->file->bs,
-                                         (size_t) num_tables * c->table_size);
+                                         (size_t) max_tables * c->table_size);
 
     if (!c->entries || !c->table_array) {
         qemu_vfree(c->table_array);
@@ -148,11 +177,27 @@ Qcow2Cache *qcow2_cache_create(BlockDriverState *bs, int num_tables,
     return c;
 }
 
+Qcow2Cache *qcow2_cache_create(BlockDriverState *bs, int num_tables,
+                               unsigned table_size)
+{
+    return qcow2_cache_do_create(bs, num_tables, num_tables, num_tables,
+                                 table_size);
+}
+
+Qcow2Cache *qcow2_cache_create_adaptive(BlockDriverState *bs, int min_tables,
+                                        int max_tables, unsigned table_size)
+{
+    int num_tables = MAX(min_tables, max_tables / QCOW2_CACHE_INITIAL_RATIO);
+
+    return qcow2_cache_do_create(bs, num_tables, min_tables, max_tables,
+                                 table_size);
+}
+
 int qcow2_cache_destroy(Qcow2Cache *c)
 {
     int i;
 
-    for (i = 0; i < c->size; i++) {
+    for (i = 0; i < c->max_size; i++) {
         assert(c->entries[i].ref == 0);
     }
 
@@ -318,6 +363,97 @@ int qcow2_cache_empty(BlockDriverState *bs, Qcow2Cache *c)
     return 0;
 }
 
+static bool qcow2_cache_entry_is_hot(Qcow2Cache *c, int i)
+{
+    return c->entries[i].ref > 0 ||
+           c->entries[i].lru_counter > c->adapt_lru_counter;
+}
+
+/*
+ * Drop the entries from new_size on, keeping those that are in use or dirty
+ * (new_size is raised above them) and moving recently used tables to slots
+ * that are free or have not been used since the last resize decision.
+ */
+static void qcow2_cache_shrink(Qcow2Cache *c, int new_size)
+{
+    int i, j = 0;
+
+    for (i = new_size; i < c->size; i++) {
+        if (c->entries[i].ref > 0 || c->entries[i].dirty) {
+            new_size = i + 1;
+        }
+    }
+    if (new_size >= c->size) {
+        return;
+    }
+
+    for (i = new_size; i < c->size; i++) {
+        if (!c->entries[i].offset || !qcow2_cache_entry_is_hot(c, i)) {
+            continue;
+        }
+        while (j < new_size && c->entries[j].offset &&
+               (c->entries[j].dirty || qcow2_cache_entry_is_hot(c, j))) {
+            j++;
+        }
+        if (j == new_size) {
+            break;
+        }
+        memcpy(qcow2_cache_get_table_addr(c, j),
+               qcow2_cache_get_table_addr(c, i), c->table_size);
+        c->entries[j] = c->entries[i];
+        j++;
+    }
+
+    for (i = new_size; i < c->size; i++) {
+        c->entries[i].offset = 0;
+        c->entries[i].lru_counter = 0;
+    }
+    qcow2_cache_table_release(c, new_size, c->size - new_size);
+    c->size = new_size;
+}
+
+static void qcow2_cache_adapt(Qcow2Cache *c)
+{
+    int used = 0;
+    int i;
+
+    for (i = 0; i < c->size; i++) {
+        if (c->entries[i].offset && qcow2_cache_entry_is_hot(c, i)) {
+            used++;
+        }
+    }
+
+    if (c->adapt_evictions > 0 && c->size < c->max_size &&
+        c->adapt_misses * QCOW2_CACHE_GROW_MISS_RATIO > c->adapt_lookups) {
+        /* The new entries are empty: they were never used, or cleared when
+         * the cache last shrank */
+        c->size = MIN(c->max_size, c->size * 2);
+    } else if (used * 4 < c->size && c->size > c->min_size) {
+        qcow2_cache_shrink(c, MAX(c->min_size, MAX(used * 2, c->size / 2)));
+    }
+
+    c->adapt_lookups = 0;
+    c->adapt_misses = 0;
+    c->adapt_evictions = 0;
+    c->adapt_lru_counter = c->lru_counter;
+}
+
+void qcow2_cache_reserve(Qcow2Cache *c, int num_tables)
+{
+    c->size = MAX(c->size, MIN(num_tables, c->max_size));
+}
+
+Qcow2CacheStats *qcow2_cache_get_stats(Qcow2Cache *c)
+{
+    Qcow2CacheStats *stats = g_new0(Qcow2CacheStats, 1);
+
+    stats->size = (int64_t) c->size * c->table_size;
+    stats->max_size = (int64_t) c->max_size * c->table_size;
+    stats->hits = c->hits;
+    stats->misses = c->misses;
+    return stats;
+}
+
 static int qcow2_cache_do_get(BlockDriverState *bs, Qcow2Cache *c,
     uint64_t offset, void **table, bool read_from_disk)
 {
@@ -340,11 +476,20 @@ static int qcow2_cache_do_get(BlockDriverState *bs, Qcow2Cache *c,
         return -EIO;
     }
 
+    if (c->max_size > c->min_size &&
+        c->adapt_lookups >= QCOW2_CACHE_ADAPT_INTERVAL) {
+        qcow2_cache_adapt(c);
+    }
+    c->adapt_lookups++;
+
     /* Check if the table is already cached */
     i = lookup_index = (offset / c->table_size * 4) % c->size;
     do {
         const Qcow2CachedTable *t = &c->entries[i];
         if (t->offset == offset) {
+            if (read_from_disk) {
+                c->hits++;
+            }
             goto found;
         }
         if (t->ref == 0 && t->lru_counter < min_lru_counter) {
@@ -372,6 +517,14 @@ static int qcow2_cache_do_get(BlockDriverState *bs, Qcow2Cache *c,
         return ret;
     }
 
+    if (c->entries[i].offset) {
+        c->adapt_evictions++;
+    }
+    if (read_from_disk) {
+        c->misses++;
+        c->adapt_misses++;
+    }
+
     trace_qcow2_cache_get_read(qemu_coroutine_self(),
                                c == s->l2_table_cache, i);
     c->entries[i].offset = 0;
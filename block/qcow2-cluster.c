@@ -214,6 +214,10 @@ static int l2_load(BlockDriverState *bs, uint64_t offset,
     int start_of_slice = sizeof(uint64_t) *
         (offset_to_l2_index(s, offset) - offset_to_l2_slice_index(s, offset));
 
+    if (s->boot_trace_recording) {
+        qcow2_boot_trace_record(bs, offset);
+    }
+
     return qcow2_cache_get(bs, s->l2_table_cache, l2_offset + start_of_slice,
                            (void **)l2_slice);
 }
@@ -68,6 +68,7 @@ typedef struct {
 #define  QCOW2_EXT_MAGIC_FEATURE_TABLE 0x6803f857
 #define  QCOW2_EXT_MAGIC_CRYPTO_HEADER 0x0537be77
 #define  QCOW2_EXT_MAGIC_BITMAPS 0x23852875
+#define  QCOW2_EXT_MAGIC_BOOT_TRACE 0x6c327066
 
 static int qcow2_probe(const uint8_t *buf, int buf_size, const char *filename)
 {
@@ -383,6 +384,53 @@ static int qcow2_read_extensions(BlockDriverState *bs, uint64_t start_offset,
 #endif
             break;
 
+        case QCOW2_EXT_MAGIC_BOOT_TRACE:
+        {
+            Qcow2BootTraceHeaderExt boot_trace_ext;
+            uint32_t i;
+
+            /* The boot trace is only a hint, so drop it if it is invalid */
+            if (ext.len < sizeof(boot_trace_ext)) {
+                warn_report("Ignoring boot trace extension of invalid length");
+                break;
+            }
+
+            ret = bdrv_pread(bs->file, offset, &boot_trace_ext,
+                             sizeof(boot_trace_ext));
+            if (ret < 0) {
+                error_setg_errno(errp, -ret, "boot_trace_ext: "
+                                 "Could not read ext header");
+                return ret;
+            }
+
+            be32_to_cpus(&boot_trace_ext.nb_entries);
+            if (boot_trace_ext.nb_entries > QCOW2_BOOT_TRACE_MAX_ENTRIES ||
+                ext.len != sizeof(boot_trace_ext) +
+                           boot_trace_ext.nb_entries * sizeof(uint32_t) ||
+                boot_trace_ext.granularity_bits < MIN_CLUSTER_BITS ||
+                boot_trace_ext.granularity_bits > 63) {
+                warn_report("Ignoring invalid boot trace extension");
+                break;
+            }
+
+            g_free(s->boot_trace);
+            s->boot_trace = g_new(uint32_t, boot_trace_ext.nb_entries);
+            s->boot_trace_size = boot_trace_ext.nb_entries;
+            s->boot_trace_granularity = boot_trace_ext.granularity_bits;
+            ret = bdrv_pread(bs->file, offset + sizeof(boot_trace_ext),
+                             s->boot_trace,
+                             s->boot_trace_size * sizeof(uint32_t));
+            if (ret < 0) {
+                error_setg_errno(errp, -ret, "boot_trace_ext: "
+                                 "Could not read boot trace");
+                return ret;
+            }
+            for (i = 0; i < s->boot_trace_size; i++) {
+                be32_to_cpus(&s->boot_trace[i]);
+            }
+            break;
+        }
+
         default:
             /* unknown magic - save it in case we need to rewrite the header */
             /* If you add a new feature, make sure to also update the fast
@@ -695,6 +743,18 @@ static QemuOptsList qcow2_runtime_opts = {
             .type = QEMU_OPT_SIZE,
             .help = "Maximum refcount block cache size",
         },
+        {
+            .name = QCOW2_OPT_CACHE_ADAPTIVE,
+            .type = QEMU_OPT_BOOL,
+            .help = "Grow and shrink the metadata caches with the working "
+                    "set, up to their configured sizes",
+        },
+        {
+            .name = QCOW2_OPT_L2_PREFETCH,
+            .type = QEMU_OPT_BOOL,
+            .help = "Record the L2 tables used while booting and prefetch "
+                    "them when the image is opened again",
+        },
         {
             .name = QCOW2_OPT_CACHE_CLEAN_INTERVAL,
             .type = QEMU_OPT_NUMBER,
@@ -760,6 +820,223 @@ static void qcow2_attach_aio_context(BlockDriverState *bs,
     cache_clean_timer_init(bs, new_context);
 }
 
+static int qcow2_boot_trace_granularity(BDRVQcow2State *s)
+{
+    return s->cluster_bits + ctz32(s->l2_slice_size);
+}
+
+static void qcow2_boot_trace_start(BlockDriverState *bs)
+{
+    BDRVQcow2State *s = bs->opaque;
+
+    s->boot_trace_recording = g_hash_table_new(NULL, NULL);
+    s->boot_trace_deadline = qemu_clock_get_ms(QEMU_CLOCK_REALTIME) +
+                             QCOW2_BOOT_TRACE_MS;
+}
+
+static int boot_trace_entry_cmp(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+/* Stops recording and replaces the stored boot trace if the new one differs */
+static void qcow2_boot_trace_finish(BlockDriverState *bs)
+{
+    BDRVQcow2State *s = bs->opaque;
+    GHashTableIter iter;
+    gpointer key;
+    uint32_t *trace;
+    uint32_t size = 0;
+    int granularity = qcow2_boot_trace_granularity(s);
+
+    if (!s->boot_trace_recording) {
+        return;
+    }
+
+    trace = g_new(uint32_t, g_hash_table_size(s->boot_trace_recording));
+    g_hash_table_iter_init(&iter, s->boot_trace_recording);
+    while (g_hash_table_iter_next(&iter, &key, NULL)) {
+        trace[size++] = GPOINTER_TO_UINT(key);
+    }
+    g_hash_table_destroy(s->boot_trace_recording);
+    s->boot_trace_recording = NULL;
+    qsort(trace, size, sizeof(*trace), boot_trace_entry_cmp);
+
+    /* Keep the old trace if the guest did not get to do anything */
+    if (size == 0 ||
+        (size == s->boot_trace_size &&
+         granularity == s->boot_trace_granularity &&
+         !memcmp(trace, s->boot_trace, size * sizeof(*trace)))) {
+        g_free(trace);
+        return;
+    }
+
+    g_free(s->boot_trace);
+    s->boot_trace = trace;
+    s->boot_trace_size = size;
+    s->boot_trace_granularity = granularity;
+    s->boot_trace_dirty = true;
+}
+
+static void coroutine_fn qcow2_boot_trace_store_entry(void *opaque)
+{
+    BlockDriverState *bs = opaque;
+    BDRVQcow2State *s = bs->opaque;
+    int ret;
+
+    qemu_co_mutex_lock(&s->lock);
+    if (s->boot_trace_dirty && !bdrv_is_read_only(bs) &&
+        !(bdrv_get_flags(bs) & BDRV_O_INACTIVE)) {
+        ret = qcow2_update_header(bs);
+        if (ret < 0) {
+            warn_report("Could not store the qcow2 boot trace: %s",
+                        strerror(-ret));
+        }
+        s->boot_trace_dirty = false;
+    }
+    qemu_co_mutex_unlock(&s->lock);
+    bdrv_dec_in_flight(bs);
+}
+
+/* Called with s->lock held from l2_load() while the boot trace is recorded */
+void qcow2_boot_trace_record(BlockDriverState *bs, uint64_t offset)
+{
+    BDRVQcow2State *s = bs->opaque;
+    uint64_t region = offset >> qcow2_boot_trace_granularity(s);
+
+    if (qemu_clock_get_ms(QEMU_CLOCK_REALTIME) >= s->boot_trace_deadline) {
+        qcow2_boot_trace_finish(bs);
+        if (s->boot_trace_dirty) {
+            /* The header is rewritten once the current request lets go of
+             * s->lock */
+            bdrv_inc_in_flight(bs);
+            aio_co_schedule(bdrv_get_aio_context(bs),
+                            qemu_coroutine_create(qcow2_boot_trace_store_entry,
+                                                  bs));
+        }
+        return;
+    }
+
+    if (region <= UINT32_MAX &&
+        g_hash_table_size(s->boot_trace_recording) <
+        QCOW2_BOOT_TRACE_MAX_ENTRIES) {
+        g_hash_table_insert(s->boot_trace_recording,
+                            GUINT_TO_POINTER(region), NULL);
+    }
+}
+
+typedef struct Qcow2PrefetchCo {
+    BlockDriverState *bs;
+    uint32_t *trace;
+    uint32_t trace_size;
+    int granularity;
+} Qcow2PrefetchCo;
+
+/* Called with s->lock held */
+static int coroutine_fn qcow2_prefetch_l2_slice(BlockDriverState *bs,
+                                                uint64_t offset)
+{
+    BDRVQcow2State *s = bs->opaque;
+    int l1_index = offset_to_l1_index(s, offset);
+    uint64_t l2_offset, slice_offset;
+    uint64_t *l2_slice;
+    int ret;
+
+    if (l1_index >= s->l1_size) {
+        return 0;
+    }
+    l2_offset = s->l1_table[l1_index] & L1E_OFFSET_MASK;
+    if (!l2_offset || offset_into_cluster(s, l2_offset)) {
+        /* Unallocated, or corrupt and left for the regular path to report */
+        return 0;
+    }
+
+    slice_offset = l2_offset + sizeof(uint64_t) *
+        (offset_to_l2_index(s, offset) - offset_to_l2_slice_index(s, offset));
+    if (qcow2_cache_is_table_offset(s->l2_table_cache, slice_offset)) {
+        return 0;
+    }
+
+    ret = qcow2_cache_get(bs, s->l2_table_cache, slice_offset,
+                          (void **) &l2_slice);
+    if (ret < 0) {
+        return ret;
+    }
+    qcow2_cache_put(s->l2_table_cache, (void **) &l2_slice);
+    s->prefetched_l2_slices++;
+    return 0;
+}
+
+/*
+ * Reads the L2 slices of the regions in the boot trace into the L2 cache, one
+ * at a time so that guest requests can take s->lock in between.  Stops early
+ * when the node is drained.
+ */
+static void coroutine_fn qcow2_co_prefetch_l2(void *opaque)
+{
+    Qcow2PrefetchCo *pco = opaque;
+    BlockDriverState *bs = pco->bs;
+    BDRVQcow2State *s = bs->opaque;
+    uint64_t slice_bytes = (uint64_t) s->l2_slice_size << s->cluster_bits;
+    uint64_t disk_size = bs->total_sectors * BDRV_SECTOR_SIZE;
+    uint64_t start, end, offset;
+    uint32_t i;
+    int ret = 0;
+
+    for (i = 0; i < pco->trace_size && ret >= 0; i++) {
+        start = (uint64_t) pco->trace[i] << pco->granularity;
+        end = MIN(start + (1ULL << pco->granularity), disk_size);
+
+        for (offset = QEMU_ALIGN_DOWN(start, slice_bytes);
+             offset < end && ret >= 0; offset += slice_bytes)
+        {
+            if (atomic_read(&bs->quiesce_counter)) {
+                goto out;
+            }
+            qemu_co_mutex_lock(&s->lock);
+            ret = qcow2_prefetch_l2_slice(bs, offset);
+            qemu_co_mutex_unlock(&s->lock);
+        }
+    }
+
+out:
+    g_free(pco->trace);
+    g_free(pco);
+    bdrv_dec_in_flight(bs);
+}
+
+static void qcow2_prefetch_l2_start(BlockDriverState *bs)
+{
+    BDRVQcow2State *s = bs->opaque;
+    Qcow2PrefetchCo *pco;
+    int slice_granularity = qcow2_boot_trace_granularity(s);
+    uint64_t slices;
+
+    /* Make room for the whole trace if the cache is adaptive */
+    slices = s->boot_trace_size;
+    if (s->boot_trace_granularity > slice_granularity) {
+        slices <<= MIN(s->boot_trace_granularity - slice_granularity, 32);
+    }
+    qcow2_cache_reserve(s->l2_table_cache, MIN(slices, INT_MAX));
+
+    /* The stored trace may be replaced while the prefetch runs */
+    pco = g_new(Qcow2PrefetchCo, 1);
+    *pco = (Qcow2PrefetchCo) {
+        .bs             = bs,
+        .trace          = g_memdup(s->boot_trace,
+                                   s->boot_trace_size * sizeof(uint32_t)),
+        .trace_size     = s->boot_trace_size,
+        .granularity    = s->boot_trace_granularity,
+    };
+
+    bdrv_inc_in_flight(bs);
+    aio_co_schedule(bdrv_get_aio_context(bs),
+                    qemu_coroutine_create(qcow2_co_prefetch_l2, pco));
+}
+
 static void read_cache_sizes(BlockDriverState *bs, QemuOpts *opts,
                              uint64_t *l2_cache_size,
                              uint64_t *l2_cache_entry_size,
@@ -840,6 +1117,8 @@ typedef struct Qcow2ReopenState {
     int overlap_check;
     bool discard_passthrough[QCOW2_DISCARD_MAX];
     uint64_t cache_clean_interval;
+    bool cache_adaptive;
+    bool l2_prefetch;
     QCryptoBlockOpenOptions *crypto_opts; /* Disk encryption runtime options */
 } Qcow2ReopenState;
 
@@ -917,11 +1196,26 @@ static int qcow2_update_options_prepare(BlockDriverState *bs,
         }
     }
 
+    /* With cache-adaptive, the cache sizes are upper bounds */
+    r->cache_adaptive = qemu_opt_get_bool(opts, QCOW2_OPT_CACHE_ADAPTIVE,
+                                          s->cache_adaptive);
+    r->l2_prefetch = qemu_opt_get_bool(opts, QCOW2_OPT_L2_PREFETCH,
+                                       s->l2_prefetch);
+
     r->l2_slice_size = l2_cache_entry_size / sizeof(uint64_t);
-    r->l2_table_cache = qcow2_cache_create(bs, l2_cache_size,
-                                           l2_cache_entry_size);
-    r->refcount_block_cache = qcow2_cache_create(bs, refcount_cache_size,
-                                                 s->cluster_size);
+    if (r->cache_adaptive) {
+        r->l2_table_cache =
+            qcow2_cache_create_adaptive(bs, MIN_L2_CACHE_SIZE, l2_cache_size,
+                                        l2_cache_entry_size);
+        r->refcount_block_cache =
+            qcow2_cache_create_adaptive(bs, MIN_REFCOUNT_CACHE_SIZE,
+                                        refcount_cache_size, s->cluster_size);
+    } else {
+        r->l2_table_cache = qcow2_cache_create(bs, l2_cache_size,
+                                               l2_cache_entry_size);
+        r->refcount_block_cache = qcow2_cache_create(bs, refcount_cache_size,
+                                                     s->cluster_size);
+    }
     if (r->l2_table_cache == NULL || r->refcount_block_cache == NULL) {
         error_setg(errp, "Could not allocate metadata caches");
         ret = -ENOMEM;
@@ -1084,6 +1378,8 @@ static void qcow2_update_options_commit(BlockDriverState *bs,
     s->l2_table_cache = r->l2_table_cache;
     s->refcount_block_cache = r->refcount_block_cache;
     s->l2_slice_size = r->l2_slice_size;
+    s->cache_adaptive = r->cache_adaptive;
+    s->l2_prefetch = r->l2_prefetch;
 
     s->overlap_check = r->overlap_check;
     s->use_lazy_refcounts = r->use_lazy_refcounts;
@@ -1530,6 +1826,15 @@ static int coroutine_fn qcow2_do_open(BlockDriverState *bs, QDict *options,
         }
     }
 
+    if (s->l2_prefetch && !(flags & BDRV_O_INACTIVE)) {
+        if (s->boot_trace_size) {
+            qcow2_prefetch_l2_start(bs);
+        }
+        if (!bs->read_only) {
+            qcow2_boot_trace_start(bs);
+        }
+    }
+
 #ifdef DEBUG_ALLOC
     {
         BdrvCheckResult result = {0};
@@ -1539,6 +1844,8 @@ static int coroutine_fn qcow2_do_open(BlockDriverState *bs, QDict *options,
     return ret;
 
  fail:
+    g_free(s->boot_trace);
+    s->boot_trace = NULL;
     g_free(s->unknown_header_fields);
     cleanup_unknown_header_ext(bs);
     qcow2_free_snapshots(bs);
@@ -2119,6 +2426,16 @@ static int qcow2_inactivate(BlockDriverState *bs)
                      strerror(-ret));
     }
 
+    qcow2_boot_trace_finish(bs);
+    if (s->boot_trace_dirty && !bdrv_is_read_only(bs)) {
+        ret = qcow2_update_header(bs);
+        if (ret < 0) {
+            warn_report("Could not store the qcow2 boot trace: %s",
+                        strerror(-ret));
+        }
+        s->boot_trace_dirty = false;
+    }
+
     if (result == 0) {
         qcow2_mark_clean(bs);
     }
@@ -2150,6 +2467,8 @@ static void qcow2_close(BlockDriverState *bs)
     g_free(s->image_backing_file);
     g_free(s->image_backing_format);
 
+    g_free(s->boot_trace);
+
     g_free(s->cluster_cache);
     qemu_vfree(s->cluster_data);
     qcow2_refcount_close(bs);
@@ -2396,6 +2715,41 @@ int qcow2_update_header(BlockDriverState *bs)
         buflen -= ret;
     }
 
+    /* Boot trace extension, truncated to the room the end of the header
+     * extensions and the backing file name leave */
+    if (s->boot_trace_size) {
+        size_t reserved = sizeof(QCowExtension) +
+            (s->image_backing_file ? strlen(s->image_backing_file) : 0);
+        size_t max_len = buflen > reserved + sizeof(QCowExtension) ?
+                         (buflen - reserved - sizeof(QCowExtension)) & ~7 : 0;
+        Qcow2BootTraceHeaderExt *boot_trace_ext;
+        uint32_t *entries;
+        uint32_t i, nb_entries;
+        size_t len;
+
+        if (max_len > sizeof(*boot_trace_ext)) {
+            nb_entries = MIN(s->boot_trace_size,
+                             (max_len - sizeof(*boot_trace_ext)) /
+                             sizeof(uint32_t));
+            len = sizeof(*boot_trace_ext) + nb_entries * sizeof(uint32_t);
+            boot_trace_ext = g_malloc0(len);
+            boot_trace_ext->nb_entries = cpu_to_be32(nb_entries);
+            boot_trace_ext->granularity_bits = s->boot_trace_granularity;
+            entries = (uint32_t *) (boot_trace_ext + 1);
+            for (i = 0; i < nb_entries; i++) {
+                entries[i] = cpu_to_be32(s->boot_trace[i]);
+            }
+            ret = header_ext_add(buf, QCOW2_EXT_MAGIC_BOOT_TRACE,
+                                 boot_trace_ext, len, buflen);
+            g_free(boot_trace_ext);
+            if (ret < 0) {
+                goto fail;
+            }
+            buf += ret;
+            buflen -= ret;
+        }
+    }
+
     /* End of header extensions */
     ret = header_ext_add(buf, QCOW2_EXT_MAGIC_END, NULL, 0, buflen);
     if (ret < 0) {
@@ -3953,6 +4307,25 @@ static int qcow2_get_info(BlockDriverState *bs, BlockDriverInfo *bdi)
     return 0;
 }
 
+static BlockStatsSpecific *qcow2_get_specific_stats(BlockDriverState *bs)
+{
+    BDRVQcow2State *s = bs->opaque;
+    BlockStatsSpecific *stats = g_new(BlockStatsSpecific, 1);
+
+    *stats = (BlockStatsSpecific){
+        .type  = BLOCK_STATS_SPECIFIC_KIND_QCOW2,
+        .u.qcow2.data = g_new(BlockStatsSpecificQcow2, 1),
+    };
+    *stats->u.qcow2.data = (BlockStatsSpecificQcow2){
+        .l2_cache               = qcow2_cache_get_stats(s->l2_table_cache),
+        .refcount_cache         =
+            qcow2_cache_get_stats(s->refcount_block_cache),
+        .prefetched_l2_slices   = s->prefetched_l2_slices,
+    };
+
+    return stats;
+}
+
 static ImageInfoSpecific *qcow2_get_specific_info(BlockDriverState *bs)
 {
     BDRVQcow2State *s = bs->opaque;
@@ -4527,6 +4900,7 @@ BlockDriver bdrv_qcow2 = {
     .bdrv_measure           = qcow2_measure,
     .bdrv_get_info          = qcow2_get_info,
     .bdrv_get_specific_info = qcow2_get_specific_info,
+    .bdrv_get_specific_stats = qcow2_get_specific_stats,
 
     .bdrv_save_vmstate    = qcow2_save_vmstate,
     .bdrv_load_vmstate    = qcow2_load_vmstate,
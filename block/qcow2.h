@@ -83,6 +83,13 @@
 
 #define DEFAULT_CLUSTER_SIZE 65536
 
+/* L2 slices looked up during this long after open make up the boot trace */
+#define QCOW2_BOOT_TRACE_MS 60000
+
+/* Maximum number of guest regions in the boot trace; the header extension
+ * holding it must also fit in the first cluster together with the others */
+#define QCOW2_BOOT_TRACE_MAX_ENTRIES 4096
+
 
 #define QCOW2_OPT_LAZY_REFCOUNTS "lazy-refcounts"
 #define QCOW2_OPT_DISCARD_REQUEST "pass-discard-request"
@@ -103,6 +110,8 @@
 #define QCOW2_OPT_L2_CACHE_ENTRY_SIZE "l2-cache-entry-size"
 #define QCOW2_OPT_REFCOUNT_CACHE_SIZE "refcount-cache-size"
 #define QCOW2_OPT_CACHE_CLEAN_INTERVAL "cache-clean-interval"
+#define QCOW2_OPT_CACHE_ADAPTIVE "cache-adaptive"
+#define QCOW2_OPT_L2_PREFETCH "l2-prefetch"
 
 typedef struct QCowHeader {
     uint32_t magic;
@@ -248,6 +257,13 @@ typedef struct Qcow2BitmapHeaderExt {
     uint64_t bitmap_directory_offset;
 } QEMU_PACKED Qcow2BitmapHeaderExt;
 
+typedef struct Qcow2BootTraceHeaderExt {
+    uint32_t nb_entries;
+    uint8_t granularity_bits;
+    uint8_t reserved[3];
+    /* followed by nb_entries big endian uint32_t guest region indices */
+} QEMU_PACKED Qcow2BootTraceHeaderExt;
+
 typedef struct BDRVQcow2State {
     int cluster_bits;
     int cluster_size;
@@ -269,6 +285,19 @@ typedef struct BDRVQcow2State {
     Qcow2Cache* refcount_block_cache;
     QEMUTimer *cache_clean_timer;
     unsigned cache_clean_interval;
+    bool cache_adaptive;
+
+    /* Guest regions (of 1 << boot_trace_granularity bytes) whose L2 slices
+     * were looked up while booting, sorted; loaded from and stored in the
+     * boot trace header extension */
+    bool l2_prefetch;
+    uint32_t *boot_trace;
+    uint32_t boot_trace_size;
+    uint8_t boot_trace_granularity;
+    bool boot_trace_dirty;
+    GHashTable *boot_trace_recording;
+    int64_t boot_trace_deadline;
+    uint64_t prefetched_l2_slices;
 
     uint8_t *cluster_cache;
     uint8_t *cluster_data;
@@ -538,6 +567,7 @@ int qcow2_mark_dirty(BlockDriverState *bs);
 int qcow2_mark_corrupt(BlockDriverState *bs);
 int qcow2_mark_consistent(BlockDriverState *bs);
 int qcow2_update_header(BlockDriverState *bs);
+void qcow2_boot_trace_record(BlockDriverState *bs, uint64_t offset);
 
 void qcow2_signal_corruption(BlockDriverState *bs, bool fatal, int64_t offset,
                              int64_t size, const char *message_format, ...)
@@ -647,7 +677,11 @@ int qcow2_read_snapshots(BlockDriverState *bs);
 /* qcow2-cache.c functions */
 Qcow2Cache *qcow2_cache_create(BlockDriverState *bs, int num_tables,
                                unsigned table_size);
+Qcow2Cache *qcow2_cache_create_adaptive(BlockDriverState *bs, int min_tables,
+                                        int max_tables, unsigned table_size);
 int qcow2_cache_destroy(Qcow2Cache *c);
+void qcow2_cache_reserve(Qcow2Cache *c, int num_tables);
+Qcow2CacheStats *qcow2_cache_get_stats(Qcow2Cache *c);
 
 void qcow2_cache_entry_mark_dirty(Qcow2Cache *c, void *table);
 int qcow2_cache_flush(BlockDriverState *bs, Qcow2Cache *c);
@@ -0,0 +1,876 @@
+/*
+ * Host-wide shared read cache for read-only images
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ */
+
+/*
+ * Every emulator instance that boots the same system image reads the same
+ * blocks in roughly the same order.  This filter keeps those blocks in a POSIX
+ * shared memory segment named after the identity of the image file, so that
+ * all instances on the host that open the same image attach to the same
+ * cache and only the first one pays for reading (and, when the filter is put
+ * above a format driver, for decoding) a block.
+ *
+ * The segment is a 4-way set-associative cache of 64 KiB blocks.  Each slot
+ * is protected by a sequence counter, like a QemuSeqLock that is shared
+ * across processes: readers never write to the slot except for the LRU
+ * tick, and retry from the image if the counter changed while they copied
+ * the data out; writers claim a slot by moving the counter from even to odd
+ * with a compare-and-swap, so they do not need a lock either.
+ *
+ * Who uses the segment is tracked with byte-range locks on a lock file in the
+ * temporary directory, rather than with a count in the segment, because the
+ * kernel drops the locks of an instance that crashes or is killed.  The instance that
+ * finds no other users when it attaches or detaches removes the segment.
+ */
+
+#include "qemu/osdep.h"
+#include <sys/mman.h>
+#include "block/block_int.h"
+#include "qapi/error.h"
+#include "qapi/qapi-commands-block-core.h"
+#include "qemu/atomic.h"
+#include "qemu/cutils.h"
+#include "qemu/error-report.h"
+#include "qemu/option.h"
+#include "qemu/stats64.h"
+#include "qemu/timer.h"
+#include "sysemu/block-backend.h"
+
+#define SHARED_CACHE_MAGIC          0x51424c43 /* "QBLC" */
+#define SHARED_CACHE_VERSION        2
+#define SHARED_CACHE_BLOCK_SIZE     (64 * 1024)
+#define SHARED_CACHE_WAYS           4
+#define SHARED_CACHE_HEADER_SIZE    4096
+#define SHARED_CACHE_DEFAULT_SIZE   (256 * 1024 * 1024)
+
+/* Longest run of missing blocks read from the image with one request */
+#define SHARED_CACHE_MAX_RUN        16
+
+/*
+ * Bytes of the lock file.  The first one is held while an instance attaches
+ * or detaches, and every attached node holds one of the others.
+ */
+#define SHARED_CACHE_LOCK_ATTACH    0
+#define SHARED_CACHE_LOCK_USERS     1
+#define SHARED_CACHE_MAX_USERS      256
+
+/* How long to wait for another instance to attach or detach */
+#define SHARED_CACHE_LOCK_TIMEOUT_MS 1000
+
+/*
+ * A slot that stays claimed for this long belongs to a writer that died
+ * before it published the block, and can be claimed again.
+ */
+#define SHARED_CACHE_STALE_CLAIM_SECS 60
+
+#define SHARED_CACHE_OPT_SIZE       "size"
+
+typedef struct SharedCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t block_size;
+    uint32_t nb_sets;
+    uint64_t image_dev;
+    uint64_t image_ino;
+    uint64_t image_size;
+    int64_t image_mtime;
+    uint32_t clock;
+} SharedCacheHeader;
+
+typedef struct SharedCacheSlot {
+    uint32_t key;   /* block index + 1, 0 if the slot is empty */
+    uint32_t tick;  /* value of the header clock when last used */
+    /*
+     * The sequence counter in the low 32 bits, odd while the slot is being
+     * filled; then the time of the claim, in seconds, in the high 32 bits.
+     */
+    uint64_t seq;
+} SharedCacheSlot;
+
+typedef struct BDRVSharedCacheState {
+    char *name;
+    uint64_t image_size;
+
+    /* The lock file, and the byte of it that this node holds */
+    int lock_fd;
+    int user;
+
+    /* NULL if the segment could not be attached; reads pass through then */
+    SharedCacheHeader *hdr;
+    SharedCacheSlot *slots;
+    uint8_t *data;
+    size_t map_size;
+    uint32_t nb_sets;
+
+    Stat64 hits;
+    Stat64 misses;
+    Stat64 inserts;
+} BDRVSharedCacheState;
+
+static QemuOptsList shared_cache_opts = {
+    .name = "shared-cache",
+    .head = QTAILQ_HEAD_INITIALIZER(shared_cache_opts.head),
+    .desc = {
+        {
+            .name = SHARED_CACHE_OPT_SIZE,
+            .type = QEMU_OPT_SIZE,
+            .help = "Size of the shared cache, if this instance creates it",
+        },
+        { /* end of list */ }
+    },
+};
+
+/* FNV-1a, to fit the image identity in a portable shm name */
+static uint64_t shared_cache_hash(const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    while (len--) {
+        hash = (hash ^ *p++) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static size_t shared_cache_slots_size(uint32_t nb_sets)
+{
+    return ROUND_UP((size_t)nb_sets * SHARED_CACHE_WAYS *
+                    sizeof(SharedCacheSlot), SHARED_CACHE_HEADER_SIZE);
+}
+
+static size_t shared_cache_map_size(uint32_t nb_sets)
+{
+    return SHARED_CACHE_HEADER_SIZE + shared_cache_slots_size(nb_sets) +
+           (size_t)nb_sets * SHARED_CACHE_WAYS * SHARED_CACHE_BLOCK_SIZE;
+}
+
+static bool shared_cache_header_matches(SharedCacheHeader *hdr,
+                                        SharedCacheHeader *id)
+{
+    return hdr->version == SHARED_CACHE_VERSION &&
+           hdr->block_size == SHARED_CACHE_BLOCK_SIZE &&
+           hdr->image_dev == id->image_dev &&
+           hdr->image_ino == id->image_ino &&
+           hdr->image_size == id->image_size &&
+           hdr->image_mtime == id->image_mtime;
+}
+
+static char *shared_cache_lock_path(const char *name)
+{
+    return g_strdup_printf("%s%s.lock", g_get_tmp_dir(), name);
+}
+
+/* Lock byte @start of the lock file, waiting for other instances. */
+static int shared_cache_lock(int fd, int64_t start)
+{
+    int i, ret;
+
+    for (i = 0; ; i++) {
+        ret = qemu_lock_fd(fd, start, 1, true);
+        if ((ret != -EAGAIN && ret != -EACCES) ||
+            i == SHARED_CACHE_LOCK_TIMEOUT_MS) {
+            return ret;
+        }
+        g_usleep(1000);
+    }
+}
+
+/*
+ * True if another node holds a user byte.  Our own locks never conflict
+ * with us, so this is false for the last user.
+ */
+static bool shared_cache_has_other_users(int fd)
+{
+    return qemu_lock_fd_test(fd, SHARED_CACHE_LOCK_USERS,
+                             SHARED_CACHE_MAX_USERS, true) < 0;
+}
+
+/* The claim time stored in a slot sequence. */
+static uint32_t shared_cache_now(void)
+{
+    return get_clock() / NANOSECONDS_PER_SECOND;
+}
+
+static void shared_cache_unmap(BDRVSharedCacheState *s)
+{
+    munmap(s->hdr, s->map_size);
+    s->hdr = NULL;
+    s->slots = NULL;
+    s->data = NULL;
+}
+
+/*
+ * Create the segment and initialize its header.  Called with the attach
+ * lock held, so nobody looks at the segment before it is initialized.
+ */
+static int shared_cache_create(BDRVSharedCacheState *s, SharedCacheHeader *id,
+                               uint32_t nb_sets, Error **errp)
+{
+    size_t size = shared_cache_map_size(nb_sets);
+    SharedCacheHeader *hdr;
+    int fd, ret;
+
+    fd = shm_open(s->name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+        error_setg_errno(errp, errno, "Could not create shared cache '%s'",
+                         s->name);
+        return -errno;
+    }
+    if (ftruncate(fd, size) < 0) {
+        error_setg_errno(errp, errno, "Could not resize shared cache");
+        ret = -errno;
+        goto fail;
+    }
+    hdr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (hdr == MAP_FAILED) {
+        error_setg_errno(errp, errno, "Could not map shared cache");
+        ret = -errno;
+        goto fail;
+    }
+    close(fd);
+
+    *hdr = *id;
+    hdr->version = SHARED_CACHE_VERSION;
+    hdr->block_size = SHARED_CACHE_BLOCK_SIZE;
+    hdr->nb_sets = nb_sets;
+    hdr->magic = SHARED_CACHE_MAGIC;
+
+    s->hdr = hdr;
+    s->map_size = size;
+    s->nb_sets = nb_sets;
+    return 0;
+
+fail:
+    close(fd);
+    shm_unlink(s->name);
+    return ret;
+}
+
+/* Attach to a segment that another instance uses. */
+static int shared_cache_open_existing(BDRVSharedCacheState *s,
+                                      SharedCacheHeader *id, Error **errp)
+{
+    SharedCacheHeader *hdr;
+    struct stat st;
+    uint32_t nb_sets;
+    size_t size;
+    int fd, ret;
+
+    fd = shm_open(s->name, O_RDWR, 0600);
+    if (fd < 0) {
+        error_setg_errno(errp, errno, "Could not open shared cache '%s'",
+                         s->name);
+        return -errno;
+    }
+    if (fstat(fd, &st) < 0) {
+        error_setg_errno(errp, errno, "Could not stat shared cache");
+        ret = -errno;
+        goto out;
+    }
+    if (st.st_size < SHARED_CACHE_HEADER_SIZE) {
+        error_setg(errp, "Shared cache '%s' is truncated", s->name);
+        ret = -EINVAL;
+        goto out;
+    }
+
+    hdr = mmap(NULL, SHARED_CACHE_HEADER_SIZE, PROT_READ | PROT_WRITE,
+               MAP_SHARED, fd, 0);
+    if (hdr == MAP_FAILED) {
+        error_setg_errno(errp, errno, "Could not map shared cache");
+        ret = -errno;
+        goto out;
+    }
+    if (hdr->magic != SHARED_CACHE_MAGIC ||
+        !shared_cache_header_matches(hdr, id)) {
+        munmap(hdr, SHARED_CACHE_HEADER_SIZE);
+        error_setg(errp, "Shared cache '%s' belongs to a different image",
+                   s->name);
+        ret = -EINVAL;
+        goto out;
+    }
+    nb_sets = hdr->nb_sets;
+    munmap(hdr, SHARED_CACHE_HEADER_SIZE);
+
+    size = shared_cache_map_size(nb_sets);
+    if ((uint64_t)st.st_size < size) {
+        error_setg(errp, "Shared cache '%s' is truncated", s->name);
+        ret = -EINVAL;
+        goto out;
+    }
+    hdr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (hdr == MAP_FAILED) {
+        error_setg_errno(errp, errno, "Could not map shared cache");
+        ret = -errno;
+        goto out;
+    }
+
+    s->hdr = hdr;
+    s->map_size = size;
+    s->nb_sets = nb_sets;
+    ret = 0;
+out:
+    close(fd);
+    return ret;
+}
+
+static int shared_cache_attach(BDRVSharedCacheState *s, SharedCacheHeader *id,
+                               uint64_t cache_size, Error **errp)
+{
+    uint64_t nb_sets = cache_size /
+                       (SHARED_CACHE_WAYS * SHARED_CACHE_BLOCK_SIZE);
+    char *path;
+    int fd, user, ret;
+
+    if (nb_sets == 0 || nb_sets > UINT32_MAX) {
+        error_setg(errp, "Invalid shared cache size %" PRIu64, cache_size);
+        return -EINVAL;
+    }
+
+    path = shared_cache_lock_path(s->name);
+    fd = qemu_open(path, O_RDWR | O_CREAT, 0600);
+    if (fd < 0) {
+        error_setg_errno(errp, errno, "Could not open '%s'", path);
+        ret = -errno;
+        goto out;
+    }
+    ret = shared_cache_lock(fd, SHARED_CACHE_LOCK_ATTACH);
+    if (ret < 0) {
+        error_setg_errno(errp, -ret, "Could not lock '%s'", path);
+        goto fail;
+    }
+
+    for (user = 0; user < SHARED_CACHE_MAX_USERS; user++) {
+        if (qemu_lock_fd(fd, SHARED_CACHE_LOCK_USERS + user, 1, true) == 0) {
+            break;
+        }
+    }
+    if (user == SHARED_CACHE_MAX_USERS) {
+        error_setg(errp, "Shared cache '%s' has too many users", s->name);
+        ret = -EBUSY;
+        goto fail;
+    }
+
+    if (shared_cache_has_other_users(fd)) {
+        ret = shared_cache_open_existing(s, id, errp);
+    } else {
+        /* Whatever is left is from instances that crashed */
+        shm_unlink(s->name);
+        ret = shared_cache_create(s, id, nb_sets, errp);
+    }
+    if (ret < 0) {
+        goto fail;
+    }
+
+    qemu_unlock_fd(fd, SHARED_CACHE_LOCK_ATTACH, 1);
+    s->lock_fd = fd;
+    s->user = user;
+    s->slots = (SharedCacheSlot *)((uint8_t *)s->hdr +
+                                   SHARED_CACHE_HEADER_SIZE);
+    s->data = (uint8_t *)s->slots + shared_cache_slots_size(s->nb_sets);
+    goto out;
+
+fail:
+    /* Drops our locks */
+    qemu_close(fd);
+out:
+    g_free(path);
+    return ret;
+}
+
+static void shared_cache_detach(BDRVSharedCacheState *s)
+{
+    if (!s->hdr) {
+        return;
+    }
+    /*
+     * If we cannot get the attach lock, the segment stays around; the next
+     * instance to attach or to sweep removes it if it is unused.
+     */
+    if (shared_cache_lock(s->lock_fd, SHARED_CACHE_LOCK_ATTACH) == 0 &&
+        !shared_cache_has_other_users(s->lock_fd)) {
+        shm_unlink(s->name);
+    }
+    qemu_close(s->lock_fd);
+    s->lock_fd = -1;
+    shared_cache_unmap(s);
+}
+
+/*
+ * Remove the segments of other images that nobody uses anymore, because
+ * their last users crashed.  The lock files stay, as another instance may
+ * be about to open one.
+ */
+static void shared_cache_sweep(void)
+{
+    const char *tmpdir = g_get_tmp_dir();
+    const char *entry;
+    GDir *dir;
+
+    /*
+     * Without OFD locks, closing the lock file would drop the locks of our
+     * own nodes on it.
+     */
+    if (!qemu_has_ofd_lock()) {
+        return;
+    }
+    dir = g_dir_open(tmpdir, 0, NULL);
+    if (!dir) {
+        return;
+    }
+    while ((entry = g_dir_read_name(dir))) {
+        char *path, *name;
+        int fd;
+
+        if (!g_str_has_prefix(entry, "qemu-blkcache-") ||
+            !g_str_has_suffix(entry, ".lock")) {
+            continue;
+        }
+        path = g_build_filename(tmpdir, entry, NULL);
+        fd = qemu_open(path, O_RDWR);
+        g_free(path);
+        if (fd < 0) {
+            continue;
+        }
+        if (qemu_lock_fd(fd, SHARED_CACHE_LOCK_ATTACH, 1, true) == 0 &&
+            !shared_cache_has_other_users(fd)) {
+            name = g_strdup_printf("/%.*s", (int)(strlen(entry) -
+                                                  strlen(".lock")), entry);
+            shm_unlink(name);
+            g_free(name);
+        }
+        qemu_close(fd);
+    }
+    g_dir_close(dir);
+}
+
+static SharedCacheSlot *shared_cache_set(BDRVSharedCacheState *s,
+                                         uint64_t index)
+{
+    return &s->slots[(index % s->nb_sets) * SHARED_CACHE_WAYS];
+}
+
+static uint8_t *shared_cache_slot_data(BDRVSharedCacheState *s,
+                                       SharedCacheSlot *slot)
+{
+    return s->data + (size_t)(slot - s->slots) * SHARED_CACHE_BLOCK_SIZE;
+}
+
+/*
+ * Copy the part of block @index that intersects [@offset, @offset + @bytes)
+ * from @buf to the matching place in @qiov.
+ */
+static void shared_cache_copy_block(uint64_t index, const uint8_t *buf,
+                                    uint64_t offset, uint64_t bytes,
+                                    QEMUIOVector *qiov)
+{
+    uint64_t start = index * SHARED_CACHE_BLOCK_SIZE;
+    uint64_t copy_start = MAX(offset, start);
+    uint64_t copy_end = MIN(offset + bytes, start + SHARED_CACHE_BLOCK_SIZE);
+
+    qemu_iovec_from_buf(qiov, copy_start - offset, buf + copy_start - start,
+                        copy_end - copy_start);
+}
+
+/*
+ * Look block @index up and copy it to @qiov on a hit.  If a writer recycles
+ * the slot while we copy, @qiov holds garbage but the caller reads the block
+ * from the image into the same place anyway.
+ */
+static bool shared_cache_lookup(BDRVSharedCacheState *s, uint64_t index,
+                                uint64_t offset, uint64_t bytes,
+                                QEMUIOVector *qiov)
+{
+    SharedCacheSlot *set = shared_cache_set(s, index);
+    uint32_t key = index + 1;
+    int i;
+
+    for (i = 0; i < SHARED_CACHE_WAYS; i++) {
+        SharedCacheSlot *slot = &set[i];
+        uint64_t seq = atomic_load_acquire(&slot->seq);
+
+        if ((seq & 1) || atomic_read(&slot->key) != key) {
+            continue;
+        }
+        shared_cache_copy_block(index, shared_cache_slot_data(s, slot),
+                                offset, bytes, qiov);
+        smp_rmb();
+        if (atomic_read(&slot->seq) != seq) {
+            return false;
+        }
+        atomic_set(&slot->tick, atomic_read(&s->hdr->clock));
+        return true;
+    }
+    return false;
+}
+
+/*
+ * Publish block @index.  Gives up silently if another instance is already
+ * filling the chosen slot or inserted the same block first.
+ */
+static void shared_cache_insert(BDRVSharedCacheState *s, uint64_t index,
+                                const uint8_t *buf)
+{
+    SharedCacheSlot *set = shared_cache_set(s, index);
+    SharedCacheSlot *victim = NULL;
+    uint32_t key = index + 1;
+    uint32_t now = atomic_read(&s->hdr->clock);
+    uint32_t now_secs = shared_cache_now();
+    uint64_t victim_seq = 0, claim;
+    uint32_t victim_age = 0, count;
+    int i;
+
+    for (i = 0; i < SHARED_CACHE_WAYS; i++) {
+        SharedCacheSlot *slot = &set[i];
+        uint64_t seq = atomic_read(&slot->seq);
+        uint32_t slot_key, age;
+
+        if (seq & 1) {
+            if (now_secs - (uint32_t)(seq >> 32) <
+                SHARED_CACHE_STALE_CLAIM_SECS) {
+                continue;
+            }
+            /* Its writer is gone, take over the claim */
+            victim = slot;
+            victim_seq = seq;
+            break;
+        }
+        slot_key = atomic_read(&slot->key);
+        if (slot_key == key) {
+            return;
+        }
+        if (slot_key == 0) {
+            victim = slot;
+            victim_seq = seq;
+            break;
+        }
+        age = now - atomic_read(&slot->tick);
+        if (!victim || age > victim_age) {
+            victim = slot;
+            victim_seq = seq;
+            victim_age = age;
+        }
+    }
+
+    if (!victim) {
+        return;
+    }
+    count = victim_seq;
+    count += (count & 1) ? 2 : 1;
+    claim = (uint64_t)now_secs << 32 | count;
+    if (atomic_cmpxchg(&victim->seq, victim_seq, claim) != victim_seq) {
+        return;
+    }
+    /* atomic_cmpxchg is a full barrier, readers see the odd count first */
+    atomic_set(&victim->key, key);
+    memcpy(shared_cache_slot_data(s, victim), buf, SHARED_CACHE_BLOCK_SIZE);
+    atomic_set(&victim->tick, atomic_fetch_inc(&s->hdr->clock));
+    /* Unless we took so long that somebody else took over the claim */
+    if (atomic_cmpxchg(&victim->seq, claim, (uint64_t)(count + 1)) != claim) {
+        return;
+    }
+
+    stat64_add(&s->inserts, 1);
+}
+
+/*
+ * Read blocks [@first, @end) from the image, publish them and copy them to
+ * the request.
+ */
+static int coroutine_fn shared_cache_fill(BlockDriverState *bs,
+                                          uint64_t first, uint64_t end,
+                                          uint64_t offset, uint64_t bytes,
+                                          QEMUIOVector *qiov)
+{
+    BDRVSharedCacheState *s = bs->opaque;
+    uint64_t run_offset = first * SHARED_CACHE_BLOCK_SIZE;
+    uint64_t run_bytes = (end - first) * SHARED_CACHE_BLOCK_SIZE;
+    uint64_t avail = 0;
+    QEMUIOVector local_qiov;
+    struct iovec iov;
+    uint8_t *buf;
+    uint64_t i;
+    int ret;
+
+    buf = qemu_try_blockalign(bs->file->bs, run_bytes);
+    if (!buf) {
+        return -ENOMEM;
+    }
+
+    /* The block layer may round the last request up past the end of file */
+    if (run_offset < s->image_size) {
+        avail = MIN(run_bytes, s->image_size - run_offset);
+        iov.iov_base = buf;
+        iov.iov_len = avail;
+        qemu_iovec_init_external(&local_qiov, &iov, 1);
+        ret = bdrv_co_preadv(bs->file, run_offset, avail, &local_qiov, 0);
+        if (ret < 0) {
+            goto out;
+        }
+    }
+    memset(buf + avail, 0, run_bytes - avail);
+
+    for (i = first; i < end; i++) {
+        uint8_t *block = buf + (i - first) * SHARED_CACHE_BLOCK_SIZE;
+
+        shared_cache_insert(s, i, block);
+        shared_cache_copy_block(i, block, offset, bytes, qiov);
+    }
+    stat64_add(&s->misses, end - first);
+    ret = 0;
+
+out:
+    qemu_vfree(buf);
+    return ret;
+}
+
+static int coroutine_fn shared_cache_co_preadv(BlockDriverState *bs,
+                                               uint64_t offset, uint64_t bytes,
+                                               QEMUIOVector *qiov, int flags)
+{
+    BDRVSharedCacheState *s = bs->opaque;
+    uint64_t index, last;
+    int ret;
+
+    if (!s->hdr || bytes == 0) {
+        return bdrv_co_preadv(bs->file, offset, bytes, qiov, flags);
+    }
+
+    index = offset / SHARED_CACHE_BLOCK_SIZE;
+    last = (offset + bytes - 1) / SHARED_CACHE_BLOCK_SIZE;
+    while (index <= last) {
+        uint64_t end;
+        bool hit_after_run = false;
+
+        if (shared_cache_lookup(s, index, offset, bytes, qiov)) {
+            stat64_add(&s->hits, 1);
+            index++;
+            continue;
+        }
+
+        /* Coalesce consecutive misses into a single read of the image */
+        for (end = index + 1;
+             end <= last && end - index < SHARED_CACHE_MAX_RUN; end++) {
+            if (shared_cache_lookup(s, end, offset, bytes, qiov)) {
+                stat64_add(&s->hits, 1);
+                hit_after_run = true;
+                break;
+            }
+        }
+
+        ret = shared_cache_fill(bs, index, end, offset, bytes, qiov);
+        if (ret < 0) {
+            return ret;
+        }
+        index = end + hit_after_run;
+    }
+    return 0;
+}
+
+static int shared_cache_open(BlockDriverState *bs, QDict *options, int flags,
+                             Error **errp)
+{
+    BDRVSharedCacheState *s = bs->opaque;
+    SharedCacheHeader id = { 0 };
+    Error *local_err = NULL;
+    QemuOpts *opts;
+    uint64_t cache_size;
+    int64_t image_size;
+    struct stat st;
+    int ret;
+
+    if (flags & BDRV_O_RDWR) {
+        error_setg(errp, "The shared-cache driver only supports read-only "
+                   "images");
+        return -EINVAL;
+    }
+
+    opts = qemu_opts_create(&shared_cache_opts, NULL, 0, &error_abort);
+    qemu_opts_absorb_qdict(opts, options, &local_err);
+    if (local_err) {
+        error_propagate(errp, local_err);
+        ret = -EINVAL;
+        goto fail;
+    }
+    cache_size = qemu_opt_get_size(opts, SHARED_CACHE_OPT_SIZE,
+                                   SHARED_CACHE_DEFAULT_SIZE);
+
+    bs->file = bdrv_open_child(NULL, options, "file", bs, &child_file, false,
+                               errp);
+    if (!bs->file) {
+        ret = -EINVAL;
+        goto fail;
+    }
+
+    image_size = bdrv_getlength(bs->file->bs);
+    if (image_size < 0) {
+        error_setg_errno(errp, -image_size, "Could not get image size");
+        ret = image_size;
+        goto fail;
+    }
+    if (image_size / SHARED_CACHE_BLOCK_SIZE >= UINT32_MAX) {
+        error_setg(errp, "Image is too large for the shared cache");
+        ret = -EFBIG;
+        goto fail;
+    }
+    s->image_size = image_size;
+
+    /*
+     * Blocks are keyed by the identity of the image file rather than by a
+     * hash of their contents: hashing would require reading the data that
+     * the cache is supposed to spare us from reading.  Rewriting the image
+     * changes its mtime, and therefore the segment.
+     */
+    if (stat(bs->file->bs->filename, &st) < 0) {
+        error_setg_errno(errp, errno, "The shared-cache driver requires a "
+                         "local image file");
+        ret = -errno;
+        goto fail;
+    }
+    id.image_dev = st.st_dev;
+    id.image_ino = st.st_ino;
+    id.image_size = st.st_size;
+    id.image_mtime = st.st_mtime;
+    s->name = g_strdup_printf("/qemu-blkcache-%016" PRIx64,
+                              shared_cache_hash(&id, sizeof(id)));
+
+    /* Without a segment we are slower, not wrong: keep going */
+    shared_cache_sweep();
+    ret = shared_cache_attach(s, &id, cache_size, &local_err);
+    if (ret < 0) {
+        warn_reportf_err(local_err, "%s: ", bs->file->bs->filename);
+        local_err = NULL;
+    }
+
+    bs->supported_write_flags = 0;
+    bs->supported_zero_flags = 0;
+    ret = 0;
+fail:
+    qemu_opts_del(opts);
+    if (ret < 0) {
+        g_free(s->name);
+        s->name = NULL;
+    }
+    return ret;
+}
+
+static void shared_cache_close(BlockDriverState *bs)
+{
+    BDRVSharedCacheState *s = bs->opaque;
+
+    shared_cache_detach(s);
+    g_free(s->name);
+}
+
+static int64_t shared_cache_getlength(BlockDriverState *bs)
+{
+    return bdrv_getlength(bs->file->bs);
+}
+
+static int shared_cache_reopen_prepare(BDRVReopenState *reopen_state,
+                                       BlockReopenQueue *queue, Error **errp)
+{
+    if (reopen_state->flags & BDRV_O_RDWR) {
+        error_setg(errp, "The shared-cache driver only supports read-only "
+                   "images");
+        return -EINVAL;
+    }
+    return 0;
+}
+
+static bool shared_cache_recurse_is_first_non_filter(BlockDriverState *bs,
+                                                     BlockDriverState *candidate)
+{
+    return bdrv_recurse_is_first_non_filter(bs->file->bs, candidate);
+}
+
+static BlockDriver bdrv_shared_cache = {
+    .format_name                        =   "shared-cache",
+    .instance_size                      =   sizeof(BDRVSharedCacheState),
+
+    .bdrv_open                          =   shared_cache_open,
+    .bdrv_close                         =   shared_cache_close,
+
+    .bdrv_child_perm                    =   bdrv_filter_default_perms,
+
+    .bdrv_getlength                     =   shared_cache_getlength,
+
+    .bdrv_co_preadv                     =   shared_cache_co_preadv,
+
+    .bdrv_recurse_is_first_non_filter   =
+        shared_cache_recurse_is_first_non_filter,
+
+    .bdrv_reopen_prepare                =   shared_cache_reopen_prepare,
+    .bdrv_co_block_status               =   bdrv_co_block_status_from_file,
+
+    .is_filter                          =   true,
+};
+
+/* The number of nodes that hold a user byte, including this one. */
+static int64_t shared_cache_instances(BDRVSharedCacheState *s)
+{
+    int64_t instances = 1;
+    int i;
+
+    for (i = 0; i < SHARED_CACHE_MAX_USERS; i++) {
+        if (i != s->user &&
+            qemu_lock_fd_test(s->lock_fd, SHARED_CACHE_LOCK_USERS + i, 1,
+                              true) < 0) {
+            instances++;
+        }
+    }
+    return instances;
+}
+
+SharedCacheInfoList *qmp_query_shared_cache(Error **errp)
+{
+    SharedCacheInfoList *head = NULL, **p_next = &head;
+    BlockDriverState *bs;
+
+    for (bs = bdrv_next_node(NULL); bs; bs = bdrv_next_node(bs)) {
+        BDRVSharedCacheState *s = bs->opaque;
+        SharedCacheInfoList *entry;
+        SharedCacheInfo *info;
+        const char *device;
+
+        if (bs->drv != &bdrv_shared_cache) {
+            continue;
+        }
+
+        info = g_new0(SharedCacheInfo, 1);
+        info->node_name = g_strdup(bdrv_get_node_name(bs));
+        device = bdrv_get_device_name(bs);
+        if (*device) {
+            info->has_device = true;
+            info->device = g_strdup(device);
+        }
+        info->image = g_strdup(bs->file->bs->filename);
+        info->shared = s->hdr != NULL;
+        if (s->hdr) {
+            info->size = (uint64_t)s->nb_sets * SHARED_CACHE_WAYS *
+                         SHARED_CACHE_BLOCK_SIZE;
+            info->instances = shared_cache_instances(s);
+        }
+        info->block_size = SHARED_CACHE_BLOCK_SIZE;
+        info->hits = stat64_get(&s->hits);
+        info->misses = stat64_get(&s->misses);
+        info->inserts = stat64_get(&s->inserts);
+
+        entry = g_new0(SharedCacheInfoList, 1);
+        entry->value = info;
+        *p_next = entry;
+        p_next = &entry->next;
+    }
+    return head;
+}
+
+static void bdrv_shared_cache_init(void)
+{
+    bdrv_register(&bdrv_shared_cache);
+}
+
+block_init(bdrv_shared_cache_init);
@@ -44,7 +44,10 @@
 #include "sysemu/whpx.h"
 #include "sysemu/gvm.h"
 #include "exec/exec-all.h"
+#include "exec/tb-cache.h"
+#include "exec/tcg-profile.h"
 
+#include "qemu/bql-profile.h"
 #include "qemu/thread.h"
 #include "qemu/thread_local.h"
 #include "sysemu/cpus.h"
@@ -202,6 +205,22 @@ static bool default_mttcg_enabled(void)
 void qemu_tcg_configure(QemuOpts *opts, Error **errp)
 {
     const char *t = qemu_opt_get(opts, "thread");
+    const char *tb_cache = qemu_opt_get(opts, "tb-cache");
+    Error *local_err = NULL;
+
+    if (tb_cache) {
+        tb_cache_configure(tb_cache,
+                           qemu_opt_get_size(opts, "tb-cache-size",
+                                             TB_CACHE_DEFAULT_SIZE),
+                           &local_err);
+        if (local_err) {
+            error_propagate(errp, local_err);
+            return;
+        }
+    }
+
+    tcg_profile_set(qemu_opt_get_bool(opts, "profile", false));
+
     if (t) {
         if (strcmp(t, "multi") == 0) {
             if (TCG_OVERSIZED_GUEST) {
@@ -1032,7 +1051,12 @@ static int do_vm_stop(RunState state, bool send_stop)
  */
 int vm_shutdown(void)
 {
-    return do_vm_stop(RUN_STATE_SHUTDOWN, false);
+    int ret = do_vm_stop(RUN_STATE_SHUTDOWN, false);
+
+    if (tcg_enabled()) {
+        tb_cache_save();
+    }
+    return ret;
 }
 
 static bool cpu_can_run(CPUState *cpu)
@@ -1175,7 +1199,7 @@ static void qemu_tcg_rr_wait_io_event(CPUState *cpu)
 {
     while (all_cpu_threads_idle()) {
         stop_tcg_kick_timer();
-        qemu_cond_wait(cpu->halt_cond, &qemu_global_mutex);
+        qemu_cond_wait_iothread(cpu->halt_cond);
     }
 
     start_tcg_kick_timer();
@@ -1187,7 +1211,7 @@ static void qemu_tcg_rr_wait_io_event(CPUState *cpu)
 static void qemu_hvf_wait_io_event(CPUState *cpu)
 {
     while (cpu_thread_is_idle(cpu)) {
-        qemu_cond_wait(cpu->halt_cond, &qemu_global_mutex);
+        qemu_cond_wait_iothread(cpu->halt_cond);
     }
     qemu_wait_io_event_common(cpu);
 }
@@ -1197,7 +1221,7 @@ static void qemu_hvf_wait_io_event(CPUState *cpu)
 static void qemu_wait_io_event(CPUState *cpu)
 {
     while (cpu_thread_is_idle(cpu)) {
-        qemu_cond_wait(cpu->halt_cond, &qemu_global_mutex);
+        qemu_cond_wait_iothread(cpu->halt_cond);
     }
 
 #ifdef _WIN32
@@ -1477,7 +1501,7 @@ static void *qemu_tcg_rr_cpu_thread_fn(void *arg)
 
     /* wait for initial kick-off after machine start */
     while (first_cpu->stopped) {
-        qemu_cond_wait(first_cpu->halt_cond, &qemu_global_mutex);
+        qemu_cond_wait_iothread(first_cpu->halt_cond);
 
         /* process any pending work */
         CPU_FOREACH(cpu) {
@@ -1688,7 +1712,7 @@ static void *qemu_whpx_cpu_thread_fn(void *arg)
             }
         }
         while (cpu_thread_is_idle(cpu)) {
-            qemu_cond_wait(cpu->halt_cond, &qemu_global_mutex);
+            qemu_cond_wait_iothread(cpu->halt_cond);
         }
         qemu_wait_io_event_common(cpu);
     } while (!cpu->unplug || cpu_can_run(cpu));
@@ -1884,20 +1908,33 @@ bool qemu_mutex_iothread_locked(void)
     return QEMU_THREAD_LOCAL_GET(iothread_locked);
 }
 
-void qemu_mutex_lock_iothread(void)
+void qemu_mutex_lock_iothread_impl(const char *file, int line)
 {
+    int64_t start = bql_profile_lock_start();
+
     g_assert(!qemu_mutex_iothread_locked());
     qemu_mutex_lock(&qemu_global_mutex);
-     QEMU_THREAD_LOCAL_SET(iothread_locked, true);
+    QEMU_THREAD_LOCAL_SET(iothread_locked, true);
+    if (start) {
+        bql_profile_locked(file, line, start);
+    }
 }
 
 void qemu_mutex_unlock_iothread(void)
 {
     g_assert(qemu_mutex_iothread_locked());
+    bql_profile_unlocked(false);
     QEMU_THREAD_LOCAL_SET(iothread_locked, false);
     qemu_mutex_unlock(&qemu_global_mutex);
 }
 
+void qemu_cond_wait_iothread(QemuCond *cond)
+{
+    bql_profile_unlocked(true);
+    qemu_cond_wait(cond, &qemu_global_mutex);
+    bql_profile_relocked();
+}
+
 static bool all_vcpus_paused(void)
 {
     CPUState *cpu;
@@ -1931,7 +1968,7 @@ void pause_all_vcpus(void)
     replay_mutex_unlock();
 
     while (!all_vcpus_paused()) {
-        qemu_cond_wait(&qemu_pause_cond, &qemu_global_mutex);
+        qemu_cond_wait_iothread(&qemu_pause_cond);
         CPU_FOREACH(cpu) {
             qemu_cpu_kick(cpu);
         }
@@ -2126,7 +2163,7 @@ static void qemu_gvm_start_vcpu(CPUState *cpu)
     qemu_thread_create(cpu->thread, thread_name, qemu_gvm_cpu_thread_fn,
                        cpu, QEMU_THREAD_JOINABLE);
     while (!cpu->created) {
-        qemu_cond_wait(&qemu_cpu_cond, &qemu_global_mutex);
+        qemu_cond_wait_iothread(&qemu_cpu_cond);
     }
 #ifdef _WIN32
     cpu->hThread = qemu_thread_get_handle(cpu->thread);
@@ -2179,7 +2216,7 @@ void qemu_init_vcpu(CPUState *cpu)
     }
 
     while (!cpu->created) {
-        qemu_cond_wait(&qemu_cpu_cond, &qemu_global_mutex);
+        qemu_cond_wait_iothread(&qemu_cpu_cond);
     }
 }
 
@@ -293,6 +293,42 @@ STEXI
 @item info opcount
 @findex info opcount
 Show dynamic compiler opcode counters
+ETEXI
+
+#if defined(CONFIG_TCG)
+    {
+        .name       = "tcg-profile",
+        .args_type  = "count:i?",
+        .params     = "[count]",
+        .help       = "show the hottest translation blocks and helpers",
+        .cmd        = hmp_info_tcg_profile,
+    },
+#endif
+
+STEXI
+@item info tcg-profile [@var{count}]
+@findex info tcg-profile
+Show the @var{count} translation blocks where the guest spends the most time,
+the helpers called the most, and the softmmu and TB flush counters. The
+profile is recorded when QEMU is started with @code{-accel tcg,profile=on} or
+after @code{tcg-profile on}. The default count is 20.
+ETEXI
+
+    {
+        .name       = "bql-profile",
+        .args_type  = "count:i?",
+        .params     = "[count]",
+        .help       = "show who holds the big QEMU lock, and for how long",
+        .cmd        = hmp_info_bql_profile,
+    },
+
+STEXI
+@item info bql-profile [@var{count}]
+@findex info bql-profile
+Show the @var{count} call sites that hold the big QEMU lock the longest, with
+how many times each took it and the average, median, 99th percentile and
+maximum times spent waiting for it and holding it. The profile is recorded
+after @code{bql-profile on}. The default count is 20.
 ETEXI
 
     {
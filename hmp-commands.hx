@@ -388,6 +388,41 @@ STEXI
 @findex singlestep
 Run the emulation in single step mode.
 If called with option off, the emulation returns to normal mode.
+ETEXI
+
+#if defined(CONFIG_TCG)
+    {
+        .name       = "tcg-profile",
+        .args_type  = "op:s,arg:F?",
+        .params     = "on|off|reset|dump [filename]",
+        .help       = "start, stop or reset the TCG execution profile, "
+                      "or save it to a JSON file",
+        .cmd        = hmp_tcg_profile,
+    },
+#endif
+
+STEXI
+@item tcg-profile on|off|reset|dump [@var{filename}]
+@findex tcg-profile
+Start or stop counting how many times the translated code is executed, clear
+the counters, or save them to @var{filename} in JSON. The counters can be
+shown with @code{info tcg-profile}.
+ETEXI
+
+    {
+        .name       = "bql-profile",
+        .args_type  = "op:s",
+        .params     = "on|off|reset",
+        .help       = "start, stop or reset the big QEMU lock profile",
+        .cmd        = hmp_bql_profile,
+    },
+
+STEXI
+@item bql-profile on|off|reset
+@findex bql-profile
+Start or stop recording the wait and hold times of the big QEMU lock for
+each call site that takes it, or clear them. The times can be shown with
+@code{info bql-profile}.
 ETEXI
 
     {
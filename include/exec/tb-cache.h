@@ -0,0 +1,95 @@
+/*
+ * Persistent translation block cache
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+
+#ifndef EXEC_TB_CACHE_H
+#define EXEC_TB_CACHE_H
+
+#include "exec/exec-all.h"
+
+#define TB_CACHE_DEFAULT_SIZE (256 * 1024 * 1024)
+
+#ifdef CONFIG_SOFTMMU
+
+/* Set once a cache file is configured, until it is saved */
+extern bool tb_cache_enabled;
+
+/**
+ * tb_cache_configure: map the cache file and index its TBs
+ *
+ * @path: the cache file; it is created when the cache is saved
+ * @max_size: maximum size of the file in bytes
+ * @errp: error object
+ */
+void tb_cache_configure(const char *path, uint64_t max_size, Error **errp);
+
+/**
+ * tb_cache_load: copy the code for @tb from the cache
+ *
+ * Looks for a TB with the same key as @tb, whose guest code is still the
+ * same, and copies its code and search data to tb->tc.ptr.  Fills in the
+ * fields that translation would have filled in.
+ *
+ * Returns the size of the search data, or -1 if the TB must be translated.
+ * Called with tb_lock held.
+ *
+ * @cpu: the CPU about to execute the TB
+ * @tb: the TB, with its key and tc.ptr set
+ * @phys_pc: the ram address of the TB
+ */
+int tb_cache_load(CPUState *cpu, TranslationBlock *tb, tb_page_addr_t phys_pc);
+
+/**
+ * tb_cache_store: add a newly translated TB to the cache
+ *
+ * Called with tb_lock held, right after tcg_gen_code.
+ *
+ * @cpu: the CPU the TB was translated for
+ * @tb: the TB
+ * @phys_pc: the ram address of the TB
+ * @search_size: size of the search data after the code
+ * @translate_ns: time spent translating the TB
+ */
+void tb_cache_store(CPUState *cpu, TranslationBlock *tb,
+                    tb_page_addr_t phys_pc, int search_size,
+                    int64_t translate_ns);
+
+/**
+ * tb_cache_save: write the cache file and disable the cache
+ *
+ * Keeps the TBs that were used recently or are still valid, and adds the
+ * ones translated since the file was loaded.
+ */
+void tb_cache_save(void);
+
+void tb_cache_dump_info(FILE *f, fprintf_function cpu_fprintf);
+
+#else
+
+#define tb_cache_enabled false
+
+static inline int tb_cache_load(CPUState *cpu, TranslationBlock *tb,
+                                tb_page_addr_t phys_pc)
+{
+    return -1;
+}
+
+static inline void tb_cache_store(CPUState *cpu, TranslationBlock *tb,
+                                  tb_page_addr_t phys_pc, int search_size,
+                                  int64_t translate_ns)
+{
+}
+
+static inline void tb_cache_dump_info(FILE *f, fprintf_function cpu_fprintf)
+{
+}
+
+#endif
+
+#endif
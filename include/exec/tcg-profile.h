@@ -0,0 +1,100 @@
+/*
+ * TCG execution profile
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+
+#ifndef EXEC_TCG_PROFILE_H
+#define EXEC_TCG_PROFILE_H
+
+#include "exec/exec-all.h"
+#include "qemu/stats64.h"
+
+typedef enum TCGProfileEvent {
+    TCG_PROFILE_SLOW_LOAD,
+    TCG_PROFILE_SLOW_STORE,
+    TCG_PROFILE_TLB_VICTIM_HIT,
+    TCG_PROFILE_TLB_FILL,
+    TCG_PROFILE_IO_READ,
+    TCG_PROFILE_IO_WRITE,
+    TCG_PROFILE_FLUSH,
+    TCG_PROFILE_FLUSH_FULL,
+    TCG_PROFILE_INVALIDATE_WRITE,
+    TCG_PROFILE_INVALIDATE_IO,
+    TCG_PROFILE_INVALIDATE_WATCHPOINT,
+    TCG_PROFILE_EVENT__MAX,
+} TCGProfileEvent;
+
+#ifdef CONFIG_SOFTMMU
+
+/* Read by the slow paths; TBs are only profiled if it was set when they
+ * were translated.
+ */
+extern bool tcg_profile_enabled;
+extern Stat64 tcg_profile_events[TCG_PROFILE_EVENT__MAX];
+
+static inline void tcg_profile_event(TCGProfileEvent ev)
+{
+    if (unlikely(atomic_read(&tcg_profile_enabled))) {
+        stat64_add(&tcg_profile_events[ev], 1);
+    }
+}
+
+/**
+ * tcg_profile_tb_start: start profiling a TB that is about to be translated
+ *
+ * Returns the counter that the code of @tb must increment each time it is
+ * executed, which is shared with earlier translations of the same code.
+ * Called with tb_lock held.
+ *
+ * @tb: the TB, with its key set
+ * @phys_pc: the ram address of the TB
+ */
+uint64_t *tcg_profile_tb_start(TranslationBlock *tb, tb_page_addr_t phys_pc);
+
+/**
+ * tcg_profile_tb_end: record the translation of a profiled TB
+ *
+ * @tb: the TB that was translated
+ * @translate_ns: time spent translating it
+ */
+void tcg_profile_tb_end(TranslationBlock *tb, int64_t translate_ns);
+
+/**
+ * tcg_profile_set: start or stop profiling
+ *
+ * Flushes the TBs, so that they get translated again with or without
+ * the counters.
+ */
+void tcg_profile_set(bool enable);
+void tcg_profile_reset(void);
+
+void tcg_profile_dump_info(FILE *f, fprintf_function cpu_fprintf, int count);
+void tcg_profile_dump_json(const char *filename, Error **errp);
+
+#else
+
+#define tcg_profile_enabled false
+
+static inline void tcg_profile_event(TCGProfileEvent ev)
+{
+}
+
+static inline uint64_t *tcg_profile_tb_start(TranslationBlock *tb,
+                                             tb_page_addr_t phys_pc)
+{
+    return NULL;
+}
+
+static inline void tcg_profile_tb_end(TranslationBlock *tb,
+                                      int64_t translate_ns)
+{
+}
+
+#endif
+
+#endif
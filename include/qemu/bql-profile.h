@@ -0,0 +1,68 @@
+/*
+ * Big QEMU lock contention profile
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+
+#ifndef QEMU_BQL_PROFILE_H
+#define QEMU_BQL_PROFILE_H
+
+#include "qemu/atomic.h"
+#include "qemu/fprintf-fn.h"
+#include "qemu/timer.h"
+
+/*
+ * While enabled, every acquisition of the iothread lock records how long
+ * the caller waited for it and how long it then held it, against the call
+ * site that took it: a file and line for qemu_mutex_lock_iothread(), or a
+ * function name for android::VmLock users.
+ *
+ * Times are taken with cpu_get_host_ticks() and recorded in histograms of
+ * the thread that took the lock, so that the lock paths share nothing.
+ */
+extern bool bql_profile_enabled;
+
+/* Called before waiting for the lock; returns 0 when not profiling. */
+static inline int64_t bql_profile_lock_start(void)
+{
+    return unlikely(atomic_read(&bql_profile_enabled)) ?
+           cpu_get_host_ticks() : 0;
+}
+
+/**
+ * bql_profile_locked: record an acquisition of the lock
+ *
+ * @file: the call site, or the name of the caller when @line is 0
+ * @line: the line of the call site
+ * @start: the result of bql_profile_lock_start(), which must not be 0
+ */
+void bql_profile_locked(const char *file, int line, int64_t start);
+
+/**
+ * bql_profile_unlocked: record the release of the lock
+ *
+ * @suspend: true if the lock is released for a condition variable wait,
+ * in which case bql_profile_relocked() carries on with the same hold.
+ */
+void bql_profile_unlocked(bool suspend);
+void bql_profile_relocked(void);
+
+void bql_profile_set(bool enable);
+void bql_profile_reset(void);
+
+/**
+ * bql_profile_set_trace_counter: export the profile as trace counters
+ *
+ * @counter is called with the wait and hold times of each acquisition, in
+ * microseconds, while the profile is enabled.
+ */
+void bql_profile_set_trace_counter(void (*counter)(const char *name,
+                                                   int64_t value));
+
+void bql_profile_dump_info(FILE *f, fprintf_function cpu_fprintf, int count);
+
+#endif
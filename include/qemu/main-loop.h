@@ -269,8 +269,12 @@ bool qemu_mutex_iothread_locked(void);
  *
  * NOTE: tools currently are single-threaded and qemu_mutex_lock_iothread
  * is a no-op there.
+ *
+ * The call site is recorded by the BQL profile, see qemu/bql-profile.h.
  */
-void qemu_mutex_lock_iothread(void);
+void qemu_mutex_lock_iothread_impl(const char *file, int line);
+#define qemu_mutex_lock_iothread() \
+    qemu_mutex_lock_iothread_impl(__FILE__, __LINE__)
 
 /**
  * qemu_mutex_unlock_iothread: Unlock the main loop mutex.
@@ -287,6 +291,14 @@ void qemu_mutex_lock_iothread(void);
  */
 void qemu_mutex_unlock_iothread(void);
 
+/**
+ * qemu_cond_wait_iothread: Wait on condition for the main loop mutex
+ *
+ * This function atomically releases the main loop mutex and causes
+ * the calling thread to block on the condition.
+ */
+void qemu_cond_wait_iothread(QemuCond *cond);
+
 /* internal interfaces */
 
 void qemu_fd_register(int fd);
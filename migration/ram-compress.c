@@ -0,0 +1,241 @@
+/*
+ * Multi-threaded RAM page compression for migration
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+
+#include "qemu/osdep.h"
+#include "qemu/cutils.h"
+#include "qemu/thread.h"
+#include "ram-compress.h"
+
+/*
+ * The queueing thread fills a batch of pages and hands it to the workers in
+ * round-robin order.  Each worker compresses its batch into its own buffer.
+ * Before a worker gets a new batch, the queueing thread waits for its
+ * previous one and passes the results on, so pages come out in the order
+ * they went in, without the workers ever touching the stream.
+ */
+
+typedef struct CompressPage {
+    void *tag;
+    uint64_t offset;
+    const uint8_t *data;
+} CompressPage;
+
+typedef struct CompressWorker {
+    CompressPool *pool;
+    QemuThread thread;
+    QemuMutex mutex;
+    QemuCond work_cond;
+    QemuCond done_cond;
+    bool quit;
+    /* The worker owns pages, buf and lens while nb_pages > 0 && !done */
+    bool done;
+    int nb_pages;
+    CompressPage *pages;
+    uint8_t *buf;
+    ssize_t *lens;
+} CompressWorker;
+
+struct CompressPool {
+    CompressWorker *workers;
+    int nb_workers;
+    int next_worker;
+    int batch_pages;
+    size_t page_size;
+    size_t max_compressed_size;
+    int level;
+    MigrationCompressionOps ops;
+    CompressPageFunc *func;
+    void *opaque;
+
+    /* Batch being filled by compress_pool_queue */
+    CompressPage *pending;
+    int nb_pending;
+};
+
+static void compress_worker_run(CompressWorker *w)
+{
+    CompressPool *pool = w->pool;
+    int i;
+
+    for (i = 0; i < w->nb_pages; i++) {
+        const uint8_t *data = w->pages[i].data;
+        uint8_t *dest = w->buf + i * pool->max_compressed_size;
+        ssize_t len;
+
+        if (buffer_is_zero(data, pool->page_size)) {
+            w->lens[i] = 0;
+            continue;
+        }
+
+        len = pool->ops.compress(dest, pool->max_compressed_size,
+                                 data, pool->page_size, pool->level);
+        w->lens[i] = len > 0 ? len : -1;
+    }
+}
+
+static void *compress_worker_thread(void *opaque)
+{
+    CompressWorker *w = opaque;
+
+    qemu_mutex_lock(&w->mutex);
+    while (!w->quit) {
+        if (w->nb_pages && !w->done) {
+            qemu_mutex_unlock(&w->mutex);
+            compress_worker_run(w);
+            qemu_mutex_lock(&w->mutex);
+            w->done = true;
+            qemu_cond_signal(&w->done_cond);
+        } else {
+            qemu_cond_wait(&w->work_cond, &w->mutex);
+        }
+    }
+    qemu_mutex_unlock(&w->mutex);
+
+    return NULL;
+}
+
+/* Waits for the batch of @w, if any, and passes its results on */
+static void compress_worker_collect(CompressPool *pool, CompressWorker *w)
+{
+    int i;
+
+    qemu_mutex_lock(&w->mutex);
+    while (w->nb_pages && !w->done) {
+        qemu_cond_wait(&w->done_cond, &w->mutex);
+    }
+    qemu_mutex_unlock(&w->mutex);
+
+    /* The worker leaves a finished batch alone */
+    for (i = 0; i < w->nb_pages; i++) {
+        pool->func(pool->opaque, w->pages[i].tag, w->pages[i].offset,
+                   w->buf + i * pool->max_compressed_size, w->lens[i]);
+    }
+
+    qemu_mutex_lock(&w->mutex);
+    w->nb_pages = 0;
+    qemu_mutex_unlock(&w->mutex);
+}
+
+static void compress_pool_submit(CompressPool *pool)
+{
+    CompressWorker *w = &pool->workers[pool->next_worker];
+    CompressPage *pages;
+
+    if (!pool->nb_pending) {
+        return;
+    }
+
+    compress_worker_collect(pool, w);
+
+    /* The worker's page array becomes the next pending batch */
+    pages = w->pages;
+    qemu_mutex_lock(&w->mutex);
+    w->pages = pool->pending;
+    w->nb_pages = pool->nb_pending;
+    w->done = false;
+    qemu_cond_signal(&w->work_cond);
+    qemu_mutex_unlock(&w->mutex);
+
+    pool->pending = pages;
+    pool->nb_pending = 0;
+    pool->next_worker = (pool->next_worker + 1) % pool->nb_workers;
+}
+
+CompressPool *compress_pool_new(int threads, int batch_pages, size_t page_size,
+                                int level, const MigrationCompressionOps *ops,
+                                CompressPageFunc *func, void *opaque)
+{
+    CompressPool *pool = g_new0(CompressPool, 1);
+    int i;
+
+    assert(threads > 0 && batch_pages > 0);
+
+    pool->nb_workers = threads;
+    pool->batch_pages = batch_pages;
+    pool->page_size = page_size;
+    pool->max_compressed_size = ops->max_compressed_size(page_size);
+    pool->level = level;
+    pool->ops = *ops;
+    pool->func = func;
+    pool->opaque = opaque;
+    pool->pending = g_new(CompressPage, batch_pages);
+
+    pool->workers = g_new0(CompressWorker, threads);
+    for (i = 0; i < threads; i++) {
+        CompressWorker *w = &pool->workers[i];
+
+        w->pool = pool;
+        w->pages = g_new(CompressPage, batch_pages);
+        w->buf = g_malloc(batch_pages * pool->max_compressed_size);
+        w->lens = g_new(ssize_t, batch_pages);
+        qemu_mutex_init(&w->mutex);
+        qemu_cond_init(&w->work_cond);
+        qemu_cond_init(&w->done_cond);
+        qemu_thread_create(&w->thread, "compress", compress_worker_thread, w,
+                           QEMU_THREAD_JOINABLE);
+    }
+
+    return pool;
+}
+
+void compress_pool_free(CompressPool *pool)
+{
+    int i;
+
+    if (!pool) {
+        return;
+    }
+
+    for (i = 0; i < pool->nb_workers; i++) {
+        CompressWorker *w = &pool->workers[i];
+
+        qemu_mutex_lock(&w->mutex);
+        w->quit = true;
+        qemu_cond_signal(&w->work_cond);
+        qemu_mutex_unlock(&w->mutex);
+        qemu_thread_join(&w->thread);
+
+        qemu_mutex_destroy(&w->mutex);
+        qemu_cond_destroy(&w->work_cond);
+        qemu_cond_destroy(&w->done_cond);
+        g_free(w->pages);
+        g_free(w->buf);
+        g_free(w->lens);
+    }
+    g_free(pool->workers);
+    g_free(pool->pending);
+    g_free(pool);
+}
+
+void compress_pool_queue(CompressPool *pool, void *tag, uint64_t offset,
+                         const uint8_t *page)
+{
+    pool->pending[pool->nb_pending++] = (CompressPage) {
+        .tag = tag,
+        .offset = offset,
+        .data = page,
+    };
+    if (pool->nb_pending == pool->batch_pages) {
+        compress_pool_submit(pool);
+    }
+}
+
+void compress_pool_flush(CompressPool *pool)
+{
+    int i;
+
+    compress_pool_submit(pool);
+
+    /* Oldest batch first */
+    for (i = 0; i < pool->nb_workers; i++) {
+        compress_worker_collect(pool, &pool->workers[(pool->next_worker + i) %
+                                                     pool->nb_workers]);
+    }
+}
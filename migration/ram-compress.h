@@ -0,0 +1,82 @@
+/*
+ * Multi-threaded RAM page compression for migration
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+
+#ifndef QEMU_MIGRATION_RAM_COMPRESS_H
+#define QEMU_MIGRATION_RAM_COMPRESS_H
+
+#include "migration/compression.h"
+
+/* Pool of threads that compress batches of pages */
+typedef struct CompressPool CompressPool;
+
+/**
+ * CompressPageFunc: hands the result for one page back to the stream
+ *
+ * Called in the thread that queues the pages, in the order they were queued.
+ *
+ * @opaque: the opaque pointer passed to compress_pool_new
+ * @tag: the tag passed to compress_pool_queue with the page
+ * @offset: the offset passed to compress_pool_queue with the page
+ * @data: the compressed page, valid until the function returns
+ * @len: the size of @data in bytes, 0 if the page is all zeroes, or negative
+ *       if it could not be compressed
+ */
+typedef void CompressPageFunc(void *opaque, void *tag, uint64_t offset,
+                              const uint8_t *data, ssize_t len);
+
+/**
+ * compress_pool_new: start the compression threads
+ *
+ * Returns the new pool
+ *
+ * @threads: number of compression threads
+ * @batch_pages: number of pages each thread compresses per job
+ * @page_size: size of a page in bytes
+ * @level: compression level passed to @ops
+ * @ops: compression functions
+ * @func: called with the result for each page
+ * @opaque: passed to @func
+ */
+CompressPool *compress_pool_new(int threads, int batch_pages, size_t page_size,
+                                int level, const MigrationCompressionOps *ops,
+                                CompressPageFunc *func, void *opaque);
+
+/**
+ * compress_pool_free: stop the threads and free the pool
+ *
+ * Pages that were queued but not flushed are dropped.
+ *
+ * @pool: the pool to free
+ */
+void compress_pool_free(CompressPool *pool);
+
+/**
+ * compress_pool_queue: queue a page for compression
+ *
+ * The page must stay mapped until compress_pool_flush returns.  Results of
+ * earlier batches may be passed to the pool's CompressPageFunc before this
+ * function returns.
+ *
+ * @pool: the pool
+ * @tag: opaque value passed back with the result, e.g. the RAM block
+ * @offset: offset passed back with the result
+ * @page: the page contents
+ */
+void compress_pool_queue(CompressPool *pool, void *tag, uint64_t offset,
+                         const uint8_t *page);
+
+/**
+ * compress_pool_flush: pass the results of all queued pages on
+ *
+ * @pool: the pool
+ */
+void compress_pool_flush(CompressPool *pool);
+
+#endif
@@ -74,7 +74,9 @@
 #include "trace/simple.h"
 #endif
 #include "exec/memory.h"
+#include "exec/tcg-profile.h"
 #include "exec/exec-all.h"
+#include "qemu/bql-profile.h"
 #include "qemu/log.h"
 #include "qemu/option.h"
 #include "hmp.h"
@@ -1412,8 +1414,67 @@ static void hmp_info_opcount(Monitor *mon, const QDict *qdict)
 {
     dump_opcount_info((FILE *)mon, monitor_fprintf);
 }
+
+static void hmp_info_tcg_profile(Monitor *mon, const QDict *qdict)
+{
+    if (!tcg_enabled()) {
+        error_report("TCG profile is only available with accel=tcg");
+        return;
+    }
+
+    tcg_profile_dump_info((FILE *)mon, monitor_fprintf,
+                          qdict_get_try_int(qdict, "count", 20));
+}
+
+static void hmp_tcg_profile(Monitor *mon, const QDict *qdict)
+{
+    const char *op = qdict_get_str(qdict, "op");
+    const char *arg = qdict_get_try_str(qdict, "arg");
+    Error *err = NULL;
+
+    if (!tcg_enabled()) {
+        error_report("TCG profile is only available with accel=tcg");
+        return;
+    }
+
+    if (!strcmp(op, "on")) {
+        tcg_profile_set(true);
+    } else if (!strcmp(op, "off")) {
+        tcg_profile_set(false);
+    } else if (!strcmp(op, "reset")) {
+        tcg_profile_reset();
+    } else if (!strcmp(op, "dump") && arg) {
+        tcg_profile_dump_json(arg, &err);
+        if (err) {
+            error_report_err(err);
+        }
+    } else {
+        help_cmd(mon, "tcg-profile");
+    }
+}
 #endif
 
+static void hmp_info_bql_profile(Monitor *mon, const QDict *qdict)
+{
+    bql_profile_dump_info((FILE *)mon, monitor_fprintf,
+                          qdict_get_try_int(qdict, "count", 20));
+}
+
+static void hmp_bql_profile(Monitor *mon, const QDict *qdict)
+{
+    const char *op = qdict_get_str(qdict, "op");
+
+    if (!strcmp(op, "on")) {
+        bql_profile_set(true);
+    } else if (!strcmp(op, "off")) {
+        bql_profile_set(false);
+    } else if (!strcmp(op, "reset")) {
+        bql_profile_reset();
+    } else {
+        help_cmd(mon, "bql-profile");
+    }
+}
+
 static void hmp_info_history(Monitor *mon, const QDict *qdict)
 {
     int i;
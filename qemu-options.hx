@@ -128,9 +128,12 @@ Select CPU model (@code{-cpu help} for list and additional feature selection)
 ETEXI
 
 DEF("accel", HAS_ARG, QEMU_OPTION_accel,
-    "-accel [accel=]accelerator[,thread=single|multi]\n"
+    "-accel [accel=]accelerator[,thread=single|multi][,tb-cache=file][,tb-cache-size=size][,profile=on|off]\n"
     "                select accelerator (kvm, xen, hax, hvf, whpx or tcg; use 'help' for a list)\n"
-    "                thread=single|multi (enable multi-threaded TCG)", QEMU_ARCH_ALL)
+    "                thread=single|multi (enable multi-threaded TCG)\n"
+    "                tb-cache=file keeps translated code across runs (TCG only)\n"
+    "                tb-cache-size=size limits the size of the tb-cache file\n"
+    "                profile=on|off counts executed code, see 'info tcg-profile' (TCG only)", QEMU_ARCH_ALL)
 STEXI
 @item -accel @var{name}[,prop=@var{value}[,...]]
 @findex -accel
@@ -144,6 +147,21 @@ Controls number of TCG threads. When the TCG is multi-threaded there will be one
 thread per vCPU therefor taking advantage of additional host cores. The default
 is to enable multi-threading where both the back-end and front-ends support it and
 no incompatible TCG features have been enabled (e.g. icount/replay).
+@item tb-cache=@var{file}
+Saves the code translated by TCG to @var{file} when QEMU exits, and reuses it
+in the next runs instead of translating the same guest code again. A block of
+translated code is only reused if the guest code it was translated from did
+not change. The file is ignored if it was written by another build of QEMU or
+for another CPU model. Only supported on x86-64 hosts.
+@item tb-cache-size=@var{size}
+Limits the size of the tb-cache file. The default is 256M.
+@item profile=on|off
+Counts how many times each block of translated code is executed, along with
+the calls to helpers and the slow paths of the softmmu, so that the hottest
+guest code can be found. The counters slow the guest down and can be read
+with the @code{info tcg-profile} monitor command. Profiling can also be
+started and stopped from the monitor with @code{tcg-profile}. The default
+is off.
 @end table
 ETEXI
 
@@ -817,7 +835,8 @@ DEF("drive", HAS_ARG, QEMU_OPTION_drive,
     "       [,cyls=c,heads=h,secs=s[,trans=t]][,snapshot=on|off]\n"
     "       [,cache=writethrough|writeback|none|directsync|unsafe][,format=f]\n"
     "       [,serial=s][,addr=A][,rerror=ignore|stop|report]\n"
-    "       [,werror=ignore|stop|report|enospc][,id=name][,aio=threads|native]\n"
+    "       [,werror=ignore|stop|report|enospc][,id=name]\n"
+    "       [,aio=threads|native|io_uring]\n"
     "       [,readonly=on|off][,copy-on-read=on|off]\n"
     "       [,discard=ignore|unmap][,detect-zeroes=on|off|unmap]\n"
     "       [[,bps=b]|[[,bps_rd=r][,bps_wr=w]]]\n"
@@ -889,7 +908,9 @@ unsafe       │ on                off            on
 The default mode is @option{cache=writeback}.
 
 @item aio=@var{aio}
-@var{aio} is "threads", or "native" and selects between pthread based disk I/O and native Linux AIO.
+@var{aio} is "threads", "native" or "io_uring" and selects between pthread based
+disk I/O, native Linux AIO and Linux io_uring.  io_uring falls back to the
+thread pool on kernels that do not support it.
 @item format=@var{format}
 Specify which disk @var{format} will be used rather than detecting
 the format.  Can be used to specify format=raw to avoid interpreting
@@ -187,6 +187,26 @@ defined(TARGET_PPC) || defined(TARGET_XTENSA) || defined(TARGET_M68K)
 #endif
 
 
+#if defined(CONFIG_TCG)
+{
+.name       = "tcg-profile",
+.args_type  = "count:i?",
+.params     = "[count]",
+.help       = "show the hottest translation blocks and helpers",
+.cmd        = hmp_info_tcg_profile,
+},
+#endif
+
+
+{
+.name       = "bql-profile",
+.args_type  = "count:i?",
+.params     = "[count]",
+.help       = "show who holds the big QEMU lock, and for how long",
+.cmd        = hmp_info_bql_profile,
+},
+
+
 {
 .name       = "kvm",
 .args_type  = "",
@@ -207,6 +207,27 @@
 },
 
 
+#if defined(CONFIG_TCG)
+{
+.name       = "tcg-profile",
+.args_type  = "op:s,arg:F?",
+.params     = "on|off|reset|dump [filename]",
+.help       = "start, stop or reset the TCG execution profile, "
+"or save it to a JSON file",
+.cmd        = hmp_tcg_profile,
+},
+#endif
+
+
+{
+.name       = "bql-profile",
+.args_type  = "op:s",
+.params     = "on|off|reset",
+.help       = "start, stop or reset the big QEMU lock profile",
+.cmd        = hmp_bql_profile,
+},
+
+
 {
 .name       = "stop",
 .args_type  = "",
@@ -168,6 +168,64 @@ out:
     visit_free(v);
 }
 
+static void qmp_marshal_output_SharedCacheInfoList(SharedCacheInfoList *ret_in, QObject **ret_out, Error **errp)
+{
+    Error *err = NULL;
+    Visitor *v;
+
+    v = qobject_output_visitor_new(ret_out);
+    visit_type_SharedCacheInfoList(v, "unused", &ret_in, &err);
+    if (!err) {
+        visit_complete(v, ret_out);
+    }
+    error_propagate(errp, err);
+    visit_free(v);
+    v = qapi_dealloc_visitor_new();
+    visit_type_SharedCacheInfoList(v, "unused", &ret_in, NULL);
+    visit_free(v);
+}
+
+void qmp_marshal_query_shared_cache(QDict *args, QObject **ret, Error **errp)
+{
+    Error *err = NULL;
+    SharedCacheInfoList *retval;
+    Visitor *v = NULL;
+
+    if (args) {
+        v = qobject_input_visitor_new(QOBJECT(args));
+        visit_start_struct(v, NULL, NULL, 0, &err);
+        if (err) {
+            goto out;
+        }
+        
+        if (!err) {
+            visit_check_struct(v, &err);
+        }
+        visit_end_struct(v, NULL);
+        if (err) {
+            goto out;
+        }
+    }
+
+    retval = qmp_query_shared_cache(&err);
+    if (err) {
+        goto out;
+    }
+
+    qmp_marshal_output_SharedCacheInfoList(retval, ret, &err);
+
+out:
+    error_propagate(errp, err);
+    visit_free(v);
+    if (args) {
+        v = qapi_dealloc_visitor_new();
+        visit_start_struct(v, NULL, NULL, 0, NULL);
+        
+        visit_end_struct(v, NULL);
+        visit_free(v);
+    }
+}
+
 static void qmp_marshal_output_BlockJobInfoList(BlockJobInfoList *ret_in, QObject **ret_out, Error **errp)
 {
     Error *err = NULL;
@@ -25,6 +25,8 @@ BlockInfoList *qmp_query_block(Error **errp);
 void qmp_marshal_query_block(QDict *args, QObject **ret, Error **errp);
 BlockStatsList *qmp_query_blockstats(bool has_query_nodes, bool query_nodes, Error **errp);
 void qmp_marshal_query_blockstats(QDict *args, QObject **ret, Error **errp);
+SharedCacheInfoList *qmp_query_shared_cache(Error **errp);
+void qmp_marshal_query_shared_cache(QDict *args, QObject **ret, Error **errp);
 BlockJobInfoList *qmp_query_block_jobs(Error **errp);
 void qmp_marshal_query_block_jobs(QDict *args, QObject **ret, Error **errp);
 void qmp_block_passwd(bool has_device, const char *device, bool has_node_name, const char *node_name, const char *password, Error **errp);
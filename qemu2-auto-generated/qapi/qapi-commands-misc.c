@@ -3047,5 +3047,37 @@ out:
     visit_end_struct(v, NULL);
     visit_free(v);
 }
+
+void qmp_marshal_x_tcg_profile_dump(QDict *args, QObject **ret, Error **errp)
+{
+    Error *err = NULL;
+    Visitor *v;
+    q_obj_x_tcg_profile_dump_arg arg = {0};
+
+    v = qobject_input_visitor_new(QOBJECT(args));
+    visit_start_struct(v, NULL, NULL, 0, &err);
+    if (err) {
+        goto out;
+    }
+    visit_type_q_obj_x_tcg_profile_dump_arg_members(v, &arg, &err);
+    if (!err) {
+        visit_check_struct(v, &err);
+    }
+    visit_end_struct(v, NULL);
+    if (err) {
+        goto out;
+    }
+
+    qmp_x_tcg_profile_dump(arg.filename, &err);
+
+out:
+    error_propagate(errp, err);
+    visit_free(v);
+    v = qapi_dealloc_visitor_new();
+    visit_start_struct(v, NULL, NULL, 0, NULL);
+    visit_type_q_obj_x_tcg_profile_dump_arg_members(v, &arg, NULL);
+    visit_end_struct(v, NULL);
+    visit_free(v);
+}
 /* Dummy declaration to prevent empty .o file */
 char dummy_qapi_commands_misc_c;
@@ -146,5 +146,7 @@ SevCapability *qmp_query_sev_capabilities(Error **errp);
 void qmp_marshal_query_sev_capabilities(QDict *args, QObject **ret, Error **errp);
 void qmp_x_oob_test(bool lock, Error **errp);
 void qmp_marshal_x_oob_test(QDict *args, QObject **ret, Error **errp);
+void qmp_x_tcg_profile_dump(const char *filename, Error **errp);
+void qmp_marshal_x_tcg_profile_dump(QDict *args, QObject **ret, Error **errp);
 
 #endif /* QAPI_COMMANDS_MISC_H */
@@ -37,6 +37,8 @@ void qmp_init_marshal(QmpCommandList *cmds)
                          qmp_marshal_query_block, QCO_NO_OPTIONS);
     qmp_register_command(cmds, "query-blockstats",
                          qmp_marshal_query_blockstats, QCO_NO_OPTIONS);
+    qmp_register_command(cmds, "query-shared-cache",
+                         qmp_marshal_query_shared_cache, QCO_NO_OPTIONS);
     qmp_register_command(cmds, "query-block-jobs",
                          qmp_marshal_query_block_jobs, QCO_NO_OPTIONS);
     qmp_register_command(cmds, "block_passwd",
@@ -355,6 +357,8 @@ void qmp_init_marshal(QmpCommandList *cmds)
                          qmp_marshal_query_sev_capabilities, QCO_NO_OPTIONS);
     qmp_register_command(cmds, "x-oob-test",
                          qmp_marshal_x_oob_test, QCO_ALLOW_OOB);
+    qmp_register_command(cmds, "x-tcg-profile-dump",
+                         qmp_marshal_x_tcg_profile_dump, QCO_NO_OPTIONS);
 }
 /* Dummy declaration to prevent empty .o file */
 char dummy_qapi_commands_c;
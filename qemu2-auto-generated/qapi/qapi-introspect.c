@@ -117,13 +117,21 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "allow-oob", QLIT_QBOOL(false) },
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
-        { "name", QLIT_QSTR("query-block-jobs") },
+        { "name", QLIT_QSTR("query-shared-cache") },
         { "ret-type", QLIT_QSTR("[11]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("12") },
+        { "arg-type", QLIT_QSTR("0") },
+        { "meta-type", QLIT_QSTR("command") },
+        { "name", QLIT_QSTR("query-block-jobs") },
+        { "ret-type", QLIT_QSTR("[12]") },
+        {}
+    })),
+    QLIT_QDICT(((QLitDictEntry[]) {
+        { "allow-oob", QLIT_QBOOL(false) },
+        { "arg-type", QLIT_QSTR("13") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block_passwd") },
         { "ret-type", QLIT_QSTR("0") },
@@ -131,7 +139,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("13") },
+        { "arg-type", QLIT_QSTR("14") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block_resize") },
         { "ret-type", QLIT_QSTR("0") },
@@ -139,7 +147,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("14") },
+        { "arg-type", QLIT_QSTR("15") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("blockdev-snapshot-sync") },
         { "ret-type", QLIT_QSTR("0") },
@@ -147,7 +155,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("15") },
+        { "arg-type", QLIT_QSTR("16") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("blockdev-snapshot") },
         { "ret-type", QLIT_QSTR("0") },
@@ -155,7 +163,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("16") },
+        { "arg-type", QLIT_QSTR("17") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("change-backing-file") },
         { "ret-type", QLIT_QSTR("0") },
@@ -163,7 +171,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("17") },
+        { "arg-type", QLIT_QSTR("18") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block-commit") },
         { "ret-type", QLIT_QSTR("0") },
@@ -171,7 +179,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("18") },
+        { "arg-type", QLIT_QSTR("19") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("drive-backup") },
         { "ret-type", QLIT_QSTR("0") },
@@ -179,7 +187,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("19") },
+        { "arg-type", QLIT_QSTR("20") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("blockdev-backup") },
         { "ret-type", QLIT_QSTR("0") },
@@ -190,12 +198,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-named-block-nodes") },
-        { "ret-type", QLIT_QSTR("[20]") },
+        { "ret-type", QLIT_QSTR("[21]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("21") },
+        { "arg-type", QLIT_QSTR("22") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("drive-mirror") },
         { "ret-type", QLIT_QSTR("0") },
@@ -203,7 +211,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("22") },
+        { "arg-type", QLIT_QSTR("23") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block-dirty-bitmap-add") },
         { "ret-type", QLIT_QSTR("0") },
@@ -211,7 +219,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("23") },
+        { "arg-type", QLIT_QSTR("24") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block-dirty-bitmap-remove") },
         { "ret-type", QLIT_QSTR("0") },
@@ -219,7 +227,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("23") },
+        { "arg-type", QLIT_QSTR("24") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block-dirty-bitmap-clear") },
         { "ret-type", QLIT_QSTR("0") },
@@ -227,15 +235,15 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("23") },
+        { "arg-type", QLIT_QSTR("24") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("x-debug-block-dirty-bitmap-sha256") },
-        { "ret-type", QLIT_QSTR("24") },
+        { "ret-type", QLIT_QSTR("25") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("25") },
+        { "arg-type", QLIT_QSTR("26") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("blockdev-mirror") },
         { "ret-type", QLIT_QSTR("0") },
@@ -243,7 +251,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("26") },
+        { "arg-type", QLIT_QSTR("27") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block_set_io_throttle") },
         { "ret-type", QLIT_QSTR("0") },
@@ -251,7 +259,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("27") },
+        { "arg-type", QLIT_QSTR("28") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block-stream") },
         { "ret-type", QLIT_QSTR("0") },
@@ -259,7 +267,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("28") },
+        { "arg-type", QLIT_QSTR("29") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block-job-set-speed") },
         { "ret-type", QLIT_QSTR("0") },
@@ -267,7 +275,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("29") },
+        { "arg-type", QLIT_QSTR("30") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block-job-cancel") },
         { "ret-type", QLIT_QSTR("0") },
@@ -275,7 +283,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("30") },
+        { "arg-type", QLIT_QSTR("31") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block-job-pause") },
         { "ret-type", QLIT_QSTR("0") },
@@ -283,7 +291,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("31") },
+        { "arg-type", QLIT_QSTR("32") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block-job-resume") },
         { "ret-type", QLIT_QSTR("0") },
@@ -291,7 +299,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("32") },
+        { "arg-type", QLIT_QSTR("33") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block-job-complete") },
         { "ret-type", QLIT_QSTR("0") },
@@ -299,7 +307,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("33") },
+        { "arg-type", QLIT_QSTR("34") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block-job-dismiss") },
         { "ret-type", QLIT_QSTR("0") },
@@ -307,7 +315,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("34") },
+        { "arg-type", QLIT_QSTR("35") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block-job-finalize") },
         { "ret-type", QLIT_QSTR("0") },
@@ -315,7 +323,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("35") },
+        { "arg-type", QLIT_QSTR("36") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("blockdev-add") },
         { "ret-type", QLIT_QSTR("0") },
@@ -323,7 +331,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("36") },
+        { "arg-type", QLIT_QSTR("37") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("blockdev-del") },
         { "ret-type", QLIT_QSTR("0") },
@@ -331,7 +339,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("37") },
+        { "arg-type", QLIT_QSTR("38") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("x-blockdev-create") },
         { "ret-type", QLIT_QSTR("0") },
@@ -339,7 +347,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("38") },
+        { "arg-type", QLIT_QSTR("39") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("blockdev-open-tray") },
         { "ret-type", QLIT_QSTR("0") },
@@ -347,7 +355,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("39") },
+        { "arg-type", QLIT_QSTR("40") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("blockdev-close-tray") },
         { "ret-type", QLIT_QSTR("0") },
@@ -355,7 +363,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("40") },
+        { "arg-type", QLIT_QSTR("41") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("blockdev-remove-medium") },
         { "ret-type", QLIT_QSTR("0") },
@@ -363,7 +371,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("41") },
+        { "arg-type", QLIT_QSTR("42") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("blockdev-insert-medium") },
         { "ret-type", QLIT_QSTR("0") },
@@ -371,63 +379,63 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("42") },
+        { "arg-type", QLIT_QSTR("43") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("blockdev-change-medium") },
         { "ret-type", QLIT_QSTR("0") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("43") },
+        { "arg-type", QLIT_QSTR("44") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("BLOCK_IMAGE_CORRUPTED") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("44") },
+        { "arg-type", QLIT_QSTR("45") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("BLOCK_IO_ERROR") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("45") },
+        { "arg-type", QLIT_QSTR("46") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("BLOCK_JOB_COMPLETED") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("46") },
+        { "arg-type", QLIT_QSTR("47") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("BLOCK_JOB_CANCELLED") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("47") },
+        { "arg-type", QLIT_QSTR("48") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("BLOCK_JOB_ERROR") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("48") },
+        { "arg-type", QLIT_QSTR("49") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("BLOCK_JOB_READY") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("49") },
+        { "arg-type", QLIT_QSTR("50") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("BLOCK_JOB_PENDING") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("50") },
+        { "arg-type", QLIT_QSTR("51") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("BLOCK_WRITE_THRESHOLD") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("51") },
+        { "arg-type", QLIT_QSTR("52") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("block-set-write-threshold") },
         { "ret-type", QLIT_QSTR("0") },
@@ -435,7 +443,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("52") },
+        { "arg-type", QLIT_QSTR("53") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("x-blockdev-change") },
         { "ret-type", QLIT_QSTR("0") },
@@ -443,7 +451,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("53") },
+        { "arg-type", QLIT_QSTR("54") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("x-blockdev-set-iothread") },
         { "ret-type", QLIT_QSTR("0") },
@@ -451,7 +459,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("54") },
+        { "arg-type", QLIT_QSTR("55") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("blockdev-snapshot-internal-sync") },
         { "ret-type", QLIT_QSTR("0") },
@@ -459,15 +467,15 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("55") },
+        { "arg-type", QLIT_QSTR("56") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("blockdev-snapshot-delete-internal-sync") },
-        { "ret-type", QLIT_QSTR("56") },
+        { "ret-type", QLIT_QSTR("57") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("57") },
+        { "arg-type", QLIT_QSTR("58") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("eject") },
         { "ret-type", QLIT_QSTR("0") },
@@ -475,7 +483,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("58") },
+        { "arg-type", QLIT_QSTR("59") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("nbd-server-start") },
         { "ret-type", QLIT_QSTR("0") },
@@ -483,7 +491,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("59") },
+        { "arg-type", QLIT_QSTR("60") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("nbd-server-add") },
         { "ret-type", QLIT_QSTR("0") },
@@ -491,7 +499,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("60") },
+        { "arg-type", QLIT_QSTR("61") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("nbd-server-remove") },
         { "ret-type", QLIT_QSTR("0") },
@@ -506,19 +514,19 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("61") },
+        { "arg-type", QLIT_QSTR("62") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("DEVICE_TRAY_MOVED") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("62") },
+        { "arg-type", QLIT_QSTR("63") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("QUORUM_FAILURE") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("63") },
+        { "arg-type", QLIT_QSTR("64") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("QUORUM_REPORT_BAD") },
         {}
@@ -528,7 +536,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-chardev") },
-        { "ret-type", QLIT_QSTR("[64]") },
+        { "ret-type", QLIT_QSTR("[65]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -536,12 +544,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-chardev-backends") },
-        { "ret-type", QLIT_QSTR("[65]") },
+        { "ret-type", QLIT_QSTR("[66]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("66") },
+        { "arg-type", QLIT_QSTR("67") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("ringbuf-write") },
         { "ret-type", QLIT_QSTR("0") },
@@ -549,7 +557,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("67") },
+        { "arg-type", QLIT_QSTR("68") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("ringbuf-read") },
         { "ret-type", QLIT_QSTR("str") },
@@ -557,23 +565,23 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("68") },
+        { "arg-type", QLIT_QSTR("69") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("chardev-add") },
-        { "ret-type", QLIT_QSTR("69") },
+        { "ret-type", QLIT_QSTR("70") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("70") },
+        { "arg-type", QLIT_QSTR("71") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("chardev-change") },
-        { "ret-type", QLIT_QSTR("69") },
+        { "ret-type", QLIT_QSTR("70") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("71") },
+        { "arg-type", QLIT_QSTR("72") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("chardev-remove") },
         { "ret-type", QLIT_QSTR("0") },
@@ -581,21 +589,21 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("72") },
+        { "arg-type", QLIT_QSTR("73") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("chardev-send-break") },
         { "ret-type", QLIT_QSTR("0") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("73") },
+        { "arg-type", QLIT_QSTR("74") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("VSERPORT_CHANGE") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("74") },
+        { "arg-type", QLIT_QSTR("75") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("set_link") },
         { "ret-type", QLIT_QSTR("0") },
@@ -603,7 +611,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("75") },
+        { "arg-type", QLIT_QSTR("76") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("netdev_add") },
         { "ret-type", QLIT_QSTR("0") },
@@ -611,7 +619,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("76") },
+        { "arg-type", QLIT_QSTR("77") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("netdev_del") },
         { "ret-type", QLIT_QSTR("0") },
@@ -619,48 +627,48 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("77") },
+        { "arg-type", QLIT_QSTR("78") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-rx-filter") },
-        { "ret-type", QLIT_QSTR("[78]") },
+        { "ret-type", QLIT_QSTR("[79]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("79") },
+        { "arg-type", QLIT_QSTR("80") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("NIC_RX_FILTER_CHANGED") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("80") },
+        { "arg-type", QLIT_QSTR("81") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-rocker") },
-        { "ret-type", QLIT_QSTR("81") },
+        { "ret-type", QLIT_QSTR("82") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("82") },
+        { "arg-type", QLIT_QSTR("83") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-rocker-ports") },
-        { "ret-type", QLIT_QSTR("[83]") },
+        { "ret-type", QLIT_QSTR("[84]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("84") },
+        { "arg-type", QLIT_QSTR("85") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-rocker-of-dpa-flows") },
-        { "ret-type", QLIT_QSTR("[85]") },
+        { "ret-type", QLIT_QSTR("[86]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("86") },
+        { "arg-type", QLIT_QSTR("87") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-rocker-of-dpa-groups") },
-        { "ret-type", QLIT_QSTR("[87]") },
+        { "ret-type", QLIT_QSTR("[88]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -668,7 +676,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-tpm-models") },
-        { "ret-type", QLIT_QSTR("[88]") },
+        { "ret-type", QLIT_QSTR("[89]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -676,7 +684,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-tpm-types") },
-        { "ret-type", QLIT_QSTR("[89]") },
+        { "ret-type", QLIT_QSTR("[90]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -684,12 +692,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-tpm") },
-        { "ret-type", QLIT_QSTR("[90]") },
+        { "ret-type", QLIT_QSTR("[91]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("91") },
+        { "arg-type", QLIT_QSTR("92") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("set_password") },
         { "ret-type", QLIT_QSTR("0") },
@@ -697,7 +705,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("92") },
+        { "arg-type", QLIT_QSTR("93") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("expire_password") },
         { "ret-type", QLIT_QSTR("0") },
@@ -705,7 +713,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("93") },
+        { "arg-type", QLIT_QSTR("94") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("screendump") },
         { "ret-type", QLIT_QSTR("0") },
@@ -716,23 +724,23 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-spice") },
-        { "ret-type", QLIT_QSTR("94") },
+        { "ret-type", QLIT_QSTR("95") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("95") },
+        { "arg-type", QLIT_QSTR("96") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("SPICE_CONNECTED") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("96") },
+        { "arg-type", QLIT_QSTR("97") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("SPICE_INITIALIZED") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("97") },
+        { "arg-type", QLIT_QSTR("98") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("SPICE_DISCONNECTED") },
         {}
@@ -748,7 +756,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-vnc") },
-        { "ret-type", QLIT_QSTR("98") },
+        { "ret-type", QLIT_QSTR("99") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -756,31 +764,31 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-vnc-servers") },
-        { "ret-type", QLIT_QSTR("[99]") },
+        { "ret-type", QLIT_QSTR("[100]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("100") },
+        { "arg-type", QLIT_QSTR("101") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("change-vnc-password") },
         { "ret-type", QLIT_QSTR("0") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("101") },
+        { "arg-type", QLIT_QSTR("102") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("VNC_CONNECTED") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("102") },
+        { "arg-type", QLIT_QSTR("103") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("VNC_INITIALIZED") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("103") },
+        { "arg-type", QLIT_QSTR("104") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("VNC_DISCONNECTED") },
         {}
@@ -790,12 +798,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-mice") },
-        { "ret-type", QLIT_QSTR("[104]") },
+        { "ret-type", QLIT_QSTR("[105]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("105") },
+        { "arg-type", QLIT_QSTR("106") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("send-key") },
         { "ret-type", QLIT_QSTR("0") },
@@ -803,7 +811,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("106") },
+        { "arg-type", QLIT_QSTR("107") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("input-send-event") },
         { "ret-type", QLIT_QSTR("0") },
@@ -814,12 +822,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-migrate") },
-        { "ret-type", QLIT_QSTR("107") },
+        { "ret-type", QLIT_QSTR("108") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("108") },
+        { "arg-type", QLIT_QSTR("109") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("migrate-set-capabilities") },
         { "ret-type", QLIT_QSTR("0") },
@@ -830,12 +838,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-migrate-capabilities") },
-        { "ret-type", QLIT_QSTR("[109]") },
+        { "ret-type", QLIT_QSTR("[110]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("110") },
+        { "arg-type", QLIT_QSTR("111") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("migrate-set-parameters") },
         { "ret-type", QLIT_QSTR("0") },
@@ -846,12 +854,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-migrate-parameters") },
-        { "ret-type", QLIT_QSTR("111") },
+        { "ret-type", QLIT_QSTR("112") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("112") },
+        { "arg-type", QLIT_QSTR("113") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("client_migrate_info") },
         { "ret-type", QLIT_QSTR("0") },
@@ -866,13 +874,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("113") },
+        { "arg-type", QLIT_QSTR("114") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("MIGRATION") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("114") },
+        { "arg-type", QLIT_QSTR("115") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("MIGRATION_PASS") },
         {}
@@ -895,7 +903,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("115") },
+        { "arg-type", QLIT_QSTR("116") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("migrate-continue") },
         { "ret-type", QLIT_QSTR("0") },
@@ -903,7 +911,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("116") },
+        { "arg-type", QLIT_QSTR("117") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("migrate_set_downtime") },
         { "ret-type", QLIT_QSTR("0") },
@@ -911,7 +919,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("117") },
+        { "arg-type", QLIT_QSTR("118") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("migrate_set_speed") },
         { "ret-type", QLIT_QSTR("0") },
@@ -919,7 +927,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("118") },
+        { "arg-type", QLIT_QSTR("119") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("migrate-set-cache-size") },
         { "ret-type", QLIT_QSTR("0") },
@@ -935,7 +943,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("119") },
+        { "arg-type", QLIT_QSTR("120") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("migrate") },
         { "ret-type", QLIT_QSTR("0") },
@@ -943,7 +951,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("120") },
+        { "arg-type", QLIT_QSTR("121") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("migrate-incoming") },
         { "ret-type", QLIT_QSTR("0") },
@@ -951,7 +959,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("121") },
+        { "arg-type", QLIT_QSTR("122") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("xen-save-devices-state") },
         { "ret-type", QLIT_QSTR("0") },
@@ -959,7 +967,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("122") },
+        { "arg-type", QLIT_QSTR("123") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("xen-set-replication") },
         { "ret-type", QLIT_QSTR("0") },
@@ -970,7 +978,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-xen-replication-status") },
-        { "ret-type", QLIT_QSTR("123") },
+        { "ret-type", QLIT_QSTR("124") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -983,7 +991,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("124") },
+        { "arg-type", QLIT_QSTR("125") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("transaction") },
         { "ret-type", QLIT_QSTR("0") },
@@ -991,15 +999,15 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("125") },
+        { "arg-type", QLIT_QSTR("126") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("trace-event-get-state") },
-        { "ret-type", QLIT_QSTR("[126]") },
+        { "ret-type", QLIT_QSTR("[127]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("127") },
+        { "arg-type", QLIT_QSTR("128") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("trace-event-set-state") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1010,12 +1018,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-qmp-schema") },
-        { "ret-type", QLIT_QSTR("[128]") },
+        { "ret-type", QLIT_QSTR("[129]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("129") },
+        { "arg-type", QLIT_QSTR("130") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("qmp_capabilities") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1026,7 +1034,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-version") },
-        { "ret-type", QLIT_QSTR("130") },
+        { "ret-type", QLIT_QSTR("131") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1034,12 +1042,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-commands") },
-        { "ret-type", QLIT_QSTR("[131]") },
+        { "ret-type", QLIT_QSTR("[132]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("132") },
+        { "arg-type", QLIT_QSTR("133") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("add_client") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1050,7 +1058,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-name") },
-        { "ret-type", QLIT_QSTR("133") },
+        { "ret-type", QLIT_QSTR("134") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1058,7 +1066,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-kvm") },
-        { "ret-type", QLIT_QSTR("134") },
+        { "ret-type", QLIT_QSTR("135") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1066,7 +1074,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-uuid") },
-        { "ret-type", QLIT_QSTR("135") },
+        { "ret-type", QLIT_QSTR("136") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1074,7 +1082,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-events") },
-        { "ret-type", QLIT_QSTR("[136]") },
+        { "ret-type", QLIT_QSTR("[137]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1082,7 +1090,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-cpus") },
-        { "ret-type", QLIT_QSTR("[137]") },
+        { "ret-type", QLIT_QSTR("[138]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1090,7 +1098,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-cpus-fast") },
-        { "ret-type", QLIT_QSTR("[138]") },
+        { "ret-type", QLIT_QSTR("[139]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1098,7 +1106,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-iothreads") },
-        { "ret-type", QLIT_QSTR("[139]") },
+        { "ret-type", QLIT_QSTR("[140]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1106,11 +1114,11 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-balloon") },
-        { "ret-type", QLIT_QSTR("140") },
+        { "ret-type", QLIT_QSTR("141") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("141") },
+        { "arg-type", QLIT_QSTR("142") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("BALLOON_CHANGE") },
         {}
@@ -1120,7 +1128,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-pci") },
-        { "ret-type", QLIT_QSTR("[142]") },
+        { "ret-type", QLIT_QSTR("[143]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1157,7 +1165,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("143") },
+        { "arg-type", QLIT_QSTR("144") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("cpu-add") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1165,7 +1173,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("144") },
+        { "arg-type", QLIT_QSTR("145") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("memsave") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1173,7 +1181,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("145") },
+        { "arg-type", QLIT_QSTR("146") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("pmemsave") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1205,7 +1213,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("146") },
+        { "arg-type", QLIT_QSTR("147") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("balloon") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1213,7 +1221,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("147") },
+        { "arg-type", QLIT_QSTR("148") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("human-monitor-command") },
         { "ret-type", QLIT_QSTR("str") },
@@ -1221,15 +1229,15 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("148") },
+        { "arg-type", QLIT_QSTR("149") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("qom-list") },
-        { "ret-type", QLIT_QSTR("[149]") },
+        { "ret-type", QLIT_QSTR("[150]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("150") },
+        { "arg-type", QLIT_QSTR("151") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("qom-get") },
         { "ret-type", QLIT_QSTR("any") },
@@ -1237,7 +1245,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("151") },
+        { "arg-type", QLIT_QSTR("152") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("qom-set") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1245,7 +1253,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("152") },
+        { "arg-type", QLIT_QSTR("153") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("change") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1253,31 +1261,31 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("153") },
+        { "arg-type", QLIT_QSTR("154") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("qom-list-types") },
-        { "ret-type", QLIT_QSTR("[154]") },
+        { "ret-type", QLIT_QSTR("[155]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("155") },
+        { "arg-type", QLIT_QSTR("156") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("device-list-properties") },
-        { "ret-type", QLIT_QSTR("[149]") },
+        { "ret-type", QLIT_QSTR("[150]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("156") },
+        { "arg-type", QLIT_QSTR("157") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("qom-list-properties") },
-        { "ret-type", QLIT_QSTR("[149]") },
+        { "ret-type", QLIT_QSTR("[150]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("157") },
+        { "arg-type", QLIT_QSTR("158") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("xen-set-global-dirty-log") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1285,7 +1293,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("158") },
+        { "arg-type", QLIT_QSTR("159") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("device_add") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1293,21 +1301,21 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("159") },
+        { "arg-type", QLIT_QSTR("160") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("device_del") },
         { "ret-type", QLIT_QSTR("0") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("160") },
+        { "arg-type", QLIT_QSTR("161") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("DEVICE_DELETED") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("161") },
+        { "arg-type", QLIT_QSTR("162") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("dump-guest-memory") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1318,11 +1326,11 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-dump") },
-        { "ret-type", QLIT_QSTR("162") },
+        { "ret-type", QLIT_QSTR("163") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("163") },
+        { "arg-type", QLIT_QSTR("164") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("DUMP_COMPLETED") },
         {}
@@ -1332,12 +1340,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-dump-guest-memory-capability") },
-        { "ret-type", QLIT_QSTR("164") },
+        { "ret-type", QLIT_QSTR("165") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("165") },
+        { "arg-type", QLIT_QSTR("166") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("dump-skeys") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1345,7 +1353,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("166") },
+        { "arg-type", QLIT_QSTR("167") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("object-add") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1353,7 +1361,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("167") },
+        { "arg-type", QLIT_QSTR("168") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("object-del") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1361,7 +1369,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("168") },
+        { "arg-type", QLIT_QSTR("169") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("getfd") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1369,7 +1377,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("169") },
+        { "arg-type", QLIT_QSTR("170") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("closefd") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1380,7 +1388,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-machines") },
-        { "ret-type", QLIT_QSTR("[170]") },
+        { "ret-type", QLIT_QSTR("[171]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1388,7 +1396,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-memory-size-summary") },
-        { "ret-type", QLIT_QSTR("171") },
+        { "ret-type", QLIT_QSTR("172") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1396,44 +1404,44 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-cpu-definitions") },
-        { "ret-type", QLIT_QSTR("[172]") },
+        { "ret-type", QLIT_QSTR("[173]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("173") },
+        { "arg-type", QLIT_QSTR("174") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-cpu-model-expansion") },
-        { "ret-type", QLIT_QSTR("174") },
+        { "ret-type", QLIT_QSTR("175") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("175") },
+        { "arg-type", QLIT_QSTR("176") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-cpu-model-comparison") },
-        { "ret-type", QLIT_QSTR("176") },
+        { "ret-type", QLIT_QSTR("177") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("177") },
+        { "arg-type", QLIT_QSTR("178") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-cpu-model-baseline") },
-        { "ret-type", QLIT_QSTR("178") },
+        { "ret-type", QLIT_QSTR("179") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("179") },
+        { "arg-type", QLIT_QSTR("180") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("add-fd") },
-        { "ret-type", QLIT_QSTR("180") },
+        { "ret-type", QLIT_QSTR("181") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("181") },
+        { "arg-type", QLIT_QSTR("182") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("remove-fd") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1444,7 +1452,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-fdsets") },
-        { "ret-type", QLIT_QSTR("[182]") },
+        { "ret-type", QLIT_QSTR("[183]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1452,15 +1460,15 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-target") },
-        { "ret-type", QLIT_QSTR("183") },
+        { "ret-type", QLIT_QSTR("184") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("184") },
+        { "arg-type", QLIT_QSTR("185") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-command-line-options") },
-        { "ret-type", QLIT_QSTR("[185]") },
+        { "ret-type", QLIT_QSTR("[186]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1468,7 +1476,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-memdev") },
-        { "ret-type", QLIT_QSTR("[186]") },
+        { "ret-type", QLIT_QSTR("[187]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1476,11 +1484,11 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-memory-devices") },
-        { "ret-type", QLIT_QSTR("[187]") },
+        { "ret-type", QLIT_QSTR("[188]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("188") },
+        { "arg-type", QLIT_QSTR("189") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("MEM_UNPLUG_ERROR") },
         {}
@@ -1490,11 +1498,11 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-acpi-ospm-status") },
-        { "ret-type", QLIT_QSTR("[189]") },
+        { "ret-type", QLIT_QSTR("[190]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("190") },
+        { "arg-type", QLIT_QSTR("191") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("ACPI_DEVICE_OST") },
         {}
@@ -1508,14 +1516,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("191") },
+        { "arg-type", QLIT_QSTR("192") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("RTC_CHANGE") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(false) },
-        { "arg-type", QLIT_QSTR("192") },
+        { "arg-type", QLIT_QSTR("193") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("xen-load-devices-state") },
         { "ret-type", QLIT_QSTR("0") },
@@ -1526,7 +1534,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-gic-capabilities") },
-        { "ret-type", QLIT_QSTR("[193]") },
+        { "ret-type", QLIT_QSTR("[194]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1534,7 +1542,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-hotpluggable-cpus") },
-        { "ret-type", QLIT_QSTR("[194]") },
+        { "ret-type", QLIT_QSTR("[195]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1542,7 +1550,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-vm-generation-id") },
-        { "ret-type", QLIT_QSTR("195") },
+        { "ret-type", QLIT_QSTR("196") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1550,7 +1558,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-sev") },
-        { "ret-type", QLIT_QSTR("196") },
+        { "ret-type", QLIT_QSTR("197") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1558,7 +1566,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-sev-launch-measure") },
-        { "ret-type", QLIT_QSTR("197") },
+        { "ret-type", QLIT_QSTR("198") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1566,23 +1574,31 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "arg-type", QLIT_QSTR("0") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("query-sev-capabilities") },
-        { "ret-type", QLIT_QSTR("198") },
+        { "ret-type", QLIT_QSTR("199") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "arg-type", QLIT_QSTR("199") },
+        { "arg-type", QLIT_QSTR("200") },
         { "meta-type", QLIT_QSTR("event") },
         { "name", QLIT_QSTR("COMMAND_DROPPED") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "allow-oob", QLIT_QBOOL(true) },
-        { "arg-type", QLIT_QSTR("200") },
+        { "arg-type", QLIT_QSTR("201") },
         { "meta-type", QLIT_QSTR("command") },
         { "name", QLIT_QSTR("x-oob-test") },
         { "ret-type", QLIT_QSTR("0") },
         {}
     })),
+    QLIT_QDICT(((QLitDictEntry[]) {
+        { "allow-oob", QLIT_QBOOL(false) },
+        { "arg-type", QLIT_QSTR("202") },
+        { "meta-type", QLIT_QSTR("command") },
+        { "name", QLIT_QSTR("x-tcg-profile-dump") },
+        { "ret-type", QLIT_QSTR("0") },
+        {}
+    })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             {}
@@ -1605,7 +1621,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("status") },
-                { "type", QLIT_QSTR("201") },
+                { "type", QLIT_QSTR("203") },
                 {}
             })),
             {}
@@ -1644,7 +1660,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("action") },
-                { "type", QLIT_QSTR("202") },
+                { "type", QLIT_QSTR("204") },
                 {}
             })),
             {}
@@ -1657,7 +1673,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("action") },
-                { "type", QLIT_QSTR("202") },
+                { "type", QLIT_QSTR("204") },
                 {}
             })),
             {}
@@ -1670,13 +1686,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("action") },
-                { "type", QLIT_QSTR("203") },
+                { "type", QLIT_QSTR("205") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("info") },
-                { "type", QLIT_QSTR("204") },
+                { "type", QLIT_QSTR("206") },
                 {}
             })),
             {}
@@ -1759,7 +1775,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("inserted") },
-                { "type", QLIT_QSTR("20") },
+                { "type", QLIT_QSTR("21") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -1771,13 +1787,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("io-status") },
-                { "type", QLIT_QSTR("205") },
+                { "type", QLIT_QSTR("207") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("dirty-bitmaps") },
-                { "type", QLIT_QSTR("[206]") },
+                { "type", QLIT_QSTR("[208]") },
                 {}
             })),
             {}
@@ -1822,7 +1838,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("stats") },
-                { "type", QLIT_QSTR("207") },
+                { "type", QLIT_QSTR("209") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "default", QLIT_QNULL },
+                { "name", QLIT_QSTR("driver-specific") },
+                { "type", QLIT_QSTR("210") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -1852,17 +1874,82 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
-                { "name", QLIT_QSTR("type") },
+                { "name", QLIT_QSTR("node-name") },
                 { "type", QLIT_QSTR("str") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
+                { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("device") },
                 { "type", QLIT_QSTR("str") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
-                { "name", QLIT_QSTR("len") },
+                { "name", QLIT_QSTR("image") },
+                { "type", QLIT_QSTR("str") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("shared") },
+                { "type", QLIT_QSTR("bool") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("size") },
+                { "type", QLIT_QSTR("int") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("block-size") },
+                { "type", QLIT_QSTR("int") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("instances") },
+                { "type", QLIT_QSTR("int") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("hits") },
+                { "type", QLIT_QSTR("int") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("misses") },
+                { "type", QLIT_QSTR("int") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("inserts") },
+                { "type", QLIT_QSTR("int") },
+                {}
+            })),
+            {}
+        })) },
+        { "meta-type", QLIT_QSTR("object") },
+        { "name", QLIT_QSTR("11") },
+        {}
+    })),
+    QLIT_QDICT(((QLitDictEntry[]) {
+        { "element-type", QLIT_QSTR("12") },
+        { "meta-type", QLIT_QSTR("array") },
+        { "name", QLIT_QSTR("[12]") },
+        {}
+    })),
+    QLIT_QDICT(((QLitDictEntry[]) {
+        { "members", QLIT_QLIST(((QLitObject[]) {
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("type") },
+                { "type", QLIT_QSTR("str") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("device") },
+                { "type", QLIT_QSTR("str") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("len") },
                 { "type", QLIT_QSTR("int") },
                 {}
             })),
@@ -1888,7 +1975,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("io-status") },
-                { "type", QLIT_QSTR("205") },
+                { "type", QLIT_QSTR("207") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -1898,7 +1985,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("status") },
-                { "type", QLIT_QSTR("208") },
+                { "type", QLIT_QSTR("211") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -1914,7 +2001,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("11") },
+        { "name", QLIT_QSTR("12") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1939,7 +2026,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("12") },
+        { "name", QLIT_QSTR("13") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -1964,7 +2051,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("13") },
+        { "name", QLIT_QSTR("14") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2001,13 +2088,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("mode") },
-                { "type", QLIT_QSTR("209") },
+                { "type", QLIT_QSTR("212") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("14") },
+        { "name", QLIT_QSTR("15") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2025,7 +2112,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("15") },
+        { "name", QLIT_QSTR("16") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2048,7 +2135,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("16") },
+        { "name", QLIT_QSTR("17") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2097,7 +2184,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("17") },
+        { "name", QLIT_QSTR("18") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2126,13 +2213,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("sync") },
-                { "type", QLIT_QSTR("210") },
+                { "type", QLIT_QSTR("213") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("mode") },
-                { "type", QLIT_QSTR("209") },
+                { "type", QLIT_QSTR("212") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -2156,13 +2243,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("on-source-error") },
-                { "type", QLIT_QSTR("211") },
+                { "type", QLIT_QSTR("214") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("on-target-error") },
-                { "type", QLIT_QSTR("211") },
+                { "type", QLIT_QSTR("214") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -2180,7 +2267,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("18") },
+        { "name", QLIT_QSTR("19") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2203,7 +2290,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("sync") },
-                { "type", QLIT_QSTR("210") },
+                { "type", QLIT_QSTR("213") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -2221,13 +2308,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("on-source-error") },
-                { "type", QLIT_QSTR("211") },
+                { "type", QLIT_QSTR("214") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("on-target-error") },
-                { "type", QLIT_QSTR("211") },
+                { "type", QLIT_QSTR("214") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -2245,13 +2332,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("19") },
+        { "name", QLIT_QSTR("20") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("20") },
+        { "element-type", QLIT_QSTR("21") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[20]") },
+        { "name", QLIT_QSTR("[21]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2300,7 +2387,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("detect_zeroes") },
-                { "type", QLIT_QSTR("212") },
+                { "type", QLIT_QSTR("215") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -2335,7 +2422,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("image") },
-                { "type", QLIT_QSTR("213") },
+                { "type", QLIT_QSTR("216") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -2424,7 +2511,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("cache") },
-                { "type", QLIT_QSTR("214") },
+                { "type", QLIT_QSTR("217") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -2435,7 +2522,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("20") },
+        { "name", QLIT_QSTR("21") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2476,13 +2563,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("sync") },
-                { "type", QLIT_QSTR("210") },
+                { "type", QLIT_QSTR("213") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("mode") },
-                { "type", QLIT_QSTR("209") },
+                { "type", QLIT_QSTR("212") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -2506,13 +2593,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("on-source-error") },
-                { "type", QLIT_QSTR("211") },
+                { "type", QLIT_QSTR("214") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("on-target-error") },
-                { "type", QLIT_QSTR("211") },
+                { "type", QLIT_QSTR("214") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -2524,7 +2611,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("21") },
+        { "name", QLIT_QSTR("22") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2560,7 +2647,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("22") },
+        { "name", QLIT_QSTR("23") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2578,7 +2665,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("23") },
+        { "name", QLIT_QSTR("24") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2591,7 +2678,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("24") },
+        { "name", QLIT_QSTR("25") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2620,7 +2707,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("sync") },
-                { "type", QLIT_QSTR("210") },
+                { "type", QLIT_QSTR("213") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -2644,13 +2731,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("on-source-error") },
-                { "type", QLIT_QSTR("211") },
+                { "type", QLIT_QSTR("214") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("on-target-error") },
-                { "type", QLIT_QSTR("211") },
+                { "type", QLIT_QSTR("214") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -2662,7 +2749,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("25") },
+        { "name", QLIT_QSTR("26") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2796,7 +2883,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("26") },
+        { "name", QLIT_QSTR("27") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2839,13 +2926,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("on-error") },
-                { "type", QLIT_QSTR("211") },
+                { "type", QLIT_QSTR("214") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("27") },
+        { "name", QLIT_QSTR("28") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2863,7 +2950,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("28") },
+        { "name", QLIT_QSTR("29") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2882,7 +2969,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("29") },
+        { "name", QLIT_QSTR("30") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2895,7 +2982,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("30") },
+        { "name", QLIT_QSTR("31") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2908,7 +2995,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("31") },
+        { "name", QLIT_QSTR("32") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2921,7 +3008,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("32") },
+        { "name", QLIT_QSTR("33") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2934,7 +3021,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("33") },
+        { "name", QLIT_QSTR("34") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -2947,14 +3034,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("34") },
+        { "name", QLIT_QSTR("35") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("driver") },
-                { "type", QLIT_QSTR("215") },
+                { "type", QLIT_QSTR("218") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -2966,13 +3053,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("discard") },
-                { "type", QLIT_QSTR("216") },
+                { "type", QLIT_QSTR("219") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("cache") },
-                { "type", QLIT_QSTR("217") },
+                { "type", QLIT_QSTR("220") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -2990,198 +3077,203 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("detect-zeroes") },
-                { "type", QLIT_QSTR("212") },
+                { "type", QLIT_QSTR("215") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("35") },
+        { "name", QLIT_QSTR("36") },
         { "tag", QLIT_QSTR("driver") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("blkdebug") },
-                { "type", QLIT_QSTR("218") },
+                { "type", QLIT_QSTR("221") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("blkverify") },
-                { "type", QLIT_QSTR("219") },
+                { "type", QLIT_QSTR("222") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("bochs") },
-                { "type", QLIT_QSTR("220") },
+                { "type", QLIT_QSTR("223") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("cloop") },
-                { "type", QLIT_QSTR("220") },
+                { "type", QLIT_QSTR("223") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("dmg") },
-                { "type", QLIT_QSTR("220") },
+                { "type", QLIT_QSTR("223") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("221") },
+                { "type", QLIT_QSTR("224") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("ftp") },
-                { "type", QLIT_QSTR("222") },
+                { "type", QLIT_QSTR("225") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("ftps") },
-                { "type", QLIT_QSTR("223") },
+                { "type", QLIT_QSTR("226") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("gluster") },
-                { "type", QLIT_QSTR("224") },
+                { "type", QLIT_QSTR("227") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("host_cdrom") },
-                { "type", QLIT_QSTR("221") },
+                { "type", QLIT_QSTR("224") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("host_device") },
-                { "type", QLIT_QSTR("221") },
+                { "type", QLIT_QSTR("224") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("http") },
-                { "type", QLIT_QSTR("225") },
+                { "type", QLIT_QSTR("228") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("https") },
-                { "type", QLIT_QSTR("226") },
+                { "type", QLIT_QSTR("229") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("iscsi") },
-                { "type", QLIT_QSTR("227") },
+                { "type", QLIT_QSTR("230") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("luks") },
-                { "type", QLIT_QSTR("228") },
+                { "type", QLIT_QSTR("231") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("nbd") },
-                { "type", QLIT_QSTR("229") },
+                { "type", QLIT_QSTR("232") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("nfs") },
-                { "type", QLIT_QSTR("230") },
+                { "type", QLIT_QSTR("233") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("null-aio") },
-                { "type", QLIT_QSTR("231") },
+                { "type", QLIT_QSTR("234") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("null-co") },
-                { "type", QLIT_QSTR("231") },
+                { "type", QLIT_QSTR("234") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("nvme") },
-                { "type", QLIT_QSTR("232") },
+                { "type", QLIT_QSTR("235") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("parallels") },
-                { "type", QLIT_QSTR("220") },
+                { "type", QLIT_QSTR("223") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("qcow2") },
-                { "type", QLIT_QSTR("233") },
+                { "type", QLIT_QSTR("236") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("qcow") },
-                { "type", QLIT_QSTR("234") },
+                { "type", QLIT_QSTR("237") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("qed") },
-                { "type", QLIT_QSTR("235") },
+                { "type", QLIT_QSTR("238") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("quorum") },
-                { "type", QLIT_QSTR("236") },
+                { "type", QLIT_QSTR("239") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("raw") },
-                { "type", QLIT_QSTR("237") },
+                { "type", QLIT_QSTR("240") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("rbd") },
-                { "type", QLIT_QSTR("238") },
+                { "type", QLIT_QSTR("241") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("replication") },
-                { "type", QLIT_QSTR("239") },
+                { "type", QLIT_QSTR("242") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "case", QLIT_QSTR("shared-cache") },
+                { "type", QLIT_QSTR("243") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("sheepdog") },
-                { "type", QLIT_QSTR("240") },
+                { "type", QLIT_QSTR("244") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("ssh") },
-                { "type", QLIT_QSTR("241") },
+                { "type", QLIT_QSTR("245") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("throttle") },
-                { "type", QLIT_QSTR("242") },
+                { "type", QLIT_QSTR("246") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vdi") },
-                { "type", QLIT_QSTR("220") },
+                { "type", QLIT_QSTR("223") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vhdx") },
-                { "type", QLIT_QSTR("220") },
+                { "type", QLIT_QSTR("223") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vmdk") },
-                { "type", QLIT_QSTR("235") },
+                { "type", QLIT_QSTR("238") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vpc") },
-                { "type", QLIT_QSTR("220") },
+                { "type", QLIT_QSTR("223") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vvfat") },
-                { "type", QLIT_QSTR("243") },
+                { "type", QLIT_QSTR("247") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vxhs") },
-                { "type", QLIT_QSTR("244") },
+                { "type", QLIT_QSTR("248") },
                 {}
             })),
             {}
@@ -3198,205 +3290,210 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("36") },
+        { "name", QLIT_QSTR("37") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("driver") },
-                { "type", QLIT_QSTR("215") },
+                { "type", QLIT_QSTR("218") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("37") },
+        { "name", QLIT_QSTR("38") },
         { "tag", QLIT_QSTR("driver") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("blkdebug") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("blkverify") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("bochs") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("cloop") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("dmg") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("246") },
+                { "type", QLIT_QSTR("250") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("ftp") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("ftps") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("gluster") },
-                { "type", QLIT_QSTR("247") },
+                { "type", QLIT_QSTR("251") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("host_cdrom") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("host_device") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("http") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("https") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("iscsi") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("luks") },
-                { "type", QLIT_QSTR("248") },
+                { "type", QLIT_QSTR("252") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("nbd") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("nfs") },
-                { "type", QLIT_QSTR("249") },
+                { "type", QLIT_QSTR("253") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("null-aio") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("null-co") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("nvme") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("parallels") },
-                { "type", QLIT_QSTR("250") },
+                { "type", QLIT_QSTR("254") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("qcow") },
-                { "type", QLIT_QSTR("251") },
+                { "type", QLIT_QSTR("255") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("qcow2") },
-                { "type", QLIT_QSTR("252") },
+                { "type", QLIT_QSTR("256") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("qed") },
-                { "type", QLIT_QSTR("253") },
+                { "type", QLIT_QSTR("257") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("quorum") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("raw") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("rbd") },
-                { "type", QLIT_QSTR("254") },
+                { "type", QLIT_QSTR("258") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("replication") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "case", QLIT_QSTR("shared-cache") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("sheepdog") },
-                { "type", QLIT_QSTR("255") },
+                { "type", QLIT_QSTR("259") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("ssh") },
-                { "type", QLIT_QSTR("256") },
+                { "type", QLIT_QSTR("260") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("throttle") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vdi") },
-                { "type", QLIT_QSTR("257") },
+                { "type", QLIT_QSTR("261") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vhdx") },
-                { "type", QLIT_QSTR("258") },
+                { "type", QLIT_QSTR("262") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vmdk") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vpc") },
-                { "type", QLIT_QSTR("259") },
+                { "type", QLIT_QSTR("263") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vvfat") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vxhs") },
-                { "type", QLIT_QSTR("245") },
+                { "type", QLIT_QSTR("249") },
                 {}
             })),
             {}
@@ -3426,7 +3523,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("38") },
+        { "name", QLIT_QSTR("39") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3446,7 +3543,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("39") },
+        { "name", QLIT_QSTR("40") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3459,7 +3556,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("40") },
+        { "name", QLIT_QSTR("41") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3477,7 +3574,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("41") },
+        { "name", QLIT_QSTR("42") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3508,13 +3605,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("read-only-mode") },
-                { "type", QLIT_QSTR("260") },
+                { "type", QLIT_QSTR("264") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("42") },
+        { "name", QLIT_QSTR("43") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3555,7 +3652,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("43") },
+        { "name", QLIT_QSTR("44") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3573,12 +3670,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("operation") },
-                { "type", QLIT_QSTR("261") },
+                { "type", QLIT_QSTR("265") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("action") },
-                { "type", QLIT_QSTR("262") },
+                { "type", QLIT_QSTR("266") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -3595,14 +3692,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("44") },
+        { "name", QLIT_QSTR("45") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("263") },
+                { "type", QLIT_QSTR("267") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -3634,14 +3731,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("45") },
+        { "name", QLIT_QSTR("46") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("263") },
+                { "type", QLIT_QSTR("267") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -3667,7 +3764,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("46") },
+        { "name", QLIT_QSTR("47") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3679,25 +3776,25 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("operation") },
-                { "type", QLIT_QSTR("261") },
+                { "type", QLIT_QSTR("265") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("action") },
-                { "type", QLIT_QSTR("262") },
+                { "type", QLIT_QSTR("266") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("47") },
+        { "name", QLIT_QSTR("48") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("263") },
+                { "type", QLIT_QSTR("267") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -3723,14 +3820,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("48") },
+        { "name", QLIT_QSTR("49") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("263") },
+                { "type", QLIT_QSTR("267") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -3741,7 +3838,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("49") },
+        { "name", QLIT_QSTR("50") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3764,7 +3861,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("50") },
+        { "name", QLIT_QSTR("51") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3782,7 +3879,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("51") },
+        { "name", QLIT_QSTR("52") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3807,7 +3904,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("52") },
+        { "name", QLIT_QSTR("53") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3819,7 +3916,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("iothread") },
-                { "type", QLIT_QSTR("264") },
+                { "type", QLIT_QSTR("268") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -3831,7 +3928,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("53") },
+        { "name", QLIT_QSTR("54") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3849,7 +3946,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("54") },
+        { "name", QLIT_QSTR("55") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3874,7 +3971,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("55") },
+        { "name", QLIT_QSTR("56") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3917,7 +4014,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("56") },
+        { "name", QLIT_QSTR("57") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3943,14 +4040,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("57") },
+        { "name", QLIT_QSTR("58") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("addr") },
-                { "type", QLIT_QSTR("265") },
+                { "type", QLIT_QSTR("269") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -3962,7 +4059,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("58") },
+        { "name", QLIT_QSTR("59") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -3987,7 +4084,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("59") },
+        { "name", QLIT_QSTR("60") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4000,13 +4097,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("mode") },
-                { "type", QLIT_QSTR("266") },
+                { "type", QLIT_QSTR("270") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("60") },
+        { "name", QLIT_QSTR("61") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4029,7 +4126,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("61") },
+        { "name", QLIT_QSTR("62") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4052,14 +4149,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("62") },
+        { "name", QLIT_QSTR("63") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("267") },
+                { "type", QLIT_QSTR("271") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -4086,13 +4183,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("63") },
+        { "name", QLIT_QSTR("64") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("64") },
+        { "element-type", QLIT_QSTR("65") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[64]") },
+        { "name", QLIT_QSTR("[65]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4115,13 +4212,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("64") },
+        { "name", QLIT_QSTR("65") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("65") },
+        { "element-type", QLIT_QSTR("66") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[65]") },
+        { "name", QLIT_QSTR("[66]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4134,7 +4231,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("65") },
+        { "name", QLIT_QSTR("66") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4152,13 +4249,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("format") },
-                { "type", QLIT_QSTR("268") },
+                { "type", QLIT_QSTR("272") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("66") },
+        { "name", QLIT_QSTR("67") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4176,13 +4273,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("format") },
-                { "type", QLIT_QSTR("268") },
+                { "type", QLIT_QSTR("272") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("67") },
+        { "name", QLIT_QSTR("68") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4200,13 +4297,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("backend") },
-                { "type", QLIT_QSTR("269") },
+                { "type", QLIT_QSTR("273") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("68") },
+        { "name", QLIT_QSTR("69") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4220,7 +4317,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("69") },
+        { "name", QLIT_QSTR("70") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4232,13 +4329,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("backend") },
-                { "type", QLIT_QSTR("269") },
+                { "type", QLIT_QSTR("273") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("70") },
+        { "name", QLIT_QSTR("71") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4251,7 +4348,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("71") },
+        { "name", QLIT_QSTR("72") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4264,7 +4361,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("72") },
+        { "name", QLIT_QSTR("73") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4282,7 +4379,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("73") },
+        { "name", QLIT_QSTR("74") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4300,7 +4397,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("74") },
+        { "name", QLIT_QSTR("75") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4318,7 +4415,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("75") },
+        { "name", QLIT_QSTR("76") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4331,7 +4428,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("76") },
+        { "name", QLIT_QSTR("77") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4345,13 +4442,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("77") },
+        { "name", QLIT_QSTR("78") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("78") },
+        { "element-type", QLIT_QSTR("79") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[78]") },
+        { "name", QLIT_QSTR("[79]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4368,17 +4465,17 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("multicast") },
-                { "type", QLIT_QSTR("270") },
+                { "type", QLIT_QSTR("274") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("unicast") },
-                { "type", QLIT_QSTR("270") },
+                { "type", QLIT_QSTR("274") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("vlan") },
-                { "type", QLIT_QSTR("270") },
+                { "type", QLIT_QSTR("274") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -4419,7 +4516,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("78") },
+        { "name", QLIT_QSTR("79") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4438,7 +4535,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("79") },
+        { "name", QLIT_QSTR("80") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4451,7 +4548,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("80") },
+        { "name", QLIT_QSTR("81") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4474,7 +4571,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("81") },
+        { "name", QLIT_QSTR("82") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4487,13 +4584,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("82") },
+        { "name", QLIT_QSTR("83") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("83") },
+        { "element-type", QLIT_QSTR("84") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[83]") },
+        { "name", QLIT_QSTR("[84]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4520,18 +4617,18 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("duplex") },
-                { "type", QLIT_QSTR("271") },
+                { "type", QLIT_QSTR("275") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("autoneg") },
-                { "type", QLIT_QSTR("272") },
+                { "type", QLIT_QSTR("276") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("83") },
+        { "name", QLIT_QSTR("84") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4550,13 +4647,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("84") },
+        { "name", QLIT_QSTR("85") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("85") },
+        { "element-type", QLIT_QSTR("86") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[85]") },
+        { "name", QLIT_QSTR("[86]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4573,23 +4670,23 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("key") },
-                { "type", QLIT_QSTR("273") },
+                { "type", QLIT_QSTR("277") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("mask") },
-                { "type", QLIT_QSTR("274") },
+                { "type", QLIT_QSTR("278") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("action") },
-                { "type", QLIT_QSTR("275") },
+                { "type", QLIT_QSTR("279") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("85") },
+        { "name", QLIT_QSTR("86") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4608,13 +4705,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("86") },
+        { "name", QLIT_QSTR("87") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("87") },
+        { "element-type", QLIT_QSTR("88") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[87]") },
+        { "name", QLIT_QSTR("[88]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4698,18 +4795,18 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("87") },
+        { "name", QLIT_QSTR("88") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("88") },
+        { "element-type", QLIT_QSTR("89") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[88]") },
+        { "name", QLIT_QSTR("[89]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("88") },
+        { "name", QLIT_QSTR("89") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("tpm-tis"),
             QLIT_QSTR("tpm-crb"),
@@ -4718,14 +4815,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("89") },
+        { "element-type", QLIT_QSTR("90") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[89]") },
+        { "name", QLIT_QSTR("[90]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("89") },
+        { "name", QLIT_QSTR("90") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("passthrough"),
             QLIT_QSTR("emulator"),
@@ -4734,9 +4831,9 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("90") },
+        { "element-type", QLIT_QSTR("91") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[90]") },
+        { "name", QLIT_QSTR("[91]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4748,18 +4845,18 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("model") },
-                { "type", QLIT_QSTR("88") },
+                { "type", QLIT_QSTR("89") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("options") },
-                { "type", QLIT_QSTR("276") },
+                { "type", QLIT_QSTR("280") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("90") },
+        { "name", QLIT_QSTR("91") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4783,7 +4880,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("91") },
+        { "name", QLIT_QSTR("92") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4801,7 +4898,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("92") },
+        { "name", QLIT_QSTR("93") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4826,7 +4923,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("93") },
+        { "name", QLIT_QSTR("94") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4873,73 +4970,73 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("mouse-mode") },
-                { "type", QLIT_QSTR("277") },
+                { "type", QLIT_QSTR("281") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("channels") },
-                { "type", QLIT_QSTR("[278]") },
+                { "type", QLIT_QSTR("[282]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("94") },
+        { "name", QLIT_QSTR("95") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("279") },
+                { "type", QLIT_QSTR("283") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("client") },
-                { "type", QLIT_QSTR("279") },
+                { "type", QLIT_QSTR("283") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("95") },
+        { "name", QLIT_QSTR("96") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("280") },
+                { "type", QLIT_QSTR("284") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("client") },
-                { "type", QLIT_QSTR("278") },
+                { "type", QLIT_QSTR("282") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("96") },
+        { "name", QLIT_QSTR("97") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("279") },
+                { "type", QLIT_QSTR("283") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("client") },
-                { "type", QLIT_QSTR("279") },
+                { "type", QLIT_QSTR("283") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("97") },
+        { "name", QLIT_QSTR("98") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -4958,7 +5055,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("family") },
-                { "type", QLIT_QSTR("281") },
+                { "type", QLIT_QSTR("285") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -4976,19 +5073,19 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("clients") },
-                { "type", QLIT_QSTR("[282]") },
+                { "type", QLIT_QSTR("[286]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("98") },
+        { "name", QLIT_QSTR("99") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("99") },
+        { "element-type", QLIT_QSTR("100") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[99]") },
+        { "name", QLIT_QSTR("[100]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5000,23 +5097,23 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("[283]") },
+                { "type", QLIT_QSTR("[287]") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("clients") },
-                { "type", QLIT_QSTR("[282]") },
+                { "type", QLIT_QSTR("[286]") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("auth") },
-                { "type", QLIT_QSTR("284") },
+                { "type", QLIT_QSTR("288") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("vencrypt") },
-                { "type", QLIT_QSTR("285") },
+                { "type", QLIT_QSTR("289") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -5028,7 +5125,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("99") },
+        { "name", QLIT_QSTR("100") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5041,67 +5138,67 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("100") },
+        { "name", QLIT_QSTR("101") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("286") },
+                { "type", QLIT_QSTR("290") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("client") },
-                { "type", QLIT_QSTR("287") },
+                { "type", QLIT_QSTR("291") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("101") },
+        { "name", QLIT_QSTR("102") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("286") },
+                { "type", QLIT_QSTR("290") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("client") },
-                { "type", QLIT_QSTR("282") },
+                { "type", QLIT_QSTR("286") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("102") },
+        { "name", QLIT_QSTR("103") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("286") },
+                { "type", QLIT_QSTR("290") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("client") },
-                { "type", QLIT_QSTR("282") },
+                { "type", QLIT_QSTR("286") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("103") },
+        { "name", QLIT_QSTR("104") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("104") },
+        { "element-type", QLIT_QSTR("105") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[104]") },
+        { "name", QLIT_QSTR("[105]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5129,14 +5226,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("104") },
+        { "name", QLIT_QSTR("105") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("keys") },
-                { "type", QLIT_QSTR("[288]") },
+                { "type", QLIT_QSTR("[292]") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -5148,7 +5245,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("105") },
+        { "name", QLIT_QSTR("106") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5167,13 +5264,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("events") },
-                { "type", QLIT_QSTR("[289]") },
+                { "type", QLIT_QSTR("[293]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("106") },
+        { "name", QLIT_QSTR("107") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5181,25 +5278,25 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("status") },
-                { "type", QLIT_QSTR("290") },
+                { "type", QLIT_QSTR("294") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("ram") },
-                { "type", QLIT_QSTR("291") },
+                { "type", QLIT_QSTR("295") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("disk") },
-                { "type", QLIT_QSTR("291") },
+                { "type", QLIT_QSTR("295") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("xbzrle-cache") },
-                { "type", QLIT_QSTR("292") },
+                { "type", QLIT_QSTR("296") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -5241,33 +5338,33 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("107") },
+        { "name", QLIT_QSTR("108") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("capabilities") },
-                { "type", QLIT_QSTR("[109]") },
+                { "type", QLIT_QSTR("[110]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("108") },
+        { "name", QLIT_QSTR("109") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("109") },
+        { "element-type", QLIT_QSTR("110") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[109]") },
+        { "name", QLIT_QSTR("[110]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("capability") },
-                { "type", QLIT_QSTR("293") },
+                { "type", QLIT_QSTR("297") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -5278,7 +5375,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("109") },
+        { "name", QLIT_QSTR("110") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5316,13 +5413,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("tls-creds") },
-                { "type", QLIT_QSTR("264") },
+                { "type", QLIT_QSTR("268") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("tls-hostname") },
-                { "type", QLIT_QSTR("264") },
+                { "type", QLIT_QSTR("268") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -5370,7 +5467,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("110") },
+        { "name", QLIT_QSTR("111") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5462,7 +5559,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("111") },
+        { "name", QLIT_QSTR("112") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5498,20 +5595,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("112") },
+        { "name", QLIT_QSTR("113") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("status") },
-                { "type", QLIT_QSTR("290") },
+                { "type", QLIT_QSTR("294") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("113") },
+        { "name", QLIT_QSTR("114") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5524,20 +5621,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("114") },
+        { "name", QLIT_QSTR("115") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("state") },
-                { "type", QLIT_QSTR("290") },
+                { "type", QLIT_QSTR("294") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("115") },
+        { "name", QLIT_QSTR("116") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5550,7 +5647,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("116") },
+        { "name", QLIT_QSTR("117") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5563,7 +5660,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("117") },
+        { "name", QLIT_QSTR("118") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5576,7 +5673,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("118") },
+        { "name", QLIT_QSTR("119") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5613,7 +5710,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("119") },
+        { "name", QLIT_QSTR("120") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5626,7 +5723,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("120") },
+        { "name", QLIT_QSTR("121") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5645,7 +5742,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("121") },
+        { "name", QLIT_QSTR("122") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5669,7 +5766,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("122") },
+        { "name", QLIT_QSTR("123") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5688,26 +5785,26 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("123") },
+        { "name", QLIT_QSTR("124") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("actions") },
-                { "type", QLIT_QSTR("[294]") },
+                { "type", QLIT_QSTR("[298]") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("properties") },
-                { "type", QLIT_QSTR("295") },
+                { "type", QLIT_QSTR("299") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("124") },
+        { "name", QLIT_QSTR("125") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5726,13 +5823,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("125") },
+        { "name", QLIT_QSTR("126") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("126") },
+        { "element-type", QLIT_QSTR("127") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[126]") },
+        { "name", QLIT_QSTR("[127]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5744,7 +5841,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("state") },
-                { "type", QLIT_QSTR("296") },
+                { "type", QLIT_QSTR("300") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -5755,7 +5852,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("126") },
+        { "name", QLIT_QSTR("127") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5785,13 +5882,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("127") },
+        { "name", QLIT_QSTR("128") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("128") },
+        { "element-type", QLIT_QSTR("129") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[128]") },
+        { "name", QLIT_QSTR("[129]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5803,48 +5900,48 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("meta-type") },
-                { "type", QLIT_QSTR("297") },
+                { "type", QLIT_QSTR("301") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("128") },
+        { "name", QLIT_QSTR("129") },
         { "tag", QLIT_QSTR("meta-type") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("builtin") },
-                { "type", QLIT_QSTR("298") },
+                { "type", QLIT_QSTR("302") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("enum") },
-                { "type", QLIT_QSTR("299") },
+                { "type", QLIT_QSTR("303") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("array") },
-                { "type", QLIT_QSTR("300") },
+                { "type", QLIT_QSTR("304") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("object") },
-                { "type", QLIT_QSTR("301") },
+                { "type", QLIT_QSTR("305") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("alternate") },
-                { "type", QLIT_QSTR("302") },
+                { "type", QLIT_QSTR("306") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("command") },
-                { "type", QLIT_QSTR("303") },
+                { "type", QLIT_QSTR("307") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("event") },
-                { "type", QLIT_QSTR("304") },
+                { "type", QLIT_QSTR("308") },
                 {}
             })),
             {}
@@ -5856,20 +5953,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("enable") },
-                { "type", QLIT_QSTR("[305]") },
+                { "type", QLIT_QSTR("[309]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("129") },
+        { "name", QLIT_QSTR("130") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("qemu") },
-                { "type", QLIT_QSTR("306") },
+                { "type", QLIT_QSTR("310") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -5880,13 +5977,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("130") },
+        { "name", QLIT_QSTR("131") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("131") },
+        { "element-type", QLIT_QSTR("132") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[131]") },
+        { "name", QLIT_QSTR("[132]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5899,7 +5996,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("131") },
+        { "name", QLIT_QSTR("132") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5929,7 +6026,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("132") },
+        { "name", QLIT_QSTR("133") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5943,7 +6040,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("133") },
+        { "name", QLIT_QSTR("134") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5961,7 +6058,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("134") },
+        { "name", QLIT_QSTR("135") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5974,13 +6071,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("135") },
+        { "name", QLIT_QSTR("136") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("136") },
+        { "element-type", QLIT_QSTR("137") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[136]") },
+        { "name", QLIT_QSTR("[137]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -5993,13 +6090,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("136") },
+        { "name", QLIT_QSTR("137") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("137") },
+        { "element-type", QLIT_QSTR("138") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[137]") },
+        { "name", QLIT_QSTR("[138]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6032,58 +6129,58 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("props") },
-                { "type", QLIT_QSTR("307") },
+                { "type", QLIT_QSTR("311") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("arch") },
-                { "type", QLIT_QSTR("308") },
+                { "type", QLIT_QSTR("312") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("137") },
+        { "name", QLIT_QSTR("138") },
         { "tag", QLIT_QSTR("arch") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("x86") },
-                { "type", QLIT_QSTR("309") },
+                { "type", QLIT_QSTR("313") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("sparc") },
-                { "type", QLIT_QSTR("310") },
+                { "type", QLIT_QSTR("314") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("ppc") },
-                { "type", QLIT_QSTR("311") },
+                { "type", QLIT_QSTR("315") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("mips") },
-                { "type", QLIT_QSTR("312") },
+                { "type", QLIT_QSTR("316") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("tricore") },
-                { "type", QLIT_QSTR("313") },
+                { "type", QLIT_QSTR("317") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("s390") },
-                { "type", QLIT_QSTR("314") },
+                { "type", QLIT_QSTR("318") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("riscv") },
-                { "type", QLIT_QSTR("315") },
+                { "type", QLIT_QSTR("319") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("other") },
-                { "type", QLIT_QSTR("316") },
+                { "type", QLIT_QSTR("320") },
                 {}
             })),
             {}
@@ -6091,9 +6188,9 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("138") },
+        { "element-type", QLIT_QSTR("139") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[138]") },
+        { "name", QLIT_QSTR("[139]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6116,58 +6213,58 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("props") },
-                { "type", QLIT_QSTR("307") },
+                { "type", QLIT_QSTR("311") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("arch") },
-                { "type", QLIT_QSTR("308") },
+                { "type", QLIT_QSTR("312") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("138") },
+        { "name", QLIT_QSTR("139") },
         { "tag", QLIT_QSTR("arch") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("x86") },
-                { "type", QLIT_QSTR("316") },
+                { "type", QLIT_QSTR("320") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("sparc") },
-                { "type", QLIT_QSTR("316") },
+                { "type", QLIT_QSTR("320") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("ppc") },
-                { "type", QLIT_QSTR("316") },
+                { "type", QLIT_QSTR("320") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("mips") },
-                { "type", QLIT_QSTR("316") },
+                { "type", QLIT_QSTR("320") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("tricore") },
-                { "type", QLIT_QSTR("316") },
+                { "type", QLIT_QSTR("320") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("s390") },
-                { "type", QLIT_QSTR("314") },
+                { "type", QLIT_QSTR("318") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("riscv") },
-                { "type", QLIT_QSTR("315") },
+                { "type", QLIT_QSTR("319") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("other") },
-                { "type", QLIT_QSTR("316") },
+                { "type", QLIT_QSTR("320") },
                 {}
             })),
             {}
@@ -6175,9 +6272,9 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("139") },
+        { "element-type", QLIT_QSTR("140") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[139]") },
+        { "name", QLIT_QSTR("[140]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6210,7 +6307,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("139") },
+        { "name", QLIT_QSTR("140") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6223,7 +6320,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("140") },
+        { "name", QLIT_QSTR("141") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6236,13 +6333,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("141") },
+        { "name", QLIT_QSTR("142") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("142") },
+        { "element-type", QLIT_QSTR("143") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[142]") },
+        { "name", QLIT_QSTR("[143]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6254,13 +6351,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("devices") },
-                { "type", QLIT_QSTR("[317]") },
+                { "type", QLIT_QSTR("[321]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("142") },
+        { "name", QLIT_QSTR("143") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6273,7 +6370,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("143") },
+        { "name", QLIT_QSTR("144") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6302,7 +6399,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("144") },
+        { "name", QLIT_QSTR("145") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6325,7 +6422,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("145") },
+        { "name", QLIT_QSTR("146") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6338,7 +6435,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("146") },
+        { "name", QLIT_QSTR("147") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6357,7 +6454,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("147") },
+        { "name", QLIT_QSTR("148") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6370,13 +6467,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("148") },
+        { "name", QLIT_QSTR("149") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("149") },
+        { "element-type", QLIT_QSTR("150") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[149]") },
+        { "name", QLIT_QSTR("[150]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6400,7 +6497,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("149") },
+        { "name", QLIT_QSTR("150") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6418,7 +6515,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("150") },
+        { "name", QLIT_QSTR("151") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6447,7 +6544,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("151") },
+        { "name", QLIT_QSTR("152") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6471,7 +6568,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("152") },
+        { "name", QLIT_QSTR("153") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6491,13 +6588,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("153") },
+        { "name", QLIT_QSTR("154") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("154") },
+        { "element-type", QLIT_QSTR("155") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[154]") },
+        { "name", QLIT_QSTR("[155]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6522,7 +6619,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("154") },
+        { "name", QLIT_QSTR("155") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6535,7 +6632,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("155") },
+        { "name", QLIT_QSTR("156") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6548,7 +6645,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("156") },
+        { "name", QLIT_QSTR("157") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6561,7 +6658,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("157") },
+        { "name", QLIT_QSTR("158") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6586,7 +6683,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("158") },
+        { "name", QLIT_QSTR("159") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6599,7 +6696,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("159") },
+        { "name", QLIT_QSTR("160") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6618,7 +6715,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("160") },
+        { "name", QLIT_QSTR("161") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6654,20 +6751,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("format") },
-                { "type", QLIT_QSTR("318") },
+                { "type", QLIT_QSTR("322") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("161") },
+        { "name", QLIT_QSTR("162") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("status") },
-                { "type", QLIT_QSTR("319") },
+                { "type", QLIT_QSTR("323") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -6683,14 +6780,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("162") },
+        { "name", QLIT_QSTR("163") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("result") },
-                { "type", QLIT_QSTR("162") },
+                { "type", QLIT_QSTR("163") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -6702,20 +6799,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("163") },
+        { "name", QLIT_QSTR("164") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("formats") },
-                { "type", QLIT_QSTR("[318]") },
+                { "type", QLIT_QSTR("[322]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("164") },
+        { "name", QLIT_QSTR("165") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6728,7 +6825,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("165") },
+        { "name", QLIT_QSTR("166") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6752,7 +6849,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("166") },
+        { "name", QLIT_QSTR("167") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6765,7 +6862,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("167") },
+        { "name", QLIT_QSTR("168") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6778,7 +6875,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("168") },
+        { "name", QLIT_QSTR("169") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6791,13 +6888,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("169") },
+        { "name", QLIT_QSTR("170") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("170") },
+        { "element-type", QLIT_QSTR("171") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[170]") },
+        { "name", QLIT_QSTR("[171]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6832,7 +6929,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("170") },
+        { "name", QLIT_QSTR("171") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6851,13 +6948,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("171") },
+        { "name", QLIT_QSTR("172") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("172") },
+        { "element-type", QLIT_QSTR("173") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[172]") },
+        { "name", QLIT_QSTR("[173]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -6892,63 +6989,63 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("172") },
+        { "name", QLIT_QSTR("173") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("320") },
+                { "type", QLIT_QSTR("324") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("model") },
-                { "type", QLIT_QSTR("321") },
+                { "type", QLIT_QSTR("325") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("173") },
+        { "name", QLIT_QSTR("174") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("model") },
-                { "type", QLIT_QSTR("321") },
+                { "type", QLIT_QSTR("325") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("174") },
+        { "name", QLIT_QSTR("175") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("modela") },
-                { "type", QLIT_QSTR("321") },
+                { "type", QLIT_QSTR("325") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("modelb") },
-                { "type", QLIT_QSTR("321") },
+                { "type", QLIT_QSTR("325") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("175") },
+        { "name", QLIT_QSTR("176") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("result") },
-                { "type", QLIT_QSTR("322") },
+                { "type", QLIT_QSTR("326") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -6959,38 +7056,38 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("176") },
+        { "name", QLIT_QSTR("177") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("modela") },
-                { "type", QLIT_QSTR("321") },
+                { "type", QLIT_QSTR("325") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("modelb") },
-                { "type", QLIT_QSTR("321") },
+                { "type", QLIT_QSTR("325") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("177") },
+        { "name", QLIT_QSTR("178") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("model") },
-                { "type", QLIT_QSTR("321") },
+                { "type", QLIT_QSTR("325") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("178") },
+        { "name", QLIT_QSTR("179") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7010,7 +7107,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("179") },
+        { "name", QLIT_QSTR("180") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7028,7 +7125,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("180") },
+        { "name", QLIT_QSTR("181") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7047,13 +7144,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("181") },
+        { "name", QLIT_QSTR("182") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("182") },
+        { "element-type", QLIT_QSTR("183") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[182]") },
+        { "name", QLIT_QSTR("[183]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7065,13 +7162,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("fds") },
-                { "type", QLIT_QSTR("[323]") },
+                { "type", QLIT_QSTR("[327]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("182") },
+        { "name", QLIT_QSTR("183") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7084,7 +7181,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("183") },
+        { "name", QLIT_QSTR("184") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7098,13 +7195,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("184") },
+        { "name", QLIT_QSTR("185") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("185") },
+        { "element-type", QLIT_QSTR("186") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[185]") },
+        { "name", QLIT_QSTR("[186]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7116,19 +7213,19 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("parameters") },
-                { "type", QLIT_QSTR("[324]") },
+                { "type", QLIT_QSTR("[328]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("185") },
+        { "name", QLIT_QSTR("186") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("186") },
+        { "element-type", QLIT_QSTR("187") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[186]") },
+        { "name", QLIT_QSTR("[187]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7166,42 +7263,42 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("policy") },
-                { "type", QLIT_QSTR("325") },
+                { "type", QLIT_QSTR("329") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("186") },
+        { "name", QLIT_QSTR("187") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("187") },
+        { "element-type", QLIT_QSTR("188") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[187]") },
+        { "name", QLIT_QSTR("[188]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("326") },
+                { "type", QLIT_QSTR("330") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("187") },
+        { "name", QLIT_QSTR("188") },
         { "tag", QLIT_QSTR("type") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("dimm") },
-                { "type", QLIT_QSTR("327") },
+                { "type", QLIT_QSTR("331") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("nvdimm") },
-                { "type", QLIT_QSTR("327") },
+                { "type", QLIT_QSTR("331") },
                 {}
             })),
             {}
@@ -7223,13 +7320,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("188") },
+        { "name", QLIT_QSTR("189") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("189") },
+        { "element-type", QLIT_QSTR("190") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[189]") },
+        { "name", QLIT_QSTR("[190]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7247,7 +7344,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("slot-type") },
-                { "type", QLIT_QSTR("328") },
+                { "type", QLIT_QSTR("332") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -7263,20 +7360,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("189") },
+        { "name", QLIT_QSTR("190") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("info") },
-                { "type", QLIT_QSTR("189") },
+                { "type", QLIT_QSTR("190") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("190") },
+        { "name", QLIT_QSTR("191") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7289,7 +7386,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("191") },
+        { "name", QLIT_QSTR("192") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7302,13 +7399,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("192") },
+        { "name", QLIT_QSTR("193") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("193") },
+        { "element-type", QLIT_QSTR("194") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[193]") },
+        { "name", QLIT_QSTR("[194]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7331,13 +7428,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("193") },
+        { "name", QLIT_QSTR("194") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("194") },
+        { "element-type", QLIT_QSTR("195") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[194]") },
+        { "name", QLIT_QSTR("[195]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7354,7 +7451,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("props") },
-                { "type", QLIT_QSTR("307") },
+                { "type", QLIT_QSTR("311") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -7366,7 +7463,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("194") },
+        { "name", QLIT_QSTR("195") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7379,7 +7476,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("195") },
+        { "name", QLIT_QSTR("196") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7411,7 +7508,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("state") },
-                { "type", QLIT_QSTR("329") },
+                { "type", QLIT_QSTR("333") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -7422,7 +7519,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("196") },
+        { "name", QLIT_QSTR("197") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7435,7 +7532,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("197") },
+        { "name", QLIT_QSTR("198") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7463,7 +7560,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("198") },
+        { "name", QLIT_QSTR("199") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7475,13 +7572,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("reason") },
-                { "type", QLIT_QSTR("330") },
+                { "type", QLIT_QSTR("334") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("199") },
+        { "name", QLIT_QSTR("200") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7494,7 +7591,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("200") },
+        { "name", QLIT_QSTR("201") },
+        {}
+    })),
+    QLIT_QDICT(((QLitDictEntry[]) {
+        { "members", QLIT_QLIST(((QLitObject[]) {
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("filename") },
+                { "type", QLIT_QSTR("str") },
+                {}
+            })),
+            {}
+        })) },
+        { "meta-type", QLIT_QSTR("object") },
+        { "name", QLIT_QSTR("202") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7505,7 +7615,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("201") },
+        { "name", QLIT_QSTR("203") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("debug"),
             QLIT_QSTR("inmigrate"),
@@ -7529,7 +7639,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("202") },
+        { "name", QLIT_QSTR("204") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("reset"),
             QLIT_QSTR("shutdown"),
@@ -7544,7 +7654,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("203") },
+        { "name", QLIT_QSTR("205") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("pause"),
             QLIT_QSTR("poweroff"),
@@ -7556,23 +7666,23 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("331") },
+                { "type", QLIT_QSTR("335") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("204") },
+        { "name", QLIT_QSTR("206") },
         { "tag", QLIT_QSTR("type") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("hyper-v") },
-                { "type", QLIT_QSTR("332") },
+                { "type", QLIT_QSTR("336") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("s390") },
-                { "type", QLIT_QSTR("333") },
+                { "type", QLIT_QSTR("337") },
                 {}
             })),
             {}
@@ -7587,7 +7697,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("205") },
+        { "name", QLIT_QSTR("207") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("ok"),
             QLIT_QSTR("failed"),
@@ -7597,9 +7707,9 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("206") },
+        { "element-type", QLIT_QSTR("208") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[206]") },
+        { "name", QLIT_QSTR("[208]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7622,13 +7732,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("status") },
-                { "type", QLIT_QSTR("334") },
+                { "type", QLIT_QSTR("338") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("206") },
+        { "name", QLIT_QSTR("208") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7736,36 +7846,58 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("timed_stats") },
-                { "type", QLIT_QSTR("[335]") },
+                { "type", QLIT_QSTR("[339]") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("x_rd_latency_histogram") },
-                { "type", QLIT_QSTR("336") },
+                { "type", QLIT_QSTR("340") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("x_wr_latency_histogram") },
-                { "type", QLIT_QSTR("336") },
+                { "type", QLIT_QSTR("340") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("x_flush_latency_histogram") },
-                { "type", QLIT_QSTR("336") },
+                { "type", QLIT_QSTR("340") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("207") },
+        { "name", QLIT_QSTR("209") },
+        {}
+    })),
+    QLIT_QDICT(((QLitDictEntry[]) {
+        { "members", QLIT_QLIST(((QLitObject[]) {
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("type") },
+                { "type", QLIT_QSTR("341") },
+                {}
+            })),
+            {}
+        })) },
+        { "meta-type", QLIT_QSTR("object") },
+        { "name", QLIT_QSTR("210") },
+        { "tag", QLIT_QSTR("type") },
+        { "variants", QLIT_QLIST(((QLitObject[]) {
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "case", QLIT_QSTR("qcow2") },
+                { "type", QLIT_QSTR("342") },
+                {}
+            })),
+            {}
+        })) },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("208") },
+        { "name", QLIT_QSTR("211") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("undefined"),
             QLIT_QSTR("created"),
@@ -7784,7 +7916,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("209") },
+        { "name", QLIT_QSTR("212") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("existing"),
             QLIT_QSTR("absolute-paths"),
@@ -7794,7 +7926,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("210") },
+        { "name", QLIT_QSTR("213") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("top"),
             QLIT_QSTR("full"),
@@ -7806,7 +7938,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("211") },
+        { "name", QLIT_QSTR("214") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("report"),
             QLIT_QSTR("ignore"),
@@ -7819,7 +7951,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("212") },
+        { "name", QLIT_QSTR("215") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("off"),
             QLIT_QSTR("on"),
@@ -7896,25 +8028,25 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("snapshots") },
-                { "type", QLIT_QSTR("[56]") },
+                { "type", QLIT_QSTR("[57]") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("backing-image") },
-                { "type", QLIT_QSTR("213") },
+                { "type", QLIT_QSTR("216") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("format-specific") },
-                { "type", QLIT_QSTR("337") },
+                { "type", QLIT_QSTR("343") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("213") },
+        { "name", QLIT_QSTR("216") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -7937,12 +8069,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("214") },
+        { "name", QLIT_QSTR("217") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("215") },
+        { "name", QLIT_QSTR("218") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("blkdebug"),
             QLIT_QSTR("blkverify"),
@@ -7972,6 +8104,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("raw"),
             QLIT_QSTR("rbd"),
             QLIT_QSTR("replication"),
+            QLIT_QSTR("shared-cache"),
             QLIT_QSTR("sheepdog"),
             QLIT_QSTR("ssh"),
             QLIT_QSTR("throttle"),
@@ -7987,7 +8120,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("216") },
+        { "name", QLIT_QSTR("219") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("ignore"),
             QLIT_QSTR("unmap"),
@@ -8012,14 +8145,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("217") },
+        { "name", QLIT_QSTR("220") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("image") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8067,50 +8200,50 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("inject-error") },
-                { "type", QLIT_QSTR("[339]") },
+                { "type", QLIT_QSTR("[345]") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("set-state") },
-                { "type", QLIT_QSTR("[340]") },
+                { "type", QLIT_QSTR("[346]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("218") },
+        { "name", QLIT_QSTR("221") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("test") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("raw") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("219") },
+        { "name", QLIT_QSTR("222") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("220") },
+        { "name", QLIT_QSTR("223") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -8129,19 +8262,19 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("locking") },
-                { "type", QLIT_QSTR("341") },
+                { "type", QLIT_QSTR("347") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("aio") },
-                { "type", QLIT_QSTR("342") },
+                { "type", QLIT_QSTR("348") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("221") },
+        { "name", QLIT_QSTR("224") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -8190,7 +8323,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("222") },
+        { "name", QLIT_QSTR("225") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -8245,7 +8378,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("223") },
+        { "name", QLIT_QSTR("226") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -8262,7 +8395,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("[343]") },
+                { "type", QLIT_QSTR("[349]") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8280,7 +8413,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("224") },
+        { "name", QLIT_QSTR("227") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -8341,7 +8474,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("225") },
+        { "name", QLIT_QSTR("228") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -8408,14 +8541,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("226") },
+        { "name", QLIT_QSTR("229") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("transport") },
-                { "type", QLIT_QSTR("344") },
+                { "type", QLIT_QSTR("350") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8455,7 +8588,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("header-digest") },
-                { "type", QLIT_QSTR("345") },
+                { "type", QLIT_QSTR("351") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8467,14 +8600,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("227") },
+        { "name", QLIT_QSTR("230") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8486,14 +8619,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("228") },
+        { "name", QLIT_QSTR("231") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("343") },
+                { "type", QLIT_QSTR("349") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8511,14 +8644,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("229") },
+        { "name", QLIT_QSTR("232") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("346") },
+                { "type", QLIT_QSTR("352") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8565,7 +8698,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("230") },
+        { "name", QLIT_QSTR("233") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -8585,7 +8718,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("231") },
+        { "name", QLIT_QSTR("234") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -8603,20 +8736,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("232") },
+        { "name", QLIT_QSTR("235") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("backing") },
-                { "type", QLIT_QSTR("347") },
+                { "type", QLIT_QSTR("353") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8646,7 +8779,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("overlap-check") },
-                { "type", QLIT_QSTR("348") },
+                { "type", QLIT_QSTR("354") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8679,60 +8812,72 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
                 { "type", QLIT_QSTR("int") },
                 {}
             })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "default", QLIT_QNULL },
+                { "name", QLIT_QSTR("cache-adaptive") },
+                { "type", QLIT_QSTR("bool") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "default", QLIT_QNULL },
+                { "name", QLIT_QSTR("l2-prefetch") },
+                { "type", QLIT_QSTR("bool") },
+                {}
+            })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("encrypt") },
-                { "type", QLIT_QSTR("349") },
+                { "type", QLIT_QSTR("355") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("233") },
+        { "name", QLIT_QSTR("236") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("backing") },
-                { "type", QLIT_QSTR("347") },
+                { "type", QLIT_QSTR("353") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("encrypt") },
-                { "type", QLIT_QSTR("350") },
+                { "type", QLIT_QSTR("356") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("234") },
+        { "name", QLIT_QSTR("237") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("backing") },
-                { "type", QLIT_QSTR("347") },
+                { "type", QLIT_QSTR("353") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("235") },
+        { "name", QLIT_QSTR("238") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -8745,7 +8890,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("children") },
-                { "type", QLIT_QSTR("[338]") },
+                { "type", QLIT_QSTR("[344]") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8762,20 +8907,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("read-pattern") },
-                { "type", QLIT_QSTR("351") },
+                { "type", QLIT_QSTR("357") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("236") },
+        { "name", QLIT_QSTR("239") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8793,7 +8938,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("237") },
+        { "name", QLIT_QSTR("240") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -8829,25 +8974,25 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("[352]") },
+                { "type", QLIT_QSTR("[358]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("238") },
+        { "name", QLIT_QSTR("241") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("mode") },
-                { "type", QLIT_QSTR("353") },
+                { "type", QLIT_QSTR("359") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8859,14 +9004,33 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("239") },
+        { "name", QLIT_QSTR("242") },
+        {}
+    })),
+    QLIT_QDICT(((QLitDictEntry[]) {
+        { "members", QLIT_QLIST(((QLitObject[]) {
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("file") },
+                { "type", QLIT_QSTR("344") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "default", QLIT_QNULL },
+                { "name", QLIT_QSTR("size") },
+                { "type", QLIT_QSTR("int") },
+                {}
+            })),
+            {}
+        })) },
+        { "meta-type", QLIT_QSTR("object") },
+        { "name", QLIT_QSTR("243") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("343") },
+                { "type", QLIT_QSTR("349") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8889,14 +9053,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("240") },
+        { "name", QLIT_QSTR("244") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("354") },
+                { "type", QLIT_QSTR("360") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8913,13 +9077,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("host-key-check") },
-                { "type", QLIT_QSTR("355") },
+                { "type", QLIT_QSTR("361") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("241") },
+        { "name", QLIT_QSTR("245") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -8931,13 +9095,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("242") },
+        { "name", QLIT_QSTR("246") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -8974,7 +9138,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("243") },
+        { "name", QLIT_QSTR("247") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -8986,7 +9150,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("server") },
-                { "type", QLIT_QSTR("352") },
+                { "type", QLIT_QSTR("358") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -8998,7 +9162,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("244") },
+        { "name", QLIT_QSTR("248") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -9006,7 +9170,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("245") },
+        { "name", QLIT_QSTR("249") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -9024,7 +9188,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("preallocation") },
-                { "type", QLIT_QSTR("356") },
+                { "type", QLIT_QSTR("362") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9036,14 +9200,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("246") },
+        { "name", QLIT_QSTR("250") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("location") },
-                { "type", QLIT_QSTR("224") },
+                { "type", QLIT_QSTR("227") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9054,13 +9218,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("preallocation") },
-                { "type", QLIT_QSTR("356") },
+                { "type", QLIT_QSTR("362") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("247") },
+        { "name", QLIT_QSTR("251") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -9074,31 +9238,31 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("cipher-alg") },
-                { "type", QLIT_QSTR("357") },
+                { "type", QLIT_QSTR("363") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("cipher-mode") },
-                { "type", QLIT_QSTR("358") },
+                { "type", QLIT_QSTR("364") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("ivgen-alg") },
-                { "type", QLIT_QSTR("359") },
+                { "type", QLIT_QSTR("365") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("ivgen-hash-alg") },
-                { "type", QLIT_QSTR("360") },
+                { "type", QLIT_QSTR("366") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("hash-alg") },
-                { "type", QLIT_QSTR("360") },
+                { "type", QLIT_QSTR("366") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9109,7 +9273,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9120,14 +9284,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("248") },
+        { "name", QLIT_QSTR("252") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("location") },
-                { "type", QLIT_QSTR("230") },
+                { "type", QLIT_QSTR("233") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9138,14 +9302,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("249") },
+        { "name", QLIT_QSTR("253") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9162,14 +9326,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("250") },
+        { "name", QLIT_QSTR("254") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9186,20 +9350,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("encrypt") },
-                { "type", QLIT_QSTR("361") },
+                { "type", QLIT_QSTR("367") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("251") },
+        { "name", QLIT_QSTR("255") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9210,7 +9374,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("version") },
-                { "type", QLIT_QSTR("362") },
+                { "type", QLIT_QSTR("368") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9222,13 +9386,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("backing-fmt") },
-                { "type", QLIT_QSTR("215") },
+                { "type", QLIT_QSTR("218") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("encrypt") },
-                { "type", QLIT_QSTR("361") },
+                { "type", QLIT_QSTR("367") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9240,7 +9404,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("preallocation") },
-                { "type", QLIT_QSTR("356") },
+                { "type", QLIT_QSTR("362") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9258,14 +9422,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("252") },
+        { "name", QLIT_QSTR("256") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9282,7 +9446,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("backing-fmt") },
-                { "type", QLIT_QSTR("215") },
+                { "type", QLIT_QSTR("218") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9300,14 +9464,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("253") },
+        { "name", QLIT_QSTR("257") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("location") },
-                { "type", QLIT_QSTR("238") },
+                { "type", QLIT_QSTR("241") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9324,14 +9488,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("254") },
+        { "name", QLIT_QSTR("258") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("location") },
-                { "type", QLIT_QSTR("240") },
+                { "type", QLIT_QSTR("244") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9348,13 +9512,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("preallocation") },
-                { "type", QLIT_QSTR("356") },
+                { "type", QLIT_QSTR("362") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("redundancy") },
-                { "type", QLIT_QSTR("363") },
+                { "type", QLIT_QSTR("369") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9366,14 +9530,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("255") },
+        { "name", QLIT_QSTR("259") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("location") },
-                { "type", QLIT_QSTR("241") },
+                { "type", QLIT_QSTR("245") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9384,14 +9548,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("256") },
+        { "name", QLIT_QSTR("260") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9402,20 +9566,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("preallocation") },
-                { "type", QLIT_QSTR("356") },
+                { "type", QLIT_QSTR("362") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("257") },
+        { "name", QLIT_QSTR("261") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9438,7 +9602,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("subformat") },
-                { "type", QLIT_QSTR("364") },
+                { "type", QLIT_QSTR("370") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9450,14 +9614,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("258") },
+        { "name", QLIT_QSTR("262") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("338") },
+                { "type", QLIT_QSTR("344") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9468,7 +9632,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("subformat") },
-                { "type", QLIT_QSTR("365") },
+                { "type", QLIT_QSTR("371") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -9480,12 +9644,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("259") },
+        { "name", QLIT_QSTR("263") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("260") },
+        { "name", QLIT_QSTR("264") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("retain"),
             QLIT_QSTR("read-only"),
@@ -9496,7 +9660,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("261") },
+        { "name", QLIT_QSTR("265") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("read"),
             QLIT_QSTR("write"),
@@ -9506,7 +9670,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("262") },
+        { "name", QLIT_QSTR("266") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("ignore"),
             QLIT_QSTR("report"),
@@ -9517,7 +9681,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("263") },
+        { "name", QLIT_QSTR("267") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("commit"),
             QLIT_QSTR("stream"),
@@ -9540,40 +9704,40 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("alternate") },
-        { "name", QLIT_QSTR("264") },
+        { "name", QLIT_QSTR("268") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("366") },
+                { "type", QLIT_QSTR("372") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("265") },
+        { "name", QLIT_QSTR("269") },
         { "tag", QLIT_QSTR("type") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("inet") },
-                { "type", QLIT_QSTR("367") },
+                { "type", QLIT_QSTR("373") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("unix") },
-                { "type", QLIT_QSTR("368") },
+                { "type", QLIT_QSTR("374") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vsock") },
-                { "type", QLIT_QSTR("369") },
+                { "type", QLIT_QSTR("375") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("fd") },
-                { "type", QLIT_QSTR("370") },
+                { "type", QLIT_QSTR("376") },
                 {}
             })),
             {}
@@ -9582,7 +9746,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("266") },
+        { "name", QLIT_QSTR("270") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("safe"),
             QLIT_QSTR("hard"),
@@ -9592,7 +9756,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("267") },
+        { "name", QLIT_QSTR("271") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("read"),
             QLIT_QSTR("write"),
@@ -9603,7 +9767,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("268") },
+        { "name", QLIT_QSTR("272") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("utf8"),
             QLIT_QSTR("base64"),
@@ -9615,113 +9779,113 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("371") },
+                { "type", QLIT_QSTR("377") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("269") },
+        { "name", QLIT_QSTR("273") },
         { "tag", QLIT_QSTR("type") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("file") },
-                { "type", QLIT_QSTR("372") },
+                { "type", QLIT_QSTR("378") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("serial") },
-                { "type", QLIT_QSTR("373") },
+                { "type", QLIT_QSTR("379") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("parallel") },
-                { "type", QLIT_QSTR("373") },
+                { "type", QLIT_QSTR("379") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("pipe") },
-                { "type", QLIT_QSTR("373") },
+                { "type", QLIT_QSTR("379") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("socket") },
-                { "type", QLIT_QSTR("374") },
+                { "type", QLIT_QSTR("380") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("udp") },
-                { "type", QLIT_QSTR("375") },
+                { "type", QLIT_QSTR("381") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("pty") },
-                { "type", QLIT_QSTR("376") },
+                { "type", QLIT_QSTR("382") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("null") },
-                { "type", QLIT_QSTR("376") },
+                { "type", QLIT_QSTR("382") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("mux") },
-                { "type", QLIT_QSTR("377") },
+                { "type", QLIT_QSTR("383") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("msmouse") },
-                { "type", QLIT_QSTR("376") },
+                { "type", QLIT_QSTR("382") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("wctablet") },
-                { "type", QLIT_QSTR("376") },
+                { "type", QLIT_QSTR("382") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("braille") },
-                { "type", QLIT_QSTR("376") },
+                { "type", QLIT_QSTR("382") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("testdev") },
-                { "type", QLIT_QSTR("376") },
+                { "type", QLIT_QSTR("382") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("stdio") },
-                { "type", QLIT_QSTR("378") },
+                { "type", QLIT_QSTR("384") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("console") },
-                { "type", QLIT_QSTR("376") },
+                { "type", QLIT_QSTR("382") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("spicevmc") },
-                { "type", QLIT_QSTR("379") },
+                { "type", QLIT_QSTR("385") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("spiceport") },
-                { "type", QLIT_QSTR("380") },
+                { "type", QLIT_QSTR("386") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vc") },
-                { "type", QLIT_QSTR("381") },
+                { "type", QLIT_QSTR("387") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("ringbuf") },
-                { "type", QLIT_QSTR("382") },
+                { "type", QLIT_QSTR("388") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("memory") },
-                { "type", QLIT_QSTR("382") },
+                { "type", QLIT_QSTR("388") },
                 {}
             })),
             {}
@@ -9730,7 +9894,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("270") },
+        { "name", QLIT_QSTR("274") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("normal"),
             QLIT_QSTR("none"),
@@ -9747,7 +9911,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("271") },
+        { "name", QLIT_QSTR("275") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("half"),
             QLIT_QSTR("full"),
@@ -9757,7 +9921,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("272") },
+        { "name", QLIT_QSTR("276") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("off"),
             QLIT_QSTR("on"),
@@ -9834,7 +9998,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("273") },
+        { "name", QLIT_QSTR("277") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -9884,7 +10048,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("274") },
+        { "name", QLIT_QSTR("278") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -9928,30 +10092,30 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("275") },
+        { "name", QLIT_QSTR("279") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("383") },
+                { "type", QLIT_QSTR("389") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("276") },
+        { "name", QLIT_QSTR("280") },
         { "tag", QLIT_QSTR("type") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("passthrough") },
-                { "type", QLIT_QSTR("384") },
+                { "type", QLIT_QSTR("390") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("emulator") },
-                { "type", QLIT_QSTR("385") },
+                { "type", QLIT_QSTR("391") },
                 {}
             })),
             {}
@@ -9960,7 +10124,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("277") },
+        { "name", QLIT_QSTR("281") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("client"),
             QLIT_QSTR("server"),
@@ -9970,9 +10134,9 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("278") },
+        { "element-type", QLIT_QSTR("282") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[278]") },
+        { "name", QLIT_QSTR("[282]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -9989,7 +10153,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("family") },
-                { "type", QLIT_QSTR("281") },
+                { "type", QLIT_QSTR("285") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -10015,7 +10179,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("278") },
+        { "name", QLIT_QSTR("282") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10032,13 +10196,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("family") },
-                { "type", QLIT_QSTR("281") },
+                { "type", QLIT_QSTR("285") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("279") },
+        { "name", QLIT_QSTR("283") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10055,7 +10219,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("family") },
-                { "type", QLIT_QSTR("281") },
+                { "type", QLIT_QSTR("285") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -10067,12 +10231,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("280") },
+        { "name", QLIT_QSTR("284") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("281") },
+        { "name", QLIT_QSTR("285") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("ipv4"),
             QLIT_QSTR("ipv6"),
@@ -10084,9 +10248,9 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("282") },
+        { "element-type", QLIT_QSTR("286") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[282]") },
+        { "name", QLIT_QSTR("[286]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10103,7 +10267,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("family") },
-                { "type", QLIT_QSTR("281") },
+                { "type", QLIT_QSTR("285") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -10126,13 +10290,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("282") },
+        { "name", QLIT_QSTR("286") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("283") },
+        { "element-type", QLIT_QSTR("287") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[283]") },
+        { "name", QLIT_QSTR("[287]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10149,7 +10313,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("family") },
-                { "type", QLIT_QSTR("281") },
+                { "type", QLIT_QSTR("285") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -10159,24 +10323,24 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("auth") },
-                { "type", QLIT_QSTR("284") },
+                { "type", QLIT_QSTR("288") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("vencrypt") },
-                { "type", QLIT_QSTR("285") },
+                { "type", QLIT_QSTR("289") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("283") },
+        { "name", QLIT_QSTR("287") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("284") },
+        { "name", QLIT_QSTR("288") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("none"),
             QLIT_QSTR("vnc"),
@@ -10193,7 +10357,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("285") },
+        { "name", QLIT_QSTR("289") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("plain"),
             QLIT_QSTR("tls-none"),
@@ -10222,7 +10386,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("family") },
-                { "type", QLIT_QSTR("281") },
+                { "type", QLIT_QSTR("285") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -10239,7 +10403,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("286") },
+        { "name", QLIT_QSTR("290") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10256,7 +10420,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("family") },
-                { "type", QLIT_QSTR("281") },
+                { "type", QLIT_QSTR("285") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -10267,36 +10431,36 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("287") },
+        { "name", QLIT_QSTR("291") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("288") },
+        { "element-type", QLIT_QSTR("292") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[288]") },
+        { "name", QLIT_QSTR("[292]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("386") },
+                { "type", QLIT_QSTR("392") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("288") },
+        { "name", QLIT_QSTR("292") },
         { "tag", QLIT_QSTR("type") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("number") },
-                { "type", QLIT_QSTR("387") },
+                { "type", QLIT_QSTR("393") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("qcode") },
-                { "type", QLIT_QSTR("388") },
+                { "type", QLIT_QSTR("394") },
                 {}
             })),
             {}
@@ -10304,42 +10468,42 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("289") },
+        { "element-type", QLIT_QSTR("293") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[289]") },
+        { "name", QLIT_QSTR("[293]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("389") },
+                { "type", QLIT_QSTR("395") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("289") },
+        { "name", QLIT_QSTR("293") },
         { "tag", QLIT_QSTR("type") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("key") },
-                { "type", QLIT_QSTR("390") },
+                { "type", QLIT_QSTR("396") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("btn") },
-                { "type", QLIT_QSTR("391") },
+                { "type", QLIT_QSTR("397") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("rel") },
-                { "type", QLIT_QSTR("392") },
+                { "type", QLIT_QSTR("398") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("abs") },
-                { "type", QLIT_QSTR("392") },
+                { "type", QLIT_QSTR("398") },
                 {}
             })),
             {}
@@ -10348,7 +10512,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("290") },
+        { "name", QLIT_QSTR("294") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("none"),
             QLIT_QSTR("setup"),
@@ -10430,7 +10594,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("291") },
+        { "name", QLIT_QSTR("295") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10468,12 +10632,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("292") },
+        { "name", QLIT_QSTR("296") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("293") },
+        { "name", QLIT_QSTR("297") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("xbzrle"),
             QLIT_QSTR("rdma-pin-all"),
@@ -10500,62 +10664,62 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("294") },
+        { "element-type", QLIT_QSTR("298") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[294]") },
+        { "name", QLIT_QSTR("[298]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("393") },
+                { "type", QLIT_QSTR("399") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("294") },
+        { "name", QLIT_QSTR("298") },
         { "tag", QLIT_QSTR("type") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("abort") },
-                { "type", QLIT_QSTR("394") },
+                { "type", QLIT_QSTR("400") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("block-dirty-bitmap-add") },
-                { "type", QLIT_QSTR("395") },
+                { "type", QLIT_QSTR("401") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("block-dirty-bitmap-clear") },
-                { "type", QLIT_QSTR("396") },
+                { "type", QLIT_QSTR("402") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("blockdev-backup") },
-                { "type", QLIT_QSTR("397") },
+                { "type", QLIT_QSTR("403") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("blockdev-snapshot") },
-                { "type", QLIT_QSTR("398") },
+                { "type", QLIT_QSTR("404") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("blockdev-snapshot-internal-sync") },
-                { "type", QLIT_QSTR("399") },
+                { "type", QLIT_QSTR("405") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("blockdev-snapshot-sync") },
-                { "type", QLIT_QSTR("400") },
+                { "type", QLIT_QSTR("406") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("drive-backup") },
-                { "type", QLIT_QSTR("401") },
+                { "type", QLIT_QSTR("407") },
                 {}
             })),
             {}
@@ -10567,18 +10731,18 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("completion-mode") },
-                { "type", QLIT_QSTR("402") },
+                { "type", QLIT_QSTR("408") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("295") },
+        { "name", QLIT_QSTR("299") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("296") },
+        { "name", QLIT_QSTR("300") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("unavailable"),
             QLIT_QSTR("disabled"),
@@ -10589,7 +10753,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("297") },
+        { "name", QLIT_QSTR("301") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("builtin"),
             QLIT_QSTR("enum"),
@@ -10606,13 +10770,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("json-type") },
-                { "type", QLIT_QSTR("403") },
+                { "type", QLIT_QSTR("409") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("298") },
+        { "name", QLIT_QSTR("302") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10625,7 +10789,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("299") },
+        { "name", QLIT_QSTR("303") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10638,14 +10802,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("300") },
+        { "name", QLIT_QSTR("304") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("members") },
-                { "type", QLIT_QSTR("[404]") },
+                { "type", QLIT_QSTR("[410]") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -10657,26 +10821,26 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("variants") },
-                { "type", QLIT_QSTR("[405]") },
+                { "type", QLIT_QSTR("[411]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("301") },
+        { "name", QLIT_QSTR("305") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("members") },
-                { "type", QLIT_QSTR("[406]") },
+                { "type", QLIT_QSTR("[412]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("302") },
+        { "name", QLIT_QSTR("306") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10699,7 +10863,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("303") },
+        { "name", QLIT_QSTR("307") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10712,18 +10876,18 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("304") },
+        { "name", QLIT_QSTR("308") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("305") },
+        { "element-type", QLIT_QSTR("309") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[305]") },
+        { "name", QLIT_QSTR("[309]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("305") },
+        { "name", QLIT_QSTR("309") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("oob"),
             {}
@@ -10750,7 +10914,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("306") },
+        { "name", QLIT_QSTR("310") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10782,12 +10946,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("307") },
+        { "name", QLIT_QSTR("311") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("308") },
+        { "name", QLIT_QSTR("312") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("x86"),
             QLIT_QSTR("sparc"),
@@ -10811,7 +10975,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("309") },
+        { "name", QLIT_QSTR("313") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10829,7 +10993,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("310") },
+        { "name", QLIT_QSTR("314") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10842,7 +11006,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("311") },
+        { "name", QLIT_QSTR("315") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10855,7 +11019,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("312") },
+        { "name", QLIT_QSTR("316") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10868,20 +11032,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("313") },
+        { "name", QLIT_QSTR("317") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("cpu-state") },
-                { "type", QLIT_QSTR("407") },
+                { "type", QLIT_QSTR("413") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("314") },
+        { "name", QLIT_QSTR("318") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10894,7 +11058,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("315") },
+        { "name", QLIT_QSTR("319") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10902,13 +11066,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("316") },
+        { "name", QLIT_QSTR("320") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("317") },
+        { "element-type", QLIT_QSTR("321") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[317]") },
+        { "name", QLIT_QSTR("[321]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -10930,12 +11094,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("class_info") },
-                { "type", QLIT_QSTR("408") },
+                { "type", QLIT_QSTR("414") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("id") },
-                { "type", QLIT_QSTR("409") },
+                { "type", QLIT_QSTR("415") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -10952,23 +11116,23 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("pci_bridge") },
-                { "type", QLIT_QSTR("410") },
+                { "type", QLIT_QSTR("416") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("regions") },
-                { "type", QLIT_QSTR("[411]") },
+                { "type", QLIT_QSTR("[417]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("317") },
+        { "name", QLIT_QSTR("321") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("318") },
+        { "name", QLIT_QSTR("322") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("elf"),
             QLIT_QSTR("kdump-zlib"),
@@ -10980,7 +11144,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("319") },
+        { "name", QLIT_QSTR("323") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("none"),
             QLIT_QSTR("active"),
@@ -10991,14 +11155,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("318") },
+        { "element-type", QLIT_QSTR("322") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[318]") },
+        { "name", QLIT_QSTR("[322]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("320") },
+        { "name", QLIT_QSTR("324") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("static"),
             QLIT_QSTR("full"),
@@ -11022,12 +11186,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("321") },
+        { "name", QLIT_QSTR("325") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("322") },
+        { "name", QLIT_QSTR("326") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("incompatible"),
             QLIT_QSTR("identical"),
@@ -11038,9 +11202,9 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("323") },
+        { "element-type", QLIT_QSTR("327") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[323]") },
+        { "name", QLIT_QSTR("[327]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -11059,13 +11223,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("323") },
+        { "name", QLIT_QSTR("327") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("324") },
+        { "element-type", QLIT_QSTR("328") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[324]") },
+        { "name", QLIT_QSTR("[328]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -11077,7 +11241,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("412") },
+                { "type", QLIT_QSTR("418") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -11095,12 +11259,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("324") },
+        { "name", QLIT_QSTR("328") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("325") },
+        { "name", QLIT_QSTR("329") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("default"),
             QLIT_QSTR("preferred"),
@@ -11112,7 +11276,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("326") },
+        { "name", QLIT_QSTR("330") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("dimm"),
             QLIT_QSTR("nvdimm"),
@@ -11124,18 +11288,18 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("413") },
+                { "type", QLIT_QSTR("419") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("327") },
+        { "name", QLIT_QSTR("331") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("328") },
+        { "name", QLIT_QSTR("332") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("DIMM"),
             QLIT_QSTR("CPU"),
@@ -11145,7 +11309,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("329") },
+        { "name", QLIT_QSTR("333") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("uninit"),
             QLIT_QSTR("launch-update"),
@@ -11159,7 +11323,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("330") },
+        { "name", QLIT_QSTR("334") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("queue-full"),
             {}
@@ -11168,7 +11332,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("331") },
+        { "name", QLIT_QSTR("335") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("hyper-v"),
             QLIT_QSTR("s390"),
@@ -11206,7 +11370,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("332") },
+        { "name", QLIT_QSTR("336") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -11228,18 +11392,18 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("reason") },
-                { "type", QLIT_QSTR("414") },
+                { "type", QLIT_QSTR("420") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("333") },
+        { "name", QLIT_QSTR("337") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("334") },
+        { "name", QLIT_QSTR("338") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("active"),
             QLIT_QSTR("disabled"),
@@ -11250,9 +11414,9 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("335") },
+        { "element-type", QLIT_QSTR("339") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[335]") },
+        { "name", QLIT_QSTR("[339]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -11320,7 +11484,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("335") },
+        { "name", QLIT_QSTR("339") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -11338,41 +11502,63 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("336") },
+        { "name", QLIT_QSTR("340") },
+        {}
+    })),
+    QLIT_QDICT(((QLitDictEntry[]) {
+        { "meta-type", QLIT_QSTR("enum") },
+        { "name", QLIT_QSTR("341") },
+        { "values", QLIT_QLIST(((QLitObject[]) {
+            QLIT_QSTR("qcow2"),
+            {}
+        })) },
+        {}
+    })),
+    QLIT_QDICT(((QLitDictEntry[]) {
+        { "members", QLIT_QLIST(((QLitObject[]) {
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("data") },
+                { "type", QLIT_QSTR("421") },
+                {}
+            })),
+            {}
+        })) },
+        { "meta-type", QLIT_QSTR("object") },
+        { "name", QLIT_QSTR("342") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("56") },
+        { "element-type", QLIT_QSTR("57") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[56]") },
+        { "name", QLIT_QSTR("[57]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("415") },
+                { "type", QLIT_QSTR("422") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("337") },
+        { "name", QLIT_QSTR("343") },
         { "tag", QLIT_QSTR("type") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("qcow2") },
-                { "type", QLIT_QSTR("416") },
+                { "type", QLIT_QSTR("423") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vmdk") },
-                { "type", QLIT_QSTR("417") },
+                { "type", QLIT_QSTR("424") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("luks") },
-                { "type", QLIT_QSTR("418") },
+                { "type", QLIT_QSTR("425") },
                 {}
             })),
             {}
@@ -11382,7 +11568,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
-                { "type", QLIT_QSTR("35") },
+                { "type", QLIT_QSTR("36") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -11392,20 +11578,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("alternate") },
-        { "name", QLIT_QSTR("338") },
+        { "name", QLIT_QSTR("344") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("339") },
+        { "element-type", QLIT_QSTR("345") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[339]") },
+        { "name", QLIT_QSTR("[345]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("event") },
-                { "type", QLIT_QSTR("419") },
+                { "type", QLIT_QSTR("426") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -11441,20 +11627,20 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("339") },
+        { "name", QLIT_QSTR("345") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("340") },
+        { "element-type", QLIT_QSTR("346") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[340]") },
+        { "name", QLIT_QSTR("[346]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("event") },
-                { "type", QLIT_QSTR("419") },
+                { "type", QLIT_QSTR("426") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -11471,12 +11657,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("340") },
+        { "name", QLIT_QSTR("346") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("341") },
+        { "name", QLIT_QSTR("347") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("auto"),
             QLIT_QSTR("on"),
@@ -11487,51 +11673,52 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("342") },
+        { "name", QLIT_QSTR("348") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("threads"),
             QLIT_QSTR("native"),
+            QLIT_QSTR("io_uring"),
             {}
         })) },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("343") },
+        { "element-type", QLIT_QSTR("349") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[343]") },
+        { "name", QLIT_QSTR("[349]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("420") },
+                { "type", QLIT_QSTR("427") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("343") },
+        { "name", QLIT_QSTR("349") },
         { "tag", QLIT_QSTR("type") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("inet") },
-                { "type", QLIT_QSTR("354") },
+                { "type", QLIT_QSTR("360") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("unix") },
-                { "type", QLIT_QSTR("421") },
+                { "type", QLIT_QSTR("428") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("vsock") },
-                { "type", QLIT_QSTR("422") },
+                { "type", QLIT_QSTR("429") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("fd") },
-                { "type", QLIT_QSTR("423") },
+                { "type", QLIT_QSTR("430") },
                 {}
             })),
             {}
@@ -11540,7 +11727,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("344") },
+        { "name", QLIT_QSTR("350") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("tcp"),
             QLIT_QSTR("iser"),
@@ -11550,7 +11737,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("345") },
+        { "name", QLIT_QSTR("351") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("crc32c"),
             QLIT_QSTR("none"),
@@ -11564,7 +11751,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("424") },
+                { "type", QLIT_QSTR("431") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -11575,13 +11762,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("346") },
+        { "name", QLIT_QSTR("352") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
-                { "type", QLIT_QSTR("35") },
+                { "type", QLIT_QSTR("36") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -11595,46 +11782,46 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("alternate") },
-        { "name", QLIT_QSTR("347") },
+        { "name", QLIT_QSTR("353") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
-                { "type", QLIT_QSTR("425") },
+                { "type", QLIT_QSTR("432") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
-                { "type", QLIT_QSTR("426") },
+                { "type", QLIT_QSTR("433") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("alternate") },
-        { "name", QLIT_QSTR("348") },
+        { "name", QLIT_QSTR("354") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("format") },
-                { "type", QLIT_QSTR("427") },
+                { "type", QLIT_QSTR("434") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("349") },
+        { "name", QLIT_QSTR("355") },
         { "tag", QLIT_QSTR("format") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("aes") },
-                { "type", QLIT_QSTR("428") },
+                { "type", QLIT_QSTR("435") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("luks") },
-                { "type", QLIT_QSTR("429") },
+                { "type", QLIT_QSTR("436") },
                 {}
             })),
             {}
@@ -11645,18 +11832,18 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("format") },
-                { "type", QLIT_QSTR("430") },
+                { "type", QLIT_QSTR("437") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("350") },
+        { "name", QLIT_QSTR("356") },
         { "tag", QLIT_QSTR("format") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("aes") },
-                { "type", QLIT_QSTR("428") },
+                { "type", QLIT_QSTR("435") },
                 {}
             })),
             {}
@@ -11664,14 +11851,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("338") },
+        { "element-type", QLIT_QSTR("344") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[338]") },
+        { "name", QLIT_QSTR("[344]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("351") },
+        { "name", QLIT_QSTR("357") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("quorum"),
             QLIT_QSTR("fifo"),
@@ -11680,9 +11867,9 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("352") },
+        { "element-type", QLIT_QSTR("358") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[352]") },
+        { "name", QLIT_QSTR("[358]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -11700,12 +11887,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("352") },
+        { "name", QLIT_QSTR("358") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("353") },
+        { "name", QLIT_QSTR("359") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("primary"),
             QLIT_QSTR("secondary"),
@@ -11752,35 +11939,35 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("354") },
+        { "name", QLIT_QSTR("360") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("mode") },
-                { "type", QLIT_QSTR("431") },
+                { "type", QLIT_QSTR("438") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("355") },
+        { "name", QLIT_QSTR("361") },
         { "tag", QLIT_QSTR("mode") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("none") },
-                { "type", QLIT_QSTR("432") },
+                { "type", QLIT_QSTR("439") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("hash") },
-                { "type", QLIT_QSTR("433") },
+                { "type", QLIT_QSTR("440") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("known_hosts") },
-                { "type", QLIT_QSTR("432") },
+                { "type", QLIT_QSTR("439") },
                 {}
             })),
             {}
@@ -11789,7 +11976,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("356") },
+        { "name", QLIT_QSTR("362") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("off"),
             QLIT_QSTR("metadata"),
@@ -11801,7 +11988,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("357") },
+        { "name", QLIT_QSTR("363") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("aes-128"),
             QLIT_QSTR("aes-192"),
@@ -11821,7 +12008,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("358") },
+        { "name", QLIT_QSTR("364") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("ecb"),
             QLIT_QSTR("cbc"),
@@ -11833,7 +12020,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("359") },
+        { "name", QLIT_QSTR("365") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("plain"),
             QLIT_QSTR("plain64"),
@@ -11844,7 +12031,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("360") },
+        { "name", QLIT_QSTR("366") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("md5"),
             QLIT_QSTR("sha1"),
@@ -11861,23 +12048,23 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("format") },
-                { "type", QLIT_QSTR("434") },
+                { "type", QLIT_QSTR("441") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("361") },
+        { "name", QLIT_QSTR("367") },
         { "tag", QLIT_QSTR("format") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("qcow") },
-                { "type", QLIT_QSTR("428") },
+                { "type", QLIT_QSTR("435") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("luks") },
-                { "type", QLIT_QSTR("435") },
+                { "type", QLIT_QSTR("442") },
                 {}
             })),
             {}
@@ -11886,7 +12073,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("362") },
+        { "name", QLIT_QSTR("368") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("v2"),
             QLIT_QSTR("v3"),
@@ -11898,23 +12085,23 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("436") },
+                { "type", QLIT_QSTR("443") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("363") },
+        { "name", QLIT_QSTR("369") },
         { "tag", QLIT_QSTR("type") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("full") },
-                { "type", QLIT_QSTR("437") },
+                { "type", QLIT_QSTR("444") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("erasure-coded") },
-                { "type", QLIT_QSTR("438") },
+                { "type", QLIT_QSTR("445") },
                 {}
             })),
             {}
@@ -11923,7 +12110,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("364") },
+        { "name", QLIT_QSTR("370") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("dynamic"),
             QLIT_QSTR("fixed"),
@@ -11933,7 +12120,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("365") },
+        { "name", QLIT_QSTR("371") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("dynamic"),
             QLIT_QSTR("fixed"),
@@ -11949,7 +12136,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("366") },
+        { "name", QLIT_QSTR("372") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("inet"),
             QLIT_QSTR("unix"),
@@ -11963,57 +12150,57 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("354") },
+                { "type", QLIT_QSTR("360") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("367") },
+        { "name", QLIT_QSTR("373") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("421") },
+                { "type", QLIT_QSTR("428") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("368") },
+        { "name", QLIT_QSTR("374") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("422") },
+                { "type", QLIT_QSTR("429") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("369") },
+        { "name", QLIT_QSTR("375") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("423") },
+                { "type", QLIT_QSTR("430") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("370") },
+        { "name", QLIT_QSTR("376") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("371") },
+        { "name", QLIT_QSTR("377") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("file"),
             QLIT_QSTR("serial"),
@@ -12043,148 +12230,148 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("439") },
+                { "type", QLIT_QSTR("446") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("372") },
+        { "name", QLIT_QSTR("378") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("440") },
+                { "type", QLIT_QSTR("447") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("373") },
+        { "name", QLIT_QSTR("379") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("441") },
+                { "type", QLIT_QSTR("448") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("374") },
+        { "name", QLIT_QSTR("380") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("442") },
+                { "type", QLIT_QSTR("449") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("375") },
+        { "name", QLIT_QSTR("381") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("443") },
+                { "type", QLIT_QSTR("450") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("376") },
+        { "name", QLIT_QSTR("382") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("444") },
+                { "type", QLIT_QSTR("451") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("377") },
+        { "name", QLIT_QSTR("383") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("445") },
+                { "type", QLIT_QSTR("452") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("378") },
+        { "name", QLIT_QSTR("384") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("446") },
+                { "type", QLIT_QSTR("453") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("379") },
+        { "name", QLIT_QSTR("385") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("447") },
+                { "type", QLIT_QSTR("454") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("380") },
+        { "name", QLIT_QSTR("386") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("448") },
+                { "type", QLIT_QSTR("455") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("381") },
+        { "name", QLIT_QSTR("387") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("449") },
+                { "type", QLIT_QSTR("456") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("382") },
+        { "name", QLIT_QSTR("388") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("383") },
+        { "name", QLIT_QSTR("389") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("passthrough"),
             QLIT_QSTR("emulator"),
@@ -12196,31 +12383,31 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("450") },
+                { "type", QLIT_QSTR("457") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("384") },
+        { "name", QLIT_QSTR("390") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("451") },
+                { "type", QLIT_QSTR("458") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("385") },
+        { "name", QLIT_QSTR("391") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("386") },
+        { "name", QLIT_QSTR("392") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("number"),
             QLIT_QSTR("qcode"),
@@ -12238,25 +12425,25 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("387") },
+        { "name", QLIT_QSTR("393") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("452") },
+                { "type", QLIT_QSTR("459") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("388") },
+        { "name", QLIT_QSTR("394") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("389") },
+        { "name", QLIT_QSTR("395") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("key"),
             QLIT_QSTR("btn"),
@@ -12270,44 +12457,44 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("453") },
+                { "type", QLIT_QSTR("460") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("390") },
+        { "name", QLIT_QSTR("396") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("454") },
+                { "type", QLIT_QSTR("461") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("391") },
+        { "name", QLIT_QSTR("397") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("455") },
+                { "type", QLIT_QSTR("462") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("392") },
+        { "name", QLIT_QSTR("398") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("393") },
+        { "name", QLIT_QSTR("399") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("abort"),
             QLIT_QSTR("block-dirty-bitmap-add"),
@@ -12325,109 +12512,109 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("456") },
+                { "type", QLIT_QSTR("463") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("394") },
+        { "name", QLIT_QSTR("400") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("22") },
+                { "type", QLIT_QSTR("23") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("395") },
+        { "name", QLIT_QSTR("401") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("23") },
+                { "type", QLIT_QSTR("24") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("396") },
+        { "name", QLIT_QSTR("402") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("19") },
+                { "type", QLIT_QSTR("20") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("397") },
+        { "name", QLIT_QSTR("403") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("15") },
+                { "type", QLIT_QSTR("16") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("398") },
+        { "name", QLIT_QSTR("404") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("54") },
+                { "type", QLIT_QSTR("55") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("399") },
+        { "name", QLIT_QSTR("405") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("14") },
+                { "type", QLIT_QSTR("15") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("400") },
+        { "name", QLIT_QSTR("406") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("18") },
+                { "type", QLIT_QSTR("19") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("401") },
+        { "name", QLIT_QSTR("407") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("402") },
+        { "name", QLIT_QSTR("408") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("individual"),
             QLIT_QSTR("grouped"),
@@ -12437,7 +12624,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("403") },
+        { "name", QLIT_QSTR("409") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("string"),
             QLIT_QSTR("number"),
@@ -12452,9 +12639,9 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("404") },
+        { "element-type", QLIT_QSTR("410") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[404]") },
+        { "name", QLIT_QSTR("[410]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -12478,13 +12665,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("404") },
+        { "name", QLIT_QSTR("410") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("405") },
+        { "element-type", QLIT_QSTR("411") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[405]") },
+        { "name", QLIT_QSTR("[411]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -12502,13 +12689,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("405") },
+        { "name", QLIT_QSTR("411") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("406") },
+        { "element-type", QLIT_QSTR("412") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[406]") },
+        { "name", QLIT_QSTR("[412]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -12521,12 +12708,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("406") },
+        { "name", QLIT_QSTR("412") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("407") },
+        { "name", QLIT_QSTR("413") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("uninitialized"),
             QLIT_QSTR("stopped"),
@@ -12553,7 +12740,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("408") },
+        { "name", QLIT_QSTR("414") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -12571,32 +12758,32 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("409") },
+        { "name", QLIT_QSTR("415") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("bus") },
-                { "type", QLIT_QSTR("457") },
+                { "type", QLIT_QSTR("464") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("devices") },
-                { "type", QLIT_QSTR("[317]") },
+                { "type", QLIT_QSTR("[321]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("410") },
+        { "name", QLIT_QSTR("416") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("411") },
+        { "element-type", QLIT_QSTR("417") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[411]") },
+        { "name", QLIT_QSTR("[417]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -12636,12 +12823,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("411") },
+        { "name", QLIT_QSTR("417") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("412") },
+        { "name", QLIT_QSTR("418") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("string"),
             QLIT_QSTR("boolean"),
@@ -12697,12 +12884,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("413") },
+        { "name", QLIT_QSTR("419") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("414") },
+        { "name", QLIT_QSTR("420") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("unknown"),
             QLIT_QSTR("disabled-wait"),
@@ -12713,9 +12900,32 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         })) },
         {}
     })),
+    QLIT_QDICT(((QLitDictEntry[]) {
+        { "members", QLIT_QLIST(((QLitObject[]) {
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("l2-cache") },
+                { "type", QLIT_QSTR("465") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("refcount-cache") },
+                { "type", QLIT_QSTR("465") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("prefetched-l2-slices") },
+                { "type", QLIT_QSTR("int") },
+                {}
+            })),
+            {}
+        })) },
+        { "meta-type", QLIT_QSTR("object") },
+        { "name", QLIT_QSTR("421") },
+        {}
+    })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("415") },
+        { "name", QLIT_QSTR("422") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("qcow2"),
             QLIT_QSTR("vmdk"),
@@ -12728,44 +12938,44 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("458") },
+                { "type", QLIT_QSTR("466") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("416") },
+        { "name", QLIT_QSTR("423") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("459") },
+                { "type", QLIT_QSTR("467") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("417") },
+        { "name", QLIT_QSTR("424") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("data") },
-                { "type", QLIT_QSTR("460") },
+                { "type", QLIT_QSTR("468") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("418") },
+        { "name", QLIT_QSTR("425") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("419") },
+        { "name", QLIT_QSTR("426") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("l1_update"),
             QLIT_QSTR("l1_grow_alloc_table"),
@@ -12819,7 +13029,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("420") },
+        { "name", QLIT_QSTR("427") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("inet"),
             QLIT_QSTR("unix"),
@@ -12839,7 +13049,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("421") },
+        { "name", QLIT_QSTR("428") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -12857,7 +13067,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("422") },
+        { "name", QLIT_QSTR("429") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -12870,12 +13080,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("423") },
+        { "name", QLIT_QSTR("430") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("424") },
+        { "name", QLIT_QSTR("431") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("inet"),
             {}
@@ -12887,7 +13097,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("template") },
-                { "type", QLIT_QSTR("426") },
+                { "type", QLIT_QSTR("433") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -12941,12 +13151,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("425") },
+        { "name", QLIT_QSTR("432") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("426") },
+        { "name", QLIT_QSTR("433") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("none"),
             QLIT_QSTR("constant"),
@@ -12958,7 +13168,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("427") },
+        { "name", QLIT_QSTR("434") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("aes"),
             QLIT_QSTR("luks"),
@@ -12977,7 +13187,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("428") },
+        { "name", QLIT_QSTR("435") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -12991,12 +13201,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("429") },
+        { "name", QLIT_QSTR("436") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("430") },
+        { "name", QLIT_QSTR("437") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("aes"),
             {}
@@ -13005,7 +13215,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("431") },
+        { "name", QLIT_QSTR("438") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("none"),
             QLIT_QSTR("hash"),
@@ -13019,14 +13229,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("432") },
+        { "name", QLIT_QSTR("439") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("type") },
-                { "type", QLIT_QSTR("461") },
+                { "type", QLIT_QSTR("469") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -13037,12 +13247,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("433") },
+        { "name", QLIT_QSTR("440") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("434") },
+        { "name", QLIT_QSTR("441") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("qcow"),
             QLIT_QSTR("luks"),
@@ -13061,31 +13271,31 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("cipher-alg") },
-                { "type", QLIT_QSTR("357") },
+                { "type", QLIT_QSTR("363") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("cipher-mode") },
-                { "type", QLIT_QSTR("358") },
+                { "type", QLIT_QSTR("364") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("ivgen-alg") },
-                { "type", QLIT_QSTR("359") },
+                { "type", QLIT_QSTR("365") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("ivgen-hash-alg") },
-                { "type", QLIT_QSTR("360") },
+                { "type", QLIT_QSTR("366") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("hash-alg") },
-                { "type", QLIT_QSTR("360") },
+                { "type", QLIT_QSTR("366") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -13097,12 +13307,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("435") },
+        { "name", QLIT_QSTR("442") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("436") },
+        { "name", QLIT_QSTR("443") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("full"),
             QLIT_QSTR("erasure-coded"),
@@ -13120,7 +13330,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("437") },
+        { "name", QLIT_QSTR("444") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13138,7 +13348,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("438") },
+        { "name", QLIT_QSTR("445") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13175,7 +13385,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("439") },
+        { "name", QLIT_QSTR("446") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13200,7 +13410,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("440") },
+        { "name", QLIT_QSTR("447") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13219,7 +13429,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("addr") },
-                { "type", QLIT_QSTR("265") },
+                { "type", QLIT_QSTR("269") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -13267,7 +13477,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("441") },
+        { "name", QLIT_QSTR("448") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13286,19 +13496,19 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("remote") },
-                { "type", QLIT_QSTR("265") },
+                { "type", QLIT_QSTR("269") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("local") },
-                { "type", QLIT_QSTR("265") },
+                { "type", QLIT_QSTR("269") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("442") },
+        { "name", QLIT_QSTR("449") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13318,7 +13528,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("443") },
+        { "name", QLIT_QSTR("450") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13343,7 +13553,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("444") },
+        { "name", QLIT_QSTR("451") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13369,7 +13579,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("445") },
+        { "name", QLIT_QSTR("452") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13394,7 +13604,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("446") },
+        { "name", QLIT_QSTR("453") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13419,7 +13629,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("447") },
+        { "name", QLIT_QSTR("454") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13463,7 +13673,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("448") },
+        { "name", QLIT_QSTR("455") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13489,7 +13699,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("449") },
+        { "name", QLIT_QSTR("456") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13509,7 +13719,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("450") },
+        { "name", QLIT_QSTR("457") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13522,12 +13732,12 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("451") },
+        { "name", QLIT_QSTR("458") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("452") },
+        { "name", QLIT_QSTR("459") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("unmapped"),
             QLIT_QSTR("shift"),
@@ -13685,7 +13895,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("key") },
-                { "type", QLIT_QSTR("288") },
+                { "type", QLIT_QSTR("292") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -13696,14 +13906,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("453") },
+        { "name", QLIT_QSTR("460") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("button") },
-                { "type", QLIT_QSTR("462") },
+                { "type", QLIT_QSTR("470") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -13714,14 +13924,14 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("454") },
+        { "name", QLIT_QSTR("461") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("axis") },
-                { "type", QLIT_QSTR("463") },
+                { "type", QLIT_QSTR("471") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -13732,7 +13942,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("455") },
+        { "name", QLIT_QSTR("462") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13740,7 +13950,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("456") },
+        { "name", QLIT_QSTR("463") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13762,23 +13972,51 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("io_range") },
-                { "type", QLIT_QSTR("464") },
+                { "type", QLIT_QSTR("472") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("memory_range") },
-                { "type", QLIT_QSTR("464") },
+                { "type", QLIT_QSTR("472") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("prefetchable_range") },
-                { "type", QLIT_QSTR("464") },
+                { "type", QLIT_QSTR("472") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("457") },
+        { "name", QLIT_QSTR("464") },
+        {}
+    })),
+    QLIT_QDICT(((QLitDictEntry[]) {
+        { "members", QLIT_QLIST(((QLitObject[]) {
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("size") },
+                { "type", QLIT_QSTR("int") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("max-size") },
+                { "type", QLIT_QSTR("int") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("hits") },
+                { "type", QLIT_QSTR("int") },
+                {}
+            })),
+            QLIT_QDICT(((QLitDictEntry[]) {
+                { "name", QLIT_QSTR("misses") },
+                { "type", QLIT_QSTR("int") },
+                {}
+            })),
+            {}
+        })) },
+        { "meta-type", QLIT_QSTR("object") },
+        { "name", QLIT_QSTR("465") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13808,13 +14046,13 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("encrypt") },
-                { "type", QLIT_QSTR("465") },
+                { "type", QLIT_QSTR("473") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("458") },
+        { "name", QLIT_QSTR("466") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -13836,41 +14074,41 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("extents") },
-                { "type", QLIT_QSTR("[213]") },
+                { "type", QLIT_QSTR("[216]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("459") },
+        { "name", QLIT_QSTR("467") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("cipher-alg") },
-                { "type", QLIT_QSTR("357") },
+                { "type", QLIT_QSTR("363") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("cipher-mode") },
-                { "type", QLIT_QSTR("358") },
+                { "type", QLIT_QSTR("364") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("ivgen-alg") },
-                { "type", QLIT_QSTR("359") },
+                { "type", QLIT_QSTR("365") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "default", QLIT_QNULL },
                 { "name", QLIT_QSTR("ivgen-hash-alg") },
-                { "type", QLIT_QSTR("360") },
+                { "type", QLIT_QSTR("366") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("hash-alg") },
-                { "type", QLIT_QSTR("360") },
+                { "type", QLIT_QSTR("366") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
@@ -13890,18 +14128,18 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("slots") },
-                { "type", QLIT_QSTR("[466]") },
+                { "type", QLIT_QSTR("[474]") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("460") },
+        { "name", QLIT_QSTR("468") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("461") },
+        { "name", QLIT_QSTR("469") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("md5"),
             QLIT_QSTR("sha1"),
@@ -13911,7 +14149,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("462") },
+        { "name", QLIT_QSTR("470") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("left"),
             QLIT_QSTR("middle"),
@@ -13926,7 +14164,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "meta-type", QLIT_QSTR("enum") },
-        { "name", QLIT_QSTR("463") },
+        { "name", QLIT_QSTR("471") },
         { "values", QLIT_QLIST(((QLitObject[]) {
             QLIT_QSTR("x"),
             QLIT_QSTR("y"),
@@ -13949,30 +14187,30 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("464") },
+        { "name", QLIT_QSTR("472") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
         { "members", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "name", QLIT_QSTR("format") },
-                { "type", QLIT_QSTR("427") },
+                { "type", QLIT_QSTR("434") },
                 {}
             })),
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("465") },
+        { "name", QLIT_QSTR("473") },
         { "tag", QLIT_QSTR("format") },
         { "variants", QLIT_QLIST(((QLitObject[]) {
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("aes") },
-                { "type", QLIT_QSTR("467") },
+                { "type", QLIT_QSTR("475") },
                 {}
             })),
             QLIT_QDICT(((QLitDictEntry[]) {
                 { "case", QLIT_QSTR("luks") },
-                { "type", QLIT_QSTR("460") },
+                { "type", QLIT_QSTR("468") },
                 {}
             })),
             {}
@@ -13980,15 +14218,15 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("213") },
+        { "element-type", QLIT_QSTR("216") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[213]") },
+        { "name", QLIT_QSTR("[216]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
-        { "element-type", QLIT_QSTR("466") },
+        { "element-type", QLIT_QSTR("474") },
         { "meta-type", QLIT_QSTR("array") },
-        { "name", QLIT_QSTR("[466]") },
+        { "name", QLIT_QSTR("[474]") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -14018,7 +14256,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("466") },
+        { "name", QLIT_QSTR("474") },
         {}
     })),
     QLIT_QDICT(((QLitDictEntry[]) {
@@ -14026,7 +14264,7 @@ const QLitObject qmp_schema_qlit = QLIT_QLIST(((QLitObject[]) {
             {}
         })) },
         { "meta-type", QLIT_QSTR("object") },
-        { "name", QLIT_QSTR("467") },
+        { "name", QLIT_QSTR("475") },
         {}
     })),
     {}
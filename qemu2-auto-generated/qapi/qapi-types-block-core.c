@@ -342,6 +342,52 @@ void qapi_free_BlockDeviceStats(BlockDeviceStats *obj)
     visit_free(v);
 }
 
+void qapi_free_Qcow2CacheStats(Qcow2CacheStats *obj)
+{
+    Visitor *v;
+
+    if (!obj) {
+        return;
+    }
+
+    v = qapi_dealloc_visitor_new();
+    visit_type_Qcow2CacheStats(v, NULL, &obj, NULL);
+    visit_free(v);
+}
+
+void qapi_free_BlockStatsSpecificQcow2(BlockStatsSpecificQcow2 *obj)
+{
+    Visitor *v;
+
+    if (!obj) {
+        return;
+    }
+
+    v = qapi_dealloc_visitor_new();
+    visit_type_BlockStatsSpecificQcow2(v, NULL, &obj, NULL);
+    visit_free(v);
+}
+
+const QEnumLookup BlockStatsSpecificKind_lookup = {
+    .array = (const char *const[]) {
+        [BLOCK_STATS_SPECIFIC_KIND_QCOW2] = "qcow2",
+    },
+    .size = BLOCK_STATS_SPECIFIC_KIND__MAX
+};
+
+void qapi_free_BlockStatsSpecific(BlockStatsSpecific *obj)
+{
+    Visitor *v;
+
+    if (!obj) {
+        return;
+    }
+
+    v = qapi_dealloc_visitor_new();
+    visit_type_BlockStatsSpecific(v, NULL, &obj, NULL);
+    visit_free(v);
+}
+
 void qapi_free_BlockStats(BlockStats *obj)
 {
     Visitor *v;
@@ -368,6 +414,32 @@ void qapi_free_BlockStatsList(BlockStatsList *obj)
     visit_free(v);
 }
 
+void qapi_free_SharedCacheInfo(SharedCacheInfo *obj)
+{
+    Visitor *v;
+
+    if (!obj) {
+        return;
+    }
+
+    v = qapi_dealloc_visitor_new();
+    visit_type_SharedCacheInfo(v, NULL, &obj, NULL);
+    visit_free(v);
+}
+
+void qapi_free_SharedCacheInfoList(SharedCacheInfoList *obj)
+{
+    Visitor *v;
+
+    if (!obj) {
+        return;
+    }
+
+    v = qapi_dealloc_visitor_new();
+    visit_type_SharedCacheInfoList(v, NULL, &obj, NULL);
+    visit_free(v);
+}
+
 const QEnumLookup BlockdevOnError_lookup = {
     .array = (const char *const[]) {
         [BLOCKDEV_ON_ERROR_REPORT] = "report",
@@ -627,6 +699,7 @@ const QEnumLookup BlockdevAioOptions_lookup = {
     .array = (const char *const[]) {
         [BLOCKDEV_AIO_OPTIONS_THREADS] = "threads",
         [BLOCKDEV_AIO_OPTIONS_NATIVE] = "native",
+        [BLOCKDEV_AIO_OPTIONS_IO_URING] = "io_uring",
     },
     .size = BLOCKDEV_AIO_OPTIONS__MAX
 };
@@ -674,6 +747,7 @@ const QEnumLookup BlockdevDriver_lookup = {
         [BLOCKDEV_DRIVER_RAW] = "raw",
         [BLOCKDEV_DRIVER_RBD] = "rbd",
         [BLOCKDEV_DRIVER_REPLICATION] = "replication",
+        [BLOCKDEV_DRIVER_SHARED_CACHE] = "shared-cache",
         [BLOCKDEV_DRIVER_SHEEPDOG] = "sheepdog",
         [BLOCKDEV_DRIVER_SSH] = "ssh",
         [BLOCKDEV_DRIVER_THROTTLE] = "throttle",
@@ -1381,6 +1455,19 @@ void qapi_free_BlockdevOptionsThrottle(BlockdevOptionsThrottle *obj)
     visit_free(v);
 }
 
+void qapi_free_BlockdevOptionsSharedCache(BlockdevOptionsSharedCache *obj)
+{
+    Visitor *v;
+
+    if (!obj) {
+        return;
+    }
+
+    v = qapi_dealloc_visitor_new();
+    visit_type_BlockdevOptionsSharedCache(v, NULL, &obj, NULL);
+    visit_free(v);
+}
+
 void qapi_free_BlockdevOptions(BlockdevOptions *obj)
 {
     Visitor *v;
@@ -109,12 +109,34 @@ typedef struct BlockDeviceTimedStatsList BlockDeviceTimedStatsList;
 
 typedef struct BlockDeviceStats BlockDeviceStats;
 
+typedef struct Qcow2CacheStats Qcow2CacheStats;
+
+typedef struct BlockStatsSpecificQcow2 BlockStatsSpecificQcow2;
+
+typedef struct q_obj_BlockStatsSpecificQcow2_wrapper q_obj_BlockStatsSpecificQcow2_wrapper;
+
+typedef enum BlockStatsSpecificKind {
+    BLOCK_STATS_SPECIFIC_KIND_QCOW2 = 0,
+    BLOCK_STATS_SPECIFIC_KIND__MAX = 1,
+} BlockStatsSpecificKind;
+
+#define BlockStatsSpecificKind_str(val) \
+    qapi_enum_lookup(&BlockStatsSpecificKind_lookup, (val))
+
+extern const QEnumLookup BlockStatsSpecificKind_lookup;
+
+typedef struct BlockStatsSpecific BlockStatsSpecific;
+
 typedef struct BlockStats BlockStats;
 
 typedef struct q_obj_query_blockstats_arg q_obj_query_blockstats_arg;
 
 typedef struct BlockStatsList BlockStatsList;
 
+typedef struct SharedCacheInfo SharedCacheInfo;
+
+typedef struct SharedCacheInfoList SharedCacheInfoList;
+
 typedef enum BlockdevOnError {
     BLOCKDEV_ON_ERROR_REPORT = 0,
     BLOCKDEV_ON_ERROR_IGNORE = 1,
@@ -280,7 +302,8 @@ extern const QEnumLookup BlockdevDetectZeroesOptions_lookup;
 typedef enum BlockdevAioOptions {
     BLOCKDEV_AIO_OPTIONS_THREADS = 0,
     BLOCKDEV_AIO_OPTIONS_NATIVE = 1,
-    BLOCKDEV_AIO_OPTIONS__MAX = 2,
+    BLOCKDEV_AIO_OPTIONS_IO_URING = 2,
+    BLOCKDEV_AIO_OPTIONS__MAX = 3,
 } BlockdevAioOptions;
 
 #define BlockdevAioOptions_str(val) \
@@ -319,16 +342,17 @@ typedef enum BlockdevDriver {
     BLOCKDEV_DRIVER_RAW = 25,
     BLOCKDEV_DRIVER_RBD = 26,
     BLOCKDEV_DRIVER_REPLICATION = 27,
-    BLOCKDEV_DRIVER_SHEEPDOG = 28,
-    BLOCKDEV_DRIVER_SSH = 29,
-    BLOCKDEV_DRIVER_THROTTLE = 30,
-    BLOCKDEV_DRIVER_VDI = 31,
-    BLOCKDEV_DRIVER_VHDX = 32,
-    BLOCKDEV_DRIVER_VMDK = 33,
-    BLOCKDEV_DRIVER_VPC = 34,
-    BLOCKDEV_DRIVER_VVFAT = 35,
-    BLOCKDEV_DRIVER_VXHS = 36,
-    BLOCKDEV_DRIVER__MAX = 37,
+    BLOCKDEV_DRIVER_SHARED_CACHE = 28,
+    BLOCKDEV_DRIVER_SHEEPDOG = 29,
+    BLOCKDEV_DRIVER_SSH = 30,
+    BLOCKDEV_DRIVER_THROTTLE = 31,
+    BLOCKDEV_DRIVER_VDI = 32,
+    BLOCKDEV_DRIVER_VHDX = 33,
+    BLOCKDEV_DRIVER_VMDK = 34,
+    BLOCKDEV_DRIVER_VPC = 35,
+    BLOCKDEV_DRIVER_VVFAT = 36,
+    BLOCKDEV_DRIVER_VXHS = 37,
+    BLOCKDEV_DRIVER__MAX = 38,
 } BlockdevDriver;
 
 #define BlockdevDriver_str(val) \
@@ -596,6 +620,8 @@ typedef struct BlockdevOptionsVxHS BlockdevOptionsVxHS;
 
 typedef struct BlockdevOptionsThrottle BlockdevOptionsThrottle;
 
+typedef struct BlockdevOptionsSharedCache BlockdevOptionsSharedCache;
+
 typedef struct q_obj_BlockdevOptions_base q_obj_BlockdevOptions_base;
 
 typedef struct BlockdevOptions BlockdevOptions;
@@ -1124,12 +1150,44 @@ struct BlockDeviceStats {
 
 void qapi_free_BlockDeviceStats(BlockDeviceStats *obj);
 
+struct Qcow2CacheStats {
+    int64_t size;
+    int64_t max_size;
+    int64_t hits;
+    int64_t misses;
+};
+
+void qapi_free_Qcow2CacheStats(Qcow2CacheStats *obj);
+
+struct BlockStatsSpecificQcow2 {
+    Qcow2CacheStats *l2_cache;
+    Qcow2CacheStats *refcount_cache;
+    int64_t prefetched_l2_slices;
+};
+
+void qapi_free_BlockStatsSpecificQcow2(BlockStatsSpecificQcow2 *obj);
+
+struct q_obj_BlockStatsSpecificQcow2_wrapper {
+    BlockStatsSpecificQcow2 *data;
+};
+
+struct BlockStatsSpecific {
+    BlockStatsSpecificKind type;
+    union { /* union tag is @type */
+        q_obj_BlockStatsSpecificQcow2_wrapper qcow2;
+    } u;
+};
+
+void qapi_free_BlockStatsSpecific(BlockStatsSpecific *obj);
+
 struct BlockStats {
     bool has_device;
     char *device;
     bool has_node_name;
     char *node_name;
     BlockDeviceStats *stats;
+    bool has_driver_specific;
+    BlockStatsSpecific *driver_specific;
     bool has_parent;
     BlockStats *parent;
     bool has_backing;
@@ -1150,6 +1208,29 @@ struct BlockStatsList {
 
 void qapi_free_BlockStatsList(BlockStatsList *obj);
 
+struct SharedCacheInfo {
+    char *node_name;
+    bool has_device;
+    char *device;
+    char *image;
+    bool shared;
+    int64_t size;
+    int64_t block_size;
+    int64_t instances;
+    int64_t hits;
+    int64_t misses;
+    int64_t inserts;
+};
+
+void qapi_free_SharedCacheInfo(SharedCacheInfo *obj);
+
+struct SharedCacheInfoList {
+    SharedCacheInfoList *next;
+    SharedCacheInfo *value;
+};
+
+void qapi_free_SharedCacheInfoList(SharedCacheInfoList *obj);
+
 struct BlockJobInfo {
     char *type;
     char *device;
@@ -1693,6 +1774,10 @@ struct BlockdevOptionsQcow2 {
     int64_t refcount_cache_size;
     bool has_cache_clean_interval;
     int64_t cache_clean_interval;
+    bool has_cache_adaptive;
+    bool cache_adaptive;
+    bool has_l2_prefetch;
+    bool l2_prefetch;
     bool has_encrypt;
     BlockdevQcow2Encryption *encrypt;
 };
@@ -2120,6 +2205,14 @@ struct BlockdevOptionsThrottle {
 
 void qapi_free_BlockdevOptionsThrottle(BlockdevOptionsThrottle *obj);
 
+struct BlockdevOptionsSharedCache {
+    BlockdevRef *file;
+    bool has_size;
+    uint64_t size;
+};
+
+void qapi_free_BlockdevOptionsSharedCache(BlockdevOptionsSharedCache *obj);
+
 struct q_obj_BlockdevOptions_base {
     BlockdevDriver driver;
     bool has_node_name;
@@ -2179,6 +2272,7 @@ struct BlockdevOptions {
         BlockdevOptionsRaw raw;
         BlockdevOptionsRbd rbd;
         BlockdevOptionsReplication replication;
+        BlockdevOptionsSharedCache shared_cache;
         BlockdevOptionsSheepdog sheepdog;
         BlockdevOptionsSsh ssh;
         BlockdevOptionsThrottle throttle;
@@ -2465,6 +2559,7 @@ struct BlockdevCreateOptions {
         BlockdevCreateNotSupported raw;
         BlockdevCreateOptionsRbd rbd;
         BlockdevCreateNotSupported replication;
+        BlockdevCreateNotSupported shared_cache;
         BlockdevCreateOptionsSheepdog sheepdog;
         BlockdevCreateOptionsSsh ssh;
         BlockdevCreateNotSupported throttle;
@@ -489,6 +489,8 @@ typedef struct q_obj_COMMAND_DROPPED_arg q_obj_COMMAND_DROPPED_arg;
 
 typedef struct q_obj_x_oob_test_arg q_obj_x_oob_test_arg;
 
+typedef struct q_obj_x_tcg_profile_dump_arg q_obj_x_tcg_profile_dump_arg;
+
 struct QMPCapabilityList {
     QMPCapabilityList *next;
     QMPCapability value;
@@ -1465,4 +1467,8 @@ struct q_obj_x_oob_test_arg {
     bool lock;
 };
 
+struct q_obj_x_tcg_profile_dump_arg {
+    char *filename;
+};
+
 #endif /* QAPI_TYPES_MISC_H */
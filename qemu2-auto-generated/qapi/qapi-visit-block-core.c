@@ -1609,6 +1609,170 @@ out:
     error_propagate(errp, err);
 }
 
+void visit_type_Qcow2CacheStats_members(Visitor *v, Qcow2CacheStats *obj, Error **errp)
+{
+    Error *err = NULL;
+
+    visit_type_int(v, "size", &obj->size, &err);
+    if (err) {
+        goto out;
+    }
+    visit_type_int(v, "max-size", &obj->max_size, &err);
+    if (err) {
+        goto out;
+    }
+    visit_type_int(v, "hits", &obj->hits, &err);
+    if (err) {
+        goto out;
+    }
+    visit_type_int(v, "misses", &obj->misses, &err);
+    if (err) {
+        goto out;
+    }
+
+out:
+    error_propagate(errp, err);
+}
+
+void visit_type_Qcow2CacheStats(Visitor *v, const char *name, Qcow2CacheStats **obj, Error **errp)
+{
+    Error *err = NULL;
+
+    visit_start_struct(v, name, (void **)obj, sizeof(Qcow2CacheStats), &err);
+    if (err) {
+        goto out;
+    }
+    if (!*obj) {
+        goto out_obj;
+    }
+    visit_type_Qcow2CacheStats_members(v, *obj, &err);
+    if (err) {
+        goto out_obj;
+    }
+    visit_check_struct(v, &err);
+out_obj:
+    visit_end_struct(v, (void **)obj);
+    if (err && visit_is_input(v)) {
+        qapi_free_Qcow2CacheStats(*obj);
+        *obj = NULL;
+    }
+out:
+    error_propagate(errp, err);
+}
+
+void visit_type_BlockStatsSpecificQcow2_members(Visitor *v, BlockStatsSpecificQcow2 *obj, Error **errp)
+{
+    Error *err = NULL;
+
+    visit_type_Qcow2CacheStats(v, "l2-cache", &obj->l2_cache, &err);
+    if (err) {
+        goto out;
+    }
+    visit_type_Qcow2CacheStats(v, "refcount-cache", &obj->refcount_cache, &err);
+    if (err) {
+        goto out;
+    }
+    visit_type_int(v, "prefetched-l2-slices", &obj->prefetched_l2_slices, &err);
+    if (err) {
+        goto out;
+    }
+
+out:
+    error_propagate(errp, err);
+}
+
+void visit_type_BlockStatsSpecificQcow2(Visitor *v, const char *name, BlockStatsSpecificQcow2 **obj, Error **errp)
+{
+    Error *err = NULL;
+
+    visit_start_struct(v, name, (void **)obj, sizeof(BlockStatsSpecificQcow2), &err);
+    if (err) {
+        goto out;
+    }
+    if (!*obj) {
+        goto out_obj;
+    }
+    visit_type_BlockStatsSpecificQcow2_members(v, *obj, &err);
+    if (err) {
+        goto out_obj;
+    }
+    visit_check_struct(v, &err);
+out_obj:
+    visit_end_struct(v, (void **)obj);
+    if (err && visit_is_input(v)) {
+        qapi_free_BlockStatsSpecificQcow2(*obj);
+        *obj = NULL;
+    }
+out:
+    error_propagate(errp, err);
+}
+
+void visit_type_q_obj_BlockStatsSpecificQcow2_wrapper_members(Visitor *v, q_obj_BlockStatsSpecificQcow2_wrapper *obj, Error **errp)
+{
+    Error *err = NULL;
+
+    visit_type_BlockStatsSpecificQcow2(v, "data", &obj->data, &err);
+    if (err) {
+        goto out;
+    }
+
+out:
+    error_propagate(errp, err);
+}
+
+void visit_type_BlockStatsSpecificKind(Visitor *v, const char *name, BlockStatsSpecificKind *obj, Error **errp)
+{
+    int value = *obj;
+    visit_type_enum(v, name, &value, &BlockStatsSpecificKind_lookup, errp);
+    *obj = value;
+}
+
+void visit_type_BlockStatsSpecific_members(Visitor *v, BlockStatsSpecific *obj, Error **errp)
+{
+    Error *err = NULL;
+
+    visit_type_BlockStatsSpecificKind(v, "type", &obj->type, &err);
+    if (err) {
+        goto out;
+    }
+    switch (obj->type) {
+    case BLOCK_STATS_SPECIFIC_KIND_QCOW2:
+        visit_type_q_obj_BlockStatsSpecificQcow2_wrapper_members(v, &obj->u.qcow2, &err);
+        break;
+    default:
+        abort();
+    }
+
+out:
+    error_propagate(errp, err);
+}
+
+void visit_type_BlockStatsSpecific(Visitor *v, const char *name, BlockStatsSpecific **obj, Error **errp)
+{
+    Error *err = NULL;
+
+    visit_start_struct(v, name, (void **)obj, sizeof(BlockStatsSpecific), &err);
+    if (err) {
+        goto out;
+    }
+    if (!*obj) {
+        goto out_obj;
+    }
+    visit_type_BlockStatsSpecific_members(v, *obj, &err);
+    if (err) {
+        goto out_obj;
+    }
+    visit_check_struct(v, &err);
+out_obj:
+    visit_end_struct(v, (void **)obj);
+    if (err && visit_is_input(v)) {
+        qapi_free_BlockStatsSpecific(*obj);
+        *obj = NULL;
+    }
+out:
+    error_propagate(errp, err);
+}
+
 void visit_type_BlockStats_members(Visitor *v, BlockStats *obj, Error **errp)
 {
     Error *err = NULL;
@@ -1629,6 +1793,12 @@ void visit_type_BlockStats_members(Visitor *v, BlockStats *obj, Error **errp)
     if (err) {
         goto out;
     }
+    if (visit_optional(v, "driver-specific", &obj->has_driver_specific)) {
+        visit_type_BlockStatsSpecific(v, "driver-specific", &obj->driver_specific, &err);
+        if (err) {
+            goto out;
+        }
+    }
     if (visit_optional(v, "parent", &obj->has_parent)) {
         visit_type_BlockStats(v, "parent", &obj->parent, &err);
         if (err) {
@@ -1718,6 +1888,114 @@ out:
     error_propagate(errp, err);
 }
 
+void visit_type_SharedCacheInfo_members(Visitor *v, SharedCacheInfo *obj, Error **errp)
+{
+    Error *err = NULL;
+
+    visit_type_str(v, "node-name", &obj->node_name, &err);
+    if (err) {
+        goto out;
+    }
+    if (visit_optional(v, "device", &obj->has_device)) {
+        visit_type_str(v, "device", &obj->device, &err);
+        if (err) {
+            goto out;
+        }
+    }
+    visit_type_str(v, "image", &obj->image, &err);
+    if (err) {
+        goto out;
+    }
+    visit_type_bool(v, "shared", &obj->shared, &err);
+    if (err) {
+        goto out;
+    }
+    visit_type_int(v, "size", &obj->size, &err);
+    if (err) {
+        goto out;
+    }
+    visit_type_int(v, "block-size", &obj->block_size, &err);
+    if (err) {
+        goto out;
+    }
+    visit_type_int(v, "instances", &obj->instances, &err);
+    if (err) {
+        goto out;
+    }
+    visit_type_int(v, "hits", &obj->hits, &err);
+    if (err) {
+        goto out;
+    }
+    visit_type_int(v, "misses", &obj->misses, &err);
+    if (err) {
+        goto out;
+    }
+    visit_type_int(v, "inserts", &obj->inserts, &err);
+    if (err) {
+        goto out;
+    }
+
+out:
+    error_propagate(errp, err);
+}
+
+void visit_type_SharedCacheInfo(Visitor *v, const char *name, SharedCacheInfo **obj, Error **errp)
+{
+    Error *err = NULL;
+
+    visit_start_struct(v, name, (void **)obj, sizeof(SharedCacheInfo), &err);
+    if (err) {
+        goto out;
+    }
+    if (!*obj) {
+        goto out_obj;
+    }
+    visit_type_SharedCacheInfo_members(v, *obj, &err);
+    if (err) {
+        goto out_obj;
+    }
+    visit_check_struct(v, &err);
+out_obj:
+    visit_end_struct(v, (void **)obj);
+    if (err && visit_is_input(v)) {
+        qapi_free_SharedCacheInfo(*obj);
+        *obj = NULL;
+    }
+out:
+    error_propagate(errp, err);
+}
+
+void visit_type_SharedCacheInfoList(Visitor *v, const char *name, SharedCacheInfoList **obj, Error **errp)
+{
+    Error *err = NULL;
+    SharedCacheInfoList *tail;
+    size_t size = sizeof(**obj);
+
+    visit_start_list(v, name, (GenericList **)obj, size, &err);
+    if (err) {
+        goto out;
+    }
+
+    for (tail = *obj; tail;
+         tail = (SharedCacheInfoList *)visit_next_list(v, (GenericList *)tail, size)) {
+        visit_type_SharedCacheInfo(v, NULL, &tail->value, &err);
+        if (err) {
+            break;
+        }
+    }
+
+    if (!err) {
+        visit_check_list(v, &err);
+    }
+    visit_end_list(v, (void **)obj);
+    if (err && visit_is_input(v)) {
+        qapi_free_SharedCacheInfoList(*obj);
+        *obj = NULL;
+    }
+out:
+    error_propagate(errp, err);
+}
+
 void visit_type_BlockdevOnError(Visitor *v, const char *name, BlockdevOnError *obj, Error **errp)
 {
     int value = *obj;
@@ -3913,6 +4191,18 @@ void visit_type_BlockdevOptionsQcow2_members(Visitor *v, BlockdevOptionsQcow2 *o
             goto out;
         }
     }
+    if (visit_optional(v, "cache-adaptive", &obj->has_cache_adaptive)) {
+        visit_type_bool(v, "cache-adaptive", &obj->cache_adaptive, &err);
+        if (err) {
+            goto out;
+        }
+    }
+    if (visit_optional(v, "l2-prefetch", &obj->has_l2_prefetch)) {
+        visit_type_bool(v, "l2-prefetch", &obj->l2_prefetch, &err);
+        if (err) {
+            goto out;
+        }
+    }
     if (visit_optional(v, "encrypt", &obj->has_encrypt)) {
         visit_type_BlockdevQcow2Encryption(v, "encrypt", &obj->encrypt, &err);
         if (err) {
@@ -5568,6 +5858,51 @@ out:
     error_propagate(errp, err);
 }
 
+void visit_type_BlockdevOptionsSharedCache_members(Visitor *v, BlockdevOptionsSharedCache *obj, Error **errp)
+{
+    Error *err = NULL;
+
+    visit_type_BlockdevRef(v, "file", &obj->file, &err);
+    if (err) {
+        goto out;
+    }
+    if (visit_optional(v, "size", &obj->has_size)) {
+        visit_type_size(v, "size", &obj->size, &err);
+        if (err) {
+            goto out;
+        }
+    }
+
+out:
+    error_propagate(errp, err);
+}
+
+void visit_type_BlockdevOptionsSharedCache(Visitor *v, const char *name, BlockdevOptionsSharedCache **obj, Error **errp)
+{
+    Error *err = NULL;
+
+    visit_start_struct(v, name, (void **)obj, sizeof(BlockdevOptionsSharedCache), &err);
+    if (err) {
+        goto out;
+    }
+    if (!*obj) {
+        goto out_obj;
+    }
+    visit_type_BlockdevOptionsSharedCache_members(v, *obj, &err);
+    if (err) {
+        goto out_obj;
+    }
+    visit_check_struct(v, &err);
+out_obj:
+    visit_end_struct(v, (void **)obj);
+    if (err && visit_is_input(v)) {
+        qapi_free_BlockdevOptionsSharedCache(*obj);
+        *obj = NULL;
+    }
+out:
+    error_propagate(errp, err);
+}
+
 void visit_type_q_obj_BlockdevOptions_base_members(Visitor *v, q_obj_BlockdevOptions_base *obj, Error **errp)
 {
     Error *err = NULL;
@@ -5710,6 +6045,9 @@ void visit_type_BlockdevOptions_members(Visitor *v, BlockdevOptions *obj, Error
     case BLOCKDEV_DRIVER_REPLICATION:
         visit_type_BlockdevOptionsReplication_members(v, &obj->u.replication, &err);
         break;
+    case BLOCKDEV_DRIVER_SHARED_CACHE:
+        visit_type_BlockdevOptionsSharedCache_members(v, &obj->u.shared_cache, &err);
+        break;
     case BLOCKDEV_DRIVER_SHEEPDOG:
         visit_type_BlockdevOptionsSheepdog_members(v, &obj->u.sheepdog, &err);
         break;
@@ -6970,6 +7308,9 @@ void visit_type_BlockdevCreateOptions_members(Visitor *v, BlockdevCreateOptions
     case BLOCKDEV_DRIVER_REPLICATION:
         visit_type_BlockdevCreateNotSupported_members(v, &obj->u.replication, &err);
         break;
+    case BLOCKDEV_DRIVER_SHARED_CACHE:
+        visit_type_BlockdevCreateNotSupported_members(v, &obj->u.shared_cache, &err);
+        break;
     case BLOCKDEV_DRIVER_SHEEPDOG:
         visit_type_BlockdevCreateOptionsSheepdog_members(v, &obj->u.sheepdog, &err);
         break;
@@ -90,11 +90,27 @@ void visit_type_BlockDeviceTimedStatsList(Visitor *v, const char *name, BlockDev
 void visit_type_BlockDeviceStats_members(Visitor *v, BlockDeviceStats *obj, Error **errp);
 void visit_type_BlockDeviceStats(Visitor *v, const char *name, BlockDeviceStats **obj, Error **errp);
 
+void visit_type_Qcow2CacheStats_members(Visitor *v, Qcow2CacheStats *obj, Error **errp);
+void visit_type_Qcow2CacheStats(Visitor *v, const char *name, Qcow2CacheStats **obj, Error **errp);
+
+void visit_type_BlockStatsSpecificQcow2_members(Visitor *v, BlockStatsSpecificQcow2 *obj, Error **errp);
+void visit_type_BlockStatsSpecificQcow2(Visitor *v, const char *name, BlockStatsSpecificQcow2 **obj, Error **errp);
+
+void visit_type_q_obj_BlockStatsSpecificQcow2_wrapper_members(Visitor *v, q_obj_BlockStatsSpecificQcow2_wrapper *obj, Error **errp);
+void visit_type_BlockStatsSpecificKind(Visitor *v, const char *name, BlockStatsSpecificKind *obj, Error **errp);
+
+void visit_type_BlockStatsSpecific_members(Visitor *v, BlockStatsSpecific *obj, Error **errp);
+void visit_type_BlockStatsSpecific(Visitor *v, const char *name, BlockStatsSpecific **obj, Error **errp);
+
 void visit_type_BlockStats_members(Visitor *v, BlockStats *obj, Error **errp);
 void visit_type_BlockStats(Visitor *v, const char *name, BlockStats **obj, Error **errp);
 
 void visit_type_q_obj_query_blockstats_arg_members(Visitor *v, q_obj_query_blockstats_arg *obj, Error **errp);
 void visit_type_BlockStatsList(Visitor *v, const char *name, BlockStatsList **obj, Error **errp);
+
+void visit_type_SharedCacheInfo_members(Visitor *v, SharedCacheInfo *obj, Error **errp);
+void visit_type_SharedCacheInfo(Visitor *v, const char *name, SharedCacheInfo **obj, Error **errp);
+void visit_type_SharedCacheInfoList(Visitor *v, const char *name, SharedCacheInfoList **obj, Error **errp);
 void visit_type_BlockdevOnError(Visitor *v, const char *name, BlockdevOnError *obj, Error **errp);
 void visit_type_MirrorSyncMode(Visitor *v, const char *name, MirrorSyncMode *obj, Error **errp);
 void visit_type_BlockJobType(Visitor *v, const char *name, BlockJobType *obj, Error **errp);
@@ -304,6 +320,9 @@ void visit_type_BlockdevOptionsVxHS(Visitor *v, const char *name, BlockdevOption
 void visit_type_BlockdevOptionsThrottle_members(Visitor *v, BlockdevOptionsThrottle *obj, Error **errp);
 void visit_type_BlockdevOptionsThrottle(Visitor *v, const char *name, BlockdevOptionsThrottle **obj, Error **errp);
 
+void visit_type_BlockdevOptionsSharedCache_members(Visitor *v, BlockdevOptionsSharedCache *obj, Error **errp);
+void visit_type_BlockdevOptionsSharedCache(Visitor *v, const char *name, BlockdevOptionsSharedCache **obj, Error **errp);
+
 void visit_type_q_obj_BlockdevOptions_base_members(Visitor *v, q_obj_BlockdevOptions_base *obj, Error **errp);
 
 void visit_type_BlockdevOptions_members(Visitor *v, BlockdevOptions *obj, Error **errp);
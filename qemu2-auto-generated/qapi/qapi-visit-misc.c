@@ -4636,6 +4636,19 @@ void visit_type_q_obj_x_oob_test_arg_members(Visitor *v, q_obj_x_oob_test_arg *o
         goto out;
     }
 
+out:
+    error_propagate(errp, err);
+}
+
+void visit_type_q_obj_x_tcg_profile_dump_arg_members(Visitor *v, q_obj_x_tcg_profile_dump_arg *obj, Error **errp)
+{
+    Error *err = NULL;
+
+    visit_type_str(v, "filename", &obj->filename, &err);
+    if (err) {
+        goto out;
+    }
+
 out:
     error_propagate(errp, err);
 }
@@ -328,4 +328,6 @@ void visit_type_q_obj_COMMAND_DROPPED_arg_members(Visitor *v, q_obj_COMMAND_DROP
 
 void visit_type_q_obj_x_oob_test_arg_members(Visitor *v, q_obj_x_oob_test_arg *obj, Error **errp);
 
+void visit_type_q_obj_x_tcg_profile_dump_arg_members(Visitor *v, q_obj_x_tcg_profile_dump_arg *obj, Error **errp);
+
 #endif /* QAPI_VISIT_MISC_H */
@@ -0,0 +1,39 @@
+#!/bin/sh -e
+#
+# Compare the AIO backends of the file protocol driver with qemu-img bench.
+#
+# Copyright (C) 2021 The Android Open Source Project
+#
+# This work is licensed under the terms of the GNU GPL, version 2 or later.
+# See the COPYING file in the top-level directory.
+
+qemu_img="$1"
+image="$2"
+
+if [ -z "$qemu_img" ] || [ -z "$image" ]; then
+    cat << EOF
+usage: aio-bench.sh QEMU_IMG IMAGE [BENCH_OPTIONS...]
+
+Runs 'qemu-img bench' on IMAGE once per cache mode and AIO backend
+(threads, native and io_uring), passing BENCH_OPTIONS through, e.g.
+'-d 64 -s 4k -S 1M' for a boot-like read storm or '-w' for writes.
+native only runs with cache=none, because libaio requires O_DIRECT.
+EOF
+    exit 1
+fi
+shift 2
+
+for cache in none writeback; do
+    for aio in threads native io_uring; do
+        if [ "$aio" = native ] && [ "$cache" != none ]; then
+            continue
+        fi
+        # Drop the page cache between runs if we can, so that buffered runs
+        # measure I/O and not memcpy.
+        sync
+        echo 3 2>/dev/null > /proc/sys/vm/drop_caches || true
+        printf "cache=%-9s aio=%-8s " "$cache" "$aio"
+        "$qemu_img" bench -t "$cache" -i "$aio" "$@" "$image" 2>&1 |
+            grep -e "Run completed" -e "rror" || echo "failed"
+    done
+done
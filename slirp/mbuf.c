@@ -18,14 +18,48 @@
 #include "qemu/osdep.h"
 #include "slirp.h"
 
-#define MBUF_THRESH 30
-
 /*
  * Find a nice value for msize
  */
 #define SLIRP_MSIZE\
     (offsetof(struct mbuf, m_dat) + IF_MAXLINKHDR + TCPIPHDR_DELTA + IF_MTU)
 
+/*
+ * A busy connection goes through thousands of mbufs per second, so they
+ * are allocated MBUF_ARENA_COUNT at a time from arenas which are only
+ * released by m_cleanup(), and recycled through the free list.  Past
+ * MBUF_ARENA_MAX mbufs, the extra ones are marked M_DOFREE so that a burst
+ * doesn't pin memory forever.
+ */
+#define MBUF_ARENA_COUNT 64
+#define MBUF_ARENA_MAX 1024
+#define MBUF_ARENA_STRIDE QEMU_ALIGN_UP(SLIRP_MSIZE, sizeof(uint64_t))
+
+struct mbuf_arena {
+	struct mbuf_arena *next;
+	uint64_t mbufs[];
+};
+
+static void
+m_arena_alloc(Slirp *slirp)
+{
+	struct mbuf_arena *arena;
+	struct mbuf *m;
+	int i;
+
+	arena = g_malloc(sizeof(*arena) + MBUF_ARENA_COUNT * MBUF_ARENA_STRIDE);
+	arena->next = slirp->m_arenas;
+	slirp->m_arenas = arena;
+
+	for (i = 0; i < MBUF_ARENA_COUNT; i++) {
+		m = (struct mbuf *)((char *)arena->mbufs + i * MBUF_ARENA_STRIDE);
+		m->slirp = slirp;
+		m->m_flags = M_FREELIST | M_ARENA;
+		insque(m, &slirp->m_freelist);
+	}
+	slirp->mbuf_alloced += MBUF_ARENA_COUNT;
+}
+
 void
 m_init(Slirp *slirp)
 {
@@ -43,23 +77,33 @@ void m_cleanup(Slirp *slirp)
         if (m->m_flags & M_EXT) {
             g_free(m->m_ext);
         }
-        g_free(m);
+        if (!(m->m_flags & M_ARENA)) {
+            g_free(m);
+        }
         m = next;
     }
     m = (struct mbuf *) slirp->m_freelist.qh_link;
     while ((struct quehead *) m != &slirp->m_freelist) {
         next = m->m_next;
-        g_free(m);
+        if (!(m->m_flags & M_ARENA)) {
+            g_free(m);
+        }
         m = next;
     }
+    while (slirp->m_arenas) {
+        struct mbuf_arena *arena = slirp->m_arenas;
+        slirp->m_arenas = arena->next;
+        g_free(arena);
+    }
 }
 
 /*
  * Get an mbuf from the free list, if there are none
- * allocate one
+ * allocate a new arena, or a single mbuf once there are
+ * MBUF_ARENA_MAX of them
  *
  * Because fragmentation can occur if we alloc new mbufs and
- * free old mbufs, we mark all mbufs above mbuf_thresh as M_DOFREE,
+ * free old mbufs, we mark all mbufs above MBUF_ARENA_MAX as M_DOFREE,
  * which tells m_free to actually g_free() it
  */
 struct mbuf *
@@ -70,15 +114,19 @@ m_get(Slirp *slirp)
 
 	DEBUG_CALL("m_get");
 
+	if (slirp->m_freelist.qh_link == &slirp->m_freelist &&
+	    slirp->mbuf_alloced < MBUF_ARENA_MAX) {
+		m_arena_alloc(slirp);
+	}
 	if (slirp->m_freelist.qh_link == &slirp->m_freelist) {
                 m = g_malloc(SLIRP_MSIZE);
 		slirp->mbuf_alloced++;
-		if (slirp->mbuf_alloced > MBUF_THRESH)
-			flags = M_DOFREE;
+		flags = M_DOFREE;
 		m->slirp = slirp;
 	} else {
 		m = (struct mbuf *) slirp->m_freelist.qh_link;
 		remque(m);
+		flags = m->m_flags & M_ARENA;
 	}
 
 	/* Insert it in the used list */
@@ -121,7 +169,8 @@ m_free(struct mbuf *m)
                 g_free(m);
 	} else if ((m->m_flags & M_FREELIST) == 0) {
 		insque(m,&m->slirp->m_freelist);
-		m->m_flags = M_FREELIST; /* Clobber other flags */
+		/* Clobber other flags */
+		m->m_flags = M_FREELIST | (m->m_flags & M_ARENA);
 	}
   } /* if(m) */
 }
@@ -108,6 +108,7 @@ struct mbuf {
 #define M_USEDLIST		0x04	/* XXX mbuf is on used list (for dtom()) */
 #define M_DOFREE		0x08	/* when m_free is called on the mbuf, free()
 					 * it rather than putting it on the free list */
+#define M_ARENA			0x10	/* mbuf is part of an arena, never free() it */
 
 void m_init(Slirp *);
 void m_cleanup(Slirp *slirp);
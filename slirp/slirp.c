@@ -485,6 +485,7 @@ void slirp_cleanup(Slirp *slirp)
     ip_cleanup(slirp);
     ip6_cleanup(slirp);
     m_cleanup(slirp);
+    g_free(slirp->udp_recv_overflow);
 
     g_rand_free(slirp->grand);
 
@@ -183,6 +183,7 @@ struct Slirp {
     /* mbuf states */
     struct quehead m_freelist;
     struct quehead m_usedlist;
+    struct mbuf_arena *m_arenas;
     int mbuf_alloced;
 
     /* if states */
@@ -209,6 +210,8 @@ struct Slirp {
     /* udp states */
     struct socket udb;
     struct socket *udp_last_so;
+    /* recvmmsg() buffers for datagrams larger than an mbuf */
+    char *udp_recv_overflow;
 
     /* icmp states */
     struct socket icmp;
@@ -511,6 +511,186 @@ err_disconnected:
 	return -1;
 }
 
+/*
+ * Get an mbuf for a datagram received on a UDP socket, with room
+ * for the headers in front of it
+ */
+static struct mbuf *
+sorecvfrom_mbuf(struct socket *so)
+{
+	struct mbuf *m = m_get(so->slirp);
+
+	if (!m) {
+	    return NULL;
+	}
+	switch (so->so_ffamily) {
+	case AF_INET:
+	    m->m_data += IF_MAXLINKHDR + sizeof(struct udpiphdr);
+	    break;
+	case AF_INET6:
+	    m->m_data += IF_MAXLINKHDR + sizeof(struct ip6)
+	                               + sizeof(struct udphdr);
+	    break;
+	default:
+	    g_assert_not_reached();
+	    break;
+	}
+	return m;
+}
+
+/*
+ * Report a receive error on a UDP socket as ICMP
+ */
+static void
+sorecvfrom_error(struct socket *so, int err)
+{
+	switch (so->so_lfamily) {
+	uint8_t code;
+	case AF_INET:
+	  code = ICMP_UNREACH_PORT;
+
+	  if (err == EHOSTUNREACH) {
+	    code = ICMP_UNREACH_HOST;
+	  } else if (err == ENETUNREACH) {
+	    code = ICMP_UNREACH_NET;
+	  }
+
+	  DEBUG_MISC((dfd, " rx error, tx icmp ICMP_UNREACH:%i\n", code));
+	  icmp_send_error(so->so_m, ICMP_UNREACH, code, 0, strerror(err));
+	  break;
+	case AF_INET6:
+	  code = ICMP6_UNREACH_PORT;
+
+	  if (err == EHOSTUNREACH) {
+	    code = ICMP6_UNREACH_ADDRESS;
+	  } else if (err == ENETUNREACH) {
+	    code = ICMP6_UNREACH_NO_ROUTE;
+	  }
+
+	  DEBUG_MISC((dfd, " rx error, tx icmp6 ICMP_UNREACH:%i\n", code));
+	  icmp6_send_error(so->so_m, ICMP6_UNREACH, code);
+	  break;
+	default:
+	  g_assert_not_reached();
+	  break;
+	}
+}
+
+/*
+ * Send a datagram received from addr on a UDP socket to the guest
+ */
+static void
+sorecvfrom_input(struct socket *so, struct mbuf *m,
+                 struct sockaddr_storage *addr)
+{
+	struct sockaddr_storage saddr, daddr;
+
+	/*
+	 * Hack: domain name lookup will be used the most for UDP,
+	 * and since they'll only be used once there's no need
+	 * for the 4 minute (or whatever) timeout... So we time them
+	 * out much quicker (10 seconds  for now...)
+	 */
+	if (so->so_expire) {
+	  if (so->so_fport == htons(kDnsPort))
+	    so->so_expire = curtime + SO_EXPIREFAST;
+	  else
+	    so->so_expire = curtime + SO_EXPIRE;
+	}
+
+	/*
+	 * If this packet was destined for CTL_ADDR,
+	 * make it look like that's where it came from
+	 */
+	saddr = *addr;
+	sotranslate_in(so, &saddr);
+	daddr = so->lhost.ss;
+
+	switch (so->so_ffamily) {
+	case AF_INET:
+	    udp_output(so, m, (struct sockaddr_in *) &saddr,
+	               (struct sockaddr_in *) &daddr,
+	               so->so_iptos);
+	    break;
+	case AF_INET6:
+	    udp6_output(so, m, (struct sockaddr_in6 *) &saddr,
+	                (struct sockaddr_in6 *) &daddr);
+	    break;
+	default:
+	    g_assert_not_reached();
+	    break;
+	}
+}
+
+#ifdef CONFIG_LINUX
+/*
+ * Bulk UDP traffic arrives much faster than one recvfrom() per poll can
+ * take it, so once a datagram is known to be waiting, up to SO_RECV_BATCH
+ * of them are received with a single recvmmsg().  Each one goes straight
+ * into an mbuf; the part of a datagram that doesn't fit lands in the
+ * slot's overflow buffer, and is copied after the mbuf is enlarged.
+ */
+#define SO_RECV_BATCH 8
+#define SO_RECV_OVERFLOW 65536
+
+static void
+sorecvfrom_batch(struct socket *so, struct mbuf *first)
+{
+	Slirp *slirp = so->slirp;
+	struct mbuf *m[SO_RECV_BATCH];
+	struct mmsghdr msgs[SO_RECV_BATCH];
+	struct iovec iov[SO_RECV_BATCH][2];
+	struct sockaddr_storage addr[SO_RECV_BATCH];
+	int i, n, len;
+
+	if (!slirp->udp_recv_overflow) {
+	    slirp->udp_recv_overflow = g_malloc(SO_RECV_BATCH *
+	                                        SO_RECV_OVERFLOW);
+	}
+
+	memset(msgs, 0, sizeof(msgs));
+	for (i = 0; i < SO_RECV_BATCH; i++) {
+	    m[i] = i ? sorecvfrom_mbuf(so) : first;
+	    if (!m[i]) {
+	        break;
+	    }
+	    iov[i][0].iov_base = m[i]->m_data;
+	    iov[i][0].iov_len = M_FREEROOM(m[i]);
+	    iov[i][1].iov_base = slirp->udp_recv_overflow +
+	                         i * SO_RECV_OVERFLOW;
+	    iov[i][1].iov_len = SO_RECV_OVERFLOW;
+	    msgs[i].msg_hdr.msg_name = &addr[i];
+	    msgs[i].msg_hdr.msg_namelen = sizeof(addr[i]);
+	    msgs[i].msg_hdr.msg_iov = iov[i];
+	    msgs[i].msg_hdr.msg_iovlen = 2;
+	}
+
+	n = recvmmsg(so->s, msgs, i, MSG_DONTWAIT, NULL);
+	DEBUG_MISC((dfd, " did recvmmsg %d, errno = %d-%s\n",
+		    n, errno, strerror(errno)));
+	if (n < 0) {
+	    if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+	        sorecvfrom_error(so, errno);
+	    }
+	    n = 0;
+	}
+
+	for (; i > n; i--) {
+	    m_free(m[i - 1]);
+	}
+	for (i = 0; i < n; i++) {
+	    len = msgs[i].msg_len;
+	    if (len > iov[i][0].iov_len) {
+	        m_inc(m[i], len);
+	        memcpy(m[i]->m_data + iov[i][0].iov_len, iov[i][1].iov_base,
+	               len - iov[i][0].iov_len);
+	    }
+	    m[i]->m_len = len;
+	    sorecvfrom_input(so, m[i], &addr[i]);
+	}
+}
+#endif
+
 /*
  * recvfrom() a UDP socket
  */
@@ -518,7 +698,6 @@ void
 sorecvfrom(struct socket *so)
 {
 	struct sockaddr_storage addr;
-	struct sockaddr_storage saddr, daddr;
 	socklen_t addrlen = sizeof(struct sockaddr_storage);
 
 	DEBUG_CALL("sorecvfrom");
@@ -556,22 +735,10 @@ sorecvfrom(struct socket *so)
           int n;
 #endif
 
-	  m = m_get(so->slirp);
+	  m = sorecvfrom_mbuf(so);
 	  if (!m) {
 	      return;
 	  }
-	  switch (so->so_ffamily) {
-	  case AF_INET:
-	      m->m_data += IF_MAXLINKHDR + sizeof(struct udpiphdr);
-	      break;
-	  case AF_INET6:
-	      m->m_data += IF_MAXLINKHDR + sizeof(struct ip6)
-	                                 + sizeof(struct udphdr);
-	      break;
-	  default:
-	      g_assert_not_reached();
-	      break;
-	  }
 
 	  /*
 	   * XXX Shouldn't FIONREAD packets destined for port 53,
@@ -586,6 +753,13 @@ sorecvfrom(struct socket *so)
 	    m_inc(m, n);
 	    len = M_FREEROOM(m);
 	  }
+#ifdef CONFIG_LINUX
+	  else if (n > 0) {
+	    /* FIONREAD gave the size of the next datagram, which fits */
+	    sorecvfrom_batch(so, m);
+	    return;
+	  }
+#endif
 	  /* } */
 
 	  m->m_len = recvfrom(so->s, m->m_data, len, 0,
@@ -594,73 +768,10 @@ sorecvfrom(struct socket *so)
 		      m->m_len, errno,strerror(errno)));
 	  if(m->m_len<0) {
 	    /* Report error as ICMP */
-	    switch (so->so_lfamily) {
-	    uint8_t code;
-	    case AF_INET:
-	      code = ICMP_UNREACH_PORT;
-
-	      if (errno == EHOSTUNREACH) {
-		code = ICMP_UNREACH_HOST;
-	      } else if (errno == ENETUNREACH) {
-		code = ICMP_UNREACH_NET;
-	      }
-
-	      DEBUG_MISC((dfd, " rx error, tx icmp ICMP_UNREACH:%i\n", code));
-	      icmp_send_error(so->so_m, ICMP_UNREACH, code, 0, strerror(errno));
-	      break;
-	    case AF_INET6:
-	      code = ICMP6_UNREACH_PORT;
-
-	      if (errno == EHOSTUNREACH) {
-		code = ICMP6_UNREACH_ADDRESS;
-	      } else if (errno == ENETUNREACH) {
-		code = ICMP6_UNREACH_NO_ROUTE;
-	      }
-
-	      DEBUG_MISC((dfd, " rx error, tx icmp6 ICMP_UNREACH:%i\n", code));
-	      icmp6_send_error(so->so_m, ICMP6_UNREACH, code);
-	      break;
-	    default:
-	      g_assert_not_reached();
-	      break;
-	    }
+	    sorecvfrom_error(so, errno);
 	    m_free(m);
 	  } else {
-	  /*
-	   * Hack: domain name lookup will be used the most for UDP,
-	   * and since they'll only be used once there's no need
-	   * for the 4 minute (or whatever) timeout... So we time them
-	   * out much quicker (10 seconds  for now...)
-	   */
-	    if (so->so_expire) {
-	      if (so->so_fport == htons(kDnsPort))
-		so->so_expire = curtime + SO_EXPIREFAST;
-	      else
-		so->so_expire = curtime + SO_EXPIRE;
-	    }
-
-	    /*
-	     * If this packet was destined for CTL_ADDR,
-	     * make it look like that's where it came from
-	     */
-	    saddr = addr;
-	    sotranslate_in(so, &saddr);
-	    daddr = so->lhost.ss;
-
-	    switch (so->so_ffamily) {
-	    case AF_INET:
-	        udp_output(so, m, (struct sockaddr_in *) &saddr,
-	                   (struct sockaddr_in *) &daddr,
-	                   so->so_iptos);
-	        break;
-	    case AF_INET6:
-	        udp6_output(so, m, (struct sockaddr_in6 *) &saddr,
-	                    (struct sockaddr_in6 *) &daddr);
-	        break;
-	    default:
-	        g_assert_not_reached();
-	        break;
-	    }
+	    sorecvfrom_input(so, m, &addr);
 	  } /* rx error */
 	} /* if ping packet */
 }
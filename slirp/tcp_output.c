@@ -282,6 +282,26 @@ send:
 			mss = htons((uint16_t) tcp_mss(tp, 0));
 			memcpy((caddr_t)(opt + 2), (caddr_t)&mss, sizeof(mss));
 			optlen = 4;
+
+			/*
+			 * Ask for a window scale that lets us advertise the
+			 * whole receive buffer.  On a SYN,ACK only if the
+			 * other side asked for scaling too.
+			 */
+			tp->request_r_scale = 0;
+			while (tp->request_r_scale < TCP_MAX_WINSHIFT &&
+			       ((uint32_t)TCP_MAXWIN << tp->request_r_scale) <
+			       so->so_rcv.sb_datalen)
+				tp->request_r_scale++;
+			if ((tp->t_flags & TF_REQ_SCALE) &&
+			    ((flags & TH_ACK) == 0 ||
+			     (tp->t_flags & TF_RCVD_SCALE))) {
+				opt[optlen] = TCPOPT_NOP;
+				opt[optlen + 1] = TCPOPT_WINDOW;
+				opt[optlen + 2] = TCPOLEN_WINDOW;
+				opt[optlen + 3] = tp->request_r_scale;
+				optlen += 4;
+			}
 		}
  	}
 
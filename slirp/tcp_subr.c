@@ -42,10 +42,6 @@
 #include "slirp.h"
 #include "proxy.h"
 
-/* patchable/settable parameters for tcp */
-/* Don't do rfc1323 performance enhancements */
-#define TCP_DO_RFC1323 0
-
 /*
  * Tcp initialization
  */
@@ -265,7 +261,8 @@ tcp_newtcpcb(struct socket *so)
 	tp->seg_next = tp->seg_prev = (struct tcpiphdr*)tp;
 	tp->t_maxseg = (so->so_ffamily == AF_INET) ? TCP_MSS : TCP6_MSS;
 
-	tp->t_flags = TCP_DO_RFC1323 ? (TF_REQ_SCALE|TF_REQ_TSTMP) : 0;
+	/* Of the rfc1323 options, only window scaling is supported */
+	tp->t_flags = TF_REQ_SCALE;
 	tp->t_socket = so;
 
 	/*
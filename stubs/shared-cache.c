@@ -0,0 +1,8 @@
+#include "qemu/osdep.h"
+#include "qapi/error.h"
+#include "qapi/qapi-commands-block-core.h"
+
+SharedCacheInfoList *qmp_query_shared_cache(Error **errp)
+{
+    return NULL;
+}
@@ -40,6 +40,7 @@
 #include "cpu-qom.h"
 #include "exec/cpu-defs.h"
 #include "xtensa-isa.h"
+#include "xtensa-decode.h"
 
 #define NB_MMU_MODES 4
 
@@ -405,6 +406,7 @@ struct XtensaConfig {
     void *isa_internal;
     xtensa_isa isa;
     XtensaOpcodeOps **opcode_ops;
+    XtensaDecodeCache *decode_cache;
     const XtensaOpcodeTranslators **opcode_translators;
 
     uint32_t clock_freq_khz;
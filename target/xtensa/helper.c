@@ -61,6 +61,7 @@ static void init_libisa(XtensaConfig *config)
     assert(xtensa_isa_maxlength(config->isa) <= MAX_INSN_LENGTH);
     opcodes = xtensa_isa_num_opcodes(config->isa);
     config->opcode_ops = g_new(XtensaOpcodeOps *, opcodes);
+    config->decode_cache = xtensa_decode_cache_new(config->isa);
 
     for (i = 0; i < opcodes; ++i) {
         const char *opc_name = xtensa_opcode_name(config->isa, i);
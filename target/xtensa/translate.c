@@ -75,9 +75,7 @@ struct DisasContext {
 
     unsigned cpenable;
 
-    uint32_t *raw_arg;
-    xtensa_insnbuf insnbuf;
-    xtensa_insnbuf slotbuf;
+    const uint32_t *raw_arg;
 };
 
 static TCGv_i32 cpu_pc;
@@ -952,14 +950,16 @@ static inline unsigned xtensa_op0_insn_len(DisasContext *dc, uint8_t op0)
     return xtensa_isa_length_from_chars(dc->config->isa, &op0);
 }
 
+QEMU_BUILD_BUG_ON(MAX_OPCODE_ARGS > XTENSA_DECODE_MAX_ARGS);
+
 static void disas_xtensa_insn(CPUXtensaState *env, DisasContext *dc)
 {
     xtensa_isa isa = dc->config->isa;
     unsigned char b[MAX_INSN_LENGTH] = {cpu_ldub_code(env, dc->pc)};
     unsigned len = xtensa_op0_insn_len(dc, b[0]);
-    xtensa_format fmt;
-    int slot, slots;
-    unsigned i;
+    const XtensaDecodedInsn *insn;
+    unsigned slot, i;
+    int bad_slot;
 
     if (len == XTENSA_UNDEFINED) {
         qemu_log_mask(LOG_GUEST_ERROR,
@@ -973,58 +973,47 @@ static void disas_xtensa_insn(CPUXtensaState *env, DisasContext *dc)
     for (i = 1; i < len; ++i) {
         b[i] = cpu_ldub_code(env, dc->pc + i);
     }
-    xtensa_insnbuf_from_chars(isa, dc->insnbuf, b, len);
-    fmt = xtensa_format_decode(isa, dc->insnbuf);
-    if (fmt == XTENSA_UNDEFINED) {
+    insn = xtensa_decode_cache_lookup(dc->config->decode_cache, b, len,
+                                      &bad_slot);
+    if (!insn && bad_slot < 0) {
         qemu_log_mask(LOG_GUEST_ERROR,
                       "unrecognized instruction format (pc = %08x)\n",
                       dc->pc);
         gen_exception_cause(dc, ILLEGAL_INSTRUCTION_CAUSE);
         return;
     }
-    slots = xtensa_format_num_slots(isa, fmt);
-    for (slot = 0; slot < slots; ++slot) {
-        xtensa_opcode opc;
-        int opnd, vopnd, opnds;
-        uint32_t raw_arg[MAX_OPCODE_ARGS];
-        uint32_t arg[MAX_OPCODE_ARGS];
+    if (!insn) {
+        qemu_log_mask(LOG_GUEST_ERROR,
+                      "unrecognized opcode in slot %d (pc = %08x)\n",
+                      bad_slot, dc->pc);
+        gen_exception_cause(dc, ILLEGAL_INSTRUCTION_CAUSE);
+        return;
+    }
+    for (slot = 0; slot < insn->nb_slots; ++slot) {
+        const XtensaDecodedSlot *s = &insn->slot[slot];
+        const uint32_t *arg = s->arg;
+        uint32_t reloc_arg[MAX_OPCODE_ARGS];
         XtensaOpcodeOps *ops;
 
-        dc->raw_arg = raw_arg;
+        dc->raw_arg = s->arg;
 
-        xtensa_format_get_slot(isa, fmt, slot, dc->insnbuf, dc->slotbuf);
-        opc = xtensa_opcode_decode(isa, fmt, slot, dc->slotbuf);
-        if (opc == XTENSA_UNDEFINED) {
-            qemu_log_mask(LOG_GUEST_ERROR,
-                          "unrecognized opcode in slot %d (pc = %08x)\n",
-                          slot, dc->pc);
-            gen_exception_cause(dc, ILLEGAL_INSTRUCTION_CAUSE);
-            return;
-        }
-        opnds = xtensa_opcode_num_operands(isa, opc);
-
-        for (opnd = vopnd = 0; opnd < opnds; ++opnd) {
-            if (xtensa_operand_is_visible(isa, opc, opnd)) {
-                uint32_t v;
-
-                xtensa_operand_get_field(isa, opc, opnd, fmt, slot,
-                                         dc->slotbuf, &v);
-                xtensa_operand_decode(isa, opc, opnd, &v);
-                raw_arg[vopnd] = v;
-                if (xtensa_operand_is_PCrelative(isa, opc, opnd)) {
-                    xtensa_operand_undo_reloc(isa, opc, opnd, &v, dc->pc);
+        if (s->pcrel) {
+            for (i = 0; i < s->nb_args; ++i) {
+                reloc_arg[i] = s->arg[i];
+                if (s->pcrel & (1u << i)) {
+                    xtensa_operand_undo_reloc(isa, s->opc, s->opnd[i],
+                                              &reloc_arg[i], dc->pc);
                 }
-                arg[vopnd] = v;
-                ++vopnd;
             }
+            arg = reloc_arg;
         }
-        ops = dc->config->opcode_ops[opc];
+        ops = dc->config->opcode_ops[s->opc];
         if (ops) {
             ops->translate(dc, arg, ops->par);
         } else {
             qemu_log_mask(LOG_GUEST_ERROR,
-                          "unimplemented opcode '%s' in slot %d (pc = %08x)\n",
-                          xtensa_opcode_name(isa, opc), slot, dc->pc);
+                          "unimplemented opcode '%s' in slot %u (pc = %08x)\n",
+                          xtensa_opcode_name(isa, s->opc), slot, dc->pc);
             gen_exception_cause(dc, ILLEGAL_INSTRUCTION_CAUSE);
             return;
         }
@@ -1087,11 +1076,6 @@ void gen_intermediate_code(CPUState *cs, TranslationBlock *tb)
     dc.window = ((tb->flags & XTENSA_TBFLAG_WINDOW_MASK) >>
                  XTENSA_TBFLAG_WINDOW_SHIFT);
 
-    if (dc.config->isa) {
-        dc.insnbuf = xtensa_insnbuf_alloc(dc.config->isa);
-        dc.slotbuf = xtensa_insnbuf_alloc(dc.config->isa);
-    }
-
     init_sar_tracker(&dc);
     if (dc.icount) {
         dc.next_icount = tcg_temp_local_new_i32();
@@ -1170,10 +1154,6 @@ done:
     if (dc.icount) {
         tcg_temp_free(dc.next_icount);
     }
-    if (dc.config->isa) {
-        xtensa_insnbuf_free(dc.config->isa, dc.insnbuf);
-        xtensa_insnbuf_free(dc.config->isa, dc.slotbuf);
-    }
 
     if (tb_cflags(tb) & CF_LAST_IO) {
         gen_io_end();
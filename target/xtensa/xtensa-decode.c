@@ -0,0 +1,181 @@
+/*
+ * Cached Xtensa instruction decoder
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+
+#include "qemu/osdep.h"
+#include "xtensa-decode.h"
+
+/*
+ * Decoding an instruction with the ISA tables means a chain of indirect
+ * calls per slot and per operand, so doing it for every instruction of every
+ * TB costs more than generating the TCG ops for it.  Firmware keeps reusing
+ * the same instructions, so the decoded form is kept in a two-way set
+ * associative table indexed by a hash of the raw bytes, with the most
+ * recently used entry of each set first.  Instructions of up to 7 bytes,
+ * which covers every core without FLIX bundles, are packed together with
+ * their length into a 64-bit key; longer ones are decoded every time.
+ */
+
+#define XTENSA_DECODE_CACHE_BITS 13
+#define XTENSA_DECODE_CACHE_WAYS 2
+#define XTENSA_DECODE_CACHE_SIZE \
+    ((1 << XTENSA_DECODE_CACHE_BITS) * XTENSA_DECODE_CACHE_WAYS)
+#define XTENSA_DECODE_MAX_KEY_LEN 7
+
+typedef struct XtensaDecodeEntry {
+    uint64_t key;
+    XtensaDecodedInsn *insn;
+} XtensaDecodeEntry;
+
+struct XtensaDecodeCache {
+    xtensa_isa isa;
+    xtensa_insnbuf insnbuf;
+    xtensa_insnbuf slotbuf;
+    /* Allocated on first use, most cores are never run */
+    XtensaDecodeEntry *entries;
+    /* Last instruction that was too long to be cached */
+    XtensaDecodedInsn *uncached;
+};
+
+static XtensaDecodedInsn *xtensa_decode_insn(XtensaDecodeCache *cache,
+                                             const unsigned char *b,
+                                             unsigned len, int *bad_slot)
+{
+    xtensa_isa isa = cache->isa;
+    XtensaDecodedInsn *insn;
+    xtensa_format fmt;
+    int slot, slots;
+
+    xtensa_insnbuf_from_chars(isa, cache->insnbuf, b, len);
+    fmt = xtensa_format_decode(isa, cache->insnbuf);
+    if (fmt == XTENSA_UNDEFINED) {
+        *bad_slot = -1;
+        return NULL;
+    }
+
+    slots = xtensa_format_num_slots(isa, fmt);
+    insn = g_malloc(sizeof(*insn) + slots * sizeof(insn->slot[0]));
+    insn->fmt = fmt;
+    insn->len = len;
+    insn->nb_slots = slots;
+
+    for (slot = 0; slot < slots; ++slot) {
+        XtensaDecodedSlot *s = &insn->slot[slot];
+        int opnd, opnds;
+
+        xtensa_format_get_slot(isa, fmt, slot, cache->insnbuf, cache->slotbuf);
+        s->opc = xtensa_opcode_decode(isa, fmt, slot, cache->slotbuf);
+        if (s->opc == XTENSA_UNDEFINED) {
+            g_free(insn);
+            *bad_slot = slot;
+            return NULL;
+        }
+
+        s->nb_args = 0;
+        s->pcrel = 0;
+        opnds = xtensa_opcode_num_operands(isa, s->opc);
+        assert(opnds <= XTENSA_DECODE_MAX_ARGS);
+        for (opnd = 0; opnd < opnds; ++opnd) {
+            uint32_t v;
+
+            if (!xtensa_operand_is_visible(isa, s->opc, opnd)) {
+                continue;
+            }
+            xtensa_operand_get_field(isa, s->opc, opnd, fmt, slot,
+                                     cache->slotbuf, &v);
+            xtensa_operand_decode(isa, s->opc, opnd, &v);
+            if (xtensa_operand_is_PCrelative(isa, s->opc, opnd)) {
+                s->pcrel |= 1u << s->nb_args;
+            }
+            s->opnd[s->nb_args] = opnd;
+            s->arg[s->nb_args] = v;
+            s->nb_args++;
+        }
+    }
+    return insn;
+}
+
+XtensaDecodeCache *xtensa_decode_cache_new(xtensa_isa isa)
+{
+    XtensaDecodeCache *cache = g_new0(XtensaDecodeCache, 1);
+
+    cache->isa = isa;
+    cache->insnbuf = xtensa_insnbuf_alloc(isa);
+    cache->slotbuf = xtensa_insnbuf_alloc(isa);
+    return cache;
+}
+
+void xtensa_decode_cache_free(XtensaDecodeCache *cache)
+{
+    unsigned i;
+
+    if (!cache) {
+        return;
+    }
+    if (cache->entries) {
+        for (i = 0; i < XTENSA_DECODE_CACHE_SIZE; ++i) {
+            g_free(cache->entries[i].insn);
+        }
+        g_free(cache->entries);
+    }
+    g_free(cache->uncached);
+    xtensa_insnbuf_free(cache->isa, cache->insnbuf);
+    xtensa_insnbuf_free(cache->isa, cache->slotbuf);
+    g_free(cache);
+}
+
+const XtensaDecodedInsn *xtensa_decode_cache_lookup(XtensaDecodeCache *cache,
+                                                    const unsigned char *b,
+                                                    unsigned len,
+                                                    int *bad_slot)
+{
+    XtensaDecodedInsn *insn;
+    XtensaDecodeEntry *e, tmp;
+    uint64_t key;
+    unsigned i;
+
+    if (len > XTENSA_DECODE_MAX_KEY_LEN) {
+        insn = xtensa_decode_insn(cache, b, len, bad_slot);
+        if (insn) {
+            g_free(cache->uncached);
+            cache->uncached = insn;
+        }
+        return insn;
+    }
+
+    /* The length byte keeps the key of a valid entry non-zero */
+    key = (uint64_t)len << 56;
+    for (i = 0; i < len; ++i) {
+        key |= (uint64_t)b[i] << (i * 8);
+    }
+
+    if (!cache->entries) {
+        cache->entries = g_new0(XtensaDecodeEntry, XTENSA_DECODE_CACHE_SIZE);
+    }
+    e = &cache->entries[((key * 0x9e3779b97f4a7c15ull) >>
+                         (64 - XTENSA_DECODE_CACHE_BITS)) *
+                        XTENSA_DECODE_CACHE_WAYS];
+    if (likely(e[0].key == key)) {
+        return e[0].insn;
+    }
+    if (e[1].key == key) {
+        tmp = e[1];
+        e[1] = e[0];
+        e[0] = tmp;
+        return e[0].insn;
+    }
+
+    insn = xtensa_decode_insn(cache, b, len, bad_slot);
+    if (insn) {
+        g_free(e[1].insn);
+        e[1] = e[0];
+        e[0] = (XtensaDecodeEntry) { .key = key, .insn = insn };
+    }
+    return insn;
+}
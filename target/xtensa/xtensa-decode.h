@@ -0,0 +1,63 @@
+/*
+ * Cached Xtensa instruction decoder
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+
+#ifndef XTENSA_DECODE_H
+#define XTENSA_DECODE_H
+
+#include "xtensa-isa.h"
+
+#define XTENSA_DECODE_MAX_ARGS 16
+
+typedef struct XtensaDecodedSlot {
+    xtensa_opcode opc;
+    unsigned nb_args;
+    /* Bit n is set if argument n must be relocated against the PC */
+    uint32_t pcrel;
+    /* Operand index of each visible argument, for xtensa_operand_undo_reloc */
+    uint8_t opnd[XTENSA_DECODE_MAX_ARGS];
+    /* Decoded values of the visible operands, before relocation */
+    uint32_t arg[XTENSA_DECODE_MAX_ARGS];
+} XtensaDecodedSlot;
+
+typedef struct XtensaDecodedInsn {
+    xtensa_format fmt;
+    unsigned len;
+    unsigned nb_slots;
+    XtensaDecodedSlot slot[];
+} XtensaDecodedInsn;
+
+typedef struct XtensaDecodeCache XtensaDecodeCache;
+
+XtensaDecodeCache *xtensa_decode_cache_new(xtensa_isa isa);
+void xtensa_decode_cache_free(XtensaDecodeCache *cache);
+
+/**
+ * xtensa_decode_cache_lookup: decode an instruction
+ *
+ * Decodes the @len bytes at @b with the ISA tables the first time they are
+ * seen, and returns the cached result afterwards.  The result stays valid
+ * until the next lookup.  The cache is not thread-safe; the translator
+ * calls it with tb_lock held.
+ *
+ * Returns NULL if the instruction cannot be decoded.  *@bad_slot is then
+ * set to the slot with an unknown opcode, or to -1 if the format is
+ * unknown.
+ *
+ * @cache: the decode cache of the core
+ * @b: the instruction bytes
+ * @len: the instruction length, as given by the length decoder
+ * @bad_slot: the slot that could not be decoded
+ */
+const XtensaDecodedInsn *xtensa_decode_cache_lookup(XtensaDecodeCache *cache,
+                                                    const unsigned char *b,
+                                                    unsigned len,
+                                                    int *bad_slot);
+
+#endif
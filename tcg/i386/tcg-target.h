@@ -228,4 +228,9 @@ static inline void tb_target_set_jmp_target(uintptr_t tc_ptr,
 #endif
 #define TCG_TARGET_NEED_POOL_LABELS
 
+/* Code can be relocated for the persistent TB cache.  */
+#if TCG_TARGET_REG_BITS == 64 && defined(CONFIG_SOFTMMU)
+#define TCG_TARGET_HOST_RELOCS
+#endif
+
 #endif
@@ -673,6 +673,10 @@ static void tcg_out_sib_offset(TCGContext *s, int r, int rm, int index,
                the 32-bit-mode absolute addressing encoding.  */
             intptr_t pc = (intptr_t)s->code_ptr + 5 + ~rm;
             intptr_t disp = offset - pc;
+
+            /* Not worth relocating for the persistent TB cache.  */
+            s->host_relocs_ok = false;
+
             if (disp == (int32_t)disp) {
                 tcg_out8(s, (LOWREGMASK(r) << 3) | 5);
                 tcg_out32(s, disp);
@@ -947,9 +951,10 @@ static void tcg_out_movi(TCGContext *s, TCGType type,
         return;
     }
 
-    /* Try a 7 byte pc-relative lea before the 10 byte movq.  */
+    /* Try a 7 byte pc-relative lea before the 10 byte movq.  The constant
+       would change if the persistent TB cache moved the code.  */
     diff = arg - ((uintptr_t)s->code_ptr + 7);
-    if (diff == (int32_t)diff) {
+    if (diff == (int32_t)diff && !s->host_relocs_enabled) {
         tcg_out_opc(s, OPC_LEA | P_REXW, ret, 0, 0);
         tcg_out8(s, (LOWREGMASK(ret) << 3) | 5);
         tcg_out32(s, diff);
@@ -1513,6 +1518,18 @@ static void tcg_out_clz(TCGContext *s, int rexw, TCGReg dest, TCGReg arg1,
     }
 }
 
+/* Load a host address that the persistent TB cache may need to relocate.  */
+static void tcg_out_movi_host(TCGContext *s, TCGReg ret, uintptr_t arg)
+{
+    if (TCG_TARGET_REG_BITS == 64 && s->host_relocs_enabled) {
+        tcg_out_opc(s, OPC_MOVL_Iv + P_REXW + LOWREGMASK(ret), 0, ret, 0);
+        tcg_out64(s, arg);
+        tcg_note_host_addr(s, TCG_HOST_RELOC_ABS64, s->code_ptr - 8, arg);
+    } else {
+        tcg_out_movi(s, TCG_TYPE_PTR, ret, arg);
+    }
+}
+
 static void tcg_out_branch(TCGContext *s, int call, tcg_insn_unit *dest)
 {
     intptr_t disp = tcg_pcrel_diff(s, dest) - 5;
@@ -1520,6 +1537,13 @@ static void tcg_out_branch(TCGContext *s, int call, tcg_insn_unit *dest)
     if (disp == (int32_t)disp) {
         tcg_out_opc(s, call ? OPC_CALL_Jz : OPC_JMP_long, 0, 0, 0);
         tcg_out32(s, disp);
+        tcg_note_host_addr(s, TCG_HOST_RELOC_PC32, s->code_ptr - 4,
+                           (uintptr_t)dest);
+    } else if (s->host_relocs_enabled) {
+        /* The constant pool is not relocated, load the address inline.  */
+        tcg_out_movi_host(s, TCG_REG_R10, (uintptr_t)dest);
+        tcg_out_modrm(s, OPC_GRP5, call ? EXT5_CALLN_Ev : EXT5_JMPN_Ev,
+                      TCG_REG_R10);
     } else {
         /* rip-relative addressing into the constant pool.
            This is 6 + 8 = 14 bytes, as compared to using an
@@ -1586,6 +1610,56 @@ static void * const qemu_st_helpers[16] = {
     [MO_BEQ]  = helper_be_stq_mmu,
 };
 
+#ifdef TCG_TARGET_HOST_RELOCS
+/* Host addresses that the backend puts in the code, for the persistent TB
+   cache: tb_ret_addr, then the load helpers, then the store helpers.  */
+#define TCG_TARGET_NB_HOST_SYMS (1 + 2 * ARRAY_SIZE(qemu_ld_helpers))
+
+static uintptr_t tcg_target_host_sym_addr(unsigned index)
+{
+    const unsigned n = ARRAY_SIZE(qemu_ld_helpers);
+
+    if (index == 0) {
+        return (uintptr_t)tb_ret_addr;
+    } else if (index <= n) {
+        return (uintptr_t)qemu_ld_helpers[index - 1];
+    } else if (index <= 2 * n) {
+        return (uintptr_t)qemu_st_helpers[index - 1 - n];
+    }
+    return 0;
+}
+
+static bool tcg_target_host_sym(uintptr_t addr, uint16_t *index)
+{
+    unsigned i;
+
+    for (i = 0; i < TCG_TARGET_NB_HOST_SYMS; i++) {
+        if (addr == tcg_target_host_sym_addr(i)) {
+            *index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void tcg_target_host_fingerprint(GChecksum *checksum)
+{
+    const bool features[] = {
+        have_cmov, have_bmi1, have_bmi2, have_popcnt, have_lzcnt,
+        have_movbe, have_avx1, have_avx2,
+    };
+    unsigned i;
+
+    g_checksum_update(checksum, (const guchar *)features, sizeof(features));
+    for (i = 1; i < TCG_TARGET_NB_HOST_SYMS; i++) {
+        uintptr_t addr = tcg_target_host_sym_addr(i);
+        uint64_t ofs = addr ? addr - (uintptr_t)tcg_gen_code : 0;
+
+        g_checksum_update(checksum, (const guchar *)&ofs, sizeof(ofs));
+    }
+}
+#endif
+
 /* Perform the TLB load and compare.
 
    Inputs:
@@ -1754,8 +1828,8 @@ static void tcg_out_qemu_ld_slow_path(TCGContext *s, TCGLabelQemuLdst *l)
         tcg_out_mov(s, TCG_TYPE_PTR, tcg_target_call_iarg_regs[0], TCG_AREG0);
         /* The second argument is already loaded with addrlo.  */
         tcg_out_movi(s, TCG_TYPE_I32, tcg_target_call_iarg_regs[2], oi);
-        tcg_out_movi(s, TCG_TYPE_PTR, tcg_target_call_iarg_regs[3],
-                     (uintptr_t)l->raddr);
+        tcg_out_movi_host(s, tcg_target_call_iarg_regs[3],
+                          (uintptr_t)l->raddr);
     }
 
     tcg_out_call(s, qemu_ld_helpers[opc & (MO_BSWAP | MO_SIZE)]);
@@ -1853,10 +1927,10 @@ static void tcg_out_qemu_st_slow_path(TCGContext *s, TCGLabelQemuLdst *l)
 
         if (ARRAY_SIZE(tcg_target_call_iarg_regs) > 4) {
             retaddr = tcg_target_call_iarg_regs[4];
-            tcg_out_movi(s, TCG_TYPE_PTR, retaddr, (uintptr_t)l->raddr);
+            tcg_out_movi_host(s, retaddr, (uintptr_t)l->raddr);
         } else {
             retaddr = TCG_REG_RAX;
-            tcg_out_movi(s, TCG_TYPE_PTR, retaddr, (uintptr_t)l->raddr);
+            tcg_out_movi_host(s, retaddr, (uintptr_t)l->raddr);
             tcg_out_st(s, TCG_TYPE_PTR, retaddr, TCG_REG_ESP,
                        TCG_TARGET_CALL_STACK_OFFSET);
         }
@@ -2222,7 +2296,7 @@ static inline void tcg_out_op(TCGContext *s, TCGOpcode opc,
         if (a0 == 0) {
             tcg_out_jmp(s, s->code_gen_epilogue);
         } else {
-            tcg_out_movi(s, TCG_TYPE_PTR, TCG_REG_EAX, a0);
+            tcg_out_movi_host(s, TCG_REG_EAX, a0);
             tcg_out_jmp(s, tb_ret_addr);
         }
         break;
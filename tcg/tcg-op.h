@@ -805,6 +805,14 @@ void tcg_gen_goto_tb(unsigned idx);
  */
 void tcg_gen_lookup_and_goto_ptr(void);
 
+/**
+ * tcg_gen_count() - increment a 64-bit counter in host memory
+ * @counter: Host address of the counter
+ *
+ * The increment is not atomic.  Used by the TCG profile.
+ */
+void tcg_gen_count(uint64_t *counter);
+
 #if TARGET_LONG_BITS == 32
 #define tcg_temp_new() tcg_temp_new_i32()
 #define tcg_global_reg_new tcg_global_reg_new_i32
@@ -128,6 +128,9 @@ static int tcg_target_const_match(tcg_target_long val, TCGType type,
 #ifdef TCG_TARGET_NEED_LDST_LABELS
 static bool tcg_out_ldst_finalize(TCGContext *s);
 #endif
+static void tcg_note_host_addr(TCGContext *s, TCGHostRelocType type,
+                               tcg_insn_unit *place, uintptr_t addr)
+    __attribute__((unused));
 
 #define TCG_HIGHWATER 1024
 
@@ -667,6 +670,9 @@ static const TCGHelperInfo all_helpers[] = {
 };
 static GHashTable *helper_table;
 
+/* Helper calls made by profiled TBs, in the order of all_helpers */
+static uint64_t helper_calls[ARRAY_SIZE(all_helpers)];
+
 static int indirect_reg_alloc_order[ARRAY_SIZE(tcg_target_reg_alloc_order)];
 static void process_op_defs(TCGContext *s);
 static TCGTemp *tcg_global_reg_new_internal(TCGContext *s, TCGType type,
@@ -869,6 +875,9 @@ void tcg_func_start(TCGContext *s)
     s->nb_labels = 0;
     s->current_frame_offset = s->frame_start;
 
+    s->host_relocs_ok = true;
+    s->nb_host_relocs = 0;
+
 #ifdef CONFIG_DEBUG_TCG
     s->goto_tb_issue_mask = 0;
 #endif
@@ -1438,6 +1447,10 @@ void tcg_gen_callN(void *func, TCGTemp *ret, int nargs, TCGTemp **args)
     flags = info->flags;
     sizemask = info->sizemask;
 
+    if (tcg_ctx->tb_exec_count) {
+        tcg_gen_count(&helper_calls[info - all_helpers]);
+    }
+
 #if defined(__sparc__) && !defined(__arch64__) \
     && !defined(CONFIG_TCG_INTERPRETER)
     /* We have 64-bit values in one register, but need to pass as two
@@ -1596,6 +1609,20 @@ void tcg_gen_callN(void *func, TCGTemp *ret, int nargs, TCGTemp **args)
 #endif /* TCG_TARGET_EXTEND_ARGS */
 }
 
+const char *tcg_helper_calls(int i, uint64_t *calls)
+{
+    if (i >= ARRAY_SIZE(all_helpers)) {
+        return NULL;
+    }
+    *calls = helper_calls[i];
+    return all_helpers[i].name;
+}
+
+void tcg_helper_calls_reset(void)
+{
+    memset(helper_calls, 0, sizeof(helper_calls));
+}
+
 static void tcg_reg_alloc_start(TCGContext *s)
 {
     int i, n;
@@ -3239,6 +3266,8 @@ int tcg_gen_code(TCGContext *s, TranslationBlock *tb)
     int i, num_insns;
     TCGOp *op;
 
+    s->host_relocs_tb = tb;
+
 #ifdef CONFIG_PROFILER
     {
         int n;
@@ -3415,6 +3444,168 @@ int tcg_gen_code(TCGContext *s, TranslationBlock *tb)
     return tcg_current_code_size(s);
 }
 
+#ifdef TCG_TARGET_HOST_RELOCS
+/* Called by the backend for each host address that it puts in the code of
+   the TB while host_relocs_enabled.  Addresses within the code itself only
+   need a relocation if they are absolute.  */
+static void tcg_note_host_addr(TCGContext *s, TCGHostRelocType type,
+                               tcg_insn_unit *place, uintptr_t addr)
+{
+    uintptr_t tb = (uintptr_t)s->host_relocs_tb;
+    uintptr_t code = (uintptr_t)s->code_buf;
+    uintptr_t code_end = (uintptr_t)s->code_gen_highwater + TCG_HIGHWATER;
+    TCGHelperInfo *info;
+    TCGHostReloc r = {
+        .offset = tcg_ptr_byte_diff(place, s->code_buf),
+        .type = type,
+    };
+
+    if (!s->host_relocs_enabled || !s->host_relocs_ok) {
+        return;
+    }
+
+    if (addr - tb < sizeof(TranslationBlock)) {
+        r.sym = TCG_HOST_SYM_TB;
+        r.addend = addr - tb;
+    } else if (addr >= code && addr < code_end) {
+        if (type == TCG_HOST_RELOC_PC32) {
+            return;
+        }
+        r.sym = TCG_HOST_SYM_CODE;
+        r.addend = addr - code;
+    } else if (addr == (uintptr_t)s->code_gen_epilogue) {
+        r.sym = TCG_HOST_SYM_EPILOGUE;
+    } else if ((info = g_hash_table_lookup(helper_table, (gpointer)addr))) {
+        r.sym = TCG_HOST_SYM_HELPER;
+        r.index = info - all_helpers;
+    } else if (tcg_target_host_sym(addr, &r.index)) {
+        r.sym = TCG_HOST_SYM_TARGET;
+    } else {
+        s->host_relocs_ok = false;
+        return;
+    }
+
+    if (s->nb_host_relocs == TCG_MAX_HOST_RELOCS) {
+        s->host_relocs_ok = false;
+        return;
+    }
+    s->host_relocs[s->nb_host_relocs++] = r;
+}
+
+bool tcg_host_relocs_supported(void)
+{
+    return true;
+}
+
+/* Feeds @checksum with what the saved code depends on, besides the guest.
+   The offsets of the helpers from the code generator change with almost
+   any change to the binary.  */
+void tcg_host_fingerprint(GChecksum *checksum)
+{
+    size_t i;
+
+    for (i = 0; i < ARRAY_SIZE(all_helpers); i++) {
+        uint64_t ofs = (uintptr_t)all_helpers[i].func - (uintptr_t)tcg_gen_code;
+
+        g_checksum_update(checksum, (const guchar *)&ofs, sizeof(ofs));
+    }
+    tcg_target_host_fingerprint(checksum);
+}
+
+/* Applies @relocs to @code, the code of @tb copied from elsewhere.  Returns
+   false if an address cannot be reached from the new location.  */
+bool tcg_relocate_host_code(void *code, size_t code_size,
+                            TranslationBlock *tb,
+                            const TCGHostReloc *relocs, int nb_relocs)
+{
+    int i;
+
+    for (i = 0; i < nb_relocs; i++) {
+        const TCGHostReloc *r = &relocs[i];
+        tcg_insn_unit *place = code + r->offset;
+        uintptr_t addr;
+        intptr_t disp;
+
+        switch (r->sym) {
+        case TCG_HOST_SYM_TB:
+            if (r->addend < 0 || r->addend >= sizeof(TranslationBlock)) {
+                return false;
+            }
+            addr = (uintptr_t)tb + r->addend;
+            break;
+        case TCG_HOST_SYM_CODE:
+            if (r->addend < 0 || r->addend > code_size) {
+                return false;
+            }
+            addr = (uintptr_t)code + r->addend;
+            break;
+        case TCG_HOST_SYM_EPILOGUE:
+            addr = (uintptr_t)tcg_ctx->code_gen_epilogue;
+            break;
+        case TCG_HOST_SYM_HELPER:
+            if (r->index >= ARRAY_SIZE(all_helpers)) {
+                return false;
+            }
+            addr = (uintptr_t)all_helpers[r->index].func;
+            break;
+        case TCG_HOST_SYM_TARGET:
+            addr = tcg_target_host_sym_addr(r->index);
+            if (!addr) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+
+        switch (r->type) {
+        case TCG_HOST_RELOC_PC32:
+            if ((size_t)r->offset + 4 > code_size) {
+                return false;
+            }
+            disp = addr - ((uintptr_t)place + 4);
+            if (disp != (int32_t)disp) {
+                return false;
+            }
+            tcg_patch32(place, disp);
+            break;
+        case TCG_HOST_RELOC_ABS64:
+            if ((size_t)r->offset + 8 > code_size) {
+                return false;
+            }
+            tcg_patch64(place, addr);
+            break;
+        default:
+            return false;
+        }
+    }
+
+    flush_icache_range((uintptr_t)code, (uintptr_t)code + code_size);
+    return true;
+}
+#else
+static void tcg_note_host_addr(TCGContext *s, TCGHostRelocType type,
+                               tcg_insn_unit *place, uintptr_t addr)
+{
+}
+
+bool tcg_host_relocs_supported(void)
+{
+    return false;
+}
+
+void tcg_host_fingerprint(GChecksum *checksum)
+{
+}
+
+bool tcg_relocate_host_code(void *code, size_t code_size,
+                            TranslationBlock *tb,
+                            const TCGHostReloc *relocs, int nb_relocs)
+{
+    return false;
+}
+#endif
+
 #ifdef CONFIG_PROFILER
 void tcg_dump_info(FILE *f, fprintf_function cpu_fprintf)
 {
@@ -628,6 +628,32 @@ typedef struct TCGOp {
 /* Make sure operands fit in the bitfields above.  */
 QEMU_BUILD_BUG_ON(NB_OPS > (1 << 8));
 
+/* Host addresses embedded in the code of a TB, recorded so that the code
+   can be saved to the persistent TB cache and moved to another address,
+   possibly in another process.  */
+#define TCG_MAX_HOST_RELOCS 256
+
+typedef enum TCGHostRelocType {
+    TCG_HOST_RELOC_PC32,        /* 32-bit displacement from the end */
+    TCG_HOST_RELOC_ABS64,       /* 64-bit absolute address */
+} TCGHostRelocType;
+
+typedef enum TCGHostSym {
+    TCG_HOST_SYM_TB,            /* the TranslationBlock */
+    TCG_HOST_SYM_CODE,          /* the code of the TB */
+    TCG_HOST_SYM_EPILOGUE,      /* code_gen_epilogue */
+    TCG_HOST_SYM_HELPER,        /* index in the helper table */
+    TCG_HOST_SYM_TARGET,        /* backend specific, see tcg_target_host_sym */
+} TCGHostSym;
+
+typedef struct TCGHostReloc {
+    uint32_t offset;            /* of the patched field in the code */
+    uint8_t type;               /* TCGHostRelocType */
+    uint8_t sym;                /* TCGHostSym */
+    uint16_t index;
+    int64_t addend;
+} TCGHostReloc;
+
 typedef struct TCGProfile {
     int64_t tb_count1;
     int64_t tb_count;
@@ -707,6 +733,18 @@ struct TCGContext {
 
     TCGLabel *exitreq_label;
 
+    /* Persistent TB cache: host addresses in the code of the current TB.
+       host_relocs_ok is cleared if any of them cannot be relocated.  */
+    bool host_relocs_enabled;
+    bool host_relocs_ok;
+    int nb_host_relocs;
+    TranslationBlock *host_relocs_tb;
+    TCGHostReloc host_relocs[TCG_MAX_HOST_RELOCS];
+
+    /* Execution counter of the current TB, when it is being profiled.
+       Helper calls are counted as well.  */
+    uint64_t *tb_exec_count;
+
     TCGTempSet free_temps[TCG_TYPE_COUNT * 2];
     TCGTemp temps[TCG_MAX_TEMPS]; /* globals first, temps after */
 
@@ -886,6 +924,12 @@ void tcg_func_start(TCGContext *s);
 
 int tcg_gen_code(TCGContext *s, TranslationBlock *tb);
 
+bool tcg_host_relocs_supported(void);
+void tcg_host_fingerprint(GChecksum *checksum);
+bool tcg_relocate_host_code(void *code, size_t code_size,
+                            TranslationBlock *tb,
+                            const TCGHostReloc *relocs, int nb_relocs);
+
 void tcg_set_frame(TCGContext *s, TCGReg reg, intptr_t start, intptr_t size);
 
 TCGTemp *tcg_global_mem_new_internal(TCGType, TCGv_ptr,
@@ -950,6 +994,11 @@ int tcg_check_temp_count(void);
 void tcg_dump_info(FILE *f, fprintf_function cpu_fprintf);
 void tcg_dump_op_count(FILE *f, fprintf_function cpu_fprintf);
 
+/* Execution profile: returns the name and the number of profiled calls of
+   helper @i, or NULL after the last helper.  */
+const char *tcg_helper_calls(int i, uint64_t *calls);
+void tcg_helper_calls_reset(void);
+
 #define TCG_CT_ALIAS  0x80
 #define TCG_CT_IALIAS 0x40
 #define TCG_CT_NEWREG 0x20 /* output requires a new register */
@@ -1009,11 +1058,20 @@ do {\
     abort();\
 } while (0)
 
+/* A host pointer loaded as a constant cannot be relocated, so the code of
+   the current TB cannot be saved to the persistent TB cache.  */
+static inline intptr_t tcg_host_const(intptr_t ptr)
+{
+    tcg_ctx->host_relocs_ok = false;
+    return ptr;
+}
+
 #if UINTPTR_MAX == UINT32_MAX
 static inline TCGv_ptr TCGV_NAT_TO_PTR(TCGv_i32 n) { return (TCGv_ptr)n; }
 static inline TCGv_i32 TCGV_PTR_TO_NAT(TCGv_ptr n) { return (TCGv_i32)n; }
 
-#define tcg_const_ptr(V) TCGV_NAT_TO_PTR(tcg_const_i32((intptr_t)(V)))
+#define tcg_const_ptr(V) \
+    TCGV_NAT_TO_PTR(tcg_const_i32(tcg_host_const((intptr_t)(V))))
 #define tcg_global_mem_new_ptr(R, O, N) \
     TCGV_NAT_TO_PTR(tcg_global_mem_new_i32((R), (O), (N)))
 #define tcg_temp_new_ptr() TCGV_NAT_TO_PTR(tcg_temp_new_i32())
@@ -1022,7 +1080,8 @@ static inline TCGv_i32 TCGV_PTR_TO_NAT(TCGv_ptr n) { return (TCGv_i32)n; }
 static inline TCGv_ptr TCGV_NAT_TO_PTR(TCGv_i64 n) { return (TCGv_ptr)n; }
 static inline TCGv_i64 TCGV_PTR_TO_NAT(TCGv_ptr n) { return (TCGv_i64)n; }
 
-#define tcg_const_ptr(V) TCGV_NAT_TO_PTR(tcg_const_i64((intptr_t)(V)))
+#define tcg_const_ptr(V) \
+    TCGV_NAT_TO_PTR(tcg_const_i64(tcg_host_const((intptr_t)(V))))
 #define tcg_global_mem_new_ptr(R, O, N) \
     TCGV_NAT_TO_PTR(tcg_global_mem_new_i64((R), (O), (N)))
 #define tcg_temp_new_ptr() TCGV_NAT_TO_PTR(tcg_temp_new_i64())
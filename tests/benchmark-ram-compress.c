@@ -0,0 +1,165 @@
+/*
+ * Migration RAM compression speed benchmark
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+#include "qemu/osdep.h"
+#include <zlib.h>
+#include "../migration/ram-compress.h"
+
+#define PAGE_SIZE 4096
+#define RAM_SIZE (64 * 1024 * 1024)
+
+typedef struct BenchCase {
+    const char *ops_name;
+    const MigrationCompressionOps *ops;
+    int threads;
+    int batch_pages;
+} BenchCase;
+
+typedef struct BenchResult {
+    uint64_t next_offset;
+    uint64_t zero_pages;
+    uint64_t bytes;
+} BenchResult;
+
+static uint8_t *ram;
+
+static ssize_t zlib_max_compressed_size(ssize_t size)
+{
+    return compressBound(size);
+}
+
+static ssize_t zlib_compress(uint8_t *dest, ssize_t dest_size,
+                             const uint8_t *data, ssize_t size, int level)
+{
+    uLongf dest_out = dest_size;
+
+    if (compress2(dest, &dest_out, data, size, level) != Z_OK) {
+        return -1;
+    }
+    return dest_out;
+}
+
+static ssize_t copy_max_compressed_size(ssize_t size)
+{
+    return size;
+}
+
+/* Measures the cost of the pipeline itself */
+static ssize_t copy_compress(uint8_t *dest, ssize_t dest_size,
+                             const uint8_t *data, ssize_t size, int level)
+{
+    memcpy(dest, data, size);
+    return size;
+}
+
+static const MigrationCompressionOps zlib_ops = {
+    .max_compressed_size = zlib_max_compressed_size,
+    .compress = zlib_compress,
+};
+
+static const MigrationCompressionOps copy_ops = {
+    .max_compressed_size = copy_max_compressed_size,
+    .compress = copy_compress,
+};
+
+/*
+ * A quarter of the pages are zero, the rest mixes runs of repeated words with
+ * random bytes, which compresses about as well as a booted Android guest.
+ */
+static void fill_ram(void)
+{
+    uint64_t i, j;
+
+    ram = g_malloc0(RAM_SIZE);
+    for (i = 0; i < RAM_SIZE; i += PAGE_SIZE) {
+        if (g_test_rand_int_range(0, 4) == 0) {
+            continue;
+        }
+        for (j = 0; j < PAGE_SIZE; j += 8) {
+            uint64_t word = g_test_rand_int_range(0, 2) ?
+                            g_test_rand_int() : j & 0xff0;
+            memcpy(ram + i + j, &word, sizeof(word));
+        }
+    }
+}
+
+static void put_page(void *opaque, void *tag, uint64_t offset,
+                     const uint8_t *data, ssize_t len)
+{
+    BenchResult *result = opaque;
+
+    g_assert_cmpuint(offset, ==, result->next_offset);
+    g_assert_cmpint(len, >=, 0);
+    result->next_offset += PAGE_SIZE;
+    if (len == 0) {
+        result->zero_pages++;
+    }
+    result->bytes += len;
+}
+
+static void test_compress_speed(const void *opaque)
+{
+    const BenchCase *bc = opaque;
+    BenchResult result = { 0 };
+    CompressPool *pool;
+    uint64_t offset;
+    double total;
+
+    pool = compress_pool_new(bc->threads, bc->batch_pages, PAGE_SIZE, 1,
+                             bc->ops, put_page, &result);
+
+    g_test_timer_start();
+    for (offset = 0; offset < RAM_SIZE; offset += PAGE_SIZE) {
+        compress_pool_queue(pool, NULL, offset, ram + offset);
+    }
+    compress_pool_flush(pool);
+    g_test_timer_elapsed();
+
+    compress_pool_free(pool);
+    g_assert_cmpuint(result.next_offset, ==, RAM_SIZE);
+
+    total = (double)RAM_SIZE / (1024 * 1024); /* to MB */
+    g_print("%s: threads %d batch %2d ", bc->ops_name, bc->threads,
+            bc->batch_pages);
+    g_print("done: %.2f MB in %.2f secs: ", total, g_test_timer_last());
+    g_print("%.2f MB/sec, %" PRIu64 " zero pages, ratio %.2f\n",
+            total / g_test_timer_last(), result.zero_pages,
+            (double)RAM_SIZE / MAX(result.bytes, 1));
+}
+
+int main(int argc, char **argv)
+{
+    static const int batches[] = { 1, 16 };
+    int threads, i;
+    char name[64];
+
+    g_test_init(&argc, &argv, NULL);
+    fill_ram();
+
+    for (threads = 1; threads <= 8; threads *= 2) {
+        for (i = 0; i < ARRAY_SIZE(batches); i++) {
+            BenchCase *zlib_case = g_new(BenchCase, 1);
+            BenchCase *copy_case = g_new(BenchCase, 1);
+
+            *zlib_case = (BenchCase) { "zlib", &zlib_ops, threads, batches[i] };
+            *copy_case = (BenchCase) { "copy", &copy_ops, threads, batches[i] };
+
+            snprintf(name, sizeof(name),
+                     "/migration/ram-compress/zlib/threads-%d/batch-%d",
+                     threads, batches[i]);
+            g_test_add_data_func(name, zlib_case, test_compress_speed);
+            snprintf(name, sizeof(name),
+                     "/migration/ram-compress/copy/threads-%d/batch-%d",
+                     threads, batches[i]);
+            g_test_add_data_func(name, copy_case, test_compress_speed);
+        }
+    }
+
+    return g_test_run();
+}
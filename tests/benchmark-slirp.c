@@ -0,0 +1,478 @@
+/*
+ * Slirp receive speed benchmark
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+#include "qemu/osdep.h"
+#include "qemu/sockets.h"
+#include "slirp/libslirp.h"
+#include "slirp/proxy.h"
+#include "migration/register.h"
+#include "monitor/monitor.h"
+#include "chardev/char-fe.h"
+
+/*
+ * iperf style downloads: a server on the host sends to a guest socket, and
+ * the benchmark measures how fast slirp turns that into frames for the
+ * guest.  For UDP the server sends bursts of datagrams.  For TCP the guest
+ * side is a minimal TCP receiver on the fake NIC, which acks everything
+ * slirp sent after each poll.
+ */
+#define DATAGRAMS (256 * 1024)
+#define BURST 64
+#define TCP_BYTES (512 * 1024 * 1024)
+#define TCP_GUEST_WINDOW (1024 * 1024)
+#define TCP_GUEST_WSCALE 5
+
+#define GUEST_PORT 5001
+#define ETH_ALEN 6
+
+#define TCP_FIN 0x01
+#define TCP_SYN 0x02
+#define TCP_RST 0x04
+#define TCP_ACK 0x10
+
+static const uint8_t guest_mac[ETH_ALEN] = {
+    0x52, 0x54, 0x00, 0x12, 0x34, 0x56
+};
+
+static size_t received_bytes;
+static size_t received_datagrams;
+
+/* The guest end of the TCP connection */
+static struct {
+    bool connected;
+    bool need_ack;
+    uint32_t snd_nxt;
+    uint32_t rcv_nxt;
+    uint32_t rcv_acked;
+    uint32_t max_unacked;
+    int peer_wscale;
+    size_t received;
+    size_t out_of_order;
+} guest_tcp;
+
+static uint32_t get_be32(const uint8_t *p)
+{
+    return (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24, p[1] = v >> 16, p[2] = v >> 8, p[3] = v;
+}
+
+static void guest_tcp_receive(const uint8_t *ip, int len)
+{
+    int ihl = (ip[0] & 0xf) * 4;
+    const uint8_t *tcp = ip + ihl;
+    int doff = (tcp[12] >> 4) * 4;
+    int flags = tcp[13];
+    uint32_t seq = get_be32(tcp + 4);
+    int data_len = ((ip[2] << 8) | ip[3]) - ihl - doff;
+    int i;
+
+    if (flags & TCP_RST) {
+        g_error("slirp reset the connection");
+    }
+    if (flags & TCP_SYN) {
+        /* Look for the window scale option */
+        guest_tcp.peer_wscale = -1;
+        for (i = 20; i < doff; i += tcp[i] <= 1 ? 1 : tcp[i + 1]) {
+            if (tcp[i] == 0) {
+                break;
+            }
+            if (tcp[i] == 3) {
+                guest_tcp.peer_wscale = tcp[i + 2];
+            }
+        }
+        guest_tcp.rcv_nxt = seq + 1;
+        guest_tcp.connected = true;
+        guest_tcp.need_ack = true;
+        return;
+    }
+    if (data_len > 0) {
+        if (seq == guest_tcp.rcv_nxt) {
+            guest_tcp.rcv_nxt += data_len;
+            guest_tcp.received += data_len;
+            guest_tcp.max_unacked = MAX(guest_tcp.max_unacked,
+                                        guest_tcp.rcv_nxt -
+                                        guest_tcp.rcv_acked);
+        } else {
+            guest_tcp.out_of_order++;
+        }
+        guest_tcp.need_ack = true;
+    }
+}
+
+void slirp_output(void *opaque, const uint8_t *pkt, int pkt_len)
+{
+    if (pkt_len <= 34 || pkt[12] != 0x08 || pkt[13] != 0x00) {
+        return;
+    }
+    switch (pkt[23]) {
+    case 17:    /* UDP */
+        received_bytes += pkt_len - 42;
+        received_datagrams++;
+        break;
+    case 6:     /* TCP */
+        guest_tcp_receive(pkt + 14, pkt_len - 14);
+        break;
+    }
+}
+
+int register_savevm_live(DeviceState *dev, const char *idstr,
+                         int instance_id, int version_id,
+                         SaveVMHandlers *ops, void *opaque)
+{
+    return 0;
+}
+
+void unregister_savevm(DeviceState *dev, const char *idstr, void *opaque)
+{
+}
+
+void monitor_printf(Monitor *mon, const char *fmt, ...)
+{
+}
+
+int qemu_chr_fe_write_all(CharBackend *be, const uint8_t *buf, int len)
+{
+    return len;
+}
+
+static bool bench_proxy_try_connect(const struct sockaddr_storage *addr,
+                                    SlirpProxyConnectFunc *connect_func,
+                                    void *connect_opaque)
+{
+    return false;
+}
+
+static void bench_proxy_remove(void *connect_opaque)
+{
+}
+
+static const SlirpProxyOps bench_proxy = {
+    .try_connect = bench_proxy_try_connect,
+    .remove = bench_proxy_remove,
+};
+
+static uint16_t ip_checksum(const uint8_t *p, size_t len)
+{
+    uint32_t sum = 0;
+    size_t i;
+
+    for (i = 0; i < len; i += 2) {
+        sum += (p[i] << 8) | p[i + 1];
+    }
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return ~sum;
+}
+
+/* Announce the guest, so that slirp can send frames to it */
+static void guest_send_arp(Slirp *slirp, struct in_addr guest)
+{
+    uint8_t frame[42];
+
+    memset(frame, 0, sizeof(frame));
+    memset(frame, 0xff, ETH_ALEN);
+    memcpy(frame + 6, guest_mac, ETH_ALEN);
+    frame[12] = 0x08, frame[13] = 0x06;
+    frame[15] = 1;                          /* Ethernet */
+    frame[16] = 0x08;                       /* IPv4 */
+    frame[18] = ETH_ALEN;
+    frame[19] = 4;
+    frame[21] = 1;                          /* request */
+    memcpy(frame + 22, guest_mac, ETH_ALEN);
+    memcpy(frame + 28, &guest, 4);
+    memcpy(frame + 38, &guest, 4);          /* gratuitous */
+    slirp_input(slirp, frame, sizeof(frame));
+}
+
+static uint16_t tcp_checksum(const uint8_t *ip, const uint8_t *tcp,
+                             size_t len)
+{
+    uint8_t pseudo[12];
+    uint32_t sum = 0;
+    size_t i;
+
+    memcpy(pseudo, ip + 12, 8);
+    pseudo[8] = 0;
+    pseudo[9] = 6;
+    pseudo[10] = len >> 8, pseudo[11] = len;
+    for (i = 0; i < sizeof(pseudo); i += 2) {
+        sum += (pseudo[i] << 8) | pseudo[i + 1];
+    }
+    for (i = 0; i < len; i += 2) {
+        sum += (tcp[i] << 8) | (i + 1 < len ? tcp[i + 1] : 0);
+    }
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return ~sum;
+}
+
+/*
+ * Sends a segment without data.  A SYN carries the MSS, and the window
+ * scale if |wscale| isn't negative.
+ */
+static void guest_send_tcp(Slirp *slirp, struct in_addr guest,
+                           struct in_addr host, uint16_t port, int flags,
+                           int wscale)
+{
+    uint8_t frame[14 + 20 + 20 + 8];
+    uint8_t *ip = frame + 14, *tcp = ip + 20;
+    int tcp_len = (flags & TCP_SYN) ? 28 : 20;
+    uint32_t window = TCP_GUEST_WINDOW;
+    uint16_t sum;
+
+    if (!(flags & TCP_SYN) && guest_tcp.peer_wscale >= 0 && wscale >= 0) {
+        window >>= wscale;
+    }
+    window = MIN(window, 65535);
+
+    memset(frame, 0, sizeof(frame));
+    memcpy(frame + 6, guest_mac, ETH_ALEN);
+    frame[12] = 0x08;
+    ip[0] = 0x45;
+    ip[3] = 20 + tcp_len;
+    ip[8] = 64;
+    ip[9] = 6;
+    memcpy(ip + 12, &guest, 4);
+    memcpy(ip + 16, &host, 4);
+    sum = ip_checksum(ip, 20);
+    ip[10] = sum >> 8, ip[11] = sum;
+
+    tcp[0] = GUEST_PORT >> 8, tcp[1] = GUEST_PORT & 0xff;
+    tcp[2] = port >> 8, tcp[3] = port & 0xff;
+    put_be32(tcp + 4, guest_tcp.snd_nxt);
+    if (flags & TCP_ACK) {
+        put_be32(tcp + 8, guest_tcp.rcv_nxt);
+        guest_tcp.rcv_acked = guest_tcp.rcv_nxt;
+    }
+    tcp[12] = (tcp_len / 4) << 4;
+    tcp[13] = flags;
+    tcp[14] = window >> 8, tcp[15] = window;
+    if (flags & TCP_SYN) {
+        tcp[20] = 2, tcp[21] = 4, tcp[22] = 1460 >> 8, tcp[23] = 1460 & 0xff;
+        tcp[24] = 1;                        /* NOP */
+        if (wscale >= 0) {
+            tcp[25] = 3, tcp[26] = 3, tcp[27] = wscale;
+        } else {
+            tcp[25] = 1, tcp[26] = 1, tcp[27] = 1;
+        }
+        guest_tcp.snd_nxt++;
+    }
+    sum = tcp_checksum(ip, tcp, tcp_len);
+    tcp[16] = sum >> 8, tcp[17] = sum;
+    slirp_input(slirp, frame, 14 + 20 + tcp_len);
+}
+
+static void guest_send_udp(Slirp *slirp, struct in_addr guest,
+                           struct in_addr host, uint16_t port)
+{
+    uint8_t frame[14 + 20 + 8 + 4];
+    uint8_t *ip = frame + 14, *udp = ip + 20;
+    uint16_t sum;
+
+    memset(frame, 0, sizeof(frame));
+    memcpy(frame + 6, guest_mac, ETH_ALEN);
+    frame[12] = 0x08;
+    ip[0] = 0x45;
+    ip[3] = sizeof(frame) - 14;
+    ip[8] = 64;
+    ip[9] = 17;
+    memcpy(ip + 12, &guest, 4);
+    memcpy(ip + 16, &host, 4);
+    sum = ip_checksum(ip, 20);
+    ip[10] = sum >> 8, ip[11] = sum;
+    udp[0] = GUEST_PORT >> 8, udp[1] = GUEST_PORT & 0xff;
+    udp[2] = port >> 8, udp[3] = port & 0xff;
+    udp[5] = 8 + 4;
+    memcpy(udp + 8, "ping", 4);
+    slirp_input(slirp, frame, sizeof(frame));
+}
+
+static int slirp_poll_once(GArray *pollfds)
+{
+    uint32_t timeout = UINT32_MAX;
+    int ret;
+
+    g_array_set_size(pollfds, 0);
+    slirp_pollfds_fill(pollfds, &timeout);
+    ret = g_poll((GPollFD *)pollfds->data, pollfds->len, 0);
+    slirp_pollfds_poll(pollfds, ret < 0);
+    return ret;
+}
+
+static void test_udp_speed(const void *opaque)
+{
+    size_t size = (size_t)opaque;
+    struct in_addr net = { .s_addr = htonl(0x0a000200) };
+    struct in_addr mask = { .s_addr = htonl(0xffffff00) };
+    struct in_addr host = { .s_addr = htonl(0x0a000202) };
+    struct in_addr dhcp = { .s_addr = htonl(0x0a00020f) };
+    struct in_addr dns = { .s_addr = htonl(0x0a000203) };
+    struct in6_addr none6 = IN6ADDR_ANY_INIT;
+    struct sockaddr_in server = { .sin_family = AF_INET };
+    struct sockaddr_storage client;
+    socklen_t len = sizeof(server);
+    GArray *pollfds = g_array_new(FALSE, FALSE, sizeof(GPollFD));
+    char *buf = g_malloc0(size);
+    size_t sent = 0;
+    double secs;
+    Slirp *slirp;
+    int fd, i;
+
+    slirp_proxy = &bench_proxy;
+    slirp = slirp_init(false, true, net, mask, host, false, none6, 0, none6,
+                       NULL, NULL, NULL, dhcp, dns, none6, NULL, NULL);
+
+    fd = qemu_socket(AF_INET, SOCK_DGRAM, 0);
+    g_assert(fd >= 0);
+    server.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    g_assert(bind(fd, (struct sockaddr *)&server, sizeof(server)) == 0);
+    g_assert(getsockname(fd, (struct sockaddr *)&server, &len) == 0);
+
+    /* The guest opens the connection, which tells the server its address */
+    guest_send_arp(slirp, dhcp);
+    guest_send_udp(slirp, dhcp, host, ntohs(server.sin_port));
+    len = sizeof(client);
+    g_assert(recvfrom(fd, buf, size, 0, (struct sockaddr *)&client,
+                      &len) == 4);
+
+    received_bytes = 0;
+    received_datagrams = 0;
+    g_test_timer_start();
+    while (sent < DATAGRAMS) {
+        for (i = 0; i < BURST; i++) {
+            if (sendto(fd, buf, size, 0, (struct sockaddr *)&client,
+                       len) == size) {
+                sent++;
+            }
+        }
+        while (slirp_poll_once(pollfds) > 0) {
+        }
+    }
+    secs = g_test_timer_elapsed();
+
+    g_print("%zu byte datagrams: %.2f MB/sec, %.2f Kpkt/sec, %zu%% received\n",
+            size, received_bytes / secs / 1024 / 1024,
+            received_datagrams / secs / 1000,
+            received_datagrams * 100 / sent);
+
+    closesocket(fd);
+    slirp_cleanup(slirp);
+    g_array_free(pollfds, TRUE);
+    g_free(buf);
+}
+
+/*
+ * |opaque| is the window scale the guest asks for, or -1 to leave the
+ * option out and get windows of at most 64KB.
+ */
+static void test_tcp_speed(const void *opaque)
+{
+    int wscale = (intptr_t)opaque;
+    struct in_addr net = { .s_addr = htonl(0x0a000200) };
+    struct in_addr mask = { .s_addr = htonl(0xffffff00) };
+    struct in_addr host = { .s_addr = htonl(0x0a000202) };
+    struct in_addr dhcp = { .s_addr = htonl(0x0a00020f) };
+    struct in_addr dns = { .s_addr = htonl(0x0a000203) };
+    struct in6_addr none6 = IN6ADDR_ANY_INIT;
+    struct sockaddr_in server = { .sin_family = AF_INET };
+    socklen_t len = sizeof(server);
+    GArray *pollfds = g_array_new(FALSE, FALSE, sizeof(GPollFD));
+    size_t size = 64 * 1024;
+    char *buf = g_malloc0(size);
+    size_t sent = 0;
+    uint16_t port;
+    double secs;
+    Slirp *slirp;
+    int lfd, fd;
+    ssize_t n;
+
+    slirp_proxy = &bench_proxy;
+    slirp = slirp_init(false, true, net, mask, host, false, none6, 0, none6,
+                       NULL, NULL, NULL, dhcp, dns, none6, NULL, NULL);
+
+    lfd = qemu_socket(AF_INET, SOCK_STREAM, 0);
+    g_assert(lfd >= 0);
+    server.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    g_assert(bind(lfd, (struct sockaddr *)&server, sizeof(server)) == 0);
+    g_assert(getsockname(lfd, (struct sockaddr *)&server, &len) == 0);
+    g_assert(listen(lfd, 1) == 0);
+    port = ntohs(server.sin_port);
+
+    /* The guest connects to the server */
+    memset(&guest_tcp, 0, sizeof(guest_tcp));
+    guest_tcp.snd_nxt = 1000;
+    guest_send_arp(slirp, dhcp);
+    guest_send_tcp(slirp, dhcp, host, port, TCP_SYN, wscale);
+    while (!guest_tcp.connected) {
+        slirp_poll_once(pollfds);
+    }
+    /* slirp scales its window only if the guest does */
+    g_assert_cmpint(guest_tcp.peer_wscale >= 0, ==, wscale >= 0);
+    guest_send_tcp(slirp, dhcp, host, port, TCP_ACK, wscale);
+    guest_tcp.need_ack = false;
+
+    fd = accept(lfd, NULL, NULL);
+    g_assert(fd >= 0);
+    qemu_set_nonblock(fd);
+
+    g_test_timer_start();
+    while (guest_tcp.received < TCP_BYTES) {
+        while (sent < TCP_BYTES &&
+               (n = send(fd, buf, MIN(size, TCP_BYTES - sent), 0)) > 0) {
+            sent += n;
+        }
+        slirp_poll_once(pollfds);
+        if (guest_tcp.need_ack) {
+            guest_tcp.need_ack = false;
+            guest_send_tcp(slirp, dhcp, host, port, TCP_ACK, wscale);
+        }
+    }
+    secs = g_test_timer_elapsed();
+    g_assert_cmpint(guest_tcp.out_of_order, ==, 0);
+    /* With scaling, slirp fills more than the 64KB an unscaled window
+     * allows.
+     */
+    g_assert_cmpint(guest_tcp.max_unacked > 65535, ==, wscale >= 0);
+
+    g_print("window scale %d: %.2f MB/sec, up to %u bytes in flight\n",
+            wscale, guest_tcp.received / secs / 1024 / 1024,
+            guest_tcp.max_unacked);
+
+    closesocket(fd);
+    closesocket(lfd);
+    slirp_cleanup(slirp);
+    g_array_free(pollfds, TRUE);
+    g_free(buf);
+}
+
+int main(int argc, char **argv)
+{
+    size_t sizes[] = { 64, 512, 1472 };
+    char name[64];
+    int i;
+
+    g_test_init(&argc, &argv, NULL);
+
+    for (i = 0; i < ARRAY_SIZE(sizes); i++) {
+        snprintf(name, sizeof(name), "/slirp/udp/speed/%zu", sizes[i]);
+        g_test_add_data_func(name, (void *)sizes[i], test_udp_speed);
+    }
+    g_test_add_data_func("/slirp/tcp/speed/unscaled", (void *)(intptr_t)-1,
+                         test_tcp_speed);
+    g_test_add_data_func("/slirp/tcp/speed/scaled",
+                         (void *)(intptr_t)TCP_GUEST_WSCALE, test_tcp_speed);
+
+    return g_test_run();
+}
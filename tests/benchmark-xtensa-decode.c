@@ -0,0 +1,210 @@
+/*
+ * Xtensa instruction decode speed benchmark
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+#include "qemu/osdep.h"
+#include "../target/xtensa/xtensa-decode.h"
+#include "../target/xtensa/xtensa-isa-internal.h"
+
+/* Instructions the firmware is made of, and instructions decoded per run */
+#define POOL_SIZE 8192
+#define STREAM_INSNS (1024 * 1024)
+
+typedef struct BenchCore {
+    const char *name;
+    xtensa_isa_internal *modules;
+} BenchCore;
+
+extern xtensa_isa_internal xtensa_modules_dc232b;
+extern xtensa_isa_internal xtensa_modules_dc233c;
+extern xtensa_isa_internal xtensa_modules_de212;
+extern xtensa_isa_internal xtensa_modules_fsf;
+extern xtensa_isa_internal xtensa_modules_sample_controller;
+
+static const BenchCore cores[] = {
+    { "dc232b", &xtensa_modules_dc232b },
+    { "dc233c", &xtensa_modules_dc233c },
+    { "de212", &xtensa_modules_de212 },
+    { "fsf", &xtensa_modules_fsf },
+    { "sample_controller", &xtensa_modules_sample_controller },
+};
+
+/* What the translator did for each instruction before the decode cache */
+static bool decode_uncached(xtensa_isa isa, xtensa_insnbuf insnbuf,
+                            xtensa_insnbuf slotbuf, const unsigned char *b,
+                            unsigned len, uint32_t pc, uint32_t *sum)
+{
+    xtensa_format fmt;
+    int slot, slots;
+
+    xtensa_insnbuf_from_chars(isa, insnbuf, b, len);
+    fmt = xtensa_format_decode(isa, insnbuf);
+    if (fmt == XTENSA_UNDEFINED) {
+        return false;
+    }
+    slots = xtensa_format_num_slots(isa, fmt);
+    for (slot = 0; slot < slots; ++slot) {
+        xtensa_opcode opc;
+        int opnd, opnds;
+
+        xtensa_format_get_slot(isa, fmt, slot, insnbuf, slotbuf);
+        opc = xtensa_opcode_decode(isa, fmt, slot, slotbuf);
+        if (opc == XTENSA_UNDEFINED) {
+            return false;
+        }
+        *sum += opc;
+        opnds = xtensa_opcode_num_operands(isa, opc);
+        for (opnd = 0; opnd < opnds; ++opnd) {
+            if (xtensa_operand_is_visible(isa, opc, opnd)) {
+                uint32_t v;
+
+                xtensa_operand_get_field(isa, opc, opnd, fmt, slot,
+                                         slotbuf, &v);
+                xtensa_operand_decode(isa, opc, opnd, &v);
+                if (xtensa_operand_is_PCrelative(isa, opc, opnd)) {
+                    xtensa_operand_undo_reloc(isa, opc, opnd, &v, pc);
+                }
+                *sum += v;
+            }
+        }
+    }
+    return true;
+}
+
+static bool decode_cached(xtensa_isa isa, XtensaDecodeCache *cache,
+                          const unsigned char *b, unsigned len, uint32_t pc,
+                          uint32_t *sum)
+{
+    const XtensaDecodedInsn *insn;
+    unsigned slot, i;
+    int bad_slot;
+
+    insn = xtensa_decode_cache_lookup(cache, b, len, &bad_slot);
+    if (!insn) {
+        return false;
+    }
+    for (slot = 0; slot < insn->nb_slots; ++slot) {
+        const XtensaDecodedSlot *s = &insn->slot[slot];
+
+        *sum += s->opc;
+        for (i = 0; i < s->nb_args; ++i) {
+            uint32_t v = s->arg[i];
+
+            if (s->pcrel & (1u << i)) {
+                xtensa_operand_undo_reloc(isa, s->opc, s->opnd[i], &v, pc);
+            }
+            *sum += v;
+        }
+    }
+    return true;
+}
+
+/*
+ * Firmware made of random valid instructions, where a few instructions are
+ * used much more often than the others, as in real code.
+ */
+static unsigned char *make_stream(xtensa_isa isa, size_t *size)
+{
+    xtensa_insnbuf insnbuf = xtensa_insnbuf_alloc(isa);
+    xtensa_insnbuf slotbuf = xtensa_insnbuf_alloc(isa);
+    unsigned maxlen = xtensa_isa_maxlength(isa);
+    unsigned char *pool = g_malloc(POOL_SIZE * maxlen);
+    unsigned *pool_len = g_new(unsigned, POOL_SIZE);
+    unsigned char *stream = g_malloc(STREAM_INSNS * maxlen);
+    unsigned n = 0, i;
+    uint32_t sum = 0;
+
+    while (n < POOL_SIZE) {
+        unsigned char *b = pool + n * maxlen;
+        int len;
+
+        for (i = 0; i < maxlen; ++i) {
+            b[i] = g_test_rand_int();
+        }
+        len = xtensa_isa_length_from_chars(isa, b);
+        if (len != XTENSA_UNDEFINED &&
+            decode_uncached(isa, insnbuf, slotbuf, b, len, 0, &sum)) {
+            pool_len[n++] = len;
+        }
+    }
+
+    *size = 0;
+    for (i = 0; i < STREAM_INSNS; ++i) {
+        unsigned j = g_test_rand_int_range(0, g_test_rand_int_range(1,
+                                                                POOL_SIZE));
+
+        memcpy(stream + *size, pool + j * maxlen, pool_len[j]);
+        *size += pool_len[j];
+    }
+
+    g_free(pool);
+    g_free(pool_len);
+    xtensa_insnbuf_free(isa, insnbuf);
+    xtensa_insnbuf_free(isa, slotbuf);
+    return stream;
+}
+
+static void test_decode_speed(const void *opaque)
+{
+    const BenchCore *core = opaque;
+    xtensa_isa isa = xtensa_isa_init(core->modules, NULL, NULL);
+    xtensa_insnbuf insnbuf = xtensa_insnbuf_alloc(isa);
+    xtensa_insnbuf slotbuf = xtensa_insnbuf_alloc(isa);
+    XtensaDecodeCache *cache = xtensa_decode_cache_new(isa);
+    uint32_t sum_uncached = 0, sum_cached = 0;
+    double uncached_secs, cached_secs;
+    unsigned char *stream;
+    size_t size, pc;
+    int len;
+
+    stream = make_stream(isa, &size);
+
+    g_test_timer_start();
+    for (pc = 0; pc < size; pc += len) {
+        len = xtensa_isa_length_from_chars(isa, stream + pc);
+        g_assert(decode_uncached(isa, insnbuf, slotbuf, stream + pc, len, pc,
+                                 &sum_uncached));
+    }
+    uncached_secs = g_test_timer_elapsed();
+
+    g_test_timer_start();
+    for (pc = 0; pc < size; pc += len) {
+        len = xtensa_isa_length_from_chars(isa, stream + pc);
+        g_assert(decode_cached(isa, cache, stream + pc, len, pc,
+                               &sum_cached));
+    }
+    cached_secs = g_test_timer_elapsed();
+
+    g_assert_cmpuint(sum_uncached, ==, sum_cached);
+    g_print("%s: %d insns: uncached %.2f Minsn/sec, cached %.2f Minsn/sec, "
+            "speedup %.1fx\n", core->name, STREAM_INSNS,
+            STREAM_INSNS / uncached_secs / 1e6,
+            STREAM_INSNS / cached_secs / 1e6,
+            uncached_secs / cached_secs);
+
+    g_free(stream);
+    xtensa_decode_cache_free(cache);
+    xtensa_insnbuf_free(isa, insnbuf);
+    xtensa_insnbuf_free(isa, slotbuf);
+    xtensa_isa_free(isa);
+}
+
+int main(int argc, char **argv)
+{
+    char name[64];
+    int i;
+
+    g_test_init(&argc, &argv, NULL);
+
+    for (i = 0; i < ARRAY_SIZE(cores); i++) {
+        snprintf(name, sizeof(name), "/xtensa/decode/%s", cores[i].name);
+        g_test_add_data_func(name, &cores[i], test_decode_speed);
+    }
+
+    return g_test_run();
+}
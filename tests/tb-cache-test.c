@@ -0,0 +1,85 @@
+/*
+ * Persistent TB cache test
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ */
+
+#include "qemu/osdep.h"
+#include "libqtest.h"
+
+/* Returns the number that follows @name= in "info jit" */
+static uint64_t jit_stat(const char *name)
+{
+    char *info = hmp("info jit");
+    char *key = g_strdup_printf("%s=", name);
+    const char *p = strstr(info, key);
+    uint64_t value;
+
+    g_assert(p);
+    value = g_ascii_strtoull(p + strlen(key), NULL, 10);
+    g_free(key);
+    g_free(info);
+    return value;
+}
+
+/* Runs the BIOS until @name reaches @min, and shuts down, which saves the
+   cache.  */
+static uint64_t run_bios(const char *cache, int tb_size_mb, const char *name,
+                         uint64_t min)
+{
+    char *args = g_strdup_printf("-M pc -accel tcg,tb-cache=%s -tb-size %d",
+                                 cache, tb_size_mb);
+    uint64_t value = 0;
+    int i;
+
+    qtest_start(args);
+    for (i = 0; i < 1000; i++) {
+        value = jit_stat(name);
+        if (value >= min) {
+            break;
+        }
+        g_usleep(10 * 1000);
+    }
+    qtest_end();
+    g_free(args);
+    return value;
+}
+
+/*
+ * The second run maps a code buffer of another size, so the TBs are loaded
+ * at other host addresses than they were translated at, and only work if
+ * they were relocated.
+ */
+static void test_round_trip(void)
+{
+    char cache[] = "/tmp/qtest-tb-cache-XXXXXX";
+    int fd = mkstemp(cache);
+    struct stat st;
+
+    g_assert(fd != -1);
+    close(fd);
+    /* The cache is created when it is saved */
+    unlink(cache);
+
+    g_assert_cmpuint(run_bios(cache, 32, "stored", 100), >=, 100);
+    g_assert(stat(cache, &st) == 0 && st.st_size > 0);
+
+    g_assert_cmpuint(run_bios(cache, 64, "hits", 100), >=, 100);
+
+    unlink(cache);
+}
+
+int main(int argc, char **argv)
+{
+    g_test_init(&argc, &argv, NULL);
+
+    /* TBs can only be relocated by the x86-64 backend */
+#if defined(__x86_64__)
+    qtest_add_func("tb-cache/round-trip", test_round_trip);
+#endif
+
+    return g_test_run();
+}
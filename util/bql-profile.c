@@ -0,0 +1,379 @@
+/*
+ * Big QEMU lock contention profile
+ *
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+
+#include "qemu/osdep.h"
+#include "qemu-common.h"
+#include "qemu/bql-profile.h"
+#include "qemu/host-utils.h"
+#include "qemu/thread.h"
+#include "qemu/thread_local.h"
+
+/*
+ * Each thread that takes the lock gets a BQLProfileThread, which only that
+ * thread writes to, and which is never freed so that the report still
+ * includes threads that have exited.  The report reads the tables of all
+ * threads without synchronization, so it may be off by the acquisitions
+ * that are in flight.
+ *
+ * Resetting bumps bql_profile_generation; a thread clears its own table
+ * the next time it records something for an older generation.
+ */
+
+/* log2 of the duration in ticks; the last bucket takes the rest */
+#define BQL_PROFILE_BUCKETS 40
+/* Call sites per thread, beyond which they are all counted as one */
+#define BQL_PROFILE_SITES 64
+
+typedef struct BQLProfileTimes {
+    uint64_t total;
+    uint64_t max;
+    uint64_t hist[BQL_PROFILE_BUCKETS];
+} BQLProfileTimes;
+
+typedef struct BQLProfileSite {
+    const char *file;
+    int line;
+    uint64_t count;
+    BQLProfileTimes wait;
+    BQLProfileTimes hold;
+} BQLProfileSite;
+
+typedef struct BQLProfileThread {
+    struct BQLProfileThread *next;
+    unsigned generation;
+    BQLProfileSite *held;
+    BQLProfileSite *suspended;
+    int64_t hold_start;
+    BQLProfileSite sites[BQL_PROFILE_SITES];
+    BQLProfileSite other;
+} BQLProfileThread;
+
+bool bql_profile_enabled;
+
+static unsigned bql_profile_generation;
+static double bql_profile_ticks_per_us = 1;
+static int64_t bql_profile_reset_ns;
+static void (*bql_profile_trace_counter)(const char *name, int64_t value);
+
+static QemuMutex bql_profile_threads_lock;
+static BQLProfileThread *bql_profile_threads;
+
+QEMU_THREAD_LOCAL_DECLARE_INIT(BQLProfileThread *, bql_profile_thread, NULL);
+
+static void __attribute__((constructor)) bql_profile_init(void)
+{
+    qemu_mutex_init(&bql_profile_threads_lock);
+}
+
+static BQLProfileThread *bql_profile_get_thread(void)
+{
+    BQLProfileThread *t = QEMU_THREAD_LOCAL_GET(bql_profile_thread);
+    unsigned generation = atomic_read(&bql_profile_generation);
+
+    if (unlikely(!t)) {
+        t = g_new0(BQLProfileThread, 1);
+        t->generation = generation;
+        qemu_mutex_lock(&bql_profile_threads_lock);
+        t->next = bql_profile_threads;
+        atomic_mb_set(&bql_profile_threads, t);
+        qemu_mutex_unlock(&bql_profile_threads_lock);
+        QEMU_THREAD_LOCAL_SET(bql_profile_thread, t);
+    } else if (unlikely(t->generation != generation)) {
+        t->held = NULL;
+        t->suspended = NULL;
+        memset(t->sites, 0, sizeof(t->sites));
+        memset(&t->other, 0, sizeof(t->other));
+        atomic_mb_set(&t->generation, generation);
+    }
+    return t;
+}
+
+static BQLProfileSite *bql_profile_find_site(BQLProfileThread *t,
+                                             const char *file, int line)
+{
+    unsigned h = ((uintptr_t)file >> 3) * 31 + line;
+    int i;
+
+    for (i = 0; i < BQL_PROFILE_SITES; i++) {
+        BQLProfileSite *site = &t->sites[(h + i) % BQL_PROFILE_SITES];
+
+        if (site->file == file && site->line == line) {
+            return site;
+        }
+        if (!site->file) {
+            site->line = line;
+            atomic_mb_set(&site->file, file);
+            return site;
+        }
+    }
+    t->other.file = "(other)";
+    return &t->other;
+}
+
+static void bql_profile_add(BQLProfileTimes *times, int64_t ticks)
+{
+    uint64_t d = MAX(ticks, 0);
+    int bucket = d ? 64 - clz64(d) : 0;
+
+    times->total += d;
+    times->max = MAX(times->max, d);
+    times->hist[MIN(bucket, BQL_PROFILE_BUCKETS - 1)]++;
+}
+
+static int64_t bql_profile_ticks_to_us(uint64_t ticks)
+{
+    return ticks / bql_profile_ticks_per_us;
+}
+
+void bql_profile_locked(const char *file, int line, int64_t start)
+{
+    BQLProfileThread *t = bql_profile_get_thread();
+    BQLProfileSite *site = bql_profile_find_site(t, file, line);
+    int64_t now = cpu_get_host_ticks();
+
+    site->count++;
+    bql_profile_add(&site->wait, now - start);
+    t->held = site;
+    t->hold_start = now;
+
+    if (bql_profile_trace_counter) {
+        bql_profile_trace_counter("bql-wait-us",
+                                  bql_profile_ticks_to_us(now - start));
+    }
+}
+
+void bql_profile_unlocked(bool suspend)
+{
+    BQLProfileThread *t = QEMU_THREAD_LOCAL_GET(bql_profile_thread);
+    int64_t hold;
+
+    if (!t || !t->held) {
+        return;
+    }
+    if (t->generation != atomic_read(&bql_profile_generation)) {
+        /* Reset while the lock was held; the hold goes with it */
+        bql_profile_get_thread();
+        return;
+    }
+
+    hold = cpu_get_host_ticks() - t->hold_start;
+    bql_profile_add(&t->held->hold, hold);
+    t->suspended = suspend ? t->held : NULL;
+    t->held = NULL;
+
+    if (bql_profile_trace_counter) {
+        bql_profile_trace_counter("bql-hold-us",
+                                  bql_profile_ticks_to_us(hold));
+    }
+}
+
+void bql_profile_relocked(void)
+{
+    BQLProfileThread *t = QEMU_THREAD_LOCAL_GET(bql_profile_thread);
+
+    if (!t || !t->suspended ||
+        t->generation != atomic_read(&bql_profile_generation)) {
+        return;
+    }
+    t->held = t->suspended;
+    t->suspended = NULL;
+    t->hold_start = cpu_get_host_ticks();
+}
+
+static void bql_profile_calibrate(void)
+{
+    int64_t ns0 = get_clock(), ticks0 = cpu_get_host_ticks();
+    int64_t ns, ticks;
+
+    do {
+        ns = get_clock();
+        ticks = cpu_get_host_ticks();
+    } while (ns - ns0 < SCALE_MS);
+
+    bql_profile_ticks_per_us = MAX((double)(ticks - ticks0) * 1000 /
+                                   (ns - ns0), 1e-3);
+}
+
+void bql_profile_set(bool enable)
+{
+    if (enable && !atomic_read(&bql_profile_enabled)) {
+        bql_profile_calibrate();
+        if (!bql_profile_reset_ns) {
+            bql_profile_reset_ns = get_clock();
+        }
+    }
+    atomic_set(&bql_profile_enabled, enable);
+}
+
+void bql_profile_reset(void)
+{
+    atomic_inc(&bql_profile_generation);
+    bql_profile_reset_ns = get_clock();
+}
+
+void bql_profile_set_trace_counter(void (*counter)(const char *name,
+                                                   int64_t value))
+{
+    bql_profile_trace_counter = counter;
+}
+
+/* Call sites of all threads, merged by name */
+typedef struct BQLProfileEntry {
+    char *name;
+    BQLProfileSite total;
+} BQLProfileEntry;
+
+static void bql_profile_merge_times(BQLProfileTimes *dst,
+                                    const BQLProfileTimes *src)
+{
+    int i;
+
+    dst->total += src->total;
+    dst->max = MAX(dst->max, src->max);
+    for (i = 0; i < BQL_PROFILE_BUCKETS; i++) {
+        dst->hist[i] += src->hist[i];
+    }
+}
+
+static void bql_profile_merge_site(GHashTable *entries,
+                                   const BQLProfileSite *site)
+{
+    const char *file = atomic_read(&site->file);
+    BQLProfileEntry *e;
+    char *name;
+
+    if (!file || !site->count) {
+        return;
+    }
+    name = site->line ? g_strdup_printf("%s:%d", file, site->line) :
+                        g_strdup(file);
+    e = g_hash_table_lookup(entries, name);
+    if (!e) {
+        e = g_new0(BQLProfileEntry, 1);
+        e->name = name;
+        g_hash_table_insert(entries, name, e);
+    } else {
+        g_free(name);
+    }
+    e->total.count += site->count;
+    bql_profile_merge_times(&e->total.wait, &site->wait);
+    bql_profile_merge_times(&e->total.hold, &site->hold);
+}
+
+static void bql_profile_free_entry(gpointer p)
+{
+    BQLProfileEntry *e = p;
+
+    g_free(e->name);
+    g_free(e);
+}
+
+static gint bql_profile_cmp_hold(gconstpointer a, gconstpointer b)
+{
+    const BQLProfileEntry *ea = *(BQLProfileEntry *const *)a;
+    const BQLProfileEntry *eb = *(BQLProfileEntry *const *)b;
+
+    return ea->total.hold.total < eb->total.hold.total ? 1 :
+           ea->total.hold.total > eb->total.hold.total ? -1 : 0;
+}
+
+/* Upper bound of the bucket that holds the @percent percentile, in us */
+static int64_t bql_profile_percentile(const BQLProfileTimes *times,
+                                      uint64_t count, int percent)
+{
+    uint64_t seen = 0, target = (count * percent + 99) / 100;
+    int i;
+
+    for (i = 0; i < BQL_PROFILE_BUCKETS - 1; i++) {
+        seen += times->hist[i];
+        if (seen >= target) {
+            return MIN(bql_profile_ticks_to_us(1ULL << i),
+                       bql_profile_ticks_to_us(times->max));
+        }
+    }
+    return bql_profile_ticks_to_us(times->max);
+}
+
+void bql_profile_dump_info(FILE *f, fprintf_function cpu_fprintf, int count)
+{
+    GHashTable *entries = g_hash_table_new_full(g_str_hash, g_str_equal,
+                                                NULL, bql_profile_free_entry);
+    unsigned generation = atomic_read(&bql_profile_generation);
+    uint64_t acquires = 0, wait = 0, hold = 0;
+    int64_t elapsed_us;
+    BQLProfileThread *t;
+    GPtrArray *sorted;
+    GHashTableIter iter;
+    gpointer value;
+    int i;
+
+    if (!bql_profile_reset_ns) {
+        cpu_fprintf(f, "BQL profile not started, use \"bql-profile on\"\n");
+        g_hash_table_destroy(entries);
+        return;
+    }
+
+    for (t = atomic_rcu_read(&bql_profile_threads); t; t = t->next) {
+        if (atomic_read(&t->generation) != generation) {
+            continue;
+        }
+        for (i = 0; i < BQL_PROFILE_SITES; i++) {
+            bql_profile_merge_site(entries, &t->sites[i]);
+        }
+        bql_profile_merge_site(entries, &t->other);
+    }
+
+    sorted = g_ptr_array_new();
+    g_hash_table_iter_init(&iter, entries);
+    while (g_hash_table_iter_next(&iter, NULL, &value)) {
+        BQLProfileEntry *e = value;
+
+        acquires += e->total.count;
+        wait += e->total.wait.total;
+        hold += e->total.hold.total;
+        g_ptr_array_add(sorted, e);
+    }
+    g_ptr_array_sort(sorted, bql_profile_cmp_hold);
+
+    elapsed_us = MAX((get_clock() - bql_profile_reset_ns) / SCALE_US, 1);
+    cpu_fprintf(f, "BQL profile%s: %" PRIu64 " acquisitions in %" PRId64
+                " ms, held %.1f%% of the time, %" PRId64 " ms spent waiting\n",
+                atomic_read(&bql_profile_enabled) ? "" : " (stopped)",
+                acquires, elapsed_us / 1000,
+                bql_profile_ticks_to_us(hold) * 100.0 / elapsed_us,
+                bql_profile_ticks_to_us(wait) / 1000);
+    cpu_fprintf(f, "%-40s %10s %27s %27s\n", "", "",
+                "wait us (avg/p50/p99/max)", "hold us (avg/p50/p99/max)");
+    cpu_fprintf(f, "%-40s %10s %6s %6s %6s %6s %6s %6s %6s %6s\n",
+                "call site", "count", "avg", "p50", "p99", "max",
+                "avg", "p50", "p99", "max");
+
+    for (i = 0; i < (int)sorted->len && i < count; i++) {
+        BQLProfileEntry *e = g_ptr_array_index(sorted, i);
+        const BQLProfileSite *s = &e->total;
+        size_t len = strlen(e->name);
+
+        cpu_fprintf(f, "%-40s %10" PRIu64
+                    " %6" PRId64 " %6" PRId64 " %6" PRId64 " %6" PRId64
+                    " %6" PRId64 " %6" PRId64 " %6" PRId64 " %6" PRId64 "\n",
+                    len > 40 ? e->name + len - 40 : e->name, s->count,
+                    bql_profile_ticks_to_us(s->wait.total / s->count),
+                    bql_profile_percentile(&s->wait, s->count, 50),
+                    bql_profile_percentile(&s->wait, s->count, 99),
+                    bql_profile_ticks_to_us(s->wait.max),
+                    bql_profile_ticks_to_us(s->hold.total / s->count),
+                    bql_profile_percentile(&s->hold, s->count, 50),
+                    bql_profile_percentile(&s->hold, s->count, 99),
+                    bql_profile_ticks_to_us(s->hold.max));
+    }
+
+    g_ptr_array_free(sorted, TRUE);
+    g_hash_table_destroy(entries);
+}
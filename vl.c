@@ -444,6 +444,21 @@ static QemuOptsList qemu_accel_opts = {
             .type = QEMU_OPT_STRING,
             .help = "Enable/disable multi-threaded TCG",
         },
+        {
+            .name = "tb-cache",
+            .type = QEMU_OPT_STRING,
+            .help = "File to keep translated code in across runs",
+        },
+        {
+            .name = "tb-cache-size",
+            .type = QEMU_OPT_SIZE,
+            .help = "Maximum size of the tb-cache file",
+        },
+        {
+            .name = "profile",
+            .type = QEMU_OPT_BOOL,
+            .help = "Count how often each translation block is executed",
+        },
         { /* end of list */ }
     },
 };